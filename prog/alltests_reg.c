@@ -92,6 +92,7 @@ static const char *tests[] = {
                               "conversion",
                               "convolve",
                               "crop",
+                              "deflate",
                               "dewarp",
                               "distance",
                               "dither",
@@ -152,6 +153,7 @@ static const char *tests[] = {
                               "paint",
                               "paintmask",
                               "partition",
+                              "pboxa",
                               "pdfio1",
                               "pdfio2",
                               "pdfseg",
@@ -177,6 +179,7 @@ static const char *tests[] = {
                               "rasterop",
                               "rasteropip",
                               "rectangle",
+                              "rlpix",
                               "rotate1",
                               "rotate2",
                               "rotateorth",
@@ -193,6 +196,8 @@ static const char *tests[] = {
                               "subpixel",
                               "texturefill",
                               "threshnorm",
+                              "tiffbands",
+                              "tiffindex",
                               "translate",
                               "warper",
                               "watershed",
@@ -54,8 +54,11 @@ static void PixTest3(PIX *pixs, l_int32 size, l_float32 factor,
 int main(int    argc,
          const char **argv)
 {
-PIX          *pixs, *pix1, *pix2;
+l_int32       ret;
+FPIXA        *fpixa;
+PIX          *pixs, *pix1, *pix2, *pix3, *pix4;
 PIXA         *pixa;
+L_INTEGRAL   *ii;
 L_REGPARAMS* rp;
 
 	if (regTestSetup(argc, argv, "binarize", NULL, &rp))
@@ -96,6 +99,50 @@ L_REGPARAMS* rp;
     pixaDestroy(&pixa);
     pixDestroy(&pix2);
 
+        /* Sauvola with a shared integral image, compared with the
+         * local mean and the binarization made without it */
+    pix3 = pixAddMirroredBorder(pixs, 8, 8, 8, 8);
+    ii = integralCreate(pix3, 1);
+    pixSauvolaBinarize(pixs, 7, 0.34, 1, &pix1, NULL, NULL, &pix2);
+    pix4 = integralWindowedMean(ii, 7, 7, 1);
+    regTestComparePix(rp, pix1, pix4);  /* 33 */
+    pixDestroy(&pix1);
+    pixDestroy(&pix4);
+    pixSauvolaBinarizeIntegral(pix3, ii, 7, 0.34, NULL, NULL, NULL, &pix1);
+    regTestComparePix(rp, pix1, pix2);  /* 34 */
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    pixDestroy(&pix3);
+    integralDestroy(&ii);
+
+        /* Streaming Sauvola, in one band and in several bands */
+    pixSauvolaBinarize(pixs, 7, 0.34, 1, NULL, NULL, &pix1, &pix2);
+    pixSauvolaBinarizeStream(pixs, 7, 0.34, 1, &pix3, &pix4);
+    regTestComparePix(rp, pix1, pix3);  /* 35 */
+    regTestComparePix(rp, pix2, pix4);  /* 36 */
+    pixDestroy(&pix3);
+    pixDestroy(&pix4);
+    pixSauvolaBinarizeStream(pixs, 7, 0.34, 5, &pix3, &pix4);
+    regTestComparePix(rp, pix1, pix3);  /* 37 */
+    regTestComparePix(rp, pix2, pix4);  /* 38 */
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    pixDestroy(&pix3);
+    pixDestroy(&pix4);
+
+        /* The quadtree statistics need an integral image of 8 bpp */
+    pix1 = pixThresholdToBinary(pixs, 128);
+    ii = integralCreate(pix1, 1);
+    lept_stderr("******************************************************\n");
+    lept_stderr("* The next 2 error messages are intentional          *\n");
+    ret = integralQuadtreeMean(ii, 2, &fpixa);
+    regTestCompareValues(rp, 1, ret, 0);  /* 39 */
+    ret = integralQuadtreeVariance(ii, 2, &fpixa, NULL);
+    regTestCompareValues(rp, 1, ret, 0);  /* 40 */
+    lept_stderr("******************************************************\n");
+    integralDestroy(&ii);
+    pixDestroy(&pix1);
+
     pixDestroy(&pixs);
     return regTestCleanup(rp);
 }
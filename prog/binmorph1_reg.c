@@ -57,6 +57,11 @@
  *  (3) The 2-way Sel decomposition functions, implemented with the
  *      separable brick interface, are tested separately against
  *      the rasterop brick.  See binmorph2_reg.c.
+ *
+ *  (4) Solid bricks that are long enough use a doubling method.
+ *      TestLogBricks() compares it with the fused implementation,
+ *      which is used for the same brick with an added don't-care
+ *      element.
  */
 
 #include "demo_settings.h"
@@ -69,6 +74,11 @@
 #define    HEIGHT           15    /* brick sel height */
 
 static void TestAll(L_REGPARAMS *rp, PIX *pix, l_int32 symmetric);
+static void TestLogBricks(L_REGPARAMS *rp, PIX *pixs, l_int32 symmetric);
+
+    /* Brick sizes for the doubling method */
+static const l_int32  NLogSizes = 7;
+static const l_int32  LogSizes[] = {5, 8, 31, 64, 100, 151, 257};
 
 
 #if defined(BUILD_MONOLITHIC)
@@ -88,6 +98,8 @@ L_REGPARAMS* rp;
 
     TestAll(rp, pixs, FALSE);
     TestAll(rp, pixs, TRUE);
+    TestLogBricks(rp, pixs, FALSE);
+    TestLogBricks(rp, pixs, TRUE);
     pixDestroy(&pixs);
     return regTestCleanup(rp);
 }
@@ -580,3 +592,59 @@ SEL     *sel;
     selDestroy(&sel);
 }
 
+
+static void
+TestLogBricks(L_REGPARAMS  *rp,
+              PIX          *pixs,
+              l_int32       symmetric)
+{
+l_int32  i, n;
+PIX     *pix1, *pix2, *pix3, *pix4;
+SEL     *sel1, *sel2;
+
+    resetMorphBoundaryCondition((symmetric) ? SYMMETRIC_MORPH_BC :
+                                              ASYMMETRIC_MORPH_BC);
+    for (i = 0; i < 2 * NLogSizes; i++) {
+        n = LogSizes[i / 2];
+        if (i & 1) {  /* vertical */
+            sel1 = selCreateBrick(n, 1, n / 2, 0, SEL_HIT);
+            sel2 = selCreateBrick(n + 1, 1, n / 2, 0, SEL_HIT);
+            selSetElement(sel2, n, 0, SEL_DONT_CARE);
+        } else {  /* horizontal */
+            sel1 = selCreateBrick(1, n, 0, n / 2, SEL_HIT);
+            sel2 = selCreateBrick(1, n + 1, 0, n / 2, SEL_HIT);
+            selSetElement(sel2, 0, n, SEL_DONT_CARE);
+        }
+        pix1 = pixDilate(NULL, pixs, sel1);
+        pix2 = pixDilate(NULL, pixs, sel2);
+        pix3 = pixErode(NULL, pixs, sel1);
+        pix4 = pixErode(NULL, pixs, sel2);
+        regTestComparePix(rp, pix1, pix2);
+        regTestComparePix(rp, pix3, pix4);
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        pixDestroy(&pix3);
+        pixDestroy(&pix4);
+        selDestroy(&sel1);
+        selDestroy(&sel2);
+    }
+
+        /* Separable, with an origin that is not centered */
+    sel1 = selCreateBrick(37, 90, 5, 80, SEL_HIT);
+    sel2 = selCreateBrick(38, 90, 5, 80, SEL_HIT);
+    for (i = 0; i < 90; i++)
+        selSetElement(sel2, 37, i, SEL_DONT_CARE);
+    pix1 = pixDilate(NULL, pixs, sel1);
+    pix2 = pixDilate(NULL, pixs, sel2);
+    pix3 = pixErode(NULL, pixs, sel1);
+    pix4 = pixErode(NULL, pixs, sel2);
+    regTestComparePix(rp, pix1, pix2);
+    regTestComparePix(rp, pix3, pix4);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    pixDestroy(&pix3);
+    pixDestroy(&pix4);
+    selDestroy(&sel1);
+    selDestroy(&sel2);
+    resetMorphBoundaryCondition(ASYMMETRIC_MORPH_BC);
+}
@@ -35,6 +35,8 @@
  *       (4) dwa composite      vs.   morph composite
  *       (5) dwa composite      vs.   morph non-composite
  *    The brick functions all have a pre-allocated pix as the dest.
+ *    It also checks that the 32-bit, 64-bit and 256-bit versions
+ *    of the generated dwa code give the same results.
  */
 
 #include "demo_settings.h"
@@ -43,6 +45,7 @@
 
 
 static void  TestAll(L_REGPARAMS *rp, PIX *pixs, l_int32 symmetric);
+static void  TestWordWidths(L_REGPARAMS *rp, PIX *pixs);
 
 static l_int32 DoComparisonDwa1(L_REGPARAMS *rp,
                          PIX *pixs, PIX *pix1, PIX *pix2, PIX *pix3,
@@ -93,6 +96,7 @@ L_REGPARAMS* rp;
     pixs = pixRead(regGetFileArgOrDefault(rp, "feyn-fract.tif"));
     TestAll(rp, pixs, FALSE);
     TestAll(rp, pixs, TRUE);
+    TestWordWidths(rp, pixs);
     pixDestroy(&pixs);
     return regTestCleanup(rp);
 }
@@ -153,6 +157,93 @@ PIX     *pix1, *pix2, *pix3, *pix4, *pix5, *pix6;
 }
 
 
+    /* Dwa with each word width in the generated code, for the basic,
+     * hit-miss and comb sels */
+static void
+TestWordWidths(L_REGPARAMS  *rp,
+               PIX          *pixs)
+{
+char    *selname;
+l_int32  i, nsels;
+PIX     *pix1, *pix2, *pix3, *pix4, *pix5, *pix6;
+SELA    *sela;
+
+    resetMorphBoundaryCondition(ASYMMETRIC_MORPH_BC);
+    sela = selaAddBasic(NULL);
+    nsels = selaGetCount(sela);
+    for (i = 0; i < nsels; i++) {
+        selname = selGetName(selaGetSel(sela, i));
+        l_setDwaWordWidth(32);
+        pix1 = pixMorphDwa_1(NULL, pixs, L_MORPH_DILATE, selname);
+        pix2 = pixMorphDwa_1(NULL, pixs, L_MORPH_ERODE, selname);
+        l_setDwaWordWidth(64);
+        pix3 = pixMorphDwa_1(NULL, pixs, L_MORPH_DILATE, selname);
+        pix4 = pixMorphDwa_1(NULL, pixs, L_MORPH_ERODE, selname);
+        l_setDwaWordWidth(256);  /* falls back to 64 without AVX2 */
+        pix5 = pixMorphDwa_1(NULL, pixs, L_MORPH_DILATE, selname);
+        pix6 = pixMorphDwa_1(NULL, pixs, L_MORPH_ERODE, selname);
+        regTestComparePix(rp, pix1, pix3);
+        regTestComparePix(rp, pix2, pix4);
+        regTestComparePix(rp, pix1, pix5);
+        regTestComparePix(rp, pix2, pix6);
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        pixDestroy(&pix3);
+        pixDestroy(&pix4);
+        pixDestroy(&pix5);
+        pixDestroy(&pix6);
+    }
+    selaDestroy(&sela);
+
+        /* Hit-miss sels, with misses and with rows that are not used */
+    sela = selaAddHitMiss(NULL);
+    nsels = selaGetCount(sela);
+    for (i = 0; i < nsels; i++) {
+        selname = selGetName(selaGetSel(sela, i));
+        l_setDwaWordWidth(32);
+        pix1 = pixHMTDwa_1(NULL, pixs, selname);
+        l_setDwaWordWidth(64);
+        pix2 = pixHMTDwa_1(NULL, pixs, selname);
+        l_setDwaWordWidth(256);
+        pix3 = pixHMTDwa_1(NULL, pixs, selname);
+        regTestComparePix(rp, pix1, pix2);
+        regTestComparePix(rp, pix1, pix3);
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        pixDestroy(&pix3);
+    }
+    selaDestroy(&sela);
+
+        /* Comb sels of the composite dwa operations */
+    sela = selaAddDwaCombs(NULL);
+    nsels = selaGetCount(sela);
+    for (i = 0; i < nsels; i++) {
+        selname = selGetName(selaGetSel(sela, i));
+        l_setDwaWordWidth(32);
+        pix1 = pixMorphDwa_2(NULL, pixs, L_MORPH_DILATE, selname);
+        pix2 = pixMorphDwa_2(NULL, pixs, L_MORPH_ERODE, selname);
+        l_setDwaWordWidth(64);
+        pix3 = pixMorphDwa_2(NULL, pixs, L_MORPH_DILATE, selname);
+        pix4 = pixMorphDwa_2(NULL, pixs, L_MORPH_ERODE, selname);
+        l_setDwaWordWidth(256);
+        pix5 = pixMorphDwa_2(NULL, pixs, L_MORPH_DILATE, selname);
+        pix6 = pixMorphDwa_2(NULL, pixs, L_MORPH_ERODE, selname);
+        regTestComparePix(rp, pix1, pix3);
+        regTestComparePix(rp, pix2, pix4);
+        regTestComparePix(rp, pix1, pix5);
+        regTestComparePix(rp, pix2, pix6);
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        pixDestroy(&pix3);
+        pixDestroy(&pix4);
+        pixDestroy(&pix5);
+        pixDestroy(&pix6);
+    }
+    l_setDwaWordWidth(0);
+    selaDestroy(&sela);
+}
+
+
     /* Morph composite with morph non-composite */
 static l_int32
 DoComparisonDwa1(L_REGPARAMS  *rp,
@@ -28,6 +28,12 @@
  * binmorph6_reg.c
  *
  *    Miscellaneous morphological operations.
+ *
+ *    Also checks that the fused implementation of pixDilate(),
+ *    pixErode() and pixHMT() gives the same results as the rasterop
+ *    implementation, for Sels with misses and off-center origins,
+ *    with both boundary conditions, and for image widths that are
+ *    not a multiple of 32.
  */
 
 #include "demo_settings.h"
@@ -35,6 +41,23 @@
 #include "monolithic_examples.h"
 
 
+static void TestFused(L_REGPARAMS *rp, PIX *pixs, SEL *sel);
+
+    /* Hit-miss Sels: x = hit, o = miss, C = origin (don't care) */
+static const char  *sel_hmt1 = "ooooo"
+                               "oxxxo"
+                               "oxCxo"
+                               "oxxxo"
+                               "ooooo";
+static const char  *sel_hmt2 = "Cxx  o"
+                               " xx  o"
+                               "ooo   ";
+static const char  *sel_hits = "  xxx  "
+                               " xxxxx "
+                               "xxx xxx"
+                               " xxxxx "
+                               "  xxxC ";
+
 
 #if defined(BUILD_MONOLITHIC)
 #define main   lept_binmorph6_reg_main
@@ -43,6 +66,7 @@
 int main(int    argc,
          const char **argv)
 {
+l_int32       i, j;
 BOX          *box1;
 PIX          *pix1, *pix2, *pix3, *pix4, *pix5, *pix6, *pix7, *pix8;
 PIXA         *pixa;
@@ -89,6 +113,63 @@ L_REGPARAMS* rp;
     pixaDestroy(&pixa);
     boxDestroy(&box1);
     selDestroy(&sel);
+
+        /* Fused vs. rasterop, on images with widths that are not
+         * a multiple of 32 */
+    pix1 = pixRead(regGetFileArgOrDefault(rp, "feyn-fract.tif"));
+    for (i = 0; i < 2; i++) {
+        box1 = (i == 0) ? boxCreate(0, 0, 301, 250) :
+                          boxCreate(13, 7, 97, 180);
+        pix2 = pixClipRectangle(pix1, box1, NULL);
+        for (j = 0; j < 5; j++) {  /* 7 - 56 */
+            if (j == 0)
+                sel = selCreateFromString(sel_hmt1, 5, 5, "hmt1");
+            else if (j == 1)
+                sel = selCreateFromString(sel_hmt2, 3, 6, "hmt2");
+            else if (j == 2)
+                sel = selCreateFromString(sel_hits, 5, 7, "hits");
+            else if (j == 3)  /* brick below the size for doubling */
+                sel = selCreateBrick(5, 7, 0, 6, SEL_HIT);
+            else  /* origin outside the Sel */
+                sel = selCreateBrick(3, 4, -2, 5, SEL_HIT);
+            TestFused(rp, pix2, sel);
+            selDestroy(&sel);
+        }
+        pixDestroy(&pix2);
+        boxDestroy(&box1);
+    }
+    pixDestroy(&pix1);
     return regTestCleanup(rp);
 }
 
+
+
+    /* Compares dilation, erosion and the HMT, with both boundary
+     * conditions, using the fused and the rasterop implementations */
+static void
+TestFused(L_REGPARAMS  *rp,
+          PIX          *pixs,
+          SEL          *sel)
+{
+l_int32  i, k;
+PIX     *pix[2][3];
+
+    for (i = 0; i < 2; i++) {
+        resetMorphBoundaryCondition((i == 0) ? ASYMMETRIC_MORPH_BC
+                                             : SYMMETRIC_MORPH_BC);
+        for (k = 0; k < 2; k++) {
+            l_setMorphFused(k);
+            pix[k][0] = pixDilate(NULL, pixs, sel);
+            pix[k][1] = pixErode(NULL, pixs, sel);
+            pix[k][2] = pixHMT(NULL, pixs, sel);
+        }
+        l_setMorphFused(1);
+        for (k = 0; k < 3; k++) {
+            if (i == 0 || k > 0)  /* dilation does not depend on b.c. */
+                regTestComparePix(rp, pix[0][k], pix[1][k]);
+            pixDestroy(&pix[0][k]);
+            pixDestroy(&pix[1][k]);
+        }
+    }
+    resetMorphBoundaryCondition(ASYMMETRIC_MORPH_BC);
+}
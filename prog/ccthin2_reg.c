@@ -30,6 +30,9 @@
  *   Tests:
  *   - The examples in pixThinConnectedBySet()
  *   - Use of thinning and thickening in stroke width normalization
+ *   - Thinning with a lookup table, for 3x3 Sels, gives the same
+ *     result as with HMTs, which are used for the same Sels padded
+ *     to 5x5
  */
 
 #include "demo_settings.h"
@@ -37,6 +40,9 @@
 #include "monolithic_examples.h"
 
 
+static SELA *MakePaddedSela(SELA *sela);
+static void TestThinByLUT(L_REGPARAMS *rp, PIX *pixs);
+
 
 #if defined(BUILD_MONOLITHIC)
 #define main   lept_ccthin2_reg_main
@@ -191,7 +197,75 @@ SELA         *sela;
     pixaDestroy(&pixa5);
     pixDestroy(&pix1);
 
+        /* Thinning with a lookup table */
+    pix1 = pixRead(regGetFileArgOrDefault(rp, "feyn.tif"));
+    box = boxCreate(683, 799, 970, 479);
+    pixs = pixClipRectangle(pix1, box, NULL);
+    TestThinByLUT(rp, pixs);  /* 19 - 33 */
+    pixDestroy(&pix1);
+    pixDestroy(&pixs);
+    boxDestroy(&box);
+
     return regTestCleanup(rp);
 }
 
 
+static SELA *
+MakePaddedSela(SELA  *sela)
+{
+l_int32  i, j, k, n, type;
+SEL     *sel1, *sel2;
+SELA    *selad;
+
+    n = selaGetCount(sela);
+    selad = selaCreate(n);
+    for (k = 0; k < n; k++) {
+        sel1 = selaGetSel(sela, k);
+        sel2 = selCreate(5, 5, selGetName(sel1));
+        selSetOrigin(sel2, 2, 2);
+        for (i = 0; i < 3; i++) {
+            for (j = 0; j < 3; j++) {
+                selGetElement(sel1, i, j, &type);
+                selSetElement(sel2, i + 1, j + 1, type);
+            }
+        }
+        selaAddSel(selad, sel2, NULL, L_INSERT);
+    }
+    return selad;
+}
+
+
+static void
+TestThinByLUT(L_REGPARAMS  *rp,
+              PIX          *pixs)
+{
+l_int32  i, type, maxiters;
+PIX     *pix1, *pix2;
+SELA    *sela1, *sela2;
+
+    for (i = 1; i <= 15; i++) {
+        if (i <= 9) {  /* thinning to completion */
+            sela1 = selaMakeThinSets(i);
+            type = L_THIN_FG;
+            maxiters = 0;
+        } else if (i <= 11) {  /* thickening sets */
+            sela1 = selaMakeThinSets(i);
+            type = L_THIN_BG;
+            maxiters = 3;
+        } else {  /* a few iterations of thinning the bg */
+            sela1 = selaMakeThinSets((i & 1) ? 1 : 5);
+            type = (i <= 13) ? L_THIN_BG : L_THIN_FG;
+            maxiters = (i <= 13) ? 4 : 2;
+        }
+        sela2 = MakePaddedSela(sela1);
+        pix1 = pixThinConnectedBySet(pixs, type, sela1, maxiters);
+        pix2 = pixThinConnectedBySet(pixs, type, sela2, maxiters);
+        regTestComparePix(rp, pix1, pix2);
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        selaDestroy(&sela1);
+        selaDestroy(&sela2);
+    }
+}
+
+
@@ -50,6 +50,10 @@ static const char  *kel2str = " -20  -50  -80  -50  -20 "
 static const char  *kel3xstr = " -70   40  100   40  -70 ";
 static const char  *kel3ystr = "  20  -70   40  100   40  -70  20 ";
 
+static const char  *kel4str = " 1  2  1 "
+                              " 2  4  2 "
+                              " 1  2  1 ";
+
 
 
 #if defined(BUILD_MONOLITHIC)
@@ -61,7 +65,7 @@ int main(int    argc,
 {
 l_int32       i, j, sizex, sizey, bias;
 FPIX         *fpixv, *fpixrv;
-L_KERNEL     *kel1, *kel2, *kel3x, *kel3y;
+L_KERNEL     *kel1, *kel2, *kel3, *kel3x, *kel3y;
 PIX          *pixs, *pixacc, *pixg, *pixt, *pixd;
 PIX          *pixb, *pixm, *pixms, *pixrv, *pix1, *pix2, *pix3, *pix4;
 L_REGPARAMS* rp;
@@ -211,5 +215,105 @@ L_REGPARAMS* rp;
     fpixDestroy(&fpixv);
     fpixDestroy(&fpixrv);
 
+        /* Test recursive gaussian against convolution with a gaussian
+         * kernel.  The boundary conditions differ, so compare only
+         * pixels that are far enough from the edge. */
+    pixs = pixRead(regGetFileArgOrDefault(rp, "test8.jpg"));
+    makeGaussianKernelSep(20, 20, 5.0, 1.0, &kel3x, &kel3y);
+    pixt = pixConvolveSep(pixs, kel3x, kel3y, 8, 1);
+    pixd = pixGaussianBlur(pixs, 5.0, 5.0);
+    pixDisplayWithTitle(pixd, 100, 1000, NULL);
+    pix1 = pixRemoveBorder(pixt, 20);
+    pix2 = pixRemoveBorder(pixd, 20);
+    regTestCompareSimilarPix(rp, pix1, pix2, 4, 0.001, 0);  /* 18 */
+    pixDestroy(&pixt);
+    pixDestroy(&pixd);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    kernelDestroy(&kel3x);
+    kernelDestroy(&kel3y);
+    kel3x = makeGaussianKernel(0, 40, 10.0, 1.0);
+    kel3y = makeGaussianKernel(6, 0, 2.0, 1.0);
+    fpixv = pixConvertToFPix(pixs, 1);
+    fpixrv = fpixConvolveSep(fpixv, kel3x, kel3y, 1);
+    pixt = fpixConvertToPix(fpixrv, 8, L_CLIP_TO_ZERO, 0);
+    fpixDestroy(&fpixrv);
+    fpixrv = fpixGaussianBlur(fpixv, 10.0, 2.0);
+    pixd = fpixConvertToPix(fpixrv, 8, L_CLIP_TO_ZERO, 0);
+    pix1 = pixRemoveBorderGeneral(pixt, 40, 40, 6, 6);
+    pix2 = pixRemoveBorderGeneral(pixd, 40, 40, 6, 6);
+    regTestCompareSimilarPix(rp, pix1, pix2, 4, 0.001, 0);  /* 19 */
+    pixDestroy(&pixt);
+    pixDestroy(&pixd);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    fpixDestroy(&fpixv);
+    fpixDestroy(&fpixrv);
+    kernelDestroy(&kel3x);
+    kernelDestroy(&kel3y);
+
+        /* Test FFT convolution against direct convolution, using
+         * a large kernel with negative values and an off-center origin */
+    kel3 = makeDoGKernel(12, 12, 3.0, 4.5);
+    kernelSetOrigin(kel3, 4, 19);
+    pixt = pixConvolve(pixs, kel3, 8, 0);
+    l_setConvolveFFTThreshold(256);
+    pixd = pixConvolve(pixs, kel3, 8, 0);
+    l_setConvolveFFTThreshold(0);
+    pixDisplayWithTitle(pixd, 600, 1000, NULL);
+    regTestCompareSimilarPix(rp, pixt, pixd, 2, 0.0, 0);  /* 20 */
+    pixDestroy(&pixt);
+    pixDestroy(&pixd);
+    kernelDestroy(&kel3);
+
+        /* Test fixed-point convolution of 8 bpp against float.
+         * Integer kernels without normalization give the same result,
+         * for the 5x5, 3x3 and general inner loops. */
+    for (i = 0; i < 4; i++) {
+        if (i == 0)
+            kel1 = kernelCreateFromString(5, 5, 2, 2, kel1str);
+        else if (i == 1)
+            kel1 = kernelCreateFromString(5, 5, 2, 2, kel2str);
+        else if (i == 2)
+            kel1 = kernelCreateFromString(3, 3, 1, 1, kel4str);
+        else
+            kel1 = makeFlatKernel(7, 7, 3, 3);
+        pixt = pixConvolve(pixs, kel1, 32, 0);
+        l_setConvolveFixedPoint(1);
+        pixd = pixConvolve(pixs, kel1, 32, 0);
+        l_setConvolveFixedPoint(0);
+        regTestComparePix(rp, pixt, pixd);  /* 21 - 24 */
+        pixDestroy(&pixt);
+        pixDestroy(&pixd);
+        kernelDestroy(&kel1);
+    }
+
+        /* Normalized and non-integer kernels differ only by rounding */
+    for (i = 0; i < 2; i++) {
+        if (i == 0)
+            kel1 = kernelCreateFromString(5, 5, 2, 2, kel1str);
+        else
+            kel1 = makeGaussianKernel(1, 1, 0.8, 1.0);
+        pixt = pixConvolve(pixs, kel1, 8, 1);
+        l_setConvolveFixedPoint(1);
+        pixd = pixConvolve(pixs, kel1, 8, 1);
+        l_setConvolveFixedPoint(0);
+        regTestCompareSimilarPix(rp, pixt, pixd, 2, 0.0, 0);  /* 25 - 26 */
+        pixDestroy(&pixt);
+        pixDestroy(&pixd);
+        kernelDestroy(&kel1);
+    }
+    makeGaussianKernelSep(7, 7, 3.0, 1.0, &kel3x, &kel3y);
+    pixt = pixConvolveSep(pixs, kel3x, kel3y, 8, 1);
+    l_setConvolveFixedPoint(1);
+    pixd = pixConvolveSep(pixs, kel3x, kel3y, 8, 1);
+    l_setConvolveFixedPoint(0);
+    regTestCompareSimilarPix(rp, pixt, pixd, 2, 0.0, 0);  /* 27 */
+    pixDestroy(&pixt);
+    pixDestroy(&pixd);
+    kernelDestroy(&kel3x);
+    kernelDestroy(&kel3y);
+    pixDestroy(&pixs);
+
     return regTestCleanup(rp);
 }
@@ -0,0 +1,191 @@
+/*====================================================================*
+ -  Copyright (C) 2001 Leptonica.  All rights reserved.
+ -
+ -  Redistribution and use in source and binary forms, with or without
+ -  modification, are permitted provided that the following conditions
+ -  are met:
+ -  1. Redistributions of source code must retain the above copyright
+ -     notice, this list of conditions and the following disclaimer.
+ -  2. Redistributions in binary form must reproduce the above
+ -     copyright notice, this list of conditions and the following
+ -     disclaimer in the documentation and/or other materials
+ -     provided with the distribution.
+ -
+ -  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ -  ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ -  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ -  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL ANY
+ -  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ -  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ -  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ -  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ -  OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ -  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ -  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *====================================================================*/
+
+
+/*
+ *  deflate_reg.c
+ *
+ *    Regression test for compression of data in blocks on several
+ *    threads, and its use in writing png and in flate encoding for pdf.
+ *       (1) zlibCompressParallel() output is decoded by zlibUncompress(),
+ *           and does not depend on the number of threads.
+ *       (2) Images of each depth are written to png with several
+ *           threads, to file and memory, and read back.
+ *       (3) Flate data for pdf made with several threads decodes to
+ *           the same raster as with one thread.
+ */
+
+#include "demo_settings.h"
+
+#include "monolithic_examples.h"
+
+
+static l_int32 TestRoundTrip(const l_uint8 *data, size_t size,
+                             l_int32 level);
+
+
+#if defined(BUILD_MONOLITHIC)
+#define main   lept_deflate_reg_main
+#endif
+
+int main(int    argc,
+         const char **argv)
+{
+l_uint8      *data1, *data2, *data3;
+l_int32       i, prev;
+size_t        size1, size2, size3;
+L_COMP_DATA  *cid1, *cid2;
+PIX          *pix1, *pix2, *pix3;
+PIXA         *pixa;
+L_REGPARAMS  *rp;
+
+#if !defined(HAVE_LIBPNG)
+    L_ERROR("This test requires libpng to run.\n", "deflate_reg");
+    exit(77);
+#endif
+
+    if (regTestSetup(argc, argv, "deflate", NULL, &rp))
+        return 1;
+
+    lept_mkdir("lept/deflate");
+
+        /* Round trip for image data and for sizes near the block size */
+    pix1 = pixRead("marge.jpg");
+    pixGetRasterData(pix1, &data1, &size1);
+    pixDestroy(&pix1);
+    regTestCompareValues(rp, 0, TestRoundTrip(data1, size1, 6), 0);  /* 0 */
+    regTestCompareValues(rp, 0, TestRoundTrip(data1, size1, 1), 0);  /* 1 */
+    regTestCompareValues(rp, 0, TestRoundTrip(data1, size1, 0), 0);  /* 2 */
+    regTestCompareValues(rp, 0, TestRoundTrip(data1, 131072, 6), 0);  /* 3 */
+    regTestCompareValues(rp, 0, TestRoundTrip(data1, 131073, 9), 0);  /* 4 */
+    regTestCompareValues(rp, 0, TestRoundTrip(data1, 100, -1), 0);  /* 5 */
+
+        /* zlibCompress() uses the blocks when threads are requested */
+    prev = l_zlibSetThreads(0);
+    data2 = zlibCompress(data1, size1, &size2);
+    l_zlibSetThreads(prev);
+    data3 = zlibUncompress(data2, size2, &size3);
+    regTestCompareStrings(rp, data1, size1, data3, size3);  /* 6 */
+    lept_free(data1);
+    lept_free(data2);
+    lept_free(data3);
+
+        /* Write png with several threads, for each depth */
+    pix1 = pixRead("test24.jpg");
+    pixa = pixaCreate(0);
+    pix2 = pixConvertRGBToLuminance(pix1);
+    pixaAddPix(pixa, pixThresholdToBinary(pix2, 130), L_INSERT);
+    pixaAddPix(pixa, pixThresholdTo2bpp(pix2, 4, 1), L_INSERT);
+    pixaAddPix(pixa, pixThresholdTo4bpp(pix2, 16, 0), L_INSERT);
+    pixaAddPix(pixa, pixClone(pix2), L_INSERT);
+    pixaAddPix(pixa, pixConvert8To16(pix2, 8), L_INSERT);
+    pixaAddPix(pixa, pixOctreeColorQuant(pix1, 200, 0), L_INSERT);
+    pixaAddPix(pixa, pixClone(pix1), L_INSERT);
+    pix3 = pixCopy(NULL, pix1);
+    pixSetRGBComponent(pix3, pix2, L_ALPHA_CHANNEL);
+    pixSetSpp(pix3, 4);
+    pixaAddPix(pixa, pix3, L_INSERT);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    prev = l_zlibSetThreads(4);
+    l_pngSetReadStrip16To8(0);
+    for (i = 0; i < pixaGetCount(pixa); i++) {  /* 7 - 22 */
+        pix1 = pixaGetPix(pixa, i, L_CLONE);
+        pixWrite("/tmp/lept/deflate/par.png", pix1, IFF_PNG);
+        pix2 = pixRead("/tmp/lept/deflate/par.png");
+        regTestComparePix(rp, pix1, pix2);
+        pixWriteMemPng(&data1, &size1, pix1, 0.0);
+        pix3 = pixReadMemPng(data1, size1);
+        regTestComparePix(rp, pix1, pix3);
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        pixDestroy(&pix3);
+        lept_free(data1);
+    }
+    l_zlibSetThreads(prev);
+    l_pngSetReadStrip16To8(1);
+
+        /* Compare the time and size with a single stream */
+    pix1 = pixaGetPix(pixa, 6, L_CLONE);
+    startTimer();
+    pixWriteMemPng(&data1, &size1, pix1, 0.0);
+    lept_stderr("png, 1 thread:  %7.3f sec, %zu bytes\n", stopTimer(), size1);
+    prev = l_zlibSetThreads(0);
+    startTimer();
+    pixWriteMemPng(&data2, &size2, pix1, 0.0);
+    lept_stderr("png, all threads: %7.3f sec, %zu bytes\n",
+                stopTimer(), size2);
+    l_zlibSetThreads(prev);
+    regTestCompareValues(rp, 1.0, (l_float32)size2 / size1, 0.05);  /* 23 */
+    pixDestroy(&pix1);
+    lept_free(data1);
+    lept_free(data2);
+    pixaDestroy(&pixa);
+
+        /* Flate data for pdf */
+    cid1 = l_generateFlateData("marge.jpg", 0);
+    prev = l_zlibSetThreads(0);
+    cid2 = l_generateFlateData("marge.jpg", 0);
+    l_zlibSetThreads(prev);
+    data1 = zlibUncompress(cid1->datacomp, cid1->nbytescomp, &size1);
+    data2 = zlibUncompress(cid2->datacomp, cid2->nbytescomp, &size2);
+    regTestCompareStrings(rp, data1, size1, data2, size2);  /* 24 */
+    lept_free(data1);
+    lept_free(data2);
+    l_CIDataDestroy(&cid1);
+    l_CIDataDestroy(&cid2);
+
+    return regTestCleanup(rp);
+}
+
+
+    /* Returns 0 if the data compressed with 1, 2 and 8 threads is
+     * identical, and decompresses to the input */
+static l_int32
+TestRoundTrip(const l_uint8  *data,
+              size_t          size,
+              l_int32         level)
+{
+l_uint8  *data1, *data2, *data3, *data4;
+l_int32   ret;
+size_t    size1, size2, size3, size4;
+
+    data1 = zlibCompressParallel(data, size, level, 1, &size1);
+    data2 = zlibCompressParallel(data, size, level, 2, &size2);
+    data3 = zlibCompressParallel(data, size, level, 8, &size3);
+    data4 = zlibUncompress(data3, size3, &size4);
+    ret = 1;
+    if (data1 && data2 && data3 && data4 &&
+        size1 == size2 && size1 == size3 && size4 == size &&
+        !memcmp(data1, data2, size1) && !memcmp(data1, data3, size1) &&
+        !memcmp(data4, data, size))
+        ret = 0;
+    lept_free(data1);
+    lept_free(data2);
+    lept_free(data3);
+    lept_free(data4);
+    return ret;
+}
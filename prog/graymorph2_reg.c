@@ -29,6 +29,10 @@
  *
  *   Compares graymorph results with special (3x1, 1x3, 3x3) cases
  *   against the general case.  Require exact equality.
+ *
+ *   Also compares erosion and dilation with arbitrary flat Sels,
+ *   which are done by line segment decomposition, against a direct
+ *   computation over the hits.
  */
 
 #include "demo_settings.h"
@@ -36,6 +40,18 @@
 #include "monolithic_examples.h"
 
 
+static PIX *MorphGraySelDirect(PIX *pixs, SEL *sel, l_int32 type);
+
+static const char *seltext1 = "  x  "
+                              " xxx "
+                              "xxXxx"
+                              "   xx"
+                              "    x";
+static const char *seltext2 = "x    x"
+                              "      "
+                              "   C  "
+                              "x   x ";
+
 
 #if defined(BUILD_MONOLITHIC)
 #define main   lept_graymorph2_reg_main
@@ -44,8 +60,12 @@
 int main(int    argc,
          const char **argv)
 {
-PIX          *pixs, *pix1, *pix2, *pixd;
+l_int32       i, n;
+L_MORPH_PLAN *plan;
+PIX          *pixs, *pix1, *pix2, *pix3, *pix4, *pixd;
 PIXA         *pixa;
+SEL          *sel;
+SELA         *sela;
 L_REGPARAMS* rp;
 
 	if (regTestSetup(argc, argv, "gray_morph", NULL, &rp))
@@ -152,6 +172,85 @@ L_REGPARAMS* rp;
     pixDisplayWithTitle(pixd, 750, 100, "Closing");
     pixDestroy(&pixd);
     pixaDestroy(&pixa);
+
+        /* Flat Sels: disks, a plus sign, an off-center brick,
+         * and irregular shapes */
+    sela = selaCreate(0);
+    selaAddSel(sela, selMakeDisk(3), NULL, L_INSERT);
+    selaAddSel(sela, selMakeDisk(8), NULL, L_INSERT);
+    selaAddSel(sela, selMakePlusSign(9, 1), NULL, L_INSERT);
+    sel = selCreateBrick(4, 6, 0, 5, SEL_HIT);
+    selaAddSel(sela, sel, "brick", L_INSERT);
+    selaAddSel(sela, selCreateFromString(seltext1, 5, 5, "sel1"),
+               NULL, L_INSERT);
+    selaAddSel(sela, selCreateFromString(seltext2, 4, 6, "sel2"),
+               NULL, L_INSERT);
+    n = selaGetCount(sela);
+    for (i = 0; i < n; i++) {  /* 12 - 23 */
+        sel = selaGetSel(sela, i);
+        pix1 = pixDilateGraySel(pixs, sel);
+        pix2 = MorphGraySelDirect(pixs, sel, L_MORPH_DILATE);
+        regTestComparePix(rp, pix1, pix2);
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        pix1 = pixErodeGraySel(pixs, sel);
+        pix2 = MorphGraySelDirect(pixs, sel, L_MORPH_ERODE);
+        regTestComparePix(rp, pix1, pix2);
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+    }
+    selaDestroy(&sela);
+
+        /* Disks in a sequence and in a compiled plan */
+    sel = selMakeDisk(4);
+    pix1 = pixOpenGraySel(pixs, sel);
+    pix2 = pixCloseGraySel(pix1, sel);
+    pix3 = pixGrayMorphSequence(pixs, "or4 + cr4", 0, 0);
+    regTestComparePix(rp, pix2, pix3);  /* 24 */
+    plan = morphPlanCreate("or4 + cr4", 8);
+    pix4 = pixMorphPlanApply(pixs, plan, NULL);
+    regTestComparePix(rp, pix3, pix4);  /* 25 */
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    pixDestroy(&pix3);
+    pixDestroy(&pix4);
+    morphPlanDestroy(&plan);
+    selDestroy(&sel);
+
     pixDestroy(&pixs);
     return regTestCleanup(rp);
 }
+
+
+    /* Max (dilation) or min (erosion) over all the hits, each
+     * done with a translated image */
+static PIX *
+MorphGraySelDirect(PIX     *pixs,
+                   SEL     *sel,
+                   l_int32  type)
+{
+l_int32  i, j, sx, sy, cx, cy, val;
+PIX     *pix1, *pixd;
+
+    selGetParameters(sel, &sy, &sx, &cy, &cx);
+    pixd = pixCreateTemplate(pixs);
+    if (type == L_MORPH_ERODE)
+        pixSetAll(pixd);
+    for (i = 0; i < sy; i++) {
+        for (j = 0; j < sx; j++) {
+            selGetElement(sel, i, j, &val);
+            if (val != SEL_HIT) continue;
+            if (type == L_MORPH_DILATE) {
+                pix1 = pixTranslate(NULL, pixs, j - cx, i - cy,
+                                    L_BRING_IN_BLACK);
+                pixMinOrMax(pixd, pixd, pix1, L_CHOOSE_MAX);
+            } else {
+                pix1 = pixTranslate(NULL, pixs, cx - j, cy - i,
+                                    L_BRING_IN_WHITE);
+                pixMinOrMax(pixd, pixd, pix1, L_CHOOSE_MIN);
+            }
+            pixDestroy(&pix1);
+        }
+    }
+    return pixd;
+}
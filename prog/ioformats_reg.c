@@ -90,6 +90,16 @@ static l_int32 test_writemem(PIX *pixs, l_int32 format, char *psfile);
 static PIX *make_24_bpp_pix(PIX *pixs);
 static l_int32 get_header_data(const char *filename, l_int32 true_format);
 static const char *get_tiff_compression_name(l_int32 format);
+static void make_topdown_bmp(const char *filein, const char *fileout);
+
+    /* Files for the mapped read of bmp */
+static const l_int32  NMappedBmp = 6;
+static const char    *MappedBmp[] = {"test-rgba.bmp",
+                                     "/tmp/lept/regout/alpha3.bmp",
+                                     "/tmp/lept/regout/mapped1.bmp",
+                                     "/tmp/lept/regout/mapped2.bmp",
+                                     "weasel2.4c.bmp",
+                                     "test1.bmp"};
 
 
 
@@ -108,6 +118,7 @@ l_int32       w, h, bps, spp, iscmap, res;
 size_t        size, nbytes;
 PIX          *pix1, *pix2, *pix3, *pix4, *pix5, *pix6, *pix8, *pix16, *pix32;
 PIX          *pix, *pixt, *pixd;
+BOX          *box;
 PIXA         *pixa;
 PIXCMAP      *cmap;
 
@@ -663,6 +674,37 @@ part6:
     pixDestroy(&pix4);
     pixDestroy(&pix5);
     pixDestroy(&pix6);
+
+        /* Test reading BMP from a file mapping: 32 bpp rgba, 24 bpp
+         * with an odd width (padded rows), 24 bpp stored top-down,
+         * and cmapped and 1 bpp files that are decoded from the mapping */
+    lept_stderr("Test mapped read of BMP\n");
+    pix1 = pixRead("test-rgba.bmp");
+    pix2 = pixConvert32To24(pix1);
+    box = boxCreate(0, 0, 101, 77);
+    pix3 = pixClipRectangle(pix2, box, NULL);
+    pixWrite("/tmp/lept/regout/mapped1.bmp", pix3, IFF_BMP);
+    make_topdown_bmp("/tmp/lept/regout/alpha3.bmp",
+                     "/tmp/lept/regout/mapped2.bmp");
+    boxDestroy(&box);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    pixDestroy(&pix3);
+    for (i = 0; i < NMappedBmp; i++) {
+        pix1 = pixRead(MappedBmp[i]);
+        pix2 = pixReadMapped(MappedBmp[i], 0);
+        regTestComparePix(rp, pix1, pix2);  /* 10 + 2 * i */
+        pix3 = pixReadBmpMapped(MappedBmp[i], 1);
+        regTestComparePix(rp, pix1, pix3);  /* 11 + 2 * i */
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        pixDestroy(&pix3);
+    }
+    pix1 = pixRead("/tmp/lept/regout/alpha3.bmp");
+    pix2 = pixRead("/tmp/lept/regout/mapped2.bmp");
+    regTestComparePix(rp, pix1, pix2);  /* 22 */
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
     if (rp->success == FALSE) success = FALSE;
 
     if (success)
@@ -1005,3 +1047,32 @@ get_tiff_compression_name(l_int32  format)
         lept_stderr("format %d: not tiff\n", format);
     return tiff_compression_name;
 }
+
+
+    /* Rewrite an uncompressed bmp with the rows stored top-down,
+     * which is signalled by a negative height in the infoheader */
+static void
+make_topdown_bmp(const char  *filein,
+                 const char  *fileout)
+{
+l_uint8  *data, *row;
+l_int32   offset, h, bpl, i;
+size_t    size;
+
+    data = l_binaryRead(filein, &size);
+    offset = data[10] | (data[11] << 8) | (data[12] << 16) | (data[13] << 24);
+    h = data[22] | (data[23] << 8) | (data[24] << 16) | (data[25] << 24);
+    bpl = (size - offset) / h;
+    row = (l_uint8 *)lept_calloc(bpl, 1);
+    for (i = 0; i < h / 2; i++) {
+        memcpy(row, data + offset + i * bpl, bpl);
+        memcpy(data + offset + i * bpl, data + offset + (h - 1 - i) * bpl, bpl);
+        memcpy(data + offset + (h - 1 - i) * bpl, row, bpl);
+    }
+    h = -h;
+    for (i = 0; i < 4; i++)
+        data[22 + i] = (h >> (8 * i)) & 0xff;
+    l_binaryWrite(fileout, "w", data, size);
+    lept_free(row);
+    lept_free(data);
+}
@@ -53,6 +53,8 @@ void DoJpegTest1(L_REGPARAMS *rp, const char *fname);
 void DoJpegTest2(L_REGPARAMS *rp, const char *fname);
 void DoJpegTest3(L_REGPARAMS *rp, const char *fname);
 void DoJpegTest4(L_REGPARAMS *rp, const char *fname);
+void DoJpegTest5(L_REGPARAMS *rp, const char *fname);
+void DoJpegTest6(L_REGPARAMS *rp, const char *fname, BOX *box);
 
 
 
@@ -70,6 +72,7 @@ int main(int    argc,
     return 0;
 #endif  /* abort */
 
+	BOX* box;
 	L_REGPARAMS* rp;
 
 	if (regTestSetup(argc, argv, "jpeg_io", NULL, &rp))
@@ -90,6 +93,13 @@ int main(int    argc,
     DoJpegTest3(rp, regGetFileArgOrDefault(rp, "lucasta.150.jpg"));
     DoJpegTest3(rp, regGetFileArgOrDefault(rp, "tetons.jpg"));
     DoJpegTest4(rp, regGetFileArgOrDefault(rp, "karen8.jpg"));
+    DoJpegTest5(rp, regGetFileArgOrDefault(rp, "test24.jpg"));
+    DoJpegTest5(rp, regGetFileArgOrDefault(rp, "fish24.jpg"));
+    DoJpegTest5(rp, regGetFileArgOrDefault(rp, "test8.jpg"));
+    box = boxCreate(32, 16, 320, 240);
+    DoJpegTest6(rp, regGetFileArgOrDefault(rp, "test24.jpg"), box);
+    DoJpegTest6(rp, regGetFileArgOrDefault(rp, "marge.jpg"), NULL);
+    boxDestroy(&box);
 
     return regTestCleanup(rp);
 }
@@ -262,4 +272,124 @@ PIX     *pixs;
     return;
 }
 
+/* Region reads must match the same region of the full image */
+void DoJpegTest5(L_REGPARAMS  *rp,
+                 const char   *fname)
+{
+size_t    size;
+l_uint8  *data;
+l_int32   i, w, h, red, x0, y0, x1, y1;
+BOX      *box1, *box2;
+PIX      *pixs, *pix1, *pix2, *pix3;
+
+    data = l_binaryRead(fname, &size);
+    readHeaderJpeg(fname, &w, &h, NULL, NULL, NULL);
+    for (red = 1; red <= 4; red *= 2) {
+        pixs = pixReadJpeg(fname, 0, red, NULL, 0);
+        for (i = 0; i < 3; i++) {
+            if (i == 0)  /* interior, not aligned to iMCUs */
+                box1 = boxCreate(w / 3 + 5, h / 4 + 3, w / 5 + 7, h / 6 + 1);
+            else if (i == 1)  /* aligned to iMCUs */
+                box1 = boxCreate(32, 48, 64, 80);
+            else  /* clipped to the lower right corner */
+                box1 = boxCreate(w - 41, h - 27, 100, 100);
+            pix1 = pixReadJpegRegion(fname, box1, 0, red, NULL, 0);
+            pix2 = pixReadMemJpegRegion(data, size, box1, 0, red, NULL, 0);
+            x0 = box1->x / red;
+            y0 = box1->y / red;
+            x1 = L_MIN(w, box1->x + box1->w);
+            y1 = L_MIN(h, box1->y + box1->h);
+            x1 = L_MIN((x1 + red - 1) / red, pixGetWidth(pixs));
+            y1 = L_MIN((y1 + red - 1) / red, pixGetHeight(pixs));
+            box2 = boxCreate(x0, y0, x1 - x0, y1 - y0);
+            pix3 = pixClipRectangle(pixs, box2, NULL);
+            regTestComparePix(rp, pix1, pix3);
+            regTestComparePix(rp, pix2, pix3);
+            boxDestroy(&box1);
+            boxDestroy(&box2);
+            pixDestroy(&pix1);
+            pixDestroy(&pix2);
+            pixDestroy(&pix3);
+        }
+        pixDestroy(&pixs);
+    }
+
+        /* The entire image, and a region returned with a colormap */
+    pixs = pixReadJpeg(fname, 0, 1, NULL, 0);
+    pix1 = pixReadJpegRegion(fname, NULL, 0, 1, NULL, 0);
+    regTestComparePix(rp, pixs, pix1);
+    box1 = boxCreate(w / 2, h / 2, w, h);
+    pix2 = pixReadJpegRegion(fname, box1, 1, 1, NULL, 0);
+    regTestCompareValues(rp, w - w / 2, pixGetWidth(pix2), 0.0);
+    regTestCompareValues(rp, h - h / 2, pixGetHeight(pix2), 0.0);
+    regTestCompareValues(rp, pixGetDepth(pix2) == 8, 1, 0.0);
+    boxDestroy(&box1);
+    pixDestroy(&pixs);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    lept_free(data);
+    return;
+}
+
+/* Lossless transforms must match the transforms of the decoded image */
+void DoJpegTest6(L_REGPARAMS  *rp,
+                 const char   *fname,
+                 BOX          *box)
+{
+size_t    size, size1, size2;
+l_uint8  *data, *data1, *data2;
+l_int32   i, w, h, lossless;
+BOX      *box2;
+PIX      *pix1, *pix2, *pix3;
+
+    data = l_binaryRead(fname, &size);
+    jpegTransformMem(data, size, L_JPEG_NO_TRANSFORM, box, &data1, &size1);
+    pix1 = pixReadMemJpeg(data1, size1, 0, 1, NULL, 0);
+    pixGetDimensions(pix1, &w, &h, NULL);
+    if (box) {
+        regTestCompareValues(rp, box->w, w, 0.0);
+        regTestCompareValues(rp, box->h, h, 0.0);
+    }
+
+        /* Rotations and flips */
+    for (i = L_JPEG_ROTATE_90; i <= L_JPEG_FLIP_TB; i++) {
+        jpegTransformMem(data1, size1, i, NULL, &data2, &size2);
+        pix2 = pixReadMemJpeg(data2, size2, 0, 1, NULL, 0);
+        if (i <= L_JPEG_ROTATE_270)
+            pix3 = pixRotateOrth(pix1, i);
+        else if (i == L_JPEG_FLIP_LR)
+            pix3 = pixFlipLR(NULL, pix1);
+        else
+            pix3 = pixFlipTB(NULL, pix1);
+        regTestCompareSimilarPix(rp, pix2, pix3, 5, 0.0, 0);
+        pixDestroy(&pix2);
+        pixDestroy(&pix3);
+        lept_free(data2);
+    }
+
+        /* Four rotations by 90 degrees are the identity */
+    data2 = (l_uint8 *)l_binaryCopy(data1, size1);
+    size2 = size1;
+    for (i = 0; i < 4; i++) {
+        lept_free(data);
+        data = data2;
+        jpegTransformMem(data, size2, L_JPEG_ROTATE_90, NULL, &data2, &size2);
+    }
+    pix2 = pixReadMemJpeg(data2, size2, 0, 1, NULL, 0);
+    regTestComparePix(rp, pix1, pix2);
+    pixDestroy(&pix2);
+    lept_free(data2);
+
+        /* Edges that are not on an iMCU boundary can't be moved */
+    box2 = boxCreate(0, 0, w - 1, h);
+    jpegCheckTransformMem(data1, size1, L_JPEG_FLIP_LR, box2, &lossless);
+    regTestCompareValues(rp, 0, lossless, 0.0);
+    jpegCheckTransformMem(data1, size1, L_JPEG_FLIP_TB, box2, &lossless);
+    regTestCompareValues(rp, 1, lossless, 0.0);
+    boxDestroy(&box2);
 
+    pixDestroy(&pix1);
+    lept_free(data);
+    lept_free(data1);
+    return;
+}
@@ -89,6 +89,7 @@ int lept_crop_reg_main(int argc, const char **argv);
 int lept_croppdf_main(int argc, const char **argv);
 int lept_croptext_main(int argc, const char **argv);
 int lept_custom_log_plot_test_main(int argc, const char **argv);
+int lept_deflate_reg_main(int argc, const char **argv);
 int lept_deskew_it_main(int argc, const char **argv);
 int lept_dewarp_reg_main(int argc, const char **argv);
 int lept_dewarprules_main(int argc, const char **argv);
@@ -204,6 +205,7 @@ int lept_paintmask_reg_main(int argc, const char **argv);
 int lept_partifytest_main(int argc, const char **argv);
 int lept_partition_reg_main(int argc, const char **argv);
 int lept_partitiontest_main(int argc, const char **argv);
+int lept_pboxa_reg_main(int argc, const char **argv);
 int lept_pdfio1_reg_main(int argc, const char **argv);
 int lept_pdfio2_reg_main(int argc, const char **argv);
 int lept_pdfseg_reg_main(int argc, const char **argv);
@@ -220,6 +222,7 @@ int lept_pixserial_reg_main(int argc, const char **argv);
 int lept_pixtile_reg_main(int argc, const char **argv);
 int lept_plottest_main(int argc, const char **argv);
 int lept_pngio_reg_main(int argc, const char **argv);
+int lept_pngpresets_main(int argc, const char **argv);
 int lept_pnmio_reg_main(int argc, const char **argv);
 int lept_printimage_main(int argc, const char **argv);
 int lept_printsplitimage_main(int argc, const char **argv);
@@ -255,6 +258,7 @@ int lept_reducetest_main(int argc, const char **argv);
 int lept_removecmap_main(int argc, const char **argv);
 int lept_renderfonts_main(int argc, const char **argv);
 int lept_replacebytes_main(int argc, const char **argv);
+int lept_rlpix_reg_main(int argc, const char **argv);
 int lept_rotate1_reg_main(int argc, const char **argv);
 int lept_rotate2_reg_main(int argc, const char **argv);
 int lept_rotate_it_main(int argc, const char **argv);
@@ -293,6 +297,8 @@ int lept_sudokutest_main(int argc, const char **argv);
 int lept_textorient_main(int argc, const char **argv);
 int lept_texturefill_reg_main(int argc, const char **argv);
 int lept_threshnorm_reg_main(int argc, const char **argv);
+int lept_tiffbands_reg_main(int argc, const char **argv);
+int lept_tiffindex_reg_main(int argc, const char **argv);
 int lept_thresholding_test_main(int argc, const char **argv);
 int lept_tiffpdftest_main(int argc, const char **argv);
 int lept_translate_reg_main(int argc, const char **argv);
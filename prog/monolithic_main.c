@@ -98,6 +98,7 @@ MONOLITHIC_CMD_TABLE_START()
 { "croppdf", { .fa = lept_croppdf_main } },
 { "croptext", { .fa = lept_croptext_main } },
 { "custom_log_plot_test", { .fa = lept_custom_log_plot_test_main } },
+{ "deflate", { .fa = lept_deflate_reg_main } },
 { "deskew_it", { .fa = lept_deskew_it_main } },
 { "dewarp", { .fa = lept_dewarp_reg_main } },
 { "dewarprules", { .fa = lept_dewarprules_main } },
@@ -213,6 +214,7 @@ MONOLITHIC_CMD_TABLE_START()
 { "partifytest", { .fa = lept_partifytest_main } },
 { "partition", { .fa = lept_partition_reg_main } },
 { "partitiontest", { .fa = lept_partitiontest_main } },
+{ "pboxa", { .fa = lept_pboxa_reg_main } },
 { "pdfio1", { .fa = lept_pdfio1_reg_main } },
 { "pdfio2", { .fa = lept_pdfio2_reg_main } },
 { "pdfseg", { .fa = lept_pdfseg_reg_main } },
@@ -229,6 +231,7 @@ MONOLITHIC_CMD_TABLE_START()
 { "pixtile", { .fa = lept_pixtile_reg_main } },
 { "plottest", { .fa = lept_plottest_main } },
 { "pngio", { .fa = lept_pngio_reg_main } },
+{ "pngpresets", { .fa = lept_pngpresets_main } },
 { "pnmio", { .fa = lept_pnmio_reg_main } },
 { "printimage", { .fa = lept_printimage_main } },
 { "printsplitimage", { .fa = lept_printsplitimage_main } },
@@ -264,6 +267,7 @@ MONOLITHIC_CMD_TABLE_START()
 { "removecmap", { .fa = lept_removecmap_main } },
 { "renderfonts", { .fa = lept_renderfonts_main } },
 { "replacebytes", { .fa = lept_replacebytes_main } },
+{ "rlpix", { .fa = lept_rlpix_reg_main } },
 { "rotate1", { .fa = lept_rotate1_reg_main } },
 { "rotate2", { .fa = lept_rotate2_reg_main } },
 { "rotate_it", { .fa = lept_rotate_it_main } },
@@ -303,6 +307,8 @@ MONOLITHIC_CMD_TABLE_START()
 { "textorient", { .fa = lept_textorient_main } },
 { "texturefill", { .fa = lept_texturefill_reg_main } },
 { "threshnorm", { .fa = lept_threshnorm_reg_main } },
+{ "tiffbands", { .fa = lept_tiffbands_reg_main } },
+{ "tiffindex", { .fa = lept_tiffindex_reg_main } },
 { "thresholding_test", { .fa = lept_thresholding_test_main } },
 { "tiffpdftest", { .fa = lept_tiffpdftest_main } },
 { "translate", { .fa = lept_translate_reg_main } },
@@ -41,6 +41,7 @@
 #define  SEQUENCE3    "e3.3 + d3.3 + tw5.5"
 #define  SEQUENCE4    "O3.3 + C3.3"
 #define  SEQUENCE5    "O5.5 + C5.5"
+#define  SEQUENCE6    "O7.1 + C1.9 + d5.3 + e3.7 + tb5.5 + dr3 + c11.11"
 #define  BAD_SEQUENCE  "O1.+D8 + E2.4 + e.4 + r25 + R + R.5 + X + x5 + y7.3"
 
 #define  DISPLAY_SEPARATION   0   /* use 250 to get images displayed */
@@ -53,7 +54,9 @@
 int main(int    argc,
          const char **argv)
 {
-PIX  *pixs, *pixg, *pixc, *pixd;
+PIX           *pixs, *pixg, *pixc, *pixd, *pix1;
+PIXA          *pixaw;
+L_MORPH_PLAN  *plan;
 L_REGPARAMS* rp;
 
 	if (regTestSetup(argc, argv, "morph_seq", NULL, &rp))
@@ -115,12 +118,60 @@ L_REGPARAMS* rp;
     pixDestroy(&pixc);
     pixDestroy(&pixd);
 
+        /* Compiled plans, applied twice with reused buffers */
+    plan = morphPlanCreate(SEQUENCE1, 1);
+    pixaw = pixaCreate(0);
+    pixd = pixMorphSequence(pixs, SEQUENCE1, 0);
+    pix1 = pixMorphPlanApply(pixs, plan, pixaw);
+    regTestComparePix(rp, pixd, pix1);  /* 0 */
+    pixDestroy(&pix1);
+    pix1 = pixMorphPlanApply(pixs, plan, pixaw);
+    regTestComparePix(rp, pixd, pix1);  /* 1 */
+    pixDestroy(&pix1);
+    pixDestroy(&pixd);
+    pixaDestroy(&pixaw);
+    morphPlanDestroy(&plan);
+    plan = morphPlanCreate(SEQUENCE2, 1);
+    pixd = pixMorphSequence(pixs, SEQUENCE2, 0);
+    pix1 = pixMorphPlanApply(pixs, plan, NULL);
+    regTestComparePix(rp, pixd, pix1);  /* 2 */
+    pixDestroy(&pix1);
+    pixDestroy(&pixd);
+    morphPlanDestroy(&plan);
+    plan = morphPlanCreate(SEQUENCE3, 8);
+    pixd = pixGrayMorphSequence(pixg, SEQUENCE3, 0, 0);
+    pix1 = pixMorphPlanApply(pixg, plan, NULL);
+    regTestComparePix(rp, pixd, pix1);  /* 3 */
+    pixDestroy(&pix1);
+    pixDestroy(&pixd);
+    morphPlanDestroy(&plan);
+    plan = morphPlanCreate(SEQUENCE6, 8);
+    pixaw = pixaCreate(0);
+    pixd = pixGrayMorphSequence(pixg, SEQUENCE6, 0, 0);
+    pix1 = pixMorphPlanApply(pixg, plan, pixaw);
+    regTestComparePix(rp, pixd, pix1);  /* 4 */
+    pixDestroy(&pix1);
+    pix1 = pixMorphPlanApply(pixg, plan, pixaw);
+    regTestComparePix(rp, pixd, pix1);  /* 5 */
+    pixDestroy(&pix1);
+    pixDestroy(&pixd);
+    morphPlanDestroy(&plan);
+    plan = morphPlanCreate(SEQUENCE4, 8);  /* same buffers, smaller frame */
+    pixd = pixGrayMorphSequence(pixg, SEQUENCE4, 0, 0);
+    pix1 = pixMorphPlanApply(pixg, plan, pixaw);
+    regTestComparePix(rp, pixd, pix1);  /* 6 */
+    pixDestroy(&pix1);
+    pixDestroy(&pixd);
+    pixaDestroy(&pixaw);
+    morphPlanDestroy(&plan);
+
         /* Syntax error handling */
     lept_stderr("\n ----------------- Error messages ------------------\n");
     lept_stderr(" ---------------- Invalid sequence -----------------\n");
     lept_stderr(" ---------------------------------------------------\n");
     pixd = pixMorphSequence(pixs, BAD_SEQUENCE, 50);  /* fails; returns null */
     pixd = pixGrayMorphSequence(pixg, BAD_SEQUENCE, 50, 0);  /* this fails */
+    plan = morphPlanCreate(BAD_SEQUENCE, 1);  /* this fails */
 
     pixDestroy(&pixg);
     pixDestroy(&pixs);
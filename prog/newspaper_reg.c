@@ -31,6 +31,9 @@
  *
  *  Most of the work is done at 4x reduction (approx. 75 ppi),
  *  which makes it very fast.
+ *
+ *  Also checks that the banded binary seedfill gives the same
+ *  result as the fill done serially in one band.
  */
 
 #include "demo_settings.h"
@@ -38,6 +41,8 @@
 #include "monolithic_examples.h"
 
 
+static void TestBandedSeedfill(L_REGPARAMS *rp, PIX *pixs, PIX *pixm);
+
 
 #if defined(BUILD_MONOLITHIC)
 #define main   lept_newspaper_reg_main
@@ -46,10 +51,11 @@
 int main(int    argc,
          const char **argv)
 {
-l_int32       w, h;
+l_int32       i, w, h, same;
 BOXA         *boxa;
 PIX          *pixs, *pixt, *pix1, *pix2, *pix3, *pix4, *pix5;
-PIX          *pix6, *pix7, *pix8, *pix9, *pix10, *pix11;
+PIX          *pix6, *pix7, *pix8, *pix9, *pix10, *pix11, *pix12;
+PIX          *pix13, *pix14;
 PIXA         *pixa1, *pixa2;
 PIXCMAP      *cmap;
 L_REGPARAMS* rp;
@@ -159,6 +165,36 @@ L_REGPARAMS* rp;
                      "/tmp/lept/regout/newspaper.pdf");
     L_INFO("Output pdf: /tmp/lept/regout/newspaper.pdf\n", rp->testname);
 
+        /* Banded seedfill, for the vertical lines and for filling
+         * the background from the border */
+    pixt = pixMorphSequence(pix1, "o1.50", 0);
+    TestBandedSeedfill(rp, pixt, pix1);  /* 13 - 18 */
+    pixDestroy(&pixt);
+    pixt = pixCreateTemplate(pix1);
+    pixSetOrClearBorder(pixt, 1, 1, 1, 1, PIX_SET);
+    pix12 = pixInvert(NULL, pix1);
+    TestBandedSeedfill(rp, pixt, pix12);  /* 19 - 24 */
+    pixDestroy(&pixt);
+
+        /* A serpentine mask, where the fill from a single seed pixel
+         * must cross every band boundary many times, in both directions */
+    pix13 = pixCreate(300, 700, 1);
+    for (i = 0; i < 15; i++) {
+        pixRasterop(pix13, 10 + 20 * i, 5, 3, 690, PIX_SET, NULL, 0, 0);
+        if (i < 14)
+            pixRasterop(pix13, 10 + 20 * i, (i % 2) ? 5 : 692, 23, 3,
+                        PIX_SET, NULL, 0, 0);
+    }
+    pixt = pixCreateTemplate(pix13);
+    pixSetPixel(pixt, 11, 5, 1);
+    TestBandedSeedfill(rp, pixt, pix13);  /* 25 - 30 */
+    pix14 = pixSeedfillBinaryBands(NULL, pixt, pix13, 4, 8);
+    pixEqual(pix13, pix14, &same);  /* the entire mask is filled */
+    regTestCompareValues(rp, 1, same, 0);  /* 31 */
+    pixDestroy(&pixt);
+    pixDestroy(&pix13);
+    pixDestroy(&pix14);
+
     pixaDestroy(&pixa1);
     pixDestroy(&pixs);
     pixDestroy(&pix1);
@@ -172,6 +208,27 @@ L_REGPARAMS* rp;
     pixDestroy(&pix9);
     pixDestroy(&pix10);
     pixDestroy(&pix11);
+    pixDestroy(&pix12);
     return regTestCleanup(rp);
 }
 
+
+static void
+TestBandedSeedfill(L_REGPARAMS  *rp,
+                   PIX          *pixs,
+                   PIX          *pixm)
+{
+l_int32  i, connectivity;
+PIX     *pix1, *pix2;
+
+    for (i = 0; i < 6; i++) {
+        connectivity = (i < 3) ? 4 : 8;
+            /* Serial reference: a single band */
+        pix1 = pixSeedfillBinaryBands(NULL, pixs, pixm, connectivity, 1);
+        pix2 = pixSeedfillBinaryBands(NULL, pixs, pixm, connectivity,
+                                      2 + 3 * (i % 3));
+        regTestComparePix(rp, pix1, pix2);
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+    }
+}
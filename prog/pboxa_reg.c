@@ -0,0 +1,377 @@
+/*====================================================================*
+ -  Copyright (C) 2001 Leptonica.  All rights reserved.
+ -
+ -  Redistribution and use in source and binary forms, with or without
+ -  modification, are permitted provided that the following conditions
+ -  are met:
+ -  1. Redistributions of source code must retain the above copyright
+ -     notice, this list of conditions and the following disclaimer.
+ -  2. Redistributions in binary form must reproduce the above
+ -     copyright notice, this list of conditions and the following
+ -     disclaimer in the documentation and/or other materials
+ -     provided with the distribution.
+ -
+ -  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ -  ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ -  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ -  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL ANY
+ -  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ -  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ -  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ -  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ -  OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ -  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ -  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *====================================================================*/
+
+/*
+ *  pboxa_reg.c
+ *
+ *    Regression test for the packed array of boxes (L_PBOXA).
+ *    Each operation on the packed arrays is compared with the
+ *    boxa operation:
+ *       (1) conversion to and from boxa, and the extent
+ *       (2) sorting, for each sort type and order
+ *       (3) selection by size
+ *       (4) intersection with a box
+ *       (5) combining overlapping boxes
+ *    and the spatial index (L_BOXGRID) is compared with a direct scan:
+ *       (6) finding boxes that intersect a box
+ *       (7) combining overlaps in a pair of boxa, handling overlaps,
+ *           and containment of one boxa in another
+ */
+
+#include "demo_settings.h"
+
+#include "monolithic_examples.h"
+
+
+static l_int32 SortKeysEqual(BOXA *boxa1, BOXA *boxa2, l_int32 sorttype);
+static NUMA *HandleOverlapsMap(BOXA *boxas, l_int32 range,
+                               l_float32 min_overlap, l_float32 max_ratio);
+static BOXA *MakeRandomBoxa(l_int32 n, l_int32 size);
+
+static const l_int32  NSortTypes = 11;
+static const l_int32  SortTypes[] = {L_SORT_BY_X, L_SORT_BY_Y,
+                                     L_SORT_BY_RIGHT, L_SORT_BY_BOT,
+                                     L_SORT_BY_WIDTH, L_SORT_BY_HEIGHT,
+                                     L_SORT_BY_MIN_DIMENSION,
+                                     L_SORT_BY_MAX_DIMENSION,
+                                     L_SORT_BY_PERIMETER, L_SORT_BY_AREA,
+                                     L_SORT_BY_ASPECT_RATIO};
+static const l_int32  SelectTypes[] = {L_SELECT_WIDTH, L_SELECT_HEIGHT,
+                                       L_SELECT_IF_EITHER, L_SELECT_IF_BOTH};
+static const l_int32  Relations[] = {L_SELECT_IF_LT, L_SELECT_IF_GT,
+                                     L_SELECT_IF_LTE, L_SELECT_IF_GTE};
+
+
+#if defined(BUILD_MONOLITHIC)
+#define main   lept_pboxa_reg_main
+#endif
+
+int main(int    argc,
+         const char **argv)
+{
+l_int32       i, j, same, w1, h1, w2, h2, changed1, changed2, cont;
+l_int32       n, val;
+BOX          *box, *box1, *box2;
+BOXA         *boxas, *boxa1, *boxa2, *boxa3, *boxa4, *boxa5;
+L_BOXGRID    *grid;
+L_PBOXA      *pbas, *pba1, *pba2;
+NUMA         *na1, *na2;
+PIX          *pixs, *pix1;
+PIXA         *pixa;
+L_REGPARAMS  *rp;
+
+    if (regTestSetup(argc, argv, "pboxa", NULL, &rp))
+        return 1;
+
+    pixs = pixRead(regGetFileArgOrDefault(rp, "feyn-fract.tif"));
+    boxas = pixConnCompBB(pixs, 8);
+
+        /* Conversion and extent */
+    pbas = boxaConvertToPboxa(boxas);
+    boxa1 = pboxaConvertToBoxa(pbas);
+    boxaEqual(boxas, boxa1, 0, NULL, &same);
+    regTestCompareValues(rp, 1, same, 0);  /* 0 */
+    regTestCompareValues(rp, boxaGetCount(boxas), pboxaGetCount(pbas),
+                         0);  /* 1 */
+    boxaGetExtent(boxas, &w1, &h1, &box1);
+    pboxaGetExtent(pbas, &w2, &h2, &box2);
+    boxEqual(box1, box2, &same);
+    regTestCompareValues(rp, 1, same && w1 == w2 && h1 == h2, 0);  /* 2 */
+    boxaDestroy(&boxa1);
+    boxDestroy(&box1);
+    boxDestroy(&box2);
+
+        /* Sorting; boxes with equal keys may be in a different order */
+    for (i = 0; i < NSortTypes; i++) {  /* 3 - 24 */
+        for (j = 0; j < 2; j++) {
+            boxa1 = boxaSort(boxas, SortTypes[i],
+                       (j == 0) ? L_SORT_INCREASING : L_SORT_DECREASING, NULL);
+            pba1 = pboxaSort(pbas, SortTypes[i],
+                       (j == 0) ? L_SORT_INCREASING : L_SORT_DECREASING, NULL);
+            boxa2 = pboxaConvertToBoxa(pba1);
+            regTestCompareValues(rp, 1,
+                                 SortKeysEqual(boxa1, boxa2, SortTypes[i]), 0);
+            boxaDestroy(&boxa1);
+            boxaDestroy(&boxa2);
+            pboxaDestroy(&pba1);
+        }
+    }
+
+        /* Selection by size */
+    for (i = 0; i < 4; i++) {  /* 25 - 32 */
+        boxa1 = boxaSelectBySize(boxas, 12, 20, SelectTypes[i],
+                                 Relations[i], &changed1);
+        pba1 = pboxaSelectBySize(pbas, 12, 20, SelectTypes[i],
+                                 Relations[i], &changed2);
+        boxa2 = pboxaConvertToBoxa(pba1);
+        boxaEqual(boxa1, boxa2, 0, NULL, &same);
+        regTestCompareValues(rp, 1, same, 0);
+        regTestCompareValues(rp, changed1, changed2, 0);
+        boxaDestroy(&boxa1);
+        boxaDestroy(&boxa2);
+        pboxaDestroy(&pba1);
+    }
+
+        /* Intersection with a box */
+    pixGetDimensions(pixs, &w1, &h1, NULL);
+    box = boxCreate(w1 / 4, h1 / 3, w1 / 2, h1 / 4);
+    boxa1 = boxaIntersectsBox(boxas, box);
+    pba1 = pboxaIntersectsBox(pbas, box);
+    boxa2 = pboxaConvertToBoxa(pba1);
+    boxaEqual(boxa1, boxa2, 0, NULL, &same);
+    regTestCompareValues(rp, 1, same, 0);  /* 33 */
+    boxaDestroy(&boxa1);
+    boxaDestroy(&boxa2);
+    pboxaDestroy(&pba1);
+    boxDestroy(&box);
+
+        /* Combining overlaps, on the boxes of the components after
+         * dilation, so that many of them overlap.  The boxa function
+         * with debug output does not use the packed arrays. */
+    pix1 = pixDilateBrick(NULL, pixs, 5, 5);
+    boxa1 = pixConnCompBB(pix1, 8);
+    boxa2 = boxaAdjustSides(boxa1, -2, 2, -2, 2);  /* undo the dilation */
+    boxaDestroy(&boxa1);
+    pba1 = boxaConvertToPboxa(boxa2);
+    pba2 = pboxaCombineOverlaps(pba1);
+    boxa1 = pboxaConvertToBoxa(pba2);
+    boxa3 = boxaCombineOverlaps(boxa2, NULL);
+    boxaEqual(boxa1, boxa3, 0, NULL, &same);
+    regTestCompareValues(rp, 1, same, 0);  /* 34 */
+    boxaDestroy(&boxa3);
+    pixa = pixaCreate(0);
+    boxa3 = boxaCombineOverlaps(boxa2, pixa);
+    boxaEqual(boxa1, boxa3, 0, NULL, &same);
+    regTestCompareValues(rp, 1, same, 0);  /* 35 */
+    pixaDestroy(&pixa);
+    pixDestroy(&pix1);
+    boxaDestroy(&boxa1);
+    boxaDestroy(&boxa2);
+    boxaDestroy(&boxa3);
+    pboxaDestroy(&pba1);
+    pboxaDestroy(&pba2);
+
+        /* Finding the boxes that intersect a box, with the grid */
+    grid = boxgridCreate(boxas, 0, 0);
+    pixGetDimensions(pixs, &w1, &h1, NULL);
+    for (i = 0; i < 4; i++) {  /* 36 - 39 */
+        box = boxCreate(i * w1 / 5 - 20, i * h1 / 5 - 20,
+                        w1 / 3 + 40 * i, h1 / 6 + 10 * i);
+        boxa1 = boxaIntersectsBox(boxas, box);
+        na1 = boxgridFindIntersecting(grid, box);
+        boxa2 = boxaCreate(0);
+        n = numaGetCount(na1);
+        for (j = 0; j < n; j++) {
+            numaGetIValue(na1, j, &val);
+            boxaAddBox(boxa2, boxaGetBox(boxas, val, L_CLONE), L_INSERT);
+        }
+        boxaEqual(boxa1, boxa2, 0, NULL, &same);
+        regTestCompareValues(rp, 1, same, 0);
+        boxaDestroy(&boxa1);
+        boxaDestroy(&boxa2);
+        numaDestroy(&na1);
+        boxDestroy(&box);
+    }
+    boxgridDestroy(&grid);
+
+        /* Combining overlaps in a pair.  The boxa function with
+         * debug output does not use the packed arrays or the grid. */
+    srand(45617);
+    boxa1 = MakeRandomBoxa(600, 60);
+    boxa2 = MakeRandomBoxa(400, 30);
+    boxaCombineOverlapsInPair(boxa1, boxa2, &boxa3, &boxa4, NULL);
+    pixa = pixaCreate(0);
+    boxaCombineOverlapsInPair(boxa1, boxa2, &boxa5, &boxa1, pixa);
+    boxaEqual(boxa3, boxa5, 0, NULL, &same);
+    regTestCompareValues(rp, 1, same, 0);  /* 40 */
+    boxaEqual(boxa4, boxa1, 0, NULL, &same);
+    regTestCompareValues(rp, 1, same, 0);  /* 41 */
+    pixaDestroy(&pixa);
+    boxaDestroy(&boxa1);
+    boxaDestroy(&boxa2);
+    boxaDestroy(&boxa3);
+    boxaDestroy(&boxa4);
+    boxaDestroy(&boxa5);
+
+        /* Handling overlaps, with a range that uses the grid */
+    boxa1 = MakeRandomBoxa(800, 50);
+    n = boxaGetCount(boxa1);
+    for (i = 0; i < 2; i++) {  /* 42 - 45 */
+        boxa2 = boxaHandleOverlaps(boxa1, (i == 0) ? L_COMBINE :
+                                   L_REMOVE_SMALL, 200, 0.2 * i, 0.8, &na1);
+        na2 = HandleOverlapsMap(boxa1, 200, 0.2 * i, 0.8);
+        numaSimilar(na1, na2, 0.0, &same);
+        regTestCompareValues(rp, 1, same, 0);
+        numaDestroy(&na1);
+        numaDestroy(&na2);
+        boxaDestroy(&boxa2);
+        boxa2 = boxaHandleOverlaps(boxa1, L_COMBINE, n, 0.0, 1.0, &na1);
+        na2 = HandleOverlapsMap(boxa1, n, 0.0, 1.0);
+        numaSimilar(na1, na2, 0.0, &same);
+        regTestCompareValues(rp, 1, same, 0);
+        numaDestroy(&na1);
+        numaDestroy(&na2);
+        boxaDestroy(&boxa2);
+    }
+
+        /* Containment: the input boxes are in the combined boxes,
+         * but the combined boxes are not all in the input boxes */
+    boxa2 = boxaCombineOverlaps(boxa1, NULL);
+    boxaContainedInBoxa(boxa2, boxa1, &cont);
+    regTestCompareValues(rp, 1, cont, 0);  /* 46 */
+    boxaContainedInBoxa(boxa1, boxa2, &cont);
+    regTestCompareValues(rp, 0, cont, 0);  /* 47 */
+    boxaDestroy(&boxa1);
+    boxaDestroy(&boxa2);
+
+        /* Timing for many random boxes */
+    boxa1 = MakeRandomBoxa(20000, 12);
+    startTimer();
+    boxa2 = boxaCombineOverlaps(boxa1, NULL);
+    lept_stderr("Time to combine %d boxes: %7.3f sec\n",
+                boxaGetCount(boxa1), stopTimer());
+    boxaDestroy(&boxa1);
+    boxaDestroy(&boxa2);
+
+    pboxaDestroy(&pbas);
+    boxaDestroy(&boxas);
+    pixDestroy(&pixs);
+    return regTestCleanup(rp);
+}
+
+
+    /* Returns 1 if the sort keys of corresponding boxes are equal */
+static l_int32
+SortKeysEqual(BOXA    *boxa1,
+              BOXA    *boxa2,
+              l_int32  sorttype)
+{
+l_int32  i, n, x1, y1, w1, h1, x2, y2, w2, h2;
+
+    if ((n = boxaGetCount(boxa1)) != boxaGetCount(boxa2))
+        return 0;
+    for (i = 0; i < n; i++) {
+        boxaGetBoxGeometry(boxa1, i, &x1, &y1, &w1, &h1);
+        boxaGetBoxGeometry(boxa2, i, &x2, &y2, &w2, &h2);
+        switch (sorttype)
+        {
+        case L_SORT_BY_X:
+            if (x1 != x2) return 0;
+            break;
+        case L_SORT_BY_Y:
+            if (y1 != y2) return 0;
+            break;
+        case L_SORT_BY_RIGHT:
+            if (x1 + w1 != x2 + w2) return 0;
+            break;
+        case L_SORT_BY_BOT:
+            if (y1 + h1 != y2 + h2) return 0;
+            break;
+        case L_SORT_BY_WIDTH:
+            if (w1 != w2) return 0;
+            break;
+        case L_SORT_BY_HEIGHT:
+            if (h1 != h2) return 0;
+            break;
+        case L_SORT_BY_MIN_DIMENSION:
+            if (L_MIN(w1, h1) != L_MIN(w2, h2)) return 0;
+            break;
+        case L_SORT_BY_MAX_DIMENSION:
+            if (L_MAX(w1, h1) != L_MAX(w2, h2)) return 0;
+            break;
+        case L_SORT_BY_PERIMETER:
+            if (w1 + h1 != w2 + h2) return 0;
+            break;
+        case L_SORT_BY_AREA:
+            if (w1 * h1 != w2 * h2) return 0;
+            break;
+        default:  /* L_SORT_BY_ASPECT_RATIO */
+            if ((l_float32)w1 / (l_float32)h1 !=
+                (l_float32)w2 / (l_float32)h2) return 0;
+            break;
+        }
+    }
+    return 1;
+}
+
+
+    /* Direct scan over all pairs within the range, for the map
+     * returned by boxaHandleOverlaps() */
+static NUMA *
+HandleOverlapsMap(BOXA      *boxas,
+                  l_int32    range,
+                  l_float32  min_overlap,
+                  l_float32  max_ratio)
+{
+l_int32  i, j, n, w, h, area1, area2, overlap_area;
+BOX     *box1, *box2;
+NUMA    *namap;
+
+    n = boxaGetCount(boxas);
+    namap = numaMakeConstant(-1, n);
+    for (i = 0; i < n; i++) {
+        box1 = boxaGetBox(boxas, i, L_CLONE);
+            boxGetGeometry(box1, NULL, NULL, &w, &h);
+        area1 = w * h;
+        for (j = i + 1; j < i + 1 + range && j < n; j++) {
+            box2 = boxaGetBox(boxas, j, L_CLONE);
+            boxGetGeometry(box2, NULL, NULL, &w, &h);
+            area2 = w * h;
+            boxOverlapArea(box1, box2, &overlap_area);
+            if (overlap_area > 0 && area1 >= area2) {
+                if ((l_float32)overlap_area / area2 >= min_overlap &&
+                    (l_float32)area2 / area1 <= max_ratio)
+                    numaSetValue(namap, j, i);
+            } else if (overlap_area > 0) {
+                if ((l_float32)overlap_area / area1 >= min_overlap &&
+                    (l_float32)area1 / area2 <= max_ratio)
+                    numaSetValue(namap, i, j);
+            }
+            boxDestroy(&box2);
+        }
+        boxDestroy(&box1);
+    }
+    return namap;
+}
+
+
+    /* Boxes with random position in a 2000 x 2000 region and random
+     * size up to %size */
+static BOXA *
+MakeRandomBoxa(l_int32  n,
+               l_int32  size)
+{
+l_int32  i;
+BOXA    *boxa;
+
+    boxa = boxaCreate(n);
+    for (i = 0; i < n; i++) {
+        boxaAddBox(boxa, boxCreate(rand() % 2000, rand() % 2000,
+                                   1 + rand() % size, 1 + rand() % size),
+                   L_INSERT);
+    }
+    return boxa;
+}
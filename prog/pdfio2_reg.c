@@ -36,6 +36,7 @@
 static void GetImageMask(PIX *pixs, l_int32 res, BOXA **pboxa,
                          L_REGPARAMS *rp, const char *debugfile);
 static PIX * QuantizeNonImageRegion(PIX *pixs, PIX *pixm, l_int32 levels);
+static l_int32 XrefIsValid(const l_uint8 *data, size_t nbytes);
 
 
 
@@ -46,13 +47,20 @@ static PIX * QuantizeNonImageRegion(PIX *pixs, PIX *pixm, l_int32 levels);
 int main(int    argc,
          const char **argv)
 {
-l_uint8      *data;
-l_int32       w, h, same;
-size_t        nbytes;
-BOXA         *boxa1, *boxa2;
-L_BYTEA      *ba;
-PIX          *pix1, *pix2, *pix3, *pix4, *pix5, *pix6;
-L_REGPARAMS  *rp;
+l_uint8       *data, *data2;
+l_int32        i, n, w, h, same, npages, npages2, ret, nthreads;
+size_t         nbytes, nbytes2;
+BOXA          *boxa1, *boxa2;
+FILE          *fp;
+L_BYTEA       *ba;
+L_COMP_DATA   *cid;
+L_PTRA        *pa_data;
+PIX           *pix1, *pix2, *pix3, *pix4, *pix5, *pix6;
+PIXA          *pixa;
+PIXAC         *pixac;
+SARRAY        *sa;
+L_PDF_WRITER  *pdfw;
+L_REGPARAMS   *rp;
 
 #if !defined(HAVE_LIBPNG)
     L_ERROR("This test requires libpng to run.\n", "pdfio2_reg");
@@ -305,6 +313,136 @@ L_REGPARAMS  *rp;
         lept_stderr("Busted: files are different\n");
     lept_stderr("Corruption recovery time: %7.3f\n", stopTimer());
 
+    /* ------------------ Test streaming pdf writer ----------------- */
+    lept_stderr("\n*** Writing multipage pdfs with the streaming writer\n");
+    pixa = pixaCreate(0);
+    pixaAddPix(pixa, pixRead("feyn-fract.tif"), L_INSERT);
+    pixaAddPix(pixa, pixRead("test8.jpg"), L_INSERT);
+    pixaAddPix(pixa, pixRead("weasel4.16c.png"), L_INSERT);
+    pixaAddPix(pixa, pixRead("marge.jpg"), L_INSERT);
+
+        /* Pages from pix, compressed data and a file */
+    pdfw = pdfWriterOpen("/tmp/lept/pdf2/writer1.pdf", "writer test");
+    for (i = 0; i < pixaGetCount(pixa); i++) {
+        pix1 = pixaGetPix(pixa, i, L_CLONE);
+        pdfWriterAddPix(pdfw, pix1, L_DEFAULT_ENCODE, 0, 0);
+        pixDestroy(&pix1);
+    }
+    l_generateCIDataForPdf("rabi.png", NULL, 0, &cid);
+    pdfWriterAddCompData(pdfw, cid);
+    pdfWriterAddFile(pdfw, "test24.jpg");
+    regTestCompareValues(rp, 6, pdfWriterGetPageCount(pdfw), 0);  /* 20 */
+    ret = pdfWriterClose(&pdfw);
+    regTestCompareValues(rp, 0, ret, 0);  /* 21 */
+    getPdfPageCount("/tmp/lept/pdf2/writer1.pdf", &npages);
+    regTestCompareValues(rp, 6, npages, 0);  /* 22 */
+
+        /* Stream the pages to a file, and independently make the same
+         * pdf in memory by concatenating single page pdfs of each pix */
+    fp = fopenWriteStream("/tmp/lept/pdf2/writer3.pdf", "wb");
+    pdfw = pdfWriterOpenStream(fp, NULL);
+    pa_data = ptraCreate(0);
+    for (i = 0; i < pixaGetCount(pixa); i++) {
+        pix1 = pixaGetPix(pixa, i, L_CLONE);
+        pdfWriterAddPix(pdfw, pix1, L_DEFAULT_ENCODE, 0, 0);
+        pixConvertToPdfData(pix1, L_DEFAULT_ENCODE, 0, &data, &nbytes,
+                            0, 0, 0, NULL, NULL, 0);
+        ptraAdd(pa_data, l_byteaInitFromMem(data, nbytes));
+        lept_free(data);
+        pixDestroy(&pix1);
+    }
+    pdfWriterClose(&pdfw);
+    fclose(fp);
+    ptraConcatenatePdfToData(pa_data, NULL, &data, &nbytes);
+    ptraGetActualCount(pa_data, &n);
+    for (i = 0; i < n; i++) {
+        ba = (L_BYTEA *)ptraRemove(pa_data, i, L_NO_COMPACTION);
+        l_byteaDestroy(&ba);
+    }
+    ptraDestroy(&pa_data, FALSE, FALSE);
+    l_binaryWrite("/tmp/lept/pdf2/writer2.pdf", "w", data, nbytes);
+    data2 = l_binaryRead("/tmp/lept/pdf2/writer3.pdf", &nbytes2);
+
+        /* Both have the same pages and the same layout, with the Pages
+         * object ahead of the pages, so the files are identical.  The
+         * xref table of each streamed file gives the location of every
+         * object */
+    getPdfPageCount("/tmp/lept/pdf2/writer2.pdf", &npages);
+    regTestCompareValues(rp, 4, npages, 0);  /* 23 */
+    getPdfPageCount("/tmp/lept/pdf2/writer3.pdf", &npages2);
+    regTestCompareValues(rp, npages, npages2, 0);  /* 24 */
+    regTestCompareStrings(rp, data, nbytes, data2, nbytes2);  /* 25 */
+    regTestCompareValues(rp, 1, XrefIsValid(data2, nbytes2), 0);  /* 26 */
+    lept_free(data);
+    lept_free(data2);
+    data = l_binaryRead("/tmp/lept/pdf2/writer1.pdf", &nbytes);
+    regTestCompareValues(rp, 1, XrefIsValid(data, nbytes), 0);  /* 27 */
+    lept_free(data);
+    pixaDestroy(&pixa);
+
+        /* A writer with no pages is an error */
+    pdfw = pdfWriterOpen("/tmp/lept/pdf2/writer4.pdf", NULL);
+    ret = pdfWriterClose(&pdfw);
+    regTestCompareValues(rp, 1, ret, 0);  /* 28 */
+
+    /* -------------- Test encoding pages on several threads ------------- */
+    lept_stderr("\n*** Encoding pdf pages on several threads\n");
+    nthreads = l_pdfSetThreads(1);
+    sa = getSortedPathnamesInDirectory("/tmp/lept/image", "file", 0, 0);
+    saConvertFilesToPdfData(sa, 100, 0.8, L_DEFAULT_ENCODE, 75, "threads",
+                            &data, &nbytes);
+    saConvertFilesToPdf(sa, 100, 0.8, L_DEFAULT_ENCODE, 75, "threads",
+                        "/tmp/lept/pdf2/threads1.pdf");
+    l_pdfSetThreads(3);
+    saConvertFilesToPdfData(sa, 100, 0.8, L_DEFAULT_ENCODE, 75, "threads",
+                            &data2, &nbytes2);
+    saConvertFilesToPdf(sa, 100, 0.8, L_DEFAULT_ENCODE, 75, "threads",
+                        "/tmp/lept/pdf2/threads2.pdf");
+    regTestCompareStrings(rp, data, nbytes, data2, nbytes2);  /* 29 */
+    filesAreIdentical("/tmp/lept/pdf2/threads1.pdf",
+                      "/tmp/lept/pdf2/threads2.pdf", &same);
+    regTestCompareValues(rp, 1, same, 0);  /* 30 */
+    lept_free(data);
+    lept_free(data2);
+    sarrayDestroy(&sa);
+
+        /* More pages than are encoded at once, with the same pix
+         * appearing several times */
+    pixa = pixaCreate(0);
+    pix1 = pixRead("feyn-fract.tif");
+    pix2 = pixRead("weasel4.16c.png");
+    pix3 = pixRead("test8.jpg");
+    for (i = 0; i < 5; i++) {
+        pixaAddPix(pixa, pix1, L_CLONE);
+        pixaAddPix(pixa, pix2, L_CLONE);
+        pixaAddPix(pixa, pix3, L_CLONE);
+    }
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    pixDestroy(&pix3);
+    l_pdfSetThreads(1);
+    pixaConvertToPdfData(pixa, 0, 1.0, L_DEFAULT_ENCODE, 0, "threads",
+                         &data, &nbytes);
+    l_pdfSetThreads(0);
+    pixaConvertToPdfData(pixa, 0, 1.0, L_DEFAULT_ENCODE, 0, "threads",
+                         &data2, &nbytes2);
+    regTestCompareStrings(rp, data, nbytes, data2, nbytes2);  /* 31 */
+    lept_free(data);
+    lept_free(data2);
+    pixac = pixacompCreateFromPixa(pixa, IFF_DEFAULT, L_CLONE);
+    l_pdfSetThreads(1);
+    pixacompConvertToPdfData(pixac, 0, 0.5, L_DEFAULT_ENCODE, 0, "threads",
+                             &data, &nbytes);
+    l_pdfSetThreads(4);
+    pixacompConvertToPdfData(pixac, 0, 0.5, L_DEFAULT_ENCODE, 0, "threads",
+                             &data2, &nbytes2);
+    regTestCompareStrings(rp, data, nbytes, data2, nbytes2);  /* 32 */
+    lept_free(data);
+    lept_free(data2);
+    pixaDestroy(&pixa);
+    pixacompDestroy(&pixac);
+    l_pdfSetThreads(nthreads);
+
 #if 0
 {
     char     buffer[512];
@@ -378,3 +516,54 @@ PIX  *pix1, *pix2, *pixd;
     pixDestroy(&pix2);
     return pixd;
 }
+
+
+    /* Returns 1 if startxref gives the xref table, and the offset of
+     * each object N in the table is the start of "N 0 obj"; 0 otherwise. */
+static l_int32
+XrefIsValid(const l_uint8  *data,
+            size_t          nbytes)
+{
+char     buf[32];
+char    *str, *entry;
+l_int32  i, n, loc, xrefloc;
+L_DNA   *da;
+
+    if (!data || nbytes == 0)
+        return 0;
+    da = arrayFindEachSequence(data, nbytes, (const l_uint8 *)"startxref\n",
+                               strlen("startxref\n"));
+    n = l_dnaGetCount(da);
+    if (n == 0) {
+        l_dnaDestroy(&da);
+        return 0;
+    }
+    l_dnaGetIValue(da, n - 1, &loc);
+    l_dnaDestroy(&da);
+
+        /* Make a null-terminated copy, so the text can be scanned */
+    str = (char *)lept_calloc(nbytes + 1, 1);
+    memcpy(str, data, nbytes);
+    if (sscanf(str + loc + strlen("startxref\n"), "%d", &xrefloc) != 1 ||
+        xrefloc < 0 || xrefloc >= (l_int32)nbytes ||
+        sscanf(str + xrefloc, "xref\n0 %d\n", &n) != 1) {
+        lept_free(str);
+        return 0;
+    }
+    entry = strchr(str + xrefloc + 5, '\n') + 1;  /* object 0 entry */
+    for (i = 1; i < n; i++) {  /* each entry is 20 bytes */
+        if (sscanf(entry + 20 * i, "%d", &xrefloc) != 1 ||
+            xrefloc < 0 || xrefloc >= (l_int32)nbytes) {
+            lept_free(str);
+            return 0;
+        }
+        snprintf(buf, sizeof(buf), "%d 0 obj", i);
+        if (strncmp(str + xrefloc, buf, strlen(buf)) != 0) {
+            lept_stderr("xref entry for object %d is wrong\n", i);
+            lept_free(str);
+            return 0;
+        }
+    }
+    lept_free(str);
+    return 1;
+}
@@ -54,7 +54,7 @@ int main(int    argc,
          const char **argv)
 {
 l_uint8      *data1, *data2;
-l_int32       i;
+l_int32       i, j, k, n, same, equal;
 size_t        size1, size2;
 BOX          *box;
 PIX          *pix, *pix1, *pix2, *pix3;
@@ -213,6 +213,58 @@ L_REGPARAMS* rp;
     lept_free(data1);
     lept_free(data2);
 
+        /* Test reading with the data left in the file, which is mapped
+         * into memory, and with a cache of decompressed pix */
+    pixac1 = pixacompRead("/tmp/lept/comp/file1.pac");
+    pixac2 = pixacompReadMapped("/tmp/lept/comp/file1.pac", 3);
+    n = pixacompGetCount(pixac1);
+    regTestCompareValues(rp, n, pixacompGetCount(pixac2), 0);  /* 16 */
+    same = TRUE;
+    for (j = 0; j < 3; j++) {  /* the cache is smaller than n */
+        for (i = 0; i < n; i++) {
+            k = (j == 1) ? i / 2 : i;  /* get each pix twice in a row */
+            pix1 = pixacompGetPix(pixac1, k);
+            pix2 = pixacompGetPix(pixac2, k);
+            pixEqual(pix1, pix2, &equal);
+            if (!equal)
+                same = FALSE;
+            pixDestroy(&pix1);
+            pixDestroy(&pix2);
+        }
+    }
+    regTestCompareValues(rp, TRUE, same, 0);  /* 17 */
+    pixacompWrite("/tmp/lept/comp/file5.pac", pixac2);
+    filesAreIdentical("/tmp/lept/comp/file1.pac", "/tmp/lept/comp/file5.pac",
+                      &same);
+    regTestCompareValues(rp, TRUE, same, 0);  /* 18 */
+
+        /* The returned pix is a copy; changing it leaves the cache alone */
+    pix1 = pixacompGetPix(pixac2, 0);
+    pixInvert(pix1, pix1);
+    pix2 = pixacompGetPix(pixac2, 0);
+    pix3 = pixacompGetPix(pixac1, 0);
+    regTestComparePix(rp, pix2, pix3);  /* 19 */
+    pixDestroy(&pix2);
+    pixDestroy(&pix3);
+
+        /* Replacing a pixcomp removes it from the cache */
+    pixacompReplacePix(pixac2, 0, pix1, IFF_PNG);
+    pix2 = pixacompGetPix(pixac2, 0);
+    regTestComparePix(rp, pix1, pix2);  /* 20 */
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+
+        /* A copy of the pixcomp has its own data */
+    pixc = pixacompGetPixcomp(pixac2, 1, L_COPY);
+    pixacompDestroy(&pixac2);
+    pix1 = pixCreateFromPixcomp(pixc);
+    pix2 = pixacompGetPix(pixac1, 1);
+    regTestComparePix(rp, pix1, pix2);  /* 21 */
+    pixcompDestroy(&pixc);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    pixacompDestroy(&pixac1);
+
     return regTestCleanup(rp);
 }
 
@@ -29,6 +29,9 @@
  *
  *    Tests the fast (uncompressed) serialization of pix to a string
  *    in memory and the deserialization back to a pix.
+ *
+ *    Also tests reading spix from a file mapping, where the pix
+ *    data is in the mapping.
  */
 
 #include "demo_settings.h"
@@ -61,7 +64,7 @@ int main(int    argc,
 {
 char          buf[256];
 size_t        size;
-l_int32       i, w, h;
+l_int32       i, w, h, d, same;
 l_int32       format, bps, spp, iscmap, format2, w2, h2, bps2, spp2, iscmap2;
 l_uint8      *data;
 l_uint32     *data32, *data32r;
@@ -132,6 +135,40 @@ L_REGPARAMS* rp;
     }
 
 
+        /* Test reading from a file mapping */
+    for (i = 0; i < nfiles; i++) {
+        pixs = pixRead(regGetFileArgOrDefault(rp, filename[i]));
+        snprintf(buf, sizeof(buf), "/tmp/lept/regout/mapped.%d.spix", i);
+        pixWrite(buf, pixs, IFF_SPIX);
+        pixd = pixReadMapped(buf, 0);
+        regTestComparePix(rp, pixs, pixd);  /* 3 * nfiles + 2 * i */
+        regTestCompareValues(rp, 1, pixIsMapped(pixd), 0);  /* + 1 */
+        pixDestroy(&pixs);
+        pixDestroy(&pixd);
+    }
+
+        /* Writing to the mapped pix does not change the file, and
+         * extracting the data gives a copy that is not mapped */
+    pixs = pixRead(regGetFileArgOrDefault(rp, "karen8.jpg"));
+    pixWrite("/tmp/lept/regout/mapped.spix", pixs, IFF_SPIX);
+    pixd = pixReadSpixMapped("/tmp/lept/regout/mapped.spix");
+    pixSetAll(pixd);
+    pixt = pixRead("/tmp/lept/regout/mapped.spix");
+    regTestComparePix(rp, pixs, pixt);  /* 5 * nfiles */
+    pixDestroy(&pixd);
+    pixd = pixReadSpixMapped("/tmp/lept/regout/mapped.spix");
+    pixGetDimensions(pixd, &w, &h, &d);
+    data32 = pixExtractData(pixd);
+    regTestCompareValues(rp, 0, pixIsMapped(pixd), 0);  /* 5 * nfiles + 1 */
+    pixt2 = pixCreateHeader(w, h, d);
+    pixSetData(pixt2, data32);
+    pixEqual(pixs, pixt2, &same);
+    regTestCompareValues(rp, 1, same, 0);  /* 5 * nfiles + 2 */
+    pixDestroy(&pixs);
+    pixDestroy(&pixt);
+    pixDestroy(&pixt2);
+    pixDestroy(&pixd);
+
         /* Do timing */
     for (i = 0; i < nfiles; i++) {
 		const char* fname = regGetFileArgOrDefault(rp, filename[i]);
@@ -145,6 +182,15 @@ L_REGPARAMS* rp;
         pixDestroy(&pixd);
     }
 
+    for (i = 0; i < nfiles; i++) {
+        snprintf(buf, sizeof(buf), "/tmp/lept/regout/mapped.%d.spix", i);
+        startTimer();
+        pixd = pixReadMapped(buf, 0);
+        lept_stderr("Time for mapped %s: %7.3f sec\n", filename[i],
+                    stopTimer());
+        pixDestroy(&pixd);
+    }
+
 
     return regTestCleanup(rp);
 }
@@ -64,6 +64,7 @@
 
 static l_int32 test_file_png(const char *fname, const char *dirout);
 static l_int32 test_mem_png(const char *fname);
+static l_int32 test_presets_png(const char *fname);
 static l_int32 get_header_data(const char *filename);
 static l_int32 test_1bpp_trans(L_REGPARAMS *rp);
 static l_int32 test_1bpp_color(L_REGPARAMS *rp);
@@ -223,6 +224,23 @@ L_REGPARAMS  *rp;
     }
     if (!success) failure = TRUE;
 
+    /* ---------- Part 5: Test lossless r/w with write presets ---------- */
+    success = TRUE;
+    if (test_presets_png(FILE_1BPP)) success = FALSE;
+    if (test_presets_png(FILE_4BPP_C)) success = FALSE;
+    if (test_presets_png(FILE_8BPP)) success = FALSE;
+    if (test_presets_png(FILE_8BPP_C)) success = FALSE;
+    if (test_presets_png(FILE_16BPP)) success = FALSE;
+    if (test_presets_png(FILE_32BPP)) success = FALSE;
+    if (test_presets_png(FILE_32BPP_ALPHA)) success = FALSE;
+    if (test_presets_png(FILE_GRAY_ALPHA)) success = FALSE;
+    if (success) {
+        lept_stderr("\n  ******* Success on write presets *******\n\n");
+    } else {
+        lept_stderr("\n  ******* Failure on write presets *******\n\n");
+    }
+    if (!success) failure = TRUE;
+
     if (!failure) {
         lept_stderr("  ******* Success on all tests *******\n\n");
     } else {
@@ -300,6 +318,43 @@ PIX      *pixd = NULL;
     return (!same);
 }
 
+    /* Memory r/w test with each write preset.  Returns 1 on error */
+static l_int32
+test_presets_png(const char  *fname)
+{
+l_uint8  *data;
+l_int32   i, same, fail, prev;
+size_t    size;
+PIX      *pixs, *pixd;
+
+    if ((pixs = pixRead(fname)) == NULL) {
+        lept_stderr("Failure to read %s\n", fname);
+        return 1;
+    }
+    fail = FALSE;
+    prev = l_pngGetWritePreset();
+    for (i = L_PNG_WRITE_DEFAULT; i <= L_PNG_WRITE_SMALLEST; i++) {
+        l_pngSetWritePreset(i);
+        if (pixWriteMemPng(&data, &size, pixs, 0.0)) {
+            lept_stderr("Mem write fail for preset %d\n", i);
+            fail = TRUE;
+            continue;
+        }
+        pixd = pixReadMemPng(data, size);
+        pixEqual(pixs, pixd, &same);
+        if (!same) {
+            lept_stderr("Write/read fail for file %s with preset %d\n",
+                        fname, i);
+            fail = TRUE;
+        }
+        pixDestroy(&pixd);
+        lept_free(data);
+    }
+    l_pngSetWritePreset(prev);
+    pixDestroy(&pixs);
+    return fail;
+}
+
     /* Retrieve header data from file and from array in memory */
 static l_int32
 get_header_data(const char  *filename)
@@ -0,0 +1,128 @@
+/*====================================================================*
+ -  Copyright (C) 2001 Leptonica.  All rights reserved.
+ -
+ -  Redistribution and use in source and binary forms, with or without
+ -  modification, are permitted provided that the following conditions
+ -  are met:
+ -  1. Redistributions of source code must retain the above copyright
+ -     notice, this list of conditions and the following disclaimer.
+ -  2. Redistributions in binary form must reproduce the above
+ -     copyright notice, this list of conditions and the following
+ -     disclaimer in the documentation and/or other materials
+ -     provided with the distribution.
+ -
+ -  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ -  ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ -  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ -  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL ANY
+ -  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ -  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ -  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ -  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ -  OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ -  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ -  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *====================================================================*/
+
+/*
+ * pngpresets.c
+ *
+ *   Compares the png write presets for encoding time and file size.
+ *
+ *   Use:
+ *      pngpresets [file1 file2 ...]
+ *   Without arguments, a set of images of each depth in this directory
+ *   is used.
+ *
+ *   Each image is written to memory with each preset, and read back
+ *   to verify that it is unchanged.  The time is the average of
+ *   several writes.  The totals over all images are given at the end.
+ */
+
+#include "demo_settings.h"
+
+#include "monolithic_examples.h"
+
+
+static const l_int32  NReps = 3;
+static const l_int32  NFiles = 12;
+static const char    *Files[] = {"feyn.tif", "rabi.png", "weasel4.16c.png",
+                                 "dreyfus8.png", "test8.jpg", "karen8.jpg",
+                                 "lucasta.150.jpg", "test16.png",
+                                 "books_logo.png", "marge.jpg",
+                                 "test24.jpg", "wyom.jpg"};
+static const char    *PresetNames[] = {"default", "fastest", "balanced",
+                                       "smallest"};
+
+
+#if defined(BUILD_MONOLITHIC)
+#define main   lept_pngpresets_main
+#endif
+
+int main(int    argc,
+         const char **argv)
+{
+const char  *fname;
+l_uint8     *data;
+l_int32      i, j, k, nfiles, preset, severity, same, w, h, d;
+size_t       size;
+size_t       totsize[4];
+l_float32    time;
+l_float32    tottime[4];
+PIX         *pixs, *pix1;
+
+    setLeptDebugOK(1);
+    nfiles = (argc > 1) ? argc - 1 : NFiles;
+    l_pngSetReadStrip16To8(0);  /* to compare 16 bpp images */
+    severity = setMsgSeverity(L_SEVERITY_WARNING);
+    preset = l_pngGetWritePreset();
+    for (j = 0; j < 4; j++) {
+        totsize[j] = 0;
+        tottime[j] = 0.0;
+    }
+
+    lept_stderr("%-18s %-14s %-9s %10s %9s\n", "file", "w x h x d",
+                "preset", "bytes", "msec");
+    for (i = 0; i < nfiles; i++) {
+        fname = (argc > 1) ? argv[i + 1] : Files[i];
+        if ((pixs = pixRead(fname)) == NULL) {
+            L_ERROR("image %s not read\n", __func__, fname);
+            continue;
+        }
+        pixGetDimensions(pixs, &w, &h, &d);
+        for (j = 0; j < 4; j++) {
+            l_pngSetWritePreset(L_PNG_WRITE_DEFAULT + j);
+            startTimer();
+            for (k = 0; k < NReps; k++) {
+                pixWriteMemPng(&data, &size, pixs, 0.0);
+                if (k < NReps - 1) lept_free(data);
+            }
+            time = 1000.0 * stopTimer() / NReps;
+            pix1 = pixReadMemPng(data, size);
+            pixEqual(pixs, pix1, &same);
+            if (!same)
+                L_ERROR("%s changed with preset %s\n", __func__, fname,
+                        PresetNames[j]);
+            lept_stderr("%-18s %4dx%4dx%-4d %-9s %10zu %9.2f\n", fname,
+                        w, h, d, PresetNames[j], size, time);
+            totsize[j] += size;
+            tottime[j] += time;
+            lept_free(data);
+            pixDestroy(&pix1);
+        }
+        pixDestroy(&pixs);
+    }
+
+    lept_stderr("\nTotals:\n");
+    for (j = 0; j < 4; j++) {
+        lept_stderr("  %-9s %10zu bytes (%5.1f%%) %10.2f msec (%5.1f%%)\n",
+                    PresetNames[j], totsize[j],
+                    100.0 * totsize[j] / L_MAX(1, totsize[0]),
+                    tottime[j], 100.0 * tottime[j] / L_MAX(0.001, tottime[0]));
+    }
+
+    l_pngSetWritePreset(preset);
+    l_pngSetReadStrip16To8(1);
+    setMsgSeverity(severity);
+    return 0;
+}
@@ -29,6 +29,9 @@
  *
  *   Tests read and write of both ascii and packed pnm, using
  *   pix with 1, 2, 4, 8 and 32 bpp.
+ *
+ *   Also tests reading pnm from a file mapping, which must give
+ *   the same pix as pixRead().
  */
 
 #include "demo_settings.h"
@@ -36,6 +39,22 @@
 #include "monolithic_examples.h"
 
 
+static const l_int32  NMapped = 14;
+static const char    *Mapped[] = {"/tmp/lept/pnm/pix1.1.pnm",
+                                  "/tmp/lept/pnm/pix2.1.pnm",
+                                  "/tmp/lept/pnm/pix3.1.pnm",
+                                  "/tmp/lept/pnm/pix3.2.pnm",
+                                  "/tmp/lept/pnm/pix4.2.pnm",
+                                  "/tmp/lept/pnm/pix3.4.pnm",
+                                  "/tmp/lept/pnm/pix4.4.pnm",
+                                  "/tmp/lept/pnm/pix2.8.pnm",
+                                  "/tmp/lept/pnm/pix3.8.pnm",
+                                  "/tmp/lept/pnm/pix1.16.pnm",
+                                  "/tmp/lept/pnm/pix1.24.pnm",
+                                  "/tmp/lept/pnm/pix2.24.pnm",
+                                  "/tmp/lept/pnm/pix3.24.pnm",
+                                  "/tmp/lept/pnm/pix1.32.pnm"};
+
 
 #if defined(BUILD_MONOLITHIC)
 #define main   lept_pnmio_reg_main
@@ -45,6 +64,7 @@ int main(int  argc,
          const char   **argv)
 {
 l_uint8      *data;
+l_int32       i;
 size_t        size;
 FILE         *fp;
 PIX          *pix1, *pix2, *pix3, *pix4, *pix5;
@@ -183,5 +203,31 @@ L_REGPARAMS* rp;
     pixDestroy(&pix2);
     pixDestroy(&pix3);
 
+        /* Test reading from a file mapping, converting in parallel
+         * and with one thread.  Include 16 bpp (pgm). */
+    pix1 = pixRead(regGetFileArgOrDefault(rp, "weasel8.png"));
+    pix2 = pixConvert8To16(pix1, 8);
+    pixWrite("/tmp/lept/pnm/pix1.16.pnm", pix2, IFF_PNM);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    for (i = 0; i < NMapped; i++) {
+        pix1 = pixRead(Mapped[i]);
+        pix2 = pixReadMapped(Mapped[i], 0);
+        regTestComparePix(rp, pix1, pix2);  /* 12 + 2 * i */
+        pix3 = pixReadPnmMapped(Mapped[i], 1);
+        regTestComparePix(rp, pix1, pix3);  /* 13 + 2 * i */
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        pixDestroy(&pix3);
+    }
+
+        /* A truncated file is not read */
+    data = l_binaryRead("/tmp/lept/pnm/pix2.24.pnm", &size);
+    l_binaryWrite("/tmp/lept/pnm/trunc.pnm", "w", data, size - 100);
+    lept_free(data);
+    pix1 = pixReadPnmMapped("/tmp/lept/pnm/trunc.pnm", 0);
+    regTestCompareValues(rp, 1, pix1 == NULL, 0);  /* 40 */
+    pixDestroy(&pix1);
+
     return regTestCleanup(rp);
 }
@@ -0,0 +1,223 @@
+/*====================================================================*
+ -  Copyright (C) 2001 Leptonica.  All rights reserved.
+ -
+ -  Redistribution and use in source and binary forms, with or without
+ -  modification, are permitted provided that the following conditions
+ -  are met:
+ -  1. Redistributions of source code must retain the above copyright
+ -     notice, this list of conditions and the following disclaimer.
+ -  2. Redistributions in binary form must reproduce the above
+ -     copyright notice, this list of conditions and the following
+ -     disclaimer in the documentation and/or other materials
+ -     provided with the distribution.
+ -
+ -  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ -  ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ -  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ -  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL ANY
+ -  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ -  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ -  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ -  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ -  OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ -  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ -  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *====================================================================*/
+
+/*
+ *  rlpix_reg.c
+ *
+ *    Regression test for the run-length encoded 1 bpp image (RLPIX).
+ *    Each operation on the runs is compared with the pix operation:
+ *       (1) conversion to and from pix, and pixel counting
+ *       (2) union, intersection and subtraction, including an
+ *           rlpix of different size
+ *       (3) brick dilation, erosion, opening and closing, for
+ *           both boundary conditions
+ *       (4) connected component bounding boxes and counts
+ */
+
+#include "demo_settings.h"
+
+#include "monolithic_examples.h"
+
+
+static void TestBrick(L_REGPARAMS *rp, PIX *pixs, RLPIX *rls,
+                      l_int32 hsize, l_int32 vsize);
+static void TestConnComp(L_REGPARAMS *rp, PIX *pixs, l_int32 connectivity);
+
+    /* Brick sizes; both even and odd sizes are used, because the
+     * origin is not centered for even sizes */
+static const l_int32  NSizes = 9;
+static const l_int32  HSizes[] = {1, 2, 1, 5, 1, 4, 21, 1, 25};
+static const l_int32  VSizes[] = {1, 1, 2, 1, 7, 6, 1, 16, 25};
+
+
+#if defined(BUILD_MONOLITHIC)
+#define main   lept_rlpix_reg_main
+#endif
+
+int main(int    argc,
+         const char **argv)
+{
+l_int32       i, count1, count2;
+BOX          *box;
+PIX          *pixs, *pix1, *pix2, *pix3, *pix4;
+RLPIX        *rls, *rl1, *rl2, *rl3;
+L_REGPARAMS  *rp;
+
+    if (regTestSetup(argc, argv, "rlpix", NULL, &rp))
+        return 1;
+
+    pixs = pixRead(regGetFileArgOrDefault(rp, "feyn-fract.tif"));
+
+        /* Conversion and pixel counting */
+    rls = pixConvertToRLPix(pixs);
+    pix1 = rlpixConvertToPix(rls);
+    regTestComparePix(rp, pixs, pix1);  /* 0 */
+    pixCountPixels(pixs, &count1, NULL);
+    rlpixCountPixels(rls, &count2);
+    regTestCompareValues(rp, count1, count2, 0);  /* 1 */
+    pixDestroy(&pix1);
+
+        /* Set operations; rl2 is smaller than rls */
+    pix1 = pixTranslate(NULL, pixs, 7, 3, L_BRING_IN_WHITE);
+    box = boxCreate(0, 0, pixGetWidth(pixs) / 2 + 13,
+                    pixGetHeight(pixs) / 2 + 5);
+    pix2 = pixClipRectangle(pix1, box, NULL);
+    rl1 = pixConvertToRLPix(pix1);
+    rl2 = pixConvertToRLPix(pix2);
+    for (i = 0; i < 2; i++) {
+        pix3 = pixOr(NULL, pixs, (i == 0) ? pix1 : pix2);
+        rl3 = rlpixUnion(rls, (i == 0) ? rl1 : rl2);
+        pix4 = rlpixConvertToPix(rl3);
+        regTestComparePix(rp, pix3, pix4);  /* 2, 5 */
+        pixDestroy(&pix3);
+        pixDestroy(&pix4);
+        rlpixDestroy(&rl3);
+        pix3 = pixAnd(NULL, pixs, (i == 0) ? pix1 : pix2);
+        rl3 = rlpixIntersection(rls, (i == 0) ? rl1 : rl2);
+        pix4 = rlpixConvertToPix(rl3);
+        regTestComparePix(rp, pix3, pix4);  /* 3, 6 */
+        pixDestroy(&pix3);
+        pixDestroy(&pix4);
+        rlpixDestroy(&rl3);
+        pix3 = pixSubtract(NULL, pixs, (i == 0) ? pix1 : pix2);
+        rl3 = rlpixSubtract(rls, (i == 0) ? rl1 : rl2);
+        pix4 = rlpixConvertToPix(rl3);
+        regTestComparePix(rp, pix3, pix4);  /* 4, 7 */
+        pixDestroy(&pix3);
+        pixDestroy(&pix4);
+        rlpixDestroy(&rl3);
+    }
+    boxDestroy(&box);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    rlpixDestroy(&rl1);
+    rlpixDestroy(&rl2);
+
+        /* Brick morphology, for both boundary conditions */
+    resetMorphBoundaryCondition(ASYMMETRIC_MORPH_BC);
+    for (i = 0; i < NSizes; i++)  /* 8 - 43 */
+        TestBrick(rp, pixs, rls, HSizes[i], VSizes[i]);
+    resetMorphBoundaryCondition(SYMMETRIC_MORPH_BC);
+    for (i = 0; i < NSizes; i++)  /* 44 - 79 */
+        TestBrick(rp, pixs, rls, HSizes[i], VSizes[i]);
+    resetMorphBoundaryCondition(ASYMMETRIC_MORPH_BC);
+
+        /* Connected components */
+    TestConnComp(rp, pixs, 4);  /* 80 - 81 */
+    TestConnComp(rp, pixs, 8);  /* 82 - 83 */
+    pix1 = pixMorphSequence(pixs, "c25.1 + o1.3", 0);
+    TestConnComp(rp, pix1, 4);  /* 84 - 85 */
+    TestConnComp(rp, pix1, 8);  /* 86 - 87 */
+    pixDestroy(&pix1);
+
+        /* Word boxes, on the runs and on the pix */
+    startTimer();
+    for (i = 0; i < 10; i++) {
+        rl1 = rlpixCloseBrick(rls, 11, 5);
+        rlpixCountConnComp(rl1, 8, &count1);
+        rlpixDestroy(&rl1);
+    }
+    lept_stderr("Time for rlpix words:  %7.3f sec\n", stopTimer());
+    startTimer();
+    for (i = 0; i < 10; i++) {
+        pix1 = pixCloseBrick(NULL, pixs, 11, 5);
+        pixCountConnComp(pix1, 8, &count2);
+        pixDestroy(&pix1);
+    }
+    lept_stderr("Time for pix words:    %7.3f sec\n", stopTimer());
+    regTestCompareValues(rp, count1, count2, 0);  /* 88 */
+
+    rlpixDestroy(&rls);
+    pixDestroy(&pixs);
+    return regTestCleanup(rp);
+}
+
+
+static void
+TestBrick(L_REGPARAMS  *rp,
+          PIX          *pixs,
+          RLPIX        *rls,
+          l_int32       hsize,
+          l_int32       vsize)
+{
+PIX    *pix1, *pix2;
+RLPIX  *rl1;
+
+    pix1 = pixDilateBrick(NULL, pixs, hsize, vsize);
+    rl1 = rlpixDilateBrick(rls, hsize, vsize);
+    pix2 = rlpixConvertToPix(rl1);
+    regTestComparePix(rp, pix1, pix2);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    rlpixDestroy(&rl1);
+
+    pix1 = pixErodeBrick(NULL, pixs, hsize, vsize);
+    rl1 = rlpixErodeBrick(rls, hsize, vsize);
+    pix2 = rlpixConvertToPix(rl1);
+    regTestComparePix(rp, pix1, pix2);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    rlpixDestroy(&rl1);
+
+    pix1 = pixOpenBrick(NULL, pixs, hsize, vsize);
+    rl1 = rlpixOpenBrick(rls, hsize, vsize);
+    pix2 = rlpixConvertToPix(rl1);
+    regTestComparePix(rp, pix1, pix2);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    rlpixDestroy(&rl1);
+
+    pix1 = pixCloseBrick(NULL, pixs, hsize, vsize);
+    rl1 = rlpixCloseBrick(rls, hsize, vsize);
+    pix2 = rlpixConvertToPix(rl1);
+    regTestComparePix(rp, pix1, pix2);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    rlpixDestroy(&rl1);
+}
+
+
+static void
+TestConnComp(L_REGPARAMS  *rp,
+             PIX          *pixs,
+             l_int32       connectivity)
+{
+l_int32  same, count1, count2;
+BOXA    *boxa1, *boxa2;
+RLPIX   *rl;
+
+    rl = pixConvertToRLPix(pixs);
+    boxa1 = pixConnCompBB(pixs, connectivity);
+    boxa2 = rlpixConnCompBB(rl, connectivity);
+    boxaEqual(boxa1, boxa2, 0, NULL, &same);
+    regTestCompareValues(rp, 1, same, 0);
+    pixCountConnComp(pixs, connectivity, &count1);
+    rlpixCountConnComp(rl, connectivity, &count2);
+    regTestCompareValues(rp, count1, count2, 0);
+    boxaDestroy(&boxa1);
+    boxaDestroy(&boxa2);
+    rlpixDestroy(&rl);
+}
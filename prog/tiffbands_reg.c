@@ -0,0 +1,293 @@
+/*====================================================================*
+ -  Copyright (C) 2001 Leptonica.  All rights reserved.
+ -
+ -  Redistribution and use in source and binary forms, with or without
+ -  modification, are permitted provided that the following conditions
+ -  are met:
+ -  1. Redistributions of source code must retain the above copyright
+ -     notice, this list of conditions and the following disclaimer.
+ -  2. Redistributions in binary form must reproduce the above
+ -     copyright notice, this list of conditions and the following
+ -     disclaimer in the documentation and/or other materials
+ -     provided with the distribution.
+ -
+ -  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ -  ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ -  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ -  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL ANY
+ -  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ -  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ -  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ -  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ -  OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ -  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ -  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *====================================================================*/
+
+/*
+ *  tiffbands_reg.c
+ *
+ *    Regression test for reading and writing tiff by bands.
+ *       (1) Each file is read by bands, and the bands are assembled
+ *           and compared with the image from pixReadTiff().
+ *       (2) Images of each depth are written by bands of arbitrary
+ *           height, and read back both ways.
+ *       (3) A band filter is run with tiffProcessBands(), and
+ *           compared with the filter applied to the full image.
+ *       (4) Tiled gray, rgb and rgba files are read by tiles, and
+ *           compared with the same images written in strips.
+ */
+
+#include "demo_settings.h"
+
+#include "monolithic_examples.h"
+
+
+static PIX *ReadByBands(const char *filename);
+static l_int32 WriteByBands(const char *filename, PIX *pixs,
+                            l_int32 bandh, l_int32 comptype);
+static PIX *ThresholdBand(PIX *pixs, l_int32 y, void *userdata);
+static PIX *CopyBand(PIX *pixs, l_int32 y, void *userdata);
+
+static const l_int32  NFiles = 7;
+static const char    *Files[] = {"feyn-fract.tif", "test16.tif",
+                                 "miniswhite.tif", "minisblack.tif",
+                                 "rgb16.tif", "gray-alpha.tif",
+                                 "jpeg-coded.tif"};
+
+    /* 32 x 32 tiles; the images are 82 x 73 */
+static const l_int32  NTiled = 3;
+static const char    *TiledFiles[] = {"weasel8-tiled.tif",
+                                      "weasel32-tiled.tif",
+                                      "weasel32a-tiled.tif"};
+
+
+#if defined(BUILD_MONOLITHIC)
+#define main   lept_tiffbands_reg_main
+#endif
+
+int main(int    argc,
+         const char **argv)
+{
+char            buf[256];
+l_int32         i, w, h, d, nbands, ret, thresh;
+PIX            *pix1, *pix2, *pix3, *pix4;
+PIXA           *pixa;
+L_TIFF_READER  *reader;
+L_TIFF_WRITER  *writer;
+L_REGPARAMS    *rp;
+
+#if !defined(HAVE_LIBTIFF)
+    L_ERROR("This test requires libtiff to run.\n", "tiffbands_reg");
+    exit(77);
+#endif
+
+    if (regTestSetup(argc, argv, "tiffbands", NULL, &rp))
+        return 1;
+
+    lept_mkdir("lept/tiffbands");
+
+        /* Read by bands */
+    for (i = 0; i < NFiles; i++) {  /* 0 - 6 */
+        pix1 = pixReadTiff(Files[i], 0);
+        pix2 = ReadByBands(Files[i]);
+        regTestComparePix(rp, pix1, pix2);
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+    }
+
+        /* Write by bands, with a band height that does not match
+         * the strips, for each depth and with a colormap */
+    pix1 = pixRead("test24.jpg");
+    pixa = pixaCreate(0);
+    pixaAddPix(pixa, pixRead("feyn-fract.tif"), L_INSERT);
+    pixaAddPix(pixa, pixConvertRGBToLuminance(pix1), L_INSERT);
+    pixaAddPix(pixa, pixClone(pix1), L_INSERT);
+    pix2 = pixConvertRGBToLuminance(pix1);
+    pix3 = pixCopy(NULL, pix1);
+    pixSetRGBComponent(pix3, pix2, L_ALPHA_CHANNEL);
+    pixSetSpp(pix3, 4);
+    pixaAddPix(pixa, pix3, L_INSERT);
+    pixaAddPix(pixa, pixConvert8To16(pix2, 8), L_INSERT);
+    pixaAddPix(pixa, pixOctreeColorQuant(pix1, 128, 0), L_INSERT);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    for (i = 0; i < pixaGetCount(pixa); i++) {  /* 7 - 18 */
+        pix1 = pixaGetPix(pixa, i, L_CLONE);
+        snprintf(buf, sizeof(buf), "/tmp/lept/tiffbands/write%d.tif", i);
+        WriteByBands(buf, pix1, 37,
+                     (pixGetDepth(pix1) == 1) ? IFF_TIFF_G4 : IFF_TIFF_ZIP);
+        pix2 = pixReadTiff(buf, 0);
+        regTestComparePix(rp, pix1, pix2);
+        pix3 = ReadByBands(buf);
+        regTestComparePix(rp, pix1, pix3);
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        pixDestroy(&pix3);
+    }
+    pixaDestroy(&pixa);
+
+        /* The writer requires all rows */
+    pix1 = pixRead("feyn-fract.tif");
+    pixGetDimensions(pix1, &w, &h, NULL);
+    writer = tiffWriterOpen("/tmp/lept/tiffbands/short.tif", h + 1,
+                            IFF_TIFF_G4);
+    tiffWriterWriteBand(writer, pix1);
+    ret = tiffWriterClose(&writer);
+    regTestCompareValues(rp, 1, ret, 0);  /* 19 */
+    pixDestroy(&pix1);
+
+        /* Band filter, changing the depth */
+    thresh = 140;
+    pix1 = pixReadTiff("jpeg-coded.tif", 0);
+    ret = tiffProcessBands("jpeg-coded.tif", 0,
+                           "/tmp/lept/tiffbands/thresh.tif", IFF_TIFF_G4,
+                           ThresholdBand, &thresh);
+    regTestCompareValues(rp, 0, ret, 0);  /* 20 */
+    pix2 = pixThresholdToBinary(pix1, thresh);
+    pix3 = pixReadTiff("/tmp/lept/tiffbands/thresh.tif", 0);
+    regTestComparePix(rp, pix2, pix3);  /* 21 */
+    pix4 = ReadByBands("/tmp/lept/tiffbands/thresh.tif");
+    regTestComparePix(rp, pix2, pix4);  /* 22 */
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    pixDestroy(&pix3);
+    pixDestroy(&pix4);
+
+        /* A large image is read and written in bounded memory */
+    pix1 = pixRead("feyn.tif");
+    pix2 = pixExpandBinaryReplicate(pix1, 2, 2);
+    pixWriteTiff("/tmp/lept/tiffbands/big.tif", pix2, IFF_TIFF_G4, "w");
+    startTimer();
+    ret = tiffProcessBands("/tmp/lept/tiffbands/big.tif", 0,
+                           "/tmp/lept/tiffbands/big2.tif", IFF_TIFF_G4,
+                           ThresholdBand, NULL);
+    lept_stderr("Time to copy %d x %d image by bands: %7.3f sec\n",
+                pixGetWidth(pix2), pixGetHeight(pix2), stopTimer());
+    pix3 = pixReadTiff("/tmp/lept/tiffbands/big2.tif", 0);
+    regTestComparePix(rp, pix2, pix3);  /* 23 */
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    pixDestroy(&pix3);
+    reader = tiffReaderOpen("/tmp/lept/tiffbands/big.tif", 0);
+    tiffReaderGetInfo(reader, NULL, NULL, &d, NULL, &nbands);
+    regTestCompareValues(rp, 1, d == 1 && nbands > 1, 0);  /* 24 */
+    tiffReaderClose(&reader);
+
+        /* Tiled files, read by bands of tiles with TIFFReadTile() for
+         * gray and rgb and with TIFFReadRGBATile() for rgba.  pixReadTiff()
+         * does not read tiled files, so the reference for each is the
+         * same image written in strips. */
+    pix1 = pixRead("weasel8.png");
+    pix2 = pixRead("weasel32.png");
+    pixa = pixaCreate(0);
+    pixaAddPix(pixa, pixClone(pix1), L_INSERT);
+    pixaAddPix(pixa, pixClone(pix2), L_INSERT);
+    pix3 = pixCopy(NULL, pix2);
+    pixSetRGBComponent(pix3, pix1, L_ALPHA_CHANNEL);
+    pixSetSpp(pix3, 4);
+    pixaAddPix(pixa, pix3, L_INSERT);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    for (i = 0; i < NTiled; i++) {  /* 25 - 33 */
+        pix1 = pixaGetPix(pixa, i, L_CLONE);
+        snprintf(buf, sizeof(buf), "/tmp/lept/tiffbands/strips%d.tif", i);
+        pixWriteTiff(buf, pix1, IFF_TIFF_ZIP, "w");
+        pixDestroy(&pix1);
+        pix1 = pixRead(buf);
+        reader = tiffReaderOpen(TiledFiles[i], 0);
+        tiffReaderGetInfo(reader, NULL, NULL, NULL, NULL, &nbands);
+        regTestCompareValues(rp, 3, nbands, 0);
+        tiffReaderClose(&reader);
+        pix2 = ReadByBands(TiledFiles[i]);
+        regTestComparePix(rp, pix1, pix2);
+        snprintf(buf, sizeof(buf), "/tmp/lept/tiffbands/copy%d.tif", i);
+        tiffProcessBands(TiledFiles[i], 0, buf, IFF_TIFF_ZIP, CopyBand, NULL);
+        pix3 = pixRead(buf);
+        regTestComparePix(rp, pix1, pix3);
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        pixDestroy(&pix3);
+    }
+    pixaDestroy(&pixa);
+
+    return regTestCleanup(rp);
+}
+
+
+    /* Reads a tiff file by bands and assembles the bands */
+static PIX *
+ReadByBands(const char  *filename)
+{
+l_int32         w, y, nbands, i;
+PIX            *pixd, *pix1;
+L_TIFF_READER  *reader;
+
+    if ((reader = tiffReaderOpen(filename, 0)) == NULL)
+        return NULL;
+    tiffReaderGetInfo(reader, &w, NULL, NULL, NULL, &nbands);
+    pixd = NULL;
+    for (i = 0; i < nbands; i++) {
+        pix1 = tiffReaderReadBand(reader, &y);
+        if (i == 0) {
+            pixd = pixCreate(w, pixGetHeight(pix1) * nbands,
+                             pixGetDepth(pix1));
+            pixCopySpp(pixd, pix1);
+            pixCopyColormap(pixd, pix1);
+            pixCopyResolution(pixd, pix1);
+        }
+        pixRasterop(pixd, 0, y, w, pixGetHeight(pix1), PIX_SRC, pix1, 0, 0);
+        if (i == nbands - 1)
+            pixSetHeight(pixd, y + pixGetHeight(pix1));
+        pixDestroy(&pix1);
+    }
+    tiffReaderClose(&reader);
+    return pixd;
+}
+
+
+    /* Writes a pix as a sequence of bands of height %bandh */
+static l_int32
+WriteByBands(const char  *filename,
+             PIX         *pixs,
+             l_int32      bandh,
+             l_int32      comptype)
+{
+l_int32         w, h, y;
+BOX            *box;
+PIX            *pix1;
+L_TIFF_WRITER  *writer;
+
+    pixGetDimensions(pixs, &w, &h, NULL);
+    writer = tiffWriterOpen(filename, h, comptype);
+    for (y = 0; y < h; y += bandh) {
+        box = boxCreate(0, y, w, L_MIN(bandh, h - y));
+        pix1 = pixClipRectangle(pixs, box, NULL);
+        tiffWriterWriteBand(writer, pix1);
+        boxDestroy(&box);
+        pixDestroy(&pix1);
+    }
+    return tiffWriterClose(&writer);
+}
+
+
+    /* Thresholds an 8 bpp band; copies a 1 bpp band */
+static PIX *
+ThresholdBand(PIX      *pixs,
+              l_int32   y,
+              void     *userdata)
+{
+    if (pixGetDepth(pixs) == 1)
+        return pixCopy(NULL, pixs);
+    return pixThresholdToBinary(pixs, *(l_int32 *)userdata);
+}
+
+
+    /* Copies a band */
+static PIX *
+CopyBand(PIX      *pixs,
+         l_int32   y,
+         void     *userdata)
+{
+    return pixCopy(NULL, pixs);
+}
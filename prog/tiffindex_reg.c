@@ -0,0 +1,197 @@
+/*====================================================================*
+ -  Copyright (C) 2001 Leptonica.  All rights reserved.
+ -
+ -  Redistribution and use in source and binary forms, with or without
+ -  modification, are permitted provided that the following conditions
+ -  are met:
+ -  1. Redistributions of source code must retain the above copyright
+ -     notice, this list of conditions and the following disclaimer.
+ -  2. Redistributions in binary form must reproduce the above
+ -     copyright notice, this list of conditions and the following
+ -     disclaimer in the documentation and/or other materials
+ -     provided with the distribution.
+ -
+ -  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ -  ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ -  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ -  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL ANY
+ -  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ -  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ -  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ -  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ -  OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ -  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ -  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *====================================================================*/
+
+
+/*
+ *  tiffindex_reg.c
+ *
+ *    Regression test for random access to multipage tiff with a
+ *    page index.
+ *       (1) Pages read in random order with the index are compared
+ *           with pages read by pixReadTiff(), from file and memory.
+ *       (2) The index is serialized and read back.
+ *       (3) An index that does not match the file is rejected.
+ */
+
+#include "demo_settings.h"
+
+#include "monolithic_examples.h"
+
+
+static const l_int32  NPages = 200;
+
+
+#if defined(BUILD_MONOLITHIC)
+#define main   lept_tiffindex_reg_main
+#endif
+
+int main(int    argc,
+         const char **argv)
+{
+l_uint8       *data;
+l_int32        i, j, n, w, h, format, xres, same, equal;
+size_t         size;
+NUMA          *na;
+PIX           *pix1, *pix2, *pix3, *pix4;
+PIXA          *pixa;
+L_TIFF_INDEX  *tidx1, *tidx2;
+L_REGPARAMS   *rp;
+
+#if !defined(HAVE_LIBTIFF)
+    L_ERROR("This test requires libtiff to run.\n", "tiffindex_reg");
+    exit(77);
+#endif
+
+    if (regTestSetup(argc, argv, "tiffindex", NULL, &rp))
+        return 1;
+
+    lept_mkdir("lept/tiffindex");
+
+        /* Make a multipage file with pages of different depths,
+         * sizes, compression and resolution */
+    pixa = pixaCreate(NPages);
+    pix1 = pixRead("test24.jpg");
+    pix2 = pixRead("feyn-fract.tif");
+    pix3 = pixScale(pix1, 0.25, 0.25);
+    pix4 = pixOctreeColorQuant(pix3, 128, 0);
+    pixDestroy(&pix3);
+    for (i = 0; i < NPages; i++) {
+        switch (i % 4) {
+        case 0:
+            pix3 = pixScale(pix2, 0.3 - 0.001 * i, 0.3 - 0.001 * i);
+            break;
+        case 1:
+            pix3 = pixScaleToGray8(pix2);
+            break;
+        case 2:
+            pix3 = pixScale(pix1, 0.3 - 0.001 * i, 0.3);
+            break;
+        default:
+            pix3 = pixCopy(NULL, pix4);
+            break;
+        }
+        pixSetResolution(pix3, 100 + i, 100 + i);
+        pixaAddPix(pixa, pix3, L_INSERT);
+    }
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    pixDestroy(&pix4);
+    pixaWriteMultipageTiff("/tmp/lept/tiffindex/multi.tif", pixa);
+    pixaDestroy(&pixa);
+
+        /* Build the index */
+    tidx1 = tiffIndexCreate("/tmp/lept/tiffindex/multi.tif");
+    n = tiffIndexGetCount(tidx1);
+    regTestCompareValues(rp, NPages, n, 0);  /* 0 */
+
+        /* Read pages in random order, and check the page info */
+    same = TRUE;
+    na = numaPseudorandomSequence(NPages, 13);  /* arbitrary seed */
+    for (i = 0; i < NPages; i++) {
+        numaGetIValue(na, i, &j);
+        pix1 = pixReadTiff("/tmp/lept/tiffindex/multi.tif", j);
+        pix2 = pixReadTiffIndexed("/tmp/lept/tiffindex/multi.tif", tidx1, j);
+        tiffIndexGetPageInfo(tidx1, j, NULL, &w, &h, NULL, NULL, &format,
+                             &xres, NULL);
+        pixEqual(pix1, pix2, &equal);
+        if (!equal || w != pixGetWidth(pix1) || h != pixGetHeight(pix1) ||
+            xres != pixGetXRes(pix1) || format != pixGetInputFormat(pix1) ||
+            format != pixGetInputFormat(pix2)) {
+            lept_stderr("page %d differs\n", j);
+            same = FALSE;
+        }
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+    }
+    numaDestroy(&na);
+    regTestCompareValues(rp, TRUE, same, 0);  /* 1 */
+
+        /* Serialize and read back */
+    tiffIndexWrite("/tmp/lept/tiffindex/multi.tif.idx", tidx1);
+    tidx2 = tiffIndexRead("/tmp/lept/tiffindex/multi.tif.idx");
+    tiffIndexWrite("/tmp/lept/tiffindex/multi2.tif.idx", tidx2);
+    filesAreIdentical("/tmp/lept/tiffindex/multi.tif.idx",
+                      "/tmp/lept/tiffindex/multi2.tif.idx", &same);
+    regTestCompareValues(rp, TRUE, same, 0);  /* 2 */
+    pix1 = pixReadTiff("/tmp/lept/tiffindex/multi.tif", NPages - 1);
+    pix2 = pixReadTiffIndexed("/tmp/lept/tiffindex/multi.tif", tidx2,
+                              NPages - 1);
+    regTestComparePix(rp, pix1, pix2);  /* 3 */
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    tiffIndexDestroy(&tidx2);
+
+        /* Read from memory, with indices made from the file and the data */
+    data = l_binaryRead("/tmp/lept/tiffindex/multi.tif", &size);
+    tidx2 = tiffIndexCreateMem(data, size);
+    regTestCompareValues(rp, NPages, tiffIndexGetCount(tidx2), 0);  /* 4 */
+    same = TRUE;
+    for (i = 0; i < NPages; i += 7) {
+        pix1 = pixReadMemTiff(data, size, i);
+        pix2 = pixReadMemTiffIndexed(data, size, tidx1, i);
+        pix3 = pixReadMemTiffIndexed(data, size, tidx2, i);
+        tiffIndexGetPageInfo(tidx1, i, NULL, NULL, NULL, NULL, NULL, &format,
+                             NULL, NULL);
+        pixEqual(pix1, pix2, &equal);
+        if (!equal) same = FALSE;
+        pixEqual(pix1, pix3, &equal);
+        if (!equal) same = FALSE;
+        if (format != pixGetInputFormat(pix2) ||
+            format != pixGetInputFormat(pix3)) same = FALSE;
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        pixDestroy(&pix3);
+    }
+    regTestCompareValues(rp, TRUE, same, 0);  /* 5 */
+    tiffIndexDestroy(&tidx2);
+
+        /* Time reading the last page, with and without the index */
+    startTimer();
+    for (i = 0; i < 10; i++) {
+        pix1 = pixReadMemTiff(data, size, NPages - 1);
+        pixDestroy(&pix1);
+    }
+    lept_stderr("Time for last page without index: %7.4f sec\n",
+                stopTimer() / 10.);
+    startTimer();
+    for (i = 0; i < 10; i++) {
+        pix1 = pixReadMemTiffIndexed(data, size, tidx1, NPages - 1);
+        pixDestroy(&pix1);
+    }
+    lept_stderr("Time for last page with index:    %7.4f sec\n",
+                stopTimer() / 10.);
+    lept_free(data);
+
+        /* An index is rejected when the file has changed */
+    pix1 = pixRead("feyn-fract.tif");
+    pixWriteTiff("/tmp/lept/tiffindex/multi.tif", pix1, IFF_TIFF_G4, "a");
+    pix2 = pixReadTiffIndexed("/tmp/lept/tiffindex/multi.tif", tidx1, 0);
+    regTestCompareValues(rp, TRUE, pix2 == NULL, 0);  /* 6 */
+    pixDestroy(&pix1);
+    tiffIndexDestroy(&tidx1);
+
+    return regTestCleanup(rp);
+}
@@ -168,6 +168,8 @@ LEPT_DLL extern PIX * pixOtsuThreshOnBackgroundNorm ( PIX *pixs, PIX *pixim, l_i
 LEPT_DLL extern PIX * pixMaskedThreshOnBackgroundNorm ( PIX *pixs, PIX *pixim, l_int32 sx, l_int32 sy, l_int32 thresh, l_int32 mincount, l_int32 smoothx, l_int32 smoothy, l_float32 scorefract, l_int32 *pthresh );
 LEPT_DLL extern l_ok pixSauvolaBinarizeTiled ( PIX *pixs, l_int32 whsize, l_float32 factor, l_int32 nx, l_int32 ny, PIX **ppixth, PIX **ppixd );
 LEPT_DLL extern l_ok pixSauvolaBinarize ( PIX *pixs, l_int32 whsize, l_float32 factor, l_int32 addborder, PIX **ppixm, PIX **ppixsd, PIX **ppixth, PIX **ppixd );
+LEPT_DLL extern l_ok pixSauvolaBinarizeIntegral ( PIX *pixs, L_INTEGRAL *ii, l_int32 whsize, l_float32 factor, PIX **ppixm, PIX **ppixsd, PIX **ppixth, PIX **ppixd );
+LEPT_DLL extern l_ok pixSauvolaBinarizeStream ( PIX *pixs, l_int32 whsize, l_float32 factor, l_int32 nbands, PIX **ppixth, PIX **ppixd );
 LEPT_DLL extern PIX * pixSauvolaOnContrastNorm ( PIX *pixs, l_int32 mindiff, PIX **ppixn, PIX **ppixth );
 LEPT_DLL extern PIX * pixThreshOnDoubleNorm ( PIX *pixs, l_int32 mindiff );
 LEPT_DLL extern l_ok pixThresholdByConnComp ( PIX *pixs, PIX *pixm, l_int32 start, l_int32 end, l_int32 incr, l_float32 thresh48, l_float32 threshdiff, l_int32 *pglobthresh, PIX **ppixd );
@@ -204,6 +206,7 @@ LEPT_DLL extern PIXA * pixaGetFont ( const char *dir, l_int32 fontsize, l_int32
 LEPT_DLL extern l_ok pixaSaveFont ( const char *indir, const char *outdir, l_int32 fontsize );
 LEPT_DLL extern PIX * pixReadStreamBmp ( FILE *fp );
 LEPT_DLL extern PIX * pixReadMemBmp ( const l_uint8 *cdata, size_t size );
+LEPT_DLL extern PIX * pixReadBmpMapped ( const char *filename, l_int32 nthreads );
 LEPT_DLL extern l_ok pixWriteStreamBmp ( FILE *fp, PIX *pix );
 LEPT_DLL extern l_ok pixWriteMemBmp ( l_uint8 **pdata, size_t *psize, PIX *pixs );
 LEPT_DLL extern PIXA * l_bootnum_gen1 ( void );
@@ -660,7 +663,11 @@ LEPT_DLL extern PIX * pixConvolveRGBSep ( PIX *pixs, L_KERNEL *kelx, L_KERNEL *k
 LEPT_DLL extern FPIX * fpixConvolve ( FPIX *fpixs, L_KERNEL *kel, l_int32 normflag );
 LEPT_DLL extern FPIX * fpixConvolveSep ( FPIX *fpixs, L_KERNEL *kelx, L_KERNEL *kely, l_int32 normflag );
 LEPT_DLL extern PIX * pixConvolveWithBias ( PIX *pixs, L_KERNEL *kel1, L_KERNEL *kel2, l_int32 force8, l_int32 *pbias );
+LEPT_DLL extern PIX * pixGaussianBlur ( PIX *pixs, l_float32 sigmax, l_float32 sigmay );
+LEPT_DLL extern FPIX * fpixGaussianBlur ( FPIX *fpixs, l_float32 sigmax, l_float32 sigmay );
 LEPT_DLL extern void l_setConvolveSampling ( l_int32 xfact, l_int32 yfact );
+LEPT_DLL extern void l_setConvolveFFTThreshold ( l_int32 size );
+LEPT_DLL extern void l_setConvolveFixedPoint ( l_int32 flag );
 LEPT_DLL extern PIX * pixAddGaussianNoise ( PIX *pixs, l_float32 stdev );
 LEPT_DLL extern l_float32 gaussDistribSampling ( void );
 LEPT_DLL extern l_ok pixCorrelationScore ( PIX *pix1, PIX *pix2, l_int32 area1, l_int32 area2, l_float32 delx, l_float32 dely, l_int32 maxdiffw, l_int32 maxdiffh, l_int32 *tab, l_float32 *pscore );
@@ -828,6 +835,9 @@ LEPT_DLL extern PIX * pixDarkenGray ( PIX *pixd, PIX *pixs, l_int32 thresh, l_in
 LEPT_DLL extern PIX * pixMultConstantColor ( PIX *pixs, l_float32 rfact, l_float32 gfact, l_float32 bfact );
 LEPT_DLL extern PIX * pixMultMatrixColor ( PIX *pixs, L_KERNEL *kel );
 LEPT_DLL extern PIX * pixHalfEdgeByBandpass ( PIX *pixs, l_int32 sm1h, l_int32 sm1v, l_int32 sm2h, l_int32 sm2v );
+LEPT_DLL extern PIX * pixConvolveFFT ( PIX *pixs, L_KERNEL *kel, l_int32 outdepth, l_int32 normflag );
+LEPT_DLL extern FPIX * fpixConvolveFFT ( FPIX *fpixs, L_KERNEL *kel, l_int32 normflag );
+LEPT_DLL extern FPIX * fpixCorrelateFFT ( FPIX *fpixs, L_KERNEL *kel, l_int32 normflag );
 LEPT_DLL extern l_ok fhmtautogen ( SELA *sela, l_int32 fileindex, const char *filename );
 LEPT_DLL extern l_ok fhmtautogen1 ( SELA *sela, l_int32 fileindex, const char *filename );
 LEPT_DLL extern l_ok fhmtautogen2 ( SELA *sela, l_int32 fileindex, const char *filename );
@@ -1021,6 +1031,11 @@ LEPT_DLL extern PIX * pixErodeGray ( PIX *pixs, l_int32 hsize, l_int32 vsize );
 LEPT_DLL extern PIX * pixDilateGray ( PIX *pixs, l_int32 hsize, l_int32 vsize );
 LEPT_DLL extern PIX * pixOpenGray ( PIX *pixs, l_int32 hsize, l_int32 vsize );
 LEPT_DLL extern PIX * pixCloseGray ( PIX *pixs, l_int32 hsize, l_int32 vsize );
+LEPT_DLL extern l_ok pixGrayMorphLinearFramed ( PIX *pixd, PIX *pixs, l_int32 frame, l_int32 type, l_int32 size, l_int32 direction );
+LEPT_DLL extern PIX * pixErodeGraySel ( PIX *pixs, SEL *sel );
+LEPT_DLL extern PIX * pixDilateGraySel ( PIX *pixs, SEL *sel );
+LEPT_DLL extern PIX * pixOpenGraySel ( PIX *pixs, SEL *sel );
+LEPT_DLL extern PIX * pixCloseGraySel ( PIX *pixs, SEL *sel );
 LEPT_DLL extern PIX * pixErodeGray3 ( PIX *pixs, l_int32 hsize, l_int32 vsize );
 LEPT_DLL extern PIX * pixDilateGray3 ( PIX *pixs, l_int32 hsize, l_int32 vsize );
 LEPT_DLL extern PIX * pixOpenGray3 ( PIX *pixs, l_int32 hsize, l_int32 vsize );
@@ -1060,6 +1075,15 @@ LEPT_DLL extern void * lheapGetElement ( L_HEAP *lh, l_int32 index );
 LEPT_DLL extern l_ok lheapSort ( L_HEAP *lh );
 LEPT_DLL extern l_ok lheapSortStrictOrder ( L_HEAP *lh );
 LEPT_DLL extern l_ok lheapPrint ( FILE *fp, L_HEAP *lh );
+LEPT_DLL extern L_INTEGRAL * integralCreate ( PIX *pixs, l_int32 sqflag );
+LEPT_DLL extern void integralDestroy ( L_INTEGRAL **pii );
+LEPT_DLL extern l_ok integralGetDimensions ( L_INTEGRAL *ii, l_int32 *pw, l_int32 *ph, l_int32 *pd, l_int32 *phassq );
+LEPT_DLL extern l_ok integralGetRectSums ( L_INTEGRAL *ii, l_int32 x, l_int32 y, l_int32 w, l_int32 h, l_uint32 *psum, l_uint64 *psqsum );
+LEPT_DLL extern l_ok integralMeanInRectangle ( L_INTEGRAL *ii, BOX *box, l_float32 *pval );
+LEPT_DLL extern l_ok integralVarianceInRectangle ( L_INTEGRAL *ii, BOX *box, l_float32 *pvar, l_float32 *prvar );
+LEPT_DLL extern PIX * integralWindowedMean ( L_INTEGRAL *ii, l_int32 wc, l_int32 hc, l_int32 normflag );
+LEPT_DLL extern PIX * integralWindowedMeanSquare ( L_INTEGRAL *ii, l_int32 wc, l_int32 hc );
+LEPT_DLL extern PIX * integralBlockconv ( L_INTEGRAL *ii, l_int32 wc, l_int32 hc );
 LEPT_DLL extern JBCLASSER * jbRankHausInit ( l_int32 components, l_int32 maxwidth, l_int32 maxheight, l_int32 size, l_float32 rank );
 LEPT_DLL extern JBCLASSER * jbCorrelationInit ( l_int32 components, l_int32 maxwidth, l_int32 maxheight, l_float32 thresh, l_float32 weightfactor );
 LEPT_DLL extern JBCLASSER * jbCorrelationInitWithoutComponents ( l_int32 components, l_int32 maxwidth, l_int32 maxheight, l_float32 thresh, l_float32 weightfactor );
@@ -1097,6 +1121,8 @@ LEPT_DLL extern PIX * pixReadMemJp2k ( const l_uint8 *data, size_t size, l_uint3
 LEPT_DLL extern l_ok pixWriteMemJp2k ( l_uint8 **pdata, size_t *psize, PIX *pix, l_int32 quality, l_int32 nlevels, l_int32 hint, l_ok debugflag );
 LEPT_DLL extern PIX * pixReadJpeg ( const char *filename, l_int32 cmflag, l_int32 reduction, l_int32 *pnwarn, l_int32 hint );
 LEPT_DLL extern PIX * pixReadStreamJpeg ( FILE *fp, l_int32 cmflag, l_int32 reduction, l_int32 *pnwarn, l_int32 hint );
+LEPT_DLL extern PIX * pixReadJpegRegion ( const char *filename, BOX *box, l_int32 cmapflag, l_int32 reduction, l_int32 *pnwarn, l_int32 hint );
+LEPT_DLL extern PIX * pixReadStreamJpegRegion ( FILE *fp, BOX *box, l_int32 cmapflag, l_int32 reduction, l_int32 *pnwarn, l_int32 hint );
 LEPT_DLL extern l_ok readHeaderJpeg ( const char *filename, l_int32 *pw, l_int32 *ph, l_int32 *pspp, l_int32 *pycck, l_int32 *pcmyk );
 LEPT_DLL extern l_ok freadHeaderJpeg ( FILE *fp, l_int32 *pw, l_int32 *ph, l_int32 *pspp, l_int32 *pycck, l_int32 *pcmyk );
 LEPT_DLL extern l_int32 fgetJpegResolution ( FILE *fp, l_int32 *pxres, l_int32 *pyres );
@@ -1104,9 +1130,14 @@ LEPT_DLL extern l_int32 fgetJpegComment ( FILE *fp, l_uint8 **pcomment );
 LEPT_DLL extern l_ok pixWriteJpeg ( const char *filename, PIX *pix, l_int32 quality, l_int32 progressive );
 LEPT_DLL extern l_ok pixWriteStreamJpeg ( FILE *fp, PIX *pix, l_int32 quality, l_int32 progressive );
 LEPT_DLL extern PIX * pixReadMemJpeg ( const l_uint8 *cdata, size_t size, l_int32 cmflag, l_int32 reduction, l_int32 *pnwarn, l_int32 hint );
+LEPT_DLL extern PIX * pixReadMemJpegRegion ( const l_uint8 *data, size_t size, BOX *box, l_int32 cmflag, l_int32 reduction, l_int32 *pnwarn, l_int32 hint );
 LEPT_DLL extern l_ok readHeaderMemJpeg ( const l_uint8 *cdata, size_t size, l_int32 *pw, l_int32 *ph, l_int32 *pspp, l_int32 *pycck, l_int32 *pcmyk );
 LEPT_DLL extern l_ok readResolutionMemJpeg ( const l_uint8 *data, size_t size, l_int32 *pxres, l_int32 *pyres );
 LEPT_DLL extern l_ok pixWriteMemJpeg ( l_uint8 **pdata, size_t *psize, PIX *pix, l_int32 quality, l_int32 progressive );
+LEPT_DLL extern l_ok jpegTransformFile ( const char *filein, const char *fileout, l_int32 transform, BOX *box );
+LEPT_DLL extern l_ok jpegTransformStream ( FILE *fpin, FILE *fpout, l_int32 transform, BOX *box );
+LEPT_DLL extern l_ok jpegTransformMem ( const l_uint8 *datain, size_t nbytesin, l_int32 transform, BOX *box, l_uint8 **pdataout, size_t *pnbytesout );
+LEPT_DLL extern l_ok jpegCheckTransformMem ( const l_uint8 *data, size_t nbytes, l_int32 transform, BOX *box, l_int32 *plossless );
 LEPT_DLL extern l_ok pixSetChromaSampling ( PIX *pix, l_int32 sampling );
 LEPT_DLL extern L_KERNEL * kernelCreate ( l_int32 height, l_int32 width );
 LEPT_DLL extern void kernelDestroy ( L_KERNEL **pkel );
@@ -1192,6 +1223,7 @@ LEPT_DLL extern PIX * pixCloseCompBrick ( PIX *pixd, PIX *pixs, l_int32 hsize, l
 LEPT_DLL extern PIX * pixCloseSafeCompBrick ( PIX *pixd, PIX *pixs, l_int32 hsize, l_int32 vsize );
 LEPT_DLL extern void resetMorphBoundaryCondition ( l_int32 bc );
 LEPT_DLL extern l_uint32 getMorphBorderPixelColor ( l_int32 type, l_int32 depth );
+LEPT_DLL extern void l_setMorphFused ( l_int32 flag );
 LEPT_DLL extern PIX * pixExtractBoundary ( PIX *pixs, l_int32 type );
 LEPT_DLL extern PIX * pixMorphSequenceMasked ( PIX *pixs, PIX *pixm, const char *sequence, l_int32 dispsep );
 LEPT_DLL extern PIX * pixMorphSequenceByComponent ( PIX *pixs, const char *sequence, l_int32 connectivity, l_int32 minw, l_int32 minh, BOXA **pboxa );
@@ -1226,13 +1258,19 @@ LEPT_DLL extern PIX * pixErodeCompBrickExtendDwa ( PIX *pixd, PIX *pixs, l_int32
 LEPT_DLL extern PIX * pixOpenCompBrickExtendDwa ( PIX *pixd, PIX *pixs, l_int32 hsize, l_int32 vsize );
 LEPT_DLL extern PIX * pixCloseCompBrickExtendDwa ( PIX *pixd, PIX *pixs, l_int32 hsize, l_int32 vsize );
 LEPT_DLL extern l_ok getExtendedCompositeParameters ( l_int32 size, l_int32 *pn, l_int32 *pextra, l_int32 *pactualsize );
+LEPT_DLL extern l_ok l_setDwaWordWidth ( l_int32 width );
+LEPT_DLL extern l_int32 l_getDwaWordWidth ( void );
 LEPT_DLL extern PIX * pixMorphSequence ( PIX *pixs, const char *sequence, l_int32 dispsep );
 LEPT_DLL extern PIX * pixMorphCompSequence ( PIX *pixs, const char *sequence, l_int32 dispsep );
 LEPT_DLL extern PIX * pixMorphSequenceDwa ( PIX *pixs, const char *sequence, l_int32 dispsep );
 LEPT_DLL extern PIX * pixMorphCompSequenceDwa ( PIX *pixs, const char *sequence, l_int32 dispsep );
 LEPT_DLL extern l_int32 morphSequenceVerify ( SARRAY *sa );
 LEPT_DLL extern PIX * pixGrayMorphSequence ( PIX *pixs, const char *sequence, l_int32 dispsep, l_int32 dispy );
+LEPT_DLL extern l_int32 grayMorphSequenceVerify ( SARRAY *sa );
 LEPT_DLL extern PIX * pixColorMorphSequence ( PIX *pixs, const char *sequence, l_int32 dispsep, l_int32 dispy );
+LEPT_DLL extern L_MORPH_PLAN * morphPlanCreate ( const char *sequence, l_int32 depth );
+LEPT_DLL extern void morphPlanDestroy ( L_MORPH_PLAN **pplan );
+LEPT_DLL extern PIX * pixMorphPlanApply ( PIX *pixs, L_MORPH_PLAN *plan, PIXA *pixaw );
 LEPT_DLL extern NUMA * numaCreate ( l_int32 n );
 LEPT_DLL extern NUMA * numaCreateFromIArray ( l_int32 *iarray, l_int32 size );
 LEPT_DLL extern NUMA * numaCreateFromFArray ( l_float32 *farray, l_int32 size, l_int32 copyflag );
@@ -1424,6 +1462,23 @@ LEPT_DLL extern l_ok partifyFiles ( const char *dirname, const char *substr, l_i
 LEPT_DLL extern l_ok partifyPixac ( PIXAC *pixac, l_int32 nparts, PIXA *pixadb );
 LEPT_DLL extern BOXA * boxaGetWhiteblocks ( BOXA *boxas, BOX *box, l_int32 sortflag, l_int32 maxboxes, l_float32 maxoverlap, l_int32 maxperim, l_float32 fract, l_int32 maxpops );
 LEPT_DLL extern BOXA * boxaPruneSortedOnOverlap ( BOXA *boxas, l_float32 maxoverlap );
+LEPT_DLL extern L_PBOXA * pboxaCreate ( l_int32 n );
+LEPT_DLL extern void pboxaDestroy ( L_PBOXA **ppba );
+LEPT_DLL extern L_PBOXA * pboxaCopy ( L_PBOXA *pbas );
+LEPT_DLL extern l_int32 pboxaGetCount ( L_PBOXA *pba );
+LEPT_DLL extern l_ok pboxaAddBox ( L_PBOXA *pba, l_int32 x, l_int32 y, l_int32 w, l_int32 h );
+LEPT_DLL extern l_ok pboxaGetBoxGeometry ( L_PBOXA *pba, l_int32 index, l_int32 *px, l_int32 *py, l_int32 *pw, l_int32 *ph );
+LEPT_DLL extern L_PBOXA * boxaConvertToPboxa ( BOXA *boxa );
+LEPT_DLL extern BOXA * pboxaConvertToBoxa ( L_PBOXA *pba );
+LEPT_DLL extern l_ok pboxaGetExtent ( L_PBOXA *pba, l_int32 *pw, l_int32 *ph, BOX **pbox );
+LEPT_DLL extern L_PBOXA * pboxaSort ( L_PBOXA *pbas, l_int32 sorttype, l_int32 sortorder, NUMA **pnaindex );
+LEPT_DLL extern L_PBOXA * pboxaSelectBySize ( L_PBOXA *pbas, l_int32 width, l_int32 height, l_int32 type, l_int32 relation, l_int32 *pchanged );
+LEPT_DLL extern L_PBOXA * pboxaIntersectsBox ( L_PBOXA *pbas, BOX *box );
+LEPT_DLL extern L_PBOXA * pboxaCombineOverlaps ( L_PBOXA *pbas );
+LEPT_DLL extern l_ok pboxaCombineOverlapsInPair ( L_PBOXA *pbas1, L_PBOXA *pbas2, L_PBOXA **ppbad1, L_PBOXA **ppbad2 );
+LEPT_DLL extern L_BOXGRID * boxgridCreate ( BOXA *boxa, l_int32 cellw, l_int32 cellh );
+LEPT_DLL extern void boxgridDestroy ( L_BOXGRID **pgrid );
+LEPT_DLL extern NUMA * boxgridFindIntersecting ( L_BOXGRID *grid, BOX *box );
 LEPT_DLL extern l_ok compressFilesToPdf ( SARRAY *sa, l_int32 onebit, l_int32 savecolor, l_float32 scalefactor, l_int32 quality, const char *title, const char *fileout );
 LEPT_DLL extern l_ok cropFilesToPdf ( SARRAY *sa, l_int32 lr_clear, l_int32 tb_clear, l_int32 edgeclean, l_int32 lr_border, l_int32 tb_border, l_float32 maxwiden, l_int32 printwiden, const char *title, const char *fileout );
 LEPT_DLL extern l_ok cleanTo1bppFilesToPdf ( SARRAY *sa, l_int32 res, l_int32 contrast, l_int32 rotation, l_int32 opensize, const char *title, const char *fileout );
@@ -1438,6 +1493,7 @@ LEPT_DLL extern l_ok saConvertUnscaledFilesToPdfData ( SARRAY *sa, const char *t
 LEPT_DLL extern l_ok convertUnscaledToPdfData ( const char *fname, const char *title, l_uint8 **pdata, size_t *pnbytes );
 LEPT_DLL extern l_ok pixaConvertToPdf ( PIXA *pixa, l_int32 res, l_float32 scalefactor, l_int32 type, l_int32 quality, const char *title, const char *fileout );
 LEPT_DLL extern l_ok pixaConvertToPdfData ( PIXA *pixa, l_int32 res, l_float32 scalefactor, l_int32 type, l_int32 quality, const char *title, l_uint8 **pdata, size_t *pnbytes );
+LEPT_DLL extern l_int32 pdfMakePages ( SARRAY *sa, PIXA *pixa, PIXAC *pixac, l_int32 res, l_float32 scalefactor, l_int32 type, l_int32 quality, const char *title, L_PTRA *pa_data, L_PDF_WRITER *pdfw );
 LEPT_DLL extern l_ok convertToPdf ( const char *filein, l_int32 type, l_int32 quality, const char *fileout, l_int32 x, l_int32 y, l_int32 res, const char *title, L_PDF_DATA **plpd, l_int32 position );
 LEPT_DLL extern l_ok convertImageDataToPdf ( l_uint8 *imdata, size_t size, l_int32 type, l_int32 quality, const char *fileout, l_int32 x, l_int32 y, l_int32 res, const char *title, L_PDF_DATA **plpd, l_int32 position );
 LEPT_DLL extern l_ok convertToPdfData ( const char *filein, l_int32 type, l_int32 quality, l_uint8 **pdata, size_t *pnbytes, l_int32 x, l_int32 y, l_int32 res, const char *title, L_PDF_DATA **plpd, l_int32 position );
@@ -1458,8 +1514,17 @@ LEPT_DLL extern l_ok concatenatePdfToData ( const char *dirname, const char *sub
 LEPT_DLL extern l_ok saConcatenatePdfToData ( SARRAY *sa, l_uint8 **pdata, size_t *pnbytes );
 LEPT_DLL extern l_ok pixConvertToPdfData ( PIX *pix, l_int32 type, l_int32 quality, l_uint8 **pdata, size_t *pnbytes, l_int32 x, l_int32 y, l_int32 res, const char *title, L_PDF_DATA **plpd, l_int32 position );
 LEPT_DLL extern l_ok ptraConcatenatePdfToData ( L_PTRA *pa_data, SARRAY *sa, l_uint8 **pdata, size_t *pnbytes );
+LEPT_DLL extern L_PDF_WRITER * pdfWriterOpen ( const char *fileout, const char *title );
+LEPT_DLL extern L_PDF_WRITER * pdfWriterOpenStream ( FILE *fp, const char *title );
+LEPT_DLL extern l_ok pdfWriterAddPix ( L_PDF_WRITER *pdfw, PIX *pix, l_int32 type, l_int32 quality, l_int32 res );
+LEPT_DLL extern l_ok pdfWriterAddCompData ( L_PDF_WRITER *pdfw, L_COMP_DATA *cid );
+LEPT_DLL extern l_ok pdfWriterAddFile ( L_PDF_WRITER *pdfw, const char *fname );
+LEPT_DLL extern l_ok pdfWriterAddPageData ( L_PDF_WRITER *pdfw, l_uint8 *data, size_t nbytes );
+LEPT_DLL extern l_int32 pdfWriterGetPageCount ( L_PDF_WRITER *pdfw );
+LEPT_DLL extern l_ok pdfWriterClose ( L_PDF_WRITER **ppdfw );
 LEPT_DLL extern l_ok convertTiffMultipageToPdf ( const char *filein, const char *fileout );
 LEPT_DLL extern l_ok l_generateCIDataForPdf ( const char *fname, PIX *pix, l_int32 quality, L_COMP_DATA **pcid );
+LEPT_DLL extern l_ok l_generateCIDataForPdfOrth ( const char *fname, l_int32 quads, l_int32 quality, L_COMP_DATA **pcid );
 LEPT_DLL extern L_COMP_DATA * l_generateFlateDataPdf ( const char *fname, PIX *pix );
 LEPT_DLL extern L_COMP_DATA * l_generateJpegData ( const char *fname, l_int32 ascii85flag );
 LEPT_DLL extern L_COMP_DATA * l_generateJpegDataMem ( l_uint8 *data, size_t nbytes, l_int32 ascii85flag );
@@ -1475,6 +1540,8 @@ LEPT_DLL extern l_ok getPdfMediaBoxSizes ( const char *fname, NUMA **pnaw, NUMA
 LEPT_DLL extern l_ok getPdfRendererResolution ( const char *infile, const char *outdir, l_int32 *pres );
 LEPT_DLL extern void l_pdfSetG4ImageMask ( l_int32 flag );
 LEPT_DLL extern void l_pdfSetDateAndVersion ( l_int32 flag );
+LEPT_DLL extern l_int32 l_pdfSetThreads ( l_int32 nthreads );
+LEPT_DLL extern l_int32 l_pdfGetThreads ( void );
 LEPT_DLL extern void setPixMemoryManager ( alloc_fn allocator, dealloc_fn deallocator );
 LEPT_DLL extern PIX * pixCreate ( l_int32 width, l_int32 height, l_int32 depth );
 LEPT_DLL extern PIX * pixCreateNoInit ( l_int32 width, l_int32 height, l_int32 depth );
@@ -1531,6 +1598,8 @@ LEPT_DLL extern l_int32 pixFreeAndSetData ( PIX *pix, l_uint32 *data );
 LEPT_DLL extern l_int32 pixSetData ( PIX *pix, l_uint32 *data );
 LEPT_DLL extern l_int32 pixFreeData ( PIX *pix );
 LEPT_DLL extern l_uint32 * pixExtractData ( PIX *pixs );
+LEPT_DLL extern l_ok pixSetMappedData ( PIX *pix, l_uint32 *data, l_uint8 *mapdata, size_t mapsize );
+LEPT_DLL extern l_int32 pixIsMapped ( PIX *pix );
 LEPT_DLL extern void ** pixGetLinePtrs ( PIX *pix, l_int32 *psize );
 LEPT_DLL extern l_int32 pixSizesEqual ( const PIX *pix1, const PIX *pix2 );
 LEPT_DLL extern l_ok pixMaxAspectRatio ( PIX *pixs, l_float32 *pratio );
@@ -1936,6 +2005,7 @@ LEPT_DLL extern l_ok pixacompAddBox ( PIXAC *pixac, BOX *box, l_int32 copyflag )
 LEPT_DLL extern l_int32 pixacompGetCount ( const PIXAC *pixac );
 LEPT_DLL extern PIXC * pixacompGetPixcomp ( PIXAC *pixac, l_int32 index, l_int32 copyflag );
 LEPT_DLL extern PIX * pixacompGetPix ( PIXAC *pixac, l_int32 index );
+LEPT_DLL extern l_ok pixacompSetCacheSize ( PIXAC *pixac, l_int32 cachesize );
 LEPT_DLL extern l_ok pixacompGetPixDimensions ( PIXAC *pixac, l_int32 index, l_int32 *pw, l_int32 *ph, l_int32 *pd );
 LEPT_DLL extern BOXA * pixacompGetBoxa ( PIXAC *pixac, l_int32 accesstype );
 LEPT_DLL extern l_int32 pixacompGetBoxaCount ( PIXAC *pixac );
@@ -1949,6 +2019,7 @@ LEPT_DLL extern PIXAC * pixacompInterleave ( PIXAC *pixac1, PIXAC *pixac2 );
 LEPT_DLL extern PIXAC * pixacompRead ( const char *filename );
 LEPT_DLL extern PIXAC * pixacompReadStream ( FILE *fp );
 LEPT_DLL extern PIXAC * pixacompReadMem ( const l_uint8 *data, size_t size );
+LEPT_DLL extern PIXAC * pixacompReadMapped ( const char *filename, l_int32 cachesize );
 LEPT_DLL extern l_ok pixacompWrite ( const char *filename, PIXAC *pixac );
 LEPT_DLL extern l_ok pixacompWriteStream ( FILE *fp, PIXAC *pixac );
 LEPT_DLL extern l_ok pixacompWriteMem ( l_uint8 **pdata, size_t *psize, PIXAC *pixac );
@@ -2044,6 +2115,8 @@ LEPT_DLL extern l_ok pixWritePng ( const char *filename, PIX *pix, l_float32 gam
 LEPT_DLL extern l_ok pixWriteStreamPng ( FILE *fp, PIX *pix, l_float32 gamma );
 LEPT_DLL extern l_ok pixSetZlibCompression ( PIX *pix, l_int32 compval );
 LEPT_DLL extern void l_pngSetReadStrip16To8 ( l_int32 flag );
+LEPT_DLL extern l_int32 l_pngSetWritePreset ( l_int32 preset );
+LEPT_DLL extern l_int32 l_pngGetWritePreset ( void );
 LEPT_DLL extern PIX * pixReadMemPng ( const l_uint8 *filedata, size_t filesize );
 LEPT_DLL extern l_ok pixWriteMemPng ( l_uint8 **pfiledata, size_t *pfilesize, PIX *pix, l_float32 gamma );
 LEPT_DLL extern PIX * pixReadStreamPnm ( FILE *fp );
@@ -2056,6 +2129,7 @@ LEPT_DLL extern PIX * pixReadMemPnm ( const l_uint8 *cdata, size_t size );
 LEPT_DLL extern l_ok readHeaderMemPnm ( const l_uint8 *cdata, size_t size, l_int32 *pw, l_int32 *ph, l_int32 *pd, l_int32 *ptype, l_int32 *pbps, l_int32 *pspp );
 LEPT_DLL extern l_ok pixWriteMemPnm ( l_uint8 **pdata, size_t *psize, PIX *pix );
 LEPT_DLL extern l_ok pixWriteMemPam ( l_uint8 **pdata, size_t *psize, PIX *pix );
+LEPT_DLL extern PIX * pixReadPnmMapped ( const char *filename, l_int32 nthreads );
 LEPT_DLL extern PIX * pixProjectiveSampledPta ( PIX *pixs, PTA *ptad, PTA *ptas, l_int32 incolor );
 LEPT_DLL extern PIX * pixProjectiveSampled ( PIX *pixs, l_float32 *vc, l_int32 incolor );
 LEPT_DLL extern PIX * pixProjectivePta ( PIX *pixs, PTA *ptad, PTA *ptas, l_int32 incolor );
@@ -2216,6 +2290,8 @@ LEPT_DLL extern L_PTRA * ptraaGetPtra ( L_PTRAA *paa, l_int32 index, l_int32 acc
 LEPT_DLL extern L_PTRA * ptraaFlattenToPtra ( L_PTRAA *paa );
 LEPT_DLL extern l_ok pixQuadtreeMean ( PIX *pixs, l_int32 nlevels, PIX *pix_ma, FPIXA **pfpixa );
 LEPT_DLL extern l_ok pixQuadtreeVariance ( PIX *pixs, l_int32 nlevels, PIX *pix_ma, DPIX *dpix_msa, FPIXA **pfpixa_v, FPIXA **pfpixa_rv );
+LEPT_DLL extern l_ok integralQuadtreeMean ( L_INTEGRAL *ii, l_int32 nlevels, FPIXA **pfpixa );
+LEPT_DLL extern l_ok integralQuadtreeVariance ( L_INTEGRAL *ii, l_int32 nlevels, FPIXA **pfpixa_v, FPIXA **pfpixa_rv );
 LEPT_DLL extern l_ok pixMeanInRectangle ( PIX *pixs, BOX *box, PIX *pixma, l_float32 *pval );
 LEPT_DLL extern l_ok pixVarianceInRectangle ( PIX *pixs, BOX *box, PIX *pix_ma, DPIX *dpix_msa, l_float32 *pvar, l_float32 *prvar );
 LEPT_DLL extern BOXAA * boxaaQuadtreeRegions ( l_int32 w, l_int32 h, l_int32 nlevels );
@@ -2262,6 +2338,7 @@ LEPT_DLL extern PIX * pixRead ( const char *filename );
 LEPT_DLL extern PIX * pixReadWithHint ( const char *filename, l_int32 hint );
 LEPT_DLL extern PIX * pixReadIndexed ( SARRAY *sa, l_int32 index );
 LEPT_DLL extern PIX * pixReadStream ( FILE *fp, l_int32 hint );
+LEPT_DLL extern PIX * pixReadMapped ( const char *filename, l_int32 nthreads );
 LEPT_DLL extern l_ok pixReadHeader ( const char *filename, l_int32 *pformat, l_int32 *pw, l_int32 *ph, l_int32 *pbps, l_int32 *pspp, l_int32 *piscmap );
 LEPT_DLL extern l_ok findFileFormat ( const char *filename, l_int32 *pformat );
 LEPT_DLL extern l_ok findFileFormatStream ( FILE *fp, l_int32 *pformat );
@@ -2358,6 +2435,24 @@ LEPT_DLL extern l_ok l_pdfRenderFile ( const char *filename, l_int32 res, SARRAY
 LEPT_DLL extern l_ok l_pdfRenderFiles ( const char *dir, SARRAY *sain, l_int32 res, SARRAY **psaout );
 LEPT_DLL extern l_ok l_pdfRenderUnscaledFile ( const char *filename, SARRAY **psaout );
 LEPT_DLL extern l_ok l_pdfRenderUnscaledFiles ( const char *dir, SARRAY *sain, SARRAY **psaout );
+LEPT_DLL extern RLPIX * rlpixCreate ( l_int32 w, l_int32 h );
+LEPT_DLL extern void rlpixDestroy ( RLPIX **prl );
+LEPT_DLL extern RLPIX * rlpixCopy ( RLPIX *rls );
+LEPT_DLL extern l_ok rlpixGetDimensions ( RLPIX *rl, l_int32 *pw, l_int32 *ph );
+LEPT_DLL extern l_int32 rlpixGetRunCount ( RLPIX *rl );
+LEPT_DLL extern l_ok rlpixGetLineRuns ( RLPIX *rl, l_int32 y, l_int32 *pn, l_int32 **pxstart, l_int32 **pxend );
+LEPT_DLL extern RLPIX * pixConvertToRLPix ( PIX *pixs );
+LEPT_DLL extern PIX * rlpixConvertToPix ( RLPIX *rl );
+LEPT_DLL extern l_ok rlpixCountPixels ( RLPIX *rl, l_int32 *pcount );
+LEPT_DLL extern RLPIX * rlpixUnion ( RLPIX *rl1, RLPIX *rl2 );
+LEPT_DLL extern RLPIX * rlpixIntersection ( RLPIX *rl1, RLPIX *rl2 );
+LEPT_DLL extern RLPIX * rlpixSubtract ( RLPIX *rl1, RLPIX *rl2 );
+LEPT_DLL extern RLPIX * rlpixDilateBrick ( RLPIX *rls, l_int32 hsize, l_int32 vsize );
+LEPT_DLL extern RLPIX * rlpixErodeBrick ( RLPIX *rls, l_int32 hsize, l_int32 vsize );
+LEPT_DLL extern RLPIX * rlpixOpenBrick ( RLPIX *rls, l_int32 hsize, l_int32 vsize );
+LEPT_DLL extern RLPIX * rlpixCloseBrick ( RLPIX *rls, l_int32 hsize, l_int32 vsize );
+LEPT_DLL extern BOXA * rlpixConnCompBB ( RLPIX *rls, l_int32 connectivity );
+LEPT_DLL extern l_ok rlpixCountConnComp ( RLPIX *rls, l_int32 connectivity, l_int32 *pcount );
 LEPT_DLL extern l_ok pixRasterop ( PIX *pixd, l_int32 dx, l_int32 dy, l_int32 dw, l_int32 dh, l_int32 op, PIX *pixs, l_int32 sx, l_int32 sy );
 LEPT_DLL extern l_ok pixRasteropVip ( PIX *pixd, l_int32 bx, l_int32 bw, l_int32 vshift, l_int32 incolor );
 LEPT_DLL extern l_ok pixRasteropHip ( PIX *pixd, l_int32 by, l_int32 bh, l_int32 hshift, l_int32 incolor );
@@ -2502,6 +2597,7 @@ LEPT_DLL extern PIX * pixScaleGrayRank2 ( PIX *pixs, l_int32 rank );
 LEPT_DLL extern l_ok pixScaleAndTransferAlpha ( PIX *pixd, PIX *pixs, l_float32 scalex, l_float32 scaley );
 LEPT_DLL extern PIX * pixScaleWithAlpha ( PIX *pixs, l_float32 scalex, l_float32 scaley, PIX *pixg, l_float32 fract );
 LEPT_DLL extern PIX * pixSeedfillBinary ( PIX *pixd, PIX *pixs, PIX *pixm, l_int32 connectivity );
+LEPT_DLL extern PIX * pixSeedfillBinaryBands ( PIX *pixd, PIX *pixs, PIX *pixm, l_int32 connectivity, l_int32 nbands );
 LEPT_DLL extern PIX * pixSeedfillBinaryRestricted ( PIX *pixd, PIX *pixs, PIX *pixm, l_int32 connectivity, l_int32 xmax, l_int32 ymax );
 LEPT_DLL extern PIX * pixHolesByFilling ( PIX *pixs, l_int32 connectivity );
 LEPT_DLL extern PIX * pixFillClosedBorders ( PIX *pixs, l_int32 connectivity );
@@ -2574,6 +2670,7 @@ LEPT_DLL extern SELA * sela4ccThin ( SELA *sela );
 LEPT_DLL extern SELA * sela8ccThin ( SELA *sela );
 LEPT_DLL extern SELA * sela4and8ccThin ( SELA *sela );
 LEPT_DLL extern SEL * selMakePlusSign ( l_int32 size, l_int32 linewidth );
+LEPT_DLL extern SEL * selMakeDisk ( l_int32 radius );
 LEPT_DLL extern SEL * pixGenerateSelBoundary ( PIX *pixs, l_int32 hitdist, l_int32 missdist, l_int32 hitskip, l_int32 missskip, l_int32 topflag, l_int32 botflag, l_int32 leftflag, l_int32 rightflag, PIX **ppixe );
 LEPT_DLL extern SEL * pixGenerateSelWithRuns ( PIX *pixs, l_int32 nhlines, l_int32 nvlines, l_int32 distance, l_int32 minlength, l_int32 toppix, l_int32 botpix, l_int32 leftpix, l_int32 rightpix, PIX **ppixe );
 LEPT_DLL extern SEL * pixGenerateSelRandom ( PIX *pixs, l_float32 hitfract, l_float32 missfract, l_int32 distance, l_int32 toppix, l_int32 botpix, l_int32 leftpix, l_int32 rightpix, PIX **ppixe );
@@ -2606,6 +2703,7 @@ LEPT_DLL extern l_int32 pixFindSkewOrthogonalRange ( PIX *pixs, l_float32 *pangl
 LEPT_DLL extern l_ok pixFindDifferentialSquareSum ( PIX *pixs, l_float32 *psum );
 LEPT_DLL extern l_ok pixFindNormalizedSquareSum ( PIX *pixs, l_float32 *phratio, l_float32 *pvratio, l_float32 *pfract );
 LEPT_DLL extern PIX * pixReadStreamSpix ( FILE *fp );
+LEPT_DLL extern PIX * pixReadSpixMapped ( const char *filename );
 LEPT_DLL extern l_ok readHeaderSpix ( const char *filename, l_int32 *pwidth, l_int32 *pheight, l_int32 *pbps, l_int32 *pspp, l_int32 *piscmap );
 LEPT_DLL extern l_ok freadHeaderSpix ( FILE *fp, l_int32 *pwidth, l_int32 *pheight, l_int32 *pbps, l_int32 *pspp, l_int32 *piscmap );
 LEPT_DLL extern l_ok sreadHeaderSpix ( const l_uint32 *data, size_t size, l_int32 *pwidth, l_int32 *pheight, l_int32 *pbps, l_int32 *pspp, l_int32 *piscmap );
@@ -2662,6 +2760,26 @@ LEPT_DLL extern PIXA * pixaReadMultipageTiff ( const char *filename );
 LEPT_DLL extern l_ok pixaWriteMultipageTiff ( const char *filename, PIXA *pixa );
 LEPT_DLL extern l_ok writeMultipageTiff ( const char *dirin, const char *substr, const char *fileout );
 LEPT_DLL extern l_ok writeMultipageTiffSA ( SARRAY *sa, const char *fileout );
+LEPT_DLL extern L_TIFF_READER * tiffReaderOpen ( const char *filename, l_int32 n );
+LEPT_DLL extern void tiffReaderClose ( L_TIFF_READER **preader );
+LEPT_DLL extern l_ok tiffReaderGetInfo ( L_TIFF_READER *reader, l_int32 *pw, l_int32 *ph, l_int32 *pd, l_int32 *pbandh, l_int32 *pnbands );
+LEPT_DLL extern PIX * tiffReaderReadBand ( L_TIFF_READER *reader, l_int32 *py );
+LEPT_DLL extern L_TIFF_WRITER * tiffWriterOpen ( const char *filename, l_int32 h, l_int32 comptype );
+LEPT_DLL extern l_ok tiffWriterWriteBand ( L_TIFF_WRITER *writer, PIX *pix );
+LEPT_DLL extern l_ok tiffWriterClose ( L_TIFF_WRITER **pwriter );
+LEPT_DLL extern l_ok tiffProcessBands ( const char *filein, l_int32 n, const char *fileout, l_int32 comptype, tiffBandHandler_f func, void *userdata );
+LEPT_DLL extern L_TIFF_INDEX * tiffIndexCreate ( const char *filename );
+LEPT_DLL extern L_TIFF_INDEX * tiffIndexCreateMem ( const l_uint8 *cdata, size_t size );
+LEPT_DLL extern void tiffIndexDestroy ( L_TIFF_INDEX **ptidx );
+LEPT_DLL extern l_int32 tiffIndexGetCount ( L_TIFF_INDEX *tidx );
+LEPT_DLL extern l_ok tiffIndexGetPageInfo ( L_TIFF_INDEX *tidx, l_int32 n, size_t *poffset, l_int32 *pw, l_int32 *ph, l_int32 *pbps, l_int32 *pspp, l_int32 *pformat, l_int32 *pxres, l_int32 *pyres );
+LEPT_DLL extern L_TIFF_INDEX * tiffIndexRead ( const char *filename );
+LEPT_DLL extern L_TIFF_INDEX * tiffIndexReadStream ( FILE *fp );
+LEPT_DLL extern l_ok tiffIndexWrite ( const char *filename, L_TIFF_INDEX *tidx );
+LEPT_DLL extern l_ok tiffIndexWriteStream ( FILE *fp, L_TIFF_INDEX *tidx );
+LEPT_DLL extern PIX * pixReadTiffIndexed ( const char *filename, L_TIFF_INDEX *tidx, l_int32 n );
+LEPT_DLL extern PIX * pixReadStreamTiffIndexed ( FILE *fp, L_TIFF_INDEX *tidx, l_int32 n );
+LEPT_DLL extern PIX * pixReadMemTiffIndexed ( const l_uint8 *cdata, size_t size, L_TIFF_INDEX *tidx, l_int32 n );
 LEPT_DLL extern l_ok fprintTiffInfo ( FILE *fpout, const char *tiffile );
 LEPT_DLL extern l_ok tiffGetCount ( FILE *fp, l_int32 *pn );
 LEPT_DLL extern l_ok getTiffResolution ( FILE *fp, l_int32 *pxres, l_int32 *pyres );
@@ -2744,6 +2862,9 @@ LEPT_DLL extern l_uint8 * l_binaryReadSelectStream ( FILE *fp, size_t start, siz
 LEPT_DLL extern l_ok l_binaryWrite ( const char *filename, const char *operation, const void *data, size_t nbytes );
 LEPT_DLL extern size_t nbytesInFile ( const char *filename );
 LEPT_DLL extern size_t fnbytesInFile ( FILE *fp );
+LEPT_DLL extern l_uint8 * l_binaryMap ( const char *filename, size_t *pnbytes );
+LEPT_DLL extern l_uint8 * l_binaryMapPrivate ( const char *filename, size_t *pnbytes );
+LEPT_DLL extern l_ok l_binaryUnmap ( l_uint8 **pdata, size_t nbytes );
 LEPT_DLL extern l_uint8 * l_binaryCopy ( const l_uint8 *datas, size_t size );
 LEPT_DLL extern l_ok l_binaryCompare ( const l_uint8 *data1, size_t size1, const l_uint8 *data2, size_t size2, l_int32 *psame );
 LEPT_DLL extern l_ok fileCopy ( const char *srcfile, const char *newfile );
@@ -2850,6 +2971,9 @@ LEPT_DLL extern void changeFormatForMissingLib ( l_int32 *pformat );
 LEPT_DLL extern l_ok pixDisplayWrite ( PIX *pixs, l_int32 reduction );
 LEPT_DLL extern l_uint8 * zlibCompress ( const l_uint8 *datain, size_t nin, size_t *pnout );
 LEPT_DLL extern l_uint8 * zlibUncompress ( const l_uint8 *datain, size_t nin, size_t *pnout );
+LEPT_DLL extern l_uint8 * zlibCompressParallel ( const l_uint8 *datain, size_t nin, l_int32 level, l_int32 nthreads, size_t *pnout );
+LEPT_DLL extern l_int32 l_zlibSetThreads ( l_int32 nthreads );
+LEPT_DLL extern l_int32 l_zlibGetThreads ( void );
 
 LEPT_DLL extern void leptCreateDiagnoticsSpecInstance ( void );
 LEPT_DLL extern void leptDestroyDiagnoticsSpecInstance ( void );
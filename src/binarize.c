@@ -49,6 +49,9 @@
  *      Sauvola local thresholding
  *          l_int32       pixSauvolaBinarizeTiled()
  *          l_int32       pixSauvolaBinarize()
+ *          l_int32       pixSauvolaBinarizeIntegral()
+ *          l_int32       pixSauvolaBinarizeStream()
+ *          static l_int32  pixSauvolaStreamBand()
  *          static PIX   *pixSauvolaGetThreshold()
  *          static PIX   *pixApplyLocalThreshold();
  *
@@ -94,6 +97,10 @@
 static PIX *pixSauvolaGetThreshold(PIX *pixm, PIX *pixms, l_float32 factor,
                                    PIX **ppixsd);
 static PIX *pixApplyLocalThreshold(PIX *pixs, PIX *pixth);
+static l_int32 pixSauvolaStreamBand(PIX *pixs, const l_int32 *xmap,
+                                    l_int32 whsize, l_float32 factor,
+                                    l_int32 ystart, l_int32 yend,
+                                    PIX *pixth, PIX *pixd);
 
 /*------------------------------------------------------------------*
  *                 Adaptive Otsu-based thresholding                 *
@@ -474,12 +481,10 @@ PIX      *pixn, *pixm, *pixd, *pix1, *pix2, *pix3, *pix4;
  *          value for %whsize is 2; typically it is >= 7.
  *      (2) For nx == ny == 1, this defaults to pixSauvolaBinarize().
  *      (3) Why a tiled version?
- *          (a) A uint32 is used for the mean value accumulator, so
- *              overflow can occur for an image with more than 16M pixels.
- *          (b) A dpix is used to accumulate mean square values, and it
- *              can only accommodate images with less than 2^28 pixels.
- *              Using tiles reduces the size of all the arrays.
- *          (c) Each tile can be processed independently, in parallel,
+ *          (a) pixSauvolaBinarize() makes an integral image with
+ *              12 bytes per pixel.  Using tiles reduces the size of
+ *              all the arrays.
+ *          (b) Each tile can be processed independently, in parallel,
  *              on a multicore processor.
  *      (4) The Sauvola threshold is determined from the formula:
  *              t = m * (1 - k * (1 - s / 128))
@@ -609,6 +614,13 @@ PIXTILING  *pt;
  *          and the larger the variance, the closer to the median
  *          it should be chosen.  Typical values for k are between
  *          0.2 and 0.5.
+ *      (6) The local statistics come from an integral image, which
+ *          takes 12 bytes per pixel of the bordered image.  Its 32-bit
+ *          sums wrap around, but the window sums are exact for any
+ *          image size if the window has fewer than 2^24 pixels; i.e.,
+ *          for %whsize < 2048.
+ *          To reduce the memory for very large images, use
+ *          pixSauvolaBinarizeTiled() or pixSauvolaBinarizeStream().
  * </pre>
  */
 l_ok
@@ -621,8 +633,8 @@ pixSauvolaBinarize(PIX       *pixs,
                    PIX      **ppixth,
                    PIX      **ppixd)
 {
-l_int32  w, h;
-PIX     *pixg, *pixsc, *pixm = NULL, *pixms = NULL, *pixth = NULL, *pixd = NULL;
+l_int32  w, h, ret;
+PIX     *pixg;
 
     if (ppixm) *ppixm = NULL;
     if (ppixsd) *ppixsd = NULL;
@@ -642,28 +654,106 @@ PIX     *pixg, *pixsc, *pixm = NULL, *pixms = NULL, *pixth = NULL, *pixd = NULL;
     if (factor < 0.0)
         return ERROR_INT("factor must be >= 0", __func__, 1);
 
-    if (addborder) {
+    if (addborder)
         pixg = pixAddMirroredBorder(pixs, whsize + 1, whsize + 1,
                                     whsize + 1, whsize + 1);
-        pixsc = pixClone(pixs);
-    } else {
+    else
         pixg = pixClone(pixs);
-        pixsc = pixRemoveBorder(pixs, whsize + 1);
+    if (!pixg)
+        return ERROR_INT("pixg not made", __func__, 1);
+
+    ret = pixSauvolaBinarizeIntegral(pixg, NULL, whsize, factor,
+                                     ppixm, ppixsd, ppixth, ppixd);
+    if (ppixd && *ppixd)
+        pixCopyResolution(*ppixd, pixs);
+    pixDestroy(&pixg);
+    return ret;
+}
+
+
+/*!
+ * \brief   pixSauvolaBinarizeIntegral()
+ *
+ * \param[in]    pixs       8 bpp grayscale, with a border of
+ *                          (%whsize + 1) pixels on all sides
+ * \param[in]    ii         [optional] integral image of pixs, made with
+ *                          sums of squares; can be null
+ * \param[in]    whsize     window half-width for measuring local statistics
+ * \param[in]    factor     factor for reducing threshold due to variance; >= 0
+ * \param[out]   ppixm      [optional] local mean values
+ * \param[out]   ppixsd     [optional] local standard deviation values
+ * \param[out]   ppixth     [optional] threshold values
+ * \param[out]   ppixd      [optional] thresholded image
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is pixSauvolaBinarize() with %addborder = 0, where the
+ *          integral image can be shared with other operations on
+ *          the same image; see integral.c.  If %ii is null, it is
+ *          made here.
+ *      (2) The local mean and mean square are found from the single
+ *          integral image, rather than from separate accumulators.
+ *      (3) The outputs have the border removed.
+ *      (4) There is no limit on image size other than memory for
+ *          the integral image; see pixSauvolaBinarize().
+ * </pre>
+ */
+l_ok
+pixSauvolaBinarizeIntegral(PIX         *pixs,
+                           L_INTEGRAL  *ii,
+                           l_int32      whsize,
+                           l_float32    factor,
+                           PIX        **ppixm,
+                           PIX        **ppixsd,
+                           PIX        **ppixth,
+                           PIX        **ppixd)
+{
+l_int32      w, h, iw, ih, id, hassq;
+L_INTEGRAL  *iic;
+PIX         *pixsc, *pixm = NULL, *pixms = NULL, *pixth = NULL, *pixd = NULL;
+
+    if (ppixm) *ppixm = NULL;
+    if (ppixsd) *ppixsd = NULL;
+    if (ppixth) *ppixth = NULL;
+    if (ppixd) *ppixd = NULL;
+    if (!ppixm && !ppixsd && !ppixth && !ppixd)
+        return ERROR_INT("no outputs", __func__, 1);
+    if (!pixs || pixGetDepth(pixs) != 8)
+        return ERROR_INT("pixs undefined or not 8 bpp", __func__, 1);
+    if (pixGetColormap(pixs))
+        return ERROR_INT("pixs is cmapped", __func__, 1);
+    pixGetDimensions(pixs, &w, &h, NULL);
+    if (whsize < 2)
+        return ERROR_INT("whsize must be >= 2", __func__, 1);
+    if (w < 2 * whsize + 4 || h < 2 * whsize + 4)
+        return ERROR_INT("whsize too large for image", __func__, 1);
+    if (factor < 0.0)
+        return ERROR_INT("factor must be >= 0", __func__, 1);
+    if (ii) {
+        integralGetDimensions(ii, &iw, &ih, &id, &hassq);
+        if (iw != w || ih != h || id != 8)
+            return ERROR_INT("ii does not match pixs", __func__, 1);
+        if (!hassq && (ppixsd || ppixth || ppixd))
+            return ERROR_INT("ii has no sums of squares", __func__, 1);
+        iic = ii;
+    } else {
+        if ((iic = integralCreate(pixs, (ppixsd || ppixth || ppixd))) == NULL)
+            return ERROR_INT("iic not made", __func__, 1);
     }
-    if (!pixg || !pixsc)
-        return ERROR_INT("pixg and pixsc not made", __func__, 1);
 
         /* All these functions strip off the border pixels. */
-    if (ppixm || ppixth || ppixd)
-        pixm = pixWindowedMean(pixg, whsize, whsize, 1, 1);
-    if (ppixsd || ppixth || ppixd)
-        pixms = pixWindowedMeanSquare(pixg, whsize, whsize, 1);
-    if (ppixth || ppixd)
+    pixm = integralWindowedMean(iic, whsize, whsize, 1);
+    if (ppixsd || ppixth || ppixd) {
+        pixms = integralWindowedMeanSquare(iic, whsize, whsize);
         pixth = pixSauvolaGetThreshold(pixm, pixms, factor, ppixsd);
+    }
     if (ppixd) {
+        pixsc = pixRemoveBorder(pixs, whsize + 1);
         pixd = pixApplyLocalThreshold(pixsc, pixth);
         pixCopyResolution(pixd, pixs);
-	}
+        pixDestroy(&pixsc);
+    }
 
     if (ppixm)
         *ppixm = pixm;
@@ -676,8 +766,243 @@ PIX     *pixg, *pixsc, *pixm = NULL, *pixms = NULL, *pixth = NULL, *pixd = NULL;
         pixDestroy(&pixth);
     if (ppixd)
         *ppixd = pixd;
-    pixDestroy(&pixg);
-    pixDestroy(&pixsc);
+    if (iic != ii) integralDestroy(&iic);
+    return 0;
+}
+
+
+/*!
+ * \brief   pixSauvolaBinarizeStream()
+ *
+ * \param[in]    pixs      8 bpp grayscale, not colormapped
+ * \param[in]    whsize    window half-width for measuring local statistics
+ * \param[in]    factor    factor for reducing threshold due to variance; >= 0
+ * \param[in]    nbands    number of horizontal bands; >= 1
+ * \param[out]   ppixth    [optional] Sauvola threshold values
+ * \param[out]   ppixd     [optional] thresholded image
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This gives the same result as pixSauvolaBinarize() with
+ *          %addborder = 1, but it never makes the bordered image or
+ *          the full-size mean, mean square and threshold images.
+ *          Instead, each band slides down its rows keeping running
+ *          column sums of values and squared values over the window,
+ *          and the output is generated one raster line at a time.
+ *          Besides the outputs, the memory required is only two
+ *          arrays of (w + 2 * %whsize) words for each band.
+ *      (2) The mirrored border is handled by reflecting row and column
+ *          indices, so the result is identical to thresholding with
+ *          a border of (%whsize + 1) added by pixAddMirroredBorder().
+ *      (3) The bands are independent, and are processed in parallel
+ *          when built with OpenMP.  Each band must prime its column
+ *          sums with 2 * %whsize + 1 rows, so the number of bands is
+ *          reduced if necessary to make them at least that high.
+ *      (4) Unlike pixSauvolaBinarize(), no integral image of the
+ *          full image is made; the window sums stay in range for all
+ *          practical values of %whsize.
+ * </pre>
+ */
+l_ok
+pixSauvolaBinarizeStream(PIX       *pixs,
+                         l_int32    whsize,
+                         l_float32  factor,
+                         l_int32    nbands,
+                         PIX      **ppixth,
+                         PIX      **ppixd)
+{
+l_int32   i, k, x, w, h, wext, bh, ret;
+l_int32  *xmap;
+PIX      *pixth = NULL, *pixd = NULL;
+
+    if (!ppixth && !ppixd)
+        return ERROR_INT("no outputs", __func__, 1);
+    if (ppixth) *ppixth = NULL;
+    if (ppixd) *ppixd = NULL;
+    if (!pixs || pixGetDepth(pixs) != 8)
+        return ERROR_INT("pixs undefined or not 8 bpp", __func__, 1);
+    if (pixGetColormap(pixs))
+        return ERROR_INT("pixs is cmapped", __func__, 1);
+    pixGetDimensions(pixs, &w, &h, NULL);
+    if (whsize < 2)
+        return ERROR_INT("whsize must be >= 2", __func__, 1);
+    if (w < 2 * whsize + 3 || h < 2 * whsize + 3)
+        return ERROR_INT("whsize too large for image", __func__, 1);
+    if (factor < 0.0)
+        return ERROR_INT("factor must be >= 0", __func__, 1);
+
+        /* Each band must be at least as high as the window */
+    nbands = L_MAX(1, L_MIN(nbands, h / (2 * whsize + 1)));
+    bh = (h + nbands - 1) / nbands;
+    nbands = (h + bh - 1) / bh;
+
+        /* Map from column in the virtual bordered image to column in pixs */
+    wext = w + 2 * whsize;
+    if ((xmap = (l_int32 *)LEPT_CALLOC(wext, sizeof(l_int32))) == NULL)
+        return ERROR_INT("xmap not made", __func__, 1);
+    for (k = 0; k < wext; k++) {
+        x = k - whsize;
+        if (x < 0)
+            x = -x - 1;
+        else if (x >= w)
+            x = 2 * w - 1 - x;
+        xmap[k] = x;
+    }
+
+    if (ppixth) {
+        pixth = pixCreate(w, h, 8);
+        *ppixth = pixth;
+    }
+    if (ppixd) {
+        pixd = pixCreate(w, h, 1);
+        pixCopyResolution(pixd, pixs);
+        *ppixd = pixd;
+    }
+    if ((ppixth && !pixth) || (ppixd && !pixd)) {
+        LEPT_FREE(xmap);
+        if (ppixth) pixDestroy(ppixth);
+        if (ppixd) pixDestroy(ppixd);
+        return ERROR_INT("output pix not made", __func__, 1);
+    }
+
+    ret = 0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:ret) if (nbands > 1)
+#endif  /* _OPENMP */
+    for (i = 0; i < nbands; i++) {
+        ret += pixSauvolaStreamBand(pixs, xmap, whsize, factor, i * bh,
+                                    L_MIN(h, (i + 1) * bh), pixth, pixd);
+    }
+
+    LEPT_FREE(xmap);
+    if (ret) {
+        if (ppixth) pixDestroy(ppixth);
+        if (ppixd) pixDestroy(ppixd);
+        return ERROR_INT("band processing failed", __func__, 1);
+    }
+    return 0;
+}
+
+
+/*!
+ * \brief   pixSauvolaStreamBand()
+ *
+ * \param[in]    pixs      8 bpp grayscale
+ * \param[in]    xmap      map from extended column to column in pixs
+ * \param[in]    whsize    window half-width
+ * \param[in]    factor    factor for reducing threshold due to variance
+ * \param[in]    ystart    first row of the band
+ * \param[in]    yend      one past the last row of the band
+ * \param[in]    pixth     [optional] 8 bpp threshold output; can be null
+ * \param[in]    pixd      [optional] 1 bpp binary output; can be null
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The column sums cover the window rows, with reflection at
+ *          the top and bottom of the image.  Moving down one row
+ *          subtracts the row leaving the window and adds the one
+ *          entering it.  Along each row, the window sums are found
+ *          with a running sum over the column sums.
+ *      (2) The arithmetic and rounding are the same as in
+ *          integralWindowedMean(), integralWindowedMeanSquare() and
+ *          pixSauvolaGetThreshold().
+ * </pre>
+ */
+static l_int32
+pixSauvolaStreamBand(PIX            *pixs,
+                     const l_int32  *xmap,
+                     l_int32         whsize,
+                     l_float32       factor,
+                     l_int32         ystart,
+                     l_int32         yend,
+                     PIX            *pixth,
+                     PIX            *pixd)
+{
+l_int32    i, j, k, y, w, h, wext, wincr, wpls, wplt, wpld;
+l_int32    val, valadd, valsub, mv, ms, var, thresh;
+l_uint32   sum;
+l_uint64   sqsum;
+l_uint32  *datas, *datat, *datad, *lines, *lineadd, *linesub;
+l_uint32  *linet = NULL, *lined = NULL, *colsum, *colsq;
+l_float32  norm, sd;
+l_float64  normsq;
+
+    pixGetDimensions(pixs, &w, &h, NULL);
+    wext = w + 2 * whsize;
+    wincr = 2 * whsize + 1;
+    colsum = (l_uint32 *)LEPT_CALLOC(wext, sizeof(l_uint32));
+    colsq = (l_uint32 *)LEPT_CALLOC(wext, sizeof(l_uint32));
+    if (!colsum || !colsq) {
+        LEPT_FREE(colsum);
+        LEPT_FREE(colsq);
+        return ERROR_INT("column sum arrays not made", __func__, 1);
+    }
+    datas = pixGetData(pixs);
+    wpls = pixGetWpl(pixs);
+    datat = (pixth) ? pixGetData(pixth) : NULL;
+    wplt = (pixth) ? pixGetWpl(pixth) : 0;
+    datad = (pixd) ? pixGetData(pixd) : NULL;
+    wpld = (pixd) ? pixGetWpl(pixd) : 0;
+    norm = 1.0f / ((l_float32)(wincr) * wincr);
+    normsq = 1.0 / ((l_float32)(wincr) * wincr);
+
+        /* Prime the column sums with the window above the first row */
+    for (y = ystart - whsize; y <= ystart + whsize; y++) {
+        lines = datas + (size_t)((y < 0) ? -y - 1 :
+                                 (y >= h) ? 2 * h - 1 - y : y) * wpls;
+        for (k = 0; k < wext; k++) {
+            val = GET_DATA_BYTE(lines, xmap[k]);
+            colsum[k] += val;
+            colsq[k] += val * val;
+        }
+    }
+
+    for (i = ystart; i < yend; i++) {
+        if (i > ystart) {  /* slide the window down one row */
+            y = i + whsize;
+            lineadd = datas + (size_t)((y >= h) ? 2 * h - 1 - y : y) * wpls;
+            y = i - whsize - 1;
+            linesub = datas + (size_t)((y < 0) ? -y - 1 : y) * wpls;
+            for (k = 0; k < wext; k++) {
+                valadd = GET_DATA_BYTE(lineadd, xmap[k]);
+                valsub = GET_DATA_BYTE(linesub, xmap[k]);
+                colsum[k] += valadd - valsub;
+                colsq[k] += valadd * valadd - valsub * valsub;
+            }
+        }
+
+        lines = datas + (size_t)i * wpls;
+        if (pixth) linet = datat + (size_t)i * wplt;
+        if (pixd) lined = datad + (size_t)i * wpld;
+        sum = 0;
+        sqsum = 0;
+        for (k = 0; k < wincr; k++) {
+            sum += colsum[k];
+            sqsum += colsq[k];
+        }
+        for (j = 0; j < w; j++) {
+            if (j > 0) {
+                sum += colsum[j + wincr - 1] - colsum[j - 1];
+                sqsum += colsq[j + wincr - 1];
+                sqsum -= colsq[j - 1];
+            }
+            mv = (l_uint8)(norm * sum);
+            ms = (l_uint32)(normsq * (l_float64)sqsum + 0.5);
+            var = ms - mv * mv;
+            sd = sqrtf((l_float32)var);
+            thresh = (l_int32)(mv * (1.0 - factor * (1.0 - sd / 128.)));
+            thresh &= 0xff;  /* as stored in an 8 bpp threshold image */
+            if (pixth)
+                SET_DATA_BYTE(linet, j, thresh);
+            if (pixd && GET_DATA_BYTE(lines, j) < thresh)
+                SET_DATA_BIT(lined, j);
+        }
+    }
+
+    LEPT_FREE(colsum);
+    LEPT_FREE(colsq);
     return 0;
 }
 
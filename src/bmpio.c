@@ -32,6 +32,10 @@
  *           PIX          *pixReadStreamBmp()
  *           PIX          *pixReadMemBmp()
  *
+ *      Read from a file mapping
+ *           PIX          *pixReadBmpMapped()
+ *           static void   bmpConvertRow()
+ *
  *      Write bmp
  *           l_int32       pixWriteStreamBmp()
  *           l_int32       pixWriteMemBmp()
@@ -47,6 +51,9 @@
 #include "allheaders.h"
 #include "pix_internal.h"
 #include "bmp.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif  /* _OPENMP */
 
 /* --------------------------------------------*/
 #if  USE_BMPIO   /* defined in environ.h */
@@ -64,6 +71,12 @@ static const l_int32  L_MAX_ALLOWED_HEIGHT = 1000000;
 static const l_int64  L_MAX_ALLOWED_PIXELS = 400000000LL;
 static const l_int32  L_MAX_ALLOWED_RES = 10000000;  /* pixels/meter */
 
+    /* number of rows converted together in pixReadBmpMapped() */
+static const l_int32  BMP_BAND_HEIGHT = 64;
+
+static void bmpConvertRow(const l_uint8 *src, l_uint32 *line, l_int32 w,
+                          l_int32 filebpp);
+
 #ifndef  NO_CONSOLE_IO
 #undef DEBUG
 #define  DEBUG     0
@@ -397,6 +410,188 @@ PIXCMAP   *cmap;
 }
 
 
+/*--------------------------------------------------------------*
+ *                   Read from a file mapping                   *
+ *--------------------------------------------------------------*/
+/*!
+ * \brief   pixReadBmpMapped()
+ *
+ * \param[in]    filename
+ * \param[in]    nthreads   max number of threads; 0 for all available
+ * \return  pix, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This gives the same pix as pixRead().  The file is mapped
+ *          into memory instead of being copied into a buffer.
+ *      (2) For uncompressed rgb (24 bpp) and rgba (32 bpp) files without
+ *          a colormap, the rows are converted directly from the mapping,
+ *          in bands of rows that are done in parallel.  The file rows
+ *          are bottom-up unless the height in the header is negative.
+ *      (3) Other files are decoded from the mapping by pixReadMemBmp().
+ *          Their rows are a memcpy, so there is little to gain from
+ *          doing them in parallel.
+ * </pre>
+ */
+PIX *
+pixReadBmpMapped(const char  *filename,
+                 l_int32      nthreads)
+{
+l_uint8   *mapdata, *bmpih_b;
+l_int16    bftype, depth;
+l_int32    offset, width, height, height_neg, xres, yres, compression;
+l_int32    imagebytes, filebpp, wpl, i, k, nbands, iend, srcrow;
+l_uint32   ihbytes;
+l_uint32  *data;
+l_int64    npixels;
+size_t     nbytes, fdatabpl;
+BMP_FH    *bmpfh;
+BMP_IH     bmpih;
+PIX       *pix;
+
+    if (!filename)
+        return (PIX *)ERROR_PTR("filename not defined", __func__, NULL);
+    if (nthreads < 0)
+        return (PIX *)ERROR_PTR("invalid nthreads", __func__, NULL);
+
+#ifdef _OPENMP
+    if (nthreads == 0)
+        nthreads = omp_get_max_threads();
+#else
+    nthreads = 1;
+#endif  /* _OPENMP */
+
+    if ((mapdata = l_binaryMap(filename, &nbytes)) == NULL)
+        return (PIX *)ERROR_PTR_1("file not mapped", filename, __func__, NULL);
+    if (nbytes < sizeof(BMP_FH) + sizeof(BMP_IH)) {
+        l_binaryUnmap(&mapdata, nbytes);
+        return (PIX *)ERROR_PTR_1("bmf size error", filename, __func__, NULL);
+    }
+
+        /* Read the header fields as in pixReadMemBmp() */
+    bmpfh = (BMP_FH *)mapdata;
+    bftype = bmpfh->bfType[0] + ((l_int32)bmpfh->bfType[1] << 8);
+    memcpy(&bmpih, mapdata + BMP_FHBYTES, BMP_IHBYTES);
+    compression = convertOnBigEnd32(bmpih.biCompression);
+    offset = bmpfh->bfOffBits[0];
+    offset += (l_int32)bmpfh->bfOffBits[1] << 8;
+    offset += (l_int32)bmpfh->bfOffBits[2] << 16;
+    offset += (l_uint32)bmpfh->bfOffBits[3] << 24;
+    bmpih_b = (l_uint8 *)&bmpih;
+    ihbytes = bmpih_b[0] | ((l_int32)bmpih_b[1] << 8) |
+              ((l_int32)bmpih_b[2] << 16) | ((l_uint32)bmpih_b[3] << 24);
+    width = convertOnBigEnd32(bmpih.biWidth);
+    height = convertOnBigEnd32(bmpih.biHeight);
+    depth = convertOnBigEnd16(bmpih.biBitCount);
+    imagebytes = convertOnBigEnd32(bmpih.biSizeImage);
+    xres = convertOnBigEnd32(bmpih.biXPelsPerMeter);
+    yres = convertOnBigEnd32(bmpih.biYPelsPerMeter);
+
+        /* Everything except uncompressed rgb and rgba without a cmap
+         * is decoded by pixReadMemBmp(), which also reports any
+         * errors in the header. */
+    if (bftype != BMP_ID || compression != 0 ||
+        (depth != 24 && depth != 32) ||
+        (ihbytes != 40 && ihbytes != 108 && ihbytes != 124) ||
+        offset != BMP_FHBYTES + ihbytes) {
+        pix = pixReadMemBmp(mapdata, nbytes);
+        l_binaryUnmap(&mapdata, nbytes);
+        if (!pix)
+            return (PIX *)ERROR_PTR_1("pix not read", filename, __func__, NULL);
+        return pix;
+    }
+
+        /* The same sanity checks as in pixReadMemBmp() */
+    if (width < 1 || width > L_MAX_ALLOWED_WIDTH ||
+        height == 0 || height < -L_MAX_ALLOWED_HEIGHT ||
+        height > L_MAX_ALLOWED_HEIGHT ||
+        xres < 0 || xres > L_MAX_ALLOWED_RES ||
+        yres < 0 || yres > L_MAX_ALLOWED_RES) {
+        l_binaryUnmap(&mapdata, nbytes);
+        return (PIX *)ERROR_PTR_1("invalid header", filename, __func__, NULL);
+    }
+    height_neg = (height < 0) ? 1 : 0;
+    if (height_neg) height = -height;
+    npixels = 1LL * width * height;
+    fdatabpl = 4 * ((1LL * width * depth + 31) / 32);
+    if (npixels > L_MAX_ALLOWED_PIXELS ||
+        (imagebytes != 0 && imagebytes != fdatabpl * height)) {
+        l_binaryUnmap(&mapdata, nbytes);
+        return (PIX *)ERROR_PTR_1("invalid header", filename, __func__, NULL);
+    }
+    if (nbytes != offset + fdatabpl * height) {
+        l_binaryUnmap(&mapdata, nbytes);
+        return (PIX *)ERROR_PTR_1("size incommensurate with image data",
+                                  filename, __func__, NULL);
+    }
+
+    if ((pix = pixCreate(width, height, 32)) == NULL) {
+        l_binaryUnmap(&mapdata, nbytes);
+        return (PIX *)ERROR_PTR("pix not made", __func__, NULL);
+    }
+    pixSetXRes(pix, (l_int32)((l_float32)xres / 39.37 + 0.5));  /* to ppi */
+    pixSetYRes(pix, (l_int32)((l_float32)yres / 39.37 + 0.5));  /* to ppi */
+    pixSetInputFormat(pix, IFF_BMP);
+    pixSetSpp(pix, (depth == 24) ? 3 : 4);
+    filebpp = depth / 8;
+    data = pixGetData(pix);
+    wpl = pixGetWpl(pix);
+
+        /* Each band of rows is converted independently */
+    nbands = (height + BMP_BAND_HEIGHT - 1) / BMP_BAND_HEIGHT;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+        private(i, iend, srcrow) if (nthreads > 1)
+#endif  /* _OPENMP */
+    for (k = 0; k < nbands; k++) {
+        iend = L_MIN(height, (k + 1) * BMP_BAND_HEIGHT);
+        for (i = k * BMP_BAND_HEIGHT; i < iend; i++) {
+            srcrow = (height_neg) ? i : height - 1 - i;
+            bmpConvertRow(mapdata + offset + srcrow * fdatabpl,
+                          data + i * wpl, width, filebpp);
+        }
+    }
+
+    l_binaryUnmap(&mapdata, nbytes);
+    return pix;
+}
+
+
+/*!
+ * \brief   bmpConvertRow()
+ *
+ * \param[in]    src       start of the row in the bmp image data
+ * \param[in]    line      start of the row in the 32 bpp pix
+ * \param[in]    w         width of the pix
+ * \param[in]    filebpp   bytes/pixel in the file: 3 or 4
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) The file pixels are in bgr(a) byte order.  The words are
+ *          composed directly, so no endian swap is needed afterwards.
+ *      (2) Alpha is set opaque for rgb, as in pixReadMemBmp().
+ * </pre>
+ */
+static void
+bmpConvertRow(const l_uint8  *src,
+              l_uint32       *line,
+              l_int32         w,
+              l_int32         filebpp)
+{
+l_int32  j, aval;
+
+    for (j = 0; j < w; j++) {
+        aval = (filebpp == 3) ? 255 : src[3];
+        line[j] = ((l_uint32)src[2] << L_RED_SHIFT) |
+                  ((l_uint32)src[1] << L_GREEN_SHIFT) |
+                  ((l_uint32)src[0] << L_BLUE_SHIFT) |
+                  ((l_uint32)aval << L_ALPHA_SHIFT);
+        src += filebpp;
+    }
+}
+
+
 /*--------------------------------------------------------------*
  *                            Write bmp                         *
  *--------------------------------------------------------------*/
@@ -68,5 +68,12 @@ l_ok pixWriteMemBmp(l_uint8 **pdata, size_t *psize, PIX *pixs)
     return ERROR_INT("function not present", __func__, 1);
 }
 
+/* ----------------------------------------------------------------------*/
+
+PIX * pixReadBmpMapped(const char *filename, l_int32 nthreads)
+{
+    return (PIX *)ERROR_PTR("function not present", __func__, NULL);
+}
+
 /* --------------------------------------------*/
 #endif  /* !USE_BMPIO */
@@ -264,14 +264,22 @@ BOX     *box1;
  * \param[out]    pcontained    1 if every box in boxa2 is contained in
  *                              some box in boxa1; 0 otherwise
  * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) For each box in %boxa2, only the boxes in %boxa1 that
+ *          intersect it are tested, using a spatial index over %boxa1.
+ * </pre>
  */
 l_ok
 boxaContainedInBoxa(BOXA     *boxa1,
                     BOXA     *boxa2,
                     l_int32  *pcontained)
 {
-l_int32  i, j, n1, n2, cont, result;
-BOX     *box1, *box2;
+l_int32     i, j, k, n2, ncand, cont, result;
+BOX        *box1, *box2;
+L_BOXGRID  *grid;
+NUMA       *na;
 
     if (!pcontained)
         return ERROR_INT("&contained not defined", __func__, 1);
@@ -279,15 +287,18 @@ BOX     *box1, *box2;
     if (!boxa1 || !boxa2)
         return ERROR_INT("boxa1 and boxa2 not both defined", __func__, 1);
 
-    n1 = boxaGetCount(boxa1);
+    if ((grid = boxgridCreate(boxa1, 0, 0)) == NULL)
+        return ERROR_INT("grid not made", __func__, 1);
     n2 = boxaGetCount(boxa2);
     for (i = 0; i < n2; i++) {
         if ((box2 = boxaGetValidBox(boxa2, i, L_CLONE)) == NULL)
             continue;
         cont = 0;
-        for (j = 0; j < n1; j++) {
-            if ((box1 = boxaGetValidBox(boxa1, j, L_CLONE)) == NULL)
-                continue;
+        na = boxgridFindIntersecting(grid, box2);
+        ncand = numaGetCount(na);
+        for (k = 0; k < ncand; k++) {
+            numaGetIValue(na, k, &j);
+            box1 = boxaGetBox(boxa1, j, L_CLONE);
             boxContains(box1, box2, &result);
             boxDestroy(&box1);
             if (result) {
@@ -295,10 +306,15 @@ BOX     *box1, *box2;
                 break;
             }
         }
+        numaDestroy(&na);
         boxDestroy(&box2);
-        if (!cont) return 0;
+        if (!cont) {
+            boxgridDestroy(&grid);
+            return 0;
+        }
     }
 
+    boxgridDestroy(&grid);
     *pcontained = 1;
     return 0;
 }
@@ -457,20 +473,32 @@ BOXA    *boxad;
  *          This is still faster than painting each rectangle and finding
  *          the bounding boxes of the connected components, even for
  *          thousands of rectangles.
+ *      (5) Without debug output, this is done on packed box arrays with
+ *          pboxaCombineOverlaps(), which makes no boxes in the loop.
  * </pre>
  */
 BOXA *
 boxaCombineOverlaps(BOXA  *boxas,
                     PIXA  *pixadb)
 {
-l_int32  i, j, w, h, n1, n2, overlap, niters;
-BOX     *box1, *box2, *box3;
-BOXA    *boxa1, *boxa2;
-PIX     *pix1 = NULL;
+l_int32   i, j, w, h, n1, n2, overlap, niters;
+BOX      *box1, *box2, *box3;
+BOXA     *boxa1, *boxa2;
+L_PBOXA  *pba1, *pba2;
+PIX      *pix1 = NULL;
 
     if (!boxas)
         return (BOXA *)ERROR_PTR("boxas not defined", __func__, NULL);
 
+    if (!pixadb) {
+        pba1 = boxaConvertToPboxa(boxas);
+        pba2 = pboxaCombineOverlaps(pba1);
+        boxa1 = pboxaConvertToBoxa(pba2);
+        pboxaDestroy(&pba1);
+        pboxaDestroy(&pba2);
+        return boxa1;
+    }
+
     if (pixadb)
 		boxaGetExtent(boxas, &w, &h, NULL);
 
@@ -551,6 +579,8 @@ PIX     *pix1 = NULL;
  *      (4) This is useful if different operations are to be carried out
  *          on possibly overlapping rectangular regions, and it is desired
  *          to have only one operation on any rectangular region.
+ *      (5) Without debug output, this is done on packed box arrays with
+ *          pboxaCombineOverlapsInPair().
  * </pre>
  */
 l_ok
@@ -561,10 +591,11 @@ boxaCombineOverlapsInPair(BOXA   *boxas1,
                           PIXA   *pixadb)
 {
 l_int32  i, j, w, h, w2, h2, n1, n2, n1i, n2i, niters;
-l_int32  overlap, bigger, area1, area2;
-BOX     *box1, *box2, *box3;
-BOXA    *boxa1, *boxa2, *boxac1, *boxac2;
-PIX     *pix1;
+l_int32   overlap, bigger, area1, area2;
+BOX      *box1, *box2, *box3;
+BOXA     *boxa1, *boxa2, *boxac1, *boxac2;
+L_PBOXA  *pba1, *pba2, *pbad1, *pbad2;
+PIX      *pix1;
 
     if (pboxad1) *pboxad1 = NULL;
     if (pboxad2) *pboxad2 = NULL;
@@ -573,6 +604,24 @@ PIX     *pix1;
     if (!pboxad1 || !pboxad2)
         return ERROR_INT("&boxad1 and &boxad2 not both defined", __func__, 1);
 
+    if (!pixadb) {
+        pba1 = boxaConvertToPboxa(boxas1);
+        pba2 = boxaConvertToPboxa(boxas2);
+        pboxaCombineOverlapsInPair(pba1, pba2, &pbad1, &pbad2);
+        pboxaDestroy(&pba1);
+        pboxaDestroy(&pba2);
+        if (!pbad1 || !pbad2) {
+            pboxaDestroy(&pbad1);
+            pboxaDestroy(&pbad2);
+            return ERROR_INT("overlaps not combined", __func__, 1);
+        }
+        *pboxad1 = pboxaConvertToBoxa(pbad1);
+        *pboxad2 = pboxaConvertToBoxa(pbad2);
+        pboxaDestroy(&pbad1);
+        pboxaDestroy(&pbad2);
+        return 0;
+    }
+
     if (pixadb) {
         boxaGetExtent(boxas1, &w, &h, NULL);
         boxaGetExtent(boxas2, &w2, &h2, NULL);
@@ -883,6 +932,9 @@ BOX     *box;
  *          boxes that are not too different in size.  If %max_ratio == 0.0,
  *          no boxes can be removed; if %max_ratio == 1.0, this constraint
  *          is ignored.
+ *      (5) For a large range, the boxes that overlap each box are found
+ *          with a spatial index instead of testing every box in the range.
+ *          They are visited in the same order, so the result is the same.
  * </pre>
  */
 BOXA *
@@ -893,12 +945,13 @@ boxaHandleOverlaps(BOXA    *boxas,
                    l_float32  max_ratio,
                    NUMA   **pnamap)
 {
-l_int32    i, j, n, w, h, area1, area2, val;
-l_int32    overlap_area;
-l_float32  overlap_ratio, area_ratio;
-BOX       *box1, *box2, *box3;
-BOXA      *boxat, *boxad;
-NUMA      *namap;
+l_int32     i, j, k, n, w, h, area1, area2, val, ncand;
+l_int32     overlap_area;
+l_float32   overlap_ratio, area_ratio;
+BOX        *box1, *box2, *box3;
+BOXA       *boxat, *boxad;
+L_BOXGRID  *grid;
+NUMA       *namap, *na;
 
     if (pnamap) *pnamap = NULL;
     if (!boxas)
@@ -914,8 +967,14 @@ NUMA      *namap;
         return boxaCopy(boxas, L_COPY);
     }
 
-        /* Identify smaller boxes in overlap pairs, and mark to eliminate. */
+        /* Identify smaller boxes in overlap pairs, and mark to eliminate.
+         * With a large range, use a spatial index to find the boxes
+         * that overlap box i; they are in increasing order. */
     namap = numaMakeConstant(-1, n);
+    grid = NULL;
+    na = NULL;
+    if (L_MIN(range, n) > 32)
+        grid = boxgridCreate(boxas, 0, 0);
     for (i = 0; i < n; i++) {
         if ((box1 = boxaGetValidBox(boxas, i, L_CLONE)) == NULL)
             continue;
@@ -925,7 +984,21 @@ NUMA      *namap;
             boxDestroy(&box1);
             continue;
         }
-        for (j = i + 1; j < i + 1 + range && j < n; j++) {
+        if (grid) {
+            numaDestroy(&na);
+            na = boxgridFindIntersecting(grid, box1);
+            ncand = numaGetCount(na);
+        } else {
+            ncand = L_MIN(range, n - i - 1);
+        }
+        for (k = 0; k < ncand; k++) {
+            if (grid) {
+                numaGetIValue(na, k, &j);
+                if (j <= i) continue;
+                if (j >= i + 1 + range) break;
+            } else {
+                j = i + 1 + k;
+            }
             if ((box2 = boxaGetValidBox(boxas, j, L_CLONE)) == NULL)
                 continue;
             boxOverlapArea(box1, box2, &overlap_area);
@@ -954,6 +1027,8 @@ NUMA      *namap;
         }
         boxDestroy(&box1);
     }
+    numaDestroy(&na);
+    boxgridDestroy(&grid);
 
     boxat = boxaCopy(boxas, L_COPY);
     if (op == L_COMBINE) {
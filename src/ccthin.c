@@ -32,6 +32,10 @@
  *     PIX    *pixThinConnected()
  *     PIX    *pixThinConnectedBySet()
  *     SELA   *selaMakeThinSets()
+ *
+ *     Thinning with a lookup table
+ *        static l_int32  thinMakeLUT()
+ *        static l_int32  pixThinByLUT()
  * </pre>
  */
 
@@ -41,6 +45,9 @@
 
 #include "allheaders.h"
 
+static l_int32 thinMakeLUT(SELA *sela, l_uint8 **ptab);
+static l_int32 pixThinByLUT(PIX *pixd, l_uint8 *tab, l_int32 maxiters);
+
     /* ------------------------------------------------------------
      * The sels used here (and their rotated counterparts) are the
      * useful 3x3 Sels for thinning.   They are defined in sel2.c,
@@ -214,6 +221,11 @@ SELA  *sela;
  *          operate directly on the source (pixd) to produce the result
  *          (in this case, with four sequential thinning operations, one
  *          from each of four directions).
+ *      (4) When all the Sels are 3x3 with the origin at the center,
+ *          which is the case for all sets from selaMakeThinSets(),
+ *          the HMTs are replaced by a lookup table on the 8 neighbors
+ *          of each pixel, and only pixels near the boundary are
+ *          examined; see pixThinByLUT().  The result is identical.
  * </pre>
  */
 PIX *
@@ -222,11 +234,12 @@ pixThinConnectedBySet(PIX     *pixs,
                       SELA    *sela,
                       l_int32  maxiters)
 {
-l_int32  i, j, r, nsels, same;
-PIXA    *pixahmt;
-PIX    **pixhmt;  /* array owned by pixahmt; do not destroy! */
-PIX     *pix1, *pix2, *pixd;
-SEL     *sel, *selr;
+l_int32   i, j, r, nsels, same;
+l_uint8  *tab;
+PIXA     *pixahmt;
+PIX     **pixhmt;  /* array owned by pixahmt; do not destroy! */
+PIX      *pix1, *pix2, *pixd;
+SEL      *sel, *selr;
 
     if (!pixs)
         return (PIX *)ERROR_PTR("pixs not defined", __func__, NULL);
@@ -238,45 +251,57 @@ SEL     *sel, *selr;
         return (PIX *)ERROR_PTR("sela not defined", __func__, NULL);
     if (maxiters == 0) maxiters = 10000;
 
-        /* Set up array of temp pix to hold hmts */
-    nsels = selaGetCount(sela);
-    pixahmt = pixaCreate(nsels);
-    for (i = 0; i < nsels; i++) {
-        pix1 = pixCreateTemplate(pixs);
-        pixaAddPix(pixahmt, pix1, L_INSERT);
-    }
-    pixhmt = pixaGetPixArray(pixahmt);
-    if (!pixhmt) {
-        pixaDestroy(&pixahmt);
-        return (PIX *)ERROR_PTR("pixhmt array not made", __func__, NULL);
-    }
-
         /* Set up initial image for fg thinning */
     if (type == L_THIN_FG)
         pixd = pixCopy(NULL, pixs);
     else  /* bg thinning */
         pixd = pixInvert(NULL, pixs);
 
-        /* Thin the fg, with up to maxiters iterations */
-    for (i = 0; i < maxiters; i++) {
-        pix1 = pixCopy(NULL, pixd);  /* test for completion */
-        for (r = 0; r < 4; r++) {  /* over 90 degree rotations of Sels */
-            for (j = 0; j < nsels; j++) {  /* over individual sels in sela */
-                sel = selaGetSel(sela, j);  /* not a copy */
-                selr = selRotateOrth(sel, r);
-                pixHMT(pixhmt[j], pixd, selr);
-                selDestroy(&selr);
-                if (j > 0)
-                    pixOr(pixhmt[0], pixhmt[0], pixhmt[j]);  /* accum result */
-            }
-            pixSubtract(pixd, pixd, pixhmt[0]);  /* remove result */
+        /* For 3x3 Sels, use the lookup table on the boundary pixels */
+    if (thinMakeLUT(sela, &tab) == 0) {
+        if (pixThinByLUT(pixd, tab, maxiters)) {
+            LEPT_FREE(tab);
+            pixDestroy(&pixd);
+            return (PIX *)ERROR_PTR("thinning by LUT failed", __func__, NULL);
         }
-        pixEqual(pixd, pix1, &same);
-        pixDestroy(&pix1);
-        if (same) {
-/*            L_INFO("%d iterations to completion\n", __func__, i); */
-            break;
+        LEPT_FREE(tab);
+    } else {
+            /* Set up array of temp pix to hold hmts */
+        nsels = selaGetCount(sela);
+        pixahmt = pixaCreate(nsels);
+        for (i = 0; i < nsels; i++) {
+            pix1 = pixCreateTemplate(pixs);
+            pixaAddPix(pixahmt, pix1, L_INSERT);
+        }
+        pixhmt = pixaGetPixArray(pixahmt);
+        if (!pixhmt) {
+            pixaDestroy(&pixahmt);
+            pixDestroy(&pixd);
+            return (PIX *)ERROR_PTR("pixhmt array not made", __func__, NULL);
+        }
+
+            /* Thin the fg, with up to maxiters iterations */
+        for (i = 0; i < maxiters; i++) {
+            pix1 = pixCopy(NULL, pixd);  /* test for completion */
+            for (r = 0; r < 4; r++) {  /* over 90 degree rotations of Sels */
+                for (j = 0; j < nsels; j++) {  /* over individual sels */
+                    sel = selaGetSel(sela, j);  /* not a copy */
+                    selr = selRotateOrth(sel, r);
+                    pixHMT(pixhmt[j], pixd, selr);
+                    selDestroy(&selr);
+                    if (j > 0)  /* accum result */
+                        pixOr(pixhmt[0], pixhmt[0], pixhmt[j]);
+                }
+                pixSubtract(pixd, pixd, pixhmt[0]);  /* remove result */
+            }
+            pixEqual(pixd, pix1, &same);
+            pixDestroy(&pix1);
+            if (same) {
+/*                L_INFO("%d iterations to completion\n", __func__, i); */
+                break;
+            }
         }
+        pixaDestroy(&pixahmt);
     }
 
         /* This is a bit tricky. If we're thickening the foreground, then
@@ -301,7 +326,6 @@ SEL     *sel, *selr;
         pixDestroy(&pix2);
     }
 
-    pixaDestroy(&pixahmt);
     return pixd;
 }
 
@@ -466,3 +490,256 @@ SELA  *sela1, *sela2, *sela3;
     selaDestroy(&sela1);
     return sela2;
 }
+
+
+/*----------------------------------------------------------------*
+ *                 Thinning with a lookup table                   *
+ *----------------------------------------------------------------*/
+/*!
+ * \brief   thinMakeLUT()
+ *
+ * \param[in]    sela     of Sels for parallel composite HMTs
+ * \param[out]   ptab     table of 5 * 256 entries
+ * \return  0 if OK; 1 if the Sels can't be used in a table, or on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) All Sels must be 3x3 with the origin at the center.
+ *      (2) The index into each table is made from the 8 neighbors of
+ *          a pixel, with bit 7 for the UL neighbor, going in raster
+ *          order to bit 0 for the LR neighbor.  For rotation r of
+ *          the Sels, tab[256 * r + index] is 1 if any of the rotated
+ *          Sels matches an ON pixel with those neighbors.  The
+ *          last table, tab[1024 + index], is 1 if any of the first
+ *          four is 1.
+ *      (3) As in pixHMT(), pixels outside the image are OFF.
+ * </pre>
+ */
+static l_int32
+thinMakeLUT(SELA      *sela,
+            l_uint8  **ptab)
+{
+l_int32   i, j, k, n, r, index, sx, sy, cx, cy, bit, val, match;
+l_uint8  *tab;
+SEL      *sel, *selr;
+
+    *ptab = NULL;
+    n = selaGetCount(sela);
+    if (n == 0)
+        return 1;
+    for (k = 0; k < n; k++) {
+        sel = selaGetSel(sela, k);
+        selGetParameters(sel, &sy, &sx, &cy, &cx);
+        if (sx != 3 || sy != 3 || cx != 1 || cy != 1)
+            return 1;
+    }
+
+    if ((tab = (l_uint8 *)LEPT_CALLOC(5 * 256, sizeof(l_uint8))) == NULL)
+        return ERROR_INT("tab not made", __func__, 1);
+    for (r = 0; r < 4; r++) {
+        for (k = 0; k < n; k++) {
+            selr = selRotateOrth(selaGetSel(sela, k), r);
+            for (index = 0; index < 256; index++) {
+                match = TRUE;
+                bit = 7;
+                for (i = 0; i < 3 && match; i++) {
+                    for (j = 0; j < 3; j++) {
+                        if (i == 1 && j == 1) {
+                            val = 1;
+                        } else {
+                            val = (index >> bit) & 1;
+                            bit--;
+                        }
+                        if ((selr->data[i][j] == SEL_HIT && val == 0) ||
+                            (selr->data[i][j] == SEL_MISS && val == 1)) {
+                            match = FALSE;
+                            break;
+                        }
+                    }
+                }
+                if (match) {
+                    tab[256 * r + index] = 1;
+                    tab[1024 + index] = 1;
+                }
+            }
+            selDestroy(&selr);
+        }
+    }
+
+    *ptab = tab;
+    return 0;
+}
+
+
+    /* Index into the thinning table for the pixel at (x, y), from
+     * the lines above, at and below y */
+#define THIN_INDEX(la, l, lb, x) \
+    ((GET_DATA_BIT(la, (x) - 1) << 7) | (GET_DATA_BIT(la, x) << 6) | \
+     (GET_DATA_BIT(la, (x) + 1) << 5) | (GET_DATA_BIT(l, (x) - 1) << 4) | \
+     (GET_DATA_BIT(l, (x) + 1) << 3) | (GET_DATA_BIT(lb, (x) - 1) << 2) | \
+     (GET_DATA_BIT(lb, x) << 1) | GET_DATA_BIT(lb, (x) + 1))
+
+/*!
+ * \brief   pixThinByLUT()
+ *
+ * \param[in]    pixd       1 bpp; thinned in place
+ * \param[in]    tab        from thinMakeLUT()
+ * \param[in]    maxiters   max number of iterations; > 0
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This gives the same result as the iterated HMTs in
+ *          pixThinConnectedBySet().  Each iteration has four steps,
+ *          one for each rotation of the Sels.  In each step, the
+ *          pixels to be removed are all found before any is removed,
+ *          so the steps are parallel operations, as with the HMTs.
+ *      (2) A list is kept of the ON pixels whose neighbors match the
+ *          table for some rotation.  Only those pixels can be removed,
+ *          and only they are examined.  When a pixel is removed, its
+ *          ON neighbors are checked and added to the list.  Pixels deep
+ *          inside a component are not looked at until the boundary
+ *          reaches them, so the work is about proportional to the
+ *          number of pixels removed, rather than to iterations x area.
+ *      (3) The image is given a border of 1 OFF pixel, so that the
+ *          neighbors can be read without testing for the boundary.
+ *          A pixel is given by its offset y * wb + x in the bordered
+ *          image.
+ * </pre>
+ */
+static l_int32
+pixThinByLUT(PIX      *pixd,
+             l_uint8  *tab,
+             l_int32   maxiters)
+{
+l_int32    i, k, m, r, x, y, w, h, wb, hb, wpl, n, nnew, nrem, nalloc;
+l_int32    total, index, pos, q, ret;
+l_int32   *list, *rem;
+l_uint8   *inlist;
+l_uint32  *data, *line;
+PIX       *pixb;
+
+    pixGetDimensions(pixd, &w, &h, NULL);
+    if ((pixb = pixAddBorder(pixd, 1, 0)) == NULL)
+        return ERROR_INT("pixb not made", __func__, 1);
+    wb = w + 2;
+    hb = h + 2;
+    data = pixGetData(pixb);
+    wpl = pixGetWpl(pixb);
+
+        /* Start with the ON pixels that can be removed at some rotation */
+    ret = 0;
+    nalloc = 1024;
+    list = (l_int32 *)LEPT_CALLOC(nalloc, sizeof(l_int32));
+    inlist = (l_uint8 *)LEPT_CALLOC((size_t)wb * hb, sizeof(l_uint8));
+    rem = NULL;
+    if (!list || !inlist) {
+        ret = ERROR_INT("arrays not made", __func__, 1);
+        goto cleanup;
+    }
+    n = 0;
+    for (y = 1; y <= h; y++) {
+        line = data + (size_t)y * wpl;
+        for (x = 1; x <= w; x++) {
+            if (!GET_DATA_BIT(line, x)) continue;
+            index = THIN_INDEX(line - wpl, line, line + wpl, x);
+            if (!tab[1024 + index]) continue;
+            if (n >= nalloc) {
+                if ((list = (l_int32 *)reallocNew((void **)&list,
+                                sizeof(l_int32) * nalloc,
+                                2 * sizeof(l_int32) * nalloc)) == NULL) {
+                    ret = ERROR_INT("list not extended", __func__, 1);
+                    goto cleanup;
+                }
+                nalloc *= 2;
+            }
+            list[n++] = y * wb + x;
+            inlist[y * wb + x] = 1;
+        }
+    }
+    if ((rem = (l_int32 *)LEPT_CALLOC(nalloc, sizeof(l_int32))) == NULL) {
+        ret = ERROR_INT("rem not made", __func__, 1);
+        goto cleanup;
+    }
+
+    for (i = 0; i < maxiters; i++) {
+        total = 0;
+        for (r = 0; r < 4; r++) {
+                /* Find the pixels to remove, before removing any */
+            nrem = 0;
+            for (k = 0; k < n; k++) {
+                y = list[k] / wb;
+                x = list[k] - y * wb;
+                line = data + (size_t)y * wpl;
+                index = THIN_INDEX(line - wpl, line, line + wpl, x);
+                if (tab[256 * r + index])
+                    rem[nrem++] = list[k];
+            }
+            if (nrem == 0) continue;
+            total += nrem;
+            for (k = 0; k < nrem; k++) {
+                y = rem[k] / wb;
+                x = rem[k] - y * wb;
+                CLEAR_DATA_BIT(data + (size_t)y * wpl, x);
+            }
+
+                /* Keep the pixels that can still be removed */
+            nnew = 0;
+            for (k = 0; k < n; k++) {
+                pos = list[k];
+                y = pos / wb;
+                x = pos - y * wb;
+                line = data + (size_t)y * wpl;
+                if (GET_DATA_BIT(line, x) &&
+                    tab[1024 + THIN_INDEX(line - wpl, line, line + wpl, x)])
+                    list[nnew++] = pos;
+                else
+                    inlist[pos] = 0;
+            }
+            n = nnew;
+
+                /* Add the neighbors of removed pixels that can now
+                 * be removed */
+            for (k = 0; k < nrem; k++) {
+                for (m = 0; m < 9; m++) {
+                    if (m == 4) continue;
+                    q = rem[k] + (m / 3 - 1) * wb + (m % 3 - 1);
+                    if (inlist[q]) continue;
+                    y = q / wb;
+                    x = q - y * wb;
+                    if (y < 1 || y > h || x < 1 || x > w) continue;
+                    line = data + (size_t)y * wpl;
+                    if (!GET_DATA_BIT(line, x)) continue;
+                    index = THIN_INDEX(line - wpl, line, line + wpl, x);
+                    if (!tab[1024 + index]) continue;
+                    if (n >= nalloc) {
+                        list = (l_int32 *)reallocNew((void **)&list,
+                                   sizeof(l_int32) * nalloc,
+                                   2 * sizeof(l_int32) * nalloc);
+                        rem = (l_int32 *)reallocNew((void **)&rem,
+                                   sizeof(l_int32) * nalloc,
+                                   2 * sizeof(l_int32) * nalloc);
+                        if (!list || !rem) {
+                            ret = ERROR_INT("lists not extended", __func__, 1);
+                            goto cleanup;
+                        }
+                        nalloc *= 2;
+                    }
+                    list[n++] = q;
+                    inlist[q] = 1;
+                }
+            }
+        }
+        if (total == 0)
+            break;
+    }
+
+    pixRasterop(pixd, 0, 0, w, h, PIX_SRC, pixb, 1, 1);
+
+cleanup:
+    pixDestroy(&pixb);
+    LEPT_FREE(list);
+    LEPT_FREE(rem);
+    LEPT_FREE(inlist);
+    return ret;
+}
@@ -68,6 +68,11 @@
  *          PIX          *pixConvolveRGB()
  *          PIX          *pixConvolveRGBSep()
  *
+ *      Fixed-point generic convolution for 8 bpp
+ *          static PIX   *pixConvolveFixed8()
+ *          static PIX   *pixConvolveSepFixed8()
+ *          static l_int32  kernelQuantizeLow()
+ *
  *      Generic convolution (with float arrays)
  *          FPIX         *fpixConvolve()
  *          FPIX         *fpixConvolveSep()
@@ -75,8 +80,18 @@
  *      Convolution with bias (for non-negative output)
  *          PIX          *pixConvolveWithBias()
  *
- *      Set parameter for convolution subsampling
+ *      Recursive (IIR) gaussian smoothing
+ *          PIX          *pixGaussianBlur()
+ *          FPIX         *fpixGaussianBlur()
+ *          static void   gaussRecursiveCoeffs()
+ *          static l_float64  gaussRecursiveVariance()
+ *          static l_int32  gaussRecursiveLow()
+ *          static void   transposeFloatLow()
+ *
+ *      Set parameters for generic convolution
  *          void          l_setConvolveSampling()
+ *          void          l_setConvolveFFTThreshold()
+ *          void          l_setConvolveFixedPoint()
  *
  *      Additive gaussian noise
  *          PIX          *pixAddGaussNoise()
@@ -89,6 +104,7 @@
 #endif  /* HAVE_CONFIG_H */
 
 #include <math.h>
+#include <string.h>
 #include "allheaders.h"
 
     /* These globals determine the subsampling factors for
@@ -97,6 +113,18 @@
 LEPT_DLL l_int32  ConvolveSamplingFactX = 1;
 LEPT_DLL l_int32  ConvolveSamplingFactY = 1;
 
+    /* If > 0, generic convolution of pix and fpix without subsampling
+     * uses the FFT (see fftconv.c) if the number of kernel elements is
+     * at least this value.  The default of 0 always uses direct
+     * convolution.  To change the value, use l_setConvolveFFTThreshold(). */
+LEPT_DLL l_int32  ConvolveFFTThreshold = 0;
+
+    /* Generic convolution of 8 bpp pix without subsampling is done
+     * in fixed point if this is 1.  It is off by default, because the
+     * results can differ from the float path by 1.  To change the value,
+     * use l_setConvolveFixedPoint(). */
+LEPT_DLL l_int32  ConvolveFixedPoint = 0;
+
     /* Low-level static functions */
 static void blockconvLow(l_uint32 *data, l_int32 w, l_int32 h, l_int32 wpl,
                          l_uint32 *dataa, l_int32 wpla, l_int32 wc,
@@ -106,6 +134,33 @@ static void blockconvAccumLow(l_uint32 *datad, l_int32 w, l_int32 h,
                               l_int32 wpls);
 static void blocksumLow(l_uint32 *datad, l_int32 w, l_int32 h, l_int32 wpl,
                         l_uint32 *dataa, l_int32 wpla, l_int32 wc, l_int32 hc);
+static void gaussRecursiveCoeffs(l_float32 sigma, l_float32 *coeffs);
+static l_float64 gaussRecursiveVariance(l_float64 q);
+static l_int32 gaussRecursiveLow(l_float32 *data, l_int32 w, l_int32 h,
+                                 l_int32 wpl, l_float32 *coeffs);
+static void transposeFloatLow(l_float32 *datad, l_int32 wpld,
+                              l_float32 *datas, l_int32 wpls,
+                              l_int32 ws, l_int32 hs);
+static PIX *pixConvolveFixed8(PIX *pixs, L_KERNEL *keli, l_int32 outdepth,
+                              l_int32 normflag);
+static PIX *pixConvolveSepFixed8(PIX *pixs, L_KERNEL *kelx, L_KERNEL *kely,
+                                 l_int32 outdepth, l_int32 normflag);
+static l_int32 kernelQuantizeLow(L_KERNEL *kel, l_int32 normflag,
+                                 l_float32 maxin, l_int32 intexact,
+                                 l_int32 **pqk, l_int32 *pdiv);
+
+    /* Poles of the recursive gaussian, for q = 1, and block size for
+     * the transpose of the float array */
+static const l_float64  GaussPoleReal = 1.40098;
+static const l_float64  GaussPoleImag = 1.00236;
+static const l_float64  GaussPole3 = 1.85132;
+static const l_int32  TransposeBlockSize = 32;
+
+    /* Largest power of 2 for quantizing kernels in fixed-point
+     * convolution, and number of fractional bits kept between the
+     * two passes of the separable fixed-point convolution */
+static const l_int32  FixedMaxShift = 24;
+static const l_int32  SepFixedFractBits = 12;
 
 
 /*----------------------------------------------------------------------*
@@ -1080,8 +1135,11 @@ PIX  *pixb, *pixm, *pixms;
  *      (3) Typically, %normflag == 1.  However, if you want the sum
  *          within the window, rather than a normalized convolution,
  *          use %normflag == 0.
- *      (4) This builds a block accumulator pix, uses it here, and
- *          destroys it.
+ *      (4) For the normalized mean of an 8 bpp pix, this makes an
+ *          integral image and calls integralWindowedMean(), which gives
+ *          the same result and runs in parallel with OpenMP.  Otherwise
+ *          it builds a block accumulator pix.  Either is destroyed
+ *          before returning.
  *      (5) The added border, along with the use of an accumulator array,
  *          allows computation without special treatment of pixels near
  *          the image boundary, and runs in a time that is independent
@@ -1095,11 +1153,12 @@ pixWindowedMean(PIX     *pixs,
                 l_int32  hasborder,
                 l_int32  normflag)
 {
-l_int32    i, j, w, h, d, wd, hd, wplc, wpld, wincr, hincr;
-l_uint32   val;
-l_uint32  *datac, *datad, *linec1, *linec2, *lined;
-l_float32  norm;
-PIX       *pixb, *pixc, *pixd;
+l_int32      i, j, w, h, d, wd, hd, wplc, wpld, wincr, hincr;
+l_uint32     val;
+l_uint32    *datac, *datad, *linec1, *linec2, *lined;
+l_float32    norm;
+L_INTEGRAL  *ii;
+PIX         *pixb, *pixc, *pixd;
 
     if (!pixs)
         return (PIX *)ERROR_PTR("pixs not defined", __func__, NULL);
@@ -1117,6 +1176,17 @@ PIX       *pixb, *pixc, *pixd;
     else
         pixb = pixClone(pixs);
 
+        /* Use an integral image for the normalized mean of 8 bpp */
+    if (d == 8 && normflag && !pixGetColormap(pixb)) {
+        if ((ii = integralCreate(pixb, 0)) == NULL) {
+            L_ERROR("ii not made\n", __func__);
+            goto cleanup;
+        }
+        pixd = integralWindowedMean(ii, wc, hc, 1);
+        integralDestroy(&ii);
+        goto cleanup;
+    }
+
         /* Make the accumulator pix from pixb */
     if ((pixc = pixBlockconvAccum(pixb)) == NULL) {
         L_ERROR("pixc not made\n", __func__);
@@ -1876,6 +1946,30 @@ PIX       *pixav, *pixd;
  *          each pixel-op in the convolution.  For example, with a 3 GHz
  *          cpu, a 1 Mpixel grayscale image, and a kernel with
  *          (sx * sy) = 25 elements, the convolution takes about 100 msec.
+ *      (9) If l_setConvolveFFTThreshold() has been called with a
+ *          size > 0, kernels with at least that many elements are
+ *          convolved without subsampling by pixConvolveFFT(), for which
+ *          the time per pixel grows only as the log of the kernel size.
+ *          Unlike the direct convolution, results that are too large
+ *          for %outdepth are clipped, and they can differ by rounding.
+ *     (10) If l_setConvolveFixedPoint(1) has been called, the convolution
+ *          of 8 bpp input without subsampling is done in fixed point,
+ *          which is several times faster.  If the kernel values are
+ *          integers, as is typical for kernels made with
+ *          kernelCreateFromString(), the sums are exact.  Without
+ *          normalization, the result is then the same as from the float
+ *          path, for sums below 2^24 that fit in %outdepth.  With
+ *          normalization, it is the correctly rounded quotient, from
+ *          which the float path can differ by 1.  Otherwise
+ *          the kernel is quantized to a multiple of 2^-s, and for a
+ *          kernel with n elements, the error in each sum before
+ *          rounding is at most 255 * n * 2^-(s+1).  For a normalized,
+ *          non-negative kernel s = 22, so the error is less than
+ *          3.1e-5 * n; e.g., 0.0008 for a 5x5 and 0.007 for a 15x15
+ *          kernel.  Results can then differ from the float path by 1,
+ *          only for sums that are within that error of a rounding
+ *          boundary.  Results that are too large for %outdepth are
+ *          clipped.
  * </pre>
  */
 PIX *
@@ -1901,6 +1995,20 @@ PIX       *pixt, *pixd;
     if (!kel)
         return (PIX *)ERROR_PTR("kel not defined", __func__, NULL);
 
+    kernelGetParameters(kel, &sy, &sx, NULL, NULL);
+    if (ConvolveFFTThreshold > 0 && sx * sy >= ConvolveFFTThreshold &&
+        ConvolveSamplingFactX == 1 && ConvolveSamplingFactY == 1)
+        return pixConvolveFFT(pixs, kel, outdepth, normflag);
+
+    if (d == 8 && ConvolveFixedPoint &&
+        ConvolveSamplingFactX == 1 && ConvolveSamplingFactY == 1 &&
+        (outdepth == 8 || outdepth == 16 || outdepth == 32)) {
+        keli = kernelInvert(kel);
+        pixd = pixConvolveFixed8(pixs, keli, outdepth, normflag);
+        kernelDestroy(&keli);
+        if (pixd) return pixd;
+    }
+
     pixd = NULL;
 
     keli = kernelInvert(kel);
@@ -2004,6 +2112,13 @@ cleanup:
  *          convolution.
  *      (6) This uses mirrored borders to avoid special casing on
  *          the boundaries.
+ *      (7) If l_setConvolveFixedPoint(1) has been called, the convolution
+ *          of 8 bpp input without subsampling is done in fixed point.
+ *          The intermediate result is kept to 1/4096
+ *          rather than being rounded to an integer, and the error
+ *          in each sum before the final rounding is less than 0.002 for
+ *          normalized non-negative kernels with up to 31 elements in
+ *          each direction.  See notes in pixConvolve().
  * </pre>
  */
 PIX *
@@ -2029,6 +2144,13 @@ PIX       *pixt, *pixd;
 
     xfact = ConvolveSamplingFactX;
     yfact = ConvolveSamplingFactY;
+    if (d == 8 && ConvolveFixedPoint && xfact == 1 && yfact == 1 &&
+        (outdepth == 8 || outdepth == 16 || outdepth == 32)) {
+        if ((pixd = pixConvolveSepFixed8(pixs, kelx, kely, outdepth,
+                                         normflag)) != NULL)
+            return pixd;
+    }
+
     if (normflag) {
         kelxn = kernelNormalize(kelx, 1000.0f);
         kelyn = kernelNormalize(kely, 0.001f);
@@ -2165,6 +2287,425 @@ PIX  *pixt, *pixr, *pixg, *pixb, *pixd;
 }
 
 
+/*----------------------------------------------------------------------*
+ *               Fixed-point generic convolution for 8 bpp              *
+ *----------------------------------------------------------------------*/
+/*!
+ * \brief   pixConvolveFixed8()
+ *
+ * \param[in]    pixs       8 bpp; no colormap
+ * \param[in]    keli       inverted kernel
+ * \param[in]    outdepth   of pixd: 8, 16 or 32
+ * \param[in]    normflag   1 to normalize kernel to unit sum; 0 otherwise
+ * \return  pixd, or NULL if the kernel can't be quantized or on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is the fixed-point version of pixConvolve(), without
+ *          subsampling.  The kernel is quantized by kernelQuantizeLow(),
+ *          and the sums are accumulated in 32-bit integers, one output
+ *          raster line at a time, so the inner loops vectorize.
+ *      (2) The %sy input lines needed for each output line are kept
+ *          unpacked in a ring buffer of bytes.
+ *      (3) 3x3 and 5x5 kernels have specialized inner loops.
+ *      (4) As with pixConvolve(), the absolute value is taken.  Results
+ *          that are too large for %outdepth are clipped.
+ * </pre>
+ */
+static PIX *
+pixConvolveFixed8(PIX       *pixs,
+                  L_KERNEL  *keli,
+                  l_int32    outdepth,
+                  l_int32    normflag)
+{
+l_int32    i, j, k, m, w, h, wt, sx, sy, cx, cy, wplt, wpld, div, shift;
+l_int32    half, val, maxval, q;
+l_int32   *qk, *acc;
+l_uint8   *ring, *r0, *r1, *r2, *r3, *r4;
+l_uint8   *rows[5];
+l_uint32  *datat, *datad, *linet, *lined;
+PIX       *pixt, *pixd;
+
+    kernelGetParameters(keli, &sy, &sx, &cy, &cx);
+    if (kernelQuantizeLow(keli, normflag, 255.0, 1, &qk, &div))
+        return NULL;
+
+    pixd = NULL;
+    ring = NULL;
+    acc = NULL;
+    pixGetDimensions(pixs, &w, &h, NULL);
+    if ((pixt = pixAddMirroredBorder(pixs, cx, sx - cx, cy, sy - cy)) == NULL) {
+        L_ERROR("pixt not made\n", __func__);
+        goto cleanup;
+    }
+    wt = pixGetWidth(pixt);
+    ring = (l_uint8 *)LEPT_CALLOC((size_t)sy * wt, sizeof(l_uint8));
+    acc = (l_int32 *)LEPT_CALLOC(w, sizeof(l_int32));
+    if (!ring || !acc) {
+        L_ERROR("buffers not made\n", __func__);
+        goto cleanup;
+    }
+    if ((pixd = pixCreate(w, h, outdepth)) == NULL) {
+        L_ERROR("pixd not made\n", __func__);
+        goto cleanup;
+    }
+
+    for (shift = 0; (1 << shift) < div; shift++) ;
+    if ((1 << shift) != div) shift = -1;  /* use division */
+    half = div / 2;
+    if (outdepth == 8)
+        maxval = 0xff;
+    else if (outdepth == 16)
+        maxval = 0xffff;
+    else  /* outdepth == 32 */
+        maxval = 0x7fffffff;
+
+    datat = pixGetData(pixt);
+    wplt = pixGetWpl(pixt);
+    datad = pixGetData(pixd);
+    wpld = pixGetWpl(pixd);
+    for (i = 0; i < sy - 1; i++) {
+        linet = datat + (size_t)i * wplt;
+        for (j = 0, r0 = ring + (size_t)i * wt; j < wt; j++)
+            r0[j] = GET_DATA_BYTE(linet, j);
+    }
+    for (i = 0; i < h; i++) {
+            /* Unpack the newest line into the ring */
+        k = (i + sy - 1) % sy;
+        linet = datat + (size_t)(i + sy - 1) * wplt;
+        for (j = 0, r0 = ring + (size_t)k * wt; j < wt; j++)
+            r0[j] = GET_DATA_BYTE(linet, j);
+
+        if (sx == 3 && sy == 3) {
+            r0 = ring + (size_t)(i % 3) * wt;
+            r1 = ring + (size_t)((i + 1) % 3) * wt;
+            r2 = ring + (size_t)((i + 2) % 3) * wt;
+            for (j = 0; j < w; j++) {
+                acc[j] = qk[0] * r0[j] + qk[1] * r0[j + 1] +
+                         qk[2] * r0[j + 2] + qk[3] * r1[j] +
+                         qk[4] * r1[j + 1] + qk[5] * r1[j + 2] +
+                         qk[6] * r2[j] + qk[7] * r2[j + 1] +
+                         qk[8] * r2[j + 2];
+            }
+        } else if (sx == 5 && sy == 5) {
+            for (k = 0; k < 5; k++)
+                rows[k] = ring + (size_t)((i + k) % 5) * wt;
+            r0 = rows[0];
+            r1 = rows[1];
+            r2 = rows[2];
+            r3 = rows[3];
+            r4 = rows[4];
+            for (j = 0; j < w; j++) {
+                acc[j] = qk[0] * r0[j] + qk[1] * r0[j + 1] +
+                         qk[2] * r0[j + 2] + qk[3] * r0[j + 3] +
+                         qk[4] * r0[j + 4] + qk[5] * r1[j] +
+                         qk[6] * r1[j + 1] + qk[7] * r1[j + 2] +
+                         qk[8] * r1[j + 3] + qk[9] * r1[j + 4] +
+                         qk[10] * r2[j] + qk[11] * r2[j + 1] +
+                         qk[12] * r2[j + 2] + qk[13] * r2[j + 3] +
+                         qk[14] * r2[j + 4] + qk[15] * r3[j] +
+                         qk[16] * r3[j + 1] + qk[17] * r3[j + 2] +
+                         qk[18] * r3[j + 3] + qk[19] * r3[j + 4] +
+                         qk[20] * r4[j] + qk[21] * r4[j + 1] +
+                         qk[22] * r4[j + 2] + qk[23] * r4[j + 3] +
+                         qk[24] * r4[j + 4];
+            }
+        } else {
+            memset(acc, 0, w * sizeof(l_int32));
+            for (k = 0; k < sy; k++) {
+                r0 = ring + (size_t)((i + k) % sy) * wt;
+                for (m = 0; m < sx; m++) {
+                    if ((q = qk[k * sx + m]) == 0) continue;
+                    for (j = 0, r1 = r0 + m; j < w; j++)
+                        acc[j] += q * r1[j];
+                }
+            }
+        }
+
+            /* Scale, round and clip */
+        lined = datad + (size_t)i * wpld;
+        for (j = 0; j < w; j++) {
+            val = L_ABS(acc[j]);
+            if (shift >= 0)
+                val = (val + half) >> shift;
+            else
+                val = (val + half) / div;
+            val = L_MIN(val, maxval);
+            if (outdepth == 8)
+                SET_DATA_BYTE(lined, j, val);
+            else if (outdepth == 16)
+                SET_DATA_TWO_BYTES(lined, j, val);
+            else  /* outdepth == 32 */
+                lined[j] = (l_uint32)val;
+        }
+    }
+
+cleanup:
+    LEPT_FREE(qk);
+    LEPT_FREE(ring);
+    LEPT_FREE(acc);
+    pixDestroy(&pixt);
+    return pixd;
+}
+
+
+/*!
+ * \brief   pixConvolveSepFixed8()
+ *
+ * \param[in]    pixs       8 bpp; no colormap
+ * \param[in]    kelx       x-dependent kernel; a single row
+ * \param[in]    kely       y-dependent kernel; a single column
+ * \param[in]    outdepth   of pixd: 8, 16 or 32
+ * \param[in]    normflag   1 to normalize kernels to unit sum; 0 otherwise
+ * \return  pixd, or NULL if the kernels can't be quantized or on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is the fixed-point version of pixConvolveSep(), without
+ *          subsampling.  The horizontal pass is accumulated in 32 bits
+ *          and kept with SepFixedFractBits fractional bits, rather than
+ *          being rounded to an integer.  The vertical pass is
+ *          accumulated in 64 bits.
+ *      (2) As with pixConvolveSep(), the absolute value is taken after
+ *          each pass.  Results that are too large for %outdepth are
+ *          clipped.
+ *      (3) Only the %sy horizontally convolved lines needed for each
+ *          output line are kept, in a ring buffer.
+ * </pre>
+ */
+static PIX *
+pixConvolveSepFixed8(PIX       *pixs,
+                     L_KERNEL  *kelx,
+                     L_KERNEL  *kely,
+                     l_int32    outdepth,
+                     l_int32    normflag)
+{
+l_int32    i, j, k, m, w, h, wt, sx, sy, cx, cy, ny, nx, wplt, wpld;
+l_int32    divx, divy, shiftx, shifty, fbits, shift, val, maxval, q;
+l_int32   *qx, *qy, *ring, *racc, *r;
+l_int64    half, sum;
+l_int64   *acc;
+l_uint8   *row;
+l_uint32  *datat, *datad, *linet, *lined;
+L_KERNEL  *kelxi, *kelyi;
+PIX       *pixt, *pixd;
+
+    kernelGetParameters(kelx, &ny, &sx, NULL, NULL);
+    kernelGetParameters(kely, &sy, &nx, NULL, NULL);
+    if (ny != 1 || nx != 1)
+        return NULL;
+
+    pixd = NULL;
+    pixt = NULL;
+    qx = qy = ring = racc = NULL;
+    acc = NULL;
+    row = NULL;
+    kelxi = kernelInvert(kelx);
+    kelyi = kernelInvert(kely);
+    if (!kelxi || !kelyi)
+        goto cleanup;
+    kernelGetParameters(kelxi, NULL, NULL, NULL, &cx);
+    kernelGetParameters(kelyi, NULL, NULL, &cy, NULL);
+    if (kernelQuantizeLow(kelxi, normflag, 255.0, 0, &qx, &divx))
+        goto cleanup;
+    for (shiftx = 0; (1 << shiftx) < divx; shiftx++) ;
+    fbits = L_MIN(SepFixedFractBits, shiftx);
+    for (j = 0, val = 0; j < sx; j++)
+        val += L_ABS(qx[j]);
+    if (kernelQuantizeLow(kelyi, normflag,
+                          255.0 * (l_float32)val / (l_float32)divx,
+                          0, &qy, &divy))
+        goto cleanup;
+    for (shifty = 0; (1 << shifty) < divy; shifty++) ;
+
+    pixGetDimensions(pixs, &w, &h, NULL);
+    if ((pixt = pixAddMirroredBorder(pixs, cx, sx - cx, cy, sy - cy)) == NULL) {
+        L_ERROR("pixt not made\n", __func__);
+        goto cleanup;
+    }
+    wt = pixGetWidth(pixt);
+    row = (l_uint8 *)LEPT_CALLOC(wt, sizeof(l_uint8));
+    ring = (l_int32 *)LEPT_CALLOC((size_t)sy * w, sizeof(l_int32));
+    racc = (l_int32 *)LEPT_CALLOC(w, sizeof(l_int32));
+    acc = (l_int64 *)LEPT_CALLOC(w, sizeof(l_int64));
+    if (!row || !ring || !racc || !acc) {
+        L_ERROR("buffers not made\n", __func__);
+        goto cleanup;
+    }
+    if ((pixd = pixCreate(w, h, outdepth)) == NULL) {
+        L_ERROR("pixd not made\n", __func__);
+        goto cleanup;
+    }
+
+    if (outdepth == 8)
+        maxval = 0xff;
+    else if (outdepth == 16)
+        maxval = 0xffff;
+    else  /* outdepth == 32 */
+        maxval = 0x7fffffff;
+    shift = shifty + fbits;
+    half = (shift > 0) ? (l_int64)1 << (shift - 1) : 0;
+
+    datat = pixGetData(pixt);
+    wplt = pixGetWpl(pixt);
+    datad = pixGetData(pixd);
+    wpld = pixGetWpl(pixd);
+    for (i = 0; i < h + sy - 1; i++) {
+            /* Horizontal pass on line i, into the ring */
+        linet = datat + (size_t)i * wplt;
+        for (j = 0; j < wt; j++)
+            row[j] = GET_DATA_BYTE(linet, j);
+        memset(racc, 0, w * sizeof(l_int32));
+        for (m = 0; m < sx; m++) {
+            if ((q = qx[m]) == 0) continue;
+            for (j = 0; j < w; j++)
+                racc[j] += q * row[j + m];
+        }
+        r = ring + (size_t)(i % sy) * w;
+        k = shiftx - fbits;
+        for (j = 0; j < w; j++) {
+            val = L_ABS(racc[j]);
+            r[j] = (k > 0) ? (val + (1 << (k - 1))) >> k : val;
+        }
+        if (i < sy - 1) continue;
+
+            /* Vertical pass for output line i - sy + 1 */
+        memset(acc, 0, w * sizeof(l_int64));
+        for (k = 0; k < sy; k++) {
+            if ((q = qy[k]) == 0) continue;
+            r = ring + (size_t)((i + 1 + k) % sy) * w;
+            for (j = 0; j < w; j++)
+                acc[j] += (l_int64)q * r[j];
+        }
+        lined = datad + (size_t)(i - sy + 1) * wpld;
+        for (j = 0; j < w; j++) {
+            sum = acc[j];
+            if (sum < 0) sum = -sum;
+            sum = (sum + half) >> shift;
+            val = (l_int32)L_MIN(sum, maxval);
+            if (outdepth == 8)
+                SET_DATA_BYTE(lined, j, val);
+            else if (outdepth == 16)
+                SET_DATA_TWO_BYTES(lined, j, val);
+            else  /* outdepth == 32 */
+                lined[j] = (l_uint32)val;
+        }
+    }
+
+cleanup:
+    kernelDestroy(&kelxi);
+    kernelDestroy(&kelyi);
+    LEPT_FREE(qx);
+    LEPT_FREE(qy);
+    LEPT_FREE(row);
+    LEPT_FREE(ring);
+    LEPT_FREE(racc);
+    LEPT_FREE(acc);
+    pixDestroy(&pixt);
+    return pixd;
+}
+
+
+/*!
+ * \brief   kernelQuantizeLow()
+ *
+ * \param[in]    kel        kernel
+ * \param[in]    normflag   1 to normalize kernel to unit sum; 0 otherwise
+ * \param[in]    maxin      maximum absolute value of the input samples
+ * \param[in]    intexact   1 to allow an integer kernel to be used
+ *                          with a divisor that is not a power of 2
+ * \param[out]   pqk        quantized kernel values, in raster order
+ * \param[out]   pdiv       divisor for the quantized kernel
+ * \return  0 if OK, 1 if the kernel can't be quantized
+ *
+ * <pre>
+ * Notes:
+ *      (1) On return, the (normalized) kernel is approximated by
+ *          %qk / %div.  The values are chosen so that a sum of
+ *          input values with absolute value up to %maxin, weighted
+ *          by %qk, can not overflow a 32-bit signed integer.
+ *      (2) If %intexact is set and the kernel values are all integers,
+ *          %qk are the kernel values, and %div is their sum if the
+ *          kernel is to be normalized, or 1 if not.  This is exact.
+ *      (3) Otherwise %div = 2^s, where s is the largest integer not
+ *          exceeding FixedMaxShift with
+ *              %maxin * Sum|k| * 2^s < 2^30
+ *          Each quantized value is within 2^-(s+1) of the kernel
+ *          value, so the weighted sum differs from the exact value by
+ *          at most  %maxin * n * 2^-(s+1)  for a kernel with n elements.
+ *      (4) This fails if the kernel sum is too close to 0 to normalize,
+ *          or if the kernel values are too large to quantize.
+ *          The caller then uses floating point.
+ * </pre>
+ */
+static l_int32
+kernelQuantizeLow(L_KERNEL   *kel,
+                  l_int32     normflag,
+                  l_float32   maxin,
+                  l_int32     intexact,
+                  l_int32   **pqk,
+                  l_int32    *pdiv)
+{
+l_int32    i, j, sx, sy, isint, shift;
+l_int32   *qk;
+l_float64  val, sum, abssum, factor, limit;
+
+    *pqk = NULL;
+    *pdiv = 1;
+    kernelGetParameters(kel, &sy, &sx, NULL, NULL);
+    sum = abssum = 0.0;
+    isint = intexact;
+    for (i = 0; i < sy; i++) {
+        for (j = 0; j < sx; j++) {
+            val = kel->data[i][j];
+            sum += val;
+            abssum += L_ABS(val);
+            if (isint && (L_ABS(val) > 65536.0 || val != floor(val)))
+                isint = FALSE;
+        }
+    }
+    if (abssum == 0.0 || (normflag && L_ABS(sum) < 0.00001))
+        return 1;
+    limit = 1073741824.0;  /* 2^30 */
+
+    if ((qk = (l_int32 *)LEPT_CALLOC((size_t)sx * sy, sizeof(l_int32)))
+        == NULL)
+        return ERROR_INT("qk not made", __func__, 1);
+
+        /* Integer kernel; no quantization */
+    if (isint && (!normflag || sum > 0.0) && maxin * abssum < limit) {
+        for (i = 0; i < sy; i++) {
+            for (j = 0; j < sx; j++)
+                qk[i * sx + j] = (l_int32)kel->data[i][j];
+        }
+        *pqk = qk;
+        *pdiv = (normflag) ? (l_int32)sum : 1;
+        return 0;
+    }
+
+        /* Quantize to 2^-shift */
+    factor = (normflag) ? 1.0 / sum : 1.0;
+    abssum *= L_ABS(factor);
+    for (shift = 0; shift < FixedMaxShift; shift++) {
+        if (maxin * abssum * (l_float64)(1 << (shift + 1)) >= limit)
+            break;
+    }
+    if (maxin * abssum * (l_float64)(1 << shift) >= limit) {
+        LEPT_FREE(qk);
+        return 1;
+    }
+    for (i = 0; i < sy; i++) {
+        for (j = 0; j < sx; j++) {
+            val = factor * kel->data[i][j] * (l_float64)(1 << shift);
+            qk[i * sx + j] = (l_int32)floor(val + 0.5);
+        }
+    }
+    *pqk = qk;
+    *pdiv = 1 << shift;
+    return 0;
+}
+
+
 /*----------------------------------------------------------------------*
  *                  Generic convolution with float array                *
  *----------------------------------------------------------------------*/
@@ -2191,6 +2732,8 @@ PIX  *pixt, *pixr, *pixg, *pixb, *pixd;
  *          product of the sampling factors.
  *      (5) This uses a mirrored border to avoid special casing on
  *          the boundaries.
+ *      (6) If enabled with l_setConvolveFFTThreshold(), large kernels
+ *          without subsampling are convolved with fpixConvolveFFT().
  * </pre>
  */
 FPIX *
@@ -2210,6 +2753,11 @@ FPIX       *fpixt, *fpixd;
     if (!kel)
         return (FPIX *)ERROR_PTR("kel not defined", __func__, NULL);
 
+    kernelGetParameters(kel, &sy, &sx, NULL, NULL);
+    if (ConvolveFFTThreshold > 0 && sx * sy >= ConvolveFFTThreshold &&
+        ConvolveSamplingFactX == 1 && ConvolveSamplingFactY == 1)
+        return fpixConvolveFFT(fpixs, kel, normflag);
+
     fpixd = NULL;
 
     keli = kernelInvert(kel);
@@ -2434,7 +2982,407 @@ PIX       *pixd;
 
 
 /*------------------------------------------------------------------------*
- *                Set parameter for convolution subsampling               *
+ *                  Recursive (IIR) gaussian smoothing                    *
+ *------------------------------------------------------------------------*/
+/*!
+ * \brief   pixGaussianBlur()
+ *
+ * \param[in]    pixs       8 bpp gray or 32 bpp rgb; colormap OK
+ * \param[in]    sigmax     standard deviation of gaussian in x; >= 0.0
+ * \param[in]    sigmay     standard deviation of gaussian in y; >= 0.0
+ * \return  pixd  8 or 32 bpp, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This smooths with a separable gaussian, using the
+ *          Young-van Vliet recursive (IIR) approximation.  The cost
+ *          per pixel is constant, independent of %sigmax and %sigmay,
+ *          so for large sigma it is much faster than pixConvolveSep()
+ *          with kernels from makeGaussianKernelSep().
+ *      (2) A colormap is removed.  For 32 bpp, each of the rgb
+ *          components is smoothed separately.
+ *      (3) See fpixGaussianBlur() for details.
+ * </pre>
+ */
+PIX *
+pixGaussianBlur(PIX       *pixs,
+                l_float32  sigmax,
+                l_float32  sigmay)
+{
+l_int32  d;
+FPIX    *fpixt, *fpixd;
+PIX     *pixt, *pixd, *pixr, *pixrc, *pixg, *pixgc, *pixb, *pixbc;
+
+    if (!pixs)
+        return (PIX *)ERROR_PTR("pixs not defined", __func__, NULL);
+    if (sigmax < 0.0 || sigmay < 0.0)
+        return (PIX *)ERROR_PTR("sigmax and sigmay not both >= 0",
+                                __func__, NULL);
+
+    if (pixGetColormap(pixs))
+        pixt = pixRemoveColormap(pixs, REMOVE_CMAP_BASED_ON_SRC);
+    else
+        pixt = pixClone(pixs);
+    d = pixGetDepth(pixt);
+    if (d != 8 && d != 32) {
+        pixDestroy(&pixt);
+        return (PIX *)ERROR_PTR("depth not 8 or 32 bpp", __func__, NULL);
+    }
+
+    if (d == 8) {
+        fpixt = pixConvertToFPix(pixt, 1);
+        fpixd = fpixGaussianBlur(fpixt, sigmax, sigmay);
+        pixd = fpixConvertToPix(fpixd, 8, L_CLIP_TO_ZERO, 0);
+        fpixDestroy(&fpixt);
+        fpixDestroy(&fpixd);
+    } else {  /* d == 32 */
+        pixr = pixGetRGBComponent(pixt, COLOR_RED);
+        pixrc = pixGaussianBlur(pixr, sigmax, sigmay);
+        pixDestroy(&pixr);
+        pixg = pixGetRGBComponent(pixt, COLOR_GREEN);
+        pixgc = pixGaussianBlur(pixg, sigmax, sigmay);
+        pixDestroy(&pixg);
+        pixb = pixGetRGBComponent(pixt, COLOR_BLUE);
+        pixbc = pixGaussianBlur(pixb, sigmax, sigmay);
+        pixDestroy(&pixb);
+        pixd = pixCreateRGBImage(pixrc, pixgc, pixbc);
+        pixDestroy(&pixrc);
+        pixDestroy(&pixgc);
+        pixDestroy(&pixbc);
+    }
+
+    pixDestroy(&pixt);
+    if (pixd) pixCopyResolution(pixd, pixs);
+    return pixd;
+}
+
+
+/*!
+ * \brief   fpixGaussianBlur()
+ *
+ * \param[in]    fpixs      32 bit float array
+ * \param[in]    sigmax     standard deviation of gaussian in x; >= 0.0
+ * \param[in]    sigmay     standard deviation of gaussian in y; >= 0.0
+ * \return  fpixd, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This smooths with a separable gaussian, using the third order
+ *          recursive filter of Young and van Vliet, applied causally and
+ *          anti-causally in each direction.  The number of operations
+ *          per pixel does not depend on the sigma values.
+ *      (2) The approximation is valid for sigma >= 0.5.  Smaller values
+ *          of sigma give no smoothing in that direction.  A direction
+ *          with fewer than 4 pixels is also not smoothed.
+ *      (3) Boundary pixels are treated as if replicated to infinity.
+ *          The initial conditions for the anti-causal pass use the
+ *          method of Triggs and Sdika, so there are no transients
+ *          at either end.  Because fpixConvolveSep() uses a mirrored
+ *          border, the results differ within about 3 sigma of the edge.
+ *      (4) The y pass runs down the columns, with the inner loop
+ *          over a full raster line so that it vectorizes.  For the
+ *          x pass the array is transposed in blocks, smoothed the
+ *          same way, and transposed back.
+ *      (5) For sigma >= 2, the impulse response differs from a sampled
+ *          gaussian by less than 2% of its peak value, and the
+ *          variance is exact.  The error is largest near sigma = 0.5.
+ * </pre>
+ */
+FPIX *
+fpixGaussianBlur(FPIX      *fpixs,
+                 l_float32  sigmax,
+                 l_float32  sigmay)
+{
+l_int32     w, h;
+l_float32   coeffs[13];
+l_float32  *datad, *datat;
+FPIX       *fpixd;
+
+    if (!fpixs)
+        return (FPIX *)ERROR_PTR("fpixs not defined", __func__, NULL);
+    if (sigmax < 0.0 || sigmay < 0.0)
+        return (FPIX *)ERROR_PTR("sigmax and sigmay not both >= 0",
+                                 __func__, NULL);
+
+    if ((fpixd = fpixCopy(fpixs)) == NULL)
+        return (FPIX *)ERROR_PTR("fpixd not made", __func__, NULL);
+    fpixGetDimensions(fpixd, &w, &h);
+    datad = fpixGetData(fpixd);
+
+        /* Smooth in y, down the columns */
+    if (sigmay >= 0.5 && h >= 4) {
+        gaussRecursiveCoeffs(sigmay, coeffs);
+        if (gaussRecursiveLow(datad, w, h, w, coeffs)) {
+            fpixDestroy(&fpixd);
+            return (FPIX *)ERROR_PTR("y smoothing failed", __func__, NULL);
+        }
+    }
+
+        /* Smooth in x, by transposing, smoothing in y and transposing back */
+    if (sigmax >= 0.5 && w >= 4) {
+        if ((datat = (l_float32 *)LEPT_CALLOC((size_t)w * h,
+                                              sizeof(l_float32))) == NULL) {
+            fpixDestroy(&fpixd);
+            return (FPIX *)ERROR_PTR("datat not made", __func__, NULL);
+        }
+        gaussRecursiveCoeffs(sigmax, coeffs);
+        transposeFloatLow(datat, h, datad, w, w, h);
+        if (gaussRecursiveLow(datat, h, w, h, coeffs)) {
+            LEPT_FREE(datat);
+            fpixDestroy(&fpixd);
+            return (FPIX *)ERROR_PTR("x smoothing failed", __func__, NULL);
+        }
+        transposeFloatLow(datad, w, datat, h, h, w);
+        LEPT_FREE(datat);
+    }
+
+    return fpixd;
+}
+
+
+/*!
+ * \brief   gaussRecursiveCoeffs()
+ *
+ * \param[in]    sigma     standard deviation; >= 0.5
+ * \param[out]   coeffs    array of 13 coefficients: B, a1, a2, a3,
+ *                         followed by the 3x3 matrix M (row-major)
+ *                         for the Triggs-Sdika right boundary condition
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) With these coefficients, the causal pass is
+ *              w[n] = B * x[n] + a1 * w[n-1] + a2 * w[n-2] + a3 * w[n-3]
+ *          and the anti-causal pass is
+ *              y[n] = B * w[n] + a1 * y[n+1] + a2 * y[n+2] + a3 * y[n+3]
+ *          Because B = 1 - (a1 + a2 + a3), the filter has unit dc gain.
+ *      (2) The poles are those of L.J. van Vliet, I.T. Young and
+ *          P.W. Verbeek, "Recursive Gaussian derivative filters",
+ *          ICPR 1998, scaled by the exponent 1/q.  Rather than use the
+ *          approximate formula for q in the earlier Young-van Vliet
+ *          paper, which gives about 10% too much smoothing, q is found
+ *          by Newton's method so that the variance of the impulse
+ *          response of both passes is exactly sigma^2.
+ *      (3) The boundary matrix is from B. Triggs and M. Sdika, "Boundary
+ *          conditions for Young-van Vliet recursive filtering", IEEE
+ *          Trans. Signal Processing 54 (2006) 2365-2367.  Because both
+ *          passes here include the gain B, the matrix is scaled by B.
+ * </pre>
+ */
+static void
+gaussRecursiveCoeffs(l_float32   sigma,
+                     l_float32  *coeffs)
+{
+l_int32    i;
+l_float64  q, dq, var, vard, rq, dr, d3, p, a1, a2, a3, bgain, scale;
+
+        /* Solve var(q) = sigma^2, with the derivative found numerically */
+    q = sigma / 2.0;
+    for (i = 0; i < 20; i++) {
+        var = gaussRecursiveVariance(q);
+        dq = 1.0e-6 * q;
+        vard = (gaussRecursiveVariance(q + dq) - var) / dq;
+        dq = (var - sigma * sigma) / vard;
+        q -= dq;
+        if (L_ABS(dq) < 1.0e-8 * q)
+            break;
+    }
+
+        /* The complex pair is rq * exp(+-i * theta / q); the real pole is d3 */
+    rq = pow(GaussPoleReal * GaussPoleReal + GaussPoleImag * GaussPoleImag,
+             0.5 / q);
+    dr = rq * cos(atan2(GaussPoleImag, GaussPoleReal) / q);
+    d3 = pow(GaussPole3, 1.0 / q);
+    p = rq * rq * d3;
+    a1 = (rq * rq + 2.0 * dr * d3) / p;
+    a2 = -(2.0 * dr + d3) / p;
+    a3 = 1.0 / p;
+    bgain = 1.0 - (a1 + a2 + a3);
+
+    scale = bgain / ((1.0 + a1 - a2 + a3) * (1.0 - a1 - a2 - a3) *
+                     (1.0 + a2 + (a1 - a3) * a3));
+    coeffs[0] = bgain;
+    coeffs[1] = a1;
+    coeffs[2] = a2;
+    coeffs[3] = a3;
+    coeffs[4] = scale * (-a3 * a1 + 1.0 - a3 * a3 - a2);
+    coeffs[5] = scale * (a3 + a1) * (a2 + a3 * a1);
+    coeffs[6] = scale * a3 * (a1 + a3 * a2);
+    coeffs[7] = scale * (a1 + a3 * a2);
+    coeffs[8] = -scale * (a2 - 1.0) * (a2 + a3 * a1);
+    coeffs[9] = -scale * a3 * (a3 * a1 + a3 * a3 + a2 - 1.0);
+    coeffs[10] = scale * (a3 * a1 + a2 + a1 * a1 - a2 * a2);
+    coeffs[11] = scale * (a1 * a2 + a3 * a2 * a2 - a1 * a3 * a3 -
+                          a3 * a3 * a3 - a3 * a2 + a3);
+    coeffs[12] = scale * a3 * (a1 + a3 * a2);
+}
+
+
+/*!
+ * \brief   gaussRecursiveVariance()
+ *
+ * \param[in]    q     pole scaling exponent
+ * \return  variance of the impulse response of the causal and
+ *          anti-causal passes, with poles scaled by 1/q
+ *
+ * <pre>
+ * Notes:
+ *      (1) For each pole d, the contribution is 2d / (d - 1)^2.
+ *          The complex conjugate pair contributes twice the real
+ *          part of the term for one of them.
+ * </pre>
+ */
+static l_float64
+gaussRecursiveVariance(l_float64  q)
+{
+l_float64  rq, theta, dr, di, cr, ci, d3;
+
+    rq = pow(GaussPoleReal * GaussPoleReal + GaussPoleImag * GaussPoleImag,
+             0.5 / q);
+    theta = atan2(GaussPoleImag, GaussPoleReal) / q;
+    dr = rq * cos(theta);
+    di = rq * sin(theta);
+    cr = (dr - 1.0) * (dr - 1.0) - di * di;  /* (d - 1)^2 */
+    ci = 2.0 * (dr - 1.0) * di;
+    d3 = pow(GaussPole3, 1.0 / q);
+    return 4.0 * (dr * cr + di * ci) / (cr * cr + ci * ci) +
+           2.0 * d3 / ((d3 - 1.0) * (d3 - 1.0));
+}
+
+
+/*!
+ * \brief   gaussRecursiveLow()
+ *
+ * \param[in]    data      float array, smoothed in place
+ * \param[in]    w, h      dimensions; h >= 4
+ * \param[in]    wpl       stride in floats
+ * \param[in]    coeffs    from gaussRecursiveCoeffs()
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This smooths each column of the array with the causal pass
+ *          (top to bottom) followed by the anti-causal pass (bottom
+ *          to top).  The inner loops run along raster lines, so all
+ *          columns are processed together.
+ *      (2) Above the first line, the input is taken to be constant,
+ *          which is the steady state of the causal filter.
+ * </pre>
+ */
+static l_int32
+gaussRecursiveLow(l_float32  *data,
+                  l_int32     w,
+                  l_int32     h,
+                  l_int32     wpl,
+                  l_float32  *coeffs)
+{
+l_int32     i, j;
+l_float32   b, a1, a2, a3, u, d0, d1, d2;
+l_float32  *buf, *bufu, *buf1, *buf2, *line, *p1, *p2, *p3;
+l_float32  *m;
+
+    if ((buf = (l_float32 *)LEPT_CALLOC(3 * (size_t)w,
+                                        sizeof(l_float32))) == NULL)
+        return ERROR_INT("buf not made", __func__, 1);
+    bufu = buf;
+    buf1 = buf + w;
+    buf2 = buf + 2 * w;
+    b = coeffs[0];
+    a1 = coeffs[1];
+    a2 = coeffs[2];
+    a3 = coeffs[3];
+    m = coeffs + 4;
+
+        /* Save the last input line for the right boundary condition,
+         * and the first input line for the causal initial condition */
+    memcpy(bufu, data + (size_t)(h - 1) * wpl, w * sizeof(l_float32));
+    memcpy(buf1, data, w * sizeof(l_float32));
+
+        /* Causal pass */
+    for (i = 0; i < h; i++) {
+        line = data + (size_t)i * wpl;
+        p1 = (i >= 1) ? line - wpl : buf1;
+        p2 = (i >= 2) ? line - 2 * wpl : buf1;
+        p3 = (i >= 3) ? line - 3 * wpl : buf1;
+        for (j = 0; j < w; j++)
+            line[j] = b * line[j] + a1 * p1[j] + a2 * p2[j] + a3 * p3[j];
+    }
+
+        /* Triggs-Sdika initial conditions for the anti-causal pass:
+         * the last line is set in place, and buf1 and buf2 hold the
+         * virtual lines at h and h + 1 */
+    line = data + (size_t)(h - 1) * wpl;
+    p1 = line - wpl;
+    p2 = line - 2 * wpl;
+    for (j = 0; j < w; j++) {
+        u = bufu[j];
+        d0 = line[j] - u;
+        d1 = p1[j] - u;
+        d2 = p2[j] - u;
+        line[j] = m[0] * d0 + m[1] * d1 + m[2] * d2 + u;
+        buf1[j] = m[3] * d0 + m[4] * d1 + m[5] * d2 + u;
+        buf2[j] = m[6] * d0 + m[7] * d1 + m[8] * d2 + u;
+    }
+
+        /* Anti-causal pass */
+    for (i = h - 2; i >= 0; i--) {
+        line = data + (size_t)i * wpl;
+        p1 = line + wpl;
+        p2 = (i + 2 < h) ? line + 2 * wpl : buf1;
+        if (i + 3 < h)
+            p3 = line + 3 * wpl;
+        else
+            p3 = (i + 3 == h) ? buf1 : buf2;
+        for (j = 0; j < w; j++)
+            line[j] = b * line[j] + a1 * p1[j] + a2 * p2[j] + a3 * p3[j];
+    }
+
+    LEPT_FREE(buf);
+    return 0;
+}
+
+
+/*!
+ * \brief   transposeFloatLow()
+ *
+ * \param[in]    datad     dest float array, of size ws x hs transposed
+ * \param[in]    wpld      stride of dest, in floats
+ * \param[in]    datas     src float array
+ * \param[in]    wpls      stride of src, in floats
+ * \param[in]    ws, hs    dimensions of src
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) The transpose is done in square blocks so that both
+ *          the reads and the writes stay in cache.
+ * </pre>
+ */
+static void
+transposeFloatLow(l_float32  *datad,
+                  l_int32     wpld,
+                  l_float32  *datas,
+                  l_int32     wpls,
+                  l_int32     ws,
+                  l_int32     hs)
+{
+l_int32  i, j, ib, jb, imax, jmax;
+
+    for (ib = 0; ib < hs; ib += TransposeBlockSize) {
+        imax = L_MIN(ib + TransposeBlockSize, hs);
+        for (jb = 0; jb < ws; jb += TransposeBlockSize) {
+            jmax = L_MIN(jb + TransposeBlockSize, ws);
+            for (i = ib; i < imax; i++) {
+                for (j = jb; j < jmax; j++)
+                    datad[(size_t)j * wpld + i] = datas[(size_t)i * wpls + j];
+            }
+        }
+    }
+}
+
+
+/*------------------------------------------------------------------------*
+ *                Set parameters for generic convolution                  *
  *------------------------------------------------------------------------*/
 /*!
  * \brief   l_setConvolveSampling()
@@ -2460,6 +3408,55 @@ l_setConvolveSampling(l_int32  xfact,
 }
 
 
+/*!
+ * \brief   l_setConvolveFFTThreshold()
+ *
+ * \param[in]    size     minimum number of kernel elements for which
+ *                        the FFT is used; 0 to never use the FFT
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) This sets the kernel size (sx * sy) above which pixConvolve()
+ *          and fpixConvolve() use the FFT, when there is no subsampling.
+ *          The default value is 0, so the FFT is not used.
+ *      (2) The FFT is faster for kernels as small as about 7 x 7, but
+ *          its results can differ from direct convolution by rounding,
+ *          and pixConvolve() clips instead of wrapping values that are
+ *          too large for the output depth.  A value of 256 (a 16 x 16
+ *          kernel) uses it only where the speedup is large.
+ * </pre>
+ */
+void
+l_setConvolveFFTThreshold(l_int32  size)
+{
+    if (size < 0) size = 0;
+    ConvolveFFTThreshold = size;
+}
+
+
+/*!
+ * \brief   l_setConvolveFixedPoint()
+ *
+ * \param[in]    flag     1 to use fixed point for 8 bpp; 0 for float
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) This determines whether pixConvolve() and pixConvolveSep()
+ *          use fixed-point arithmetic for 8 bpp input without
+ *          subsampling.  The default is 0, so that the results are
+ *          those of the float path.  See pixConvolve() for the
+ *          worst-case error relative to floating point.
+ * </pre>
+ */
+void
+l_setConvolveFixedPoint(l_int32  flag)
+{
+    ConvolveFixedPoint = (flag) ? 1 : 0;
+}
+
+
 /*------------------------------------------------------------------------*
  *                          Additive gaussian noise                       *
  *------------------------------------------------------------------------*/
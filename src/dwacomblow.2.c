@@ -41,6 +41,27 @@
 
 #include "allheaders.h"
 
+    /* Two adjacent words, with the first in the upper half, and the
+     * same shifted left or right by n < 32 bits */
+#define  DWA_WORD64(p)  ((((l_uint64)*(p)) << 32) | *((p) + 1))
+#define  DWA_SHL64(p, n)  ((DWA_WORD64(p) << (n)) | \
+                           (DWA_WORD64((p) + 1) >> (32 - (n))))
+#define  DWA_SHR64(p, n)  ((DWA_WORD64(p) >> (n)) | \
+                           (DWA_WORD64((p) - 1) << (32 - (n))))
+
+#if L_HAVE_AVX2
+#include <immintrin.h>
+
+    /* Eight adjacent words, and the same shifted left or right by n bits */
+#define  DWA_WORD256(p)  _mm256_loadu_si256((const __m256i *)(p))
+#define  DWA_SHL256(p, n)  \
+         _mm256_or_si256(_mm256_slli_epi32(DWA_WORD256(p), (n)), \
+                         _mm256_srli_epi32(DWA_WORD256((p) + 1), 32 - (n)))
+#define  DWA_SHR256(p, n)  \
+         _mm256_or_si256(_mm256_srli_epi32(DWA_WORD256(p), (n)), \
+                         _mm256_slli_epi32(DWA_WORD256((p) - 1), 32 - (n)))
+#endif  /* L_HAVE_AVX2 */
+
 static void  fdilate_2_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
 static void  ferode_2_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
 static void  fdilate_2_1(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
@@ -193,6 +214,312 @@ static void  fdilate_2_74(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_i
 static void  ferode_2_74(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
 static void  fdilate_2_75(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
 static void  ferode_2_75(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_1(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_1(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_2(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_2(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_3(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_3(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_4(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_4(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_5(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_5(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_6(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_6(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_7(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_7(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_8(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_8(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_9(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_9(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_10(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_10(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_11(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_11(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_12(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_12(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_13(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_13(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_14(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_14(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_15(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_15(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_16(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_16(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_17(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_17(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_18(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_18(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_19(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_19(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_20(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_20(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_21(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_21(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_22(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_22(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_23(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_23(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_24(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_24(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_25(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_25(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_26(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_26(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_27(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_27(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_28(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_28(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_29(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_29(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_30(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_30(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_31(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_31(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_32(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_32(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_33(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_33(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_34(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_34(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_35(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_35(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_36(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_36(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_37(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_37(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_38(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_38(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_39(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_39(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_40(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_40(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_41(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_41(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_42(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_42(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_43(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_43(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_44(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_44(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_45(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_45(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_46(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_46(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_47(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_47(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_48(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_48(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_49(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_49(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_50(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_50(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_51(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_51(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_52(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_52(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_53(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_53(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_54(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_54(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_55(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_55(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_56(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_56(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_57(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_57(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_58(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_58(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_59(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_59(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_60(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_60(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_61(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_61(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_62(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_62(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_63(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_63(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_64(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_64(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_65(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_65(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_66(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_66(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_67(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_67(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_68(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_68(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_69(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_69(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_70(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_70(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_71(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_71(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_72(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_72(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_73(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_73(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_74(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_74(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_2_75(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_2_75(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+#if L_HAVE_AVX2
+static void  L_TARGET_AVX2 fdilate256_2_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_1(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_1(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_2(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_2(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_3(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_3(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_4(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_4(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_5(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_5(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_6(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_6(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_7(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_7(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_8(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_8(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_9(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_9(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_10(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_10(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_11(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_11(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_12(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_12(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_13(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_13(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_14(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_14(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_15(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_15(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_16(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_16(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_17(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_17(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_18(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_18(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_19(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_19(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_20(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_20(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_21(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_21(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_22(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_22(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_23(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_23(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_24(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_24(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_25(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_25(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_26(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_26(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_27(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_27(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_28(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_28(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_29(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_29(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_30(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_30(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_31(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_31(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_32(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_32(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_33(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_33(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_34(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_34(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_35(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_35(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_36(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_36(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_37(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_37(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_38(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_38(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_39(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_39(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_40(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_40(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_41(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_41(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_42(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_42(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_43(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_43(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_44(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_44(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_45(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_45(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_46(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_46(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_47(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_47(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_48(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_48(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_49(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_49(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_50(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_50(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_51(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_51(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_52(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_52(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_53(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_53(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_54(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_54(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_55(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_55(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_56(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_56(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_57(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_57(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_58(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_58(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_59(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_59(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_60(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_60(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_61(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_61(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_62(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_62(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_63(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_63(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_64(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_64(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_65(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_65(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_66(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_66(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_67(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_67(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_68(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_68(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_69(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_69(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_70(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_70(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_71(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_71(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_72(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_72(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_73(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_73(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_74(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_74(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_2_75(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_2_75(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+#endif  /* L_HAVE_AVX2 */
 
 
 /*---------------------------------------------------------------------*
@@ -212,6 +539,935 @@ fmorphopgen_low_2(l_uint32  *datad,
                   l_int32    wpls,
                   l_int32    index)
 {
+l_int32  width;
+
+    width = l_getDwaWordWidth();
+#if L_HAVE_AVX2
+    if (width == 256) {
+        switch (index)
+        {
+        case 0:
+            fdilate256_2_0(datad, w, h, wpld, datas, wpls);
+            break;
+        case 1:
+            ferode256_2_0(datad, w, h, wpld, datas, wpls);
+            break;
+        case 2:
+            fdilate256_2_1(datad, w, h, wpld, datas, wpls);
+            break;
+        case 3:
+            ferode256_2_1(datad, w, h, wpld, datas, wpls);
+            break;
+        case 4:
+            fdilate256_2_2(datad, w, h, wpld, datas, wpls);
+            break;
+        case 5:
+            ferode256_2_2(datad, w, h, wpld, datas, wpls);
+            break;
+        case 6:
+            fdilate256_2_3(datad, w, h, wpld, datas, wpls);
+            break;
+        case 7:
+            ferode256_2_3(datad, w, h, wpld, datas, wpls);
+            break;
+        case 8:
+            fdilate256_2_4(datad, w, h, wpld, datas, wpls);
+            break;
+        case 9:
+            ferode256_2_4(datad, w, h, wpld, datas, wpls);
+            break;
+        case 10:
+            fdilate256_2_5(datad, w, h, wpld, datas, wpls);
+            break;
+        case 11:
+            ferode256_2_5(datad, w, h, wpld, datas, wpls);
+            break;
+        case 12:
+            fdilate256_2_6(datad, w, h, wpld, datas, wpls);
+            break;
+        case 13:
+            ferode256_2_6(datad, w, h, wpld, datas, wpls);
+            break;
+        case 14:
+            fdilate256_2_7(datad, w, h, wpld, datas, wpls);
+            break;
+        case 15:
+            ferode256_2_7(datad, w, h, wpld, datas, wpls);
+            break;
+        case 16:
+            fdilate256_2_8(datad, w, h, wpld, datas, wpls);
+            break;
+        case 17:
+            ferode256_2_8(datad, w, h, wpld, datas, wpls);
+            break;
+        case 18:
+            fdilate256_2_9(datad, w, h, wpld, datas, wpls);
+            break;
+        case 19:
+            ferode256_2_9(datad, w, h, wpld, datas, wpls);
+            break;
+        case 20:
+            fdilate256_2_10(datad, w, h, wpld, datas, wpls);
+            break;
+        case 21:
+            ferode256_2_10(datad, w, h, wpld, datas, wpls);
+            break;
+        case 22:
+            fdilate256_2_11(datad, w, h, wpld, datas, wpls);
+            break;
+        case 23:
+            ferode256_2_11(datad, w, h, wpld, datas, wpls);
+            break;
+        case 24:
+            fdilate256_2_12(datad, w, h, wpld, datas, wpls);
+            break;
+        case 25:
+            ferode256_2_12(datad, w, h, wpld, datas, wpls);
+            break;
+        case 26:
+            fdilate256_2_13(datad, w, h, wpld, datas, wpls);
+            break;
+        case 27:
+            ferode256_2_13(datad, w, h, wpld, datas, wpls);
+            break;
+        case 28:
+            fdilate256_2_14(datad, w, h, wpld, datas, wpls);
+            break;
+        case 29:
+            ferode256_2_14(datad, w, h, wpld, datas, wpls);
+            break;
+        case 30:
+            fdilate256_2_15(datad, w, h, wpld, datas, wpls);
+            break;
+        case 31:
+            ferode256_2_15(datad, w, h, wpld, datas, wpls);
+            break;
+        case 32:
+            fdilate256_2_16(datad, w, h, wpld, datas, wpls);
+            break;
+        case 33:
+            ferode256_2_16(datad, w, h, wpld, datas, wpls);
+            break;
+        case 34:
+            fdilate256_2_17(datad, w, h, wpld, datas, wpls);
+            break;
+        case 35:
+            ferode256_2_17(datad, w, h, wpld, datas, wpls);
+            break;
+        case 36:
+            fdilate256_2_18(datad, w, h, wpld, datas, wpls);
+            break;
+        case 37:
+            ferode256_2_18(datad, w, h, wpld, datas, wpls);
+            break;
+        case 38:
+            fdilate256_2_19(datad, w, h, wpld, datas, wpls);
+            break;
+        case 39:
+            ferode256_2_19(datad, w, h, wpld, datas, wpls);
+            break;
+        case 40:
+            fdilate256_2_20(datad, w, h, wpld, datas, wpls);
+            break;
+        case 41:
+            ferode256_2_20(datad, w, h, wpld, datas, wpls);
+            break;
+        case 42:
+            fdilate256_2_21(datad, w, h, wpld, datas, wpls);
+            break;
+        case 43:
+            ferode256_2_21(datad, w, h, wpld, datas, wpls);
+            break;
+        case 44:
+            fdilate256_2_22(datad, w, h, wpld, datas, wpls);
+            break;
+        case 45:
+            ferode256_2_22(datad, w, h, wpld, datas, wpls);
+            break;
+        case 46:
+            fdilate256_2_23(datad, w, h, wpld, datas, wpls);
+            break;
+        case 47:
+            ferode256_2_23(datad, w, h, wpld, datas, wpls);
+            break;
+        case 48:
+            fdilate256_2_24(datad, w, h, wpld, datas, wpls);
+            break;
+        case 49:
+            ferode256_2_24(datad, w, h, wpld, datas, wpls);
+            break;
+        case 50:
+            fdilate256_2_25(datad, w, h, wpld, datas, wpls);
+            break;
+        case 51:
+            ferode256_2_25(datad, w, h, wpld, datas, wpls);
+            break;
+        case 52:
+            fdilate256_2_26(datad, w, h, wpld, datas, wpls);
+            break;
+        case 53:
+            ferode256_2_26(datad, w, h, wpld, datas, wpls);
+            break;
+        case 54:
+            fdilate256_2_27(datad, w, h, wpld, datas, wpls);
+            break;
+        case 55:
+            ferode256_2_27(datad, w, h, wpld, datas, wpls);
+            break;
+        case 56:
+            fdilate256_2_28(datad, w, h, wpld, datas, wpls);
+            break;
+        case 57:
+            ferode256_2_28(datad, w, h, wpld, datas, wpls);
+            break;
+        case 58:
+            fdilate256_2_29(datad, w, h, wpld, datas, wpls);
+            break;
+        case 59:
+            ferode256_2_29(datad, w, h, wpld, datas, wpls);
+            break;
+        case 60:
+            fdilate256_2_30(datad, w, h, wpld, datas, wpls);
+            break;
+        case 61:
+            ferode256_2_30(datad, w, h, wpld, datas, wpls);
+            break;
+        case 62:
+            fdilate256_2_31(datad, w, h, wpld, datas, wpls);
+            break;
+        case 63:
+            ferode256_2_31(datad, w, h, wpld, datas, wpls);
+            break;
+        case 64:
+            fdilate256_2_32(datad, w, h, wpld, datas, wpls);
+            break;
+        case 65:
+            ferode256_2_32(datad, w, h, wpld, datas, wpls);
+            break;
+        case 66:
+            fdilate256_2_33(datad, w, h, wpld, datas, wpls);
+            break;
+        case 67:
+            ferode256_2_33(datad, w, h, wpld, datas, wpls);
+            break;
+        case 68:
+            fdilate256_2_34(datad, w, h, wpld, datas, wpls);
+            break;
+        case 69:
+            ferode256_2_34(datad, w, h, wpld, datas, wpls);
+            break;
+        case 70:
+            fdilate256_2_35(datad, w, h, wpld, datas, wpls);
+            break;
+        case 71:
+            ferode256_2_35(datad, w, h, wpld, datas, wpls);
+            break;
+        case 72:
+            fdilate256_2_36(datad, w, h, wpld, datas, wpls);
+            break;
+        case 73:
+            ferode256_2_36(datad, w, h, wpld, datas, wpls);
+            break;
+        case 74:
+            fdilate256_2_37(datad, w, h, wpld, datas, wpls);
+            break;
+        case 75:
+            ferode256_2_37(datad, w, h, wpld, datas, wpls);
+            break;
+        case 76:
+            fdilate256_2_38(datad, w, h, wpld, datas, wpls);
+            break;
+        case 77:
+            ferode256_2_38(datad, w, h, wpld, datas, wpls);
+            break;
+        case 78:
+            fdilate256_2_39(datad, w, h, wpld, datas, wpls);
+            break;
+        case 79:
+            ferode256_2_39(datad, w, h, wpld, datas, wpls);
+            break;
+        case 80:
+            fdilate256_2_40(datad, w, h, wpld, datas, wpls);
+            break;
+        case 81:
+            ferode256_2_40(datad, w, h, wpld, datas, wpls);
+            break;
+        case 82:
+            fdilate256_2_41(datad, w, h, wpld, datas, wpls);
+            break;
+        case 83:
+            ferode256_2_41(datad, w, h, wpld, datas, wpls);
+            break;
+        case 84:
+            fdilate256_2_42(datad, w, h, wpld, datas, wpls);
+            break;
+        case 85:
+            ferode256_2_42(datad, w, h, wpld, datas, wpls);
+            break;
+        case 86:
+            fdilate256_2_43(datad, w, h, wpld, datas, wpls);
+            break;
+        case 87:
+            ferode256_2_43(datad, w, h, wpld, datas, wpls);
+            break;
+        case 88:
+            fdilate256_2_44(datad, w, h, wpld, datas, wpls);
+            break;
+        case 89:
+            ferode256_2_44(datad, w, h, wpld, datas, wpls);
+            break;
+        case 90:
+            fdilate256_2_45(datad, w, h, wpld, datas, wpls);
+            break;
+        case 91:
+            ferode256_2_45(datad, w, h, wpld, datas, wpls);
+            break;
+        case 92:
+            fdilate256_2_46(datad, w, h, wpld, datas, wpls);
+            break;
+        case 93:
+            ferode256_2_46(datad, w, h, wpld, datas, wpls);
+            break;
+        case 94:
+            fdilate256_2_47(datad, w, h, wpld, datas, wpls);
+            break;
+        case 95:
+            ferode256_2_47(datad, w, h, wpld, datas, wpls);
+            break;
+        case 96:
+            fdilate256_2_48(datad, w, h, wpld, datas, wpls);
+            break;
+        case 97:
+            ferode256_2_48(datad, w, h, wpld, datas, wpls);
+            break;
+        case 98:
+            fdilate256_2_49(datad, w, h, wpld, datas, wpls);
+            break;
+        case 99:
+            ferode256_2_49(datad, w, h, wpld, datas, wpls);
+            break;
+        case 100:
+            fdilate256_2_50(datad, w, h, wpld, datas, wpls);
+            break;
+        case 101:
+            ferode256_2_50(datad, w, h, wpld, datas, wpls);
+            break;
+        case 102:
+            fdilate256_2_51(datad, w, h, wpld, datas, wpls);
+            break;
+        case 103:
+            ferode256_2_51(datad, w, h, wpld, datas, wpls);
+            break;
+        case 104:
+            fdilate256_2_52(datad, w, h, wpld, datas, wpls);
+            break;
+        case 105:
+            ferode256_2_52(datad, w, h, wpld, datas, wpls);
+            break;
+        case 106:
+            fdilate256_2_53(datad, w, h, wpld, datas, wpls);
+            break;
+        case 107:
+            ferode256_2_53(datad, w, h, wpld, datas, wpls);
+            break;
+        case 108:
+            fdilate256_2_54(datad, w, h, wpld, datas, wpls);
+            break;
+        case 109:
+            ferode256_2_54(datad, w, h, wpld, datas, wpls);
+            break;
+        case 110:
+            fdilate256_2_55(datad, w, h, wpld, datas, wpls);
+            break;
+        case 111:
+            ferode256_2_55(datad, w, h, wpld, datas, wpls);
+            break;
+        case 112:
+            fdilate256_2_56(datad, w, h, wpld, datas, wpls);
+            break;
+        case 113:
+            ferode256_2_56(datad, w, h, wpld, datas, wpls);
+            break;
+        case 114:
+            fdilate256_2_57(datad, w, h, wpld, datas, wpls);
+            break;
+        case 115:
+            ferode256_2_57(datad, w, h, wpld, datas, wpls);
+            break;
+        case 116:
+            fdilate256_2_58(datad, w, h, wpld, datas, wpls);
+            break;
+        case 117:
+            ferode256_2_58(datad, w, h, wpld, datas, wpls);
+            break;
+        case 118:
+            fdilate256_2_59(datad, w, h, wpld, datas, wpls);
+            break;
+        case 119:
+            ferode256_2_59(datad, w, h, wpld, datas, wpls);
+            break;
+        case 120:
+            fdilate256_2_60(datad, w, h, wpld, datas, wpls);
+            break;
+        case 121:
+            ferode256_2_60(datad, w, h, wpld, datas, wpls);
+            break;
+        case 122:
+            fdilate256_2_61(datad, w, h, wpld, datas, wpls);
+            break;
+        case 123:
+            ferode256_2_61(datad, w, h, wpld, datas, wpls);
+            break;
+        case 124:
+            fdilate256_2_62(datad, w, h, wpld, datas, wpls);
+            break;
+        case 125:
+            ferode256_2_62(datad, w, h, wpld, datas, wpls);
+            break;
+        case 126:
+            fdilate256_2_63(datad, w, h, wpld, datas, wpls);
+            break;
+        case 127:
+            ferode256_2_63(datad, w, h, wpld, datas, wpls);
+            break;
+        case 128:
+            fdilate256_2_64(datad, w, h, wpld, datas, wpls);
+            break;
+        case 129:
+            ferode256_2_64(datad, w, h, wpld, datas, wpls);
+            break;
+        case 130:
+            fdilate256_2_65(datad, w, h, wpld, datas, wpls);
+            break;
+        case 131:
+            ferode256_2_65(datad, w, h, wpld, datas, wpls);
+            break;
+        case 132:
+            fdilate256_2_66(datad, w, h, wpld, datas, wpls);
+            break;
+        case 133:
+            ferode256_2_66(datad, w, h, wpld, datas, wpls);
+            break;
+        case 134:
+            fdilate256_2_67(datad, w, h, wpld, datas, wpls);
+            break;
+        case 135:
+            ferode256_2_67(datad, w, h, wpld, datas, wpls);
+            break;
+        case 136:
+            fdilate256_2_68(datad, w, h, wpld, datas, wpls);
+            break;
+        case 137:
+            ferode256_2_68(datad, w, h, wpld, datas, wpls);
+            break;
+        case 138:
+            fdilate256_2_69(datad, w, h, wpld, datas, wpls);
+            break;
+        case 139:
+            ferode256_2_69(datad, w, h, wpld, datas, wpls);
+            break;
+        case 140:
+            fdilate256_2_70(datad, w, h, wpld, datas, wpls);
+            break;
+        case 141:
+            ferode256_2_70(datad, w, h, wpld, datas, wpls);
+            break;
+        case 142:
+            fdilate256_2_71(datad, w, h, wpld, datas, wpls);
+            break;
+        case 143:
+            ferode256_2_71(datad, w, h, wpld, datas, wpls);
+            break;
+        case 144:
+            fdilate256_2_72(datad, w, h, wpld, datas, wpls);
+            break;
+        case 145:
+            ferode256_2_72(datad, w, h, wpld, datas, wpls);
+            break;
+        case 146:
+            fdilate256_2_73(datad, w, h, wpld, datas, wpls);
+            break;
+        case 147:
+            ferode256_2_73(datad, w, h, wpld, datas, wpls);
+            break;
+        case 148:
+            fdilate256_2_74(datad, w, h, wpld, datas, wpls);
+            break;
+        case 149:
+            ferode256_2_74(datad, w, h, wpld, datas, wpls);
+            break;
+        case 150:
+            fdilate256_2_75(datad, w, h, wpld, datas, wpls);
+            break;
+        case 151:
+            ferode256_2_75(datad, w, h, wpld, datas, wpls);
+            break;
+        }
+        return 0;
+    }
+#endif  /* L_HAVE_AVX2 */
+    if (width == 64) {
+        switch (index)
+        {
+        case 0:
+            fdilate64_2_0(datad, w, h, wpld, datas, wpls);
+            break;
+        case 1:
+            ferode64_2_0(datad, w, h, wpld, datas, wpls);
+            break;
+        case 2:
+            fdilate64_2_1(datad, w, h, wpld, datas, wpls);
+            break;
+        case 3:
+            ferode64_2_1(datad, w, h, wpld, datas, wpls);
+            break;
+        case 4:
+            fdilate64_2_2(datad, w, h, wpld, datas, wpls);
+            break;
+        case 5:
+            ferode64_2_2(datad, w, h, wpld, datas, wpls);
+            break;
+        case 6:
+            fdilate64_2_3(datad, w, h, wpld, datas, wpls);
+            break;
+        case 7:
+            ferode64_2_3(datad, w, h, wpld, datas, wpls);
+            break;
+        case 8:
+            fdilate64_2_4(datad, w, h, wpld, datas, wpls);
+            break;
+        case 9:
+            ferode64_2_4(datad, w, h, wpld, datas, wpls);
+            break;
+        case 10:
+            fdilate64_2_5(datad, w, h, wpld, datas, wpls);
+            break;
+        case 11:
+            ferode64_2_5(datad, w, h, wpld, datas, wpls);
+            break;
+        case 12:
+            fdilate64_2_6(datad, w, h, wpld, datas, wpls);
+            break;
+        case 13:
+            ferode64_2_6(datad, w, h, wpld, datas, wpls);
+            break;
+        case 14:
+            fdilate64_2_7(datad, w, h, wpld, datas, wpls);
+            break;
+        case 15:
+            ferode64_2_7(datad, w, h, wpld, datas, wpls);
+            break;
+        case 16:
+            fdilate64_2_8(datad, w, h, wpld, datas, wpls);
+            break;
+        case 17:
+            ferode64_2_8(datad, w, h, wpld, datas, wpls);
+            break;
+        case 18:
+            fdilate64_2_9(datad, w, h, wpld, datas, wpls);
+            break;
+        case 19:
+            ferode64_2_9(datad, w, h, wpld, datas, wpls);
+            break;
+        case 20:
+            fdilate64_2_10(datad, w, h, wpld, datas, wpls);
+            break;
+        case 21:
+            ferode64_2_10(datad, w, h, wpld, datas, wpls);
+            break;
+        case 22:
+            fdilate64_2_11(datad, w, h, wpld, datas, wpls);
+            break;
+        case 23:
+            ferode64_2_11(datad, w, h, wpld, datas, wpls);
+            break;
+        case 24:
+            fdilate64_2_12(datad, w, h, wpld, datas, wpls);
+            break;
+        case 25:
+            ferode64_2_12(datad, w, h, wpld, datas, wpls);
+            break;
+        case 26:
+            fdilate64_2_13(datad, w, h, wpld, datas, wpls);
+            break;
+        case 27:
+            ferode64_2_13(datad, w, h, wpld, datas, wpls);
+            break;
+        case 28:
+            fdilate64_2_14(datad, w, h, wpld, datas, wpls);
+            break;
+        case 29:
+            ferode64_2_14(datad, w, h, wpld, datas, wpls);
+            break;
+        case 30:
+            fdilate64_2_15(datad, w, h, wpld, datas, wpls);
+            break;
+        case 31:
+            ferode64_2_15(datad, w, h, wpld, datas, wpls);
+            break;
+        case 32:
+            fdilate64_2_16(datad, w, h, wpld, datas, wpls);
+            break;
+        case 33:
+            ferode64_2_16(datad, w, h, wpld, datas, wpls);
+            break;
+        case 34:
+            fdilate64_2_17(datad, w, h, wpld, datas, wpls);
+            break;
+        case 35:
+            ferode64_2_17(datad, w, h, wpld, datas, wpls);
+            break;
+        case 36:
+            fdilate64_2_18(datad, w, h, wpld, datas, wpls);
+            break;
+        case 37:
+            ferode64_2_18(datad, w, h, wpld, datas, wpls);
+            break;
+        case 38:
+            fdilate64_2_19(datad, w, h, wpld, datas, wpls);
+            break;
+        case 39:
+            ferode64_2_19(datad, w, h, wpld, datas, wpls);
+            break;
+        case 40:
+            fdilate64_2_20(datad, w, h, wpld, datas, wpls);
+            break;
+        case 41:
+            ferode64_2_20(datad, w, h, wpld, datas, wpls);
+            break;
+        case 42:
+            fdilate64_2_21(datad, w, h, wpld, datas, wpls);
+            break;
+        case 43:
+            ferode64_2_21(datad, w, h, wpld, datas, wpls);
+            break;
+        case 44:
+            fdilate64_2_22(datad, w, h, wpld, datas, wpls);
+            break;
+        case 45:
+            ferode64_2_22(datad, w, h, wpld, datas, wpls);
+            break;
+        case 46:
+            fdilate64_2_23(datad, w, h, wpld, datas, wpls);
+            break;
+        case 47:
+            ferode64_2_23(datad, w, h, wpld, datas, wpls);
+            break;
+        case 48:
+            fdilate64_2_24(datad, w, h, wpld, datas, wpls);
+            break;
+        case 49:
+            ferode64_2_24(datad, w, h, wpld, datas, wpls);
+            break;
+        case 50:
+            fdilate64_2_25(datad, w, h, wpld, datas, wpls);
+            break;
+        case 51:
+            ferode64_2_25(datad, w, h, wpld, datas, wpls);
+            break;
+        case 52:
+            fdilate64_2_26(datad, w, h, wpld, datas, wpls);
+            break;
+        case 53:
+            ferode64_2_26(datad, w, h, wpld, datas, wpls);
+            break;
+        case 54:
+            fdilate64_2_27(datad, w, h, wpld, datas, wpls);
+            break;
+        case 55:
+            ferode64_2_27(datad, w, h, wpld, datas, wpls);
+            break;
+        case 56:
+            fdilate64_2_28(datad, w, h, wpld, datas, wpls);
+            break;
+        case 57:
+            ferode64_2_28(datad, w, h, wpld, datas, wpls);
+            break;
+        case 58:
+            fdilate64_2_29(datad, w, h, wpld, datas, wpls);
+            break;
+        case 59:
+            ferode64_2_29(datad, w, h, wpld, datas, wpls);
+            break;
+        case 60:
+            fdilate64_2_30(datad, w, h, wpld, datas, wpls);
+            break;
+        case 61:
+            ferode64_2_30(datad, w, h, wpld, datas, wpls);
+            break;
+        case 62:
+            fdilate64_2_31(datad, w, h, wpld, datas, wpls);
+            break;
+        case 63:
+            ferode64_2_31(datad, w, h, wpld, datas, wpls);
+            break;
+        case 64:
+            fdilate64_2_32(datad, w, h, wpld, datas, wpls);
+            break;
+        case 65:
+            ferode64_2_32(datad, w, h, wpld, datas, wpls);
+            break;
+        case 66:
+            fdilate64_2_33(datad, w, h, wpld, datas, wpls);
+            break;
+        case 67:
+            ferode64_2_33(datad, w, h, wpld, datas, wpls);
+            break;
+        case 68:
+            fdilate64_2_34(datad, w, h, wpld, datas, wpls);
+            break;
+        case 69:
+            ferode64_2_34(datad, w, h, wpld, datas, wpls);
+            break;
+        case 70:
+            fdilate64_2_35(datad, w, h, wpld, datas, wpls);
+            break;
+        case 71:
+            ferode64_2_35(datad, w, h, wpld, datas, wpls);
+            break;
+        case 72:
+            fdilate64_2_36(datad, w, h, wpld, datas, wpls);
+            break;
+        case 73:
+            ferode64_2_36(datad, w, h, wpld, datas, wpls);
+            break;
+        case 74:
+            fdilate64_2_37(datad, w, h, wpld, datas, wpls);
+            break;
+        case 75:
+            ferode64_2_37(datad, w, h, wpld, datas, wpls);
+            break;
+        case 76:
+            fdilate64_2_38(datad, w, h, wpld, datas, wpls);
+            break;
+        case 77:
+            ferode64_2_38(datad, w, h, wpld, datas, wpls);
+            break;
+        case 78:
+            fdilate64_2_39(datad, w, h, wpld, datas, wpls);
+            break;
+        case 79:
+            ferode64_2_39(datad, w, h, wpld, datas, wpls);
+            break;
+        case 80:
+            fdilate64_2_40(datad, w, h, wpld, datas, wpls);
+            break;
+        case 81:
+            ferode64_2_40(datad, w, h, wpld, datas, wpls);
+            break;
+        case 82:
+            fdilate64_2_41(datad, w, h, wpld, datas, wpls);
+            break;
+        case 83:
+            ferode64_2_41(datad, w, h, wpld, datas, wpls);
+            break;
+        case 84:
+            fdilate64_2_42(datad, w, h, wpld, datas, wpls);
+            break;
+        case 85:
+            ferode64_2_42(datad, w, h, wpld, datas, wpls);
+            break;
+        case 86:
+            fdilate64_2_43(datad, w, h, wpld, datas, wpls);
+            break;
+        case 87:
+            ferode64_2_43(datad, w, h, wpld, datas, wpls);
+            break;
+        case 88:
+            fdilate64_2_44(datad, w, h, wpld, datas, wpls);
+            break;
+        case 89:
+            ferode64_2_44(datad, w, h, wpld, datas, wpls);
+            break;
+        case 90:
+            fdilate64_2_45(datad, w, h, wpld, datas, wpls);
+            break;
+        case 91:
+            ferode64_2_45(datad, w, h, wpld, datas, wpls);
+            break;
+        case 92:
+            fdilate64_2_46(datad, w, h, wpld, datas, wpls);
+            break;
+        case 93:
+            ferode64_2_46(datad, w, h, wpld, datas, wpls);
+            break;
+        case 94:
+            fdilate64_2_47(datad, w, h, wpld, datas, wpls);
+            break;
+        case 95:
+            ferode64_2_47(datad, w, h, wpld, datas, wpls);
+            break;
+        case 96:
+            fdilate64_2_48(datad, w, h, wpld, datas, wpls);
+            break;
+        case 97:
+            ferode64_2_48(datad, w, h, wpld, datas, wpls);
+            break;
+        case 98:
+            fdilate64_2_49(datad, w, h, wpld, datas, wpls);
+            break;
+        case 99:
+            ferode64_2_49(datad, w, h, wpld, datas, wpls);
+            break;
+        case 100:
+            fdilate64_2_50(datad, w, h, wpld, datas, wpls);
+            break;
+        case 101:
+            ferode64_2_50(datad, w, h, wpld, datas, wpls);
+            break;
+        case 102:
+            fdilate64_2_51(datad, w, h, wpld, datas, wpls);
+            break;
+        case 103:
+            ferode64_2_51(datad, w, h, wpld, datas, wpls);
+            break;
+        case 104:
+            fdilate64_2_52(datad, w, h, wpld, datas, wpls);
+            break;
+        case 105:
+            ferode64_2_52(datad, w, h, wpld, datas, wpls);
+            break;
+        case 106:
+            fdilate64_2_53(datad, w, h, wpld, datas, wpls);
+            break;
+        case 107:
+            ferode64_2_53(datad, w, h, wpld, datas, wpls);
+            break;
+        case 108:
+            fdilate64_2_54(datad, w, h, wpld, datas, wpls);
+            break;
+        case 109:
+            ferode64_2_54(datad, w, h, wpld, datas, wpls);
+            break;
+        case 110:
+            fdilate64_2_55(datad, w, h, wpld, datas, wpls);
+            break;
+        case 111:
+            ferode64_2_55(datad, w, h, wpld, datas, wpls);
+            break;
+        case 112:
+            fdilate64_2_56(datad, w, h, wpld, datas, wpls);
+            break;
+        case 113:
+            ferode64_2_56(datad, w, h, wpld, datas, wpls);
+            break;
+        case 114:
+            fdilate64_2_57(datad, w, h, wpld, datas, wpls);
+            break;
+        case 115:
+            ferode64_2_57(datad, w, h, wpld, datas, wpls);
+            break;
+        case 116:
+            fdilate64_2_58(datad, w, h, wpld, datas, wpls);
+            break;
+        case 117:
+            ferode64_2_58(datad, w, h, wpld, datas, wpls);
+            break;
+        case 118:
+            fdilate64_2_59(datad, w, h, wpld, datas, wpls);
+            break;
+        case 119:
+            ferode64_2_59(datad, w, h, wpld, datas, wpls);
+            break;
+        case 120:
+            fdilate64_2_60(datad, w, h, wpld, datas, wpls);
+            break;
+        case 121:
+            ferode64_2_60(datad, w, h, wpld, datas, wpls);
+            break;
+        case 122:
+            fdilate64_2_61(datad, w, h, wpld, datas, wpls);
+            break;
+        case 123:
+            ferode64_2_61(datad, w, h, wpld, datas, wpls);
+            break;
+        case 124:
+            fdilate64_2_62(datad, w, h, wpld, datas, wpls);
+            break;
+        case 125:
+            ferode64_2_62(datad, w, h, wpld, datas, wpls);
+            break;
+        case 126:
+            fdilate64_2_63(datad, w, h, wpld, datas, wpls);
+            break;
+        case 127:
+            ferode64_2_63(datad, w, h, wpld, datas, wpls);
+            break;
+        case 128:
+            fdilate64_2_64(datad, w, h, wpld, datas, wpls);
+            break;
+        case 129:
+            ferode64_2_64(datad, w, h, wpld, datas, wpls);
+            break;
+        case 130:
+            fdilate64_2_65(datad, w, h, wpld, datas, wpls);
+            break;
+        case 131:
+            ferode64_2_65(datad, w, h, wpld, datas, wpls);
+            break;
+        case 132:
+            fdilate64_2_66(datad, w, h, wpld, datas, wpls);
+            break;
+        case 133:
+            ferode64_2_66(datad, w, h, wpld, datas, wpls);
+            break;
+        case 134:
+            fdilate64_2_67(datad, w, h, wpld, datas, wpls);
+            break;
+        case 135:
+            ferode64_2_67(datad, w, h, wpld, datas, wpls);
+            break;
+        case 136:
+            fdilate64_2_68(datad, w, h, wpld, datas, wpls);
+            break;
+        case 137:
+            ferode64_2_68(datad, w, h, wpld, datas, wpls);
+            break;
+        case 138:
+            fdilate64_2_69(datad, w, h, wpld, datas, wpls);
+            break;
+        case 139:
+            ferode64_2_69(datad, w, h, wpld, datas, wpls);
+            break;
+        case 140:
+            fdilate64_2_70(datad, w, h, wpld, datas, wpls);
+            break;
+        case 141:
+            ferode64_2_70(datad, w, h, wpld, datas, wpls);
+            break;
+        case 142:
+            fdilate64_2_71(datad, w, h, wpld, datas, wpls);
+            break;
+        case 143:
+            ferode64_2_71(datad, w, h, wpld, datas, wpls);
+            break;
+        case 144:
+            fdilate64_2_72(datad, w, h, wpld, datas, wpls);
+            break;
+        case 145:
+            ferode64_2_72(datad, w, h, wpld, datas, wpls);
+            break;
+        case 146:
+            fdilate64_2_73(datad, w, h, wpld, datas, wpls);
+            break;
+        case 147:
+            ferode64_2_73(datad, w, h, wpld, datas, wpls);
+            break;
+        case 148:
+            fdilate64_2_74(datad, w, h, wpld, datas, wpls);
+            break;
+        case 149:
+            ferode64_2_74(datad, w, h, wpld, datas, wpls);
+            break;
+        case 150:
+            fdilate64_2_75(datad, w, h, wpld, datas, wpls);
+            break;
+        case 151:
+            ferode64_2_75(datad, w, h, wpld, datas, wpls);
+            break;
+        }
+        return 0;
+    }
 
     switch (index)
     {
@@ -687,6 +1943,12 @@ fmorphopgen_low_2(l_uint32  *datad,
  *        code by redefining w and h smaller and by moving the
  *        start-of-image pointers up to the beginning of this
  *        interior rectangle.
+ *
+ *        The 64-bit and 256-bit versions of each routine do most
+ *        of each line two or eight words at a time, and finish it
+ *        with the 32-bit code.  Horizontal shifts are always less
+ *        than 32, so the funnel shifts on the wider words give the
+ *        same bits as the 32-bit code.
  */
 static void
 fdilate_2_0(l_uint32  *datad,
@@ -4968,3 +6230,11149 @@ l_int32             wpls27;
     }
 }
 
+static void
+fdilate64_2_0(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 1) |
+                    DWA_SHR64(sptr, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31));
+        }
+    }
+}
+
+static void
+ferode64_2_0(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 1) &
+                    DWA_SHL64(sptr, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31));
+        }
+    }
+}
+
+static void
+fdilate64_2_1(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr - wpls);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls)) |
+                    (*(sptr - wpls));
+        }
+    }
+}
+
+static void
+ferode64_2_1(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr + wpls);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls)) &
+                    (*(sptr + wpls));
+        }
+    }
+}
+
+static void
+fdilate64_2_2(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void
+ferode64_2_2(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void
+fdilate64_2_3(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void
+ferode64_2_3(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void
+fdilate64_2_4(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 2) |
+                    DWA_SHR64(sptr, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31));
+        }
+    }
+}
+
+static void
+ferode64_2_4(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 2) &
+                    DWA_SHL64(sptr, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31));
+        }
+    }
+}
+
+static void
+fdilate64_2_5(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr - wpls);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls2)) |
+                    (*(sptr - wpls));
+        }
+    }
+}
+
+static void
+ferode64_2_5(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr + wpls);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls2)) &
+                    (*(sptr + wpls));
+        }
+    }
+}
+
+static void
+fdilate64_2_6(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void
+ferode64_2_6(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void
+fdilate64_2_7(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void
+ferode64_2_7(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void
+fdilate64_2_8(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 2) |
+                    DWA_SHR64(sptr, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30));
+        }
+    }
+}
+
+static void
+ferode64_2_8(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 2) &
+                    DWA_SHL64(sptr, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30));
+        }
+    }
+}
+
+static void
+fdilate64_2_9(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr - wpls2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls2)) |
+                    (*(sptr - wpls2));
+        }
+    }
+}
+
+static void
+ferode64_2_9(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr + wpls2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls2)) &
+                    (*(sptr + wpls2));
+        }
+    }
+}
+
+static void
+fdilate64_2_10(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 3) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    (*sptr) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29));
+        }
+    }
+}
+
+static void
+ferode64_2_10(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 3) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    (*sptr) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29));
+        }
+    }
+}
+
+static void
+fdilate64_2_11(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls3;
+
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls3)) |
+                    (*sptr) |
+                    (*(sptr - wpls3));
+        }
+    }
+}
+
+static void
+ferode64_2_11(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls3;
+
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls3)) &
+                    (*sptr) &
+                    (*(sptr + wpls3));
+        }
+    }
+}
+
+static void
+fdilate64_2_12(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 3) |
+                    DWA_SHR64(sptr, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30));
+        }
+    }
+}
+
+static void
+ferode64_2_12(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 3) &
+                    DWA_SHL64(sptr, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30));
+        }
+    }
+}
+
+static void
+fdilate64_2_13(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+l_int32             wpls3;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr - wpls2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls3)) |
+                    (*(sptr - wpls2));
+        }
+    }
+}
+
+static void
+ferode64_2_13(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+l_int32             wpls3;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr + wpls2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls3)) &
+                    (*(sptr + wpls2));
+        }
+    }
+}
+
+static void
+fdilate64_2_14(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 4) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 4);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    (*sptr) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28));
+        }
+    }
+}
+
+static void
+ferode64_2_14(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 4) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 4);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    (*sptr) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28));
+        }
+    }
+}
+
+static void
+fdilate64_2_15(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls4;
+
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls4);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls4)) |
+                    (*sptr) |
+                    (*(sptr - wpls4));
+        }
+    }
+}
+
+static void
+ferode64_2_15(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls4;
+
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls4);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls4)) &
+                    (*sptr) &
+                    (*(sptr + wpls4));
+        }
+    }
+}
+
+static void
+fdilate64_2_16(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 4) |
+                    DWA_SHR64(sptr, 3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29));
+        }
+    }
+}
+
+static void
+ferode64_2_16(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 4) &
+                    DWA_SHL64(sptr, 3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29));
+        }
+    }
+}
+
+static void
+fdilate64_2_17(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls3;
+l_int32             wpls4;
+
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr - wpls3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls4)) |
+                    (*(sptr - wpls3));
+        }
+    }
+}
+
+static void
+ferode64_2_17(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls3;
+l_int32             wpls4;
+
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr + wpls3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls4)) &
+                    (*(sptr + wpls3));
+        }
+    }
+}
+
+static void
+fdilate64_2_18(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 5) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    (*sptr) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27));
+        }
+    }
+}
+
+static void
+ferode64_2_18(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 5) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    (*sptr) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27));
+        }
+    }
+}
+
+static void
+fdilate64_2_19(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls5;
+
+    wpls5 = 5 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls5)) |
+                    (*sptr) |
+                    (*(sptr - wpls5));
+        }
+    }
+}
+
+static void
+ferode64_2_19(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls5;
+
+    wpls5 = 5 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls5)) &
+                    (*sptr) &
+                    (*(sptr + wpls5));
+        }
+    }
+}
+
+static void
+fdilate64_2_20(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26));
+        }
+    }
+}
+
+static void
+ferode64_2_20(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26));
+        }
+    }
+}
+
+static void
+fdilate64_2_21(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+l_int32             wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls6)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls6));
+        }
+    }
+}
+
+static void
+ferode64_2_21(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+l_int32             wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls6)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls6));
+        }
+    }
+}
+
+static void
+fdilate64_2_22(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 6) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    (*sptr) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26));
+        }
+    }
+}
+
+static void
+ferode64_2_22(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 6) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    (*sptr) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26));
+        }
+    }
+}
+
+static void
+fdilate64_2_23(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls6;
+
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls6)) |
+                    (*sptr) |
+                    (*(sptr - wpls6));
+        }
+    }
+}
+
+static void
+ferode64_2_23(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls6;
+
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls6)) &
+                    (*sptr) &
+                    (*(sptr + wpls6));
+        }
+    }
+}
+
+static void
+fdilate64_2_24(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 8) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 7);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25));
+        }
+    }
+}
+
+static void
+ferode64_2_24(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 8) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 7);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25));
+        }
+    }
+}
+
+static void
+fdilate64_2_25(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+l_int32             wpls3;
+l_int32             wpls7;
+l_int32             wpls8;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls7);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls8)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls7));
+        }
+    }
+}
+
+static void
+ferode64_2_25(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+l_int32             wpls3;
+l_int32             wpls7;
+l_int32             wpls8;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls7);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls8)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls7));
+        }
+    }
+}
+
+static void
+fdilate64_2_26(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 7) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 7);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    (*sptr) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25));
+        }
+    }
+}
+
+static void
+ferode64_2_26(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 7) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 7);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    (*sptr) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25));
+        }
+    }
+}
+
+static void
+fdilate64_2_27(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls7;
+
+    wpls7 = 7 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls7);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls7)) |
+                    (*sptr) |
+                    (*(sptr - wpls7));
+        }
+    }
+}
+
+static void
+ferode64_2_27(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls7;
+
+    wpls7 = 7 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls7);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls7)) &
+                    (*sptr) &
+                    (*(sptr + wpls7));
+        }
+    }
+}
+
+static void
+fdilate64_2_28(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 6) |
+                    DWA_SHR64(sptr, 5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27));
+        }
+    }
+}
+
+static void
+ferode64_2_28(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 6) &
+                    DWA_SHL64(sptr, 5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27));
+        }
+    }
+}
+
+static void
+fdilate64_2_29(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls5;
+l_int32             wpls6;
+
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr - wpls5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls6)) |
+                    (*(sptr - wpls5));
+        }
+    }
+}
+
+static void
+ferode64_2_29(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls5;
+l_int32             wpls6;
+
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr + wpls5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls6)) &
+                    (*(sptr + wpls5));
+        }
+    }
+}
+
+static void
+fdilate64_2_30(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 9) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 9);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23));
+        }
+    }
+}
+
+static void
+ferode64_2_30(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 9) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 9);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23));
+        }
+    }
+}
+
+static void
+fdilate64_2_31(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls3;
+l_int32             wpls9;
+
+    wpls3 = 3 * wpls;
+    wpls9 = 9 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls9);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls9)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls9));
+        }
+    }
+}
+
+static void
+ferode64_2_31(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls3;
+l_int32             wpls9;
+
+    wpls3 = 3 * wpls;
+    wpls9 = 9 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls9);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls9)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls9));
+        }
+    }
+}
+
+static void
+fdilate64_2_32(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 10) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 10);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    (*sptr) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22));
+        }
+    }
+}
+
+static void
+ferode64_2_32(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 10) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 10);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    (*sptr) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22));
+        }
+    }
+}
+
+static void
+fdilate64_2_33(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls5;
+l_int32             wpls10;
+
+    wpls5 = 5 * wpls;
+    wpls10 = 10 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls10) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls10);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls10)) |
+                    (*(sptr + wpls5)) |
+                    (*sptr) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls10));
+        }
+    }
+}
+
+static void
+ferode64_2_33(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls5;
+l_int32             wpls10;
+
+    wpls5 = 5 * wpls;
+    wpls10 = 10 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls10) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls10);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls10)) &
+                    (*(sptr - wpls5)) &
+                    (*sptr) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls10));
+        }
+    }
+}
+
+static void
+fdilate64_2_34(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 9) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 9);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    (*sptr) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23));
+        }
+    }
+}
+
+static void
+ferode64_2_34(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 9) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 9);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    (*sptr) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23));
+        }
+    }
+}
+
+static void
+fdilate64_2_35(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls9;
+
+    wpls9 = 9 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls9);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls9)) |
+                    (*sptr) |
+                    (*(sptr - wpls9));
+        }
+    }
+}
+
+static void
+ferode64_2_35(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls9;
+
+    wpls9 = 9 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls9);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls9)) &
+                    (*sptr) &
+                    (*(sptr + wpls9));
+        }
+    }
+}
+
+static void
+fdilate64_2_36(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 11) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 10);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22));
+        }
+    }
+}
+
+static void
+ferode64_2_36(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 11) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 10);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22));
+        }
+    }
+}
+
+static void
+fdilate64_2_37(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls3;
+l_int32             wpls4;
+l_int32             wpls10;
+l_int32             wpls11;
+
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls11) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls10);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls11)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls10));
+        }
+    }
+}
+
+static void
+ferode64_2_37(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls3;
+l_int32             wpls4;
+l_int32             wpls10;
+l_int32             wpls11;
+
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls11) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls10);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls11)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls10));
+        }
+    }
+}
+
+static void
+fdilate64_2_38(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 12) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 12);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    (*sptr) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20));
+        }
+    }
+}
+
+static void
+ferode64_2_38(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 12) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 12);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    (*sptr) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20));
+        }
+    }
+}
+
+static void
+fdilate64_2_39(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls6;
+l_int32             wpls12;
+
+    wpls6 = 6 * wpls;
+    wpls12 = 12 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls12) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls12);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls12)) |
+                    (*(sptr + wpls6)) |
+                    (*sptr) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls12));
+        }
+    }
+}
+
+static void
+ferode64_2_39(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls6;
+l_int32             wpls12;
+
+    wpls6 = 6 * wpls;
+    wpls12 = 12 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls12) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls12);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls12)) &
+                    (*(sptr - wpls6)) &
+                    (*sptr) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls12));
+        }
+    }
+}
+
+static void
+fdilate64_2_40(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 12) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 12);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20));
+        }
+    }
+}
+
+static void
+ferode64_2_40(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 12) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 12);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20));
+        }
+    }
+}
+
+static void
+fdilate64_2_41(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls4;
+l_int32             wpls12;
+
+    wpls4 = 4 * wpls;
+    wpls12 = 12 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls12) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls12);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls12)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls12));
+        }
+    }
+}
+
+static void
+ferode64_2_41(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls4;
+l_int32             wpls12;
+
+    wpls4 = 4 * wpls;
+    wpls12 = 12 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls12) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls12);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls12)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls12));
+        }
+    }
+}
+
+static void
+fdilate64_2_42(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 11) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 11);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    (*sptr) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21));
+        }
+    }
+}
+
+static void
+ferode64_2_42(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 11) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 11);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    (*sptr) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21));
+        }
+    }
+}
+
+static void
+fdilate64_2_43(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls11;
+
+    wpls11 = 11 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls11) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls11);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls11)) |
+                    (*sptr) |
+                    (*(sptr - wpls11));
+        }
+    }
+}
+
+static void
+ferode64_2_43(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls11;
+
+    wpls11 = 11 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls11) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls11);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls11)) &
+                    (*sptr) &
+                    (*(sptr + wpls11));
+        }
+    }
+}
+
+static void
+fdilate64_2_44(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 14) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 7) |
+                    DWA_SHR64(sptr, 14);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    (*sptr) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18));
+        }
+    }
+}
+
+static void
+ferode64_2_44(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 14) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 7) &
+                    DWA_SHL64(sptr, 14);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    (*sptr) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18));
+        }
+    }
+}
+
+static void
+fdilate64_2_45(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls7;
+l_int32             wpls14;
+
+    wpls7 = 7 * wpls;
+    wpls14 = 14 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls14) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls7) |
+                    DWA_WORD64(sptr - wpls14);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls14)) |
+                    (*(sptr + wpls7)) |
+                    (*sptr) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls14));
+        }
+    }
+}
+
+static void
+ferode64_2_45(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls7;
+l_int32             wpls14;
+
+    wpls7 = 7 * wpls;
+    wpls14 = 14 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls14) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls7) &
+                    DWA_WORD64(sptr + wpls14);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls14)) &
+                    (*(sptr - wpls7)) &
+                    (*sptr) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls14));
+        }
+    }
+}
+
+static void
+fdilate64_2_46(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 15) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 9) |
+                    DWA_SHR64(sptr, 15);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17));
+        }
+    }
+}
+
+static void
+ferode64_2_46(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 15) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 9) &
+                    DWA_SHL64(sptr, 15);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17));
+        }
+    }
+}
+
+static void
+fdilate64_2_47(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls3;
+l_int32             wpls9;
+l_int32             wpls15;
+
+    wpls3 = 3 * wpls;
+    wpls9 = 9 * wpls;
+    wpls15 = 15 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls15) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls9) |
+                    DWA_WORD64(sptr - wpls15);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls15)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls15));
+        }
+    }
+}
+
+static void
+ferode64_2_47(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls3;
+l_int32             wpls9;
+l_int32             wpls15;
+
+    wpls3 = 3 * wpls;
+    wpls9 = 9 * wpls;
+    wpls15 = 15 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls15) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls9) &
+                    DWA_WORD64(sptr + wpls15);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls15)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls15));
+        }
+    }
+}
+
+static void
+fdilate64_2_48(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 13) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 13);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    (*sptr) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19));
+        }
+    }
+}
+
+static void
+ferode64_2_48(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 13) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 13);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    (*sptr) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19));
+        }
+    }
+}
+
+static void
+fdilate64_2_49(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls13;
+
+    wpls13 = 13 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls13) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls13);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls13)) |
+                    (*sptr) |
+                    (*(sptr - wpls13));
+        }
+    }
+}
+
+static void
+ferode64_2_49(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls13;
+
+    wpls13 = 13 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls13) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls13);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls13)) &
+                    (*sptr) &
+                    (*(sptr + wpls13));
+        }
+    }
+}
+
+static void
+fdilate64_2_50(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 16) |
+                    DWA_SHL64(sptr, 8) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 8) |
+                    DWA_SHR64(sptr, 16);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    (*sptr) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16));
+        }
+    }
+}
+
+static void
+ferode64_2_50(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 16) &
+                    DWA_SHR64(sptr, 8) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 8) &
+                    DWA_SHL64(sptr, 16);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    (*sptr) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16));
+        }
+    }
+}
+
+static void
+fdilate64_2_51(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls8;
+l_int32             wpls16;
+
+    wpls8 = 8 * wpls;
+    wpls16 = 16 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls16) |
+                    DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls8) |
+                    DWA_WORD64(sptr - wpls16);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls16)) |
+                    (*(sptr + wpls8)) |
+                    (*sptr) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls16));
+        }
+    }
+}
+
+static void
+ferode64_2_51(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls8;
+l_int32             wpls16;
+
+    wpls8 = 8 * wpls;
+    wpls16 = 16 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls16) &
+                    DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls8) &
+                    DWA_WORD64(sptr + wpls16);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls16)) &
+                    (*(sptr - wpls8)) &
+                    (*sptr) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls16));
+        }
+    }
+}
+
+static void
+fdilate64_2_52(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 18) |
+                    DWA_SHL64(sptr, 11) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 10) |
+                    DWA_SHR64(sptr, 17);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15));
+        }
+    }
+}
+
+static void
+ferode64_2_52(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 18) &
+                    DWA_SHR64(sptr, 11) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 10) &
+                    DWA_SHL64(sptr, 17);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15));
+        }
+    }
+}
+
+static void
+fdilate64_2_53(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls3;
+l_int32             wpls4;
+l_int32             wpls10;
+l_int32             wpls11;
+l_int32             wpls17;
+l_int32             wpls18;
+
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls18) |
+                    DWA_WORD64(sptr + wpls11) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls10) |
+                    DWA_WORD64(sptr - wpls17);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls18)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls17));
+        }
+    }
+}
+
+static void
+ferode64_2_53(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls3;
+l_int32             wpls4;
+l_int32             wpls10;
+l_int32             wpls11;
+l_int32             wpls17;
+l_int32             wpls18;
+
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls18) &
+                    DWA_WORD64(sptr - wpls11) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls10) &
+                    DWA_WORD64(sptr + wpls17);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls18)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls17));
+        }
+    }
+}
+
+static void
+fdilate64_2_54(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 17) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 16);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16));
+        }
+    }
+}
+
+static void
+ferode64_2_54(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 17) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 16);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16));
+        }
+    }
+}
+
+static void
+fdilate64_2_55(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls5;
+l_int32             wpls6;
+l_int32             wpls16;
+l_int32             wpls17;
+
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls17) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls16);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls17)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls16));
+        }
+    }
+}
+
+static void
+ferode64_2_55(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls5;
+l_int32             wpls6;
+l_int32             wpls16;
+l_int32             wpls17;
+
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls17) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls16);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls17)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls16));
+        }
+    }
+}
+
+static void
+fdilate64_2_56(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 18) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 9) |
+                    DWA_SHR64(sptr, 18);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    (*sptr) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14));
+        }
+    }
+}
+
+static void
+ferode64_2_56(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 18) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 9) &
+                    DWA_SHL64(sptr, 18);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    (*sptr) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14));
+        }
+    }
+}
+
+static void
+fdilate64_2_57(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls9;
+l_int32             wpls18;
+
+    wpls9 = 9 * wpls;
+    wpls18 = 18 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls18) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls9) |
+                    DWA_WORD64(sptr - wpls18);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls18)) |
+                    (*(sptr + wpls9)) |
+                    (*sptr) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls18));
+        }
+    }
+}
+
+static void
+ferode64_2_57(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls9;
+l_int32             wpls18;
+
+    wpls9 = 9 * wpls;
+    wpls18 = 18 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls18) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls9) &
+                    DWA_WORD64(sptr + wpls18);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls18)) &
+                    (*(sptr - wpls9)) &
+                    (*sptr) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls18));
+        }
+    }
+}
+
+static void
+fdilate64_2_58(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 20) |
+                    DWA_SHL64(sptr, 12) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 12) |
+                    DWA_SHR64(sptr, 20);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12));
+        }
+    }
+}
+
+static void
+ferode64_2_58(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 20) &
+                    DWA_SHR64(sptr, 12) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 12) &
+                    DWA_SHL64(sptr, 20);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12));
+        }
+    }
+}
+
+static void
+fdilate64_2_59(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls4;
+l_int32             wpls12;
+l_int32             wpls20;
+
+    wpls4 = 4 * wpls;
+    wpls12 = 12 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls20) |
+                    DWA_WORD64(sptr + wpls12) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls12) |
+                    DWA_WORD64(sptr - wpls20);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls20)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls20));
+        }
+    }
+}
+
+static void
+ferode64_2_59(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls4;
+l_int32             wpls12;
+l_int32             wpls20;
+
+    wpls4 = 4 * wpls;
+    wpls12 = 12 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls20) &
+                    DWA_WORD64(sptr - wpls12) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls12) &
+                    DWA_WORD64(sptr + wpls20);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls20)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls20));
+        }
+    }
+}
+
+static void
+fdilate64_2_60(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 21) |
+                    DWA_SHL64(sptr, 14) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 7) |
+                    DWA_SHR64(sptr, 14) |
+                    DWA_SHR64(sptr, 21);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 21) | (*(sptr + 1) >> 11)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    (*sptr) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11));
+        }
+    }
+}
+
+static void
+ferode64_2_60(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 21) &
+                    DWA_SHR64(sptr, 14) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 7) &
+                    DWA_SHL64(sptr, 14) &
+                    DWA_SHL64(sptr, 21);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 21) | (*(sptr - 1) << 11)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    (*sptr) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11));
+        }
+    }
+}
+
+static void
+fdilate64_2_61(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls7;
+l_int32             wpls14;
+l_int32             wpls21;
+
+    wpls7 = 7 * wpls;
+    wpls14 = 14 * wpls;
+    wpls21 = 21 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls21) |
+                    DWA_WORD64(sptr + wpls14) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls7) |
+                    DWA_WORD64(sptr - wpls14) |
+                    DWA_WORD64(sptr - wpls21);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls21)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls7)) |
+                    (*sptr) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls21));
+        }
+    }
+}
+
+static void
+ferode64_2_61(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls7;
+l_int32             wpls14;
+l_int32             wpls21;
+
+    wpls7 = 7 * wpls;
+    wpls14 = 14 * wpls;
+    wpls21 = 21 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls21) &
+                    DWA_WORD64(sptr - wpls14) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls7) &
+                    DWA_WORD64(sptr + wpls14) &
+                    DWA_WORD64(sptr + wpls21);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls21)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls7)) &
+                    (*sptr) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls21));
+        }
+    }
+}
+
+static void
+fdilate64_2_62(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 20) |
+                    DWA_SHL64(sptr, 10) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 10) |
+                    DWA_SHR64(sptr, 20);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    (*sptr) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12));
+        }
+    }
+}
+
+static void
+ferode64_2_62(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 20) &
+                    DWA_SHR64(sptr, 10) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 10) &
+                    DWA_SHL64(sptr, 20);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    (*sptr) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12));
+        }
+    }
+}
+
+static void
+fdilate64_2_63(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls10;
+l_int32             wpls20;
+
+    wpls10 = 10 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls20) |
+                    DWA_WORD64(sptr + wpls10) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls10) |
+                    DWA_WORD64(sptr - wpls20);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls20)) |
+                    (*(sptr + wpls10)) |
+                    (*sptr) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls20));
+        }
+    }
+}
+
+static void
+ferode64_2_63(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls10;
+l_int32             wpls20;
+
+    wpls10 = 10 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls20) &
+                    DWA_WORD64(sptr - wpls10) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls10) &
+                    DWA_WORD64(sptr + wpls20);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls20)) &
+                    (*(sptr - wpls10)) &
+                    (*sptr) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls20));
+        }
+    }
+}
+
+static void
+fdilate64_2_64(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 20) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 19);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13));
+        }
+    }
+}
+
+static void
+ferode64_2_64(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 20) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 19);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13));
+        }
+    }
+}
+
+static void
+fdilate64_2_65(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls6;
+l_int32             wpls7;
+l_int32             wpls19;
+l_int32             wpls20;
+
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls20) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls19);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls20)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls19));
+        }
+    }
+}
+
+static void
+ferode64_2_65(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls6;
+l_int32             wpls7;
+l_int32             wpls19;
+l_int32             wpls20;
+
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls20) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls19);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls20)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls19));
+        }
+    }
+}
+
+static void
+fdilate64_2_66(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 23) |
+                    DWA_SHL64(sptr, 14) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 13) |
+                    DWA_SHR64(sptr, 22);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 23) | (*(sptr + 1) >> 9)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10));
+        }
+    }
+}
+
+static void
+ferode64_2_66(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 23) &
+                    DWA_SHR64(sptr, 14) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 13) &
+                    DWA_SHL64(sptr, 22);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 23) | (*(sptr - 1) << 9)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10));
+        }
+    }
+}
+
+static void
+fdilate64_2_67(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls4;
+l_int32             wpls5;
+l_int32             wpls13;
+l_int32             wpls14;
+l_int32             wpls22;
+l_int32             wpls23;
+
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls22 = 22 * wpls;
+    wpls23 = 23 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls23) |
+                    DWA_WORD64(sptr + wpls14) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls13) |
+                    DWA_WORD64(sptr - wpls22);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls23)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls22));
+        }
+    }
+}
+
+static void
+ferode64_2_67(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls4;
+l_int32             wpls5;
+l_int32             wpls13;
+l_int32             wpls14;
+l_int32             wpls22;
+l_int32             wpls23;
+
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls22 = 22 * wpls;
+    wpls23 = 23 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls23) &
+                    DWA_WORD64(sptr - wpls14) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls13) &
+                    DWA_WORD64(sptr + wpls22);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls23)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls22));
+        }
+    }
+}
+
+static void
+fdilate64_2_68(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 22) |
+                    DWA_SHL64(sptr, 11) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 11) |
+                    DWA_SHR64(sptr, 22);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 22) | (*(sptr + 1) >> 10)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    (*sptr) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10));
+        }
+    }
+}
+
+static void
+ferode64_2_68(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 22) &
+                    DWA_SHR64(sptr, 11) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 11) &
+                    DWA_SHL64(sptr, 22);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 22) | (*(sptr - 1) << 10)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    (*sptr) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10));
+        }
+    }
+}
+
+static void
+fdilate64_2_69(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls11;
+l_int32             wpls22;
+
+    wpls11 = 11 * wpls;
+    wpls22 = 22 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls22) |
+                    DWA_WORD64(sptr + wpls11) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls11) |
+                    DWA_WORD64(sptr - wpls22);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls22)) |
+                    (*(sptr + wpls11)) |
+                    (*sptr) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls22));
+        }
+    }
+}
+
+static void
+ferode64_2_69(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls11;
+l_int32             wpls22;
+
+    wpls11 = 11 * wpls;
+    wpls22 = 22 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls22) &
+                    DWA_WORD64(sptr - wpls11) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls11) &
+                    DWA_WORD64(sptr + wpls22);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls22)) &
+                    (*(sptr - wpls11)) &
+                    (*sptr) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls22));
+        }
+    }
+}
+
+static void
+fdilate64_2_70(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 24) |
+                    DWA_SHL64(sptr, 16) |
+                    DWA_SHL64(sptr, 8) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 8) |
+                    DWA_SHR64(sptr, 16) |
+                    DWA_SHR64(sptr, 24);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 24) | (*(sptr + 1) >> 8)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    (*sptr) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 24) | (*(sptr - 1) << 8));
+        }
+    }
+}
+
+static void
+ferode64_2_70(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 24) &
+                    DWA_SHR64(sptr, 16) &
+                    DWA_SHR64(sptr, 8) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 8) &
+                    DWA_SHL64(sptr, 16) &
+                    DWA_SHL64(sptr, 24);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 24) | (*(sptr - 1) << 8)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    (*sptr) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 24) | (*(sptr + 1) >> 8));
+        }
+    }
+}
+
+static void
+fdilate64_2_71(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls8;
+l_int32             wpls16;
+l_int32             wpls24;
+
+    wpls8 = 8 * wpls;
+    wpls16 = 16 * wpls;
+    wpls24 = 24 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls24) |
+                    DWA_WORD64(sptr + wpls16) |
+                    DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls8) |
+                    DWA_WORD64(sptr - wpls16) |
+                    DWA_WORD64(sptr - wpls24);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls24)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls8)) |
+                    (*sptr) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls24));
+        }
+    }
+}
+
+static void
+ferode64_2_71(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls8;
+l_int32             wpls16;
+l_int32             wpls24;
+
+    wpls8 = 8 * wpls;
+    wpls16 = 16 * wpls;
+    wpls24 = 24 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls24) &
+                    DWA_WORD64(sptr - wpls16) &
+                    DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls8) &
+                    DWA_WORD64(sptr + wpls16) &
+                    DWA_WORD64(sptr + wpls24);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls24)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls8)) &
+                    (*sptr) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls24));
+        }
+    }
+}
+
+static void
+fdilate64_2_72(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 25) |
+                    DWA_SHL64(sptr, 15) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 15) |
+                    DWA_SHR64(sptr, 25);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 25) | (*(sptr + 1) >> 7)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 25) | (*(sptr - 1) << 7));
+        }
+    }
+}
+
+static void
+ferode64_2_72(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 25) &
+                    DWA_SHR64(sptr, 15) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 15) &
+                    DWA_SHL64(sptr, 25);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 25) | (*(sptr - 1) << 7)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 25) | (*(sptr + 1) >> 7));
+        }
+    }
+}
+
+static void
+fdilate64_2_73(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls5;
+l_int32             wpls15;
+l_int32             wpls25;
+
+    wpls5 = 5 * wpls;
+    wpls15 = 15 * wpls;
+    wpls25 = 25 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls25) |
+                    DWA_WORD64(sptr + wpls15) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls15) |
+                    DWA_WORD64(sptr - wpls25);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls25)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls25));
+        }
+    }
+}
+
+static void
+ferode64_2_73(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls5;
+l_int32             wpls15;
+l_int32             wpls25;
+
+    wpls5 = 5 * wpls;
+    wpls15 = 15 * wpls;
+    wpls25 = 25 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls25) &
+                    DWA_WORD64(sptr - wpls15) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls15) &
+                    DWA_WORD64(sptr + wpls25);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls25)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls25));
+        }
+    }
+}
+
+static void
+fdilate64_2_74(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 27) |
+                    DWA_SHL64(sptr, 18) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 9) |
+                    DWA_SHR64(sptr, 18) |
+                    DWA_SHR64(sptr, 27);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 27) | (*(sptr + 1) >> 5)) |
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    (*sptr) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) |
+                    ((*(sptr) >> 27) | (*(sptr - 1) << 5));
+        }
+    }
+}
+
+static void
+ferode64_2_74(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 27) &
+                    DWA_SHR64(sptr, 18) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 9) &
+                    DWA_SHL64(sptr, 18) &
+                    DWA_SHL64(sptr, 27);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 27) | (*(sptr - 1) << 5)) &
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    (*sptr) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) &
+                    ((*(sptr) << 27) | (*(sptr + 1) >> 5));
+        }
+    }
+}
+
+static void
+fdilate64_2_75(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls9;
+l_int32             wpls18;
+l_int32             wpls27;
+
+    wpls9 = 9 * wpls;
+    wpls18 = 18 * wpls;
+    wpls27 = 27 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls27) |
+                    DWA_WORD64(sptr + wpls18) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls9) |
+                    DWA_WORD64(sptr - wpls18) |
+                    DWA_WORD64(sptr - wpls27);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls27)) |
+                    (*(sptr + wpls18)) |
+                    (*(sptr + wpls9)) |
+                    (*sptr) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls18)) |
+                    (*(sptr - wpls27));
+        }
+    }
+}
+
+static void
+ferode64_2_75(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls9;
+l_int32             wpls18;
+l_int32             wpls27;
+
+    wpls9 = 9 * wpls;
+    wpls18 = 18 * wpls;
+    wpls27 = 27 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls27) &
+                    DWA_WORD64(sptr - wpls18) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls9) &
+                    DWA_WORD64(sptr + wpls18) &
+                    DWA_WORD64(sptr + wpls27);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls27)) &
+                    (*(sptr - wpls18)) &
+                    (*(sptr - wpls9)) &
+                    (*sptr) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls18)) &
+                    (*(sptr + wpls27));
+        }
+    }
+}
+
+#if L_HAVE_AVX2
+static void L_TARGET_AVX2
+fdilate256_2_0(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 1);
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_0(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 1);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_1(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls)) |
+                    (*(sptr - wpls));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_1(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls)) &
+                    (*(sptr + wpls));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_2(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_2(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_3(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_3(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_4(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 2);
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_4(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 2);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_5(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls2);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls2)) |
+                    (*(sptr - wpls));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_5(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls2);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls2)) &
+                    (*(sptr + wpls));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_6(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_6(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_7(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_7(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_8(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 2);
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_8(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 2);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_9(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls2);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls2)) |
+                    (*(sptr - wpls2));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_9(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls2);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls2)) &
+                    (*(sptr + wpls2));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_10(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 3);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    (*sptr) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_10(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 3);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    (*sptr) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_11(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls3;
+
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls3);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls3)) |
+                    (*sptr) |
+                    (*(sptr - wpls3));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_11(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls3;
+
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls3);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls3)) &
+                    (*sptr) &
+                    (*(sptr + wpls3));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_12(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 3);
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_12(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 3);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_13(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+l_int32             wpls3;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls3);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls3)) |
+                    (*(sptr - wpls2));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_13(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+l_int32             wpls3;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls3);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls3)) &
+                    (*(sptr + wpls2));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_14(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 4);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    (*sptr) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_14(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 4);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    (*sptr) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_15(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls4;
+
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls4);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls4)) |
+                    (*sptr) |
+                    (*(sptr - wpls4));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_15(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls4;
+
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls4);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls4)) &
+                    (*sptr) &
+                    (*(sptr + wpls4));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_16(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 4);
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_16(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 4);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_17(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls3;
+l_int32             wpls4;
+
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls4);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls4)) |
+                    (*(sptr - wpls3));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_17(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls3;
+l_int32             wpls4;
+
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls4);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls4)) &
+                    (*(sptr + wpls3));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_18(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 5);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    (*sptr) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_18(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 5);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    (*sptr) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_19(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls5;
+
+    wpls5 = 5 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls5);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls5)) |
+                    (*sptr) |
+                    (*(sptr - wpls5));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_19(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls5;
+
+    wpls5 = 5 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls5);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls5)) &
+                    (*sptr) &
+                    (*(sptr + wpls5));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_20(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 6);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_20(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 6);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_21(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+l_int32             wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls6);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls6)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls6));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_21(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+l_int32             wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls6);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls6)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls6));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_22(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 6);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    (*sptr) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_22(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 6);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    (*sptr) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_23(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls6;
+
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls6);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls6)) |
+                    (*sptr) |
+                    (*(sptr - wpls6));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_23(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls6;
+
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls6);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls6)) &
+                    (*sptr) &
+                    (*(sptr + wpls6));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_24(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 8);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_24(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 8);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_25(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+l_int32             wpls3;
+l_int32             wpls7;
+l_int32             wpls8;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls8);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls8)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls7));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_25(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+l_int32             wpls3;
+l_int32             wpls7;
+l_int32             wpls8;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls8);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls8)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls7));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_26(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 7);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    (*sptr) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_26(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 7);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    (*sptr) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_27(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls7;
+
+    wpls7 = 7 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls7);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls7)) |
+                    (*sptr) |
+                    (*(sptr - wpls7));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_27(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls7;
+
+    wpls7 = 7 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls7);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls7)) &
+                    (*sptr) &
+                    (*(sptr + wpls7));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_28(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 6);
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_28(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 6);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_29(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls5;
+l_int32             wpls6;
+
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls6);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls6)) |
+                    (*(sptr - wpls5));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_29(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls5;
+l_int32             wpls6;
+
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls6);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls6)) &
+                    (*(sptr + wpls5));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_30(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 9);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_30(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 9);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_31(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls3;
+l_int32             wpls9;
+
+    wpls3 = 3 * wpls;
+    wpls9 = 9 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls9);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls9)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls9));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_31(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls3;
+l_int32             wpls9;
+
+    wpls3 = 3 * wpls;
+    wpls9 = 9 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls9);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls9)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls9));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_32(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 10);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    (*sptr) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_32(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 10);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    (*sptr) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_33(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls5;
+l_int32             wpls10;
+
+    wpls5 = 5 * wpls;
+    wpls10 = 10 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls10);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls10)) |
+                    (*(sptr + wpls5)) |
+                    (*sptr) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls10));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_33(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls5;
+l_int32             wpls10;
+
+    wpls5 = 5 * wpls;
+    wpls10 = 10 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls10);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls10)) &
+                    (*(sptr - wpls5)) &
+                    (*sptr) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls10));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_34(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 9);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    (*sptr) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_34(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 9);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    (*sptr) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_35(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls9;
+
+    wpls9 = 9 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls9);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls9)) |
+                    (*sptr) |
+                    (*(sptr - wpls9));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_35(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls9;
+
+    wpls9 = 9 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls9);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls9)) &
+                    (*sptr) &
+                    (*(sptr + wpls9));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_36(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 11);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_36(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 11);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_37(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls3;
+l_int32             wpls4;
+l_int32             wpls10;
+l_int32             wpls11;
+
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls11);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls11)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls10));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_37(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls3;
+l_int32             wpls4;
+l_int32             wpls10;
+l_int32             wpls11;
+
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls11);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls11)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls10));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_38(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 12);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 12));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    (*sptr) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_38(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 12);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 12));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    (*sptr) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_39(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls6;
+l_int32             wpls12;
+
+    wpls6 = 6 * wpls;
+    wpls12 = 12 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls12);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls12));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls12)) |
+                    (*(sptr + wpls6)) |
+                    (*sptr) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls12));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_39(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls6;
+l_int32             wpls12;
+
+    wpls6 = 6 * wpls;
+    wpls12 = 12 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls12);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls12));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls12)) &
+                    (*(sptr - wpls6)) &
+                    (*sptr) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls12));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_40(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 12);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 12));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_40(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 12);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 12));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_41(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls4;
+l_int32             wpls12;
+
+    wpls4 = 4 * wpls;
+    wpls12 = 12 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls12);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls12));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls12)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls12));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_41(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls4;
+l_int32             wpls12;
+
+    wpls4 = 4 * wpls;
+    wpls12 = 12 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls12);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls12));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls12)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls12));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_42(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 11);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 11));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    (*sptr) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_42(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 11);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 11));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    (*sptr) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_43(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls11;
+
+    wpls11 = 11 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls11);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls11));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls11)) |
+                    (*sptr) |
+                    (*(sptr - wpls11));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_43(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls11;
+
+    wpls11 = 11 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls11);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls11));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls11)) &
+                    (*sptr) &
+                    (*(sptr + wpls11));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_44(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 14);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 14));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    (*sptr) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_44(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 14);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 14));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    (*sptr) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_45(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls7;
+l_int32             wpls14;
+
+    wpls7 = 7 * wpls;
+    wpls14 = 14 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls14);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls14));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls14)) |
+                    (*(sptr + wpls7)) |
+                    (*sptr) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls14));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_45(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls7;
+l_int32             wpls14;
+
+    wpls7 = 7 * wpls;
+    wpls14 = 14 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls14);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls14));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls14)) &
+                    (*(sptr - wpls7)) &
+                    (*sptr) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls14));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_46(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 15);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 15));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_46(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 15);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 15));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_47(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls3;
+l_int32             wpls9;
+l_int32             wpls15;
+
+    wpls3 = 3 * wpls;
+    wpls9 = 9 * wpls;
+    wpls15 = 15 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls15);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls15));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls15)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls15));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_47(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls3;
+l_int32             wpls9;
+l_int32             wpls15;
+
+    wpls3 = 3 * wpls;
+    wpls9 = 9 * wpls;
+    wpls15 = 15 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls15);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls15));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls15)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls15));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_48(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 13);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 13));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    (*sptr) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_48(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 13);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 13));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    (*sptr) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_49(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls13;
+
+    wpls13 = 13 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls13);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls13));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls13)) |
+                    (*sptr) |
+                    (*(sptr - wpls13));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_49(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls13;
+
+    wpls13 = 13 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls13);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls13));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls13)) &
+                    (*sptr) &
+                    (*(sptr + wpls13));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_50(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 16);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 16));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    (*sptr) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_50(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 16);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 16));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    (*sptr) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_51(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls8;
+l_int32             wpls16;
+
+    wpls8 = 8 * wpls;
+    wpls16 = 16 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls16);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls16));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls16)) |
+                    (*(sptr + wpls8)) |
+                    (*sptr) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls16));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_51(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls8;
+l_int32             wpls16;
+
+    wpls8 = 8 * wpls;
+    wpls16 = 16 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls16);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls16));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls16)) &
+                    (*(sptr - wpls8)) &
+                    (*sptr) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls16));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_52(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 18);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 17));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_52(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 18);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 17));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_53(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls3;
+l_int32             wpls4;
+l_int32             wpls10;
+l_int32             wpls11;
+l_int32             wpls17;
+l_int32             wpls18;
+
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls18);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls17));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls18)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls17));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_53(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls3;
+l_int32             wpls4;
+l_int32             wpls10;
+l_int32             wpls11;
+l_int32             wpls17;
+l_int32             wpls18;
+
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls18);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls17));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls18)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls17));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_54(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 17);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 16));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_54(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 17);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 16));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_55(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls5;
+l_int32             wpls6;
+l_int32             wpls16;
+l_int32             wpls17;
+
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls17);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls16));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls17)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls16));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_55(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls5;
+l_int32             wpls6;
+l_int32             wpls16;
+l_int32             wpls17;
+
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls17);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls16));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls17)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls16));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_56(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 18);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 18));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    (*sptr) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_56(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 18);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 18));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    (*sptr) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_57(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls9;
+l_int32             wpls18;
+
+    wpls9 = 9 * wpls;
+    wpls18 = 18 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls18);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls18));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls18)) |
+                    (*(sptr + wpls9)) |
+                    (*sptr) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls18));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_57(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls9;
+l_int32             wpls18;
+
+    wpls9 = 9 * wpls;
+    wpls18 = 18 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls18);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls18));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls18)) &
+                    (*(sptr - wpls9)) &
+                    (*sptr) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls18));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_58(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 20);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 20));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_58(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 20);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 20));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_59(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls4;
+l_int32             wpls12;
+l_int32             wpls20;
+
+    wpls4 = 4 * wpls;
+    wpls12 = 12 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls20);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls20));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls20)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls20));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_59(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls4;
+l_int32             wpls12;
+l_int32             wpls20;
+
+    wpls4 = 4 * wpls;
+    wpls12 = 12 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls20);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls20));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls20)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls20));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_60(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 21);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 21));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 21) | (*(sptr + 1) >> 11)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    (*sptr) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_60(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 21);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 21));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 21) | (*(sptr - 1) << 11)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    (*sptr) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_61(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls7;
+l_int32             wpls14;
+l_int32             wpls21;
+
+    wpls7 = 7 * wpls;
+    wpls14 = 14 * wpls;
+    wpls21 = 21 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls21);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls21));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls21)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls7)) |
+                    (*sptr) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls21));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_61(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls7;
+l_int32             wpls14;
+l_int32             wpls21;
+
+    wpls7 = 7 * wpls;
+    wpls14 = 14 * wpls;
+    wpls21 = 21 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls21);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls21));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls21)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls7)) &
+                    (*sptr) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls21));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_62(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 20);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 20));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    (*sptr) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_62(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 20);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 20));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    (*sptr) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_63(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls10;
+l_int32             wpls20;
+
+    wpls10 = 10 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls20);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls20));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls20)) |
+                    (*(sptr + wpls10)) |
+                    (*sptr) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls20));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_63(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls10;
+l_int32             wpls20;
+
+    wpls10 = 10 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls20);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls20));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls20)) &
+                    (*(sptr - wpls10)) &
+                    (*sptr) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls20));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_64(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 20);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 19));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_64(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 20);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 19));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_65(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls6;
+l_int32             wpls7;
+l_int32             wpls19;
+l_int32             wpls20;
+
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls20);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls19));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls20)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls19));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_65(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls6;
+l_int32             wpls7;
+l_int32             wpls19;
+l_int32             wpls20;
+
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls20);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls19));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls20)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls19));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_66(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 23);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 22));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 23) | (*(sptr + 1) >> 9)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_66(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 23);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 22));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 23) | (*(sptr - 1) << 9)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_67(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls4;
+l_int32             wpls5;
+l_int32             wpls13;
+l_int32             wpls14;
+l_int32             wpls22;
+l_int32             wpls23;
+
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls22 = 22 * wpls;
+    wpls23 = 23 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls23);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls22));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls23)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls22));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_67(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls4;
+l_int32             wpls5;
+l_int32             wpls13;
+l_int32             wpls14;
+l_int32             wpls22;
+l_int32             wpls23;
+
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls22 = 22 * wpls;
+    wpls23 = 23 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls23);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls22));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls23)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls22));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_68(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 22);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 22));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 22) | (*(sptr + 1) >> 10)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    (*sptr) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_68(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 22);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 22));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 22) | (*(sptr - 1) << 10)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    (*sptr) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_69(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls11;
+l_int32             wpls22;
+
+    wpls11 = 11 * wpls;
+    wpls22 = 22 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls22);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls22));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls22)) |
+                    (*(sptr + wpls11)) |
+                    (*sptr) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls22));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_69(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls11;
+l_int32             wpls22;
+
+    wpls11 = 11 * wpls;
+    wpls22 = 22 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls22);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls22));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls22)) &
+                    (*(sptr - wpls11)) &
+                    (*sptr) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls22));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_70(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 24);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 24));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 24) | (*(sptr + 1) >> 8)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    (*sptr) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 24) | (*(sptr - 1) << 8));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_70(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 24);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 24));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 24) | (*(sptr - 1) << 8)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    (*sptr) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 24) | (*(sptr + 1) >> 8));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_71(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls8;
+l_int32             wpls16;
+l_int32             wpls24;
+
+    wpls8 = 8 * wpls;
+    wpls16 = 16 * wpls;
+    wpls24 = 24 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls24);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls24));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls24)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls8)) |
+                    (*sptr) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls24));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_71(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls8;
+l_int32             wpls16;
+l_int32             wpls24;
+
+    wpls8 = 8 * wpls;
+    wpls16 = 16 * wpls;
+    wpls24 = 24 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls24);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls24));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls24)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls8)) &
+                    (*sptr) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls24));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_72(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 25);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 25));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 25) | (*(sptr + 1) >> 7)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 25) | (*(sptr - 1) << 7));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_72(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 25);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 25));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 25) | (*(sptr - 1) << 7)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 25) | (*(sptr + 1) >> 7));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_73(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls5;
+l_int32             wpls15;
+l_int32             wpls25;
+
+    wpls5 = 5 * wpls;
+    wpls15 = 15 * wpls;
+    wpls25 = 25 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls25);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls25));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls25)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls25));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_73(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls5;
+l_int32             wpls15;
+l_int32             wpls25;
+
+    wpls5 = 5 * wpls;
+    wpls15 = 15 * wpls;
+    wpls25 = 25 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls25);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls25));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls25)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls25));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_74(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 27);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 18));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 18));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 27));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 27) | (*(sptr + 1) >> 5)) |
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    (*sptr) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) |
+                    ((*(sptr) >> 27) | (*(sptr - 1) << 5));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_74(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 27);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 18));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 18));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 27));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 27) | (*(sptr - 1) << 5)) &
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    (*sptr) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) &
+                    ((*(sptr) << 27) | (*(sptr + 1) >> 5));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_2_75(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls9;
+l_int32             wpls18;
+l_int32             wpls27;
+
+    wpls9 = 9 * wpls;
+    wpls18 = 18 * wpls;
+    wpls27 = 27 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls27);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls18));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls18));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls27));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls27)) |
+                    (*(sptr + wpls18)) |
+                    (*(sptr + wpls9)) |
+                    (*sptr) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls18)) |
+                    (*(sptr - wpls27));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_2_75(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls9;
+l_int32             wpls18;
+l_int32             wpls27;
+
+    wpls9 = 9 * wpls;
+    wpls18 = 18 * wpls;
+    wpls27 = 27 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls27);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls18));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls18));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls27));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls27)) &
+                    (*(sptr - wpls18)) &
+                    (*(sptr - wpls9)) &
+                    (*sptr) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls18)) &
+                    (*(sptr + wpls27));
+        }
+    }
+}
+
+#endif  /* L_HAVE_AVX2 */
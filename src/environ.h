@@ -256,6 +256,30 @@ typedef uintptr_t l_uintptr_t;
 #define  HAVE_DIRFD       0
 #endif /* ! HAVE_CONFIG_H */
 
+/*-------------------------------------------------------------------------*
+ * The generated dwa morphology code (fmorphgenlow.*.c, fhmtgenlow.*.c,    *
+ * dwacomblow.*.c) has inner loops on 32-bit words, 64-bit words and      *
+ * 256-bit AVX2 vectors.  The 256-bit routines are compiled on x86-64      *
+ * with a per-function target attribute, so the rest of the library does   *
+ * not need -mavx2, and they are only called if the cpu supports AVX2.     *
+ * To leave them out, compile with -DL_HAVE_AVX2=0.                        *
+ *-------------------------------------------------------------------------*/
+#if !defined(L_HAVE_AVX2)
+  #if (defined(__x86_64__) || defined(_M_X64)) && \
+      (defined(__GNUC__) || defined(__clang__) || \
+       (defined(_MSC_VER) && _MSC_VER >= 1800))
+  #define  L_HAVE_AVX2      1
+  #else
+  #define  L_HAVE_AVX2      0
+  #endif
+#endif  /* ! L_HAVE_AVX2 */
+
+#if L_HAVE_AVX2 && (defined(__GNUC__) || defined(__clang__))
+#define  L_TARGET_AVX2    __attribute__((target("avx2")))
+#else
+#define  L_TARGET_AVX2
+#endif
+
 /*--------------------------------------------------------------------*
  * It is desirable on Windows to have all temp files written to the same
  * subdirectory of the Windows <Temp> directory, because files under <Temp>
@@ -0,0 +1,565 @@
+/*====================================================================*
+ -  Copyright (C) 2001 Leptonica.  All rights reserved.
+ -
+ -  Redistribution and use in source and binary forms, with or without
+ -  modification, are permitted provided that the following conditions
+ -  are met:
+ -  1. Redistributions of source code must retain the above copyright
+ -     notice, this list of conditions and the following disclaimer.
+ -  2. Redistributions in binary form must reproduce the above
+ -     copyright notice, this list of conditions and the following
+ -     disclaimer in the documentation and/or other materials
+ -     provided with the distribution.
+ -
+ -  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ -  ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ -  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ -  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL ANY
+ -  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ -  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ -  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ -  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ -  OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ -  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ -  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *====================================================================*/
+
+/*!
+ * \file fftconv.c
+ * <pre>
+ *
+ *      FFT-based convolution and correlation (with Pix)
+ *          PIX          *pixConvolveFFT()
+ *
+ *      FFT-based convolution and correlation (with float arrays)
+ *          FPIX         *fpixConvolveFFT()
+ *          FPIX         *fpixCorrelateFFT()
+ *
+ *      Tiled correlation
+ *          static FPIX  *fpixCorrelateTiledLow()
+ *
+ *      Complex FFT
+ *          static L_FFTTAB  *fftTabCreate()
+ *          static void       fftTabDestroy()
+ *          static void       fft1dLow()
+ *          static void       fft2dLow()
+ *
+ *  For kernels with many elements, the direct convolution in
+ *  pixConvolve() and fpixConvolve() does sx * sy multiplications
+ *  for each pixel.  Here, the same result is computed with
+ *  a 2D FFT, for which the cost per pixel grows only as the log
+ *  of the tile size.  pixConvolve() and fpixConvolve() can be made
+ *  to call these functions when the kernel is large enough;
+ *  see l_setConvolveFFTThreshold().
+ *
+ *  The image is processed in tiles (the overlap-save method), so
+ *  the memory required does not depend on the image size.  Each
+ *  tile of the (bordered) input is transformed, multiplied by the
+ *  precomputed transform of the kernel, and inverse transformed.
+ *  Output pixels for which the circular convolution wraps around
+ *  are discarded, and the input tiles overlap by the kernel size
+ *  to compensate.  Because the input is real, two tiles are packed
+ *  into the real and imaginary parts of each complex transform.
+ *
+ *  The FFT is a simple iterative radix-2 transform on interleaved
+ *  (re, im) float arrays.  The tile dimensions are powers of 2.
+ * </pre>
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config_auto.h>
+#endif  /* HAVE_CONFIG_H */
+
+#include <math.h>
+#include <string.h>
+#include "allheaders.h"
+
+#ifndef M_PI
+#define M_PI    3.14159265358979323846264338327950
+#endif
+
+    /* Tables for a complex FFT of size n (a power of 2) */
+struct L_FftTab
+{
+    l_int32     n;           /* size of the transform                   */
+    l_int32    *bitrev;      /* bit-reversal permutation, size n        */
+    l_float32  *cosv;        /* cos(2 pi k / n), for k < n / 2          */
+    l_float32  *sinv;        /* sin(2 pi k / n), for k < n / 2          */
+};
+typedef struct L_FftTab  L_FFTTAB;
+
+    /* Minimum size of the FFT in each direction; the tile size is
+     * chosen to be at least twice the kernel size in each direction */
+static const l_int32  MinFftSize = 64;
+
+#ifndef  NO_CONSOLE_IO
+#define  DEBUG_FFT_TILES   0
+#endif  /* ~NO_CONSOLE_IO */
+
+static FPIX *fpixCorrelateTiledLow(FPIX *fpixb, L_KERNEL *kel,
+                                   l_int32 w, l_int32 h);
+static L_FFTTAB *fftTabCreate(l_int32 n);
+static void fftTabDestroy(L_FFTTAB **ptab);
+static void fft1dLow(l_float32 *data, L_FFTTAB *tab, l_int32 inverse);
+static void fft2dLow(l_float32 *data, L_FFTTAB *tabx, L_FFTTAB *taby,
+                     l_float32 *colbuf, l_int32 inverse);
+
+
+/*----------------------------------------------------------------------*
+ *               FFT-based convolution (with Pix)                       *
+ *----------------------------------------------------------------------*/
+/*!
+ * \brief   pixConvolveFFT()
+ *
+ * \param[in]    pixs       8, 16, 32 bpp; no colormap
+ * \param[in]    kel        kernel
+ * \param[in]    outdepth   of pixd: 8, 16 or 32
+ * \param[in]    normflag   1 to normalize kernel to unit sum; 0 otherwise
+ * \return  pixd 8, 16 or 32 bpp, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This gives the same result as pixConvolve(), except for
+ *          rounding, but is much faster for large kernels.  As with
+ *          pixConvolve(), negative results are replaced by their
+ *          absolute value, and a mirrored border is used.
+ *      (2) Results that are too large for %outdepth are clipped to
+ *          the maximum value.
+ *      (3) Subsampling with l_setConvolveSampling() is ignored.
+ * </pre>
+ */
+PIX *
+pixConvolveFFT(PIX       *pixs,
+               L_KERNEL  *kel,
+               l_int32    outdepth,
+               l_int32    normflag)
+{
+l_int32  d;
+FPIX    *fpixs, *fpixd;
+PIX     *pixd;
+
+    if (!pixs)
+        return (PIX *)ERROR_PTR("pixs not defined", __func__, NULL);
+    if (pixGetColormap(pixs))
+        return (PIX *)ERROR_PTR("pixs has colormap", __func__, NULL);
+    d = pixGetDepth(pixs);
+    if (d != 8 && d != 16 && d != 32)
+        return (PIX *)ERROR_PTR("pixs not 8, 16, or 32 bpp", __func__, NULL);
+    if (outdepth != 8 && outdepth != 16 && outdepth != 32)
+        return (PIX *)ERROR_PTR("outdepth not 8, 16, or 32", __func__, NULL);
+    if (!kel)
+        return (PIX *)ERROR_PTR("kel not defined", __func__, NULL);
+
+    if ((fpixs = pixConvertToFPix(pixs, 1)) == NULL)
+        return (PIX *)ERROR_PTR("fpixs not made", __func__, NULL);
+    fpixd = fpixConvolveFFT(fpixs, kel, normflag);
+    fpixDestroy(&fpixs);
+    if (!fpixd)
+        return (PIX *)ERROR_PTR("fpixd not made", __func__, NULL);
+    pixd = fpixConvertToPix(fpixd, outdepth, L_TAKE_ABSVAL, 0);
+    fpixDestroy(&fpixd);
+    return pixd;
+}
+
+
+/*----------------------------------------------------------------------*
+ *             FFT-based convolution (with float arrays)                *
+ *----------------------------------------------------------------------*/
+/*!
+ * \brief   fpixConvolveFFT()
+ *
+ * \param[in]    fpixs      32 bit float array
+ * \param[in]    kel        kernel
+ * \param[in]    normflag   1 to normalize kernel to unit sum; 0 otherwise
+ * \return  fpixd 32 bit float array, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This gives the same result as fpixConvolve(), except for
+ *          rounding, using the FFT.  It uses a mirrored border.
+ *      (2) Subsampling with l_setConvolveSampling() is ignored.
+ * </pre>
+ */
+FPIX *
+fpixConvolveFFT(FPIX      *fpixs,
+                L_KERNEL  *kel,
+                l_int32    normflag)
+{
+L_KERNEL  *keli;
+FPIX      *fpixd;
+
+    if (!fpixs)
+        return (FPIX *)ERROR_PTR("fpixs not defined", __func__, NULL);
+    if (!kel)
+        return (FPIX *)ERROR_PTR("kel not defined", __func__, NULL);
+
+        /* Convolution is correlation with the inverted kernel */
+    if ((keli = kernelInvert(kel)) == NULL)
+        return (FPIX *)ERROR_PTR("keli not made", __func__, NULL);
+    fpixd = fpixCorrelateFFT(fpixs, keli, normflag);
+    kernelDestroy(&keli);
+    return fpixd;
+}
+
+
+/*!
+ * \brief   fpixCorrelateFFT()
+ *
+ * \param[in]    fpixs      32 bit float array
+ * \param[in]    kel        kernel (template)
+ * \param[in]    normflag   1 to normalize kernel to unit sum; 0 otherwise
+ * \return  fpixd 32 bit float array, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This computes the correlation of fpixs with the kernel:
+ *             d(i,j) = Sum[k,m] s(i + k - cy, j + m - cx) * kel(k,m)
+ *          where (cx, cy) is the kernel origin.  This is the matched
+ *          filter response for a template in %kel.  Correlation with
+ *          a kernel is the same as convolution with the inverted kernel.
+ *      (2) Values outside fpixs are taken from a mirrored border.
+ *      (3) The work is done in tiles, so memory use is proportional
+ *          to the square of the kernel size, not the image size.
+ * </pre>
+ */
+FPIX *
+fpixCorrelateFFT(FPIX      *fpixs,
+                 L_KERNEL  *kel,
+                 l_int32    normflag)
+{
+l_int32    w, h, sx, sy, cx, cy;
+L_KERNEL  *keln;
+FPIX      *fpixb, *fpixd;
+
+    if (!fpixs)
+        return (FPIX *)ERROR_PTR("fpixs not defined", __func__, NULL);
+    if (!kel)
+        return (FPIX *)ERROR_PTR("kel not defined", __func__, NULL);
+
+    if (normflag)
+        keln = kernelNormalize(kel, 1.0);
+    else
+        keln = kernelCopy(kel);
+    if (!keln)
+        return (FPIX *)ERROR_PTR("keln not made", __func__, NULL);
+    kernelGetParameters(keln, &sy, &sx, &cy, &cx);
+
+    fpixGetDimensions(fpixs, &w, &h);
+    fpixb = fpixAddMirroredBorder(fpixs, cx, sx - cx, cy, sy - cy);
+    if (!fpixb) {
+        kernelDestroy(&keln);
+        return (FPIX *)ERROR_PTR("fpixb not made", __func__, NULL);
+    }
+
+    fpixd = fpixCorrelateTiledLow(fpixb, keln, w, h);
+    if (fpixd) fpixCopyResolution(fpixd, fpixs);
+    kernelDestroy(&keln);
+    fpixDestroy(&fpixb);
+    return fpixd;
+}
+
+
+/*----------------------------------------------------------------------*
+ *                          Tiled correlation                           *
+ *----------------------------------------------------------------------*/
+/*!
+ * \brief   fpixCorrelateTiledLow()
+ *
+ * \param[in]    fpixb     bordered input; at least (w + sx - 1) x (h + sy - 1)
+ * \param[in]    kel       correlation kernel, sx x sy
+ * \param[in]    w, h      size of output
+ * \return  fpixd   w x h, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This computes d(i,j) = Sum[k,m] b(i + k, j + m) * kel(k,m).
+ *      (2) The FFT size (nx, ny) is a power of 2 in each direction, and
+ *          the output tiles are (nx - sx + 1) x (ny - sy + 1).  With
+ *          the input in the real part and the kernel K real, the
+ *          circular correlation is IFFT(FFT(b) * conj(FFT(K))), and
+ *          the values with i <= ny - sy and j <= nx - sx do not wrap.
+ *      (3) By linearity, the real and imaginary parts of the result
+ *          are the correlations of the real and imaginary parts of
+ *          the input, so two tiles are done for each pair of transforms.
+ * </pre>
+ */
+static FPIX *
+fpixCorrelateTiledLow(FPIX      *fpixb,
+                      L_KERNEL  *kel,
+                      l_int32    w,
+                      l_int32    h)
+{
+l_int32     i, j, k, sx, sy, nx, ny, tw, th, ntx, nty, ntiles, t;
+l_int32     wb, hb, wplb, wpld, x0, y0, xe, ye, ncopy, part;
+l_float32   re, im, kre, kim, scale;
+l_float32  *datab, *datad, *lineb, *lined, *buf, *kbuf, *colbuf, *pbuf;
+L_FFTTAB   *tabx, *taby;
+FPIX       *fpixd;
+
+    kernelGetParameters(kel, &sy, &sx, NULL, NULL);
+    fpixGetDimensions(fpixb, &wb, &hb);
+    if (wb < w + sx - 1 || hb < h + sy - 1)
+        return (FPIX *)ERROR_PTR("fpixb too small", __func__, NULL);
+
+        /* Choose the transform size in each direction: at least twice
+         * the kernel size, but no larger than needed for the image */
+    for (nx = MinFftSize; nx < 2 * sx; nx *= 2) ;
+    while (nx / 2 >= w + sx - 1 && nx / 2 >= sx) nx /= 2;
+    for (ny = MinFftSize; ny < 2 * sy; ny *= 2) ;
+    while (ny / 2 >= h + sy - 1 && ny / 2 >= sy) ny /= 2;
+    tw = nx - sx + 1;
+    th = ny - sy + 1;
+    ntx = (w + tw - 1) / tw;
+    nty = (h + th - 1) / th;
+    ntiles = ntx * nty;
+#if DEBUG_FFT_TILES
+    lept_stderr("fft size: %d x %d; tiles: %d x %d of %d x %d\n",
+                nx, ny, ntx, nty, tw, th);
+#endif  /* DEBUG_FFT_TILES */
+
+    fpixd = NULL;
+    buf = kbuf = colbuf = NULL;
+    tabx = fftTabCreate(nx);
+    taby = fftTabCreate(ny);
+    buf = (l_float32 *)LEPT_CALLOC(2 * (size_t)nx * ny, sizeof(l_float32));
+    kbuf = (l_float32 *)LEPT_CALLOC(2 * (size_t)nx * ny, sizeof(l_float32));
+    colbuf = (l_float32 *)LEPT_CALLOC(2 * (size_t)ny, sizeof(l_float32));
+    if (!tabx || !taby || !buf || !kbuf || !colbuf) {
+        L_ERROR("fft arrays not made\n", __func__);
+        goto cleanup;
+    }
+
+        /* Transform of the kernel */
+    for (i = 0; i < sy; i++) {
+        for (j = 0; j < sx; j++)
+            kbuf[2 * (i * nx + j)] = kel->data[i][j];
+    }
+    fft2dLow(kbuf, tabx, taby, colbuf, 0);
+
+    if ((fpixd = fpixCreate(w, h)) == NULL) {
+        L_ERROR("fpixd not made\n", __func__);
+        goto cleanup;
+    }
+    datab = fpixGetData(fpixb);
+    wplb = fpixGetWpl(fpixb);
+    datad = fpixGetData(fpixd);
+    wpld = fpixGetWpl(fpixd);
+    scale = 1.0f / ((l_float32)nx * ny);
+
+        /* Process the tiles in pairs */
+    for (t = 0; t < ntiles; t += 2) {
+        memset(buf, 0, 2 * (size_t)nx * ny * sizeof(l_float32));
+        for (part = 0; part < 2 && t + part < ntiles; part++) {
+            x0 = ((t + part) % ntx) * tw;
+            y0 = ((t + part) / ntx) * th;
+            ye = L_MIN(y0 + ny, hb);
+            ncopy = L_MIN(nx, wb - x0);
+            for (i = y0; i < ye; i++) {
+                lineb = datab + (size_t)i * wplb + x0;
+                pbuf = buf + 2 * (size_t)(i - y0) * nx + part;
+                for (j = 0; j < ncopy; j++)
+                    pbuf[2 * j] = lineb[j];
+            }
+        }
+
+            /* Multiply by the conjugate of the kernel transform */
+        fft2dLow(buf, tabx, taby, colbuf, 0);
+        for (k = 0; k < nx * ny; k++) {
+            re = buf[2 * k];
+            im = buf[2 * k + 1];
+            kre = kbuf[2 * k];
+            kim = kbuf[2 * k + 1];
+            buf[2 * k] = (re * kre + im * kim) * scale;
+            buf[2 * k + 1] = (im * kre - re * kim) * scale;
+        }
+        fft2dLow(buf, tabx, taby, colbuf, 1);
+
+            /* Save the valid part of each tile */
+        for (part = 0; part < 2 && t + part < ntiles; part++) {
+            x0 = ((t + part) % ntx) * tw;
+            y0 = ((t + part) / ntx) * th;
+            xe = L_MIN(x0 + tw, w);
+            ye = L_MIN(y0 + th, h);
+            for (i = y0; i < ye; i++) {
+                lined = datad + (size_t)i * wpld;
+                pbuf = buf + 2 * (size_t)(i - y0) * nx + part;
+                for (j = x0; j < xe; j++)
+                    lined[j] = pbuf[2 * (j - x0)];
+            }
+        }
+    }
+
+cleanup:
+    fftTabDestroy(&tabx);
+    fftTabDestroy(&taby);
+    LEPT_FREE(buf);
+    LEPT_FREE(kbuf);
+    LEPT_FREE(colbuf);
+    return fpixd;
+}
+
+
+/*----------------------------------------------------------------------*
+ *                             Complex FFT                              *
+ *----------------------------------------------------------------------*/
+/*!
+ * \brief   fftTabCreate()
+ *
+ * \param[in]    n      size of transform; a power of 2
+ * \return  tab, or NULL on error
+ */
+static L_FFTTAB *
+fftTabCreate(l_int32  n)
+{
+l_int32    i, j, nbits;
+l_float64  angle;
+L_FFTTAB  *tab;
+
+    if (n < 2 || (n & (n - 1)) != 0)
+        return (L_FFTTAB *)ERROR_PTR("n not a power of 2", __func__, NULL);
+
+    tab = (L_FFTTAB *)LEPT_CALLOC(1, sizeof(L_FFTTAB));
+    tab->n = n;
+    tab->bitrev = (l_int32 *)LEPT_CALLOC(n, sizeof(l_int32));
+    tab->cosv = (l_float32 *)LEPT_CALLOC(n / 2, sizeof(l_float32));
+    tab->sinv = (l_float32 *)LEPT_CALLOC(n / 2, sizeof(l_float32));
+    if (!tab->bitrev || !tab->cosv || !tab->sinv) {
+        fftTabDestroy(&tab);
+        return (L_FFTTAB *)ERROR_PTR("arrays not made", __func__, NULL);
+    }
+
+    for (nbits = 0; (1 << nbits) < n; nbits++) ;
+    for (i = 0; i < n; i++) {
+        tab->bitrev[i] = 0;
+        for (j = 0; j < nbits; j++) {
+            if (i & (1 << j))
+                tab->bitrev[i] |= 1 << (nbits - 1 - j);
+        }
+    }
+    for (i = 0; i < n / 2; i++) {
+        angle = 2.0 * M_PI * i / n;
+        tab->cosv[i] = (l_float32)cos(angle);
+        tab->sinv[i] = (l_float32)sin(angle);
+    }
+    return tab;
+}
+
+
+/*!
+ * \brief   fftTabDestroy()
+ *
+ * \param[in,out]   ptab    will be set to null before returning
+ * \return  void
+ */
+static void
+fftTabDestroy(L_FFTTAB  **ptab)
+{
+L_FFTTAB  *tab;
+
+    if (!ptab) return;
+    if ((tab = *ptab) == NULL) return;
+    LEPT_FREE(tab->bitrev);
+    LEPT_FREE(tab->cosv);
+    LEPT_FREE(tab->sinv);
+    LEPT_FREE(tab);
+    *ptab = NULL;
+}
+
+
+/*!
+ * \brief   fft1dLow()
+ *
+ * \param[in]    data      n complex values, as interleaved (re, im)
+ * \param[in]    tab       tables for size n
+ * \param[in]    inverse   1 for inverse transform; 0 for forward
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) In-place radix-2 decimation-in-time transform.  The forward
+ *          transform uses exp(-2 pi i jk / n).  Neither direction
+ *          is scaled.
+ * </pre>
+ */
+static void
+fft1dLow(l_float32  *data,
+         L_FFTTAB   *tab,
+         l_int32     inverse)
+{
+l_int32     n, i, j, k, len, half, step;
+l_float32   wr, wi, tr, ti, ur, ui, sign;
+l_float32  *p, *q;
+
+    n = tab->n;
+    for (i = 0; i < n; i++) {
+        j = tab->bitrev[i];
+        if (j > i) {
+            tr = data[2 * i];
+            ti = data[2 * i + 1];
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = tr;
+            data[2 * j + 1] = ti;
+        }
+    }
+
+    sign = (inverse) ? 1.0f : -1.0f;
+    for (len = 2; len <= n; len *= 2) {
+        half = len / 2;
+        step = n / len;
+        for (i = 0; i < n; i += len) {
+            p = data + 2 * i;
+            q = p + 2 * half;
+            for (k = 0; k < half; k++) {
+                wr = tab->cosv[k * step];
+                wi = sign * tab->sinv[k * step];
+                ur = q[2 * k];
+                ui = q[2 * k + 1];
+                tr = ur * wr - ui * wi;
+                ti = ur * wi + ui * wr;
+                q[2 * k] = p[2 * k] - tr;
+                q[2 * k + 1] = p[2 * k + 1] - ti;
+                p[2 * k] += tr;
+                p[2 * k + 1] += ti;
+            }
+        }
+    }
+}
+
+
+/*!
+ * \brief   fft2dLow()
+ *
+ * \param[in]    data      nx * ny complex values, row-major, interleaved
+ * \param[in]    tabx      tables for size nx
+ * \param[in]    taby      tables for size ny
+ * \param[in]    colbuf    buffer for 2 * ny floats
+ * \param[in]    inverse   1 for inverse transform; 0 for forward
+ * \return  void
+ */
+static void
+fft2dLow(l_float32  *data,
+         L_FFTTAB   *tabx,
+         L_FFTTAB   *taby,
+         l_float32  *colbuf,
+         l_int32     inverse)
+{
+l_int32     i, j, nx, ny;
+l_float32  *p;
+
+    nx = tabx->n;
+    ny = taby->n;
+    for (i = 0; i < ny; i++)
+        fft1dLow(data + 2 * (size_t)i * nx, tabx, inverse);
+    for (j = 0; j < nx; j++) {
+        for (i = 0, p = data + 2 * j; i < ny; i++, p += 2 * nx) {
+            colbuf[2 * i] = p[0];
+            colbuf[2 * i + 1] = p[1];
+        }
+        fft1dLow(colbuf, taby, inverse);
+        for (i = 0, p = data + 2 * j; i < ny; i++, p += 2 * nx) {
+            p[0] = colbuf[2 * i];
+            p[1] = colbuf[2 * i + 1];
+        }
+    }
+}
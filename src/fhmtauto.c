@@ -38,6 +38,7 @@
  *       static SARRAY      *sarrayMakeWplsCode()
  *       static SARRAY      *sarrayMakeInnerLoopDWACode()
  *       static char        *makeBarrelshiftString()
+ *       static char        *makeWideBarrelshiftString()
  *
  *    This automatically generates dwa code for the hit-miss transform.
  *    Here's a road map for how it all works.
@@ -89,6 +90,11 @@
  *        verifies the correctness of the implementation by
  *        comparing the dwa result with that of full-image
  *        rasterops.
+ *
+ *    (5) As with fmorphautogen(), the low-level file has versions of
+ *        the code for each sel with inner loops on 32-bit words,
+ *        64-bit words and 256-bit AVX2 vectors, and the dispatcher
+ *        fhmtgen_low_*() picks one with l_getDwaWordWidth().
  * </pre>
  */
 
@@ -107,42 +113,16 @@
 
 #define L_BUF_SIZE 512
 
+    /* Word widths of the code generated besides the 32-bit code */
+static const l_int32  WideWidths[2] = {64, 256};
+
 static char * makeBarrelshiftString(l_int32 delx, l_int32 dely, l_int32 type);
-static SARRAY * sarrayMakeInnerLoopDWACode(SEL *sel, l_int32 nhits, l_int32 nmisses);
+static char * makeWideBarrelshiftString(l_int32 delx, l_int32 dely,
+                                        l_int32 width);
+static SARRAY * sarrayMakeInnerLoopDWACode(SEL *sel, l_int32 nhits,
+                                           l_int32 nmisses, l_int32 width);
 static SARRAY * sarrayMakeWplsCode(SEL *sel);
 
-static char wpldecls[][60] = {
-            "l_int32             wpls2;",
-            "l_int32             wpls2, wpls3;",
-            "l_int32             wpls2, wpls3, wpls4;",
-            "l_int32             wpls5;",
-            "l_int32             wpls5, wpls6;",
-            "l_int32             wpls5, wpls6, wpls7;",
-            "l_int32             wpls5, wpls6, wpls7, wpls8;",
-            "l_int32             wpls9;",
-            "l_int32             wpls9, wpls10;",
-            "l_int32             wpls9, wpls10, wpls11;",
-            "l_int32             wpls9, wpls10, wpls11, wpls12;",
-            "l_int32             wpls13;",
-            "l_int32             wpls13, wpls14;",
-            "l_int32             wpls13, wpls14, wpls15;",
-            "l_int32             wpls13, wpls14, wpls15, wpls16;",
-            "l_int32             wpls17;",
-            "l_int32             wpls17, wpls18;",
-            "l_int32             wpls17, wpls18, wpls19;",
-            "l_int32             wpls17, wpls18, wpls19, wpls20;",
-            "l_int32             wpls21;",
-            "l_int32             wpls21, wpls22;",
-            "l_int32             wpls21, wpls22, wpls23;",
-            "l_int32             wpls21, wpls22, wpls23, wpls24;",
-            "l_int32             wpls25;",
-            "l_int32             wpls25, wpls26;",
-            "l_int32             wpls25, wpls26, wpls27;",
-            "l_int32             wpls25, wpls26, wpls27, wpls28;",
-            "l_int32             wpls29;",
-            "l_int32             wpls29, wpls30;",
-            "l_int32             wpls29, wpls30, wpls31;"};
-
 static char wpldefs[][24] = {
             "    wpls2 = 2 * wpls;",
             "    wpls3 = 3 * wpls;",
@@ -427,6 +407,9 @@ SARRAY  *sa1, *sa2, *sa3;
  *      (3) If filename == NULL, the output file is fhmtgenlow.[n].c,
  *          where [n] is equal to the %fileindex parameter.
  *      (4) If filename != NULL, the output file is [filename]low.[n].c.
+ *      (5) Each sel gets three versions of the low-level function,
+ *          for 32-bit words, 64-bit words and 256-bit vectors;
+ *          namely fhmt_[n]_*(), fhmt64_[n]_*() and fhmt256_[n]_*().
  * </pre>
  */
 l_ok
@@ -439,9 +422,18 @@ char    *str_doc1, *str_doc2, *str_doc3, *str_def1;
 char     bigbuf[L_BUF_SIZE];
 char     breakstring[] = "        break;";
 char     staticstring[] = "static void";
-l_int32  i, k, l, nsels, nbytes, nhits, nmisses;
+char     staticavx2string[] = "static void L_TARGET_AVX2";
+char     ifavx2string[] = "#if L_HAVE_AVX2";
+char     endifavx2string[] = "#endif  /* L_HAVE_AVX2 */";
+char     nohitsstring[] = "    "
+                 "lept_stderr(\"Error in HMT: no hits in sel!\\n\");\n}\n\n";
+const char  *indent;
+l_int32  i, k, l, m, nsels, nbytes, nhits, nmisses;
 l_int32  actstart, end, newstart;
 l_int32  argstart, argend, loopstart, loopend, finalstart, finalend;
+l_int32  warg[2], wargend[2], wloop[2], wloopend[2], wmid[2], wmidend[2];
+l_int32  wfinal[2], wfinalend[2];
+l_int32  ifstart, ifend, endifstart, endifend;
 size_t   size;
 SARRAY  *sa1, *sa2, *sa3, *sa4, *sa5, *sa6;
 SEL     *sel;
@@ -461,8 +453,9 @@ SEL     *sel;
     if (!sa1)
         return ERROR_INT("sa1 not made", __func__, 1);
 
-        /* Make the array of static function names */
-    if ((sa2 = sarrayCreate(nsels)) == NULL) {
+        /* Make the array of static function names: first the 32-bit
+         * functions, then the 64-bit and the 256-bit ones */
+    if ((sa2 = sarrayCreate(3 * nsels)) == NULL) {
         sarrayDestroy(&sa1);
         return ERROR_INT("sa2 not made", __func__, 1);
     }
@@ -470,14 +463,28 @@ SEL     *sel;
         sprintf(bigbuf, "fhmt_%d_%d", fileindex, i);
         sarrayAddString(sa2, bigbuf, L_COPY);
     }
+    for (k = 0; k < 2; k++) {
+        for (i = 0; i < nsels; i++) {
+            sprintf(bigbuf, "fhmt%d_%d_%d", WideWidths[k], fileindex, i);
+            sarrayAddString(sa2, bigbuf, L_COPY);
+        }
+    }
 
         /* Make the static prototype strings */
-    sa3 = sarrayCreate(2 * nsels);  /* should be ok */
-    for (i = 0; i < nsels; i++) {
+    sa3 = sarrayCreate(3 * nsels + 2);  /* should be ok */
+    for (i = 0; i < 3 * nsels; i++) {
         fname = sarrayGetString(sa2, i, L_NOCOPY);
-        sprintf(bigbuf, "static void  %s%s", fname, PROTOARGS);
+        if (i < 2 * nsels) {
+            sprintf(bigbuf, "static void  %s%s", fname, PROTOARGS);
+        } else {
+            if (i == 2 * nsels)
+                sarrayAddString(sa3, ifavx2string, L_COPY);
+            sprintf(bigbuf, "static void  L_TARGET_AVX2 %s%s",
+                    fname, PROTOARGS);
+        }
         sarrayAddString(sa3, bigbuf, L_COPY);
     }
+    sarrayAddString(sa3, endifavx2string, L_COPY);
 
         /* Make strings containing function names */
     sprintf(bigbuf, " *             l_int32    fhmtgen_low_%d()",
@@ -502,7 +509,7 @@ SEL     *sel;
     sarrayAppendRange(sa4, sa1, actstart, end);
 
         /* Insert static protos */
-    for (i = 0; i < nsels; i++) {
+    for (i = 0; i < sarrayGetCount(sa3); i++) {
         if ((linestr = sarrayGetString(sa3, i, L_COPY)) == NULL) {
             sarrayDestroy(&sa1);
             sarrayDestroy(&sa2);
@@ -529,19 +536,25 @@ SEL     *sel;
     sarrayParseRange(sa1, newstart, &actstart, &end, &newstart, "--", 0);
     sarrayAppendRange(sa4, sa1, actstart, end);
 
-        /* Generate and insert the dispatcher code */
-    for (i = 0; i < nsels; i++) {
-        sprintf(bigbuf, "    case %d:", i);
-        sarrayAddString(sa4, bigbuf, L_COPY);
-        sprintf(bigbuf, "        %s(datad, w, h, wpld, datas, wpls);",
-               sarrayGetString(sa2, i, L_NOCOPY));
-        sarrayAddString(sa4, bigbuf, L_COPY);
-        sarrayAddString(sa4, breakstring, L_COPY);
-    }
+        /* Generate and insert the dispatcher code, for the 256-bit,
+         * 64-bit and 32-bit functions in that order */
+    for (k = 2; k >= 0; k--) {
+        indent = (k > 0) ? "    " : "";
+        for (i = 0; i < nsels; i++) {
+            sprintf(bigbuf, "%s    case %d:", indent, i);
+            sarrayAddString(sa4, bigbuf, L_COPY);
+            sprintf(bigbuf, "%s        %s(datad, w, h, wpld, datas, wpls);",
+                   indent, sarrayGetString(sa2, k * nsels + i, L_NOCOPY));
+            sarrayAddString(sa4, bigbuf, L_COPY);
+            sprintf(bigbuf, "%s%s", indent, breakstring);
+            sarrayAddString(sa4, bigbuf, L_COPY);
+        }
 
-        /* Finish the dispatcher and introduce the low-level code */
-    sarrayParseRange(sa1, newstart, &actstart, &end, &newstart, "--", 0);
-    sarrayAppendRange(sa4, sa1, actstart, end);
+            /* Finish this switch; after the last one, finish the
+             * dispatcher and introduce the low-level code */
+        sarrayParseRange(sa1, newstart, &actstart, &end, &newstart, "--", 0);
+        sarrayAppendRange(sa4, sa1, actstart, end);
+    }
 
         /* Get the range for the args common to all functions */
     sarrayParseRange(sa1, newstart, &argstart, &argend, &newstart, "--", 0);
@@ -552,6 +565,24 @@ SEL     *sel;
         /* Get the range for the ending code common to all functions */
     sarrayParseRange(sa1, newstart, &finalstart, &finalend, &newstart, "--", 0);
 
+        /* Get the same ranges for the 64-bit and 256-bit functions.
+         * These have a 32-bit loop to finish each line, in the range
+         * between the wide loop and the ending code. */
+    for (k = 0; k < 2; k++) {
+        sarrayParseRange(sa1, newstart, &warg[k], &wargend[k],
+                         &newstart, "--", 0);
+        sarrayParseRange(sa1, newstart, &wloop[k], &wloopend[k],
+                         &newstart, "--", 0);
+        sarrayParseRange(sa1, newstart, &wmid[k], &wmidend[k],
+                         &newstart, "--", 0);
+        sarrayParseRange(sa1, newstart, &wfinal[k], &wfinalend[k],
+                         &newstart, "--", 0);
+        if (k == 0)  /* the #if that encloses the 256-bit code */
+            sarrayParseRange(sa1, newstart, &ifstart, &ifend,
+                             &newstart, "--", 0);
+    }
+    sarrayParseRange(sa1, newstart, &endifstart, &endifend, &newstart, "--", 0);
+
         /* Do all the static functions */
     for (i = 0; i < nsels; i++) {
             /* Generate the function header and add the common args */
@@ -585,9 +616,7 @@ SEL     *sel;
             }
         }
         if (nhits == 0) {
-            linestr = stringNew("    "
-                "lept_stderr(\"Error in HMT: no hits in sel!\\n\");\n}\n\n");
-            sarrayAddString(sa4, linestr, L_INSERT);
+            sarrayAddString(sa4, nohitsstring, L_COPY);
             continue;
         }
 
@@ -595,7 +624,8 @@ SEL     *sel;
         sarrayAppendRange(sa4, sa1, loopstart, loopend);
 
             /* Insert barrel-op code for *dptr */
-        if ((sa6 = sarrayMakeInnerLoopDWACode(sel, nhits, nmisses)) == NULL) {
+        if ((sa6 = sarrayMakeInnerLoopDWACode(sel, nhits, nmisses, 32))
+                == NULL) {
             sarrayDestroy(&sa1);
             sarrayDestroy(&sa2);
             sarrayDestroy(&sa3);
@@ -609,6 +639,50 @@ SEL     *sel;
         sarrayAppendRange(sa4, sa1, finalstart, finalend);
     }
 
+        /* Do the 64-bit and 256-bit versions.  The sels have all
+         * been checked above. */
+    for (k = 0; k < 2; k++) {
+        if (k == 1)
+            sarrayAppendRange(sa4, sa1, ifstart, ifend);
+        for (i = 0; i < nsels; i++) {
+            sarrayAddString(sa4, (k == 0) ? staticstring : staticavx2string,
+                            L_COPY);
+            fname = sarrayGetString(sa2, (k + 1) * nsels + i, L_NOCOPY);
+            sprintf(bigbuf, "%s(l_uint32  *datad,", fname);
+            sarrayAddString(sa4, bigbuf, L_COPY);
+            sarrayAppendRange(sa4, sa1, warg[k], wargend[k]);
+            sel = selaGetSel(sela, i);
+            sa5 = sarrayMakeWplsCode(sel);
+            sarrayJoin(sa4, sa5);
+            sarrayDestroy(&sa5);
+            nhits = 0;
+            nmisses = 0;
+            for (l = 0; l < sel->sy; l++) {
+                for (m = 0; m < sel->sx; m++) {
+                    if (sel->data[l][m] == 1)
+                        nhits++;
+                    else if (sel->data[l][m] == 2)
+                        nmisses++;
+                }
+            }
+            if (nhits == 0) {
+                sarrayAddString(sa4, nohitsstring, L_COPY);
+                continue;
+            }
+            sarrayAppendRange(sa4, sa1, wloop[k], wloopend[k]);
+            sa6 = sarrayMakeInnerLoopDWACode(sel, nhits, nmisses,
+                                             WideWidths[k]);
+            sarrayJoin(sa4, sa6);
+            sarrayDestroy(&sa6);
+            sarrayAppendRange(sa4, sa1, wmid[k], wmidend[k]);
+            sa6 = sarrayMakeInnerLoopDWACode(sel, nhits, nmisses, 32);
+            sarrayJoin(sa4, sa6);
+            sarrayDestroy(&sa6);
+            sarrayAppendRange(sa4, sa1, wfinal[k], wfinalend[k]);
+        }
+    }
+    sarrayAppendRange(sa4, sa1, endifstart, endifend);
+
         /* Output to file */
     filestr = sarrayToString(sa4, 1);
     nbytes = strlen(filestr);
@@ -632,56 +706,72 @@ SEL     *sel;
  *--------------------------------------------------------------------------*/
 /*!
  * \brief   sarrayMakeWplsCode()
+ *
+ * <pre>
+ * Notes:
+ *      (1) Only the wplsN for vertical offsets N >= 2 that are used
+ *          by a hit or miss are declared and set.  Hit-miss sels often
+ *          have empty rows, and unused offsets would give
+ *          set-but-unused warnings in the generated code.
+ * </pre>
  */
 static SARRAY *
 sarrayMakeWplsCode(SEL  *sel)
 {
 char     emptystring[] = "";
-l_int32  i, j, ymax, dely;
+char     bigbuf[L_BUF_SIZE];
+l_int32  i, j, group, len, dely;
+l_int32  used[32];
 SARRAY  *sa;
 
     if (!sel)
         return (SARRAY *)ERROR_PTR("sel not defined", __func__, NULL);
 
-    ymax = 0;
+    for (i = 0; i < 32; i++)
+        used[i] = 0;
     for (i = 0; i < sel->sy; i++) {
         for (j = 0; j < sel->sx; j++) {
             if (sel->data[i][j] == 1 || sel->data[i][j] == 2) {
                 dely = L_ABS(i - sel->cy);
-                ymax = L_MAX(ymax, dely);
+                if (dely > 31) {
+                    L_WARNING("dely > 31; truncating to 31\n", __func__);
+                    dely = 31;
+                }
+                used[dely] = 1;
             }
         }
     }
-    if (ymax > 31) {
-        L_WARNING("ymax > 31; truncating to 31\n", __func__);
-        ymax = 31;
-    }
 
     sa = sarrayCreate(0);
 
-        /* Declarations */
-    if (ymax > 4)
-        sarrayAddString(sa, wpldecls[2], L_COPY);
-    if (ymax > 8)
-        sarrayAddString(sa, wpldecls[6], L_COPY);
-    if (ymax > 12)
-        sarrayAddString(sa, wpldecls[10], L_COPY);
-    if (ymax > 16)
-        sarrayAddString(sa, wpldecls[14], L_COPY);
-    if (ymax > 20)
-        sarrayAddString(sa, wpldecls[18], L_COPY);
-    if (ymax > 24)
-        sarrayAddString(sa, wpldecls[22], L_COPY);
-    if (ymax > 28)
-        sarrayAddString(sa, wpldecls[26], L_COPY);
-    if (ymax > 1)
-        sarrayAddString(sa, wpldecls[ymax - 2], L_COPY);
+        /* Declarations, on lines for wpls2-4, wpls5-8, wpls9-12, ... */
+    group = -1;
+    len = 0;
+    for (i = 2; i < 32; i++) {
+        if (!used[i]) continue;
+        if ((i - 1) / 4 != group) {
+            if (len > 0) {
+                sprintf(bigbuf + len, ";");
+                sarrayAddString(sa, bigbuf, L_COPY);
+            }
+            group = (i - 1) / 4;
+            len = sprintf(bigbuf, "l_int32             wpls%d", i);
+        } else {
+            len += sprintf(bigbuf + len, ", wpls%d", i);
+        }
+    }
+    if (len > 0) {
+        sprintf(bigbuf + len, ";");
+        sarrayAddString(sa, bigbuf, L_COPY);
+    }
 
     sarrayAddString(sa, emptystring, L_COPY);
 
         /* Definitions */
-    for (i = 2; i <= ymax; i++)
-        sarrayAddString(sa, wpldefs[i - 2], L_COPY);
+    for (i = 2; i < 32; i++) {
+        if (used[i])
+            sarrayAddString(sa, wpldefs[i - 2], L_COPY);
+    }
 
     return sa;
 }
@@ -689,21 +779,35 @@ SARRAY  *sa;
 
 /*!
  * \brief   sarrayMakeInnerLoopDWACode()
+ *
+ * <pre>
+ * Notes:
+ *      (1) For %width = 32 this makes the expression for *dptr, and
+ *          for %width = 64 the same expression for the l_uint64 word.
+ *      (2) For %width = 256 it makes a sequence of statements that
+ *          accumulate the result in the __m256i vec.  Misses are
+ *          removed with _mm256_andnot_si256().
+ * </pre>
  */
 static SARRAY *
 sarrayMakeInnerLoopDWACode(SEL     *sel,
                            l_int32  nhits,
-                           l_int32  nmisses)
+                           l_int32  nmisses,
+                           l_int32  width)
 {
-char    *string;
+char    *string, *dest;
 char     land[] = "&";
+char     dptrstring[] = "*dptr";
+char     wordstring[] = "word";
 char     bigbuf[L_BUF_SIZE];
+char     termbuf[L_BUF_SIZE];
 l_int32  i, j, ntot, nfound, type, delx, dely;
 SARRAY  *sa;
 
     if (!sel)
         return (SARRAY *)ERROR_PTR("sel not defined", __func__, NULL);
 
+    dest = (width == 64) ? wordstring : dptrstring;
     sa = sarrayCreate(0);
     ntot = nhits + nmisses;
     nfound = 0;
@@ -714,16 +818,36 @@ SARRAY  *sa;
                 nfound++;
                 dely = i - sel->cy;
                 delx = j - sel->cx;
-                if ((string = makeBarrelshiftString(delx, dely, type))
-                        == NULL) {
+                if (width == 32)
+                    string = makeBarrelshiftString(delx, dely, type);
+                else
+                    string = makeWideBarrelshiftString(delx, dely, width);
+                if (string == NULL) {
                     L_WARNING("barrel shift string not made\n", __func__);
                     continue;
                 }
-                if (ntot == 1)  /* just one item */
-                    sprintf(bigbuf, "            *dptr = %s;", string);
-                else if (nfound == 1)
-                    sprintf(bigbuf, "            *dptr = %s %s", string, land);
-                else if (nfound < ntot)
+                if (width == 64 && type == SEL_MISS) {
+                    snprintf(termbuf, L_BUF_SIZE, "(~%s)", string);
+                    LEPT_FREE(string);
+                    string = stringNew(termbuf);
+                }
+                if (width == 256) {
+                    if (nfound == 1 && type == SEL_HIT)
+                        sprintf(bigbuf, "            vec = %s;", string);
+                    else if (nfound == 1)  /* SEL_MISS */
+                        sprintf(bigbuf, "            vec = _mm256_andnot_si256("
+                                "%s, _mm256_set1_epi32(-1));", string);
+                    else if (type == SEL_HIT)
+                        sprintf(bigbuf, "            vec = _mm256_and_si256("
+                                "vec, %s);", string);
+                    else  /* SEL_MISS */
+                        sprintf(bigbuf, "            vec = _mm256_andnot_si256("
+                                "%s, vec);", string);
+                } else if (ntot == 1) {  /* just one item */
+                    sprintf(bigbuf, "            %s = %s;", dest, string);
+                } else if (nfound == 1) {
+                    sprintf(bigbuf, "            %s = %s %s", dest, string, land);
+                } else if (nfound < ntot)
                     sprintf(bigbuf, "                    %s %s", string, land);
                 else  /* nfound == ntot */
                     sprintf(bigbuf, "                    %s;", string);
@@ -809,3 +933,47 @@ char     bigbuf[L_BUF_SIZE];
 
     return stringNew(bigbuf);
 }
+
+
+/*!
+ * \brief   makeWideBarrelshiftString()
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is the 64-bit or 256-bit version of makeBarrelshiftString(),
+ *          using the DWA_WORD* and DWA_SH* macros in the template.
+ *          The caller takes care of the complement for misses.
+ * </pre>
+ */
+static char *
+makeWideBarrelshiftString(l_int32  delx,    /* j - cx */
+                          l_int32  dely,    /* i - cy */
+                          l_int32  width)   /* 64 or 256 */
+{
+l_int32  absx, absy;
+char     ptrbuf[32];
+char     bigbuf[L_BUF_SIZE];
+
+    if (delx < -31 || delx > 31)
+        return (char *)ERROR_PTR("delx out of bounds", __func__, NULL);
+    if (dely < -31 || dely > 31)
+        return (char *)ERROR_PTR("dely out of bounds", __func__, NULL);
+    absx = L_ABS(delx);
+    absy = L_ABS(dely);
+
+    if (dely == 0)
+        sprintf(ptrbuf, "sptr");
+    else if (dely < 0)
+        sprintf(ptrbuf, "sptr %s", wplstrm[absy - 1]);
+    else  /* dely > 0 */
+        sprintf(ptrbuf, "sptr %s", wplstrp[absy - 1]);
+
+    if (delx == 0)
+        sprintf(bigbuf, "DWA_WORD%d(%s)", width, ptrbuf);
+    else if (delx < 0)
+        sprintf(bigbuf, "DWA_SHR%d(%s, %d)", width, ptrbuf, absx);
+    else  /* delx > 0 */
+        sprintf(bigbuf, "DWA_SHL%d(%s, %d)", width, ptrbuf, absx);
+
+    return stringNew(bigbuf);
+}
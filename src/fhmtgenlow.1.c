@@ -34,8 +34,33 @@
  *             void       fhmt_1_*()
  */
 
+#ifdef HAVE_CONFIG_H
+#include <config_auto.h>
+#endif  /* HAVE_CONFIG_H */
+
 #include "allheaders.h"
 
+    /* Two adjacent words, with the first in the upper half, and the
+     * same shifted left or right by n < 32 bits */
+#define  DWA_WORD64(p)  ((((l_uint64)*(p)) << 32) | *((p) + 1))
+#define  DWA_SHL64(p, n)  ((DWA_WORD64(p) << (n)) | \
+                           (DWA_WORD64((p) + 1) >> (32 - (n))))
+#define  DWA_SHR64(p, n)  ((DWA_WORD64(p) >> (n)) | \
+                           (DWA_WORD64((p) - 1) << (32 - (n))))
+
+#if L_HAVE_AVX2
+#include <immintrin.h>
+
+    /* Eight adjacent words, and the same shifted left or right by n bits */
+#define  DWA_WORD256(p)  _mm256_loadu_si256((const __m256i *)(p))
+#define  DWA_SHL256(p, n)  \
+         _mm256_or_si256(_mm256_slli_epi32(DWA_WORD256(p), (n)), \
+                         _mm256_srli_epi32(DWA_WORD256((p) + 1), 32 - (n)))
+#define  DWA_SHR256(p, n)  \
+         _mm256_or_si256(_mm256_srli_epi32(DWA_WORD256(p), (n)), \
+                         _mm256_slli_epi32(DWA_WORD256((p) - 1), 32 - (n)))
+#endif  /* L_HAVE_AVX2 */
+
 static void  fhmt_1_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
 static void  fhmt_1_1(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
 static void  fhmt_1_2(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
@@ -46,6 +71,28 @@ static void  fhmt_1_6(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32
 static void  fhmt_1_7(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
 static void  fhmt_1_8(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
 static void  fhmt_1_9(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fhmt64_1_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fhmt64_1_1(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fhmt64_1_2(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fhmt64_1_3(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fhmt64_1_4(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fhmt64_1_5(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fhmt64_1_6(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fhmt64_1_7(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fhmt64_1_8(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fhmt64_1_9(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+#if L_HAVE_AVX2
+static void  L_TARGET_AVX2 fhmt256_1_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fhmt256_1_1(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fhmt256_1_2(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fhmt256_1_3(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fhmt256_1_4(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fhmt256_1_5(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fhmt256_1_6(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fhmt256_1_7(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fhmt256_1_8(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fhmt256_1_9(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+#endif  /* L_HAVE_AVX2 */
 
 
 /*---------------------------------------------------------------------*
@@ -65,6 +112,83 @@ fhmtgen_low_1(l_uint32  *datad,
               l_int32    wpls,
               l_int32    index)
 {
+l_int32  width;
+
+    width = l_getDwaWordWidth();
+#if L_HAVE_AVX2
+    if (width == 256) {
+        switch (index)
+        {
+        case 0:
+            fhmt256_1_0(datad, w, h, wpld, datas, wpls);
+            break;
+        case 1:
+            fhmt256_1_1(datad, w, h, wpld, datas, wpls);
+            break;
+        case 2:
+            fhmt256_1_2(datad, w, h, wpld, datas, wpls);
+            break;
+        case 3:
+            fhmt256_1_3(datad, w, h, wpld, datas, wpls);
+            break;
+        case 4:
+            fhmt256_1_4(datad, w, h, wpld, datas, wpls);
+            break;
+        case 5:
+            fhmt256_1_5(datad, w, h, wpld, datas, wpls);
+            break;
+        case 6:
+            fhmt256_1_6(datad, w, h, wpld, datas, wpls);
+            break;
+        case 7:
+            fhmt256_1_7(datad, w, h, wpld, datas, wpls);
+            break;
+        case 8:
+            fhmt256_1_8(datad, w, h, wpld, datas, wpls);
+            break;
+        case 9:
+            fhmt256_1_9(datad, w, h, wpld, datas, wpls);
+            break;
+        }
+        return 0;
+    }
+#endif  /* L_HAVE_AVX2 */
+    if (width == 64) {
+        switch (index)
+        {
+        case 0:
+            fhmt64_1_0(datad, w, h, wpld, datas, wpls);
+            break;
+        case 1:
+            fhmt64_1_1(datad, w, h, wpld, datas, wpls);
+            break;
+        case 2:
+            fhmt64_1_2(datad, w, h, wpld, datas, wpls);
+            break;
+        case 3:
+            fhmt64_1_3(datad, w, h, wpld, datas, wpls);
+            break;
+        case 4:
+            fhmt64_1_4(datad, w, h, wpld, datas, wpls);
+            break;
+        case 5:
+            fhmt64_1_5(datad, w, h, wpld, datas, wpls);
+            break;
+        case 6:
+            fhmt64_1_6(datad, w, h, wpld, datas, wpls);
+            break;
+        case 7:
+            fhmt64_1_7(datad, w, h, wpld, datas, wpls);
+            break;
+        case 8:
+            fhmt64_1_8(datad, w, h, wpld, datas, wpls);
+            break;
+        case 9:
+            fhmt64_1_9(datad, w, h, wpld, datas, wpls);
+            break;
+        }
+        return 0;
+    }
 
     switch (index)
     {
@@ -114,6 +238,12 @@ fhmtgen_low_1(l_uint32  *datad,
  *        code by redefining w and h smaller and by moving the
  *        start-of-image pointers up to the beginning of this
  *        interior rectangle.
+ *
+ *        The 64-bit and 256-bit versions of each routine do most
+ *        of each line two or eight words at a time, and finish it
+ *        with the 32-bit code.  Horizontal shifts are always less
+ *        than 32, so the funnel shifts on the wider words give the
+ *        same bits as the 32-bit code.
  */
 static void
 fhmt_1_0(l_uint32  *datad,
@@ -269,13 +399,10 @@ fhmt_1_5(l_uint32  *datad,
 l_int32    i;
 l_int32    j, pwpls;
 l_uint32  *sptr, *dptr;
-l_int32             wpls2, wpls3, wpls4;
-l_int32             wpls5, wpls6;
+l_int32             wpls2;
+l_int32             wpls6;
 
     wpls2 = 2 * wpls;
-    wpls3 = 3 * wpls;
-    wpls4 = 4 * wpls;
-    wpls5 = 5 * wpls;
     wpls6 = 6 * wpls;
     pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
 
@@ -443,3 +570,931 @@ l_int32             wpls2;
     }
 }
 
+static void
+fhmt64_1_0(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = (~DWA_SHR64(sptr - wpls, 1)) &
+                    (~DWA_WORD64(sptr - wpls)) &
+                    (~DWA_SHL64(sptr - wpls, 1)) &
+                    (~DWA_SHR64(sptr, 1)) &
+                    DWA_WORD64(sptr) &
+                    (~DWA_SHL64(sptr, 1)) &
+                    (~DWA_SHR64(sptr + wpls, 1)) &
+                    (~DWA_WORD64(sptr + wpls)) &
+                    (~DWA_SHL64(sptr + wpls, 1));
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls) >> 1) | (~*(sptr - wpls - 1) << 31)) &
+                    (~*(sptr - wpls)) &
+                    ((~*(sptr - wpls) << 1) | (~*(sptr - wpls + 1) >> 31)) &
+                    ((~*(sptr) >> 1) | (~*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((~*(sptr) << 1) | (~*(sptr + 1) >> 31)) &
+                    ((~*(sptr + wpls) >> 1) | (~*(sptr + wpls - 1) << 31)) &
+                    (~*(sptr + wpls)) &
+                    ((~*(sptr + wpls) << 1) | (~*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+static void
+fhmt64_1_1(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    (~DWA_SHR64(sptr + wpls, 1)) &
+                    (~DWA_WORD64(sptr + wpls)) &
+                    (~DWA_SHL64(sptr + wpls, 1));
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((~*(sptr + wpls) >> 1) | (~*(sptr + wpls - 1) << 31)) &
+                    (~*(sptr + wpls)) &
+                    ((~*(sptr + wpls) << 1) | (~*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+static void
+fhmt64_1_2(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = (~DWA_SHR64(sptr - wpls, 1)) &
+                    (~DWA_WORD64(sptr - wpls)) &
+                    (~DWA_SHL64(sptr - wpls, 1)) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls) >> 1) | (~*(sptr - wpls - 1) << 31)) &
+                    (~*(sptr - wpls)) &
+                    ((~*(sptr - wpls) << 1) | (~*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31));
+        }
+    }
+}
+
+static void
+fhmt64_1_3(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls) &
+                    (~DWA_SHL64(sptr - wpls, 1)) &
+                    DWA_WORD64(sptr) &
+                    (~DWA_SHL64(sptr, 1)) &
+                    DWA_WORD64(sptr + wpls) &
+                    (~DWA_SHL64(sptr + wpls, 1));
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls)) &
+                    ((~*(sptr - wpls) << 1) | (~*(sptr - wpls + 1) >> 31)) &
+                    (*sptr) &
+                    ((~*(sptr) << 1) | (~*(sptr + 1) >> 31)) &
+                    (*(sptr + wpls)) &
+                    ((~*(sptr + wpls) << 1) | (~*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+static void
+fhmt64_1_4(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = (~DWA_SHR64(sptr - wpls, 1)) &
+                    DWA_WORD64(sptr - wpls) &
+                    (~DWA_SHR64(sptr, 1)) &
+                    DWA_WORD64(sptr) &
+                    (~DWA_SHR64(sptr + wpls, 1)) &
+                    DWA_WORD64(sptr + wpls);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls) >> 1) | (~*(sptr - wpls - 1) << 31)) &
+                    (*(sptr - wpls)) &
+                    ((~*(sptr) >> 1) | (~*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((~*(sptr + wpls) >> 1) | (~*(sptr + wpls - 1) << 31)) &
+                    (*(sptr + wpls));
+        }
+    }
+}
+
+static void
+fhmt64_1_5(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+l_int32             wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = (~DWA_SHL64(sptr - wpls6, 1)) &
+                    DWA_SHL64(sptr - wpls6, 3) &
+                    (~DWA_WORD64(sptr - wpls2)) &
+                    DWA_SHL64(sptr - wpls2, 2) &
+                    (~DWA_SHR64(sptr + wpls2, 1)) &
+                    DWA_SHL64(sptr + wpls2, 1) &
+                    (~DWA_SHR64(sptr + wpls6, 2)) &
+                    DWA_WORD64(sptr + wpls6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls6) << 1) | (~*(sptr - wpls6 + 1) >> 31)) &
+                    ((*(sptr - wpls6) << 3) | (*(sptr - wpls6 + 1) >> 29)) &
+                    (~*(sptr - wpls2)) &
+                    ((*(sptr - wpls2) << 2) | (*(sptr - wpls2 + 1) >> 30)) &
+                    ((~*(sptr + wpls2) >> 1) | (~*(sptr + wpls2 - 1) << 31)) &
+                    ((*(sptr + wpls2) << 1) | (*(sptr + wpls2 + 1) >> 31)) &
+                    ((~*(sptr + wpls6) >> 2) | (~*(sptr + wpls6 - 1) << 30)) &
+                    (*(sptr + wpls6));
+        }
+    }
+}
+
+static void
+fhmt64_1_6(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = (~DWA_SHR64(sptr - wpls, 1)) &
+                    (~DWA_WORD64(sptr - wpls)) &
+                    (~DWA_SHL64(sptr - wpls, 1)) &
+                    (~DWA_SHL64(sptr - wpls, 2)) &
+                    (~DWA_SHR64(sptr, 1)) &
+                    DWA_SHL64(sptr, 2) &
+                    (~DWA_SHR64(sptr + wpls, 1)) &
+                    DWA_SHL64(sptr + wpls, 1) &
+                    DWA_SHL64(sptr + wpls, 2) &
+                    (~DWA_SHR64(sptr + wpls2, 1)) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_SHL64(sptr + wpls2, 1) &
+                    DWA_SHL64(sptr + wpls2, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls) >> 1) | (~*(sptr - wpls - 1) << 31)) &
+                    (~*(sptr - wpls)) &
+                    ((~*(sptr - wpls) << 1) | (~*(sptr - wpls + 1) >> 31)) &
+                    ((~*(sptr - wpls) << 2) | (~*(sptr - wpls + 1) >> 30)) &
+                    ((~*(sptr) >> 1) | (~*(sptr - 1) << 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((~*(sptr + wpls) >> 1) | (~*(sptr + wpls - 1) << 31)) &
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) &
+                    ((*(sptr + wpls) << 2) | (*(sptr + wpls + 1) >> 30)) &
+                    ((~*(sptr + wpls2) >> 1) | (~*(sptr + wpls2 - 1) << 31)) &
+                    (*(sptr + wpls2)) &
+                    ((*(sptr + wpls2) << 1) | (*(sptr + wpls2 + 1) >> 31)) &
+                    ((*(sptr + wpls2) << 2) | (*(sptr + wpls2 + 1) >> 30));
+        }
+    }
+}
+
+static void
+fhmt64_1_7(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = (~DWA_SHR64(sptr - wpls, 2)) &
+                    (~DWA_SHR64(sptr - wpls, 1)) &
+                    (~DWA_WORD64(sptr - wpls)) &
+                    (~DWA_SHL64(sptr - wpls, 1)) &
+                    DWA_SHR64(sptr, 2) &
+                    (~DWA_SHL64(sptr, 1)) &
+                    DWA_SHR64(sptr + wpls, 2) &
+                    DWA_SHR64(sptr + wpls, 1) &
+                    (~DWA_SHL64(sptr + wpls, 1)) &
+                    DWA_SHR64(sptr + wpls2, 2) &
+                    DWA_SHR64(sptr + wpls2, 1) &
+                    DWA_WORD64(sptr + wpls2) &
+                    (~DWA_SHL64(sptr + wpls2, 1));
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls) >> 2) | (~*(sptr - wpls - 1) << 30)) &
+                    ((~*(sptr - wpls) >> 1) | (~*(sptr - wpls - 1) << 31)) &
+                    (~*(sptr - wpls)) &
+                    ((~*(sptr - wpls) << 1) | (~*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((~*(sptr) << 1) | (~*(sptr + 1) >> 31)) &
+                    ((*(sptr + wpls) >> 2) | (*(sptr + wpls - 1) << 30)) &
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) &
+                    ((~*(sptr + wpls) << 1) | (~*(sptr + wpls + 1) >> 31)) &
+                    ((*(sptr + wpls2) >> 2) | (*(sptr + wpls2 - 1) << 30)) &
+                    ((*(sptr + wpls2) >> 1) | (*(sptr + wpls2 - 1) << 31)) &
+                    (*(sptr + wpls2)) &
+                    ((~*(sptr + wpls2) << 1) | (~*(sptr + wpls2 + 1) >> 31));
+        }
+    }
+}
+
+static void
+fhmt64_1_8(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = (~DWA_SHR64(sptr - wpls2, 1)) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_SHL64(sptr - wpls2, 1) &
+                    DWA_SHL64(sptr - wpls2, 2) &
+                    (~DWA_SHR64(sptr - wpls, 1)) &
+                    DWA_SHL64(sptr - wpls, 1) &
+                    DWA_SHL64(sptr - wpls, 2) &
+                    (~DWA_SHR64(sptr, 1)) &
+                    DWA_SHL64(sptr, 2) &
+                    (~DWA_SHR64(sptr + wpls, 1)) &
+                    (~DWA_WORD64(sptr + wpls)) &
+                    (~DWA_SHL64(sptr + wpls, 1)) &
+                    (~DWA_SHL64(sptr + wpls, 2));
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls2) >> 1) | (~*(sptr - wpls2 - 1) << 31)) &
+                    (*(sptr - wpls2)) &
+                    ((*(sptr - wpls2) << 1) | (*(sptr - wpls2 + 1) >> 31)) &
+                    ((*(sptr - wpls2) << 2) | (*(sptr - wpls2 + 1) >> 30)) &
+                    ((~*(sptr - wpls) >> 1) | (~*(sptr - wpls - 1) << 31)) &
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr - wpls) << 2) | (*(sptr - wpls + 1) >> 30)) &
+                    ((~*(sptr) >> 1) | (~*(sptr - 1) << 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((~*(sptr + wpls) >> 1) | (~*(sptr + wpls - 1) << 31)) &
+                    (~*(sptr + wpls)) &
+                    ((~*(sptr + wpls) << 1) | (~*(sptr + wpls + 1) >> 31)) &
+                    ((~*(sptr + wpls) << 2) | (~*(sptr + wpls + 1) >> 30));
+        }
+    }
+}
+
+static void
+fhmt64_1_9(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr - wpls2, 2) &
+                    DWA_SHR64(sptr - wpls2, 1) &
+                    DWA_WORD64(sptr - wpls2) &
+                    (~DWA_SHL64(sptr - wpls2, 1)) &
+                    DWA_SHR64(sptr - wpls, 2) &
+                    DWA_SHR64(sptr - wpls, 1) &
+                    (~DWA_SHL64(sptr - wpls, 1)) &
+                    DWA_SHR64(sptr, 2) &
+                    (~DWA_SHL64(sptr, 1)) &
+                    (~DWA_SHR64(sptr + wpls, 2)) &
+                    (~DWA_SHR64(sptr + wpls, 1)) &
+                    (~DWA_WORD64(sptr + wpls)) &
+                    (~DWA_SHL64(sptr + wpls, 1));
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls2) >> 2) | (*(sptr - wpls2 - 1) << 30)) &
+                    ((*(sptr - wpls2) >> 1) | (*(sptr - wpls2 - 1) << 31)) &
+                    (*(sptr - wpls2)) &
+                    ((~*(sptr - wpls2) << 1) | (~*(sptr - wpls2 + 1) >> 31)) &
+                    ((*(sptr - wpls) >> 2) | (*(sptr - wpls - 1) << 30)) &
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) &
+                    ((~*(sptr - wpls) << 1) | (~*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((~*(sptr) << 1) | (~*(sptr + 1) >> 31)) &
+                    ((~*(sptr + wpls) >> 2) | (~*(sptr + wpls - 1) << 30)) &
+                    ((~*(sptr + wpls) >> 1) | (~*(sptr + wpls - 1) << 31)) &
+                    (~*(sptr + wpls)) &
+                    ((~*(sptr + wpls) << 1) | (~*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+#if L_HAVE_AVX2
+static void L_TARGET_AVX2
+fhmt256_1_0(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr - wpls, 1), _mm256_set1_epi32(-1));
+            vec = _mm256_andnot_si256(DWA_WORD256(sptr - wpls), vec);
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr - wpls, 1), vec);
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr, 1), vec);
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr + wpls, 1), vec);
+            vec = _mm256_andnot_si256(DWA_WORD256(sptr + wpls), vec);
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr + wpls, 1), vec);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls) >> 1) | (~*(sptr - wpls - 1) << 31)) &
+                    (~*(sptr - wpls)) &
+                    ((~*(sptr - wpls) << 1) | (~*(sptr - wpls + 1) >> 31)) &
+                    ((~*(sptr) >> 1) | (~*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((~*(sptr) << 1) | (~*(sptr + 1) >> 31)) &
+                    ((~*(sptr + wpls) >> 1) | (~*(sptr + wpls - 1) << 31)) &
+                    (~*(sptr + wpls)) &
+                    ((~*(sptr + wpls) << 1) | (~*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fhmt256_1_1(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 1);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr + wpls, 1), vec);
+            vec = _mm256_andnot_si256(DWA_WORD256(sptr + wpls), vec);
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr + wpls, 1), vec);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((~*(sptr + wpls) >> 1) | (~*(sptr + wpls - 1) << 31)) &
+                    (~*(sptr + wpls)) &
+                    ((~*(sptr + wpls) << 1) | (~*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fhmt256_1_2(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr - wpls, 1), _mm256_set1_epi32(-1));
+            vec = _mm256_andnot_si256(DWA_WORD256(sptr - wpls), vec);
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr - wpls, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls) >> 1) | (~*(sptr - wpls - 1) << 31)) &
+                    (~*(sptr - wpls)) &
+                    ((~*(sptr - wpls) << 1) | (~*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fhmt256_1_3(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls);
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr - wpls, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr + wpls, 1), vec);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls)) &
+                    ((~*(sptr - wpls) << 1) | (~*(sptr - wpls + 1) >> 31)) &
+                    (*sptr) &
+                    ((~*(sptr) << 1) | (~*(sptr + 1) >> 31)) &
+                    (*(sptr + wpls)) &
+                    ((~*(sptr + wpls) << 1) | (~*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fhmt256_1_4(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr - wpls, 1), _mm256_set1_epi32(-1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr + wpls, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls) >> 1) | (~*(sptr - wpls - 1) << 31)) &
+                    (*(sptr - wpls)) &
+                    ((~*(sptr) >> 1) | (~*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((~*(sptr + wpls) >> 1) | (~*(sptr + wpls - 1) << 31)) &
+                    (*(sptr + wpls));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fhmt256_1_5(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+l_int32             wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr - wpls6, 1), _mm256_set1_epi32(-1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls6, 3));
+            vec = _mm256_andnot_si256(DWA_WORD256(sptr - wpls2), vec);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls2, 2));
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr + wpls2, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls2, 1));
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr + wpls6, 2), vec);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls6) << 1) | (~*(sptr - wpls6 + 1) >> 31)) &
+                    ((*(sptr - wpls6) << 3) | (*(sptr - wpls6 + 1) >> 29)) &
+                    (~*(sptr - wpls2)) &
+                    ((*(sptr - wpls2) << 2) | (*(sptr - wpls2 + 1) >> 30)) &
+                    ((~*(sptr + wpls2) >> 1) | (~*(sptr + wpls2 - 1) << 31)) &
+                    ((*(sptr + wpls2) << 1) | (*(sptr + wpls2 + 1) >> 31)) &
+                    ((~*(sptr + wpls6) >> 2) | (~*(sptr + wpls6 - 1) << 30)) &
+                    (*(sptr + wpls6));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fhmt256_1_6(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr - wpls, 1), _mm256_set1_epi32(-1));
+            vec = _mm256_andnot_si256(DWA_WORD256(sptr - wpls), vec);
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr - wpls, 1), vec);
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr - wpls, 2), vec);
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr + wpls, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls, 2));
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr + wpls2, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls2, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls2, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls) >> 1) | (~*(sptr - wpls - 1) << 31)) &
+                    (~*(sptr - wpls)) &
+                    ((~*(sptr - wpls) << 1) | (~*(sptr - wpls + 1) >> 31)) &
+                    ((~*(sptr - wpls) << 2) | (~*(sptr - wpls + 1) >> 30)) &
+                    ((~*(sptr) >> 1) | (~*(sptr - 1) << 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((~*(sptr + wpls) >> 1) | (~*(sptr + wpls - 1) << 31)) &
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) &
+                    ((*(sptr + wpls) << 2) | (*(sptr + wpls + 1) >> 30)) &
+                    ((~*(sptr + wpls2) >> 1) | (~*(sptr + wpls2 - 1) << 31)) &
+                    (*(sptr + wpls2)) &
+                    ((*(sptr + wpls2) << 1) | (*(sptr + wpls2 + 1) >> 31)) &
+                    ((*(sptr + wpls2) << 2) | (*(sptr + wpls2 + 1) >> 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fhmt256_1_7(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr - wpls, 2), _mm256_set1_epi32(-1));
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr - wpls, 1), vec);
+            vec = _mm256_andnot_si256(DWA_WORD256(sptr - wpls), vec);
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr - wpls, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr + wpls, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr + wpls, 1));
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr + wpls, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr + wpls2, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr + wpls2, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr + wpls2, 1), vec);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls) >> 2) | (~*(sptr - wpls - 1) << 30)) &
+                    ((~*(sptr - wpls) >> 1) | (~*(sptr - wpls - 1) << 31)) &
+                    (~*(sptr - wpls)) &
+                    ((~*(sptr - wpls) << 1) | (~*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((~*(sptr) << 1) | (~*(sptr + 1) >> 31)) &
+                    ((*(sptr + wpls) >> 2) | (*(sptr + wpls - 1) << 30)) &
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) &
+                    ((~*(sptr + wpls) << 1) | (~*(sptr + wpls + 1) >> 31)) &
+                    ((*(sptr + wpls2) >> 2) | (*(sptr + wpls2 - 1) << 30)) &
+                    ((*(sptr + wpls2) >> 1) | (*(sptr + wpls2 - 1) << 31)) &
+                    (*(sptr + wpls2)) &
+                    ((~*(sptr + wpls2) << 1) | (~*(sptr + wpls2 + 1) >> 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fhmt256_1_8(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr - wpls2, 1), _mm256_set1_epi32(-1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls2, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls2, 2));
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr - wpls, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls, 2));
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr + wpls, 1), vec);
+            vec = _mm256_andnot_si256(DWA_WORD256(sptr + wpls), vec);
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr + wpls, 1), vec);
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr + wpls, 2), vec);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((~*(sptr - wpls2) >> 1) | (~*(sptr - wpls2 - 1) << 31)) &
+                    (*(sptr - wpls2)) &
+                    ((*(sptr - wpls2) << 1) | (*(sptr - wpls2 + 1) >> 31)) &
+                    ((*(sptr - wpls2) << 2) | (*(sptr - wpls2 + 1) >> 30)) &
+                    ((~*(sptr - wpls) >> 1) | (~*(sptr - wpls - 1) << 31)) &
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr - wpls) << 2) | (*(sptr - wpls + 1) >> 30)) &
+                    ((~*(sptr) >> 1) | (~*(sptr - 1) << 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((~*(sptr + wpls) >> 1) | (~*(sptr + wpls - 1) << 31)) &
+                    (~*(sptr + wpls)) &
+                    ((~*(sptr + wpls) << 1) | (~*(sptr + wpls + 1) >> 31)) &
+                    ((~*(sptr + wpls) << 2) | (~*(sptr + wpls + 1) >> 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fhmt256_1_9(l_uint32  *datad,
+         l_int32    w,
+         l_int32    h,
+         l_int32    wpld,
+         l_uint32  *datas,
+         l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr - wpls2, 2);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr - wpls2, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr - wpls2, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr - wpls, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr - wpls, 1));
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr - wpls, 1), vec);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr, 1), vec);
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr + wpls, 2), vec);
+            vec = _mm256_andnot_si256(DWA_SHR256(sptr + wpls, 1), vec);
+            vec = _mm256_andnot_si256(DWA_WORD256(sptr + wpls), vec);
+            vec = _mm256_andnot_si256(DWA_SHL256(sptr + wpls, 1), vec);
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls2) >> 2) | (*(sptr - wpls2 - 1) << 30)) &
+                    ((*(sptr - wpls2) >> 1) | (*(sptr - wpls2 - 1) << 31)) &
+                    (*(sptr - wpls2)) &
+                    ((~*(sptr - wpls2) << 1) | (~*(sptr - wpls2 + 1) >> 31)) &
+                    ((*(sptr - wpls) >> 2) | (*(sptr - wpls - 1) << 30)) &
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) &
+                    ((~*(sptr - wpls) << 1) | (~*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((~*(sptr) << 1) | (~*(sptr + 1) >> 31)) &
+                    ((~*(sptr + wpls) >> 2) | (~*(sptr + wpls - 1) << 30)) &
+                    ((~*(sptr + wpls) >> 1) | (~*(sptr + wpls - 1) << 31)) &
+                    (~*(sptr + wpls)) &
+                    ((~*(sptr + wpls) << 1) | (~*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+#endif  /* L_HAVE_AVX2 */
@@ -38,6 +38,7 @@
  *       static SARRAY      *sarrayMakeWplsCode()
  *       static SARRAY      *sarrayMakeInnerLoopDWACode()
  *       static char        *makeBarrelshiftString()
+ *       static char        *makeWideBarrelshiftString()
  *
  *
  *    This automatically generates dwa code for erosion and dilation.
@@ -93,6 +94,14 @@
  *        For examples of use, see the file prog/binmorph_reg1.c, which
  *        verifies the consistency of the various implementations by
  *        comparing the dwa result with that of full-image rasterops.
+ *
+ *    (5) The low-level file has three versions of the code for each sel,
+ *        with inner loops on 32-bit words, on 64-bit words and on
+ *        256-bit AVX2 vectors.  They give identical results.  The
+ *        dispatcher fmorphopgen_low_*() picks one with l_getDwaWordWidth(),
+ *        so pixMorphDwa_*() and pixFMorphopGen_*() use the widest
+ *        version that the cpu supports.  The AVX2 code is compiled
+ *        only if L_HAVE_AVX2 is set in environ.h.
  * </pre>
  */
 
@@ -111,8 +120,14 @@
 
 #define L_BUF_SIZE 512
 
+    /* Word widths of the code generated besides the 32-bit code */
+static const l_int32  WideWidths[2] = {64, 256};
+
 static char * makeBarrelshiftString(l_int32 delx, l_int32 dely);
-static SARRAY * sarrayMakeInnerLoopDWACode(SEL *sel, l_int32 index);
+static char * makeWideBarrelshiftString(l_int32 delx, l_int32 dely,
+                                        l_int32 width);
+static SARRAY * sarrayMakeInnerLoopDWACode(SEL *sel, l_int32 index,
+                                           l_int32 width);
 static SARRAY * sarrayMakeWplsCode(SEL *sel);
 
 static char wpldecls[][53] = {
@@ -487,6 +502,9 @@ SARRAY  *sa1, *sa2, *sa3;
  *      (3) If filename == NULL, the output file is fmorphgenlow.[n].c,
  *          where [n] is equal to the 'fileindex' parameter.
  *      (4) If filename != NULL, the output file is [filename]low.[n].c.
+ *      (5) Each sel gets three versions of the low-level functions,
+ *          for 32-bit words, 64-bit words and 256-bit vectors;
+ *          e.g., fdilate_[n]_*(), fdilate64_[n]_*() and fdilate256_[n]_*().
  */
 l_int32
 fmorphautogen2(SELA        *sela,
@@ -498,8 +516,15 @@ char    *str_doc1, *str_doc2, *str_doc3, *str_doc4, *str_def1;
 char     bigbuf[L_BUF_SIZE];
 char     breakstring[] = "        break;";
 char     staticstring[] = "static void";
-l_int32  i, nsels, nbytes, actstart, end, newstart;
+char     staticavx2string[] = "static void L_TARGET_AVX2";
+char     ifavx2string[] = "#if L_HAVE_AVX2";
+char     endifavx2string[] = "#endif  /* L_HAVE_AVX2 */";
+l_int32  ifstart, ifend, endifstart, endifend;
+const char  *indent;
+l_int32  i, k, nsels, nbytes, actstart, end, newstart;
 l_int32  argstart, argend, loopstart, loopend, finalstart, finalend;
+l_int32  warg[2], wargend[2], wloop[2], wloopend[2], wmid[2], wmidend[2];
+l_int32  wfinal[2], wfinalend[2];
 size_t   size;
 SARRAY  *sa1, *sa2, *sa3, *sa4, *sa5, *sa6;
 SEL     *sel;
@@ -519,8 +544,9 @@ SEL     *sel;
     if (!sa1)
         return ERROR_INT("sa1 not made", __func__, 1);
 
-        /* Make the array of static function names */
-    if ((sa2 = sarrayCreate(2 * nsels)) == NULL) {
+        /* Make the array of static function names: first the 32-bit
+         * functions, then the 64-bit and the 256-bit ones */
+    if ((sa2 = sarrayCreate(6 * nsels)) == NULL) {
         sarrayDestroy(&sa1);
         return ERROR_INT("sa2 not made", __func__, 1);
     }
@@ -530,14 +556,30 @@ SEL     *sel;
         sprintf(bigbuf, "ferode_%d_%d", fileindex, i);
         sarrayAddString(sa2, bigbuf, L_COPY);
     }
+    for (k = 0; k < 2; k++) {
+        for (i = 0; i < nsels; i++) {
+            sprintf(bigbuf, "fdilate%d_%d_%d", WideWidths[k], fileindex, i);
+            sarrayAddString(sa2, bigbuf, L_COPY);
+            sprintf(bigbuf, "ferode%d_%d_%d", WideWidths[k], fileindex, i);
+            sarrayAddString(sa2, bigbuf, L_COPY);
+        }
+    }
 
         /* Make the static prototype strings */
-    sa3 = sarrayCreate(2 * nsels);  /* should be ok */
-    for (i = 0; i < 2 * nsels; i++) {
+    sa3 = sarrayCreate(6 * nsels + 2);  /* should be ok */
+    for (i = 0; i < 6 * nsels; i++) {
         fname = sarrayGetString(sa2, i, L_NOCOPY);
-        sprintf(bigbuf, "static void  %s%s", fname, PROTOARGS);
+        if (i < 4 * nsels) {
+            sprintf(bigbuf, "static void  %s%s", fname, PROTOARGS);
+        } else {
+            if (i == 4 * nsels)
+                sarrayAddString(sa3, ifavx2string, L_COPY);
+            sprintf(bigbuf, "static void  L_TARGET_AVX2 %s%s",
+                    fname, PROTOARGS);
+        }
         sarrayAddString(sa3, bigbuf, L_COPY);
     }
+    sarrayAddString(sa3, endifavx2string, L_COPY);
 
         /* Make strings containing function names */
     sprintf(bigbuf, " *             l_int32    fmorphopgen_low_%d()",
@@ -565,7 +607,7 @@ SEL     *sel;
     sarrayAppendRange(sa4, sa1, actstart, end);
 
         /* Insert static protos */
-    for (i = 0; i < 2 * nsels; i++) {
+    for (i = 0; i < sarrayGetCount(sa3); i++) {
         if ((linestr = sarrayGetString(sa3, i, L_COPY)) == NULL) {
             sarrayDestroy(&sa1);
             sarrayDestroy(&sa2);
@@ -592,19 +634,25 @@ SEL     *sel;
     sarrayParseRange(sa1, newstart, &actstart, &end, &newstart, "--", 0);
     sarrayAppendRange(sa4, sa1, actstart, end);
 
-        /* Generate and insert the dispatcher code */
-    for (i = 0; i < 2 * nsels; i++) {
-        sprintf(bigbuf, "    case %d:", i);
-        sarrayAddString(sa4, bigbuf, L_COPY);
-        sprintf(bigbuf, "        %s(datad, w, h, wpld, datas, wpls);",
-               sarrayGetString(sa2, i, L_NOCOPY));
-        sarrayAddString(sa4, bigbuf, L_COPY);
-        sarrayAddString(sa4, breakstring, L_COPY);
-    }
+        /* Generate and insert the dispatcher code, for the 256-bit,
+         * 64-bit and 32-bit functions in that order */
+    for (k = 2; k >= 0; k--) {
+        indent = (k > 0) ? "    " : "";
+        for (i = 0; i < 2 * nsels; i++) {
+            sprintf(bigbuf, "%s    case %d:", indent, i);
+            sarrayAddString(sa4, bigbuf, L_COPY);
+            sprintf(bigbuf, "%s        %s(datad, w, h, wpld, datas, wpls);",
+                   indent, sarrayGetString(sa2, 2 * k * nsels + i, L_NOCOPY));
+            sarrayAddString(sa4, bigbuf, L_COPY);
+            sprintf(bigbuf, "%s%s", indent, breakstring);
+            sarrayAddString(sa4, bigbuf, L_COPY);
+        }
 
-        /* Finish the dispatcher and introduce the low-level code */
-    sarrayParseRange(sa1, newstart, &actstart, &end, &newstart, "--", 0);
-    sarrayAppendRange(sa4, sa1, actstart, end);
+            /* Finish this switch; after the last one, finish the
+             * dispatcher and introduce the low-level code */
+        sarrayParseRange(sa1, newstart, &actstart, &end, &newstart, "--", 0);
+        sarrayAppendRange(sa4, sa1, actstart, end);
+    }
 
         /* Get the range for the args common to all functions */
     sarrayParseRange(sa1, newstart, &argstart, &argend, &newstart, "--", 0);
@@ -615,6 +663,24 @@ SEL     *sel;
         /* Get the range for the ending code common to all functions */
     sarrayParseRange(sa1, newstart, &finalstart, &finalend, &newstart, "--", 0);
 
+        /* Get the same ranges for the 64-bit and 256-bit functions.
+         * These have a 32-bit loop to finish each line, in the range
+         * between the wide loop and the ending code. */
+    for (k = 0; k < 2; k++) {
+        sarrayParseRange(sa1, newstart, &warg[k], &wargend[k],
+                         &newstart, "--", 0);
+        sarrayParseRange(sa1, newstart, &wloop[k], &wloopend[k],
+                         &newstart, "--", 0);
+        sarrayParseRange(sa1, newstart, &wmid[k], &wmidend[k],
+                         &newstart, "--", 0);
+        sarrayParseRange(sa1, newstart, &wfinal[k], &wfinalend[k],
+                         &newstart, "--", 0);
+        if (k == 0)  /* the #if that encloses the 256-bit code */
+            sarrayParseRange(sa1, newstart, &ifstart, &ifend,
+                             &newstart, "--", 0);
+    }
+    sarrayParseRange(sa1, newstart, &endifstart, &endifend, &newstart, "--", 0);
+
         /* Do all the static functions */
     for (i = 0; i < 2 * nsels; i++) {
             /* Generate the function header and add the common args */
@@ -640,7 +706,7 @@ SEL     *sel;
         sarrayAppendRange(sa4, sa1, loopstart, loopend);
 
             /* Insert barrel-op code for *dptr */
-        sa6 = sarrayMakeInnerLoopDWACode(sel, i);
+        sa6 = sarrayMakeInnerLoopDWACode(sel, i, 32);
         sarrayJoin(sa4, sa6);
         sarrayDestroy(&sa6);
 
@@ -648,6 +714,34 @@ SEL     *sel;
         sarrayAppendRange(sa4, sa1, finalstart, finalend);
     }
 
+        /* Do the 64-bit and 256-bit versions */
+    for (k = 0; k < 2; k++) {
+        if (k == 1)
+            sarrayAppendRange(sa4, sa1, ifstart, ifend);
+        for (i = 0; i < 2 * nsels; i++) {
+            sarrayAddString(sa4, (k == 0) ? staticstring : staticavx2string,
+                            L_COPY);
+            fname = sarrayGetString(sa2, 2 * (k + 1) * nsels + i, L_NOCOPY);
+            sprintf(bigbuf, "%s(l_uint32  *datad,", fname);
+            sarrayAddString(sa4, bigbuf, L_COPY);
+            sarrayAppendRange(sa4, sa1, warg[k], wargend[k]);
+            sel = selaGetSel(sela, i/2);
+            sa5 = sarrayMakeWplsCode(sel);
+            sarrayJoin(sa4, sa5);
+            sarrayDestroy(&sa5);
+            sarrayAppendRange(sa4, sa1, wloop[k], wloopend[k]);
+            sa6 = sarrayMakeInnerLoopDWACode(sel, i, WideWidths[k]);
+            sarrayJoin(sa4, sa6);
+            sarrayDestroy(&sa6);
+            sarrayAppendRange(sa4, sa1, wmid[k], wmidend[k]);
+            sa6 = sarrayMakeInnerLoopDWACode(sel, i, 32);
+            sarrayJoin(sa4, sa6);
+            sarrayDestroy(&sa6);
+            sarrayAppendRange(sa4, sa1, wfinal[k], wfinalend[k]);
+        }
+    }
+    sarrayAppendRange(sa4, sa1, endifstart, endifend);
+
         /* Output to file */
     filestr = sarrayToString(sa4, 1);
     nbytes = strlen(filestr);
@@ -750,14 +844,27 @@ SARRAY  *sa;
 
 /*!
  * \brief   sarrayMakeInnerLoopDWACode()
+ *
+ * <pre>
+ * Notes:
+ *      (1) For %width = 32 this makes the expression for *dptr, and
+ *          for %width = 64 the same expression for the l_uint64 word.
+ *      (2) For %width = 256 it makes a sequence of statements that
+ *          accumulate the result in the __m256i vec.
+ * </pre>
  */
 static SARRAY *
 sarrayMakeInnerLoopDWACode(SEL     *sel,
-                           l_int32  index)
+                           l_int32  index,
+                           l_int32  width)
 {
-char    *tstr, *string;
+char    *tstr, *string, *dest, *vecop;
 char     logicalor[] = "|";
 char     logicaland[] = "&";
+char     dptrstring[] = "*dptr";
+char     wordstring[] = "word";
+char     vecor[] = "_mm256_or_si256";
+char     vecand[] = "_mm256_and_si256";
 char     bigbuf[L_BUF_SIZE];
 l_int32  i, j, optype, count, nfound, delx, dely;
 SARRAY  *sa;
@@ -768,10 +875,13 @@ SARRAY  *sa;
     if (index % 2 == 0) {
         optype = L_MORPH_DILATE;
         tstr = logicalor;
+        vecop = vecor;
     } else {
         optype = L_MORPH_ERODE;
         tstr = logicaland;
+        vecop = vecand;
     }
+    dest = (width == 64) ? wordstring : dptrstring;
 
     count = 0;
     for (i = 0; i < sel->sy; i++) {
@@ -799,15 +909,25 @@ SARRAY  *sa;
                     dely = i - sel->cy;
                     delx = j - sel->cx;
                 }
-                if ((string = makeBarrelshiftString(delx, dely)) == NULL) {
+                if (width == 32)
+                    string = makeBarrelshiftString(delx, dely);
+                else
+                    string = makeWideBarrelshiftString(delx, dely, width);
+                if (string == NULL) {
                     L_WARNING("barrel shift string not made\n", __func__);
                     continue;
                 }
-                if (count == 1)  /* just one item */
-                    sprintf(bigbuf, "            *dptr = %s;", string);
-                else if (nfound == 1)
-                    sprintf(bigbuf, "            *dptr = %s %s", string, tstr);
-                else if (nfound < count)
+                if (width == 256) {
+                    if (nfound == 1)
+                        sprintf(bigbuf, "            vec = %s;", string);
+                    else
+                        sprintf(bigbuf, "            vec = %s(vec, %s);",
+                                vecop, string);
+                } else if (count == 1) {  /* just one item */
+                    sprintf(bigbuf, "            %s = %s;", dest, string);
+                } else if (nfound == 1) {
+                    sprintf(bigbuf, "            %s = %s %s", dest, string, tstr);
+                } else if (nfound < count)
                     sprintf(bigbuf, "                    %s %s", string, tstr);
                 else  /* nfound == count */
                     sprintf(bigbuf, "                    %s;", string);
@@ -865,3 +985,46 @@ char     bigbuf[L_BUF_SIZE];
 
     return stringNew(bigbuf);
 }
+
+
+/*!
+ * \brief   makeWideBarrelshiftString()
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is the 64-bit or 256-bit version of makeBarrelshiftString(),
+ *          using the DWA_WORD* and DWA_SH* macros in the template.
+ * </pre>
+ */
+static char *
+makeWideBarrelshiftString(l_int32  delx,    /* j - cx */
+                          l_int32  dely,    /* i - cy */
+                          l_int32  width)   /* 64 or 256 */
+{
+l_int32  absx, absy;
+char     ptrbuf[32];
+char     bigbuf[L_BUF_SIZE];
+
+    if (delx < -31 || delx > 31)
+        return (char *)ERROR_PTR("delx out of bounds", __func__, NULL);
+    if (dely < -31 || dely > 31)
+        return (char *)ERROR_PTR("dely out of bounds", __func__, NULL);
+    absx = L_ABS(delx);
+    absy = L_ABS(dely);
+
+    if (dely == 0)
+        sprintf(ptrbuf, "sptr");
+    else if (dely < 0)
+        sprintf(ptrbuf, "sptr %s", wplstrm[absy - 1]);
+    else  /* dely > 0 */
+        sprintf(ptrbuf, "sptr %s", wplstrp[absy - 1]);
+
+    if (delx == 0)
+        sprintf(bigbuf, "DWA_WORD%d(%s)", width, ptrbuf);
+    else if (delx < 0)
+        sprintf(bigbuf, "DWA_SHR%d(%s, %d)", width, ptrbuf, absx);
+    else  /* delx > 0 */
+        sprintf(bigbuf, "DWA_SHL%d(%s, %d)", width, ptrbuf, absx);
+
+    return stringNew(bigbuf);
+}
@@ -35,8 +35,33 @@
  *             void       ferode_1_*()
  */
 
+#ifdef HAVE_CONFIG_H
+#include <config_auto.h>
+#endif  /* HAVE_CONFIG_H */
+
 #include "allheaders.h"
 
+    /* Two adjacent words, with the first in the upper half, and the
+     * same shifted left or right by n < 32 bits */
+#define  DWA_WORD64(p)  ((((l_uint64)*(p)) << 32) | *((p) + 1))
+#define  DWA_SHL64(p, n)  ((DWA_WORD64(p) << (n)) | \
+                           (DWA_WORD64((p) + 1) >> (32 - (n))))
+#define  DWA_SHR64(p, n)  ((DWA_WORD64(p) >> (n)) | \
+                           (DWA_WORD64((p) - 1) << (32 - (n))))
+
+#if L_HAVE_AVX2
+#include <immintrin.h>
+
+    /* Eight adjacent words, and the same shifted left or right by n bits */
+#define  DWA_WORD256(p)  _mm256_loadu_si256((const __m256i *)(p))
+#define  DWA_SHL256(p, n)  \
+         _mm256_or_si256(_mm256_slli_epi32(DWA_WORD256(p), (n)), \
+                         _mm256_srli_epi32(DWA_WORD256((p) + 1), 32 - (n)))
+#define  DWA_SHR256(p, n)  \
+         _mm256_or_si256(_mm256_srli_epi32(DWA_WORD256(p), (n)), \
+                         _mm256_slli_epi32(DWA_WORD256((p) - 1), 32 - (n)))
+#endif  /* L_HAVE_AVX2 */
+
 static void  fdilate_1_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
 static void  ferode_1_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
 static void  fdilate_1_1(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
@@ -153,6 +178,240 @@ static void  fdilate_1_56(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_i
 static void  ferode_1_56(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
 static void  fdilate_1_57(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
 static void  ferode_1_57(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_1(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_1(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_2(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_2(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_3(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_3(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_4(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_4(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_5(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_5(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_6(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_6(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_7(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_7(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_8(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_8(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_9(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_9(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_10(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_10(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_11(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_11(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_12(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_12(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_13(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_13(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_14(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_14(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_15(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_15(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_16(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_16(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_17(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_17(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_18(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_18(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_19(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_19(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_20(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_20(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_21(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_21(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_22(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_22(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_23(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_23(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_24(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_24(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_25(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_25(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_26(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_26(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_27(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_27(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_28(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_28(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_29(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_29(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_30(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_30(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_31(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_31(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_32(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_32(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_33(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_33(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_34(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_34(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_35(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_35(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_36(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_36(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_37(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_37(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_38(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_38(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_39(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_39(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_40(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_40(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_41(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_41(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_42(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_42(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_43(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_43(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_44(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_44(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_45(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_45(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_46(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_46(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_47(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_47(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_48(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_48(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_49(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_49(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_50(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_50(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_51(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_51(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_52(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_52(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_53(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_53(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_54(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_54(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_55(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_55(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_56(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_56(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  fdilate64_1_57(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  ferode64_1_57(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+#if L_HAVE_AVX2
+static void  L_TARGET_AVX2 fdilate256_1_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_0(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_1(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_1(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_2(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_2(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_3(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_3(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_4(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_4(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_5(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_5(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_6(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_6(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_7(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_7(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_8(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_8(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_9(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_9(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_10(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_10(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_11(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_11(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_12(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_12(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_13(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_13(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_14(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_14(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_15(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_15(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_16(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_16(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_17(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_17(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_18(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_18(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_19(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_19(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_20(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_20(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_21(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_21(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_22(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_22(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_23(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_23(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_24(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_24(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_25(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_25(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_26(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_26(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_27(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_27(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_28(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_28(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_29(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_29(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_30(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_30(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_31(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_31(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_32(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_32(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_33(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_33(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_34(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_34(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_35(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_35(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_36(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_36(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_37(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_37(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_38(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_38(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_39(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_39(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_40(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_40(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_41(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_41(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_42(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_42(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_43(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_43(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_44(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_44(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_45(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_45(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_46(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_46(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_47(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_47(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_48(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_48(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_49(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_49(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_50(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_50(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_51(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_51(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_52(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_52(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_53(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_53(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_54(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_54(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_55(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_55(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_56(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_56(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 fdilate256_1_57(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+static void  L_TARGET_AVX2 ferode256_1_57(l_uint32 *, l_int32, l_int32, l_int32, l_uint32 *, l_int32);
+#endif  /* L_HAVE_AVX2 */
 
 
 /*---------------------------------------------------------------------*
@@ -172,6 +431,719 @@ fmorphopgen_low_1(l_uint32  *datad,
                   l_int32    wpls,
                   l_int32    index)
 {
+l_int32  width;
+
+    width = l_getDwaWordWidth();
+#if L_HAVE_AVX2
+    if (width == 256) {
+        switch (index)
+        {
+        case 0:
+            fdilate256_1_0(datad, w, h, wpld, datas, wpls);
+            break;
+        case 1:
+            ferode256_1_0(datad, w, h, wpld, datas, wpls);
+            break;
+        case 2:
+            fdilate256_1_1(datad, w, h, wpld, datas, wpls);
+            break;
+        case 3:
+            ferode256_1_1(datad, w, h, wpld, datas, wpls);
+            break;
+        case 4:
+            fdilate256_1_2(datad, w, h, wpld, datas, wpls);
+            break;
+        case 5:
+            ferode256_1_2(datad, w, h, wpld, datas, wpls);
+            break;
+        case 6:
+            fdilate256_1_3(datad, w, h, wpld, datas, wpls);
+            break;
+        case 7:
+            ferode256_1_3(datad, w, h, wpld, datas, wpls);
+            break;
+        case 8:
+            fdilate256_1_4(datad, w, h, wpld, datas, wpls);
+            break;
+        case 9:
+            ferode256_1_4(datad, w, h, wpld, datas, wpls);
+            break;
+        case 10:
+            fdilate256_1_5(datad, w, h, wpld, datas, wpls);
+            break;
+        case 11:
+            ferode256_1_5(datad, w, h, wpld, datas, wpls);
+            break;
+        case 12:
+            fdilate256_1_6(datad, w, h, wpld, datas, wpls);
+            break;
+        case 13:
+            ferode256_1_6(datad, w, h, wpld, datas, wpls);
+            break;
+        case 14:
+            fdilate256_1_7(datad, w, h, wpld, datas, wpls);
+            break;
+        case 15:
+            ferode256_1_7(datad, w, h, wpld, datas, wpls);
+            break;
+        case 16:
+            fdilate256_1_8(datad, w, h, wpld, datas, wpls);
+            break;
+        case 17:
+            ferode256_1_8(datad, w, h, wpld, datas, wpls);
+            break;
+        case 18:
+            fdilate256_1_9(datad, w, h, wpld, datas, wpls);
+            break;
+        case 19:
+            ferode256_1_9(datad, w, h, wpld, datas, wpls);
+            break;
+        case 20:
+            fdilate256_1_10(datad, w, h, wpld, datas, wpls);
+            break;
+        case 21:
+            ferode256_1_10(datad, w, h, wpld, datas, wpls);
+            break;
+        case 22:
+            fdilate256_1_11(datad, w, h, wpld, datas, wpls);
+            break;
+        case 23:
+            ferode256_1_11(datad, w, h, wpld, datas, wpls);
+            break;
+        case 24:
+            fdilate256_1_12(datad, w, h, wpld, datas, wpls);
+            break;
+        case 25:
+            ferode256_1_12(datad, w, h, wpld, datas, wpls);
+            break;
+        case 26:
+            fdilate256_1_13(datad, w, h, wpld, datas, wpls);
+            break;
+        case 27:
+            ferode256_1_13(datad, w, h, wpld, datas, wpls);
+            break;
+        case 28:
+            fdilate256_1_14(datad, w, h, wpld, datas, wpls);
+            break;
+        case 29:
+            ferode256_1_14(datad, w, h, wpld, datas, wpls);
+            break;
+        case 30:
+            fdilate256_1_15(datad, w, h, wpld, datas, wpls);
+            break;
+        case 31:
+            ferode256_1_15(datad, w, h, wpld, datas, wpls);
+            break;
+        case 32:
+            fdilate256_1_16(datad, w, h, wpld, datas, wpls);
+            break;
+        case 33:
+            ferode256_1_16(datad, w, h, wpld, datas, wpls);
+            break;
+        case 34:
+            fdilate256_1_17(datad, w, h, wpld, datas, wpls);
+            break;
+        case 35:
+            ferode256_1_17(datad, w, h, wpld, datas, wpls);
+            break;
+        case 36:
+            fdilate256_1_18(datad, w, h, wpld, datas, wpls);
+            break;
+        case 37:
+            ferode256_1_18(datad, w, h, wpld, datas, wpls);
+            break;
+        case 38:
+            fdilate256_1_19(datad, w, h, wpld, datas, wpls);
+            break;
+        case 39:
+            ferode256_1_19(datad, w, h, wpld, datas, wpls);
+            break;
+        case 40:
+            fdilate256_1_20(datad, w, h, wpld, datas, wpls);
+            break;
+        case 41:
+            ferode256_1_20(datad, w, h, wpld, datas, wpls);
+            break;
+        case 42:
+            fdilate256_1_21(datad, w, h, wpld, datas, wpls);
+            break;
+        case 43:
+            ferode256_1_21(datad, w, h, wpld, datas, wpls);
+            break;
+        case 44:
+            fdilate256_1_22(datad, w, h, wpld, datas, wpls);
+            break;
+        case 45:
+            ferode256_1_22(datad, w, h, wpld, datas, wpls);
+            break;
+        case 46:
+            fdilate256_1_23(datad, w, h, wpld, datas, wpls);
+            break;
+        case 47:
+            ferode256_1_23(datad, w, h, wpld, datas, wpls);
+            break;
+        case 48:
+            fdilate256_1_24(datad, w, h, wpld, datas, wpls);
+            break;
+        case 49:
+            ferode256_1_24(datad, w, h, wpld, datas, wpls);
+            break;
+        case 50:
+            fdilate256_1_25(datad, w, h, wpld, datas, wpls);
+            break;
+        case 51:
+            ferode256_1_25(datad, w, h, wpld, datas, wpls);
+            break;
+        case 52:
+            fdilate256_1_26(datad, w, h, wpld, datas, wpls);
+            break;
+        case 53:
+            ferode256_1_26(datad, w, h, wpld, datas, wpls);
+            break;
+        case 54:
+            fdilate256_1_27(datad, w, h, wpld, datas, wpls);
+            break;
+        case 55:
+            ferode256_1_27(datad, w, h, wpld, datas, wpls);
+            break;
+        case 56:
+            fdilate256_1_28(datad, w, h, wpld, datas, wpls);
+            break;
+        case 57:
+            ferode256_1_28(datad, w, h, wpld, datas, wpls);
+            break;
+        case 58:
+            fdilate256_1_29(datad, w, h, wpld, datas, wpls);
+            break;
+        case 59:
+            ferode256_1_29(datad, w, h, wpld, datas, wpls);
+            break;
+        case 60:
+            fdilate256_1_30(datad, w, h, wpld, datas, wpls);
+            break;
+        case 61:
+            ferode256_1_30(datad, w, h, wpld, datas, wpls);
+            break;
+        case 62:
+            fdilate256_1_31(datad, w, h, wpld, datas, wpls);
+            break;
+        case 63:
+            ferode256_1_31(datad, w, h, wpld, datas, wpls);
+            break;
+        case 64:
+            fdilate256_1_32(datad, w, h, wpld, datas, wpls);
+            break;
+        case 65:
+            ferode256_1_32(datad, w, h, wpld, datas, wpls);
+            break;
+        case 66:
+            fdilate256_1_33(datad, w, h, wpld, datas, wpls);
+            break;
+        case 67:
+            ferode256_1_33(datad, w, h, wpld, datas, wpls);
+            break;
+        case 68:
+            fdilate256_1_34(datad, w, h, wpld, datas, wpls);
+            break;
+        case 69:
+            ferode256_1_34(datad, w, h, wpld, datas, wpls);
+            break;
+        case 70:
+            fdilate256_1_35(datad, w, h, wpld, datas, wpls);
+            break;
+        case 71:
+            ferode256_1_35(datad, w, h, wpld, datas, wpls);
+            break;
+        case 72:
+            fdilate256_1_36(datad, w, h, wpld, datas, wpls);
+            break;
+        case 73:
+            ferode256_1_36(datad, w, h, wpld, datas, wpls);
+            break;
+        case 74:
+            fdilate256_1_37(datad, w, h, wpld, datas, wpls);
+            break;
+        case 75:
+            ferode256_1_37(datad, w, h, wpld, datas, wpls);
+            break;
+        case 76:
+            fdilate256_1_38(datad, w, h, wpld, datas, wpls);
+            break;
+        case 77:
+            ferode256_1_38(datad, w, h, wpld, datas, wpls);
+            break;
+        case 78:
+            fdilate256_1_39(datad, w, h, wpld, datas, wpls);
+            break;
+        case 79:
+            ferode256_1_39(datad, w, h, wpld, datas, wpls);
+            break;
+        case 80:
+            fdilate256_1_40(datad, w, h, wpld, datas, wpls);
+            break;
+        case 81:
+            ferode256_1_40(datad, w, h, wpld, datas, wpls);
+            break;
+        case 82:
+            fdilate256_1_41(datad, w, h, wpld, datas, wpls);
+            break;
+        case 83:
+            ferode256_1_41(datad, w, h, wpld, datas, wpls);
+            break;
+        case 84:
+            fdilate256_1_42(datad, w, h, wpld, datas, wpls);
+            break;
+        case 85:
+            ferode256_1_42(datad, w, h, wpld, datas, wpls);
+            break;
+        case 86:
+            fdilate256_1_43(datad, w, h, wpld, datas, wpls);
+            break;
+        case 87:
+            ferode256_1_43(datad, w, h, wpld, datas, wpls);
+            break;
+        case 88:
+            fdilate256_1_44(datad, w, h, wpld, datas, wpls);
+            break;
+        case 89:
+            ferode256_1_44(datad, w, h, wpld, datas, wpls);
+            break;
+        case 90:
+            fdilate256_1_45(datad, w, h, wpld, datas, wpls);
+            break;
+        case 91:
+            ferode256_1_45(datad, w, h, wpld, datas, wpls);
+            break;
+        case 92:
+            fdilate256_1_46(datad, w, h, wpld, datas, wpls);
+            break;
+        case 93:
+            ferode256_1_46(datad, w, h, wpld, datas, wpls);
+            break;
+        case 94:
+            fdilate256_1_47(datad, w, h, wpld, datas, wpls);
+            break;
+        case 95:
+            ferode256_1_47(datad, w, h, wpld, datas, wpls);
+            break;
+        case 96:
+            fdilate256_1_48(datad, w, h, wpld, datas, wpls);
+            break;
+        case 97:
+            ferode256_1_48(datad, w, h, wpld, datas, wpls);
+            break;
+        case 98:
+            fdilate256_1_49(datad, w, h, wpld, datas, wpls);
+            break;
+        case 99:
+            ferode256_1_49(datad, w, h, wpld, datas, wpls);
+            break;
+        case 100:
+            fdilate256_1_50(datad, w, h, wpld, datas, wpls);
+            break;
+        case 101:
+            ferode256_1_50(datad, w, h, wpld, datas, wpls);
+            break;
+        case 102:
+            fdilate256_1_51(datad, w, h, wpld, datas, wpls);
+            break;
+        case 103:
+            ferode256_1_51(datad, w, h, wpld, datas, wpls);
+            break;
+        case 104:
+            fdilate256_1_52(datad, w, h, wpld, datas, wpls);
+            break;
+        case 105:
+            ferode256_1_52(datad, w, h, wpld, datas, wpls);
+            break;
+        case 106:
+            fdilate256_1_53(datad, w, h, wpld, datas, wpls);
+            break;
+        case 107:
+            ferode256_1_53(datad, w, h, wpld, datas, wpls);
+            break;
+        case 108:
+            fdilate256_1_54(datad, w, h, wpld, datas, wpls);
+            break;
+        case 109:
+            ferode256_1_54(datad, w, h, wpld, datas, wpls);
+            break;
+        case 110:
+            fdilate256_1_55(datad, w, h, wpld, datas, wpls);
+            break;
+        case 111:
+            ferode256_1_55(datad, w, h, wpld, datas, wpls);
+            break;
+        case 112:
+            fdilate256_1_56(datad, w, h, wpld, datas, wpls);
+            break;
+        case 113:
+            ferode256_1_56(datad, w, h, wpld, datas, wpls);
+            break;
+        case 114:
+            fdilate256_1_57(datad, w, h, wpld, datas, wpls);
+            break;
+        case 115:
+            ferode256_1_57(datad, w, h, wpld, datas, wpls);
+            break;
+        }
+        return 0;
+    }
+#endif  /* L_HAVE_AVX2 */
+    if (width == 64) {
+        switch (index)
+        {
+        case 0:
+            fdilate64_1_0(datad, w, h, wpld, datas, wpls);
+            break;
+        case 1:
+            ferode64_1_0(datad, w, h, wpld, datas, wpls);
+            break;
+        case 2:
+            fdilate64_1_1(datad, w, h, wpld, datas, wpls);
+            break;
+        case 3:
+            ferode64_1_1(datad, w, h, wpld, datas, wpls);
+            break;
+        case 4:
+            fdilate64_1_2(datad, w, h, wpld, datas, wpls);
+            break;
+        case 5:
+            ferode64_1_2(datad, w, h, wpld, datas, wpls);
+            break;
+        case 6:
+            fdilate64_1_3(datad, w, h, wpld, datas, wpls);
+            break;
+        case 7:
+            ferode64_1_3(datad, w, h, wpld, datas, wpls);
+            break;
+        case 8:
+            fdilate64_1_4(datad, w, h, wpld, datas, wpls);
+            break;
+        case 9:
+            ferode64_1_4(datad, w, h, wpld, datas, wpls);
+            break;
+        case 10:
+            fdilate64_1_5(datad, w, h, wpld, datas, wpls);
+            break;
+        case 11:
+            ferode64_1_5(datad, w, h, wpld, datas, wpls);
+            break;
+        case 12:
+            fdilate64_1_6(datad, w, h, wpld, datas, wpls);
+            break;
+        case 13:
+            ferode64_1_6(datad, w, h, wpld, datas, wpls);
+            break;
+        case 14:
+            fdilate64_1_7(datad, w, h, wpld, datas, wpls);
+            break;
+        case 15:
+            ferode64_1_7(datad, w, h, wpld, datas, wpls);
+            break;
+        case 16:
+            fdilate64_1_8(datad, w, h, wpld, datas, wpls);
+            break;
+        case 17:
+            ferode64_1_8(datad, w, h, wpld, datas, wpls);
+            break;
+        case 18:
+            fdilate64_1_9(datad, w, h, wpld, datas, wpls);
+            break;
+        case 19:
+            ferode64_1_9(datad, w, h, wpld, datas, wpls);
+            break;
+        case 20:
+            fdilate64_1_10(datad, w, h, wpld, datas, wpls);
+            break;
+        case 21:
+            ferode64_1_10(datad, w, h, wpld, datas, wpls);
+            break;
+        case 22:
+            fdilate64_1_11(datad, w, h, wpld, datas, wpls);
+            break;
+        case 23:
+            ferode64_1_11(datad, w, h, wpld, datas, wpls);
+            break;
+        case 24:
+            fdilate64_1_12(datad, w, h, wpld, datas, wpls);
+            break;
+        case 25:
+            ferode64_1_12(datad, w, h, wpld, datas, wpls);
+            break;
+        case 26:
+            fdilate64_1_13(datad, w, h, wpld, datas, wpls);
+            break;
+        case 27:
+            ferode64_1_13(datad, w, h, wpld, datas, wpls);
+            break;
+        case 28:
+            fdilate64_1_14(datad, w, h, wpld, datas, wpls);
+            break;
+        case 29:
+            ferode64_1_14(datad, w, h, wpld, datas, wpls);
+            break;
+        case 30:
+            fdilate64_1_15(datad, w, h, wpld, datas, wpls);
+            break;
+        case 31:
+            ferode64_1_15(datad, w, h, wpld, datas, wpls);
+            break;
+        case 32:
+            fdilate64_1_16(datad, w, h, wpld, datas, wpls);
+            break;
+        case 33:
+            ferode64_1_16(datad, w, h, wpld, datas, wpls);
+            break;
+        case 34:
+            fdilate64_1_17(datad, w, h, wpld, datas, wpls);
+            break;
+        case 35:
+            ferode64_1_17(datad, w, h, wpld, datas, wpls);
+            break;
+        case 36:
+            fdilate64_1_18(datad, w, h, wpld, datas, wpls);
+            break;
+        case 37:
+            ferode64_1_18(datad, w, h, wpld, datas, wpls);
+            break;
+        case 38:
+            fdilate64_1_19(datad, w, h, wpld, datas, wpls);
+            break;
+        case 39:
+            ferode64_1_19(datad, w, h, wpld, datas, wpls);
+            break;
+        case 40:
+            fdilate64_1_20(datad, w, h, wpld, datas, wpls);
+            break;
+        case 41:
+            ferode64_1_20(datad, w, h, wpld, datas, wpls);
+            break;
+        case 42:
+            fdilate64_1_21(datad, w, h, wpld, datas, wpls);
+            break;
+        case 43:
+            ferode64_1_21(datad, w, h, wpld, datas, wpls);
+            break;
+        case 44:
+            fdilate64_1_22(datad, w, h, wpld, datas, wpls);
+            break;
+        case 45:
+            ferode64_1_22(datad, w, h, wpld, datas, wpls);
+            break;
+        case 46:
+            fdilate64_1_23(datad, w, h, wpld, datas, wpls);
+            break;
+        case 47:
+            ferode64_1_23(datad, w, h, wpld, datas, wpls);
+            break;
+        case 48:
+            fdilate64_1_24(datad, w, h, wpld, datas, wpls);
+            break;
+        case 49:
+            ferode64_1_24(datad, w, h, wpld, datas, wpls);
+            break;
+        case 50:
+            fdilate64_1_25(datad, w, h, wpld, datas, wpls);
+            break;
+        case 51:
+            ferode64_1_25(datad, w, h, wpld, datas, wpls);
+            break;
+        case 52:
+            fdilate64_1_26(datad, w, h, wpld, datas, wpls);
+            break;
+        case 53:
+            ferode64_1_26(datad, w, h, wpld, datas, wpls);
+            break;
+        case 54:
+            fdilate64_1_27(datad, w, h, wpld, datas, wpls);
+            break;
+        case 55:
+            ferode64_1_27(datad, w, h, wpld, datas, wpls);
+            break;
+        case 56:
+            fdilate64_1_28(datad, w, h, wpld, datas, wpls);
+            break;
+        case 57:
+            ferode64_1_28(datad, w, h, wpld, datas, wpls);
+            break;
+        case 58:
+            fdilate64_1_29(datad, w, h, wpld, datas, wpls);
+            break;
+        case 59:
+            ferode64_1_29(datad, w, h, wpld, datas, wpls);
+            break;
+        case 60:
+            fdilate64_1_30(datad, w, h, wpld, datas, wpls);
+            break;
+        case 61:
+            ferode64_1_30(datad, w, h, wpld, datas, wpls);
+            break;
+        case 62:
+            fdilate64_1_31(datad, w, h, wpld, datas, wpls);
+            break;
+        case 63:
+            ferode64_1_31(datad, w, h, wpld, datas, wpls);
+            break;
+        case 64:
+            fdilate64_1_32(datad, w, h, wpld, datas, wpls);
+            break;
+        case 65:
+            ferode64_1_32(datad, w, h, wpld, datas, wpls);
+            break;
+        case 66:
+            fdilate64_1_33(datad, w, h, wpld, datas, wpls);
+            break;
+        case 67:
+            ferode64_1_33(datad, w, h, wpld, datas, wpls);
+            break;
+        case 68:
+            fdilate64_1_34(datad, w, h, wpld, datas, wpls);
+            break;
+        case 69:
+            ferode64_1_34(datad, w, h, wpld, datas, wpls);
+            break;
+        case 70:
+            fdilate64_1_35(datad, w, h, wpld, datas, wpls);
+            break;
+        case 71:
+            ferode64_1_35(datad, w, h, wpld, datas, wpls);
+            break;
+        case 72:
+            fdilate64_1_36(datad, w, h, wpld, datas, wpls);
+            break;
+        case 73:
+            ferode64_1_36(datad, w, h, wpld, datas, wpls);
+            break;
+        case 74:
+            fdilate64_1_37(datad, w, h, wpld, datas, wpls);
+            break;
+        case 75:
+            ferode64_1_37(datad, w, h, wpld, datas, wpls);
+            break;
+        case 76:
+            fdilate64_1_38(datad, w, h, wpld, datas, wpls);
+            break;
+        case 77:
+            ferode64_1_38(datad, w, h, wpld, datas, wpls);
+            break;
+        case 78:
+            fdilate64_1_39(datad, w, h, wpld, datas, wpls);
+            break;
+        case 79:
+            ferode64_1_39(datad, w, h, wpld, datas, wpls);
+            break;
+        case 80:
+            fdilate64_1_40(datad, w, h, wpld, datas, wpls);
+            break;
+        case 81:
+            ferode64_1_40(datad, w, h, wpld, datas, wpls);
+            break;
+        case 82:
+            fdilate64_1_41(datad, w, h, wpld, datas, wpls);
+            break;
+        case 83:
+            ferode64_1_41(datad, w, h, wpld, datas, wpls);
+            break;
+        case 84:
+            fdilate64_1_42(datad, w, h, wpld, datas, wpls);
+            break;
+        case 85:
+            ferode64_1_42(datad, w, h, wpld, datas, wpls);
+            break;
+        case 86:
+            fdilate64_1_43(datad, w, h, wpld, datas, wpls);
+            break;
+        case 87:
+            ferode64_1_43(datad, w, h, wpld, datas, wpls);
+            break;
+        case 88:
+            fdilate64_1_44(datad, w, h, wpld, datas, wpls);
+            break;
+        case 89:
+            ferode64_1_44(datad, w, h, wpld, datas, wpls);
+            break;
+        case 90:
+            fdilate64_1_45(datad, w, h, wpld, datas, wpls);
+            break;
+        case 91:
+            ferode64_1_45(datad, w, h, wpld, datas, wpls);
+            break;
+        case 92:
+            fdilate64_1_46(datad, w, h, wpld, datas, wpls);
+            break;
+        case 93:
+            ferode64_1_46(datad, w, h, wpld, datas, wpls);
+            break;
+        case 94:
+            fdilate64_1_47(datad, w, h, wpld, datas, wpls);
+            break;
+        case 95:
+            ferode64_1_47(datad, w, h, wpld, datas, wpls);
+            break;
+        case 96:
+            fdilate64_1_48(datad, w, h, wpld, datas, wpls);
+            break;
+        case 97:
+            ferode64_1_48(datad, w, h, wpld, datas, wpls);
+            break;
+        case 98:
+            fdilate64_1_49(datad, w, h, wpld, datas, wpls);
+            break;
+        case 99:
+            ferode64_1_49(datad, w, h, wpld, datas, wpls);
+            break;
+        case 100:
+            fdilate64_1_50(datad, w, h, wpld, datas, wpls);
+            break;
+        case 101:
+            ferode64_1_50(datad, w, h, wpld, datas, wpls);
+            break;
+        case 102:
+            fdilate64_1_51(datad, w, h, wpld, datas, wpls);
+            break;
+        case 103:
+            ferode64_1_51(datad, w, h, wpld, datas, wpls);
+            break;
+        case 104:
+            fdilate64_1_52(datad, w, h, wpld, datas, wpls);
+            break;
+        case 105:
+            ferode64_1_52(datad, w, h, wpld, datas, wpls);
+            break;
+        case 106:
+            fdilate64_1_53(datad, w, h, wpld, datas, wpls);
+            break;
+        case 107:
+            ferode64_1_53(datad, w, h, wpld, datas, wpls);
+            break;
+        case 108:
+            fdilate64_1_54(datad, w, h, wpld, datas, wpls);
+            break;
+        case 109:
+            ferode64_1_54(datad, w, h, wpld, datas, wpls);
+            break;
+        case 110:
+            fdilate64_1_55(datad, w, h, wpld, datas, wpls);
+            break;
+        case 111:
+            ferode64_1_55(datad, w, h, wpld, datas, wpls);
+            break;
+        case 112:
+            fdilate64_1_56(datad, w, h, wpld, datas, wpls);
+            break;
+        case 113:
+            ferode64_1_56(datad, w, h, wpld, datas, wpls);
+            break;
+        case 114:
+            fdilate64_1_57(datad, w, h, wpld, datas, wpls);
+            break;
+        case 115:
+            ferode64_1_57(datad, w, h, wpld, datas, wpls);
+            break;
+        }
+        return 0;
+    }
 
     switch (index)
     {
@@ -539,6 +1511,12 @@ fmorphopgen_low_1(l_uint32  *datad,
  *        code by redefining w and h smaller and by moving the
  *        start-of-image pointers up to the beginning of this
  *        interior rectangle.
+ *
+ *        The 64-bit and 256-bit versions of each routine do most
+ *        of each line two or eight words at a time, and finish it
+ *        with the 32-bit code.  Horizontal shifts are always less
+ *        than 32, so the funnel shifts on the wider words give the
+ *        same bits as the 32-bit code.
  */
 static void
 fdilate_1_0(l_uint32  *datad,
@@ -5860,3 +6838,16025 @@ l_int32             wpls2;
     }
 }
 
+static void
+fdilate64_1_0(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr);
+        }
+    }
+}
+
+static void
+ferode64_1_0(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr);
+        }
+    }
+}
+
+static void
+fdilate64_1_1(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31));
+        }
+    }
+}
+
+static void
+ferode64_1_1(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31));
+        }
+    }
+}
+
+static void
+fdilate64_1_2(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31));
+        }
+    }
+}
+
+static void
+ferode64_1_2(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31));
+        }
+    }
+}
+
+static void
+fdilate64_1_3(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30));
+        }
+    }
+}
+
+static void
+ferode64_1_3(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30));
+        }
+    }
+}
+
+static void
+fdilate64_1_4(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30));
+        }
+    }
+}
+
+static void
+ferode64_1_4(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30));
+        }
+    }
+}
+
+static void
+fdilate64_1_5(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29));
+        }
+    }
+}
+
+static void
+ferode64_1_5(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29));
+        }
+    }
+}
+
+static void
+fdilate64_1_6(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29));
+        }
+    }
+}
+
+static void
+ferode64_1_6(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29));
+        }
+    }
+}
+
+static void
+fdilate64_1_7(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28));
+        }
+    }
+}
+
+static void
+ferode64_1_7(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28));
+        }
+    }
+}
+
+static void
+fdilate64_1_8(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28));
+        }
+    }
+}
+
+static void
+ferode64_1_8(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28));
+        }
+    }
+}
+
+static void
+fdilate64_1_9(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27));
+        }
+    }
+}
+
+static void
+ferode64_1_9(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27));
+        }
+    }
+}
+
+static void
+fdilate64_1_10(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27));
+        }
+    }
+}
+
+static void
+ferode64_1_10(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27));
+        }
+    }
+}
+
+static void
+fdilate64_1_11(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26));
+        }
+    }
+}
+
+static void
+ferode64_1_11(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26));
+        }
+    }
+}
+
+static void
+fdilate64_1_12(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 7) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26));
+        }
+    }
+}
+
+static void
+ferode64_1_12(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 7) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26));
+        }
+    }
+}
+
+static void
+fdilate64_1_13(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 7) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 7);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25));
+        }
+    }
+}
+
+static void
+ferode64_1_13(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 7) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 7);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25));
+        }
+    }
+}
+
+static void
+fdilate64_1_14(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 10) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_SHL64(sptr, 8) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 7) |
+                    DWA_SHR64(sptr, 8) |
+                    DWA_SHR64(sptr, 9);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23));
+        }
+    }
+}
+
+static void
+ferode64_1_14(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 10) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_SHR64(sptr, 8) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 7) &
+                    DWA_SHL64(sptr, 8) &
+                    DWA_SHL64(sptr, 9);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23));
+        }
+    }
+}
+
+static void
+fdilate64_1_15(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 10) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_SHL64(sptr, 8) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 7) |
+                    DWA_SHR64(sptr, 8) |
+                    DWA_SHR64(sptr, 9) |
+                    DWA_SHR64(sptr, 10);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22));
+        }
+    }
+}
+
+static void
+ferode64_1_15(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 10) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_SHR64(sptr, 8) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 7) &
+                    DWA_SHL64(sptr, 8) &
+                    DWA_SHL64(sptr, 9) &
+                    DWA_SHL64(sptr, 10);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22));
+        }
+    }
+}
+
+static void
+fdilate64_1_16(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 12) |
+                    DWA_SHL64(sptr, 11) |
+                    DWA_SHL64(sptr, 10) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_SHL64(sptr, 8) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 7) |
+                    DWA_SHR64(sptr, 8) |
+                    DWA_SHR64(sptr, 9) |
+                    DWA_SHR64(sptr, 10) |
+                    DWA_SHR64(sptr, 11) |
+                    DWA_SHR64(sptr, 12);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20));
+        }
+    }
+}
+
+static void
+ferode64_1_16(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 12) &
+                    DWA_SHR64(sptr, 11) &
+                    DWA_SHR64(sptr, 10) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_SHR64(sptr, 8) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 7) &
+                    DWA_SHL64(sptr, 8) &
+                    DWA_SHL64(sptr, 9) &
+                    DWA_SHL64(sptr, 10) &
+                    DWA_SHL64(sptr, 11) &
+                    DWA_SHL64(sptr, 12);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20));
+        }
+    }
+}
+
+static void
+fdilate64_1_17(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 15) |
+                    DWA_SHL64(sptr, 14) |
+                    DWA_SHL64(sptr, 13) |
+                    DWA_SHL64(sptr, 12) |
+                    DWA_SHL64(sptr, 11) |
+                    DWA_SHL64(sptr, 10) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_SHL64(sptr, 8) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 7) |
+                    DWA_SHR64(sptr, 8) |
+                    DWA_SHR64(sptr, 9) |
+                    DWA_SHR64(sptr, 10) |
+                    DWA_SHR64(sptr, 11) |
+                    DWA_SHR64(sptr, 12) |
+                    DWA_SHR64(sptr, 13) |
+                    DWA_SHR64(sptr, 14);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18));
+        }
+    }
+}
+
+static void
+ferode64_1_17(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 15) &
+                    DWA_SHR64(sptr, 14) &
+                    DWA_SHR64(sptr, 13) &
+                    DWA_SHR64(sptr, 12) &
+                    DWA_SHR64(sptr, 11) &
+                    DWA_SHR64(sptr, 10) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_SHR64(sptr, 8) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 7) &
+                    DWA_SHL64(sptr, 8) &
+                    DWA_SHL64(sptr, 9) &
+                    DWA_SHL64(sptr, 10) &
+                    DWA_SHL64(sptr, 11) &
+                    DWA_SHL64(sptr, 12) &
+                    DWA_SHL64(sptr, 13) &
+                    DWA_SHL64(sptr, 14);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18));
+        }
+    }
+}
+
+static void
+fdilate64_1_18(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 15) |
+                    DWA_SHL64(sptr, 14) |
+                    DWA_SHL64(sptr, 13) |
+                    DWA_SHL64(sptr, 12) |
+                    DWA_SHL64(sptr, 11) |
+                    DWA_SHL64(sptr, 10) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_SHL64(sptr, 8) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 7) |
+                    DWA_SHR64(sptr, 8) |
+                    DWA_SHR64(sptr, 9) |
+                    DWA_SHR64(sptr, 10) |
+                    DWA_SHR64(sptr, 11) |
+                    DWA_SHR64(sptr, 12) |
+                    DWA_SHR64(sptr, 13) |
+                    DWA_SHR64(sptr, 14) |
+                    DWA_SHR64(sptr, 15);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17));
+        }
+    }
+}
+
+static void
+ferode64_1_18(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 15) &
+                    DWA_SHR64(sptr, 14) &
+                    DWA_SHR64(sptr, 13) &
+                    DWA_SHR64(sptr, 12) &
+                    DWA_SHR64(sptr, 11) &
+                    DWA_SHR64(sptr, 10) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_SHR64(sptr, 8) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 7) &
+                    DWA_SHL64(sptr, 8) &
+                    DWA_SHL64(sptr, 9) &
+                    DWA_SHL64(sptr, 10) &
+                    DWA_SHL64(sptr, 11) &
+                    DWA_SHL64(sptr, 12) &
+                    DWA_SHL64(sptr, 13) &
+                    DWA_SHL64(sptr, 14) &
+                    DWA_SHL64(sptr, 15);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17));
+        }
+    }
+}
+
+static void
+fdilate64_1_19(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 17) |
+                    DWA_SHL64(sptr, 16) |
+                    DWA_SHL64(sptr, 15) |
+                    DWA_SHL64(sptr, 14) |
+                    DWA_SHL64(sptr, 13) |
+                    DWA_SHL64(sptr, 12) |
+                    DWA_SHL64(sptr, 11) |
+                    DWA_SHL64(sptr, 10) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_SHL64(sptr, 8) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 7) |
+                    DWA_SHR64(sptr, 8) |
+                    DWA_SHR64(sptr, 9) |
+                    DWA_SHR64(sptr, 10) |
+                    DWA_SHR64(sptr, 11) |
+                    DWA_SHR64(sptr, 12) |
+                    DWA_SHR64(sptr, 13) |
+                    DWA_SHR64(sptr, 14) |
+                    DWA_SHR64(sptr, 15) |
+                    DWA_SHR64(sptr, 16) |
+                    DWA_SHR64(sptr, 17);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15));
+        }
+    }
+}
+
+static void
+ferode64_1_19(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 17) &
+                    DWA_SHR64(sptr, 16) &
+                    DWA_SHR64(sptr, 15) &
+                    DWA_SHR64(sptr, 14) &
+                    DWA_SHR64(sptr, 13) &
+                    DWA_SHR64(sptr, 12) &
+                    DWA_SHR64(sptr, 11) &
+                    DWA_SHR64(sptr, 10) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_SHR64(sptr, 8) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 7) &
+                    DWA_SHL64(sptr, 8) &
+                    DWA_SHL64(sptr, 9) &
+                    DWA_SHL64(sptr, 10) &
+                    DWA_SHL64(sptr, 11) &
+                    DWA_SHL64(sptr, 12) &
+                    DWA_SHL64(sptr, 13) &
+                    DWA_SHL64(sptr, 14) &
+                    DWA_SHL64(sptr, 15) &
+                    DWA_SHL64(sptr, 16) &
+                    DWA_SHL64(sptr, 17);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15));
+        }
+    }
+}
+
+static void
+fdilate64_1_20(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 20) |
+                    DWA_SHL64(sptr, 19) |
+                    DWA_SHL64(sptr, 18) |
+                    DWA_SHL64(sptr, 17) |
+                    DWA_SHL64(sptr, 16) |
+                    DWA_SHL64(sptr, 15) |
+                    DWA_SHL64(sptr, 14) |
+                    DWA_SHL64(sptr, 13) |
+                    DWA_SHL64(sptr, 12) |
+                    DWA_SHL64(sptr, 11) |
+                    DWA_SHL64(sptr, 10) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_SHL64(sptr, 8) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 7) |
+                    DWA_SHR64(sptr, 8) |
+                    DWA_SHR64(sptr, 9) |
+                    DWA_SHR64(sptr, 10) |
+                    DWA_SHR64(sptr, 11) |
+                    DWA_SHR64(sptr, 12) |
+                    DWA_SHR64(sptr, 13) |
+                    DWA_SHR64(sptr, 14) |
+                    DWA_SHR64(sptr, 15) |
+                    DWA_SHR64(sptr, 16) |
+                    DWA_SHR64(sptr, 17) |
+                    DWA_SHR64(sptr, 18) |
+                    DWA_SHR64(sptr, 19);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) |
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) |
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13));
+        }
+    }
+}
+
+static void
+ferode64_1_20(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 20) &
+                    DWA_SHR64(sptr, 19) &
+                    DWA_SHR64(sptr, 18) &
+                    DWA_SHR64(sptr, 17) &
+                    DWA_SHR64(sptr, 16) &
+                    DWA_SHR64(sptr, 15) &
+                    DWA_SHR64(sptr, 14) &
+                    DWA_SHR64(sptr, 13) &
+                    DWA_SHR64(sptr, 12) &
+                    DWA_SHR64(sptr, 11) &
+                    DWA_SHR64(sptr, 10) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_SHR64(sptr, 8) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 7) &
+                    DWA_SHL64(sptr, 8) &
+                    DWA_SHL64(sptr, 9) &
+                    DWA_SHL64(sptr, 10) &
+                    DWA_SHL64(sptr, 11) &
+                    DWA_SHL64(sptr, 12) &
+                    DWA_SHL64(sptr, 13) &
+                    DWA_SHL64(sptr, 14) &
+                    DWA_SHL64(sptr, 15) &
+                    DWA_SHL64(sptr, 16) &
+                    DWA_SHL64(sptr, 17) &
+                    DWA_SHL64(sptr, 18) &
+                    DWA_SHL64(sptr, 19);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) &
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) &
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13));
+        }
+    }
+}
+
+static void
+fdilate64_1_21(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 20) |
+                    DWA_SHL64(sptr, 19) |
+                    DWA_SHL64(sptr, 18) |
+                    DWA_SHL64(sptr, 17) |
+                    DWA_SHL64(sptr, 16) |
+                    DWA_SHL64(sptr, 15) |
+                    DWA_SHL64(sptr, 14) |
+                    DWA_SHL64(sptr, 13) |
+                    DWA_SHL64(sptr, 12) |
+                    DWA_SHL64(sptr, 11) |
+                    DWA_SHL64(sptr, 10) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_SHL64(sptr, 8) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 7) |
+                    DWA_SHR64(sptr, 8) |
+                    DWA_SHR64(sptr, 9) |
+                    DWA_SHR64(sptr, 10) |
+                    DWA_SHR64(sptr, 11) |
+                    DWA_SHR64(sptr, 12) |
+                    DWA_SHR64(sptr, 13) |
+                    DWA_SHR64(sptr, 14) |
+                    DWA_SHR64(sptr, 15) |
+                    DWA_SHR64(sptr, 16) |
+                    DWA_SHR64(sptr, 17) |
+                    DWA_SHR64(sptr, 18) |
+                    DWA_SHR64(sptr, 19) |
+                    DWA_SHR64(sptr, 20);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) |
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) |
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) |
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12));
+        }
+    }
+}
+
+static void
+ferode64_1_21(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 20) &
+                    DWA_SHR64(sptr, 19) &
+                    DWA_SHR64(sptr, 18) &
+                    DWA_SHR64(sptr, 17) &
+                    DWA_SHR64(sptr, 16) &
+                    DWA_SHR64(sptr, 15) &
+                    DWA_SHR64(sptr, 14) &
+                    DWA_SHR64(sptr, 13) &
+                    DWA_SHR64(sptr, 12) &
+                    DWA_SHR64(sptr, 11) &
+                    DWA_SHR64(sptr, 10) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_SHR64(sptr, 8) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 7) &
+                    DWA_SHL64(sptr, 8) &
+                    DWA_SHL64(sptr, 9) &
+                    DWA_SHL64(sptr, 10) &
+                    DWA_SHL64(sptr, 11) &
+                    DWA_SHL64(sptr, 12) &
+                    DWA_SHL64(sptr, 13) &
+                    DWA_SHL64(sptr, 14) &
+                    DWA_SHL64(sptr, 15) &
+                    DWA_SHL64(sptr, 16) &
+                    DWA_SHL64(sptr, 17) &
+                    DWA_SHL64(sptr, 18) &
+                    DWA_SHL64(sptr, 19) &
+                    DWA_SHL64(sptr, 20);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) &
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) &
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) &
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12));
+        }
+    }
+}
+
+static void
+fdilate64_1_22(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 22) |
+                    DWA_SHL64(sptr, 21) |
+                    DWA_SHL64(sptr, 20) |
+                    DWA_SHL64(sptr, 19) |
+                    DWA_SHL64(sptr, 18) |
+                    DWA_SHL64(sptr, 17) |
+                    DWA_SHL64(sptr, 16) |
+                    DWA_SHL64(sptr, 15) |
+                    DWA_SHL64(sptr, 14) |
+                    DWA_SHL64(sptr, 13) |
+                    DWA_SHL64(sptr, 12) |
+                    DWA_SHL64(sptr, 11) |
+                    DWA_SHL64(sptr, 10) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_SHL64(sptr, 8) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 7) |
+                    DWA_SHR64(sptr, 8) |
+                    DWA_SHR64(sptr, 9) |
+                    DWA_SHR64(sptr, 10) |
+                    DWA_SHR64(sptr, 11) |
+                    DWA_SHR64(sptr, 12) |
+                    DWA_SHR64(sptr, 13) |
+                    DWA_SHR64(sptr, 14) |
+                    DWA_SHR64(sptr, 15) |
+                    DWA_SHR64(sptr, 16) |
+                    DWA_SHR64(sptr, 17) |
+                    DWA_SHR64(sptr, 18) |
+                    DWA_SHR64(sptr, 19) |
+                    DWA_SHR64(sptr, 20) |
+                    DWA_SHR64(sptr, 21) |
+                    DWA_SHR64(sptr, 22);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 22) | (*(sptr + 1) >> 10)) |
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11)) |
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) |
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) |
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) |
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12)) |
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11)) |
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10));
+        }
+    }
+}
+
+static void
+ferode64_1_22(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 22) &
+                    DWA_SHR64(sptr, 21) &
+                    DWA_SHR64(sptr, 20) &
+                    DWA_SHR64(sptr, 19) &
+                    DWA_SHR64(sptr, 18) &
+                    DWA_SHR64(sptr, 17) &
+                    DWA_SHR64(sptr, 16) &
+                    DWA_SHR64(sptr, 15) &
+                    DWA_SHR64(sptr, 14) &
+                    DWA_SHR64(sptr, 13) &
+                    DWA_SHR64(sptr, 12) &
+                    DWA_SHR64(sptr, 11) &
+                    DWA_SHR64(sptr, 10) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_SHR64(sptr, 8) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 7) &
+                    DWA_SHL64(sptr, 8) &
+                    DWA_SHL64(sptr, 9) &
+                    DWA_SHL64(sptr, 10) &
+                    DWA_SHL64(sptr, 11) &
+                    DWA_SHL64(sptr, 12) &
+                    DWA_SHL64(sptr, 13) &
+                    DWA_SHL64(sptr, 14) &
+                    DWA_SHL64(sptr, 15) &
+                    DWA_SHL64(sptr, 16) &
+                    DWA_SHL64(sptr, 17) &
+                    DWA_SHL64(sptr, 18) &
+                    DWA_SHL64(sptr, 19) &
+                    DWA_SHL64(sptr, 20) &
+                    DWA_SHL64(sptr, 21) &
+                    DWA_SHL64(sptr, 22);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 22) | (*(sptr - 1) << 10)) &
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11)) &
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) &
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) &
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) &
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12)) &
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11)) &
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10));
+        }
+    }
+}
+
+static void
+fdilate64_1_23(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 25) |
+                    DWA_SHL64(sptr, 24) |
+                    DWA_SHL64(sptr, 23) |
+                    DWA_SHL64(sptr, 22) |
+                    DWA_SHL64(sptr, 21) |
+                    DWA_SHL64(sptr, 20) |
+                    DWA_SHL64(sptr, 19) |
+                    DWA_SHL64(sptr, 18) |
+                    DWA_SHL64(sptr, 17) |
+                    DWA_SHL64(sptr, 16) |
+                    DWA_SHL64(sptr, 15) |
+                    DWA_SHL64(sptr, 14) |
+                    DWA_SHL64(sptr, 13) |
+                    DWA_SHL64(sptr, 12) |
+                    DWA_SHL64(sptr, 11) |
+                    DWA_SHL64(sptr, 10) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_SHL64(sptr, 8) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 7) |
+                    DWA_SHR64(sptr, 8) |
+                    DWA_SHR64(sptr, 9) |
+                    DWA_SHR64(sptr, 10) |
+                    DWA_SHR64(sptr, 11) |
+                    DWA_SHR64(sptr, 12) |
+                    DWA_SHR64(sptr, 13) |
+                    DWA_SHR64(sptr, 14) |
+                    DWA_SHR64(sptr, 15) |
+                    DWA_SHR64(sptr, 16) |
+                    DWA_SHR64(sptr, 17) |
+                    DWA_SHR64(sptr, 18) |
+                    DWA_SHR64(sptr, 19) |
+                    DWA_SHR64(sptr, 20) |
+                    DWA_SHR64(sptr, 21) |
+                    DWA_SHR64(sptr, 22) |
+                    DWA_SHR64(sptr, 23) |
+                    DWA_SHR64(sptr, 24);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 25) | (*(sptr + 1) >> 7)) |
+                    ((*(sptr) << 24) | (*(sptr + 1) >> 8)) |
+                    ((*(sptr) << 23) | (*(sptr + 1) >> 9)) |
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10)) |
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11)) |
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) |
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) |
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) |
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12)) |
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11)) |
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10)) |
+                    ((*(sptr) >> 23) | (*(sptr - 1) << 9)) |
+                    ((*(sptr) >> 24) | (*(sptr - 1) << 8));
+        }
+    }
+}
+
+static void
+ferode64_1_23(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 25) &
+                    DWA_SHR64(sptr, 24) &
+                    DWA_SHR64(sptr, 23) &
+                    DWA_SHR64(sptr, 22) &
+                    DWA_SHR64(sptr, 21) &
+                    DWA_SHR64(sptr, 20) &
+                    DWA_SHR64(sptr, 19) &
+                    DWA_SHR64(sptr, 18) &
+                    DWA_SHR64(sptr, 17) &
+                    DWA_SHR64(sptr, 16) &
+                    DWA_SHR64(sptr, 15) &
+                    DWA_SHR64(sptr, 14) &
+                    DWA_SHR64(sptr, 13) &
+                    DWA_SHR64(sptr, 12) &
+                    DWA_SHR64(sptr, 11) &
+                    DWA_SHR64(sptr, 10) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_SHR64(sptr, 8) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 7) &
+                    DWA_SHL64(sptr, 8) &
+                    DWA_SHL64(sptr, 9) &
+                    DWA_SHL64(sptr, 10) &
+                    DWA_SHL64(sptr, 11) &
+                    DWA_SHL64(sptr, 12) &
+                    DWA_SHL64(sptr, 13) &
+                    DWA_SHL64(sptr, 14) &
+                    DWA_SHL64(sptr, 15) &
+                    DWA_SHL64(sptr, 16) &
+                    DWA_SHL64(sptr, 17) &
+                    DWA_SHL64(sptr, 18) &
+                    DWA_SHL64(sptr, 19) &
+                    DWA_SHL64(sptr, 20) &
+                    DWA_SHL64(sptr, 21) &
+                    DWA_SHL64(sptr, 22) &
+                    DWA_SHL64(sptr, 23) &
+                    DWA_SHL64(sptr, 24);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 25) | (*(sptr - 1) << 7)) &
+                    ((*(sptr) >> 24) | (*(sptr - 1) << 8)) &
+                    ((*(sptr) >> 23) | (*(sptr - 1) << 9)) &
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10)) &
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11)) &
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) &
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) &
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) &
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12)) &
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11)) &
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10)) &
+                    ((*(sptr) << 23) | (*(sptr + 1) >> 9)) &
+                    ((*(sptr) << 24) | (*(sptr + 1) >> 8));
+        }
+    }
+}
+
+static void
+fdilate64_1_24(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 25) |
+                    DWA_SHL64(sptr, 24) |
+                    DWA_SHL64(sptr, 23) |
+                    DWA_SHL64(sptr, 22) |
+                    DWA_SHL64(sptr, 21) |
+                    DWA_SHL64(sptr, 20) |
+                    DWA_SHL64(sptr, 19) |
+                    DWA_SHL64(sptr, 18) |
+                    DWA_SHL64(sptr, 17) |
+                    DWA_SHL64(sptr, 16) |
+                    DWA_SHL64(sptr, 15) |
+                    DWA_SHL64(sptr, 14) |
+                    DWA_SHL64(sptr, 13) |
+                    DWA_SHL64(sptr, 12) |
+                    DWA_SHL64(sptr, 11) |
+                    DWA_SHL64(sptr, 10) |
+                    DWA_SHL64(sptr, 9) |
+                    DWA_SHL64(sptr, 8) |
+                    DWA_SHL64(sptr, 7) |
+                    DWA_SHL64(sptr, 6) |
+                    DWA_SHL64(sptr, 5) |
+                    DWA_SHL64(sptr, 4) |
+                    DWA_SHL64(sptr, 3) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHR64(sptr, 3) |
+                    DWA_SHR64(sptr, 4) |
+                    DWA_SHR64(sptr, 5) |
+                    DWA_SHR64(sptr, 6) |
+                    DWA_SHR64(sptr, 7) |
+                    DWA_SHR64(sptr, 8) |
+                    DWA_SHR64(sptr, 9) |
+                    DWA_SHR64(sptr, 10) |
+                    DWA_SHR64(sptr, 11) |
+                    DWA_SHR64(sptr, 12) |
+                    DWA_SHR64(sptr, 13) |
+                    DWA_SHR64(sptr, 14) |
+                    DWA_SHR64(sptr, 15) |
+                    DWA_SHR64(sptr, 16) |
+                    DWA_SHR64(sptr, 17) |
+                    DWA_SHR64(sptr, 18) |
+                    DWA_SHR64(sptr, 19) |
+                    DWA_SHR64(sptr, 20) |
+                    DWA_SHR64(sptr, 21) |
+                    DWA_SHR64(sptr, 22) |
+                    DWA_SHR64(sptr, 23) |
+                    DWA_SHR64(sptr, 24) |
+                    DWA_SHR64(sptr, 25);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 25) | (*(sptr + 1) >> 7)) |
+                    ((*(sptr) << 24) | (*(sptr + 1) >> 8)) |
+                    ((*(sptr) << 23) | (*(sptr + 1) >> 9)) |
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10)) |
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11)) |
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) |
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) |
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) |
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12)) |
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11)) |
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10)) |
+                    ((*(sptr) >> 23) | (*(sptr - 1) << 9)) |
+                    ((*(sptr) >> 24) | (*(sptr - 1) << 8)) |
+                    ((*(sptr) >> 25) | (*(sptr - 1) << 7));
+        }
+    }
+}
+
+static void
+ferode64_1_24(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 25) &
+                    DWA_SHR64(sptr, 24) &
+                    DWA_SHR64(sptr, 23) &
+                    DWA_SHR64(sptr, 22) &
+                    DWA_SHR64(sptr, 21) &
+                    DWA_SHR64(sptr, 20) &
+                    DWA_SHR64(sptr, 19) &
+                    DWA_SHR64(sptr, 18) &
+                    DWA_SHR64(sptr, 17) &
+                    DWA_SHR64(sptr, 16) &
+                    DWA_SHR64(sptr, 15) &
+                    DWA_SHR64(sptr, 14) &
+                    DWA_SHR64(sptr, 13) &
+                    DWA_SHR64(sptr, 12) &
+                    DWA_SHR64(sptr, 11) &
+                    DWA_SHR64(sptr, 10) &
+                    DWA_SHR64(sptr, 9) &
+                    DWA_SHR64(sptr, 8) &
+                    DWA_SHR64(sptr, 7) &
+                    DWA_SHR64(sptr, 6) &
+                    DWA_SHR64(sptr, 5) &
+                    DWA_SHR64(sptr, 4) &
+                    DWA_SHR64(sptr, 3) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHL64(sptr, 3) &
+                    DWA_SHL64(sptr, 4) &
+                    DWA_SHL64(sptr, 5) &
+                    DWA_SHL64(sptr, 6) &
+                    DWA_SHL64(sptr, 7) &
+                    DWA_SHL64(sptr, 8) &
+                    DWA_SHL64(sptr, 9) &
+                    DWA_SHL64(sptr, 10) &
+                    DWA_SHL64(sptr, 11) &
+                    DWA_SHL64(sptr, 12) &
+                    DWA_SHL64(sptr, 13) &
+                    DWA_SHL64(sptr, 14) &
+                    DWA_SHL64(sptr, 15) &
+                    DWA_SHL64(sptr, 16) &
+                    DWA_SHL64(sptr, 17) &
+                    DWA_SHL64(sptr, 18) &
+                    DWA_SHL64(sptr, 19) &
+                    DWA_SHL64(sptr, 20) &
+                    DWA_SHL64(sptr, 21) &
+                    DWA_SHL64(sptr, 22) &
+                    DWA_SHL64(sptr, 23) &
+                    DWA_SHL64(sptr, 24) &
+                    DWA_SHL64(sptr, 25);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 25) | (*(sptr - 1) << 7)) &
+                    ((*(sptr) >> 24) | (*(sptr - 1) << 8)) &
+                    ((*(sptr) >> 23) | (*(sptr - 1) << 9)) &
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10)) &
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11)) &
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) &
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) &
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) &
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12)) &
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11)) &
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10)) &
+                    ((*(sptr) << 23) | (*(sptr + 1) >> 9)) &
+                    ((*(sptr) << 24) | (*(sptr + 1) >> 8)) &
+                    ((*(sptr) << 25) | (*(sptr + 1) >> 7));
+        }
+    }
+}
+
+static void
+fdilate64_1_25(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls)) |
+                    (*sptr);
+        }
+    }
+}
+
+static void
+ferode64_1_25(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls)) &
+                    (*sptr);
+        }
+    }
+}
+
+static void
+fdilate64_1_26(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls));
+        }
+    }
+}
+
+static void
+ferode64_1_26(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls));
+        }
+    }
+}
+
+static void
+fdilate64_1_27(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls));
+        }
+    }
+}
+
+static void
+ferode64_1_27(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls));
+        }
+    }
+}
+
+static void
+fdilate64_1_28(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2));
+        }
+    }
+}
+
+static void
+ferode64_1_28(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2));
+        }
+    }
+}
+
+static void
+fdilate64_1_29(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2));
+        }
+    }
+}
+
+static void
+ferode64_1_29(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2));
+        }
+    }
+}
+
+static void
+fdilate64_1_30(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3));
+        }
+    }
+}
+
+static void
+ferode64_1_30(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3));
+        }
+    }
+}
+
+static void
+fdilate64_1_31(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3));
+        }
+    }
+}
+
+static void
+ferode64_1_31(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3));
+        }
+    }
+}
+
+static void
+fdilate64_1_32(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4));
+        }
+    }
+}
+
+static void
+ferode64_1_32(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4));
+        }
+    }
+}
+
+static void
+fdilate64_1_33(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4));
+        }
+    }
+}
+
+static void
+ferode64_1_33(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4));
+        }
+    }
+}
+
+static void
+fdilate64_1_34(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5));
+        }
+    }
+}
+
+static void
+ferode64_1_34(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5));
+        }
+    }
+}
+
+static void
+fdilate64_1_35(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5));
+        }
+    }
+}
+
+static void
+ferode64_1_35(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5));
+        }
+    }
+}
+
+static void
+fdilate64_1_36(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6));
+        }
+    }
+}
+
+static void
+ferode64_1_36(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6));
+        }
+    }
+}
+
+static void
+fdilate64_1_37(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6));
+        }
+    }
+}
+
+static void
+ferode64_1_37(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6));
+        }
+    }
+}
+
+static void
+fdilate64_1_38(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls7);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7));
+        }
+    }
+}
+
+static void
+ferode64_1_38(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls7);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7));
+        }
+    }
+}
+
+static void
+fdilate64_1_39(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls10) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls7) |
+                    DWA_WORD64(sptr - wpls8) |
+                    DWA_WORD64(sptr - wpls9);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9));
+        }
+    }
+}
+
+static void
+ferode64_1_39(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls10) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls7) &
+                    DWA_WORD64(sptr + wpls8) &
+                    DWA_WORD64(sptr + wpls9);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9));
+        }
+    }
+}
+
+static void
+fdilate64_1_40(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls10) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls7) |
+                    DWA_WORD64(sptr - wpls8) |
+                    DWA_WORD64(sptr - wpls9) |
+                    DWA_WORD64(sptr - wpls10);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10));
+        }
+    }
+}
+
+static void
+ferode64_1_40(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls10) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls7) &
+                    DWA_WORD64(sptr + wpls8) &
+                    DWA_WORD64(sptr + wpls9) &
+                    DWA_WORD64(sptr + wpls10);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10));
+        }
+    }
+}
+
+static void
+fdilate64_1_41(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls12) |
+                    DWA_WORD64(sptr + wpls11) |
+                    DWA_WORD64(sptr + wpls10) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls7) |
+                    DWA_WORD64(sptr - wpls8) |
+                    DWA_WORD64(sptr - wpls9) |
+                    DWA_WORD64(sptr - wpls10) |
+                    DWA_WORD64(sptr - wpls11) |
+                    DWA_WORD64(sptr - wpls12);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12));
+        }
+    }
+}
+
+static void
+ferode64_1_41(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls12) &
+                    DWA_WORD64(sptr - wpls11) &
+                    DWA_WORD64(sptr - wpls10) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls7) &
+                    DWA_WORD64(sptr + wpls8) &
+                    DWA_WORD64(sptr + wpls9) &
+                    DWA_WORD64(sptr + wpls10) &
+                    DWA_WORD64(sptr + wpls11) &
+                    DWA_WORD64(sptr + wpls12);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12));
+        }
+    }
+}
+
+static void
+fdilate64_1_42(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls15) |
+                    DWA_WORD64(sptr + wpls14) |
+                    DWA_WORD64(sptr + wpls13) |
+                    DWA_WORD64(sptr + wpls12) |
+                    DWA_WORD64(sptr + wpls11) |
+                    DWA_WORD64(sptr + wpls10) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls7) |
+                    DWA_WORD64(sptr - wpls8) |
+                    DWA_WORD64(sptr - wpls9) |
+                    DWA_WORD64(sptr - wpls10) |
+                    DWA_WORD64(sptr - wpls11) |
+                    DWA_WORD64(sptr - wpls12) |
+                    DWA_WORD64(sptr - wpls13) |
+                    DWA_WORD64(sptr - wpls14);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14));
+        }
+    }
+}
+
+static void
+ferode64_1_42(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls15) &
+                    DWA_WORD64(sptr - wpls14) &
+                    DWA_WORD64(sptr - wpls13) &
+                    DWA_WORD64(sptr - wpls12) &
+                    DWA_WORD64(sptr - wpls11) &
+                    DWA_WORD64(sptr - wpls10) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls7) &
+                    DWA_WORD64(sptr + wpls8) &
+                    DWA_WORD64(sptr + wpls9) &
+                    DWA_WORD64(sptr + wpls10) &
+                    DWA_WORD64(sptr + wpls11) &
+                    DWA_WORD64(sptr + wpls12) &
+                    DWA_WORD64(sptr + wpls13) &
+                    DWA_WORD64(sptr + wpls14);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14));
+        }
+    }
+}
+
+static void
+fdilate64_1_43(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls15) |
+                    DWA_WORD64(sptr + wpls14) |
+                    DWA_WORD64(sptr + wpls13) |
+                    DWA_WORD64(sptr + wpls12) |
+                    DWA_WORD64(sptr + wpls11) |
+                    DWA_WORD64(sptr + wpls10) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls7) |
+                    DWA_WORD64(sptr - wpls8) |
+                    DWA_WORD64(sptr - wpls9) |
+                    DWA_WORD64(sptr - wpls10) |
+                    DWA_WORD64(sptr - wpls11) |
+                    DWA_WORD64(sptr - wpls12) |
+                    DWA_WORD64(sptr - wpls13) |
+                    DWA_WORD64(sptr - wpls14) |
+                    DWA_WORD64(sptr - wpls15);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15));
+        }
+    }
+}
+
+static void
+ferode64_1_43(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls15) &
+                    DWA_WORD64(sptr - wpls14) &
+                    DWA_WORD64(sptr - wpls13) &
+                    DWA_WORD64(sptr - wpls12) &
+                    DWA_WORD64(sptr - wpls11) &
+                    DWA_WORD64(sptr - wpls10) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls7) &
+                    DWA_WORD64(sptr + wpls8) &
+                    DWA_WORD64(sptr + wpls9) &
+                    DWA_WORD64(sptr + wpls10) &
+                    DWA_WORD64(sptr + wpls11) &
+                    DWA_WORD64(sptr + wpls12) &
+                    DWA_WORD64(sptr + wpls13) &
+                    DWA_WORD64(sptr + wpls14) &
+                    DWA_WORD64(sptr + wpls15);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15));
+        }
+    }
+}
+
+static void
+fdilate64_1_44(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls17) |
+                    DWA_WORD64(sptr + wpls16) |
+                    DWA_WORD64(sptr + wpls15) |
+                    DWA_WORD64(sptr + wpls14) |
+                    DWA_WORD64(sptr + wpls13) |
+                    DWA_WORD64(sptr + wpls12) |
+                    DWA_WORD64(sptr + wpls11) |
+                    DWA_WORD64(sptr + wpls10) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls7) |
+                    DWA_WORD64(sptr - wpls8) |
+                    DWA_WORD64(sptr - wpls9) |
+                    DWA_WORD64(sptr - wpls10) |
+                    DWA_WORD64(sptr - wpls11) |
+                    DWA_WORD64(sptr - wpls12) |
+                    DWA_WORD64(sptr - wpls13) |
+                    DWA_WORD64(sptr - wpls14) |
+                    DWA_WORD64(sptr - wpls15) |
+                    DWA_WORD64(sptr - wpls16) |
+                    DWA_WORD64(sptr - wpls17);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls17)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls17));
+        }
+    }
+}
+
+static void
+ferode64_1_44(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls17) &
+                    DWA_WORD64(sptr - wpls16) &
+                    DWA_WORD64(sptr - wpls15) &
+                    DWA_WORD64(sptr - wpls14) &
+                    DWA_WORD64(sptr - wpls13) &
+                    DWA_WORD64(sptr - wpls12) &
+                    DWA_WORD64(sptr - wpls11) &
+                    DWA_WORD64(sptr - wpls10) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls7) &
+                    DWA_WORD64(sptr + wpls8) &
+                    DWA_WORD64(sptr + wpls9) &
+                    DWA_WORD64(sptr + wpls10) &
+                    DWA_WORD64(sptr + wpls11) &
+                    DWA_WORD64(sptr + wpls12) &
+                    DWA_WORD64(sptr + wpls13) &
+                    DWA_WORD64(sptr + wpls14) &
+                    DWA_WORD64(sptr + wpls15) &
+                    DWA_WORD64(sptr + wpls16) &
+                    DWA_WORD64(sptr + wpls17);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls17)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls17));
+        }
+    }
+}
+
+static void
+fdilate64_1_45(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls20) |
+                    DWA_WORD64(sptr + wpls19) |
+                    DWA_WORD64(sptr + wpls18) |
+                    DWA_WORD64(sptr + wpls17) |
+                    DWA_WORD64(sptr + wpls16) |
+                    DWA_WORD64(sptr + wpls15) |
+                    DWA_WORD64(sptr + wpls14) |
+                    DWA_WORD64(sptr + wpls13) |
+                    DWA_WORD64(sptr + wpls12) |
+                    DWA_WORD64(sptr + wpls11) |
+                    DWA_WORD64(sptr + wpls10) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls7) |
+                    DWA_WORD64(sptr - wpls8) |
+                    DWA_WORD64(sptr - wpls9) |
+                    DWA_WORD64(sptr - wpls10) |
+                    DWA_WORD64(sptr - wpls11) |
+                    DWA_WORD64(sptr - wpls12) |
+                    DWA_WORD64(sptr - wpls13) |
+                    DWA_WORD64(sptr - wpls14) |
+                    DWA_WORD64(sptr - wpls15) |
+                    DWA_WORD64(sptr - wpls16) |
+                    DWA_WORD64(sptr - wpls17) |
+                    DWA_WORD64(sptr - wpls18) |
+                    DWA_WORD64(sptr - wpls19);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls20)) |
+                    (*(sptr + wpls19)) |
+                    (*(sptr + wpls18)) |
+                    (*(sptr + wpls17)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls17)) |
+                    (*(sptr - wpls18)) |
+                    (*(sptr - wpls19));
+        }
+    }
+}
+
+static void
+ferode64_1_45(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls20) &
+                    DWA_WORD64(sptr - wpls19) &
+                    DWA_WORD64(sptr - wpls18) &
+                    DWA_WORD64(sptr - wpls17) &
+                    DWA_WORD64(sptr - wpls16) &
+                    DWA_WORD64(sptr - wpls15) &
+                    DWA_WORD64(sptr - wpls14) &
+                    DWA_WORD64(sptr - wpls13) &
+                    DWA_WORD64(sptr - wpls12) &
+                    DWA_WORD64(sptr - wpls11) &
+                    DWA_WORD64(sptr - wpls10) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls7) &
+                    DWA_WORD64(sptr + wpls8) &
+                    DWA_WORD64(sptr + wpls9) &
+                    DWA_WORD64(sptr + wpls10) &
+                    DWA_WORD64(sptr + wpls11) &
+                    DWA_WORD64(sptr + wpls12) &
+                    DWA_WORD64(sptr + wpls13) &
+                    DWA_WORD64(sptr + wpls14) &
+                    DWA_WORD64(sptr + wpls15) &
+                    DWA_WORD64(sptr + wpls16) &
+                    DWA_WORD64(sptr + wpls17) &
+                    DWA_WORD64(sptr + wpls18) &
+                    DWA_WORD64(sptr + wpls19);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls20)) &
+                    (*(sptr - wpls19)) &
+                    (*(sptr - wpls18)) &
+                    (*(sptr - wpls17)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls17)) &
+                    (*(sptr + wpls18)) &
+                    (*(sptr + wpls19));
+        }
+    }
+}
+
+static void
+fdilate64_1_46(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls20) |
+                    DWA_WORD64(sptr + wpls19) |
+                    DWA_WORD64(sptr + wpls18) |
+                    DWA_WORD64(sptr + wpls17) |
+                    DWA_WORD64(sptr + wpls16) |
+                    DWA_WORD64(sptr + wpls15) |
+                    DWA_WORD64(sptr + wpls14) |
+                    DWA_WORD64(sptr + wpls13) |
+                    DWA_WORD64(sptr + wpls12) |
+                    DWA_WORD64(sptr + wpls11) |
+                    DWA_WORD64(sptr + wpls10) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls7) |
+                    DWA_WORD64(sptr - wpls8) |
+                    DWA_WORD64(sptr - wpls9) |
+                    DWA_WORD64(sptr - wpls10) |
+                    DWA_WORD64(sptr - wpls11) |
+                    DWA_WORD64(sptr - wpls12) |
+                    DWA_WORD64(sptr - wpls13) |
+                    DWA_WORD64(sptr - wpls14) |
+                    DWA_WORD64(sptr - wpls15) |
+                    DWA_WORD64(sptr - wpls16) |
+                    DWA_WORD64(sptr - wpls17) |
+                    DWA_WORD64(sptr - wpls18) |
+                    DWA_WORD64(sptr - wpls19) |
+                    DWA_WORD64(sptr - wpls20);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls20)) |
+                    (*(sptr + wpls19)) |
+                    (*(sptr + wpls18)) |
+                    (*(sptr + wpls17)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls17)) |
+                    (*(sptr - wpls18)) |
+                    (*(sptr - wpls19)) |
+                    (*(sptr - wpls20));
+        }
+    }
+}
+
+static void
+ferode64_1_46(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls20) &
+                    DWA_WORD64(sptr - wpls19) &
+                    DWA_WORD64(sptr - wpls18) &
+                    DWA_WORD64(sptr - wpls17) &
+                    DWA_WORD64(sptr - wpls16) &
+                    DWA_WORD64(sptr - wpls15) &
+                    DWA_WORD64(sptr - wpls14) &
+                    DWA_WORD64(sptr - wpls13) &
+                    DWA_WORD64(sptr - wpls12) &
+                    DWA_WORD64(sptr - wpls11) &
+                    DWA_WORD64(sptr - wpls10) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls7) &
+                    DWA_WORD64(sptr + wpls8) &
+                    DWA_WORD64(sptr + wpls9) &
+                    DWA_WORD64(sptr + wpls10) &
+                    DWA_WORD64(sptr + wpls11) &
+                    DWA_WORD64(sptr + wpls12) &
+                    DWA_WORD64(sptr + wpls13) &
+                    DWA_WORD64(sptr + wpls14) &
+                    DWA_WORD64(sptr + wpls15) &
+                    DWA_WORD64(sptr + wpls16) &
+                    DWA_WORD64(sptr + wpls17) &
+                    DWA_WORD64(sptr + wpls18) &
+                    DWA_WORD64(sptr + wpls19) &
+                    DWA_WORD64(sptr + wpls20);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls20)) &
+                    (*(sptr - wpls19)) &
+                    (*(sptr - wpls18)) &
+                    (*(sptr - wpls17)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls17)) &
+                    (*(sptr + wpls18)) &
+                    (*(sptr + wpls19)) &
+                    (*(sptr + wpls20));
+        }
+    }
+}
+
+static void
+fdilate64_1_47(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+l_int32             wpls21, wpls22;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    wpls21 = 21 * wpls;
+    wpls22 = 22 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls22) |
+                    DWA_WORD64(sptr + wpls21) |
+                    DWA_WORD64(sptr + wpls20) |
+                    DWA_WORD64(sptr + wpls19) |
+                    DWA_WORD64(sptr + wpls18) |
+                    DWA_WORD64(sptr + wpls17) |
+                    DWA_WORD64(sptr + wpls16) |
+                    DWA_WORD64(sptr + wpls15) |
+                    DWA_WORD64(sptr + wpls14) |
+                    DWA_WORD64(sptr + wpls13) |
+                    DWA_WORD64(sptr + wpls12) |
+                    DWA_WORD64(sptr + wpls11) |
+                    DWA_WORD64(sptr + wpls10) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls7) |
+                    DWA_WORD64(sptr - wpls8) |
+                    DWA_WORD64(sptr - wpls9) |
+                    DWA_WORD64(sptr - wpls10) |
+                    DWA_WORD64(sptr - wpls11) |
+                    DWA_WORD64(sptr - wpls12) |
+                    DWA_WORD64(sptr - wpls13) |
+                    DWA_WORD64(sptr - wpls14) |
+                    DWA_WORD64(sptr - wpls15) |
+                    DWA_WORD64(sptr - wpls16) |
+                    DWA_WORD64(sptr - wpls17) |
+                    DWA_WORD64(sptr - wpls18) |
+                    DWA_WORD64(sptr - wpls19) |
+                    DWA_WORD64(sptr - wpls20) |
+                    DWA_WORD64(sptr - wpls21) |
+                    DWA_WORD64(sptr - wpls22);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls22)) |
+                    (*(sptr + wpls21)) |
+                    (*(sptr + wpls20)) |
+                    (*(sptr + wpls19)) |
+                    (*(sptr + wpls18)) |
+                    (*(sptr + wpls17)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls17)) |
+                    (*(sptr - wpls18)) |
+                    (*(sptr - wpls19)) |
+                    (*(sptr - wpls20)) |
+                    (*(sptr - wpls21)) |
+                    (*(sptr - wpls22));
+        }
+    }
+}
+
+static void
+ferode64_1_47(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+l_int32             wpls21, wpls22;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    wpls21 = 21 * wpls;
+    wpls22 = 22 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls22) &
+                    DWA_WORD64(sptr - wpls21) &
+                    DWA_WORD64(sptr - wpls20) &
+                    DWA_WORD64(sptr - wpls19) &
+                    DWA_WORD64(sptr - wpls18) &
+                    DWA_WORD64(sptr - wpls17) &
+                    DWA_WORD64(sptr - wpls16) &
+                    DWA_WORD64(sptr - wpls15) &
+                    DWA_WORD64(sptr - wpls14) &
+                    DWA_WORD64(sptr - wpls13) &
+                    DWA_WORD64(sptr - wpls12) &
+                    DWA_WORD64(sptr - wpls11) &
+                    DWA_WORD64(sptr - wpls10) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls7) &
+                    DWA_WORD64(sptr + wpls8) &
+                    DWA_WORD64(sptr + wpls9) &
+                    DWA_WORD64(sptr + wpls10) &
+                    DWA_WORD64(sptr + wpls11) &
+                    DWA_WORD64(sptr + wpls12) &
+                    DWA_WORD64(sptr + wpls13) &
+                    DWA_WORD64(sptr + wpls14) &
+                    DWA_WORD64(sptr + wpls15) &
+                    DWA_WORD64(sptr + wpls16) &
+                    DWA_WORD64(sptr + wpls17) &
+                    DWA_WORD64(sptr + wpls18) &
+                    DWA_WORD64(sptr + wpls19) &
+                    DWA_WORD64(sptr + wpls20) &
+                    DWA_WORD64(sptr + wpls21) &
+                    DWA_WORD64(sptr + wpls22);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls22)) &
+                    (*(sptr - wpls21)) &
+                    (*(sptr - wpls20)) &
+                    (*(sptr - wpls19)) &
+                    (*(sptr - wpls18)) &
+                    (*(sptr - wpls17)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls17)) &
+                    (*(sptr + wpls18)) &
+                    (*(sptr + wpls19)) &
+                    (*(sptr + wpls20)) &
+                    (*(sptr + wpls21)) &
+                    (*(sptr + wpls22));
+        }
+    }
+}
+
+static void
+fdilate64_1_48(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+l_int32             wpls21, wpls22, wpls23, wpls24;
+l_int32             wpls25;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    wpls21 = 21 * wpls;
+    wpls22 = 22 * wpls;
+    wpls23 = 23 * wpls;
+    wpls24 = 24 * wpls;
+    wpls25 = 25 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls25) |
+                    DWA_WORD64(sptr + wpls24) |
+                    DWA_WORD64(sptr + wpls23) |
+                    DWA_WORD64(sptr + wpls22) |
+                    DWA_WORD64(sptr + wpls21) |
+                    DWA_WORD64(sptr + wpls20) |
+                    DWA_WORD64(sptr + wpls19) |
+                    DWA_WORD64(sptr + wpls18) |
+                    DWA_WORD64(sptr + wpls17) |
+                    DWA_WORD64(sptr + wpls16) |
+                    DWA_WORD64(sptr + wpls15) |
+                    DWA_WORD64(sptr + wpls14) |
+                    DWA_WORD64(sptr + wpls13) |
+                    DWA_WORD64(sptr + wpls12) |
+                    DWA_WORD64(sptr + wpls11) |
+                    DWA_WORD64(sptr + wpls10) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls7) |
+                    DWA_WORD64(sptr - wpls8) |
+                    DWA_WORD64(sptr - wpls9) |
+                    DWA_WORD64(sptr - wpls10) |
+                    DWA_WORD64(sptr - wpls11) |
+                    DWA_WORD64(sptr - wpls12) |
+                    DWA_WORD64(sptr - wpls13) |
+                    DWA_WORD64(sptr - wpls14) |
+                    DWA_WORD64(sptr - wpls15) |
+                    DWA_WORD64(sptr - wpls16) |
+                    DWA_WORD64(sptr - wpls17) |
+                    DWA_WORD64(sptr - wpls18) |
+                    DWA_WORD64(sptr - wpls19) |
+                    DWA_WORD64(sptr - wpls20) |
+                    DWA_WORD64(sptr - wpls21) |
+                    DWA_WORD64(sptr - wpls22) |
+                    DWA_WORD64(sptr - wpls23) |
+                    DWA_WORD64(sptr - wpls24);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls25)) |
+                    (*(sptr + wpls24)) |
+                    (*(sptr + wpls23)) |
+                    (*(sptr + wpls22)) |
+                    (*(sptr + wpls21)) |
+                    (*(sptr + wpls20)) |
+                    (*(sptr + wpls19)) |
+                    (*(sptr + wpls18)) |
+                    (*(sptr + wpls17)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls17)) |
+                    (*(sptr - wpls18)) |
+                    (*(sptr - wpls19)) |
+                    (*(sptr - wpls20)) |
+                    (*(sptr - wpls21)) |
+                    (*(sptr - wpls22)) |
+                    (*(sptr - wpls23)) |
+                    (*(sptr - wpls24));
+        }
+    }
+}
+
+static void
+ferode64_1_48(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+l_int32             wpls21, wpls22, wpls23, wpls24;
+l_int32             wpls25;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    wpls21 = 21 * wpls;
+    wpls22 = 22 * wpls;
+    wpls23 = 23 * wpls;
+    wpls24 = 24 * wpls;
+    wpls25 = 25 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls25) &
+                    DWA_WORD64(sptr - wpls24) &
+                    DWA_WORD64(sptr - wpls23) &
+                    DWA_WORD64(sptr - wpls22) &
+                    DWA_WORD64(sptr - wpls21) &
+                    DWA_WORD64(sptr - wpls20) &
+                    DWA_WORD64(sptr - wpls19) &
+                    DWA_WORD64(sptr - wpls18) &
+                    DWA_WORD64(sptr - wpls17) &
+                    DWA_WORD64(sptr - wpls16) &
+                    DWA_WORD64(sptr - wpls15) &
+                    DWA_WORD64(sptr - wpls14) &
+                    DWA_WORD64(sptr - wpls13) &
+                    DWA_WORD64(sptr - wpls12) &
+                    DWA_WORD64(sptr - wpls11) &
+                    DWA_WORD64(sptr - wpls10) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls7) &
+                    DWA_WORD64(sptr + wpls8) &
+                    DWA_WORD64(sptr + wpls9) &
+                    DWA_WORD64(sptr + wpls10) &
+                    DWA_WORD64(sptr + wpls11) &
+                    DWA_WORD64(sptr + wpls12) &
+                    DWA_WORD64(sptr + wpls13) &
+                    DWA_WORD64(sptr + wpls14) &
+                    DWA_WORD64(sptr + wpls15) &
+                    DWA_WORD64(sptr + wpls16) &
+                    DWA_WORD64(sptr + wpls17) &
+                    DWA_WORD64(sptr + wpls18) &
+                    DWA_WORD64(sptr + wpls19) &
+                    DWA_WORD64(sptr + wpls20) &
+                    DWA_WORD64(sptr + wpls21) &
+                    DWA_WORD64(sptr + wpls22) &
+                    DWA_WORD64(sptr + wpls23) &
+                    DWA_WORD64(sptr + wpls24);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls25)) &
+                    (*(sptr - wpls24)) &
+                    (*(sptr - wpls23)) &
+                    (*(sptr - wpls22)) &
+                    (*(sptr - wpls21)) &
+                    (*(sptr - wpls20)) &
+                    (*(sptr - wpls19)) &
+                    (*(sptr - wpls18)) &
+                    (*(sptr - wpls17)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls17)) &
+                    (*(sptr + wpls18)) &
+                    (*(sptr + wpls19)) &
+                    (*(sptr + wpls20)) &
+                    (*(sptr + wpls21)) &
+                    (*(sptr + wpls22)) &
+                    (*(sptr + wpls23)) &
+                    (*(sptr + wpls24));
+        }
+    }
+}
+
+static void
+fdilate64_1_49(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+l_int32             wpls21, wpls22, wpls23, wpls24;
+l_int32             wpls25;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    wpls21 = 21 * wpls;
+    wpls22 = 22 * wpls;
+    wpls23 = 23 * wpls;
+    wpls24 = 24 * wpls;
+    wpls25 = 25 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr + wpls25) |
+                    DWA_WORD64(sptr + wpls24) |
+                    DWA_WORD64(sptr + wpls23) |
+                    DWA_WORD64(sptr + wpls22) |
+                    DWA_WORD64(sptr + wpls21) |
+                    DWA_WORD64(sptr + wpls20) |
+                    DWA_WORD64(sptr + wpls19) |
+                    DWA_WORD64(sptr + wpls18) |
+                    DWA_WORD64(sptr + wpls17) |
+                    DWA_WORD64(sptr + wpls16) |
+                    DWA_WORD64(sptr + wpls15) |
+                    DWA_WORD64(sptr + wpls14) |
+                    DWA_WORD64(sptr + wpls13) |
+                    DWA_WORD64(sptr + wpls12) |
+                    DWA_WORD64(sptr + wpls11) |
+                    DWA_WORD64(sptr + wpls10) |
+                    DWA_WORD64(sptr + wpls9) |
+                    DWA_WORD64(sptr + wpls8) |
+                    DWA_WORD64(sptr + wpls7) |
+                    DWA_WORD64(sptr + wpls6) |
+                    DWA_WORD64(sptr + wpls5) |
+                    DWA_WORD64(sptr + wpls4) |
+                    DWA_WORD64(sptr + wpls3) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_WORD64(sptr) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_WORD64(sptr - wpls3) |
+                    DWA_WORD64(sptr - wpls4) |
+                    DWA_WORD64(sptr - wpls5) |
+                    DWA_WORD64(sptr - wpls6) |
+                    DWA_WORD64(sptr - wpls7) |
+                    DWA_WORD64(sptr - wpls8) |
+                    DWA_WORD64(sptr - wpls9) |
+                    DWA_WORD64(sptr - wpls10) |
+                    DWA_WORD64(sptr - wpls11) |
+                    DWA_WORD64(sptr - wpls12) |
+                    DWA_WORD64(sptr - wpls13) |
+                    DWA_WORD64(sptr - wpls14) |
+                    DWA_WORD64(sptr - wpls15) |
+                    DWA_WORD64(sptr - wpls16) |
+                    DWA_WORD64(sptr - wpls17) |
+                    DWA_WORD64(sptr - wpls18) |
+                    DWA_WORD64(sptr - wpls19) |
+                    DWA_WORD64(sptr - wpls20) |
+                    DWA_WORD64(sptr - wpls21) |
+                    DWA_WORD64(sptr - wpls22) |
+                    DWA_WORD64(sptr - wpls23) |
+                    DWA_WORD64(sptr - wpls24) |
+                    DWA_WORD64(sptr - wpls25);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls25)) |
+                    (*(sptr + wpls24)) |
+                    (*(sptr + wpls23)) |
+                    (*(sptr + wpls22)) |
+                    (*(sptr + wpls21)) |
+                    (*(sptr + wpls20)) |
+                    (*(sptr + wpls19)) |
+                    (*(sptr + wpls18)) |
+                    (*(sptr + wpls17)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls17)) |
+                    (*(sptr - wpls18)) |
+                    (*(sptr - wpls19)) |
+                    (*(sptr - wpls20)) |
+                    (*(sptr - wpls21)) |
+                    (*(sptr - wpls22)) |
+                    (*(sptr - wpls23)) |
+                    (*(sptr - wpls24)) |
+                    (*(sptr - wpls25));
+        }
+    }
+}
+
+static void
+ferode64_1_49(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+l_int32             wpls21, wpls22, wpls23, wpls24;
+l_int32             wpls25;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    wpls21 = 21 * wpls;
+    wpls22 = 22 * wpls;
+    wpls23 = 23 * wpls;
+    wpls24 = 24 * wpls;
+    wpls25 = 25 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr - wpls25) &
+                    DWA_WORD64(sptr - wpls24) &
+                    DWA_WORD64(sptr - wpls23) &
+                    DWA_WORD64(sptr - wpls22) &
+                    DWA_WORD64(sptr - wpls21) &
+                    DWA_WORD64(sptr - wpls20) &
+                    DWA_WORD64(sptr - wpls19) &
+                    DWA_WORD64(sptr - wpls18) &
+                    DWA_WORD64(sptr - wpls17) &
+                    DWA_WORD64(sptr - wpls16) &
+                    DWA_WORD64(sptr - wpls15) &
+                    DWA_WORD64(sptr - wpls14) &
+                    DWA_WORD64(sptr - wpls13) &
+                    DWA_WORD64(sptr - wpls12) &
+                    DWA_WORD64(sptr - wpls11) &
+                    DWA_WORD64(sptr - wpls10) &
+                    DWA_WORD64(sptr - wpls9) &
+                    DWA_WORD64(sptr - wpls8) &
+                    DWA_WORD64(sptr - wpls7) &
+                    DWA_WORD64(sptr - wpls6) &
+                    DWA_WORD64(sptr - wpls5) &
+                    DWA_WORD64(sptr - wpls4) &
+                    DWA_WORD64(sptr - wpls3) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_WORD64(sptr) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_WORD64(sptr + wpls3) &
+                    DWA_WORD64(sptr + wpls4) &
+                    DWA_WORD64(sptr + wpls5) &
+                    DWA_WORD64(sptr + wpls6) &
+                    DWA_WORD64(sptr + wpls7) &
+                    DWA_WORD64(sptr + wpls8) &
+                    DWA_WORD64(sptr + wpls9) &
+                    DWA_WORD64(sptr + wpls10) &
+                    DWA_WORD64(sptr + wpls11) &
+                    DWA_WORD64(sptr + wpls12) &
+                    DWA_WORD64(sptr + wpls13) &
+                    DWA_WORD64(sptr + wpls14) &
+                    DWA_WORD64(sptr + wpls15) &
+                    DWA_WORD64(sptr + wpls16) &
+                    DWA_WORD64(sptr + wpls17) &
+                    DWA_WORD64(sptr + wpls18) &
+                    DWA_WORD64(sptr + wpls19) &
+                    DWA_WORD64(sptr + wpls20) &
+                    DWA_WORD64(sptr + wpls21) &
+                    DWA_WORD64(sptr + wpls22) &
+                    DWA_WORD64(sptr + wpls23) &
+                    DWA_WORD64(sptr + wpls24) &
+                    DWA_WORD64(sptr + wpls25);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls25)) &
+                    (*(sptr - wpls24)) &
+                    (*(sptr - wpls23)) &
+                    (*(sptr - wpls22)) &
+                    (*(sptr - wpls21)) &
+                    (*(sptr - wpls20)) &
+                    (*(sptr - wpls19)) &
+                    (*(sptr - wpls18)) &
+                    (*(sptr - wpls17)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls17)) &
+                    (*(sptr + wpls18)) &
+                    (*(sptr + wpls19)) &
+                    (*(sptr + wpls20)) &
+                    (*(sptr + wpls21)) &
+                    (*(sptr + wpls22)) &
+                    (*(sptr + wpls23)) &
+                    (*(sptr + wpls24)) &
+                    (*(sptr + wpls25));
+        }
+    }
+}
+
+static void
+fdilate64_1_50(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr + wpls, 1) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) |
+                    (*(sptr + wpls)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr);
+        }
+    }
+}
+
+static void
+ferode64_1_50(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr - wpls, 1) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) &
+                    (*(sptr - wpls)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr);
+        }
+    }
+}
+
+static void
+fdilate64_1_51(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr + wpls, 1) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_SHR64(sptr + wpls, 1) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHL64(sptr - wpls, 1) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_SHR64(sptr - wpls, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) |
+                    (*(sptr + wpls)) |
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) |
+                    (*(sptr - wpls)) |
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31));
+        }
+    }
+}
+
+static void
+ferode64_1_51(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr - wpls, 1) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_SHL64(sptr - wpls, 1) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHR64(sptr + wpls, 1) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_SHL64(sptr + wpls, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) &
+                    (*(sptr - wpls)) &
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) &
+                    (*(sptr + wpls)) &
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+static void
+fdilate64_1_52(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr + wpls2, 2) |
+                    DWA_SHL64(sptr + wpls2, 1) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_SHR64(sptr + wpls2, 1) |
+                    DWA_SHL64(sptr + wpls, 2) |
+                    DWA_SHL64(sptr + wpls, 1) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_SHR64(sptr + wpls, 1) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHL64(sptr - wpls, 2) |
+                    DWA_SHL64(sptr - wpls, 1) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_SHR64(sptr - wpls, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr + wpls2) << 2) | (*(sptr + wpls2 + 1) >> 30)) |
+                    ((*(sptr + wpls2) << 1) | (*(sptr + wpls2 + 1) >> 31)) |
+                    (*(sptr + wpls2)) |
+                    ((*(sptr + wpls2) >> 1) | (*(sptr + wpls2 - 1) << 31)) |
+                    ((*(sptr + wpls) << 2) | (*(sptr + wpls + 1) >> 30)) |
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) |
+                    (*(sptr + wpls)) |
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr - wpls) << 2) | (*(sptr - wpls + 1) >> 30)) |
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) |
+                    (*(sptr - wpls)) |
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31));
+        }
+    }
+}
+
+static void
+ferode64_1_52(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr - wpls2, 2) &
+                    DWA_SHR64(sptr - wpls2, 1) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_SHL64(sptr - wpls2, 1) &
+                    DWA_SHR64(sptr - wpls, 2) &
+                    DWA_SHR64(sptr - wpls, 1) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_SHL64(sptr - wpls, 1) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHR64(sptr + wpls, 2) &
+                    DWA_SHR64(sptr + wpls, 1) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_SHL64(sptr + wpls, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls2) >> 2) | (*(sptr - wpls2 - 1) << 30)) &
+                    ((*(sptr - wpls2) >> 1) | (*(sptr - wpls2 - 1) << 31)) &
+                    (*(sptr - wpls2)) &
+                    ((*(sptr - wpls2) << 1) | (*(sptr - wpls2 + 1) >> 31)) &
+                    ((*(sptr - wpls) >> 2) | (*(sptr - wpls - 1) << 30)) &
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) &
+                    (*(sptr - wpls)) &
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr + wpls) >> 2) | (*(sptr + wpls - 1) << 30)) &
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) &
+                    (*(sptr + wpls)) &
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+static void
+fdilate64_1_53(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr + wpls2, 2) |
+                    DWA_SHL64(sptr + wpls2, 1) |
+                    DWA_WORD64(sptr + wpls2) |
+                    DWA_SHR64(sptr + wpls2, 1) |
+                    DWA_SHR64(sptr + wpls2, 2) |
+                    DWA_SHL64(sptr + wpls, 2) |
+                    DWA_SHL64(sptr + wpls, 1) |
+                    DWA_WORD64(sptr + wpls) |
+                    DWA_SHR64(sptr + wpls, 1) |
+                    DWA_SHR64(sptr + wpls, 2) |
+                    DWA_SHL64(sptr, 2) |
+                    DWA_SHL64(sptr, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr, 1) |
+                    DWA_SHR64(sptr, 2) |
+                    DWA_SHL64(sptr - wpls, 2) |
+                    DWA_SHL64(sptr - wpls, 1) |
+                    DWA_WORD64(sptr - wpls) |
+                    DWA_SHR64(sptr - wpls, 1) |
+                    DWA_SHR64(sptr - wpls, 2) |
+                    DWA_SHL64(sptr - wpls2, 2) |
+                    DWA_SHL64(sptr - wpls2, 1) |
+                    DWA_WORD64(sptr - wpls2) |
+                    DWA_SHR64(sptr - wpls2, 1) |
+                    DWA_SHR64(sptr - wpls2, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr + wpls2) << 2) | (*(sptr + wpls2 + 1) >> 30)) |
+                    ((*(sptr + wpls2) << 1) | (*(sptr + wpls2 + 1) >> 31)) |
+                    (*(sptr + wpls2)) |
+                    ((*(sptr + wpls2) >> 1) | (*(sptr + wpls2 - 1) << 31)) |
+                    ((*(sptr + wpls2) >> 2) | (*(sptr + wpls2 - 1) << 30)) |
+                    ((*(sptr + wpls) << 2) | (*(sptr + wpls + 1) >> 30)) |
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) |
+                    (*(sptr + wpls)) |
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) |
+                    ((*(sptr + wpls) >> 2) | (*(sptr + wpls - 1) << 30)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr - wpls) << 2) | (*(sptr - wpls + 1) >> 30)) |
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) |
+                    (*(sptr - wpls)) |
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) |
+                    ((*(sptr - wpls) >> 2) | (*(sptr - wpls - 1) << 30)) |
+                    ((*(sptr - wpls2) << 2) | (*(sptr - wpls2 + 1) >> 30)) |
+                    ((*(sptr - wpls2) << 1) | (*(sptr - wpls2 + 1) >> 31)) |
+                    (*(sptr - wpls2)) |
+                    ((*(sptr - wpls2) >> 1) | (*(sptr - wpls2 - 1) << 31)) |
+                    ((*(sptr - wpls2) >> 2) | (*(sptr - wpls2 - 1) << 30));
+        }
+    }
+}
+
+static void
+ferode64_1_53(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr - wpls2, 2) &
+                    DWA_SHR64(sptr - wpls2, 1) &
+                    DWA_WORD64(sptr - wpls2) &
+                    DWA_SHL64(sptr - wpls2, 1) &
+                    DWA_SHL64(sptr - wpls2, 2) &
+                    DWA_SHR64(sptr - wpls, 2) &
+                    DWA_SHR64(sptr - wpls, 1) &
+                    DWA_WORD64(sptr - wpls) &
+                    DWA_SHL64(sptr - wpls, 1) &
+                    DWA_SHL64(sptr - wpls, 2) &
+                    DWA_SHR64(sptr, 2) &
+                    DWA_SHR64(sptr, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr, 1) &
+                    DWA_SHL64(sptr, 2) &
+                    DWA_SHR64(sptr + wpls, 2) &
+                    DWA_SHR64(sptr + wpls, 1) &
+                    DWA_WORD64(sptr + wpls) &
+                    DWA_SHL64(sptr + wpls, 1) &
+                    DWA_SHL64(sptr + wpls, 2) &
+                    DWA_SHR64(sptr + wpls2, 2) &
+                    DWA_SHR64(sptr + wpls2, 1) &
+                    DWA_WORD64(sptr + wpls2) &
+                    DWA_SHL64(sptr + wpls2, 1) &
+                    DWA_SHL64(sptr + wpls2, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls2) >> 2) | (*(sptr - wpls2 - 1) << 30)) &
+                    ((*(sptr - wpls2) >> 1) | (*(sptr - wpls2 - 1) << 31)) &
+                    (*(sptr - wpls2)) &
+                    ((*(sptr - wpls2) << 1) | (*(sptr - wpls2 + 1) >> 31)) &
+                    ((*(sptr - wpls2) << 2) | (*(sptr - wpls2 + 1) >> 30)) &
+                    ((*(sptr - wpls) >> 2) | (*(sptr - wpls - 1) << 30)) &
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) &
+                    (*(sptr - wpls)) &
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr - wpls) << 2) | (*(sptr - wpls + 1) >> 30)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr + wpls) >> 2) | (*(sptr + wpls - 1) << 30)) &
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) &
+                    (*(sptr + wpls)) &
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) &
+                    ((*(sptr + wpls) << 2) | (*(sptr + wpls + 1) >> 30)) &
+                    ((*(sptr + wpls2) >> 2) | (*(sptr + wpls2 - 1) << 30)) &
+                    ((*(sptr + wpls2) >> 1) | (*(sptr + wpls2 - 1) << 31)) &
+                    (*(sptr + wpls2)) &
+                    ((*(sptr + wpls2) << 1) | (*(sptr + wpls2 + 1) >> 31)) &
+                    ((*(sptr + wpls2) << 2) | (*(sptr + wpls2 + 1) >> 30));
+        }
+    }
+}
+
+static void
+fdilate64_1_54(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr, 1) |
+                    DWA_WORD64(sptr - wpls);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    (*(sptr - wpls));
+        }
+    }
+}
+
+static void
+ferode64_1_54(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr, 1) &
+                    DWA_WORD64(sptr + wpls);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    (*(sptr + wpls));
+        }
+    }
+}
+
+static void
+fdilate64_1_55(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr - wpls, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr) |
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31));
+        }
+    }
+}
+
+static void
+ferode64_1_55(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr + wpls, 1);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr) &
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+static void
+fdilate64_1_56(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr + wpls2, 2) |
+                    DWA_SHR64(sptr + wpls, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHL64(sptr - wpls, 1) |
+                    DWA_SHL64(sptr - wpls2, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr + wpls2) >> 2) | (*(sptr + wpls2 - 1) << 30)) |
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) |
+                    (*sptr) |
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) |
+                    ((*(sptr - wpls2) << 2) | (*(sptr - wpls2 + 1) >> 30));
+        }
+    }
+}
+
+static void
+ferode64_1_56(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr - wpls2, 2) &
+                    DWA_SHL64(sptr - wpls, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHR64(sptr + wpls, 1) &
+                    DWA_SHR64(sptr + wpls2, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls2) << 2) | (*(sptr - wpls2 + 1) >> 30)) &
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) &
+                    (*sptr) &
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) &
+                    ((*(sptr + wpls2) >> 2) | (*(sptr + wpls2 - 1) << 30));
+        }
+    }
+}
+
+static void
+fdilate64_1_57(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHL64(sptr + wpls2, 2) |
+                    DWA_SHL64(sptr + wpls, 1) |
+                    DWA_WORD64(sptr) |
+                    DWA_SHR64(sptr - wpls, 1) |
+                    DWA_SHR64(sptr - wpls2, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr + wpls2) << 2) | (*(sptr + wpls2 + 1) >> 30)) |
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) |
+                    ((*(sptr - wpls2) >> 2) | (*(sptr - wpls2 - 1) << 30));
+        }
+    }
+}
+
+static void
+ferode64_1_57(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+l_uint64   word;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 1; j += 2, sptr += 2, dptr += 2) {
+            word = DWA_SHR64(sptr - wpls2, 2) &
+                    DWA_SHR64(sptr - wpls, 1) &
+                    DWA_WORD64(sptr) &
+                    DWA_SHL64(sptr + wpls, 1) &
+                    DWA_SHL64(sptr + wpls2, 2);
+            *dptr = (l_uint32)(word >> 32);
+            *(dptr + 1) = (l_uint32)word;
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls2) >> 2) | (*(sptr - wpls2 - 1) << 30)) &
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) &
+                    ((*(sptr + wpls2) << 2) | (*(sptr + wpls2 + 1) >> 30));
+        }
+    }
+}
+
+#if L_HAVE_AVX2
+static void L_TARGET_AVX2
+fdilate256_1_0(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 1);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_0(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 1);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_1(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 1);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_1(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 1);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_2(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 2);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_2(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 2);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_3(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 2);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_3(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 2);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_4(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 3);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_4(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 3);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_5(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 3);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_5(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 3);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_6(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 4);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_6(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 4);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_7(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 4);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_7(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 4);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_8(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 5);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_8(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 5);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_9(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 5);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_9(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 5);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_10(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 6);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_10(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 6);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_11(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 6);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_11(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 6);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_12(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 7);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_12(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 7);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_13(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 7);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_13(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 7);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_14(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 10);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_14(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 10);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_15(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 10);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_15(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 10);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_16(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 12);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 12));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_16(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 12);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 12));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_17(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 15);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 14));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_17(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 15);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 14));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_18(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 15);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 15));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_18(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 15);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 15));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_19(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 17);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 17));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_19(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 17);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 17));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_20(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 20);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 19));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 18));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 17));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 17));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 18));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 19));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) |
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) |
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_20(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 20);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 19));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 18));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 17));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 17));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 18));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 19));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) &
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) &
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_21(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 20);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 19));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 18));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 17));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 17));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 18));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 19));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 20));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) |
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) |
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) |
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_21(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 20);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 19));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 18));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 17));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 17));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 18));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 19));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 20));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) &
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) &
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) &
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_22(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 22);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 21));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 20));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 19));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 18));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 17));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 17));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 18));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 19));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 20));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 21));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 22));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 22) | (*(sptr + 1) >> 10)) |
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11)) |
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) |
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) |
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) |
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12)) |
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11)) |
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_22(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 22);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 21));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 20));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 19));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 18));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 17));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 17));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 18));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 19));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 20));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 21));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 22));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 22) | (*(sptr - 1) << 10)) &
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11)) &
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) &
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) &
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) &
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12)) &
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11)) &
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_23(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 25);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 24));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 23));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 22));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 21));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 20));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 19));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 18));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 17));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 17));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 18));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 19));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 20));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 21));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 22));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 23));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 24));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 25) | (*(sptr + 1) >> 7)) |
+                    ((*(sptr) << 24) | (*(sptr + 1) >> 8)) |
+                    ((*(sptr) << 23) | (*(sptr + 1) >> 9)) |
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10)) |
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11)) |
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) |
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) |
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) |
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12)) |
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11)) |
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10)) |
+                    ((*(sptr) >> 23) | (*(sptr - 1) << 9)) |
+                    ((*(sptr) >> 24) | (*(sptr - 1) << 8));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_23(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 25);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 24));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 23));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 22));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 21));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 20));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 19));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 18));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 17));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 17));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 18));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 19));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 20));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 21));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 22));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 23));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 24));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 25) | (*(sptr - 1) << 7)) &
+                    ((*(sptr) >> 24) | (*(sptr - 1) << 8)) &
+                    ((*(sptr) >> 23) | (*(sptr - 1) << 9)) &
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10)) &
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11)) &
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) &
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) &
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) &
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12)) &
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11)) &
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10)) &
+                    ((*(sptr) << 23) | (*(sptr + 1) >> 9)) &
+                    ((*(sptr) << 24) | (*(sptr + 1) >> 8));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_24(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 25);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 24));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 23));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 22));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 21));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 20));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 19));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 18));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 17));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 17));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 18));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 19));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 20));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 21));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 22));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 23));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 24));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 25));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 25) | (*(sptr + 1) >> 7)) |
+                    ((*(sptr) << 24) | (*(sptr + 1) >> 8)) |
+                    ((*(sptr) << 23) | (*(sptr + 1) >> 9)) |
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10)) |
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11)) |
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12)) |
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) |
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) |
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) |
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) |
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) |
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) |
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) |
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) |
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) |
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) |
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) |
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) |
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) |
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) |
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) |
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) |
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) |
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) |
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) |
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) |
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) |
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) |
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) |
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) |
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) |
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) |
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) |
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) |
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) |
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) |
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) |
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) |
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) |
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12)) |
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11)) |
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10)) |
+                    ((*(sptr) >> 23) | (*(sptr - 1) << 9)) |
+                    ((*(sptr) >> 24) | (*(sptr - 1) << 8)) |
+                    ((*(sptr) >> 25) | (*(sptr - 1) << 7));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_24(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 25);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 24));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 23));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 22));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 21));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 20));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 19));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 18));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 17));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 3));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 4));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 5));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 6));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 7));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 8));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 9));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 10));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 11));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 12));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 13));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 14));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 15));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 16));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 17));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 18));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 19));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 20));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 21));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 22));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 23));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 24));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 25));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 25) | (*(sptr - 1) << 7)) &
+                    ((*(sptr) >> 24) | (*(sptr - 1) << 8)) &
+                    ((*(sptr) >> 23) | (*(sptr - 1) << 9)) &
+                    ((*(sptr) >> 22) | (*(sptr - 1) << 10)) &
+                    ((*(sptr) >> 21) | (*(sptr - 1) << 11)) &
+                    ((*(sptr) >> 20) | (*(sptr - 1) << 12)) &
+                    ((*(sptr) >> 19) | (*(sptr - 1) << 13)) &
+                    ((*(sptr) >> 18) | (*(sptr - 1) << 14)) &
+                    ((*(sptr) >> 17) | (*(sptr - 1) << 15)) &
+                    ((*(sptr) >> 16) | (*(sptr - 1) << 16)) &
+                    ((*(sptr) >> 15) | (*(sptr - 1) << 17)) &
+                    ((*(sptr) >> 14) | (*(sptr - 1) << 18)) &
+                    ((*(sptr) >> 13) | (*(sptr - 1) << 19)) &
+                    ((*(sptr) >> 12) | (*(sptr - 1) << 20)) &
+                    ((*(sptr) >> 11) | (*(sptr - 1) << 21)) &
+                    ((*(sptr) >> 10) | (*(sptr - 1) << 22)) &
+                    ((*(sptr) >> 9) | (*(sptr - 1) << 23)) &
+                    ((*(sptr) >> 8) | (*(sptr - 1) << 24)) &
+                    ((*(sptr) >> 7) | (*(sptr - 1) << 25)) &
+                    ((*(sptr) >> 6) | (*(sptr - 1) << 26)) &
+                    ((*(sptr) >> 5) | (*(sptr - 1) << 27)) &
+                    ((*(sptr) >> 4) | (*(sptr - 1) << 28)) &
+                    ((*(sptr) >> 3) | (*(sptr - 1) << 29)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr) << 3) | (*(sptr + 1) >> 29)) &
+                    ((*(sptr) << 4) | (*(sptr + 1) >> 28)) &
+                    ((*(sptr) << 5) | (*(sptr + 1) >> 27)) &
+                    ((*(sptr) << 6) | (*(sptr + 1) >> 26)) &
+                    ((*(sptr) << 7) | (*(sptr + 1) >> 25)) &
+                    ((*(sptr) << 8) | (*(sptr + 1) >> 24)) &
+                    ((*(sptr) << 9) | (*(sptr + 1) >> 23)) &
+                    ((*(sptr) << 10) | (*(sptr + 1) >> 22)) &
+                    ((*(sptr) << 11) | (*(sptr + 1) >> 21)) &
+                    ((*(sptr) << 12) | (*(sptr + 1) >> 20)) &
+                    ((*(sptr) << 13) | (*(sptr + 1) >> 19)) &
+                    ((*(sptr) << 14) | (*(sptr + 1) >> 18)) &
+                    ((*(sptr) << 15) | (*(sptr + 1) >> 17)) &
+                    ((*(sptr) << 16) | (*(sptr + 1) >> 16)) &
+                    ((*(sptr) << 17) | (*(sptr + 1) >> 15)) &
+                    ((*(sptr) << 18) | (*(sptr + 1) >> 14)) &
+                    ((*(sptr) << 19) | (*(sptr + 1) >> 13)) &
+                    ((*(sptr) << 20) | (*(sptr + 1) >> 12)) &
+                    ((*(sptr) << 21) | (*(sptr + 1) >> 11)) &
+                    ((*(sptr) << 22) | (*(sptr + 1) >> 10)) &
+                    ((*(sptr) << 23) | (*(sptr + 1) >> 9)) &
+                    ((*(sptr) << 24) | (*(sptr + 1) >> 8)) &
+                    ((*(sptr) << 25) | (*(sptr + 1) >> 7));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_25(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls)) |
+                    (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_25(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls)) &
+                    (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_26(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_26(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_27(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls2);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_27(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls2);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_28(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls2);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_28(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls2);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_29(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls3);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_29(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls3);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_30(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls3);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_30(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls3);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_31(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls4);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_31(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls4);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_32(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls4);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_32(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls4);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_33(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls5);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_33(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls5);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_34(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls5);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_34(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls5);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_35(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls6);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_35(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls6);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_36(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls6);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_36(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls6);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_37(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls7);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_37(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls7);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_38(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls7);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_38(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls7);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_39(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls10);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_39(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls10);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_40(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls10);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_40(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls10);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_41(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls12);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls12));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_41(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls12);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls12));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_42(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls15);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls14));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_42(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls15);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls14));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_43(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls15);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls15));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_43(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls15);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls15));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_44(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls17);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls17));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls17)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls17));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_44(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls17);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls17));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls17)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls17));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_45(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls20);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls19));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls18));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls17));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls17));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls18));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls19));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls20)) |
+                    (*(sptr + wpls19)) |
+                    (*(sptr + wpls18)) |
+                    (*(sptr + wpls17)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls17)) |
+                    (*(sptr - wpls18)) |
+                    (*(sptr - wpls19));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_45(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls20);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls19));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls18));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls17));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls17));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls18));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls19));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls20)) &
+                    (*(sptr - wpls19)) &
+                    (*(sptr - wpls18)) &
+                    (*(sptr - wpls17)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls17)) &
+                    (*(sptr + wpls18)) &
+                    (*(sptr + wpls19));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_46(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls20);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls19));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls18));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls17));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls17));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls18));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls19));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls20));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls20)) |
+                    (*(sptr + wpls19)) |
+                    (*(sptr + wpls18)) |
+                    (*(sptr + wpls17)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls17)) |
+                    (*(sptr - wpls18)) |
+                    (*(sptr - wpls19)) |
+                    (*(sptr - wpls20));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_46(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls20);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls19));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls18));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls17));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls17));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls18));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls19));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls20));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls20)) &
+                    (*(sptr - wpls19)) &
+                    (*(sptr - wpls18)) &
+                    (*(sptr - wpls17)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls17)) &
+                    (*(sptr + wpls18)) &
+                    (*(sptr + wpls19)) &
+                    (*(sptr + wpls20));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_47(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+l_int32             wpls21, wpls22;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    wpls21 = 21 * wpls;
+    wpls22 = 22 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls22);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls21));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls20));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls19));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls18));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls17));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls17));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls18));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls19));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls20));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls21));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls22));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls22)) |
+                    (*(sptr + wpls21)) |
+                    (*(sptr + wpls20)) |
+                    (*(sptr + wpls19)) |
+                    (*(sptr + wpls18)) |
+                    (*(sptr + wpls17)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls17)) |
+                    (*(sptr - wpls18)) |
+                    (*(sptr - wpls19)) |
+                    (*(sptr - wpls20)) |
+                    (*(sptr - wpls21)) |
+                    (*(sptr - wpls22));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_47(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+l_int32             wpls21, wpls22;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    wpls21 = 21 * wpls;
+    wpls22 = 22 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls22);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls21));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls20));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls19));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls18));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls17));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls17));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls18));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls19));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls20));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls21));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls22));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls22)) &
+                    (*(sptr - wpls21)) &
+                    (*(sptr - wpls20)) &
+                    (*(sptr - wpls19)) &
+                    (*(sptr - wpls18)) &
+                    (*(sptr - wpls17)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls17)) &
+                    (*(sptr + wpls18)) &
+                    (*(sptr + wpls19)) &
+                    (*(sptr + wpls20)) &
+                    (*(sptr + wpls21)) &
+                    (*(sptr + wpls22));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_48(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+l_int32             wpls21, wpls22, wpls23, wpls24;
+l_int32             wpls25;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    wpls21 = 21 * wpls;
+    wpls22 = 22 * wpls;
+    wpls23 = 23 * wpls;
+    wpls24 = 24 * wpls;
+    wpls25 = 25 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls25);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls24));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls23));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls22));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls21));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls20));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls19));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls18));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls17));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls17));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls18));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls19));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls20));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls21));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls22));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls23));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls24));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls25)) |
+                    (*(sptr + wpls24)) |
+                    (*(sptr + wpls23)) |
+                    (*(sptr + wpls22)) |
+                    (*(sptr + wpls21)) |
+                    (*(sptr + wpls20)) |
+                    (*(sptr + wpls19)) |
+                    (*(sptr + wpls18)) |
+                    (*(sptr + wpls17)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls17)) |
+                    (*(sptr - wpls18)) |
+                    (*(sptr - wpls19)) |
+                    (*(sptr - wpls20)) |
+                    (*(sptr - wpls21)) |
+                    (*(sptr - wpls22)) |
+                    (*(sptr - wpls23)) |
+                    (*(sptr - wpls24));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_48(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+l_int32             wpls21, wpls22, wpls23, wpls24;
+l_int32             wpls25;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    wpls21 = 21 * wpls;
+    wpls22 = 22 * wpls;
+    wpls23 = 23 * wpls;
+    wpls24 = 24 * wpls;
+    wpls25 = 25 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls25);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls24));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls23));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls22));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls21));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls20));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls19));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls18));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls17));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls17));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls18));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls19));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls20));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls21));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls22));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls23));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls24));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls25)) &
+                    (*(sptr - wpls24)) &
+                    (*(sptr - wpls23)) &
+                    (*(sptr - wpls22)) &
+                    (*(sptr - wpls21)) &
+                    (*(sptr - wpls20)) &
+                    (*(sptr - wpls19)) &
+                    (*(sptr - wpls18)) &
+                    (*(sptr - wpls17)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls17)) &
+                    (*(sptr + wpls18)) &
+                    (*(sptr + wpls19)) &
+                    (*(sptr + wpls20)) &
+                    (*(sptr + wpls21)) &
+                    (*(sptr + wpls22)) &
+                    (*(sptr + wpls23)) &
+                    (*(sptr + wpls24));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_49(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+l_int32             wpls21, wpls22, wpls23, wpls24;
+l_int32             wpls25;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    wpls21 = 21 * wpls;
+    wpls22 = 22 * wpls;
+    wpls23 = 23 * wpls;
+    wpls24 = 24 * wpls;
+    wpls25 = 25 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr + wpls25);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls24));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls23));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls22));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls21));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls20));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls19));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls18));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls17));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls17));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls18));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls19));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls20));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls21));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls22));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls23));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls24));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls25));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr + wpls25)) |
+                    (*(sptr + wpls24)) |
+                    (*(sptr + wpls23)) |
+                    (*(sptr + wpls22)) |
+                    (*(sptr + wpls21)) |
+                    (*(sptr + wpls20)) |
+                    (*(sptr + wpls19)) |
+                    (*(sptr + wpls18)) |
+                    (*(sptr + wpls17)) |
+                    (*(sptr + wpls16)) |
+                    (*(sptr + wpls15)) |
+                    (*(sptr + wpls14)) |
+                    (*(sptr + wpls13)) |
+                    (*(sptr + wpls12)) |
+                    (*(sptr + wpls11)) |
+                    (*(sptr + wpls10)) |
+                    (*(sptr + wpls9)) |
+                    (*(sptr + wpls8)) |
+                    (*(sptr + wpls7)) |
+                    (*(sptr + wpls6)) |
+                    (*(sptr + wpls5)) |
+                    (*(sptr + wpls4)) |
+                    (*(sptr + wpls3)) |
+                    (*(sptr + wpls2)) |
+                    (*(sptr + wpls)) |
+                    (*sptr) |
+                    (*(sptr - wpls)) |
+                    (*(sptr - wpls2)) |
+                    (*(sptr - wpls3)) |
+                    (*(sptr - wpls4)) |
+                    (*(sptr - wpls5)) |
+                    (*(sptr - wpls6)) |
+                    (*(sptr - wpls7)) |
+                    (*(sptr - wpls8)) |
+                    (*(sptr - wpls9)) |
+                    (*(sptr - wpls10)) |
+                    (*(sptr - wpls11)) |
+                    (*(sptr - wpls12)) |
+                    (*(sptr - wpls13)) |
+                    (*(sptr - wpls14)) |
+                    (*(sptr - wpls15)) |
+                    (*(sptr - wpls16)) |
+                    (*(sptr - wpls17)) |
+                    (*(sptr - wpls18)) |
+                    (*(sptr - wpls19)) |
+                    (*(sptr - wpls20)) |
+                    (*(sptr - wpls21)) |
+                    (*(sptr - wpls22)) |
+                    (*(sptr - wpls23)) |
+                    (*(sptr - wpls24)) |
+                    (*(sptr - wpls25));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_49(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2, wpls3, wpls4;
+l_int32             wpls5, wpls6, wpls7, wpls8;
+l_int32             wpls9, wpls10, wpls11, wpls12;
+l_int32             wpls13, wpls14, wpls15, wpls16;
+l_int32             wpls17, wpls18, wpls19, wpls20;
+l_int32             wpls21, wpls22, wpls23, wpls24;
+l_int32             wpls25;
+
+    wpls2 = 2 * wpls;
+    wpls3 = 3 * wpls;
+    wpls4 = 4 * wpls;
+    wpls5 = 5 * wpls;
+    wpls6 = 6 * wpls;
+    wpls7 = 7 * wpls;
+    wpls8 = 8 * wpls;
+    wpls9 = 9 * wpls;
+    wpls10 = 10 * wpls;
+    wpls11 = 11 * wpls;
+    wpls12 = 12 * wpls;
+    wpls13 = 13 * wpls;
+    wpls14 = 14 * wpls;
+    wpls15 = 15 * wpls;
+    wpls16 = 16 * wpls;
+    wpls17 = 17 * wpls;
+    wpls18 = 18 * wpls;
+    wpls19 = 19 * wpls;
+    wpls20 = 20 * wpls;
+    wpls21 = 21 * wpls;
+    wpls22 = 22 * wpls;
+    wpls23 = 23 * wpls;
+    wpls24 = 24 * wpls;
+    wpls25 = 25 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr - wpls25);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls24));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls23));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls22));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls21));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls20));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls19));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls18));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls17));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls3));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls4));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls5));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls6));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls7));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls8));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls9));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls10));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls11));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls12));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls13));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls14));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls15));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls16));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls17));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls18));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls19));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls20));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls21));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls22));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls23));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls24));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls25));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*(sptr - wpls25)) &
+                    (*(sptr - wpls24)) &
+                    (*(sptr - wpls23)) &
+                    (*(sptr - wpls22)) &
+                    (*(sptr - wpls21)) &
+                    (*(sptr - wpls20)) &
+                    (*(sptr - wpls19)) &
+                    (*(sptr - wpls18)) &
+                    (*(sptr - wpls17)) &
+                    (*(sptr - wpls16)) &
+                    (*(sptr - wpls15)) &
+                    (*(sptr - wpls14)) &
+                    (*(sptr - wpls13)) &
+                    (*(sptr - wpls12)) &
+                    (*(sptr - wpls11)) &
+                    (*(sptr - wpls10)) &
+                    (*(sptr - wpls9)) &
+                    (*(sptr - wpls8)) &
+                    (*(sptr - wpls7)) &
+                    (*(sptr - wpls6)) &
+                    (*(sptr - wpls5)) &
+                    (*(sptr - wpls4)) &
+                    (*(sptr - wpls3)) &
+                    (*(sptr - wpls2)) &
+                    (*(sptr - wpls)) &
+                    (*sptr) &
+                    (*(sptr + wpls)) &
+                    (*(sptr + wpls2)) &
+                    (*(sptr + wpls3)) &
+                    (*(sptr + wpls4)) &
+                    (*(sptr + wpls5)) &
+                    (*(sptr + wpls6)) &
+                    (*(sptr + wpls7)) &
+                    (*(sptr + wpls8)) &
+                    (*(sptr + wpls9)) &
+                    (*(sptr + wpls10)) &
+                    (*(sptr + wpls11)) &
+                    (*(sptr + wpls12)) &
+                    (*(sptr + wpls13)) &
+                    (*(sptr + wpls14)) &
+                    (*(sptr + wpls15)) &
+                    (*(sptr + wpls16)) &
+                    (*(sptr + wpls17)) &
+                    (*(sptr + wpls18)) &
+                    (*(sptr + wpls19)) &
+                    (*(sptr + wpls20)) &
+                    (*(sptr + wpls21)) &
+                    (*(sptr + wpls22)) &
+                    (*(sptr + wpls23)) &
+                    (*(sptr + wpls24)) &
+                    (*(sptr + wpls25));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_50(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr + wpls, 1);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) |
+                    (*(sptr + wpls)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_50(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr - wpls, 1);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) &
+                    (*(sptr - wpls)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr);
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_51(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr + wpls, 1);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr + wpls, 1));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr - wpls, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr - wpls, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) |
+                    (*(sptr + wpls)) |
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) |
+                    (*(sptr - wpls)) |
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_51(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr - wpls, 1);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr + wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) &
+                    (*(sptr - wpls)) &
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) &
+                    (*(sptr + wpls)) &
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_52(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr + wpls2, 2);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr + wpls2, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr + wpls2, 1));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr + wpls, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr + wpls, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr + wpls, 1));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr - wpls, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr - wpls, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr - wpls, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr + wpls2) << 2) | (*(sptr + wpls2 + 1) >> 30)) |
+                    ((*(sptr + wpls2) << 1) | (*(sptr + wpls2 + 1) >> 31)) |
+                    (*(sptr + wpls2)) |
+                    ((*(sptr + wpls2) >> 1) | (*(sptr + wpls2 - 1) << 31)) |
+                    ((*(sptr + wpls) << 2) | (*(sptr + wpls + 1) >> 30)) |
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) |
+                    (*(sptr + wpls)) |
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr - wpls) << 2) | (*(sptr - wpls + 1) >> 30)) |
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) |
+                    (*(sptr - wpls)) |
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_52(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr - wpls2, 2);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr - wpls2, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls2, 1));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr - wpls, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr - wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr + wpls, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr + wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls2) >> 2) | (*(sptr - wpls2 - 1) << 30)) &
+                    ((*(sptr - wpls2) >> 1) | (*(sptr - wpls2 - 1) << 31)) &
+                    (*(sptr - wpls2)) &
+                    ((*(sptr - wpls2) << 1) | (*(sptr - wpls2 + 1) >> 31)) &
+                    ((*(sptr - wpls) >> 2) | (*(sptr - wpls - 1) << 30)) &
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) &
+                    (*(sptr - wpls)) &
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr + wpls) >> 2) | (*(sptr + wpls - 1) << 30)) &
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) &
+                    (*(sptr + wpls)) &
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_53(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr + wpls2, 2);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr + wpls2, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr + wpls2, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr + wpls2, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr + wpls, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr + wpls, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr + wpls, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr + wpls, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr - wpls, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr - wpls, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr - wpls, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr - wpls, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr - wpls2, 2));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr - wpls2, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr - wpls2, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr - wpls2, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr + wpls2) << 2) | (*(sptr + wpls2 + 1) >> 30)) |
+                    ((*(sptr + wpls2) << 1) | (*(sptr + wpls2 + 1) >> 31)) |
+                    (*(sptr + wpls2)) |
+                    ((*(sptr + wpls2) >> 1) | (*(sptr + wpls2 - 1) << 31)) |
+                    ((*(sptr + wpls2) >> 2) | (*(sptr + wpls2 - 1) << 30)) |
+                    ((*(sptr + wpls) << 2) | (*(sptr + wpls + 1) >> 30)) |
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) |
+                    (*(sptr + wpls)) |
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) |
+                    ((*(sptr + wpls) >> 2) | (*(sptr + wpls - 1) << 30)) |
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) |
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) |
+                    ((*(sptr - wpls) << 2) | (*(sptr - wpls + 1) >> 30)) |
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) |
+                    (*(sptr - wpls)) |
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) |
+                    ((*(sptr - wpls) >> 2) | (*(sptr - wpls - 1) << 30)) |
+                    ((*(sptr - wpls2) << 2) | (*(sptr - wpls2 + 1) >> 30)) |
+                    ((*(sptr - wpls2) << 1) | (*(sptr - wpls2 + 1) >> 31)) |
+                    (*(sptr - wpls2)) |
+                    ((*(sptr - wpls2) >> 1) | (*(sptr - wpls2 - 1) << 31)) |
+                    ((*(sptr - wpls2) >> 2) | (*(sptr - wpls2 - 1) << 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_53(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr - wpls2, 2);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr - wpls2, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls2, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls2, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr - wpls, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr - wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr - wpls));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr + wpls, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr + wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr + wpls2, 2));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr + wpls2, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls2));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls2, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls2, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls2) >> 2) | (*(sptr - wpls2 - 1) << 30)) &
+                    ((*(sptr - wpls2) >> 1) | (*(sptr - wpls2 - 1) << 31)) &
+                    (*(sptr - wpls2)) &
+                    ((*(sptr - wpls2) << 1) | (*(sptr - wpls2 + 1) >> 31)) &
+                    ((*(sptr - wpls2) << 2) | (*(sptr - wpls2 + 1) >> 30)) &
+                    ((*(sptr - wpls) >> 2) | (*(sptr - wpls - 1) << 30)) &
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) &
+                    (*(sptr - wpls)) &
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) &
+                    ((*(sptr - wpls) << 2) | (*(sptr - wpls + 1) >> 30)) &
+                    ((*(sptr) >> 2) | (*(sptr - 1) << 30)) &
+                    ((*(sptr) >> 1) | (*(sptr - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    ((*(sptr) << 2) | (*(sptr + 1) >> 30)) &
+                    ((*(sptr + wpls) >> 2) | (*(sptr + wpls - 1) << 30)) &
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) &
+                    (*(sptr + wpls)) &
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) &
+                    ((*(sptr + wpls) << 2) | (*(sptr + wpls + 1) >> 30)) &
+                    ((*(sptr + wpls2) >> 2) | (*(sptr + wpls2 - 1) << 30)) &
+                    ((*(sptr + wpls2) >> 1) | (*(sptr + wpls2 - 1) << 31)) &
+                    (*(sptr + wpls2)) &
+                    ((*(sptr + wpls2) << 1) | (*(sptr + wpls2 + 1) >> 31)) &
+                    ((*(sptr + wpls2) << 2) | (*(sptr + wpls2 + 1) >> 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_54(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr, 1);
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr - wpls));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) >> 1) | (*(sptr - 1) << 31)) |
+                    (*(sptr - wpls));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_54(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr, 1);
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr + wpls));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr) << 1) | (*(sptr + 1) >> 31)) &
+                    (*(sptr + wpls));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_55(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr);
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr - wpls, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr) |
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_55(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_WORD256(sptr);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls, 1));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = (*sptr) &
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_56(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr + wpls2, 2);
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr + wpls, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr - wpls, 1));
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr - wpls2, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr + wpls2) >> 2) | (*(sptr + wpls2 - 1) << 30)) |
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) |
+                    (*sptr) |
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) |
+                    ((*(sptr - wpls2) << 2) | (*(sptr - wpls2 + 1) >> 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_56(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr - wpls2, 2);
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr - wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr + wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr + wpls2, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls2) << 2) | (*(sptr - wpls2 + 1) >> 30)) &
+                    ((*(sptr - wpls) << 1) | (*(sptr - wpls + 1) >> 31)) &
+                    (*sptr) &
+                    ((*(sptr + wpls) >> 1) | (*(sptr + wpls - 1) << 31)) &
+                    ((*(sptr + wpls2) >> 2) | (*(sptr + wpls2 - 1) << 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+fdilate256_1_57(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHL256(sptr + wpls2, 2);
+            vec = _mm256_or_si256(vec, DWA_SHL256(sptr + wpls, 1));
+            vec = _mm256_or_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr - wpls, 1));
+            vec = _mm256_or_si256(vec, DWA_SHR256(sptr - wpls2, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr + wpls2) << 2) | (*(sptr + wpls2 + 1) >> 30)) |
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) |
+                    (*sptr) |
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) |
+                    ((*(sptr - wpls2) >> 2) | (*(sptr - wpls2 - 1) << 30));
+        }
+    }
+}
+
+static void L_TARGET_AVX2
+ferode256_1_57(l_uint32  *datad,
+            l_int32    w,
+            l_int32    h,
+            l_int32    wpld,
+            l_uint32  *datas,
+            l_int32    wpls)
+{
+l_int32    i;
+l_int32    j, pwpls;
+l_uint32  *sptr, *dptr;
+__m256i    vec;
+l_int32             wpls2;
+
+    wpls2 = 2 * wpls;
+    pwpls = (l_uint32)(w + 31) / 32;  /* proper wpl of src */
+
+    for (i = 0; i < h; i++) {
+        sptr = datas + i * wpls;
+        dptr = datad + i * wpld;
+        for (j = 0; j < pwpls - 7; j += 8, sptr += 8, dptr += 8) {
+            vec = DWA_SHR256(sptr - wpls2, 2);
+            vec = _mm256_and_si256(vec, DWA_SHR256(sptr - wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_WORD256(sptr));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls, 1));
+            vec = _mm256_and_si256(vec, DWA_SHL256(sptr + wpls2, 2));
+            _mm256_storeu_si256((__m256i *)dptr, vec);
+        }
+        for (; j < pwpls; j++, sptr++, dptr++) {
+            *dptr = ((*(sptr - wpls2) >> 2) | (*(sptr - wpls2 - 1) << 30)) &
+                    ((*(sptr - wpls) >> 1) | (*(sptr - wpls - 1) << 31)) &
+                    (*sptr) &
+                    ((*(sptr + wpls) << 1) | (*(sptr + wpls + 1) >> 31)) &
+                    ((*(sptr + wpls2) << 2) | (*(sptr + wpls2 + 1) >> 30));
+        }
+    }
+}
+
+#endif  /* L_HAVE_AVX2 */
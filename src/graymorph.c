@@ -35,6 +35,16 @@
  *            PIX           *pixOpenGray()
  *            PIX           *pixCloseGray()
  *
+ *      Linear operation on images with a frame border
+ *            l_int32        pixGrayMorphLinearFramed()
+ *
+ *      Operations with arbitrary flat Sels  (line segment decomposition)
+ *            PIX           *pixErodeGraySel()
+ *            PIX           *pixDilateGraySel()
+ *            PIX           *pixOpenGraySel()
+ *            PIX           *pixCloseGraySel()
+ *            static PIX    *pixMorphGraySelLow()
+ *
  *      Special operations for 1x3, 3x1 and 3x3 Sels  (direct)
  *            PIX           *pixErodeGray3()
  *            static PIX    *pixErodeGray3h()
@@ -48,6 +58,8 @@
  *      Low-level grayscale morphological operations
  *            static void    dilateGrayLow()
  *            static void    erodeGrayLow()
+ *            static l_int32 selGetSegmentsLow()
+ *            static void    grayWindowMaxLow()
  *
  *
  *      Method: Algorithm by van Herk and Gil and Werman, 1992
@@ -123,8 +135,16 @@
 #include <config_auto.h>
 #endif  /* HAVE_CONFIG_H */
 
+#include <string.h>
 #include "allheaders.h"
 
+    /* Operations with arbitrary flat Sels */
+static PIX *pixMorphGraySelLow(PIX *pixs, SEL *sel, l_int32 type);
+static l_int32 selGetSegmentsLow(SEL *sel, l_int32 dir, l_int32 *seglist,
+                                 l_int32 *pnseg, l_int32 *pmaxlen);
+static void grayWindowMaxLow(l_uint8 *bufd, l_uint8 *bufs, l_int32 wb,
+                             l_int32 hb, l_int32 len, l_int32 dir);
+
     /* Special static operations for 3x1, 1x3 and 3x3 structuring elements */
 static PIX *pixErodeGray3h(PIX *pixs);
 static PIX *pixErodeGray3v(PIX *pixs);
@@ -631,6 +651,369 @@ cleanup:
 }
 
 
+/*-----------------------------------------------------------------*
+ *          Linear operation on images with a frame border         *
+ *-----------------------------------------------------------------*/
+/*!
+ * \brief   pixGrayMorphLinearFramed()
+ *
+ * \param[in]    pixd        8 bpp, same size as pixs
+ * \param[in]    pixs        8 bpp, with the image inside a frame border
+ * \param[in]    frame       width of the border on each side
+ * \param[in]    type        L_MORPH_DILATE or L_MORPH_ERODE
+ * \param[in]    size        odd length of the linear Sel; origin in center
+ * \param[in]    direction   L_HORIZ or L_VERT
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is one of the linear steps in pixDilateGray() and
+ *          pixErodeGray(), done on images that carry their own border,
+ *          so that a sequence of steps can alternate between two
+ *          buffers without making or copying any images.
+ *      (2) The frame of %pixs is set here to 0 for dilation and 255 for
+ *          erosion, which gives the same result inside the frame as the
+ *          functions that add a border.  The frame of %pixd is left
+ *          undefined.  It requires %frame >= (3 * %size + 1) / 2.
+ *      (3) If %size == 1, the pix is copied.
+ * </pre>
+ */
+l_ok
+pixGrayMorphLinearFramed(PIX     *pixd,
+                         PIX     *pixs,
+                         l_int32  frame,
+                         l_int32  type,
+                         l_int32  size,
+                         l_int32  direction)
+{
+l_uint8   *buffer, *array;
+l_int32    w, h, wd, hd;
+
+    if (!pixd || !pixs)
+        return ERROR_INT("pixd and pixs not both defined", __func__, 1);
+    if (pixd == pixs)
+        return ERROR_INT("pixd and pixs must differ", __func__, 1);
+    if (pixGetDepth(pixs) != 8 || pixGetDepth(pixd) != 8)
+        return ERROR_INT("pixs and pixd not both 8 bpp", __func__, 1);
+    pixGetDimensions(pixs, &w, &h, NULL);
+    pixGetDimensions(pixd, &wd, &hd, NULL);
+    if (w != wd || h != hd)
+        return ERROR_INT("pixs and pixd sizes differ", __func__, 1);
+    if (type != L_MORPH_DILATE && type != L_MORPH_ERODE)
+        return ERROR_INT("invalid type", __func__, 1);
+    if (direction != L_HORIZ && direction != L_VERT)
+        return ERROR_INT("invalid direction", __func__, 1);
+    if (size < 1 || (size & 1) == 0)
+        return ERROR_INT("size not odd and >= 1", __func__, 1);
+    if (frame < (3 * size + 1) / 2 || 2 * frame >= L_MIN(w, h))
+        return ERROR_INT("invalid frame", __func__, 1);
+
+    if (size == 1) {
+        pixCopy(pixd, pixs);
+        return 0;
+    }
+
+    buffer = (l_uint8 *)LEPT_CALLOC(L_MAX(w, h), sizeof(l_uint8));
+    array = (l_uint8 *)LEPT_CALLOC(2 * size, sizeof(l_uint8));
+    if (!buffer || !array) {
+        LEPT_FREE(buffer);
+        LEPT_FREE(array);
+        return ERROR_INT("buffer and array not made", __func__, 1);
+    }
+
+    pixSetOrClearBorder(pixs, frame, frame, frame, frame,
+                        (type == L_MORPH_DILATE) ? PIX_CLR : PIX_SET);
+    if (type == L_MORPH_DILATE)
+        dilateGrayLow(pixGetData(pixd), w, h, pixGetWpl(pixd),
+                      pixGetData(pixs), pixGetWpl(pixs), size, direction,
+                      buffer, array);
+    else
+        erodeGrayLow(pixGetData(pixd), w, h, pixGetWpl(pixd),
+                     pixGetData(pixs), pixGetWpl(pixs), size, direction,
+                     buffer, array);
+
+    LEPT_FREE(buffer);
+    LEPT_FREE(array);
+    return 0;
+}
+
+
+/*-----------------------------------------------------------------*
+ *              Operations with arbitrary flat Sels                *
+ *-----------------------------------------------------------------*/
+/*!
+ * \brief   pixErodeGraySel()
+ *
+ * \param[in]    pixs    8 bpp, not cmapped
+ * \param[in]    sel     flat Sel; only the hits are used
+ * \return  pixd, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) Each dest pixel is the minimum over the src pixels at the
+ *          locations of the hits, relative to the Sel origin.
+ *          Pixels outside the image are ignored (they are taken as 255).
+ *      (2) The Sel is decomposed into line segments of hits, either all
+ *          horizontal or all vertical, whichever is cheaper.  The
+ *          min over each segment length is found once for the image
+ *          with the vHGW method, and each segment then costs a single
+ *          comparison per pixel.  A Sel of scattered hits degenerates
+ *          to one comparison per hit and pixel.
+ *      (3) A brick Sel of odd dimensions with a centered origin is
+ *          sent to pixErodeGray().
+ * </pre>
+ */
+PIX *
+pixErodeGraySel(PIX  *pixs,
+                SEL  *sel)
+{
+    return pixMorphGraySelLow(pixs, sel, L_MORPH_ERODE);
+}
+
+
+/*!
+ * \brief   pixDilateGraySel()
+ *
+ * \param[in]    pixs    8 bpp, not cmapped
+ * \param[in]    sel     flat Sel; only the hits are used
+ * \return  pixd, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) Each dest pixel is the maximum over the src pixels at the
+ *          locations of the reflected hits, relative to the Sel origin,
+ *          as in the binary pixDilate().  Pixels outside the image
+ *          are ignored (they are taken as 0).
+ *      (2) See pixErodeGraySel() for the method.
+ * </pre>
+ */
+PIX *
+pixDilateGraySel(PIX  *pixs,
+                 SEL  *sel)
+{
+    return pixMorphGraySelLow(pixs, sel, L_MORPH_DILATE);
+}
+
+
+/*!
+ * \brief   pixOpenGraySel()
+ *
+ * \param[in]    pixs    8 bpp, not cmapped
+ * \param[in]    sel     flat Sel; only the hits are used
+ * \return  pixd, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) Erosion followed by dilation with the same Sel.
+ * </pre>
+ */
+PIX *
+pixOpenGraySel(PIX  *pixs,
+               SEL  *sel)
+{
+PIX  *pix1, *pixd;
+
+    if ((pix1 = pixErodeGraySel(pixs, sel)) == NULL)
+        return (PIX *)ERROR_PTR("pix1 not made", __func__, NULL);
+    pixd = pixDilateGraySel(pix1, sel);
+    pixDestroy(&pix1);
+    return pixd;
+}
+
+
+/*!
+ * \brief   pixCloseGraySel()
+ *
+ * \param[in]    pixs    8 bpp, not cmapped
+ * \param[in]    sel     flat Sel; only the hits are used
+ * \return  pixd, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) Dilation followed by erosion with the same Sel.
+ * </pre>
+ */
+PIX *
+pixCloseGraySel(PIX  *pixs,
+                SEL  *sel)
+{
+PIX  *pix1, *pixd;
+
+    if ((pix1 = pixDilateGraySel(pixs, sel)) == NULL)
+        return (PIX *)ERROR_PTR("pix1 not made", __func__, NULL);
+    pixd = pixErodeGraySel(pix1, sel);
+    pixDestroy(&pix1);
+    return pixd;
+}
+
+
+/*!
+ * \brief   pixMorphGraySelLow()
+ *
+ * \param[in]    pixs    8 bpp, not cmapped
+ * \param[in]    sel     flat Sel
+ * \param[in]    type    L_MORPH_DILATE or L_MORPH_ERODE
+ * \return  pixd, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) Erosion is done as a dilation of the inverted image, with
+ *          the offsets of the hits negated, so there is only a single
+ *          max path.  The image is copied into a byte array with a
+ *          border of 0 that is large enough for every offset.
+ *      (2) The cost of a decomposition is estimated as the number of
+ *          segments plus 3 for each distinct segment length > 1, which
+ *          accounts for the vHGW pass that is needed for that length.
+ * </pre>
+ */
+static PIX *
+pixMorphGraySelLow(PIX     *pixs,
+                   SEL     *sel,
+                   l_int32  type)
+{
+l_uint8   *bufs, *buff, *bufd, *lines, *linef, *lined;
+l_int32    i, j, k, w, h, wb, hb, sx, sy, cx, cy, nhits, dir, wpl, maxlen;
+l_int32    nseg, costh, costv, len, offx, offy, x, y;
+l_int32   *seglist;
+l_uint32  *data, *line;
+PIX       *pixd;
+
+    if (!pixs || pixGetDepth(pixs) != 8 || pixGetColormap(pixs))
+        return (PIX *)ERROR_PTR("pixs undefined or not 8 bpp gray",
+                                __func__, NULL);
+    if (!sel)
+        return (PIX *)ERROR_PTR("sel not defined", __func__, NULL);
+
+    selGetParameters(sel, &sy, &sx, &cy, &cx);
+    nhits = 0;
+    for (i = 0; i < sy; i++) {
+        for (j = 0; j < sx; j++) {
+            if (sel->data[i][j] == SEL_HIT)
+                nhits++;
+        }
+    }
+    if (nhits == 0)
+        return (PIX *)ERROR_PTR("sel has no hits", __func__, NULL);
+
+        /* Solid brick with centered origin: use the separable method */
+    if (nhits == sx * sy && (sx & 1) && (sy & 1) &&
+        cx == sx / 2 && cy == sy / 2) {
+        if (type == L_MORPH_DILATE)
+            return pixDilateGray(pixs, sx, sy);
+        else
+            return pixErodeGray(pixs, sx, sy);
+    }
+
+        /* Choose the direction of the line segments */
+    costh = selGetSegmentsLow(sel, L_HORIZ, NULL, NULL, NULL);
+    costv = selGetSegmentsLow(sel, L_VERT, NULL, NULL, NULL);
+    if (costh < 0 || costv < 0)
+        return (PIX *)ERROR_PTR("segments not found", __func__, NULL);
+    dir = (costh <= costv) ? L_HORIZ : L_VERT;
+    if ((seglist = (l_int32 *)LEPT_CALLOC(3 * nhits, sizeof(l_int32))) == NULL)
+        return (PIX *)ERROR_PTR("seglist not made", __func__, NULL);
+    if (selGetSegmentsLow(sel, dir, seglist, &nseg, &maxlen) < 0) {
+        LEPT_FREE(seglist);
+        return (PIX *)ERROR_PTR("segments not found", __func__, NULL);
+    }
+
+        /* Make the bordered src, inverted for erosion */
+    pixGetDimensions(pixs, &w, &h, NULL);
+    wb = w + 2 * sx;
+    hb = h + 2 * sy;
+    bufs = (l_uint8 *)LEPT_CALLOC((size_t)wb * hb, sizeof(l_uint8));
+    buff = (maxlen > 1) ?
+           (l_uint8 *)LEPT_CALLOC((size_t)wb * hb, sizeof(l_uint8)) : NULL;
+    bufd = (l_uint8 *)LEPT_CALLOC((size_t)w * h, sizeof(l_uint8));
+    pixd = pixCreateTemplate(pixs);
+    if (!bufs || (maxlen > 1 && !buff) || !bufd || !pixd) {
+        L_ERROR("buffers or pixd not made\n", __func__);
+        pixDestroy(&pixd);
+        goto cleanup;
+    }
+    data = pixGetData(pixs);
+    wpl = pixGetWpl(pixs);
+    for (y = 0; y < h; y++) {
+        line = data + y * wpl;
+        lines = bufs + (size_t)(y + sy) * wb + sx;
+        if (type == L_MORPH_DILATE) {
+            for (x = 0; x < w; x++)
+                lines[x] = GET_DATA_BYTE(line, x);
+        } else {
+            for (x = 0; x < w; x++)
+                lines[x] = 255 - GET_DATA_BYTE(line, x);
+        }
+    }
+
+        /* For each segment length, find the max over windows of that
+         * length starting at each pixel, and accumulate the max over
+         * all segments of that length.  Each segment is stored as
+         * (line, first, length); for a horizontal segment the line is
+         * the Sel row and first is the Sel column.  The window
+         * for each segment begins at (offx, offy) from the dest
+         * pixel, in the bordered image. */
+    for (len = 1; len <= maxlen; len++) {
+        for (k = 0; k < nseg; k++) {
+            if (seglist[3 * k + 2] == len) break;
+        }
+        if (k == nseg) continue;
+        if (len > 1)
+            grayWindowMaxLow(buff, bufs, wb, hb, len, dir);
+        linef = (len > 1) ? buff : bufs;
+        for (k = 0; k < nseg; k++) {
+            if (seglist[3 * k + 2] != len) continue;
+            i = seglist[3 * k];
+            j = seglist[3 * k + 1];
+            if (dir == L_HORIZ) {
+                if (type == L_MORPH_DILATE) {
+                    offx = sx + cx - (j + len - 1);
+                    offy = sy + cy - i;
+                } else {
+                    offx = sx + j - cx;
+                    offy = sy + i - cy;
+                }
+            } else {  /* i is the Sel column and j the first Sel row */
+                if (type == L_MORPH_DILATE) {
+                    offx = sx + cx - i;
+                    offy = sy + cy - (j + len - 1);
+                } else {
+                    offx = sx + i - cx;
+                    offy = sy + j - cy;
+                }
+            }
+            for (y = 0; y < h; y++) {
+                lines = linef + (size_t)(y + offy) * wb + offx;
+                lined = bufd + (size_t)y * w;
+                for (x = 0; x < w; x++)
+                    lined[x] = L_MAX(lined[x], lines[x]);
+            }
+        }
+    }
+
+        /* Write the result, inverting back for erosion */
+    data = pixGetData(pixd);
+    wpl = pixGetWpl(pixd);
+    for (y = 0; y < h; y++) {
+        line = data + y * wpl;
+        lined = bufd + (size_t)y * w;
+        if (type == L_MORPH_DILATE) {
+            for (x = 0; x < w; x++)
+                SET_DATA_BYTE(line, x, lined[x]);
+        } else {
+            for (x = 0; x < w; x++)
+                SET_DATA_BYTE(line, x, 255 - lined[x]);
+        }
+    }
+
+cleanup:
+    LEPT_FREE(seglist);
+    LEPT_FREE(bufs);
+    LEPT_FREE(buff);
+    LEPT_FREE(bufd);
+    return pixd;
+}
+
+
 /*-----------------------------------------------------------------*
  *           Special operations for 1x3, 3x1 and 3x3 Sels          *
  *-----------------------------------------------------------------*/
@@ -1350,3 +1733,204 @@ l_uint32  *lines, *lined;
 
     return;
 }
+
+
+/*!
+ * \brief   selGetSegmentsLow()
+ *
+ * \param[in]    sel
+ * \param[in]    dir        L_HORIZ or L_VERT
+ * \param[out]   seglist    [optional] 3 ints for each segment:
+ *                          (line, first, length); size 3 * nhits
+ * \param[out]   pnseg      [optional] number of segments
+ * \param[out]   pmaxlen    [optional] maximum segment length
+ * \return  estimated cost of using the segments in this direction,
+ *          or -1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) Segments are maximal runs of hits in the rows (L_HORIZ)
+ *          or columns (L_VERT) of the Sel.  The line is the row or
+ *          column, and first is the column or row of the start of
+ *          the run.
+ * </pre>
+ */
+static l_int32
+selGetSegmentsLow(SEL      *sel,
+                  l_int32   dir,
+                  l_int32  *seglist,
+                  l_int32  *pnseg,
+                  l_int32  *pmaxlen)
+{
+l_int32  i, j, n1, n2, nseg, len, maxlen, cost;
+l_int32  lencount[256];
+l_int32 *counts;
+
+    if (pnseg) *pnseg = 0;
+    if (pmaxlen) *pmaxlen = 0;
+    selGetParameters(sel, &n2, &n1, NULL, NULL);  /* L_HORIZ: rows */
+    if (dir == L_VERT) {
+        i = n1;
+        n1 = n2;
+        n2 = i;
+    }
+    counts = (n1 < 256) ? lencount : (l_int32 *)LEPT_CALLOC(n1 + 1,
+                                                            sizeof(l_int32));
+    if (!counts)
+        return ERROR_INT("counts not made", __func__, -1);
+    memset(counts, 0, sizeof(l_int32) * L_MIN(n1 + 1, 256));
+    nseg = maxlen = 0;
+    for (i = 0; i < n2; i++) {
+        len = 0;
+        for (j = 0; j <= n1; j++) {
+            if (j < n1 && ((dir == L_HORIZ && sel->data[i][j] == SEL_HIT) ||
+                           (dir == L_VERT && sel->data[j][i] == SEL_HIT))) {
+                len++;
+                continue;
+            }
+            if (len > 0) {
+                if (seglist) {
+                    seglist[3 * nseg] = i;
+                    seglist[3 * nseg + 1] = j - len;
+                    seglist[3 * nseg + 2] = len;
+                }
+                nseg++;
+                counts[len]++;
+                maxlen = L_MAX(maxlen, len);
+                len = 0;
+            }
+        }
+    }
+
+    cost = nseg;
+    for (len = 2; len <= maxlen; len++) {
+        if (counts[len] > 0)
+            cost += 3;
+    }
+    if (counts != lencount)
+        LEPT_FREE(counts);
+    if (pnseg) *pnseg = nseg;
+    if (pmaxlen) *pmaxlen = maxlen;
+    return cost;
+}
+
+
+/*!
+ * \brief   grayWindowMaxLow()
+ *
+ * \param[in]    bufd    dest array, wb x hb
+ * \param[in]    bufs    src array, wb x hb
+ * \param[in]    wb, hb  array dimensions
+ * \param[in]    len     window length; > 1
+ * \param[in]    dir     L_HORIZ or L_VERT
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) Each dest pixel gets the max of the %len src pixels
+ *          starting at that pixel and going right (L_HORIZ) or
+ *          down (L_VERT).  The array is split into blocks of %len
+ *          pixels, with the forward max from the start of each block
+ *          and the backward max from the end, and each window is
+ *          the max of one value from each (vHGW).  Pixels whose window
+ *          extends beyond the array are not set.
+ *      (2) For L_VERT, the same is done with entire rows as the
+ *          elements, so that all inner loops are along rows.
+ * </pre>
+ */
+static void
+grayWindowMaxLow(l_uint8  *bufd,
+                 l_uint8  *bufs,
+                 l_int32   wb,
+                 l_int32   hb,
+                 l_int32   len,
+                 l_int32   dir)
+{
+l_uint8  *array, *fwd, *bwd, *prevb, *curb;
+l_uint8  *lines, *lined, *linef, *lineb, *linep;
+l_int32   x, y, k, t, n, nrows;
+
+    if (dir == L_HORIZ) {
+        n = len * ((wb + len - 1) / len);
+        fwd = (l_uint8 *)LEPT_CALLOC(2 * n, sizeof(l_uint8));
+        bwd = fwd + n;
+        for (y = 0; y < hb; y++) {
+            lines = bufs + (size_t)y * wb;
+            lined = bufd + (size_t)y * wb;
+            for (k = 0; k < n; k += len) {
+                fwd[k] = lines[k];
+                for (t = k + 1; t < k + len; t++) {
+                    fwd[t] = (t < wb) ? L_MAX(fwd[t - 1], lines[t])
+                                      : fwd[t - 1];
+                }
+                t = k + len - 1;
+                bwd[t] = (t < wb) ? lines[t] : 0;
+                for (t = k + len - 2; t >= k; t--)
+                    bwd[t] = (t < wb) ? L_MAX(bwd[t + 1], lines[t]) : 0;
+            }
+            for (x = 0; x <= wb - len; x++)
+                lined[x] = L_MAX(bwd[x], fwd[x + len - 1]);
+        }
+        LEPT_FREE(fwd);
+        return;
+    }
+
+        /* Vertical: whole rows are the elements.  The windows starting
+         * in a block need the backward max of that block and the forward
+         * max of the next one, so the dest rows of each block are
+         * written after the next block has been processed. */
+    n = (hb + len - 1) / len;  /* number of blocks */
+    array = (l_uint8 *)LEPT_CALLOC((size_t)3 * len * wb, sizeof(l_uint8));
+    prevb = array;
+    curb = prevb + (size_t)len * wb;
+    fwd = curb + (size_t)len * wb;
+    for (k = 0; k <= n; k++) {
+        if (k < n) {
+            y = k * len;
+            nrows = L_MIN(len, hb - y);
+            for (t = nrows - 1; t >= 0; t--) {
+                lines = bufs + (size_t)(y + t) * wb;
+                lineb = curb + (size_t)t * wb;
+                linep = curb + (size_t)(t + 1) * wb;
+                if (t == nrows - 1) {
+                    memcpy(lineb, lines, wb);
+                } else {
+                    for (x = 0; x < wb; x++)
+                        lineb[x] = L_MAX(linep[x], lines[x]);
+                }
+            }
+            for (t = 0; t < nrows; t++) {
+                lines = bufs + (size_t)(y + t) * wb;
+                linef = fwd + (size_t)t * wb;
+                linep = fwd + (size_t)(t - 1) * wb;
+                if (t == 0) {
+                    memcpy(linef, lines, wb);
+                } else {
+                    for (x = 0; x < wb; x++)
+                        linef[x] = L_MAX(linep[x], lines[x]);
+                }
+            }
+        } else {
+            nrows = 0;
+        }
+
+            /* Dest rows of the previous block, for which the window
+             * ends within the array */
+        if (k > 0) {
+            y = (k - 1) * len;
+            if (y + len - 1 < hb)
+                memcpy(bufd + (size_t)y * wb, prevb, wb);
+            for (t = 1; t < len && t <= nrows; t++) {
+                lineb = prevb + (size_t)t * wb;
+                linef = fwd + (size_t)(t - 1) * wb;
+                lined = bufd + (size_t)(y + t) * wb;
+                for (x = 0; x < wb; x++)
+                    lined[x] = L_MAX(lineb[x], linef[x]);
+            }
+        }
+        linep = prevb;
+        prevb = curb;
+        curb = linep;
+    }
+    LEPT_FREE(array);
+}
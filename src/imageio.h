@@ -140,6 +140,55 @@ enum {
 };
 
 
+/* --------------------------------------------------------------- *
+ *               Lossless transforms of jpeg data                  *
+ * --------------------------------------------------------------- */
+/*! Jpeg Transforms */
+/* The rotations are clockwise, with the same values as in pixRotateOrth() */
+enum {
+    L_JPEG_NO_TRANSFORM = 0,      /*!< no change, except for cropping   */
+    L_JPEG_ROTATE_90 = 1,         /*!< rotate by 90 degrees             */
+    L_JPEG_ROTATE_180 = 2,        /*!< rotate by 180 degrees            */
+    L_JPEG_ROTATE_270 = 3,        /*!< rotate by 270 degrees            */
+    L_JPEG_FLIP_LR = 4,           /*!< flip about the vertical axis     */
+    L_JPEG_FLIP_TB = 5            /*!< flip about the horizontal axis   */
+};
+
+
+/* --------------------------------------------------------------- *
+ *                     Presets for writing png                     *
+ * --------------------------------------------------------------- */
+/*! Png Write Presets */
+/* The row filters are chosen for the image type in each preset */
+enum {
+    L_PNG_WRITE_DEFAULT = 0,      /*!< libpng defaults; zlib level 6     */
+    L_PNG_WRITE_FASTEST = 1,      /*!< fastest encoding; larger files    */
+    L_PNG_WRITE_BALANCED = 2,     /*!< about default size; twice as fast */
+    L_PNG_WRITE_SMALLEST = 3      /*!< smallest files; slowest encoding  */
+};
+
+
+/* --------------------------------------------------------------- *
+ *                  Reading and writing tiff by bands              *
+ * --------------------------------------------------------------- */
+/*! Tiff band reader and writer; the structs are in tiffio.c */
+typedef struct L_TiffReader  L_TIFF_READER;
+typedef struct L_TiffWriter  L_TIFF_WRITER;
+
+/*! Function applied to each band in tiffProcessBands() */
+typedef struct Pix *(*tiffBandHandler_f)(struct Pix *pixs, l_int32 y,
+                                         void *userdata);
+
+
+/* --------------------------------------------------------------- *
+ *          Page index for random access to multipage tiff         *
+ * --------------------------------------------------------------- */
+/*! Tiff page index; the struct is in tiffio.c */
+typedef struct L_TiffIndex  L_TIFF_INDEX;
+
+#define  TIFF_INDEX_VERSION_NUMBER    1  /*!< Version for tiff index */
+
+
 /* --------------------------------------------------------------- *
  *                            Jp2k codecs                          *
  * --------------------------------------------------------------- */
@@ -247,4 +296,11 @@ struct L_Pdf_Data
 };
 typedef struct L_Pdf_Data  L_PDF_DATA;
 
+
+/* ------------------------------------------------------------------------- *
+ *                     Streaming multipage pdf writer                        *
+ * ------------------------------------------------------------------------- */
+/*! Pdf writer for adding one page at a time; the struct is in pdfio2.c */
+typedef struct L_PdfWriter  L_PDF_WRITER;
+
 #endif  /* LEPTONICA_IMAGEIO_H */
@@ -0,0 +1,633 @@
+/*====================================================================*
+ -  Copyright (C) 2001 Leptonica.  All rights reserved.
+ -
+ -  Redistribution and use in source and binary forms, with or without
+ -  modification, are permitted provided that the following conditions
+ -  are met:
+ -  1. Redistributions of source code must retain the above copyright
+ -     notice, this list of conditions and the following disclaimer.
+ -  2. Redistributions in binary form must reproduce the above
+ -     copyright notice, this list of conditions and the following
+ -     disclaimer in the documentation and/or other materials
+ -     provided with the distribution.
+ -
+ -  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ -  ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ -  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ -  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL ANY
+ -  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ -  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ -  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ -  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ -  OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ -  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ -  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *====================================================================*/
+
+/*!
+ * \file integral.c
+ * <pre>
+ *
+ *      Create/Destroy
+ *          L_INTEGRAL   *integralCreate()
+ *          void          integralDestroy()
+ *
+ *      Accessors
+ *          l_ok          integralGetDimensions()
+ *
+ *      Sums and statistics in a rectangle
+ *          l_ok          integralGetRectSums()
+ *          l_ok          integralMeanInRectangle()
+ *          l_ok          integralVarianceInRectangle()
+ *
+ *      Windowed statistics and block convolution
+ *          PIX          *integralWindowedMean()
+ *          PIX          *integralWindowedMeanSquare()
+ *          PIX          *integralBlockconv()
+ *
+ *  The integral image (summed-area table) of a pix holds, for each
+ *  location, the sum of all pixels above and to the left.  The sum
+ *  over any rectangle is then found from 4 values in the table.
+ *  Several operations use it: windowed mean and variance
+ *  (pixWindowedMean(), pixWindowedMeanSquare()), Sauvola binarization,
+ *  quadtree statistics, and block convolution.  Each of these
+ *  otherwise makes its own accumulators.  By making an L_INTEGRAL
+ *  once and passing it to
+ *          integralWindowedMean()
+ *          integralWindowedMeanSquare()
+ *          integralBlockconv()
+ *          integralQuadtreeMean()           (quadtree.c)
+ *          integralQuadtreeVariance()       (quadtree.c)
+ *          pixSauvolaBinarizeIntegral()     (binarize.c)
+ *  a sequence of operations on the same image builds the tables once.
+ *
+ *  As in pixBlockconvAccum(), the sums are held in 32-bit unsigned
+ *  integers, which wrap around on large images.  Because the sum over
+ *  a rectangle is found from differences of table values, it is still
+ *  exact (modulo 2^32) as long as the sum over the rectangle itself
+ *  is less than 2^32; for 8 bpp, this holds for any rectangle with
+ *  fewer than 2^24 (about 16 million) pixels.  The sums of squares
+ *  are held in 64-bit unsigned integers, which suffice for any
+ *  rectangle.  The tables take 4 bytes for each pixel, or 12 with
+ *  the sums of squares.
+ *
+ *  If compiled with OpenMP, the tables are built, and the windowed
+ *  operations computed, with multiple threads.
+ * </pre>
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config_auto.h>
+#endif  /* HAVE_CONFIG_H */
+
+#include <math.h>
+#include "allheaders.h"
+#include "pix_internal.h"
+
+    /* Number of columns accumulated by each thread when summing the
+     * table down the columns, and minimum number of pixels for which
+     * multiple threads are used. */
+static const l_int32  IntegralStripWidth = 256;
+static const l_int32  IntegralMinParallel = 100000;
+
+
+/*--------------------------------------------------------------------*
+ *                           Create/Destroy                           *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   integralCreate()
+ *
+ * \param[in]    pixs     1 or 8 bpp; no colormap
+ * \param[in]    sqflag   1 to also make the sums of squares; 0 otherwise
+ * \return  ii, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The tables are (w + 1) x (h + 1), with 0 in the first row
+ *          and column.  The sums of squares are required for the
+ *          variance and mean square, and for Sauvola binarization.
+ *      (2) The sums take 4 bytes per pixel and the sums of squares
+ *          take 8.  The sums wrap around modulo 2^32; see the notes
+ *          at the top of this file for when rectangle sums are exact.
+ *      (3) The rows are summed in parallel, and then the columns
+ *          are summed in parallel in vertical strips.
+ * </pre>
+ */
+L_INTEGRAL *
+integralCreate(PIX     *pixs,
+               l_int32  sqflag)
+{
+l_int32      i, j, k, w, h, d, wpl, wpls, val, nstrips, jstart, jend;
+l_uint32    *datas, *lines;
+l_uint32     rsum;
+l_uint32    *line, *linep, *sum;
+l_uint64     rsqsum, npix64, nbytes;
+l_uint64    *sqline, *sqlinep, *sqsum;
+L_INTEGRAL  *ii;
+
+    if (!pixs)
+        return (L_INTEGRAL *)ERROR_PTR("pixs not defined", __func__, NULL);
+    pixGetDimensions(pixs, &w, &h, &d);
+    if (d != 1 && d != 8)
+        return (L_INTEGRAL *)ERROR_PTR("pixs not 1 or 8 bpp", __func__, NULL);
+    if (pixGetColormap(pixs))
+        return (L_INTEGRAL *)ERROR_PTR("pixs has colormap", __func__, NULL);
+    npix64 = (l_uint64)(w + 1) * (l_uint64)(h + 1);
+    nbytes = npix64 * sizeof(l_uint64);
+    if ((size_t)nbytes != nbytes)  /* 32-bit address space */
+        return (L_INTEGRAL *)ERROR_PTR("tables too large", __func__, NULL);
+
+    ii = (L_INTEGRAL *)LEPT_CALLOC(1, sizeof(L_INTEGRAL));
+    ii->w = w;
+    ii->h = h;
+    ii->d = d;
+    ii->wpl = wpl = w + 1;
+    ii->sum = sum = (l_uint32 *)LEPT_CALLOC(npix64, sizeof(l_uint32));
+    sqsum = NULL;
+    if (sqflag)
+        ii->sqsum = sqsum = (l_uint64 *)LEPT_CALLOC(npix64, sizeof(l_uint64));
+    if (!sum || (sqflag && !sqsum)) {
+        integralDestroy(&ii);
+        return (L_INTEGRAL *)ERROR_PTR("tables not made", __func__, NULL);
+    }
+
+        /* Cumulative sums along each row of pixs */
+    datas = pixGetData(pixs);
+    wpls = pixGetWpl(pixs);
+#ifdef _OPENMP
+#pragma omp parallel for private(j, val, rsum, rsqsum, lines, line, sqline) \
+        if ((l_int64)w * h >= IntegralMinParallel)
+#endif  /* _OPENMP */
+    for (i = 0; i < h; i++) {
+        lines = datas + (size_t)i * wpls;
+        line = sum + (size_t)(i + 1) * wpl;
+        sqline = (sqsum) ? sqsum + (size_t)(i + 1) * wpl : NULL;
+        rsum = 0;
+        rsqsum = 0;
+        for (j = 0; j < w; j++) {
+            val = (d == 8) ? GET_DATA_BYTE(lines, j) : GET_DATA_BIT(lines, j);
+            rsum += (l_uint32)val;
+            line[j + 1] = rsum;
+            if (sqline) {
+                rsqsum += (l_uint64)(val * val);
+                sqline[j + 1] = rsqsum;
+            }
+        }
+    }
+
+        /* Cumulative sums down the columns, in vertical strips */
+    nstrips = (w + IntegralStripWidth - 1) / IntegralStripWidth;
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, jstart, jend, line, linep, \
+                                 sqline, sqlinep) \
+        if ((l_int64)w * h >= IntegralMinParallel)
+#endif  /* _OPENMP */
+    for (k = 0; k < nstrips; k++) {
+        jstart = 1 + k * IntegralStripWidth;
+        jend = L_MIN(jstart + IntegralStripWidth, w + 1);
+        for (i = 2; i <= h; i++) {
+            line = sum + (size_t)i * wpl;
+            linep = line - wpl;
+            for (j = jstart; j < jend; j++)
+                line[j] += linep[j];
+            if (sqsum) {
+                sqline = sqsum + (size_t)i * wpl;
+                sqlinep = sqline - wpl;
+                for (j = jstart; j < jend; j++)
+                    sqline[j] += sqlinep[j];
+            }
+        }
+    }
+
+    return ii;
+}
+
+
+/*!
+ * \brief   integralDestroy()
+ *
+ * \param[in,out]   pii    will be set to null before returning
+ * \return  void
+ */
+void
+integralDestroy(L_INTEGRAL  **pii)
+{
+L_INTEGRAL  *ii;
+
+    if (!pii) {
+        L_WARNING("ptr address is null!\n", __func__);
+        return;
+    }
+    if ((ii = *pii) == NULL)
+        return;
+
+    LEPT_FREE(ii->sum);
+    LEPT_FREE(ii->sqsum);
+    LEPT_FREE(ii);
+    *pii = NULL;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                              Accessors                             *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   integralGetDimensions()
+ *
+ * \param[in]    ii
+ * \param[out]   pw, ph, pd [optional] size and depth of the source pix
+ * \param[out]   phassq     [optional] 1 if it has sums of squares
+ * \return  0 if OK, 1 on error
+ */
+l_ok
+integralGetDimensions(L_INTEGRAL  *ii,
+                      l_int32     *pw,
+                      l_int32     *ph,
+                      l_int32     *pd,
+                      l_int32     *phassq)
+{
+    if (pw) *pw = 0;
+    if (ph) *ph = 0;
+    if (pd) *pd = 0;
+    if (phassq) *phassq = 0;
+    if (!ii)
+        return ERROR_INT("ii not defined", __func__, 1);
+    if (pw) *pw = ii->w;
+    if (ph) *ph = ii->h;
+    if (pd) *pd = ii->d;
+    if (phassq) *phassq = (ii->sqsum) ? 1 : 0;
+    return 0;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                 Sums and statistics in a rectangle                 *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   integralGetRectSums()
+ *
+ * \param[in]    ii
+ * \param[in]    x, y, w, h   rectangle; must be within the source pix
+ * \param[out]   psum         [optional] sum of pixels in rectangle
+ * \param[out]   psqsum       [optional] sum of squares of pixels
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This takes O(1) time, independent of the rectangle size.
+ *      (2) The sum of squares is only available if %ii was made
+ *          with %sqflag = 1.
+ *      (3) The sum is exact if it is less than 2^32; otherwise it is
+ *          the true sum modulo 2^32.
+ * </pre>
+ */
+l_ok
+integralGetRectSums(L_INTEGRAL  *ii,
+                    l_int32      x,
+                    l_int32      y,
+                    l_int32      w,
+                    l_int32      h,
+                    l_uint32    *psum,
+                    l_uint64    *psqsum)
+{
+size_t  i1, i2;
+
+    if (psum) *psum = 0;
+    if (psqsum) *psqsum = 0;
+    if (!psum && !psqsum)
+        return ERROR_INT("no output requested", __func__, 1);
+    if (!ii)
+        return ERROR_INT("ii not defined", __func__, 1);
+    if (x < 0 || y < 0 || w <= 0 || h <= 0 ||
+        x + w > ii->w || y + h > ii->h)
+        return ERROR_INT("rectangle not within image", __func__, 1);
+    if (psqsum && !ii->sqsum)
+        return ERROR_INT("no sums of squares", __func__, 1);
+
+    i1 = (size_t)y * ii->wpl + x;
+    i2 = (size_t)(y + h) * ii->wpl + x;
+    if (psum) {
+        *psum = ii->sum[i2 + w] - ii->sum[i2] -
+                ii->sum[i1 + w] + ii->sum[i1];
+    }
+    if (psqsum) {
+        *psqsum = ii->sqsum[i2 + w] - ii->sqsum[i2] -
+                  ii->sqsum[i1 + w] + ii->sqsum[i1];
+    }
+    return 0;
+}
+
+
+/*!
+ * \brief   integralMeanInRectangle()
+ *
+ * \param[in]    ii
+ * \param[in]    box      region to compute mean value
+ * \param[out]   pval     mean value
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The box is clipped to the image.  This gives the same
+ *          result as pixMeanInRectangle().
+ * </pre>
+ */
+l_ok
+integralMeanInRectangle(L_INTEGRAL  *ii,
+                        BOX         *box,
+                        l_float32   *pval)
+{
+l_int32    bx, by, bw, bh;
+l_uint32   sum;
+l_float32  norm;
+BOX       *boxc;
+
+    if (!pval)
+        return ERROR_INT("&val not defined", __func__, 1);
+    *pval = 0.0;
+    if (!ii)
+        return ERROR_INT("ii not defined", __func__, 1);
+    if (!box)
+        return ERROR_INT("box not defined", __func__, 1);
+
+    if ((boxc = boxClipToRectangle(box, ii->w, ii->h)) == NULL)
+        return ERROR_INT("no pixels in box", __func__, 1);
+    boxGetGeometry(boxc, &bx, &by, &bw, &bh);
+    boxDestroy(&boxc);
+    if (bw == 0 || bh == 0)
+        return ERROR_INT("no pixels in box", __func__, 1);
+
+    integralGetRectSums(ii, bx, by, bw, bh, &sum, NULL);
+    norm = 1.0f / ((l_float32)(bw) * bh);
+    *pval = norm * sum;
+    return 0;
+}
+
+
+/*!
+ * \brief   integralVarianceInRectangle()
+ *
+ * \param[in]    ii       made with sums of squares
+ * \param[in]    box      region to compute variance and/or root variance
+ * \param[out]   pvar     [optional] variance
+ * \param[out]   prvar    [optional] root variance
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The box is clipped to the image.  This gives the same
+ *          result as pixVarianceInRectangle().
+ * </pre>
+ */
+l_ok
+integralVarianceInRectangle(L_INTEGRAL  *ii,
+                            BOX         *box,
+                            l_float32   *pvar,
+                            l_float32   *prvar)
+{
+l_int32    bx, by, bw, bh;
+l_uint32   sum;
+l_uint64   sqsum;
+l_float64  mval, msval, var, norm;
+BOX       *boxc;
+
+    if (!pvar && !prvar)
+        return ERROR_INT("neither &var nor &rvar defined", __func__, 1);
+    if (pvar) *pvar = 0.0;
+    if (prvar) *prvar = 0.0;
+    if (!ii)
+        return ERROR_INT("ii not defined", __func__, 1);
+    if (!ii->sqsum)
+        return ERROR_INT("ii has no sums of squares", __func__, 1);
+    if (!box)
+        return ERROR_INT("box not defined", __func__, 1);
+
+    if ((boxc = boxClipToRectangle(box, ii->w, ii->h)) == NULL)
+        return ERROR_INT("no pixels in box", __func__, 1);
+    boxGetGeometry(boxc, &bx, &by, &bw, &bh);
+    boxDestroy(&boxc);
+    if (bw == 0 || bh == 0)
+        return ERROR_INT("no pixels in box", __func__, 1);
+
+    integralGetRectSums(ii, bx, by, bw, bh, &sum, &sqsum);
+    norm = 1.0 / ((l_float32)(bw) * bh);
+    mval = norm * sum;
+    msval = norm * (l_float64)sqsum;
+    var = (msval - mval * mval);
+    if (pvar) *pvar = (l_float32)var;
+    if (prvar) *prvar = (l_float32)(sqrt(var));
+    return 0;
+}
+
+
+/*--------------------------------------------------------------------*
+ *             Windowed statistics and block convolution              *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   integralWindowedMean()
+ *
+ * \param[in]    ii         made from an 8 bpp pix with a border
+ * \param[in]    wc, hc     half width/height of convolution kernel
+ * \param[in]    normflag   1 for normalization to get average in window;
+ *                          0 for the sum in the window (un-normalized)
+ * \return  pixd 8 bpp if normalized; 32 bpp otherwise; or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The source pix is assumed to have a border of (%wc + 1)
+ *          pixels on the left and right, and (%hc + 1) on the top and
+ *          bottom.  The output has this border removed.  With
+ *          %normflag = 1, this is the same as pixWindowedMean() with
+ *          %hasborder = 1.
+ *      (2) The window is (2 * %wc + 1) x (2 * %hc + 1), centered
+ *          on each output pixel.
+ * </pre>
+ */
+PIX *
+integralWindowedMean(L_INTEGRAL  *ii,
+                     l_int32      wc,
+                     l_int32      hc,
+                     l_int32      normflag)
+{
+l_int32    i, j, wd, hd, wpl, wpld, wincr, hincr;
+l_uint32   val;
+l_uint32  *line1, *line2, *datad, *lined;
+l_float32  norm;
+PIX       *pixd;
+
+    if (!ii)
+        return (PIX *)ERROR_PTR("ii not defined", __func__, NULL);
+    if (ii->d != 8)
+        return (PIX *)ERROR_PTR("source not 8 bpp", __func__, NULL);
+    if (wc < 2 || hc < 2)
+        return (PIX *)ERROR_PTR("wc and hc not >= 2", __func__, NULL);
+
+    wd = ii->w - 2 * (wc + 1);
+    hd = ii->h - 2 * (hc + 1);
+    if (wd < 2 || hd < 2)
+        return (PIX *)ERROR_PTR("w or h too small for kernel", __func__, NULL);
+    if ((pixd = pixCreate(wd, hd, (normflag) ? 8 : 32)) == NULL)
+        return (PIX *)ERROR_PTR("pixd not made", __func__, NULL);
+    wpld = pixGetWpl(pixd);
+    datad = pixGetData(pixd);
+    wpl = ii->wpl;
+
+    wincr = 2 * wc + 1;
+    hincr = 2 * hc + 1;
+    norm = 1.0f / ((l_float32)(wincr) * hincr);
+#ifdef _OPENMP
+#pragma omp parallel for private(j, val, line1, line2, lined) \
+        if ((l_int64)wd * hd >= IntegralMinParallel)
+#endif  /* _OPENMP */
+    for (i = 0; i < hd; i++) {
+        line1 = ii->sum + (size_t)(i + 1) * wpl + 1;
+        line2 = line1 + (size_t)hincr * wpl;
+        lined = datad + (size_t)i * wpld;
+        for (j = 0; j < wd; j++) {
+            val = line2[j + wincr] - line2[j] - line1[j + wincr] + line1[j];
+            if (normflag)
+                SET_DATA_BYTE(lined, j, (l_uint8)(norm * val));
+            else
+                lined[j] = val;
+        }
+    }
+
+    return pixd;
+}
+
+
+/*!
+ * \brief   integralWindowedMeanSquare()
+ *
+ * \param[in]    ii         made from an 8 bpp pix with a border,
+ *                          with sums of squares
+ * \param[in]    wc, hc     half width/height of convolution kernel
+ * \return  pixd 32 bpp, average over window of squared value,
+ *                or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) As with integralWindowedMean(), the source pix is assumed to
+ *          have a border of (%wc + 1) pixels on the left and right, and
+ *          (%hc + 1) on the top and bottom, which is removed.  This is
+ *          the same as pixWindowedMeanSquare() with %hasborder = 1.
+ * </pre>
+ */
+PIX *
+integralWindowedMeanSquare(L_INTEGRAL  *ii,
+                           l_int32      wc,
+                           l_int32      hc)
+{
+l_int32    i, j, wd, hd, wpl, wpld, wincr, hincr;
+l_uint64   val;
+l_uint64  *line1, *line2;
+l_uint32  *datad, *lined;
+l_float64  norm;
+PIX       *pixd;
+
+    if (!ii)
+        return (PIX *)ERROR_PTR("ii not defined", __func__, NULL);
+    if (ii->d != 8)
+        return (PIX *)ERROR_PTR("source not 8 bpp", __func__, NULL);
+    if (!ii->sqsum)
+        return (PIX *)ERROR_PTR("ii has no sums of squares", __func__, NULL);
+    if (wc < 2 || hc < 2)
+        return (PIX *)ERROR_PTR("wc and hc not >= 2", __func__, NULL);
+
+    wd = ii->w - 2 * (wc + 1);
+    hd = ii->h - 2 * (hc + 1);
+    if (wd < 2 || hd < 2)
+        return (PIX *)ERROR_PTR("w or h too small for kernel", __func__, NULL);
+    if ((pixd = pixCreate(wd, hd, 32)) == NULL)
+        return (PIX *)ERROR_PTR("pixd not made", __func__, NULL);
+    wpld = pixGetWpl(pixd);
+    datad = pixGetData(pixd);
+    wpl = ii->wpl;
+
+    wincr = 2 * wc + 1;
+    hincr = 2 * hc + 1;
+    norm = 1.0 / ((l_float32)(wincr) * hincr);
+#ifdef _OPENMP
+#pragma omp parallel for private(j, val, line1, line2, lined) \
+        if ((l_int64)wd * hd >= IntegralMinParallel)
+#endif  /* _OPENMP */
+    for (i = 0; i < hd; i++) {
+        line1 = ii->sqsum + (size_t)(i + 1) * wpl + 1;
+        line2 = line1 + (size_t)hincr * wpl;
+        lined = datad + (size_t)i * wpld;
+        for (j = 0; j < wd; j++) {
+            val = line2[j + wincr] - line2[j] - line1[j + wincr] + line1[j];
+            lined[j] = (l_uint32)(norm * (l_float64)val + 0.5);
+        }
+    }
+
+    return pixd;
+}
+
+
+/*!
+ * \brief   integralBlockconv()
+ *
+ * \param[in]    ii         made from an 8 bpp pix
+ * \param[in]    wc, hc     half width/height of convolution kernel
+ * \return  pixd 8 bpp, same size as the source, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is a block convolution with a (2 * %wc + 1) x
+ *          (2 * %hc + 1) window.  Unlike integralWindowedMean(), no
+ *          border is assumed: near the image boundary the window is
+ *          clipped to the image and the average is over the pixels
+ *          in the clipped window.
+ *      (2) Results are rounded to the nearest integer.
+ * </pre>
+ */
+PIX *
+integralBlockconv(L_INTEGRAL  *ii,
+                  l_int32      wc,
+                  l_int32      hc)
+{
+l_int32    i, j, w, h, wpl, wpld, x0, x1, y0, y1;
+l_uint32   val;
+l_uint32  *line1, *line2, *datad, *lined;
+l_float32  normy;
+PIX       *pixd;
+
+    if (!ii)
+        return (PIX *)ERROR_PTR("ii not defined", __func__, NULL);
+    if (ii->d != 8)
+        return (PIX *)ERROR_PTR("source not 8 bpp", __func__, NULL);
+    if (wc < 0 || hc < 0)
+        return (PIX *)ERROR_PTR("wc and hc not >= 0", __func__, NULL);
+
+    w = ii->w;
+    h = ii->h;
+    if ((pixd = pixCreate(w, h, 8)) == NULL)
+        return (PIX *)ERROR_PTR("pixd not made", __func__, NULL);
+    wpld = pixGetWpl(pixd);
+    datad = pixGetData(pixd);
+    wpl = ii->wpl;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(j, val, x0, x1, y0, y1, normy, \
+                                 line1, line2, lined) \
+        if ((l_int64)w * h >= IntegralMinParallel)
+#endif  /* _OPENMP */
+    for (i = 0; i < h; i++) {
+        y0 = L_MAX(0, i - hc);
+        y1 = L_MIN(h, i + hc + 1);
+        normy = 1.0f / (l_float32)(y1 - y0);
+        line1 = ii->sum + (size_t)y0 * wpl;
+        line2 = ii->sum + (size_t)y1 * wpl;
+        lined = datad + (size_t)i * wpld;
+        for (j = 0; j < w; j++) {
+            x0 = L_MAX(0, j - wc);
+            x1 = L_MIN(w, j + wc + 1);
+            val = line2[x1] - line2[x0] - line1[x1] + line1[x0];
+            val = (l_uint32)(normy * val / (l_float32)(x1 - x0) + 0.5f);
+            SET_DATA_BYTE(lined, j, L_MIN(val, 255));
+        }
+    }
+
+    return pixd;
+}
@@ -31,6 +31,8 @@
  *    Read jpeg from file
  *          PIX             *pixReadJpeg()  [special top level]
  *          PIX             *pixReadStreamJpeg()
+ *          PIX             *pixReadJpegRegion()
+ *          PIX             *pixReadStreamJpegRegion()
  *
  *    Read jpeg metadata from file
  *          l_int32          readHeaderJpeg()
@@ -44,10 +46,17 @@
  *
  *    Read/write to memory
  *          PIX             *pixReadMemJpeg()
+ *          PIX             *pixReadMemJpegRegion()
  *          l_int32          readHeaderMemJpeg()
  *          l_int32          readResolutionMemJpeg()
  *          l_int32          pixWriteMemJpeg()
  *
+ *    Lossless transforms of jpeg data
+ *          l_int32          jpegTransformFile()
+ *          l_int32          jpegTransformStream()
+ *          l_int32          jpegTransformMem()
+ *          l_int32          jpegCheckTransformMem()
+ *
  *    Setting special flag for chroma sampling on write
  *          l_int32          pixSetChromaSampling()
  *
@@ -56,6 +65,9 @@
  *          static void      jpeg_error_catch_all_2()
  *          static l_uint8   jpeg_getc()
  *          static l_int32   jpeg_comment_callback()
+ *          static l_int32   jpegFindTransformRegion()
+ *          static void      jpegTransformBlock()
+ *          static void      jpegCopyMarkers()
  *
  *    Documentation: libjpeg.doc can be found, along with all
  *    source code, at ftp://ftp.uu.net/graphics/jpeg
@@ -103,6 +115,26 @@
  *    can extract just the 8 bpp luminance channel, using pixReadJpeg(),
  *    where you use L_JPEG_READ_LUMINANCE for the %hint arg.
  *
+ *    How to decode only a region of the image
+ *    ----------------------------------------
+ *    To read a rectangular region, such as a barcode zone or a column
+ *    of text, use pixReadJpegRegion() or pixReadMemJpegRegion().  With
+ *    libjpeg-turbo, rows above the region are skipped without color
+ *    conversion and upsampling, only the iMCU columns that intersect
+ *    the region are decoded, and decoding stops after the last row of
+ *    the region.  With other versions of libjpeg, the rows above the
+ *    region are decoded and discarded, but decoding still stops at
+ *    the bottom of the region.  These can be combined with reduction
+ *    by 2, 4 or 8, which is done in the IDCT.
+ *
+ *    How to rotate, flip or crop without recompression
+ *    --------------------------------------------------
+ *    jpegTransformMem() and jpegTransformFile() do orthogonal rotations,
+ *    flips and iMCU-aligned crops by rearranging the DCT coefficients,
+ *    so the image quality is unchanged and no pixels are decoded.
+ *    Edges that are moved to the top or left must be aligned to the
+ *    iMCU size; use jpegCheckTransformMem() to find if this is so.
+ *
  *    How to continue to read if the data is corrupted
  *    ------------------------------------------------
  *    By default, if data is corrupted we make every effort to fail
@@ -146,6 +178,15 @@
 static void jpeg_error_catch_all_1(j_common_ptr cinfo);
 static void jpeg_error_catch_all_2(j_common_ptr cinfo);
 static l_uint8 jpeg_getc(j_decompress_ptr cinfo);
+static l_int32 jpegFindTransformRegion(j_decompress_ptr cinfo,
+                                       l_int32 transform, BOX *box,
+                                       l_int32 *px0, l_int32 *py0,
+                                       l_int32 *pcw, l_int32 *pch,
+                                       l_int32 *plossless);
+static void jpegTransformBlock(JCOEFPTR src, JCOEFPTR dst,
+                               l_int32 transform);
+static void jpegCopyMarkers(j_decompress_ptr srcinfo,
+                            j_compress_ptr dstinfo);
 
     /* Note: 'boolean' is defined in jmorecfg.h.  We use it explicitly
      * here because for Windows where __MINGW32__ is defined,
@@ -165,6 +206,15 @@ struct callback_data {
 #define  DEBUG_INFO      0
 #endif  /* ~NO_CONSOLE_IO */
 
+    /* libjpeg-turbo 1.5 and later can skip scanlines and decode
+     * a subset of the iMCU columns */
+#if defined(LIBJPEG_TURBO_VERSION_NUMBER) && \
+    LIBJPEG_TURBO_VERSION_NUMBER >= 1005000
+#define  L_JPEG_CAN_CROP   1
+#else
+#define  L_JPEG_CAN_CROP   0
+#endif
+
 
 /*---------------------------------------------------------------------*
  *                 Read jpeg from file (special function)              *
@@ -267,15 +317,122 @@ pixReadStreamJpeg(FILE     *fp,
                   l_int32   reduction,
                   l_int32  *pnwarn,
                   l_int32   hint)
+{
+    return pixReadStreamJpegRegion(fp, NULL, cmapflag, reduction,
+                                   pnwarn, hint);
+}
+
+
+/*!
+ * \brief   pixReadJpegRegion()
+ *
+ * \param[in]    filename
+ * \param[in]    box        [optional] region to read, in full resolution
+ *                          coordinates; use NULL for the entire image
+ * \param[in]    cmapflag   0 for no colormap in returned pix;
+ *                          1 to return an 8 bpp cmapped pix if spp = 3 or 4
+ * \param[in]    reduction  scaling factor: 1, 2, 4 or 8
+ * \param[out]   pnwarn     [optional] number of warnings about
+ *                          corrupted data
+ * \param[in]    hint       a bitwise OR of L_JPEG_* values; 0 for default
+ * \return  pix, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This returns the part of the image in %box, decoding as
+ *          little of the jpeg data as possible.  The box is clipped
+ *          to the image.  See pixReadStreamJpegRegion() for details.
+ *      (2) The other args are used as in pixReadJpeg().
+ * </pre>
+ */
+PIX *
+pixReadJpegRegion(const char  *filename,
+                  BOX         *box,
+                  l_int32      cmapflag,
+                  l_int32      reduction,
+                  l_int32     *pnwarn,
+                  l_int32      hint)
+{
+l_int32   ret;
+l_uint8  *comment;
+FILE     *fp;
+PIX      *pix;
+
+    if (pnwarn) *pnwarn = 0;
+    if (!filename)
+        return (PIX *)ERROR_PTR("filename not defined", __func__, NULL);
+
+    if ((fp = fopenReadStream(filename)) == NULL)
+        return (PIX *)ERROR_PTR_1("image file not found",
+                                  filename, __func__, NULL);
+    pix = pixReadStreamJpegRegion(fp, box, cmapflag, reduction, pnwarn, hint);
+    if (pix) {
+        ret = fgetJpegComment(fp, &comment);
+        if (!ret && comment)
+            pixSetText(pix, (char *)comment);
+        LEPT_FREE(comment);
+    }
+    fclose(fp);
+
+    if (!pix)
+        return (PIX *)ERROR_PTR_1("image not returned",
+                                  filename, __func__, NULL);
+    return pix;
+}
+
+
+/*!
+ * \brief   pixReadStreamJpegRegion()
+ *
+ * \param[in]    fp         file stream
+ * \param[in]    box        [optional] region to read, in full resolution
+ *                          coordinates; use NULL for the entire image
+ * \param[in]    cmapflag   0 for no colormap in returned pix;
+ *                          1 to return an 8 bpp cmapped pix if spp = 3 or 4
+ * \param[in]    reduction  scaling factor: 1, 2, 4 or 8
+ * \param[out]   pnwarn     [optional] number of warnings
+ * \param[in]    hint       a bitwise OR of L_JPEG_* values; 0 for default
+ * \return  pix, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The box is given in the coordinates of the full resolution
+ *          image, and is clipped to it.  With %reduction > 1, the box
+ *          is scaled down, rounding its sides outward, so the result
+ *          covers all of the requested region.  It is an error if the
+ *          box does not intersect the image.
+ *      (2) The pixels are identical to those in the same region of the
+ *          image returned by pixReadStreamJpeg() with the same
+ *          %reduction, except for a colormapped result: when a box is
+ *          given and %cmapflag == 1, the color region is decoded to
+ *          RGB and then quantized with pixConvertRGBToColormap(),
+ *          because libjpeg can only quantize the full image.
+ *      (3) Rows below the region are never decoded.  With libjpeg-turbo,
+ *          rows above the region are skipped with jpeg_skip_scanlines()
+ *          and the columns are limited with jpeg_crop_scanline(), which
+ *          decodes only the iMCU columns that intersect the region.
+ *      (4) The jpeg comment, if it exists, is not stored in the pix.
+ * </pre>
+ */
+PIX *
+pixReadStreamJpegRegion(FILE     *fp,
+                        BOX      *box,
+                        l_int32   cmapflag,
+                        l_int32   reduction,
+                        l_int32  *pnwarn,
+                        l_int32   hint)
 {
 l_int32                        cyan, yellow, magenta, black, nwarn;
 l_int32                        i, j, k, rval, gval, bval;
 l_int32                        nlinesread, abort_on_warning;
 l_int32                        w, h, wpl, spp, ncolors, cindex, ycck, cmyk;
+l_int32                        bx, by, bxend, byend, x0, y0, xshift, imcuw;
+l_int32                        requant;
 l_uint32                      *data;
 l_uint32                      *line, *ppixel;
 JSAMPROW                       rowbuffer;
-PIX                           *pix;
+JDIMENSION                     xoff, cropw;
+PIX                           *pix, *pix1;
 PIXCMAP                       *cmap;
 struct jpeg_decompress_struct  cinfo = { 0 };
 struct jpeg_error_mgr          jerr = { 0 };
@@ -322,9 +479,20 @@ jmp_buf                        jmpbuf;  /* must be local to the function */
         spp = cinfo.out_color_components;
     }
 
+        /* Find the region in the (possibly reduced) output image */
+    if (boxClipToRectangleParams(box, cinfo.image_width, cinfo.image_height,
+                                 &bx, &by, &bxend, &byend, NULL, NULL)) {
+        jpeg_destroy_decompress(&cinfo);
+        return (PIX *)ERROR_PTR("invalid box", __func__, NULL);
+    }
+    x0 = bx / reduction;
+    y0 = by / reduction;
+    w = L_MIN((bxend + reduction - 1) / reduction, cinfo.output_width) - x0;
+    h = L_MIN((byend + reduction - 1) / reduction, cinfo.output_height) - y0;
+    requant = (box && cmapflag == 1 && spp != 1);
+    if (requant) cmapflag = 0;
+
         /* Allocate the image and a row buffer */
-    w = cinfo.output_width;
-    h = cinfo.output_height;
     ycck = (cinfo.jpeg_color_space == JCS_YCCK && spp == 4 && cmapflag == 0);
     cmyk = (cinfo.jpeg_color_space == JCS_CMYK && spp == 4 && cmapflag == 0);
     if (spp != 1 && spp != 3 && !ycck && !cmyk) {
@@ -333,10 +501,11 @@ jmp_buf                        jmpbuf;  /* must be local to the function */
                                 __func__, NULL);
     }
     if ((spp == 3 && cmapflag == 0) || ycck || cmyk) {  /* rgb or 4 bpp color */
-        rowbuffer = (JSAMPROW)LEPT_CALLOC(sizeof(JSAMPLE), (size_t)spp * w);
+        rowbuffer = (JSAMPROW)LEPT_CALLOC(sizeof(JSAMPLE),
+                                          (size_t)spp * cinfo.output_width);
         pix = pixCreate(w, h, 32);
     } else {  /* 8 bpp gray or colormapped */
-        rowbuffer = (JSAMPROW)LEPT_CALLOC(sizeof(JSAMPLE), w);
+        rowbuffer = (JSAMPROW)LEPT_CALLOC(sizeof(JSAMPLE), cinfo.output_width);
         pix = pixCreate(w, h, 8);
     }
     if (!rowbuffer || !pix) {
@@ -381,6 +550,31 @@ jmp_buf                        jmpbuf;  /* must be local to the function */
     wpl  = pixGetWpl(pix);
     data = pixGetData(pix);
 
+        /* Go to the first row and column of the region.  The cropped
+         * scanline starts at an iMCU boundary to the left of %x0,
+         * and %xshift is the offset of %x0 in the row buffer.  The
+         * upsampled chroma at either end of a cropped scanline is
+         * computed as if it were at the image boundary, so the crop
+         * is extended to have at least one column on the left and
+         * one iMCU on the right beyond the region.  */
+    xshift = x0;
+    if (box) {
+#if L_JPEG_CAN_CROP
+        imcuw = cinfo.max_h_samp_factor * DCTSIZE / reduction;
+        xoff = L_MAX(0, x0 - 1);
+        cropw = L_MIN(x0 + w + imcuw, (l_int32)cinfo.output_width) - xoff;
+        if (cropw < cinfo.output_width) {
+            jpeg_crop_scanline(&cinfo, &xoff, &cropw);
+            xshift = x0 - (l_int32)xoff;
+        }
+        if (y0 > 0)
+            jpeg_skip_scanlines(&cinfo, (JDIMENSION)y0);
+#else
+        for (i = 0; i < y0; i++)
+            jpeg_read_scanlines(&cinfo, &rowbuffer, (JDIMENSION)1);
+#endif  /* L_JPEG_CAN_CROP */
+    }
+
         /* Decompress.  It appears that jpeg_read_scanlines() always
          * returns 1 when you ask for one scanline, but we test anyway.
          * During decoding of scanlines, warnings are issued if corrupted
@@ -396,7 +590,7 @@ jmp_buf                        jmpbuf;  /* must be local to the function */
         nwarn = cinfo.err->num_warnings;
         if (nlinesread == 0 || (abort_on_warning && nwarn > 0)) {
             L_ERROR("read error at scanline %d; nwarn = %d\n",
-                    __func__, i, nwarn);
+                    __func__, y0 + i, nwarn);
             pixDestroy(&pix);
             jpeg_destroy_decompress(&cinfo);
             LEPT_FREE(rowbuffer);
@@ -409,7 +603,7 @@ jmp_buf                        jmpbuf;  /* must be local to the function */
         if ((spp == 3 && cmapflag == 0) || ycck || cmyk) {
             ppixel = data + i * wpl;
             if (spp == 3) {
-                for (j = k = 0; j < w; j++) {
+                for (j = 0, k = 3 * xshift; j < w; j++) {
                     SET_DATA_BYTE(ppixel, COLOR_RED, rowbuffer[k++]);
                     SET_DATA_BYTE(ppixel, COLOR_GREEN, rowbuffer[k++]);
                     SET_DATA_BYTE(ppixel, COLOR_BLUE, rowbuffer[k++]);
@@ -437,7 +631,7 @@ jmp_buf                        jmpbuf;  /* must be local to the function */
                        where they've already inverted the CMY but not
                        the K, we have to invert again.  The results
                        must be clipped to [0 ... 255]. */
-                for (j = k = 0; j < w; j++) {
+                for (j = 0, k = 4 * xshift; j < w; j++) {
                     cyan = rowbuffer[k++];
                     magenta = rowbuffer[k++];
                     yellow = rowbuffer[k++];
@@ -461,7 +655,7 @@ jmp_buf                        jmpbuf;  /* must be local to the function */
         } else {    /* 8 bpp grayscale or colormapped pix */
             line = data + i * wpl;
             for (j = 0; j < w; j++)
-                SET_DATA_BYTE(line, j, rowbuffer[j]);
+                SET_DATA_BYTE(line, j, rowbuffer[j + xshift]);
         }
     }
 
@@ -479,13 +673,23 @@ jmp_buf                        jmpbuf;  /* must be local to the function */
         lept_stderr("output spp = %d, spp = %d\n",
                     cinfo.output_components, spp);
 
-    jpeg_finish_decompress(&cinfo);
+        /* The rows below the region are not decoded */
+    if (cinfo.output_scanline < cinfo.output_height)
+        jpeg_abort_decompress(&cinfo);
+    else
+        jpeg_finish_decompress(&cinfo);
     jpeg_destroy_decompress(&cinfo);
     LEPT_FREE(rowbuffer);
     rowbuffer = NULL;
     if (pnwarn) *pnwarn = nwarn;
     if (nwarn > 0)
         L_WARNING("%d warning(s) of bad data\n", __func__, nwarn);
+
+    if (requant) {
+        pix1 = pixConvertRGBToColormap(pix, 1);
+        pixDestroy(&pix);
+        pix = pix1;
+    }
     return pix;
 }
 
@@ -1017,6 +1221,61 @@ PIX      *pix;
 }
 
 
+/*!
+ * \brief   pixReadMemJpegRegion()
+ *
+ * \param[in]    data       const; jpeg-encoded
+ * \param[in]    size       of data
+ * \param[in]    box        [optional] region to read, in full resolution
+ *                          coordinates; use NULL for the entire image
+ * \param[in]    cmflag     colormap flag 0 means return RGB image if color;
+ *                          1 means create a colormap and return
+ *                          an 8 bpp colormapped image if color
+ * \param[in]    reduction  scaling factor: 1, 2, 4 or 8
+ * \param[out]   pnwarn     [optional] number of warnings
+ * \param[in]    hint       a bitwise OR of L_JPEG_* values; 0 for default
+ * \return  pix, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) See pixReadStreamJpegRegion() for usage.  This version reads
+ *          from memory instead of from a file stream.
+ * </pre>
+ */
+PIX *
+pixReadMemJpegRegion(const l_uint8  *data,
+                     size_t          size,
+                     BOX            *box,
+                     l_int32         cmflag,
+                     l_int32         reduction,
+                     l_int32        *pnwarn,
+                     l_int32         hint)
+{
+l_int32   ret;
+l_uint8  *comment;
+FILE     *fp;
+PIX      *pix;
+
+    if (pnwarn) *pnwarn = 0;
+    if (!data)
+        return (PIX *)ERROR_PTR("data not defined", __func__, NULL);
+
+    if ((fp = fopenReadFromMemory(data, size)) == NULL)
+        return (PIX *)ERROR_PTR("stream not opened", __func__, NULL);
+    pix = pixReadStreamJpegRegion(fp, box, cmflag, reduction, pnwarn, hint);
+    if (pix) {
+        ret = fgetJpegComment(fp, &comment);
+        if (!ret && comment) {
+            pixSetText(pix, (char *)comment);
+            LEPT_FREE(comment);
+        }
+    }
+    fclose(fp);
+    if (!pix) L_ERROR("pix not read\n", __func__);
+    return pix;
+}
+
+
 /*!
  * \brief   readHeaderMemJpeg()
  *
@@ -1152,6 +1411,406 @@ FILE    *fp;
 }
 
 
+/*---------------------------------------------------------------------*
+ *                Lossless transforms of jpeg data                     *
+ *---------------------------------------------------------------------*/
+/*!
+ * \brief   jpegTransformFile()
+ *
+ * \param[in]    filein
+ * \param[in]    fileout
+ * \param[in]    transform    L_JPEG_NO_TRANSFORM, L_JPEG_ROTATE_90, ...
+ * \param[in]    box          [optional] region to crop; use NULL for
+ *                            the entire image
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) See jpegTransformStream().
+ * </pre>
+ */
+l_ok
+jpegTransformFile(const char  *filein,
+                  const char  *fileout,
+                  l_int32      transform,
+                  BOX         *box)
+{
+l_int32  ret;
+FILE    *fpin, *fpout;
+
+    if (!filein)
+        return ERROR_INT("filein not defined", __func__, 1);
+    if (!fileout)
+        return ERROR_INT("fileout not defined", __func__, 1);
+
+    if ((fpin = fopenReadStream(filein)) == NULL)
+        return ERROR_INT_1("image file not found", filein, __func__, 1);
+    if ((fpout = fopenWriteStream(fileout, "wb+")) == NULL) {
+        fclose(fpin);
+        return ERROR_INT_1("stream not opened", fileout, __func__, 1);
+    }
+    ret = jpegTransformStream(fpin, fpout, transform, box);
+    fclose(fpin);
+    fclose(fpout);
+    if (ret)
+        return ERROR_INT_1("jpeg not transformed", filein, __func__, 1);
+    return 0;
+}
+
+
+/*!
+ * \brief   jpegTransformStream()
+ *
+ * \param[in]    fpin         input jpeg stream
+ * \param[in]    fpout        output jpeg stream
+ * \param[in]    transform    L_JPEG_NO_TRANSFORM, L_JPEG_ROTATE_90, ...
+ * \param[in]    box          [optional] region to crop; use NULL for
+ *                            the entire image
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This rotates, flips and crops jpeg data without decoding
+ *          it to pixels, by rearranging the quantized DCT coefficients.
+ *          There is no loss of quality, and it is several times
+ *          faster than decoding, transforming and encoding the image.
+ *      (2) The rotations are clockwise, and the values of %transform
+ *          for the rotations are the same as %quads in pixRotateOrth().
+ *      (3) The crop box is applied before the transform, in the
+ *          coordinates of the input image.  Its upper left corner is
+ *          moved up and left to the nearest iMCU boundary (8 or 16
+ *          pixels), so the output always contains the requested region.
+ *      (4) A transform that moves the right or bottom edge of the image
+ *          (or cropped region) to the top or left can only be done if
+ *          that dimension is a multiple of the iMCU size.  Otherwise
+ *          the partial blocks at the edge would be left in the interior,
+ *          and this returns an error without writing.
+ *          Use jpegCheckTransformMem() to check before calling.
+ *      (5) Comments and application markers are copied.  The output
+ *          uses optimized Huffman tables, and is progressive if the
+ *          input is progressive.
+ * </pre>
+ */
+l_ok
+jpegTransformStream(FILE     *fpin,
+                    FILE     *fpout,
+                    l_int32   transform,
+                    BOX      *box)
+{
+l_int32                        i, ci, x0, y0, cw, ch, lossless, transpose;
+l_int32                        hs, vs, maxh, maxv, sbx0, sby0, cwb, chb;
+l_int32                        dbx, dby, dwb, dhb, sx, sy;
+UINT16                         qval, density, *qtab;
+JBLOCKARRAY                    srcrow, dstrow;
+jvirt_barray_ptr              *srccoefs, *dstcoefs;
+jpeg_component_info           *comp;
+struct jpeg_decompress_struct  srcinfo = { 0 };
+struct jpeg_compress_struct    dstinfo = { 0 };
+struct jpeg_error_mgr          jerr1 = { 0 };
+struct jpeg_error_mgr          jerr2 = { 0 };
+jmp_buf                        jmpbuf;  /* must be local to the function */
+
+    if (!fpin)
+        return ERROR_INT("fpin not defined", __func__, 1);
+    if (!fpout)
+        return ERROR_INT("fpout not defined", __func__, 1);
+    if (transform < L_JPEG_NO_TRANSFORM || transform > L_JPEG_FLIP_TB)
+        return ERROR_INT("invalid transform", __func__, 1);
+
+    rewind(fpin);
+
+        /* Modify the jpeg error handling to catch fatal errors  */
+    srcinfo.err = jpeg_std_error(&jerr1);
+    jerr1.error_exit = jpeg_error_catch_all_1;
+    srcinfo.client_data_ref = (void *)&jmpbuf;
+    dstinfo.err = jpeg_std_error(&jerr2);
+    jerr2.error_exit = jpeg_error_catch_all_1;
+    dstinfo.client_data_ref = (void *)&jmpbuf;
+    if (setjmp(jmpbuf)) {
+        jpeg_destroy_decompress(&srcinfo);
+        jpeg_destroy_compress(&dstinfo);
+        return ERROR_INT("internal jpeg error", __func__, 1);
+    }
+
+        /* Read the header, saving the markers to be copied */
+    jpeg_create_decompress(&srcinfo);
+    jpeg_create_compress(&dstinfo);
+    jpeg_stdio_src(&srcinfo, fpin);
+    jpeg_save_markers(&srcinfo, JPEG_COM, 0xffff);
+    for (i = 0; i < 16; i++)
+        jpeg_save_markers(&srcinfo, JPEG_APP0 + i, 0xffff);
+    jpeg_read_header(&srcinfo, TRUE);
+    if (jpegFindTransformRegion(&srcinfo, transform, box, &x0, &y0,
+                                &cw, &ch, &lossless) || !lossless) {
+        jpeg_destroy_decompress(&srcinfo);
+        jpeg_destroy_compress(&dstinfo);
+        return ERROR_INT("transform is not lossless for this size",
+                         __func__, 1);
+    }
+    transpose = (transform == L_JPEG_ROTATE_90 ||
+                 transform == L_JPEG_ROTATE_270);
+    maxh = srcinfo.max_h_samp_factor;
+    maxv = srcinfo.max_v_samp_factor;
+
+        /* Request the output coefficient arrays.  These must be
+         * requested before the input coefficients are read, which
+         * is when all the virtual arrays are allocated.  Blocks
+         * beyond the image that fill out the last iMCU are zeroed. */
+    dstcoefs = (jvirt_barray_ptr *)(*srcinfo.mem->alloc_small)
+               ((j_common_ptr)&srcinfo, JPOOL_IMAGE,
+                sizeof(jvirt_barray_ptr) * srcinfo.num_components);
+    for (ci = 0; ci < srcinfo.num_components; ci++) {
+        comp = srcinfo.comp_info + ci;
+        hs = (transpose) ? comp->v_samp_factor : comp->h_samp_factor;
+        vs = (transpose) ? comp->h_samp_factor : comp->v_samp_factor;
+        cwb = (cw * comp->h_samp_factor + maxh * DCTSIZE - 1) /
+              (maxh * DCTSIZE);
+        chb = (ch * comp->v_samp_factor + maxv * DCTSIZE - 1) /
+              (maxv * DCTSIZE);
+        dwb = (transpose) ? chb : cwb;
+        dhb = (transpose) ? cwb : chb;
+        dstcoefs[ci] = (*srcinfo.mem->request_virt_barray)
+                       ((j_common_ptr)&srcinfo, JPOOL_IMAGE, TRUE,
+                        (JDIMENSION)(hs * ((dwb + hs - 1) / hs)),
+                        (JDIMENSION)(vs * ((dhb + vs - 1) / vs)),
+                        (JDIMENSION)vs);
+    }
+    srccoefs = jpeg_read_coefficients(&srcinfo);
+
+        /* Set up the output parameters.  For 90 and 270 degree rotations,
+         * the sampling factors, quantization tables and pixel density
+         * are transposed. */
+    jpeg_copy_critical_parameters(&srcinfo, &dstinfo);
+    dstinfo.image_width = (transpose) ? ch : cw;
+    dstinfo.image_height = (transpose) ? cw : ch;
+    if (transpose) {
+        for (ci = 0; ci < dstinfo.num_components; ci++) {
+            comp = dstinfo.comp_info + ci;
+            hs = comp->h_samp_factor;
+            comp->h_samp_factor = comp->v_samp_factor;
+            comp->v_samp_factor = hs;
+        }
+        for (i = 0; i < NUM_QUANT_TBLS; i++) {
+            if (!dstinfo.quant_tbl_ptrs[i]) continue;
+            qtab = dstinfo.quant_tbl_ptrs[i]->quantval;
+            for (dby = 0; dby < DCTSIZE; dby++) {
+                for (dbx = 0; dbx < dby; dbx++) {
+                    qval = qtab[dby * DCTSIZE + dbx];
+                    qtab[dby * DCTSIZE + dbx] = qtab[dbx * DCTSIZE + dby];
+                    qtab[dbx * DCTSIZE + dby] = qval;
+                }
+            }
+        }
+        density = dstinfo.X_density;
+        dstinfo.X_density = dstinfo.Y_density;
+        dstinfo.Y_density = density;
+    }
+    dstinfo.optimize_coding = TRUE;
+    if (srcinfo.progressive_mode)
+        jpeg_simple_progression(&dstinfo);
+    jpeg_stdio_dest(&dstinfo, fpout);
+    jpeg_write_coefficients(&dstinfo, dstcoefs);
+    jpegCopyMarkers(&srcinfo, &dstinfo);
+
+        /* Move the blocks, one component at a time.  (sx, sy) is the
+         * block in the cropped input that goes to (dbx, dby). */
+    for (ci = 0; ci < srcinfo.num_components; ci++) {
+        comp = srcinfo.comp_info + ci;
+        sbx0 = x0 * comp->h_samp_factor / (maxh * DCTSIZE);
+        sby0 = y0 * comp->v_samp_factor / (maxv * DCTSIZE);
+        cwb = (cw * comp->h_samp_factor + maxh * DCTSIZE - 1) /
+              (maxh * DCTSIZE);
+        chb = (ch * comp->v_samp_factor + maxv * DCTSIZE - 1) /
+              (maxv * DCTSIZE);
+        dwb = (transpose) ? chb : cwb;
+        dhb = (transpose) ? cwb : chb;
+        for (dby = 0; dby < dhb; dby++) {
+            dstrow = (*srcinfo.mem->access_virt_barray)
+                     ((j_common_ptr)&srcinfo, dstcoefs[ci],
+                      (JDIMENSION)dby, 1, TRUE);
+            for (dbx = 0; dbx < dwb; dbx++) {
+                switch (transform) {
+                case L_JPEG_ROTATE_90:
+                    sx = dby;
+                    sy = chb - 1 - dbx;
+                    break;
+                case L_JPEG_ROTATE_180:
+                    sx = cwb - 1 - dbx;
+                    sy = chb - 1 - dby;
+                    break;
+                case L_JPEG_ROTATE_270:
+                    sx = cwb - 1 - dby;
+                    sy = dbx;
+                    break;
+                case L_JPEG_FLIP_LR:
+                    sx = cwb - 1 - dbx;
+                    sy = dby;
+                    break;
+                case L_JPEG_FLIP_TB:
+                    sx = dbx;
+                    sy = chb - 1 - dby;
+                    break;
+                default:  /* L_JPEG_NO_TRANSFORM */
+                    sx = dbx;
+                    sy = dby;
+                    break;
+                }
+                srcrow = (*srcinfo.mem->access_virt_barray)
+                         ((j_common_ptr)&srcinfo, srccoefs[ci],
+                          (JDIMENSION)(sby0 + sy), 1, FALSE);
+                jpegTransformBlock(srcrow[0][sbx0 + sx], dstrow[0][dbx],
+                                   transform);
+            }
+        }
+    }
+
+    jpeg_finish_compress(&dstinfo);
+    jpeg_destroy_compress(&dstinfo);
+    jpeg_finish_decompress(&srcinfo);
+    jpeg_destroy_decompress(&srcinfo);
+    return 0;
+}
+
+
+/*!
+ * \brief   jpegTransformMem()
+ *
+ * \param[in]    datain       jpeg-encoded
+ * \param[in]    nbytesin     size of %datain
+ * \param[in]    transform    L_JPEG_NO_TRANSFORM, L_JPEG_ROTATE_90, ...
+ * \param[in]    box          [optional] region to crop; use NULL for
+ *                            the entire image
+ * \param[out]   pdataout     transformed jpeg data
+ * \param[out]   pnbytesout   size of %dataout
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) See jpegTransformStream().  This version works on data
+ *          in memory.
+ * </pre>
+ */
+l_ok
+jpegTransformMem(const l_uint8  *datain,
+                 size_t          nbytesin,
+                 l_int32         transform,
+                 BOX            *box,
+                 l_uint8       **pdataout,
+                 size_t         *pnbytesout)
+{
+l_int32  ret;
+FILE    *fpin, *fpout;
+
+    if (pdataout) *pdataout = NULL;
+    if (pnbytesout) *pnbytesout = 0;
+    if (!pdataout)
+        return ERROR_INT("&dataout not defined", __func__, 1);
+    if (!pnbytesout)
+        return ERROR_INT("&nbytesout not defined", __func__, 1);
+    if (!datain)
+        return ERROR_INT("datain not defined", __func__, 1);
+
+    if ((fpin = fopenReadFromMemory(datain, nbytesin)) == NULL)
+        return ERROR_INT("input stream not opened", __func__, 1);
+#if HAVE_FMEMOPEN
+    if ((fpout = open_memstream((char **)pdataout, pnbytesout)) == NULL) {
+        fclose(fpin);
+        return ERROR_INT("stream not opened", __func__, 1);
+    }
+    ret = jpegTransformStream(fpin, fpout, transform, box);
+    fputc('\0', fpout);
+    fclose(fpout);
+    if (*pnbytesout > 0) *pnbytesout = *pnbytesout - 1;
+#else
+    L_INFO("no fmemopen API --> work-around: write to temp file\n", __func__);
+  #ifdef _WIN32
+    if ((fpout = fopenWriteWinTempfile()) == NULL) {
+        fclose(fpin);
+        return ERROR_INT("tmpfile stream not opened", __func__, 1);
+    }
+  #else
+    if ((fpout = tmpfile()) == NULL) {
+        fclose(fpin);
+        return ERROR_INT("tmpfile stream not opened", __func__, 1);
+    }
+  #endif  /* _WIN32 */
+    ret = jpegTransformStream(fpin, fpout, transform, box);
+    rewind(fpout);
+    *pdataout = l_binaryReadStream(fpout, pnbytesout);
+    fclose(fpout);
+#endif  /* HAVE_FMEMOPEN */
+    fclose(fpin);
+    if (ret) {
+        LEPT_FREE(*pdataout);
+        *pdataout = NULL;
+        *pnbytesout = 0;
+    }
+    return ret;
+}
+
+
+/*!
+ * \brief   jpegCheckTransformMem()
+ *
+ * \param[in]    data         jpeg-encoded
+ * \param[in]    nbytes       size of %data
+ * \param[in]    transform    L_JPEG_NO_TRANSFORM, L_JPEG_ROTATE_90, ...
+ * \param[in]    box          [optional] region to crop; use NULL for
+ *                            the entire image
+ * \param[out]   plossless    1 if jpegTransformMem() can do the transform;
+ *                            0 otherwise
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This reads only the header, to find if the dimensions
+ *          that the transform moves are multiples of the iMCU size.
+ *          When they are not, the caller can decode the image and
+ *          use pixRotateOrth() or pixFlipLR() instead.
+ * </pre>
+ */
+l_ok
+jpegCheckTransformMem(const l_uint8  *data,
+                      size_t          nbytes,
+                      l_int32         transform,
+                      BOX            *box,
+                      l_int32        *plossless)
+{
+l_int32                        x0, y0, cw, ch, ret;
+FILE                          *fp;
+struct jpeg_decompress_struct  cinfo = { 0 };
+struct jpeg_error_mgr          jerr = { 0 };
+jmp_buf                        jmpbuf;  /* must be local to the function */
+
+    if (!plossless)
+        return ERROR_INT("&lossless not defined", __func__, 1);
+    *plossless = 0;
+    if (!data)
+        return ERROR_INT("data not defined", __func__, 1);
+    if (transform < L_JPEG_NO_TRANSFORM || transform > L_JPEG_FLIP_TB)
+        return ERROR_INT("invalid transform", __func__, 1);
+
+    if ((fp = fopenReadFromMemory(data, nbytes)) == NULL)
+        return ERROR_INT("stream not opened", __func__, 1);
+    cinfo.err = jpeg_std_error(&jerr);
+    jerr.error_exit = jpeg_error_catch_all_1;
+    cinfo.client_data_ref = (void *)&jmpbuf;
+    if (setjmp(jmpbuf)) {
+        jpeg_destroy_decompress(&cinfo);
+        fclose(fp);
+        return ERROR_INT("internal jpeg error", __func__, 1);
+    }
+    jpeg_create_decompress(&cinfo);
+    jpeg_stdio_src(&cinfo, fp);
+    jpeg_read_header(&cinfo, TRUE);
+    ret = jpegFindTransformRegion(&cinfo, transform, box, &x0, &y0,
+                                  &cw, &ch, plossless);
+    jpeg_destroy_decompress(&cinfo);
+    fclose(fp);
+    return ret;
+}
+
+
 /*---------------------------------------------------------------------*
  *           Setting special flag for chroma sampling on write         *
  *---------------------------------------------------------------------*/
@@ -1278,6 +1937,137 @@ struct callback_data  *pcb_data;
     return 1;
 }
 
+/*!
+ * \brief   jpegFindTransformRegion()
+ *
+ * \param[in]    cinfo       after the header is read
+ * \param[in]    transform   L_JPEG_NO_TRANSFORM, L_JPEG_ROTATE_90, ...
+ * \param[in]    box         [optional] region to crop
+ * \param[out]   px0, py0    upper left corner of the region, aligned
+ *                           to the iMCU boundaries
+ * \param[out]   pcw, pch    size of the region
+ * \param[out]   plossless   1 if the transform is lossless; 0 otherwise
+ * \return  0 if OK, 1 on error
+ *
+ *  Notes:
+ *      (1) A single component image is coded in 8x8 blocks, regardless
+ *          of its sampling factors, so its iMCU is 8x8.
+ */
+static l_int32
+jpegFindTransformRegion(j_decompress_ptr  cinfo,
+                        l_int32           transform,
+                        BOX              *box,
+                        l_int32          *px0,
+                        l_int32          *py0,
+                        l_int32          *pcw,
+                        l_int32          *pch,
+                        l_int32          *plossless)
+{
+l_int32  imcuw, imcuh, bx, by, bxend, byend, needw, needh;
+
+    *px0 = *py0 = *pcw = *pch = *plossless = 0;
+    if (boxClipToRectangleParams(box, cinfo->image_width,
+                                 cinfo->image_height, &bx, &by,
+                                 &bxend, &byend, NULL, NULL))
+        return ERROR_INT("invalid box", __func__, 1);
+    if (cinfo->num_components == 1) {
+        imcuw = imcuh = DCTSIZE;
+    } else {
+        imcuw = cinfo->max_h_samp_factor * DCTSIZE;
+        imcuh = cinfo->max_v_samp_factor * DCTSIZE;
+    }
+    *px0 = imcuw * (bx / imcuw);
+    *py0 = imcuh * (by / imcuh);
+    *pcw = bxend - *px0;
+    *pch = byend - *py0;
+
+        /* These transforms move the right or the bottom edge */
+    needw = (transform == L_JPEG_ROTATE_180 ||
+             transform == L_JPEG_ROTATE_270 || transform == L_JPEG_FLIP_LR);
+    needh = (transform == L_JPEG_ROTATE_90 ||
+             transform == L_JPEG_ROTATE_180 || transform == L_JPEG_FLIP_TB);
+    *plossless = !(needw && *pcw % imcuw) && !(needh && *pch % imcuh);
+    return 0;
+}
+
+/*!
+ * \brief   jpegTransformBlock()
+ *
+ *  Notes:
+ *      (1) Coefficient (u, v) is at src[DCTSIZE * v + u], for horizontal
+ *          frequency u and vertical frequency v.  Reversing a block in
+ *          either direction changes the sign of the odd frequencies in
+ *          that direction, and the 90 and 270 degree rotations also
+ *          transpose the block.
+ */
+static void
+jpegTransformBlock(JCOEFPTR  src,
+                   JCOEFPTR  dst,
+                   l_int32   transform)
+{
+l_int32  u, v;
+JCOEF    val;
+
+    for (v = 0; v < DCTSIZE; v++) {
+        for (u = 0; u < DCTSIZE; u++) {
+            switch (transform) {
+            case L_JPEG_ROTATE_90:
+                val = src[DCTSIZE * u + v];
+                if (u & 1) val = -val;
+                break;
+            case L_JPEG_ROTATE_180:
+                val = src[DCTSIZE * v + u];
+                if ((u + v) & 1) val = -val;
+                break;
+            case L_JPEG_ROTATE_270:
+                val = src[DCTSIZE * u + v];
+                if (v & 1) val = -val;
+                break;
+            case L_JPEG_FLIP_LR:
+                val = src[DCTSIZE * v + u];
+                if (u & 1) val = -val;
+                break;
+            case L_JPEG_FLIP_TB:
+                val = src[DCTSIZE * v + u];
+                if (v & 1) val = -val;
+                break;
+            default:  /* L_JPEG_NO_TRANSFORM */
+                val = src[DCTSIZE * v + u];
+                break;
+            }
+            dst[DCTSIZE * v + u] = val;
+        }
+    }
+}
+
+/*!
+ * \brief   jpegCopyMarkers()
+ *
+ *  Notes:
+ *      (1) This copies the saved comment and application markers.
+ *          The JFIF and Adobe markers are skipped if the compressor
+ *          writes its own.
+ */
+static void
+jpegCopyMarkers(j_decompress_ptr  srcinfo,
+                j_compress_ptr    dstinfo)
+{
+jpeg_saved_marker_ptr  marker;
+
+    for (marker = srcinfo->marker_list; marker; marker = marker->next) {
+        if (dstinfo->write_JFIF_header && marker->marker == JPEG_APP0 &&
+            marker->data_length >= 5 &&
+            !memcmp(marker->data, "JFIF", 5))
+            continue;
+        if (dstinfo->write_Adobe_marker && marker->marker == JPEG_APP0 + 14 &&
+            marker->data_length >= 5 &&
+            !memcmp(marker->data, "Adobe", 5))
+            continue;
+        jpeg_write_marker(dstinfo, marker->marker, marker->data,
+                          marker->data_length);
+    }
+}
+
 /* --------------------------------------------*/
 #endif  /* HAVE_LIBJPEG */
 /* --------------------------------------------*/
@@ -60,6 +60,23 @@ PIX * pixReadStreamJpeg(FILE *fp, l_int32 cmflag, l_int32 reduction,
 
 /* ----------------------------------------------------------------------*/
 
+PIX * pixReadJpegRegion(const char *filename, BOX *box, l_int32 cmapflag,
+                        l_int32 reduction, l_int32 *pnwarn, l_int32 hint)
+{
+    return (PIX * )ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
+PIX * pixReadStreamJpegRegion(FILE *fp, BOX *box, l_int32 cmapflag,
+                              l_int32 reduction, l_int32 *pnwarn,
+                              l_int32 hint)
+{
+    return (PIX * )ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
 l_ok readHeaderJpeg(const char *filename, l_int32 *pw, l_int32 *ph,
                     l_int32 *pspp, l_int32 *pycck, l_int32 *pcmyk)
 {
@@ -114,6 +131,15 @@ PIX * pixReadMemJpeg(const l_uint8 *cdata, size_t size, l_int32 cmflag,
 
 /* ----------------------------------------------------------------------*/
 
+PIX * pixReadMemJpegRegion(const l_uint8 *data, size_t size, BOX *box,
+                           l_int32 cmflag, l_int32 reduction,
+                           l_int32 *pnwarn, l_int32 hint)
+{
+    return (PIX * )ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
 l_ok readHeaderMemJpeg(const l_uint8 *cdata, size_t size,
                        l_int32 *pw, l_int32 *ph, l_int32 *pspp,
                        l_int32 *pycck, l_int32 *pcmyk)
@@ -139,6 +165,39 @@ l_ok pixWriteMemJpeg(l_uint8 **pdata, size_t *psize, PIX *pix,
 
 /* ----------------------------------------------------------------------*/
 
+l_ok jpegTransformFile(const char *filein, const char *fileout,
+                       l_int32 transform, BOX *box)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok jpegTransformStream(FILE *fpin, FILE *fpout, l_int32 transform,
+                         BOX *box)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok jpegTransformMem(const l_uint8 *datain, size_t nbytesin,
+                      l_int32 transform, BOX *box, l_uint8 **pdataout,
+                      size_t *pnbytesout)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok jpegCheckTransformMem(const l_uint8 *data, size_t nbytes,
+                           l_int32 transform, BOX *box, l_int32 *plossless)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
 l_ok pixSetChromaSampling(PIX *pix, l_int32 sampling)
 {
     return ERROR_INT("function not present", __func__, 1);
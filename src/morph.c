@@ -58,6 +58,17 @@
  *         void     resetMorphBoundaryCondition()
  *         l_int32  getMorphBorderPixelColor()
  *
+ *     Fused word-parallel implementation for arbitrary Sels
+ *         void     l_setMorphFused()
+ *         static l_int32  pixMorphFusedLow()
+ *         static void     morphFusedLoadRow()
+ *
+ *     Logarithmic (doubling) implementation for brick Sels
+ *         static l_int32  pixMorphBrickLogLow()
+ *         static l_int32  morphBrickLogHoriz()
+ *         static l_int32  morphBrickLogVert()
+ *         static l_int32  morphBrickLogSteps()
+ *
  *     Static helpers for arg processing
  *         static PIX     *processMorphArgs1()
  *         static PIX     *processMorphArgs2()
@@ -79,6 +90,9 @@
  *  (1) Brick Sels: pix*Brick(), where * = {Dilate, Erode, Open, Close}.
  *      These are separable rasterop implementations.  The Sels are
  *      automatically generated, used, and destroyed at the end.
+ *      For long enough bricks, pixDilate() and pixErode() use a
+ *      doubling method that takes about log2(size) steps per
+ *      direction, so these are fast for long Sels, such as 100 x 1.
  *      You can get the result as a new Pix, in-place back into the src Pix,
  *      or written to another existing Pix.
  *
@@ -157,6 +171,13 @@
  *  of a hit-miss Sel), followed by the HMT.
  *  Both of these 'generalized' functions are idempotent.
  *
+ *  The generic rasterop functions pixDilate(), pixErode() and pixHMT()
+ *  make one full-image rasterop for each element of the Sel.  For Sels
+ *  with more than a few elements, they instead use a fused implementation
+ *  that makes a single pass over the image, accumulating the shifted
+ *  source words for all elements into each destination raster line
+ *  while it is in cache.  The results are identical.
+ *
  *  These functions are extensively tested in prog/binmorph1_reg.c,
  *  prog/binmorph2_reg.c, and prog/binmorph3_reg.c.
  * </pre>
@@ -166,6 +187,7 @@
 #include <config_auto.h>
 #endif  /* HAVE_CONFIG_H */
 
+#include <string.h>
 #include <math.h>
 #include "allheaders.h"
 
@@ -178,6 +200,56 @@ LEPT_DLL l_int32  MORPH_BC = ASYMMETRIC_MORPH_BC;
     /* We accept this cost in extra rasterops for decomposing exactly. */
 static const l_int32  ACCEPTABLE_COST = 5;
 
+    /* Use the fused implementation for Sels with at least this
+     * many elements, and process the image in blocks of this many
+     * raster lines (in parallel, with OpenMP) */
+static const l_int32  MIN_FUSED_ELEMENTS = 4;
+static const l_int32  FUSED_BLOCK_ROWS = 64;
+
+    /* The fused implementation is used by pixDilate(), pixErode() and
+     * pixHMT() if this is 1.  To change the value, use l_setMorphFused(). */
+LEPT_DLL l_int32  MorphFused = 1;
+
+    /* Vertical steps of the doubling implementation for brick Sels are
+     * done on strips of this many words (in parallel, with OpenMP). */
+static const l_int32  LOG_BRICK_STRIP_WORDS = 32;
+
+    /* Estimated costs used to choose between the doubling and the fused
+     * implementations for brick Sels; see pixMorphBrickLogLow().  These
+     * are times, in units of 10 usec, for a dilation or erosion of a
+     * 2528 x 3300 image (feyn.tif) on one thread.  For the doubling
+     * implementation, they are the time per step and the fixed time in
+     * each direction, and the fixed time for doing both directions.  For
+     * the fused implementation, they are the time per Sel element in a
+     * horizontal and in a vertical brick. */
+static const l_int32  LOG_COST_STEP_H = 30;
+static const l_int32  LOG_COST_BASE_H = 15;
+static const l_int32  LOG_COST_STEP_V = 8;
+static const l_int32  LOG_COST_BASE_V = 12;
+static const l_int32  LOG_COST_SEPARABLE = 45;
+static const l_int32  FUSED_COST_H = 16;
+static const l_int32  FUSED_COST_V = 10;
+
+    /* Word j of a line at a bit offset, given as 32 - offset, in [1 ... 32] */
+#define FUSED_WORD(p, j, rsh) \
+    ((l_uint32)((((l_uint64)(p)[j] << 32) | (p)[(j) + 1]) >> (rsh)))
+
+    /* Fused word-parallel implementation for arbitrary Sels */
+static l_int32 pixMorphFusedLow(PIX *pixd, PIX *pixs, SEL *sel,
+                                l_int32 type);
+static void morphFusedLoadRow(l_uint32 *bufrow, l_uint32 *lines,
+                              l_int32 wpl, l_int32 guard, l_int32 w,
+                              l_uint32 fill);
+
+    /* Logarithmic (doubling) implementation for brick Sels */
+static l_int32 pixMorphBrickLogLow(PIX *pixd, PIX *pixs, SEL *sel,
+                                   l_int32 type);
+static l_int32 morphBrickLogHoriz(PIX *pixd, PIX *pixs, l_int32 size,
+                                  l_int32 cx, l_int32 type);
+static l_int32 morphBrickLogVert(PIX *pixd, PIX *pixs, l_int32 size,
+                                 l_int32 cy, l_int32 type);
+static l_int32 morphBrickLogSteps(l_int32 size);
+
     /* Static helpers for arg processing */
 static PIX * processMorphArgs1(PIX *pixd, PIX *pixs, SEL *sel, PIX **ppixt);
 static PIX * processMorphArgs2(PIX *pixd, PIX *pixs, SEL *sel);
@@ -220,6 +292,13 @@ PIX     *pixt;
     if ((pixd = processMorphArgs1(pixd, pixs, sel, &pixt)) == NULL)
         return (PIX *)ERROR_PTR("processMorphArgs1 failed", __func__, pixd);
 
+    if (pixMorphBrickLogLow(pixd, pixt, sel, L_MORPH_DILATE) == 0 ||
+        (MorphFused &&
+         pixMorphFusedLow(pixd, pixt, sel, L_MORPH_DILATE) == 0)) {
+        pixDestroy(&pixt);
+        return pixd;
+    }
+
     pixGetDimensions(pixs, &w, &h, NULL);
     selGetParameters(sel, &sy, &sx, &cy, &cx);
     pixClearAll(pixd);
@@ -273,6 +352,13 @@ PIX     *pixt;
     if ((pixd = processMorphArgs1(pixd, pixs, sel, &pixt)) == NULL)
         return (PIX *)ERROR_PTR("processMorphArgs1 failed", __func__, pixd);
 
+    if (pixMorphBrickLogLow(pixd, pixt, sel, L_MORPH_ERODE) == 0 ||
+        (MorphFused &&
+         pixMorphFusedLow(pixd, pixt, sel, L_MORPH_ERODE) == 0)) {
+        pixDestroy(&pixt);
+        return pixd;
+    }
+
     pixGetDimensions(pixs, &w, &h, NULL);
     selGetParameters(sel, &sy, &sx, &cy, &cx);
     pixSetAll(pixd);
@@ -346,6 +432,11 @@ PIX     *pixt;
     if ((pixd = processMorphArgs1(pixd, pixs, sel, &pixt)) == NULL)
         return (PIX *)ERROR_PTR("processMorphArgs1 failed", __func__, pixd);
 
+    if (MorphFused && pixMorphFusedLow(pixd, pixt, sel, L_MORPH_HMT) == 0) {
+        pixDestroy(&pixt);
+        return pixd;
+    }
+
     pixGetDimensions(pixs, &w, &h, NULL);
     selGetParameters(sel, &sy, &sx, &cy, &cx);
     firstrasterop = TRUE;
@@ -1778,6 +1869,627 @@ getMorphBorderPixelColor(l_int32  type,
 }
 
 
+/*-----------------------------------------------------------------*
+ *      Fused word-parallel implementation for arbitrary Sels      *
+ *-----------------------------------------------------------------*/
+/*!
+ * \brief   l_setMorphFused()
+ *
+ * \param[in]    flag     1 to use the fused implementation; 0 to use
+ *                        one rasterop for each Sel element
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) This determines whether pixDilate(), pixErode() and pixHMT()
+ *          use pixMorphFusedLow() for Sels with at least
+ *          MIN_FUSED_ELEMENTS elements.  The default is 1.  The results
+ *          are the same; this is for testing and timing.
+ * </pre>
+ */
+void
+l_setMorphFused(l_int32  flag)
+{
+    MorphFused = (flag) ? 1 : 0;
+}
+
+
+/*!
+ * \brief   pixMorphFusedLow()
+ *
+ * \param[in]    pixd     1 bpp, same size as pixs
+ * \param[in]    pixs     1 bpp; not the same as pixd
+ * \param[in]    sel
+ * \param[in]    type     L_MORPH_DILATE, L_MORPH_ERODE or L_MORPH_HMT
+ * \return  0 if OK; 1 if the Sel has fewer than MIN_FUSED_ELEMENTS
+ *              elements, or on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This gives the same result as the rasterop implementations
+ *          in pixDilate(), pixErode() and pixHMT(), but reads and writes
+ *          each raster line of the image once, rather than once
+ *          for each element of the Sel.
+ *      (2) The source lines that are needed are copied into a small
+ *          ring buffer of (sy) lines, with guard words on each side
+ *          and with the pixels outside the image set to the boundary
+ *          value.  This removes all tests for the image boundary from
+ *          the inner loops.
+ *      (3) Each row of the Sel is a horizontal pattern of elements.
+ *          For each source line and each distinct pattern, the shifted
+ *          words for the elements in the pattern are combined once,
+ *          and kept in the ring.  Each destination line is then the
+ *          combination of one such line for each row of the Sel.
+ *          Sels with repeated rows, such as disks, get the horizontal
+ *          part of the work for the repeated rows for free.
+ *      (4) The boundary values are equivalent to the rasterop
+ *          implementations: pixels outside the image are OFF for
+ *          dilation and HMT, and for erosion they are OFF with
+ *          asymmetric b.c. and ON with symmetric b.c.  For the misses
+ *          of the HMT, the outside pixels are OFF, so that they do
+ *          not affect the result.
+ *      (5) The image is processed in blocks of FUSED_BLOCK_ROWS lines,
+ *          each with its own ring buffer.  With OpenMP, the blocks are
+ *          processed in parallel.
+ * </pre>
+ */
+static l_int32
+pixMorphFusedLow(PIX     *pixd,
+                 PIX     *pixs,
+                 SEL     *sel,
+                 l_int32  type)
+{
+l_int32    i, j, k, m, n, w, h, sx, sy, cx, cy, wpls, wpld, val, ret;
+l_int32    dymin, dymax, maxdx, guard, nring, rowwords, nblocks, lastbits;
+l_int32    nrows, npat, same, dxval, ntotal;
+l_int32   *dx, *shift, *inv, *rowdy, *rowpat, *patstart, *patcount;
+l_uint32   fill, lastmask;
+l_uint32  *datas, *datad;
+
+    pixGetDimensions(pixs, &w, &h, NULL);
+    selGetParameters(sel, &sy, &sx, &cy, &cx);
+    datas = pixGetData(pixs);
+    datad = pixGetData(pixd);
+    wpls = pixGetWpl(pixs);
+    wpld = pixGetWpl(pixd);
+
+    dx = (l_int32 *)LEPT_CALLOC((size_t)sx * sy, sizeof(l_int32));
+    shift = (l_int32 *)LEPT_CALLOC((size_t)sx * sy, sizeof(l_int32));
+    inv = (l_int32 *)LEPT_CALLOC((size_t)sx * sy, sizeof(l_int32));
+    rowdy = (l_int32 *)LEPT_CALLOC(sy, sizeof(l_int32));
+    rowpat = (l_int32 *)LEPT_CALLOC(sy, sizeof(l_int32));
+    patstart = (l_int32 *)LEPT_CALLOC(sy, sizeof(l_int32));
+    patcount = (l_int32 *)LEPT_CALLOC(sy, sizeof(l_int32));
+    if (!dx || !shift || !inv || !rowdy || !rowpat || !patstart ||
+        !patcount) {
+        ret = ERROR_INT("arrays not made", __func__, 1);
+        goto cleanup;
+    }
+
+        /* Collect the elements, grouped by row into distinct patterns.
+         * Dilation reads the source at (x - (j - cx), y - (i - cy));
+         * erosion and the HMT read it at (x + (j - cx), y + (i - cy)).
+         * For each element, dx[] here is the word offset and shift[]
+         * the bit shift of the source, with 0 <= shift < 32. */
+    n = nrows = npat = ntotal = 0;
+    dymin = dymax = maxdx = 0;
+    for (i = 0; i < sy; i++) {
+        patstart[npat] = n;
+        for (j = 0; j < sx; j++) {
+            val = sel->data[i][j];
+            if (val != SEL_HIT && (val != SEL_MISS || type != L_MORPH_HMT))
+                continue;
+            dxval = (type == L_MORPH_DILATE) ? cx - j : j - cx;
+            maxdx = L_MAX(maxdx, L_ABS(dxval));
+            dx[n] = (dxval >= 0) ? dxval / 32 : -((31 - dxval) / 32);
+            shift[n] = dxval - 32 * dx[n];
+            inv[n] = (val == SEL_MISS);
+            n++;
+            ntotal++;
+        }
+        if (n == patstart[npat])  /* no elements in this row */
+            continue;
+        rowdy[nrows] = (type == L_MORPH_DILATE) ? cy - i : i - cy;
+        dymin = L_MIN(dymin, rowdy[nrows]);
+        dymax = L_MAX(dymax, rowdy[nrows]);
+        patcount[npat] = n - patstart[npat];
+
+            /* Look for an identical pattern in a previous row */
+        for (k = 0; k < npat; k++) {
+            if (patcount[k] != patcount[npat]) continue;
+            same = TRUE;
+            for (m = 0; m < patcount[k] && same; m++) {
+                if (dx[patstart[k] + m] != dx[patstart[npat] + m] ||
+                    shift[patstart[k] + m] != shift[patstart[npat] + m] ||
+                    inv[patstart[k] + m] != inv[patstart[npat] + m])
+                    same = FALSE;
+            }
+            if (same) break;
+        }
+        rowpat[nrows++] = k;
+        if (k == npat)  /* new pattern */
+            npat++;
+        else  /* drop the duplicate elements */
+            n = patstart[npat];
+    }
+    if (ntotal < MIN_FUSED_ELEMENTS) {
+        ret = 1;  /* use the rasterop implementation */
+        goto cleanup;
+    }
+
+    fill = (type == L_MORPH_ERODE && MORPH_BC == SYMMETRIC_MORPH_BC) ?
+           0xffffffff : 0;
+    lastbits = w & 31;
+    lastmask = (lastbits) ? ~(0xffffffff >> lastbits) : 0xffffffff;
+    guard = (maxdx + 31) / 32 + 1;
+    rowwords = wpls + 2 * guard;
+    nring = dymax - dymin + 1;
+    nblocks = (h + FUSED_BLOCK_ROWS - 1) / FUSED_BLOCK_ROWS;
+
+    ret = 0;
+#ifdef _OPENMP
+#pragma omp parallel for private(i, j, k, m) reduction(+:ret) \
+        if (nblocks > 1 && (l_int64)ntotal * wpld * h > 1000000)
+#endif  /* _OPENMP */
+    for (k = 0; k < nblocks; k++) {
+        l_int32    y, y0, y1, r, e, sh, slot, index;
+        l_int32   *rawrow, *patrow;
+        l_uint32  *raw, *pat, *lined, *p, *hp;
+
+        raw = (l_uint32 *)LEPT_CALLOC((size_t)nring * rowwords,
+                                      sizeof(l_uint32));
+        pat = (l_uint32 *)LEPT_CALLOC((size_t)npat * nring * wpld,
+                                      sizeof(l_uint32));
+        rawrow = (l_int32 *)LEPT_CALLOC(nring, sizeof(l_int32));
+        patrow = (l_int32 *)LEPT_CALLOC((size_t)npat * nring,
+                                        sizeof(l_int32));
+        if (!raw || !pat || !rawrow || !patrow) {
+            LEPT_FREE(raw);
+            LEPT_FREE(pat);
+            LEPT_FREE(rawrow);
+            LEPT_FREE(patrow);
+            ret++;
+            continue;
+        }
+        for (i = 0; i < nring; i++)  /* not a row that is loaded */
+            rawrow[i] = dymin - 1;
+        for (i = 0; i < npat * nring; i++)
+            patrow[i] = dymin - 1;
+
+        y0 = k * FUSED_BLOCK_ROWS;
+        y1 = L_MIN(h, y0 + FUSED_BLOCK_ROWS);
+        for (y = y0; y < y1; y++) {
+            lined = datad + (size_t)y * wpld;
+            for (i = 0; i < nrows; i++) {
+                r = y + rowdy[i];
+                slot = (r - dymin) % nring;
+                if (rawrow[slot] != r) {  /* new source line */
+                    rawrow[slot] = r;
+                    morphFusedLoadRow(raw + (size_t)slot * rowwords,
+                                      (r >= 0 && r < h) ?
+                                      datas + (size_t)r * wpls : NULL,
+                                      wpls, guard, w, fill);
+                }
+
+                    /* Combine the shifted words for this row pattern */
+                index = rowpat[i] * nring + slot;
+                hp = pat + (size_t)index * wpld;
+                if (patrow[index] != r) {
+                    patrow[index] = r;
+                    for (m = 0; m < patcount[rowpat[i]]; m++) {
+                        e = patstart[rowpat[i]] + m;
+                        p = raw + (size_t)slot * rowwords + guard + dx[e];
+                        sh = 32 - shift[e];  /* in [1 ... 32] */
+                        if (m == 0 && !inv[e]) {
+                            for (j = 0; j < wpld; j++)
+                                hp[j] = FUSED_WORD(p, j, sh);
+                        } else if (m == 0) {
+                            for (j = 0; j < wpld; j++)
+                                hp[j] = ~FUSED_WORD(p, j, sh);
+                        } else if (type == L_MORPH_DILATE) {
+                            for (j = 0; j < wpld; j++)
+                                hp[j] |= FUSED_WORD(p, j, sh);
+                        } else if (!inv[e]) {
+                            for (j = 0; j < wpld; j++)
+                                hp[j] &= FUSED_WORD(p, j, sh);
+                        } else {
+                            for (j = 0; j < wpld; j++)
+                                hp[j] &= ~FUSED_WORD(p, j, sh);
+                        }
+                    }
+                }
+
+                    /* Accumulate into the dest line */
+                if (i == 0) {
+                    memcpy(lined, hp, 4 * wpld);
+                } else if (type == L_MORPH_DILATE) {
+                    for (j = 0; j < wpld; j++)
+                        lined[j] |= hp[j];
+                } else {
+                    for (j = 0; j < wpld; j++)
+                        lined[j] &= hp[j];
+                }
+            }
+            lined[wpld - 1] &= lastmask;
+        }
+
+        LEPT_FREE(raw);
+        LEPT_FREE(pat);
+        LEPT_FREE(rawrow);
+        LEPT_FREE(patrow);
+    }
+    if (ret)
+        ret = ERROR_INT("ring buffers not made", __func__, 1);
+
+cleanup:
+    LEPT_FREE(dx);
+    LEPT_FREE(shift);
+    LEPT_FREE(inv);
+    LEPT_FREE(rowdy);
+    LEPT_FREE(rowpat);
+    LEPT_FREE(patstart);
+    LEPT_FREE(patcount);
+    return ret;
+}
+
+
+/*!
+ * \brief   morphFusedLoadRow()
+ *
+ * \param[in]    bufrow   ring buffer line, of (wpl + 2 * guard) words
+ * \param[in]    lines    [optional] source line; null if outside the image
+ * \param[in]    wpl      words in the source line
+ * \param[in]    guard    number of guard words on each side
+ * \param[in]    w        image width
+ * \param[in]    fill     value for pixels outside the image: 0 or 0xffffffff
+ * \return  void
+ */
+static void
+morphFusedLoadRow(l_uint32  *bufrow,
+                  l_uint32  *lines,
+                  l_int32    wpl,
+                  l_int32    guard,
+                  l_int32    w,
+                  l_uint32   fill)
+{
+l_int32   j, lastbits;
+l_uint32  mask;
+
+    if (!lines) {
+        for (j = 0; j < wpl + 2 * guard; j++)
+            bufrow[j] = fill;
+        return;
+    }
+
+    for (j = 0; j < guard; j++) {
+        bufrow[j] = fill;
+        bufrow[guard + wpl + j] = fill;
+    }
+    memcpy(bufrow + guard, lines, 4 * wpl);
+    lastbits = w & 31;
+    if (lastbits) {  /* pad bits at the end of the line */
+        mask = 0xffffffff >> lastbits;
+        bufrow[guard + wpl - 1] = (bufrow[guard + wpl - 1] & ~mask) |
+                                  (fill & mask);
+    }
+}
+
+
+/*-----------------------------------------------------------------*
+ *       Logarithmic (doubling) implementation for brick Sels      *
+ *-----------------------------------------------------------------*/
+/*!
+ * \brief   pixMorphBrickLogLow()
+ *
+ * \param[in]    pixd    same size as pixs; not equal to pixs
+ * \param[in]    pixs    1 bpp
+ * \param[in]    sel
+ * \param[in]    type    L_MORPH_DILATE or L_MORPH_ERODE
+ * \return  0 if the operation was done; 1 if the Sel is not a solid
+ *          brick, if this is not expected to be faster, or on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) For a brick of length n, the rasterop and fused
+ *          implementations combine n shifted copies of each line.
+ *          Here, the union (or intersection) of n consecutive pixels
+ *          is built up by doubling: the result for 2L pixels is that
+ *          for L pixels combined with itself shifted by L.  This
+ *          takes about log2(n) steps, the last of which uses an
+ *          overlapping shift to get exactly n.  A final shift puts
+ *          the origin of the Sel in place.
+ *      (2) A brick with both sides > 1 is done separably, with the
+ *          horizontal operation first.  The origin can be anywhere.
+ *      (3) The boundary conditions are the same as for pixDilate()
+ *          and pixErode().
+ *      (4) This is only used if its estimated cost is less than that
+ *          of the fused implementation, which is linear in the size
+ *          of the brick.  The estimates come from these timings (msec)
+ *          for dilation and erosion of feyn.tif (2528 x 3300) on
+ *          one thread:
+ *             brick      doubling   fused
+ *             4 x 1        0.73      0.63
+ *             6 x 1        1.00      0.97
+ *             7 x 1        1.01      1.13
+ *             16 x 1       1.33      2.72
+ *             64 x 1       1.70     10.82
+ *             1 x 4        0.26      0.43
+ *             1 x 16       0.43      1.63
+ *             1 x 64       0.60      6.15
+ *             4 x 4        1.49      0.90
+ *             7 x 7        1.87      1.84
+ *             8 x 8        1.87      2.12
+ *             16 x 16      2.23      4.75
+ *             64 x 64      2.87     27.53
+ *          The doubling method takes one step per bit of (size - 1),
+ *          and each horizontal step costs more than a vertical one,
+ *          so it is used for horizontal bricks of width >= 6, for
+ *          vertical bricks of height >= 2, and for square bricks of
+ *          side >= 8.
+ * </pre>
+ */
+static l_int32
+pixMorphBrickLogLow(PIX     *pixd,
+                    PIX     *pixs,
+                    SEL     *sel,
+                    l_int32  type)
+{
+l_int32  i, j, sx, sy, cx, cy, ret, logcost, fusedcost;
+PIX     *pixt;
+
+    selGetParameters(sel, &sy, &sx, &cy, &cx);
+    if (sx * sy == 1)
+        return 1;
+    logcost = 0;
+    if (sx > 1)
+        logcost += LOG_COST_BASE_H + LOG_COST_STEP_H * morphBrickLogSteps(sx);
+    if (sy > 1)
+        logcost += LOG_COST_BASE_V + LOG_COST_STEP_V * morphBrickLogSteps(sy);
+    if (sx > 1 && sy > 1)
+        logcost += LOG_COST_SEPARABLE;
+    fusedcost = FUSED_COST_H * sx + FUSED_COST_V * sy;
+    if (logcost >= fusedcost)
+        return 1;
+    for (i = 0; i < sy; i++) {
+        for (j = 0; j < sx; j++) {
+            if (sel->data[i][j] != SEL_HIT)
+                return 1;
+        }
+    }
+
+    if (sy == 1)
+        return morphBrickLogHoriz(pixd, pixs, sx, cx, type);
+    if (sx == 1)
+        return morphBrickLogVert(pixd, pixs, sy, cy, type);
+    if ((pixt = pixCreateTemplate(pixs)) == NULL)
+        return ERROR_INT("pixt not made", __func__, 1);
+    ret = morphBrickLogHoriz(pixt, pixs, sx, cx, type);
+    if (!ret)
+        ret = morphBrickLogVert(pixd, pixt, sy, cy, type);
+    pixDestroy(&pixt);
+    return ret;
+}
+
+
+/*!
+ * \brief   morphBrickLogHoriz()
+ *
+ * \param[in]    pixd     same size as pixs
+ * \param[in]    pixs     1 bpp
+ * \param[in]    size     width of the horizontal brick
+ * \param[in]    cx       origin of the brick
+ * \param[in]    type     L_MORPH_DILATE or L_MORPH_ERODE
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) Each line is copied to a buffer with %gl guard words on
+ *          the left and more on the right, all set to the boundary
+ *          value.  After the doubling steps, bit x of the buffer
+ *          holds the combination of the %size pixels starting at x.
+ *          Dilation takes line pixels [x + cx - (size - 1), x + cx]
+ *          for dst pixel x, and erosion takes [x - cx, x - cx + size - 1].
+ *      (2) Each step works in place from left to right, so each word
+ *          is combined with words to its right that are not yet
+ *          changed.  Words beyond the ones computed stay at the
+ *          boundary value, which is their correct value for all steps.
+ * </pre>
+ */
+static l_int32
+morphBrickLogHoriz(PIX     *pixd,
+                   PIX     *pixs,
+                   l_int32  size,
+                   l_int32  cx,
+                   l_int32  type)
+{
+l_int32    k, w, h, wpls, wpld, gl, nw, nbuf, nblocks, offset, ret;
+l_uint32   fill, lastmask;
+l_uint32  *datas, *datad;
+
+    pixGetDimensions(pixs, &w, &h, NULL);
+    datas = pixGetData(pixs);
+    datad = pixGetData(pixd);
+    wpls = pixGetWpl(pixs);
+    wpld = pixGetWpl(pixd);
+    fill = (type == L_MORPH_ERODE && MORPH_BC == SYMMETRIC_MORPH_BC) ?
+           0xffffffff : 0;
+    lastmask = (w & 31) ? ~(0xffffffff >> (w & 31)) : 0xffffffff;
+    gl = (size + 31) / 32;
+    nw = gl + wpls + 1;  /* words computed in each step */
+    nbuf = nw + gl + 1;
+    offset = 32 * gl + ((type == L_MORPH_DILATE) ? cx - (size - 1) : -cx);
+    nblocks = (h + FUSED_BLOCK_ROWS - 1) / FUSED_BLOCK_ROWS;
+
+    ret = 0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:ret) \
+        if (nblocks > 1 && (l_int64)wpls * h > 100000)
+#endif  /* _OPENMP */
+    for (k = 0; k < nblocks; k++) {
+        l_int32    i, j, len, sh, q, r, pos;
+        l_uint32   v;
+        l_uint32  *buf, *lines, *lined;
+
+        if ((buf = (l_uint32 *)LEPT_CALLOC(nbuf, sizeof(l_uint32))) == NULL) {
+            ret++;
+            continue;
+        }
+        for (i = k * FUSED_BLOCK_ROWS;
+             i < L_MIN(h, (k + 1) * FUSED_BLOCK_ROWS); i++) {
+            lines = datas + (size_t)i * wpls;
+            lined = datad + (size_t)i * wpld;
+            for (j = 0; j < nbuf; j++)
+                buf[j] = fill;
+            memcpy(buf + gl, lines, 4 * wpls);
+            buf[gl + wpls - 1] = (buf[gl + wpls - 1] & lastmask) |
+                                 (fill & ~lastmask);
+
+                /* Doubling steps */
+            for (len = 1; len < size; len += sh) {
+                sh = L_MIN(len, size - len);
+                q = sh >> 5;
+                r = sh & 31;
+                for (j = 0; j < nw; j++) {
+                    v = (r) ? (buf[j + q] << r) | (buf[j + q + 1] >> (32 - r))
+                            : buf[j + q];
+                    if (type == L_MORPH_DILATE)
+                        buf[j] |= v;
+                    else
+                        buf[j] &= v;
+                }
+            }
+
+                /* Shift to the origin */
+            q = offset >> 5;
+            r = offset & 31;
+            for (j = 0, pos = q; j < wpld; j++, pos++) {
+                lined[j] = (r) ? (buf[pos] << r) | (buf[pos + 1] >> (32 - r))
+                               : buf[pos];
+            }
+            lined[wpld - 1] &= lastmask;
+        }
+        LEPT_FREE(buf);
+    }
+
+    if (ret)
+        return ERROR_INT("line buffers not made", __func__, 1);
+    return 0;
+}
+
+
+/*!
+ * \brief   morphBrickLogVert()
+ *
+ * \param[in]    pixd     same size as pixs
+ * \param[in]    pixs     1 bpp
+ * \param[in]    size     height of the vertical brick
+ * \param[in]    cy       origin of the brick
+ * \param[in]    type     L_MORPH_DILATE or L_MORPH_ERODE
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The image is copied to a buffer with (size - 1) lines
+ *          above it set to the boundary value; lines below the buffer
+ *          are taken to have the boundary value.  After the doubling
+ *          steps, line r of the buffer holds the combination of the
+ *          %size lines starting at r.
+ *      (2) Each step works in place from top to bottom, on vertical
+ *          strips of words.  With OpenMP, the strips are processed
+ *          in parallel.
+ * </pre>
+ */
+static l_int32
+morphBrickLogVert(PIX     *pixd,
+                  PIX     *pixs,
+                  l_int32  size,
+                  l_int32  cy,
+                  l_int32  type)
+{
+l_int32    i, k, w, h, wpls, wpld, nr, offset, nstrips;
+l_uint32   fill, lastmask;
+l_uint32  *datas, *datad, *buf;
+
+    pixGetDimensions(pixs, &w, &h, NULL);
+    datas = pixGetData(pixs);
+    datad = pixGetData(pixd);
+    wpls = pixGetWpl(pixs);
+    wpld = pixGetWpl(pixd);
+    fill = (type == L_MORPH_ERODE && MORPH_BC == SYMMETRIC_MORPH_BC) ?
+           0xffffffff : 0;
+    lastmask = (w & 31) ? ~(0xffffffff >> (w & 31)) : 0xffffffff;
+    nr = h + size - 1;
+    if ((buf = (l_uint32 *)LEPT_CALLOC((size_t)nr * wpls, sizeof(l_uint32)))
+            == NULL)
+        return ERROR_INT("buf not made", __func__, 1);
+    if (fill) {
+        for (k = 0; k < (size - 1) * wpls; k++)
+            buf[k] = fill;
+    }
+    memcpy(buf + (size_t)(size - 1) * wpls, datas, 4 * (size_t)h * wpls);
+
+        /* Doubling steps, on strips of LOG_BRICK_STRIP_WORDS words */
+    nstrips = (wpls + LOG_BRICK_STRIP_WORDS - 1) / LOG_BRICK_STRIP_WORDS;
+#ifdef _OPENMP
+#pragma omp parallel for if (nstrips > 1 && (l_int64)wpls * h > 100000)
+#endif  /* _OPENMP */
+    for (k = 0; k < nstrips; k++) {
+        l_int32    r, j, j0, j1, len, sh;
+        l_uint32  *line, *lineb;
+
+        j0 = k * LOG_BRICK_STRIP_WORDS;
+        j1 = L_MIN(wpls, j0 + LOG_BRICK_STRIP_WORDS);
+        for (len = 1; len < size; len += sh) {
+            sh = L_MIN(len, size - len);
+            for (r = 0; r < nr; r++) {
+                line = buf + (size_t)r * wpls;
+                if (r + sh < nr) {
+                    lineb = line + (size_t)sh * wpls;
+                    if (type == L_MORPH_DILATE) {
+                        for (j = j0; j < j1; j++)
+                            line[j] |= lineb[j];
+                    } else {
+                        for (j = j0; j < j1; j++)
+                            line[j] &= lineb[j];
+                    }
+                } else if (type == L_MORPH_ERODE && !fill) {
+                    for (j = j0; j < j1; j++)
+                        line[j] = 0;
+                }  /* else combining with fill does not change line */
+            }
+        }
+    }
+
+        /* Line y of pixd is line y + offset of the buffer */
+    offset = (size - 1) + ((type == L_MORPH_DILATE) ? cy - (size - 1) : -cy);
+    for (i = 0; i < h; i++) {
+        memcpy(datad + (size_t)i * wpld, buf + (size_t)(i + offset) * wpls,
+               4 * wpld);
+        datad[(size_t)i * wpld + wpld - 1] &= lastmask;
+    }
+
+    LEPT_FREE(buf);
+    return 0;
+}
+
+
+/*!
+ * \brief   morphBrickLogSteps()
+ *
+ * \param[in]    size     length of the brick; >= 1
+ * \return  number of doubling steps for a brick of length %size
+ */
+static l_int32
+morphBrickLogSteps(l_int32  size)
+{
+l_int32  len, nsteps;
+
+    for (len = 1, nsteps = 0; len < size; len *= 2)
+        nsteps++;
+    return nsteps;
+}
+
+
 /*-----------------------------------------------------------------*
  *               Static helpers for arg processing                 *
  *-----------------------------------------------------------------*/
@@ -35,6 +35,8 @@
  *      struct Sel
  *      struct Sela
  *      struct Kernel
+ *      struct L_MorphStep
+ *      struct L_MorphPlan
  *
  *  Contains definitions for:
  *      morphological b.c. flags
@@ -96,6 +98,37 @@ struct L_Kernel
 typedef struct L_Kernel  L_KERNEL;
 
 
+/*-------------------------------------------------------------------------*
+ *                    Compiled morphological sequence                      *
+ *-------------------------------------------------------------------------*/
+/*! One step of a compiled morphological sequence; see morphseq.c */
+struct L_MorphStep
+{
+    l_int32       type;      /*!< operation type, local to morphseq.c      */
+    l_int32       w;         /*!< sel width, or expansion factor           */
+    l_int32       h;         /*!< sel height                               */
+    l_int32       level[4];  /*!< rank thresholds for binary reduction     */
+    l_int32       resetall;  /*!< 1 to reset the full frame border before  */
+                             /*!< the step; 0 for only the outer 32 pixels */
+    struct Sel   *sel;       /*!< linear sel for rasterop, or flat gray    */
+                             /*!< sel; can be null                         */
+    char         *selname;   /*!< name of dwa linear sel; can be null      */
+};
+typedef struct L_MorphStep  L_MORPH_STEP;
+
+/*! Compiled morphological sequence, made by morphPlanCreate() */
+struct L_MorphPlan
+{
+    l_int32                depth;     /*!< 1 or 8                          */
+    l_int32                bc;        /*!< MORPH_BC when plan was made     */
+    l_int32                border;    /*!< border added by a 'b' op        */
+    l_int32                frame;     /*!< frame border for linear steps   */
+    l_int32                nsteps;    /*!< number of steps                 */
+    struct L_MorphStep    *steps;     /*!< array of steps                  */
+};
+typedef struct L_MorphPlan  L_MORPH_PLAN;
+
+
 /*-------------------------------------------------------------------------*
  *                 Morphological boundary condition flags                  *
  *                                                                         *
@@ -47,6 +47,10 @@
  *         PIX     *pixCloseCompBrickExtendDwa()
  *         l_int32  getExtendedCompositeParameters()
  *
+ *    Word width used by the generated dwa code
+ *         l_int32  l_setDwaWordWidth()
+ *         l_int32  l_getDwaWordWidth()
+ *
  *    These are higher-level interfaces for dwa morphology with brick Sels.
  *    Because many morphological operations are performed using
  *    separable brick Sels, it is useful to have a simple interface
@@ -135,10 +139,22 @@
 
 #include "allheaders.h"
 
+#if L_HAVE_AVX2 && defined(_MSC_VER)
+#include <intrin.h>
+#endif  /* L_HAVE_AVX2 && _MSC_VER */
+
 #ifndef  NO_CONSOLE_IO
 #define  DEBUG_SEL_LOOKUP   0
 #endif  /* ~NO_CONSOLE_IO */
 
+    /* Requested word width for the generated dwa code; 0 is automatic */
+static l_int32  DwaWordWidth = 0;
+
+    /* Widest word supported by this cpu; -1 until it has been tested */
+static l_int32  DwaMaxWordWidth = -1;
+
+static l_int32 dwaGetMaxWordWidth(void);
+
 /*-----------------------------------------------------------------*
  *           Binary morphological (dwa) ops with brick Sels        *
  *-----------------------------------------------------------------*/
@@ -1571,3 +1587,98 @@ l_int32  n, extra, fact1, fact2;
     *pextra = extra;
     return 0;
 }
+
+
+/*-----------------------------------------------------------------*
+ *            Word width used by the generated dwa code            *
+ *-----------------------------------------------------------------*/
+/*!
+ * \brief   l_setDwaWordWidth()
+ *
+ * \param[in]    width    0 for the widest supported; or 32, 64 or 256
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The generated low-level dwa code (fmorphgenlow.*.c,
+ *          fhmtgenlow.*.c and dwacomblow.*.c) has three versions of
+ *          each inner loop, working on 32-bit words, on 64-bit words
+ *          and on 256-bit AVX2 vectors.  All give identical results.
+ *          The dispatchers fmorphopgen_low_*() and fhmtgen_low_*()
+ *          choose the version from l_getDwaWordWidth().
+ *      (2) The default, %width = 0, uses 256-bit vectors if they
+ *          are compiled in and the cpu supports AVX2; otherwise
+ *          64-bit words.  Use this to force a narrower width, for
+ *          example for testing or timing.
+ *      (3) If %width = 256 is not available, 64 is used instead.
+ *      (4) This is a global setting; don't change it while other
+ *          threads are doing dwa morphology.
+ * </pre>
+ */
+l_ok
+l_setDwaWordWidth(l_int32  width)
+{
+    if (width != 0 && width != 32 && width != 64 && width != 256)
+        return ERROR_INT("width not in {0, 32, 64, 256}", __func__, 1);
+    if (width == 256 && dwaGetMaxWordWidth() < 256) {
+        L_WARNING("256-bit dwa not available; using 64\n", __func__);
+        width = 64;
+    }
+    DwaWordWidth = width;
+    return 0;
+}
+
+
+/*!
+ * \brief   l_getDwaWordWidth()
+ *
+ * \return  the word width in bits, one of {32, 64, 256}, that
+ *          the generated dwa code will use
+ */
+l_int32
+l_getDwaWordWidth(void)
+{
+    if (DwaWordWidth != 0)
+        return DwaWordWidth;
+    return dwaGetMaxWordWidth();
+}
+
+
+/*!
+ * \brief   dwaGetMaxWordWidth()
+ *
+ * \return  256 if the AVX2 code is compiled in and the cpu supports it;
+ *          64 otherwise
+ */
+static l_int32
+dwaGetMaxWordWidth(void)
+{
+#if L_HAVE_AVX2 && defined(_MSC_VER)
+int  info[4];
+#endif  /* L_HAVE_AVX2 && _MSC_VER */
+
+    if (DwaMaxWordWidth > 0)
+        return DwaMaxWordWidth;
+
+    DwaMaxWordWidth = 64;
+#if L_HAVE_AVX2
+#if defined(_MSC_VER)
+        /* Need cpu support for AVX2 and OS support for the ymm state */
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+        __cpuid(info, 1);
+        if ((info[2] & (1 << 27)) && (info[2] & (1 << 28)) &&
+            (_xgetbv(0) & 6) == 6) {
+            __cpuidex(info, 7, 0);
+            if (info[1] & (1 << 5))
+                DwaMaxWordWidth = 256;
+        }
+    }
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        DwaMaxWordWidth = 256;
+#endif  /* _MSC_VER */
+#endif  /* L_HAVE_AVX2 */
+    return DwaMaxWordWidth;
+}
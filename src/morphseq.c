@@ -45,9 +45,18 @@
  *
  *      Run a sequence of grayscale morphological operations
  *            PIX     *pixGrayMorphSequence()
+ *            l_int32  grayMorphSequenceVerify()
  *
  *      Run a sequence of color morphological operations
  *            PIX     *pixColorMorphSequence()
+ *
+ *      Compiled morphological sequence plans
+ *            L_MORPH_PLAN  *morphPlanCreate()
+ *            void           morphPlanDestroy()
+ *            PIX           *pixMorphPlanApply()
+ *            static l_int32  morphPlanAddLinear()
+ *            static PIX    *morphPlanGetBuffer()
+ *            static PIX    *morphPlanApplyGray()
  * </pre>
  */
 
@@ -58,6 +67,25 @@
 #include <string.h>
 #include "allheaders.h"
 
+    /* Step types in a compiled morphological plan */
+enum {
+    L_PLAN_DILATE = 1,        /* binary linear or gray flat dilation     */
+    L_PLAN_ERODE = 2,         /* binary linear or gray flat erosion      */
+    L_PLAN_OPEN = 3,          /* gray flat opening                       */
+    L_PLAN_CLOSE = 4,         /* gray flat closing                       */
+    L_PLAN_TOPHAT_WHITE = 5,  /* gray white tophat                       */
+    L_PLAN_TOPHAT_BLACK = 6,  /* gray black tophat                       */
+    L_PLAN_REDUCE = 7,        /* binary rank reduction cascade           */
+    L_PLAN_EXPAND = 8         /* binary replicative expansion            */
+};
+
+static l_int32 morphPlanAddLinear(L_MORPH_PLAN *plan, SELA *sela,
+                                  l_int32 type, l_int32 hsize, l_int32 vsize,
+                                  l_int32 resetall);
+static PIX *morphPlanGetBuffer(PIXA *pixaw, l_int32 index, l_int32 w,
+                               l_int32 h, l_int32 d);
+static PIX *morphPlanApplyGray(PIX *pixs, L_MORPH_PLAN *plan, PIXA *pixaw);
+
 /*-------------------------------------------------------------------------*
  *         Run a sequence of binary rasterop morphological operations      *
  *-------------------------------------------------------------------------*/
@@ -870,7 +898,9 @@ l_int32  intlogbase2[5] = {1, 2, 3, 0, 4};  /* of arg/4 */
  * Notes:
  *      (1) This works on 8 bpp grayscale images.
  *      (2) This runs a pipeline of operations; no branching is allowed.
- *      (3) This only uses brick SELs.
+ *      (3) This uses brick Sels, and flat disk Sels that are made with
+ *          selMakeDisk().  The disks are done by line segment
+ *          decomposition; see pixDilateGraySel().
  *      (4) A new image is always produced; the input image is not changed.
  *      (5) This contains an interpreter, allowing sequences to be
  *          generated and run.
@@ -892,12 +922,16 @@ l_int32  intlogbase2[5] = {1, 2, 3, 0, 4};  /* of arg/4 */
  *            ~ The args to the morphological operations are bricks of hits,
  *              and are formatted as a.b, where a and b are horizontal and
  *              vertical dimensions, rsp. (each must be an odd number)
+ *            ~ Alternatively, the args to the morphological operations
+ *              can be a disk of hits, formatted as r or R followed by
+ *              the radius (which must be >= 1).
  *            ~ The args to the tophat are w or W (for white tophat)
  *              or b or B (for black tophat), followed by a.b as for
  *              the dilation, erosion, opening and closing.
  *           Example valid sequences are:
  *             "c5.3 + o7.5"
  *             "c9.9 + tw9.9"
+ *             "or4 + cr2"
  * </pre>
  */
 PIX *
@@ -908,10 +942,11 @@ pixGrayMorphSequence(PIX         *pixs,
 {
 char    *rawop, *op;
 char     fname[256];
-l_int32  nops, i, valid, w, h, x, pdfout;
+l_int32  nops, i, w, h, x, pdfout;
 PIX     *pix1, *pix2;
 PIXA    *pixa;
 SARRAY  *sa;
+SEL     *sel;
 
     if (!pixs)
         return (PIX *)ERROR_PTR("pixs not defined", __func__, NULL);
@@ -925,58 +960,7 @@ SARRAY  *sa;
     pdfout = (dispsep < 0) ? 1 : 0;
 
         /* Verify that the operation sequence is valid */
-    valid = TRUE;
-    for (i = 0; i < nops; i++) {
-        rawop = sarrayGetString(sa, i, L_NOCOPY);
-        op = stringRemoveChars(rawop, " \r\n\t");
-        switch (op[0])
-        {
-        case 'd':
-        case 'D':
-        case 'e':
-        case 'E':
-        case 'o':
-        case 'O':
-        case 'c':
-        case 'C':
-            if (sscanf(&op[1], "%d.%d", &w, &h) != 2) {
-                lept_stderr("*** op: %s invalid\n", op);
-                valid = FALSE;
-                break;
-            }
-            if (w < 1 || (w & 1) == 0 || h < 1 || (h & 1) == 0 ) {
-                lept_stderr("*** op: %s; w = %d, h = %d; must both be odd\n",
-                            op, w, h);
-                valid = FALSE;
-                break;
-            }
-/*            lept_stderr("op = %s; w = %d, h = %d\n", op, w, h); */
-            break;
-        case 't':
-        case 'T':
-            if (op[1] != 'w' && op[1] != 'W' &&
-                op[1] != 'b' && op[1] != 'B') {
-                lept_stderr(
-                        "*** op = %s; arg %c must be 'w' or 'b'\n", op, op[1]);
-                valid = FALSE;
-                break;
-            }
-            sscanf(&op[2], "%d.%d", &w, &h);
-            if (w < 1 || (w & 1) == 0 || h < 1 || (h & 1) == 0 ) {
-                lept_stderr("*** op: %s; w = %d, h = %d; must both be odd\n",
-                            op, w, h);
-                valid = FALSE;
-                break;
-            }
-/*            lept_stderr("op = %s", op); */
-            break;
-        default:
-            lept_stderr("*** nonexistent op = %s\n", op);
-            valid = FALSE;
-        }
-        LEPT_FREE(op);
-    }
-    if (!valid) {
+    if (!grayMorphSequenceVerify(sa)) {
         sarrayDestroy(&sa);
         return (PIX *)ERROR_PTR("sequence invalid", __func__, NULL);
     }
@@ -993,30 +977,39 @@ SARRAY  *sa;
     for (i = 0; i < nops; i++) {
         rawop = sarrayGetString(sa, i, L_NOCOPY);
         op = stringRemoveChars(rawop, " \r\n\t");
+        sel = NULL;
+        if (op[0] != 't' && op[0] != 'T') {
+            if (op[1] == 'r' || op[1] == 'R') {
+                sscanf(&op[2], "%d", &w);
+                sel = selMakeDisk(w);
+            } else {
+                sscanf(&op[1], "%d.%d", &w, &h);
+            }
+        }
         switch (op[0])
         {
         case 'd':
         case 'D':
-            sscanf(&op[1], "%d.%d", &w, &h);
-            pix2 = pixDilateGray(pix1, w, h);
+            pix2 = (sel) ? pixDilateGraySel(pix1, sel) :
+                           pixDilateGray(pix1, w, h);
             pixSwapAndDestroy(&pix1, &pix2);
             break;
         case 'e':
         case 'E':
-            sscanf(&op[1], "%d.%d", &w, &h);
-            pix2 = pixErodeGray(pix1, w, h);
+            pix2 = (sel) ? pixErodeGraySel(pix1, sel) :
+                           pixErodeGray(pix1, w, h);
             pixSwapAndDestroy(&pix1, &pix2);
             break;
         case 'o':
         case 'O':
-            sscanf(&op[1], "%d.%d", &w, &h);
-            pix2 = pixOpenGray(pix1, w, h);
+            pix2 = (sel) ? pixOpenGraySel(pix1, sel) :
+                           pixOpenGray(pix1, w, h);
             pixSwapAndDestroy(&pix1, &pix2);
             break;
         case 'c':
         case 'C':
-            sscanf(&op[1], "%d.%d", &w, &h);
-            pix2 = pixCloseGray(pix1, w, h);
+            pix2 = (sel) ? pixCloseGraySel(pix1, sel) :
+                           pixCloseGray(pix1, w, h);
             pixSwapAndDestroy(&pix1, &pix2);
             break;
         case 't':
@@ -1032,6 +1025,7 @@ SARRAY  *sa;
             /* All invalid ops are caught in the first pass */
             break;
         }
+        selDestroy(&sel);
         LEPT_FREE(op);
 
             /* Debug output */
@@ -1055,6 +1049,92 @@ SARRAY  *sa;
 }
 
 
+/*!
+ * \brief   grayMorphSequenceVerify()
+ *
+ * \param[in]    sa    string array of operation sequence
+ * \return  TRUE if valid; FALSE otherwise or on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This does verification of valid grayscale morphological
+ *          operation sequences.
+ *      (2) See pixGrayMorphSequence() for notes on valid operations
+ *          in the sequence.
+ * </pre>
+ */
+l_int32
+grayMorphSequenceVerify(SARRAY  *sa)
+{
+char    *rawop, *op;
+l_int32  nops, i, valid, w, h;
+
+    if (!sa)
+        return ERROR_INT("sa not defined", __func__, FALSE);
+
+    nops = sarrayGetCount(sa);
+    valid = TRUE;
+    for (i = 0; i < nops; i++) {
+        rawop = sarrayGetString(sa, i, L_NOCOPY);
+        op = stringRemoveChars(rawop, " \r\n\t");
+        switch (op[0])
+        {
+        case 'd':
+        case 'D':
+        case 'e':
+        case 'E':
+        case 'o':
+        case 'O':
+        case 'c':
+        case 'C':
+            if (op[1] == 'r' || op[1] == 'R') {
+                if (sscanf(&op[2], "%d", &w) != 1 || w < 1) {
+                    lept_stderr("*** op: %s; disk radius must be >= 1\n", op);
+                    valid = FALSE;
+                }
+                break;
+            }
+            if (sscanf(&op[1], "%d.%d", &w, &h) != 2) {
+                lept_stderr("*** op: %s invalid\n", op);
+                valid = FALSE;
+                break;
+            }
+            if (w < 1 || (w & 1) == 0 || h < 1 || (h & 1) == 0 ) {
+                lept_stderr("*** op: %s; w = %d, h = %d; must both be odd\n",
+                            op, w, h);
+                valid = FALSE;
+                break;
+            }
+/*            lept_stderr("op = %s; w = %d, h = %d\n", op, w, h); */
+            break;
+        case 't':
+        case 'T':
+            if (op[1] != 'w' && op[1] != 'W' &&
+                op[1] != 'b' && op[1] != 'B') {
+                lept_stderr(
+                        "*** op = %s; arg %c must be 'w' or 'b'\n", op, op[1]);
+                valid = FALSE;
+                break;
+            }
+            sscanf(&op[2], "%d.%d", &w, &h);
+            if (w < 1 || (w & 1) == 0 || h < 1 || (h & 1) == 0 ) {
+                lept_stderr("*** op: %s; w = %d, h = %d; must both be odd\n",
+                            op, w, h);
+                valid = FALSE;
+                break;
+            }
+/*            lept_stderr("op = %s", op); */
+            break;
+        default:
+            lept_stderr("*** nonexistent op = %s\n", op);
+            valid = FALSE;
+        }
+        LEPT_FREE(op);
+    }
+    return valid;
+}
+
+
 /*-----------------------------------------------------------------*
  *         Run a sequence of color morphological operations        *
  *-----------------------------------------------------------------*/
@@ -1227,3 +1307,620 @@ SARRAY  *sa;
     sarrayDestroy(&sa);
     return pix1;
 }
+
+
+/*-----------------------------------------------------------------*
+ *             Compiled morphological sequence plans               *
+ *-----------------------------------------------------------------*/
+/*!
+ * \brief   morphPlanCreate()
+ *
+ * \param[in]    sequence   string specifying sequence
+ * \param[in]    depth      1 for binary or 8 for grayscale sequences
+ * \return  plan, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This parses and verifies %sequence once, so that it can be
+ *          run on many images with pixMorphPlanApply().  The format of
+ *          the sequence string for %depth = 1 is given in
+ *          pixMorphSequence(), and for %depth = 8 in pixGrayMorphSequence().
+ *      (2) Binary brick operations are decomposed here into a sequence
+ *          of linear dilations and erosions.  For each of these, the
+ *          dwa implementation is chosen if the linear Sel is in the
+ *          set generated by selaAddBasic(); otherwise the rasterop
+ *          implementation is used with a Sel that is made here.
+ *          Grayscale brick operations are decomposed in the same way,
+ *          as in pixErodeGray(), pixOpenGray(), etc.
+ *      (3) The plan is fixed to the binary boundary condition, MORPH_BC,
+ *          at the time it is made.  It is an error to apply it after
+ *          changing the boundary condition.
+ *      (4) The plan is not changed when it is applied, so a single
+ *          plan can be applied concurrently from several threads.
+ * </pre>
+ */
+L_MORPH_PLAN *
+morphPlanCreate(const char  *sequence,
+                l_int32      depth)
+{
+char          *rawop, *op;
+l_int32        nops, i, j, w, h, nred, index, maxtrans, margin, valid, type;
+l_int32        ret;
+L_MORPH_PLAN  *plan;
+L_MORPH_STEP  *step;
+SARRAY        *sa;
+SELA          *sela = NULL;
+
+    if (!sequence)
+        return (L_MORPH_PLAN *)ERROR_PTR("sequence not defined",
+                                         __func__, NULL);
+    if (depth != 1 && depth != 8)
+        return (L_MORPH_PLAN *)ERROR_PTR("depth not 1 or 8", __func__, NULL);
+
+    sa = sarrayCreate(0);
+    sarraySplitString(sa, sequence, "+");
+    nops = sarrayGetCount(sa);
+    valid = (depth == 1) ? morphSequenceVerify(sa) :
+                           grayMorphSequenceVerify(sa);
+    if (!valid || nops == 0) {
+        sarrayDestroy(&sa);
+        return (L_MORPH_PLAN *)ERROR_PTR("sequence not valid", __func__, NULL);
+    }
+
+        /* A binary brick op gives at most 4 linear steps */
+    plan = (L_MORPH_PLAN *)LEPT_CALLOC(1, sizeof(L_MORPH_PLAN));
+    if (plan)
+        plan->steps = (L_MORPH_STEP *)LEPT_CALLOC(4 * nops,
+                                                  sizeof(L_MORPH_STEP));
+    if (!plan || !plan->steps) {
+        morphPlanDestroy(&plan);
+        sarrayDestroy(&sa);
+        return (L_MORPH_PLAN *)ERROR_PTR("plan not made", __func__, NULL);
+    }
+    plan->depth = depth;
+    plan->bc = MORPH_BC;
+    if (depth == 1 && (sela = selaAddBasic(NULL)) == NULL) {
+        morphPlanDestroy(&plan);
+        sarrayDestroy(&sa);
+        return (L_MORPH_PLAN *)ERROR_PTR("sela not made", __func__, NULL);
+    }
+
+    margin = 0;
+    ret = 0;
+    for (i = 0; i < nops && !ret; i++) {
+        rawop = sarrayGetString(sa, i, L_NOCOPY);
+        op = stringRemoveChars(rawop, " \r\n\t");
+        if (depth == 8) {
+            switch (op[0])
+            {
+            case 'd':
+            case 'D':
+                type = L_PLAN_DILATE;
+                break;
+            case 'e':
+            case 'E':
+                type = L_PLAN_ERODE;
+                break;
+            case 'o':
+            case 'O':
+                type = L_PLAN_OPEN;
+                break;
+            case 'c':
+            case 'C':
+                type = L_PLAN_CLOSE;
+                break;
+            default:  /* 't' or 'T' */
+                type = (op[1] == 'w' || op[1] == 'W') ?
+                       L_PLAN_TOPHAT_WHITE : L_PLAN_TOPHAT_BLACK;
+                break;
+            }
+            if (type == L_PLAN_TOPHAT_WHITE || type == L_PLAN_TOPHAT_BLACK) {
+                step = &plan->steps[plan->nsteps++];
+                step->type = type;
+                sscanf(&op[2], "%d.%d", &step->w, &step->h);
+            } else if (op[1] == 'r' || op[1] == 'R') {
+                step = &plan->steps[plan->nsteps++];
+                step->type = type;
+                sscanf(&op[2], "%d", &step->w);
+                if ((step->sel = selMakeDisk(step->w)) == NULL)
+                    ret = 1;
+            } else {
+                    /* The margin is the frame needed by the linear steps */
+                sscanf(&op[1], "%d.%d", &w, &h);
+                margin = L_MAX(margin, (3 * L_MAX(w, h) + 1) / 2);
+                if (type == L_PLAN_ERODE || type == L_PLAN_OPEN) {
+                    ret += morphPlanAddLinear(plan, NULL, L_PLAN_ERODE,
+                                              w, 1, 1);
+                    ret += morphPlanAddLinear(plan, NULL, L_PLAN_ERODE,
+                                              1, h, 1);
+                }
+                if (type != L_PLAN_ERODE) {
+                    ret += morphPlanAddLinear(plan, NULL, L_PLAN_DILATE,
+                                              w, 1, 1);
+                    ret += morphPlanAddLinear(plan, NULL, L_PLAN_DILATE,
+                                              1, h, 1);
+                }
+                if (type == L_PLAN_CLOSE) {
+                    ret += morphPlanAddLinear(plan, NULL, L_PLAN_ERODE,
+                                              w, 1, 1);
+                    ret += morphPlanAddLinear(plan, NULL, L_PLAN_ERODE,
+                                              1, h, 1);
+                }
+            }
+            LEPT_FREE(op);
+            continue;
+        }
+
+        switch (op[0])
+        {
+        case 'd':
+        case 'D':
+            sscanf(&op[1], "%d.%d", &w, &h);
+            ret += morphPlanAddLinear(plan, sela, L_PLAN_DILATE, w, 1, 1);
+            ret += morphPlanAddLinear(plan, sela, L_PLAN_DILATE, 1, h, 1);
+            break;
+        case 'e':
+        case 'E':
+            sscanf(&op[1], "%d.%d", &w, &h);
+            ret += morphPlanAddLinear(plan, sela, L_PLAN_ERODE, w, 1, 1);
+            ret += morphPlanAddLinear(plan, sela, L_PLAN_ERODE, 1, h, 1);
+            break;
+        case 'o':
+        case 'O':
+            sscanf(&op[1], "%d.%d", &w, &h);
+            ret += morphPlanAddLinear(plan, sela, L_PLAN_ERODE, w, 1, 1);
+            ret += morphPlanAddLinear(plan, sela, L_PLAN_ERODE, 1, h, 1);
+            ret += morphPlanAddLinear(plan, sela, L_PLAN_DILATE, w, 1, 1);
+            ret += morphPlanAddLinear(plan, sela, L_PLAN_DILATE, 1, h, 1);
+            break;
+        case 'c':
+        case 'C':
+                /* This is the safe closing.  With asymmetric b.c., the
+                 * dilation must not be clipped before the erosion, so
+                 * only the first step resets the full frame border;
+                 * the frame gets an extra margin for the spillover.
+                 * With symmetric b.c., this is an ordinary closing. */
+            sscanf(&op[1], "%d.%d", &w, &h);
+            if (w == 1 && h == 1)
+                break;
+            if (plan->bc == SYMMETRIC_MORPH_BC) {
+                ret += morphPlanAddLinear(plan, sela, L_PLAN_DILATE, w, 1, 1);
+                ret += morphPlanAddLinear(plan, sela, L_PLAN_DILATE, 1, h, 1);
+                ret += morphPlanAddLinear(plan, sela, L_PLAN_ERODE, w, 1, 1);
+                ret += morphPlanAddLinear(plan, sela, L_PLAN_ERODE, 1, h, 1);
+            } else {
+                maxtrans = L_MAX(w / 2, h / 2);
+                margin = L_MAX(margin, 32 * ((maxtrans + 31) / 32));
+                index = plan->nsteps;
+                ret += morphPlanAddLinear(plan, sela, L_PLAN_DILATE, w, 1, 0);
+                ret += morphPlanAddLinear(plan, sela, L_PLAN_DILATE, 1, h, 0);
+                ret += morphPlanAddLinear(plan, sela, L_PLAN_ERODE, w, 1, 0);
+                ret += morphPlanAddLinear(plan, sela, L_PLAN_ERODE, 1, h, 0);
+                plan->steps[index].resetall = 1;
+            }
+            break;
+        case 'r':
+        case 'R':
+            step = &plan->steps[plan->nsteps++];
+            step->type = L_PLAN_REDUCE;
+            nred = strlen(op) - 1;
+            for (j = 0; j < nred; j++)
+                step->level[j] = op[j + 1] - '0';
+            break;
+        case 'x':
+        case 'X':
+            step = &plan->steps[plan->nsteps++];
+            step->type = L_PLAN_EXPAND;
+            sscanf(&op[1], "%d", &step->w);
+            break;
+        case 'b':
+        case 'B':  /* verified to be the first op */
+            sscanf(&op[1], "%d", &plan->border);
+            break;
+        default:
+            break;
+        }
+        LEPT_FREE(op);
+    }
+    plan->frame = (depth == 1) ? 32 + margin : margin;
+
+    selaDestroy(&sela);
+    sarrayDestroy(&sa);
+    if (ret) {
+        morphPlanDestroy(&plan);
+        return (L_MORPH_PLAN *)ERROR_PTR("plan steps not made", __func__,
+                                         NULL);
+    }
+    return plan;
+}
+
+
+/*!
+ * \brief   morphPlanDestroy()
+ *
+ * \param[in,out]   pplan    will be set to null before returning
+ * \return  void
+ */
+void
+morphPlanDestroy(L_MORPH_PLAN  **pplan)
+{
+l_int32        i;
+L_MORPH_PLAN  *plan;
+
+    if (pplan == NULL) {
+        L_WARNING("ptr address is null!\n", __func__);
+        return;
+    }
+    if ((plan = *pplan) == NULL)
+        return;
+
+    for (i = 0; i < plan->nsteps; i++) {
+        selDestroy(&plan->steps[i].sel);
+        LEPT_FREE(plan->steps[i].selname);
+    }
+    LEPT_FREE(plan->steps);
+    LEPT_FREE(plan);
+    *pplan = NULL;
+}
+
+
+/*!
+ * \brief   pixMorphPlanApply()
+ *
+ * \param[in]    pixs     1 or 8 bpp, matching the depth of the plan
+ * \param[in]    plan     made by morphPlanCreate()
+ * \param[in]    pixaw    [optional] work buffers; can be null
+ * \return  pixd, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This runs a compiled sequence on pixs.  The result is the
+ *          same as from pixMorphSequence() or pixGrayMorphSequence()
+ *          with the sequence string used to make the plan.  A new
+ *          image is always produced.
+ *      (2) Binary images are copied once into a frame with a border
+ *          of at least 32 pixels, which is what the dwa operations
+ *          require.  All the linear steps then alternate between two
+ *          frame buffers; the border is reset before each step to
+ *          give the same boundary conditions as the unbordered ops.
+ *          New buffers are only made when reductions or expansions
+ *          change the image size.
+ *      (3) If %pixaw is given, the frame buffers are kept in it and
+ *          reused by later calls with images of the same size, so
+ *          that repeated application does no image allocation for
+ *          the morphological steps.  Start with an empty pixa, and
+ *          destroy it when done.  For concurrent application of the
+ *          same plan, each thread must use its own %pixaw.
+ *      (4) Grayscale plans are run in the same way, on two 8 bpp frame
+ *          buffers whose border is reset by each linear step; see
+ *          pixGrayMorphLinearFramed().  The steps with a disk Sel and
+ *          the tophats are done with the functions that make a new
+ *          image, and their result is copied back into the frame.
+ * </pre>
+ */
+PIX *
+pixMorphPlanApply(PIX           *pixs,
+                  L_MORPH_PLAN  *plan,
+                  PIXA          *pixaw)
+{
+l_int32        i, j, w, h, ws, hs, frame, border, level, ring, op, color;
+l_float32      scale;
+L_MORPH_STEP  *step;
+PIX           *pix1, *pix2, *pix3, *pixd;
+
+    if (!pixs)
+        return (PIX *)ERROR_PTR("pixs not defined", __func__, NULL);
+    if (!plan)
+        return (PIX *)ERROR_PTR("plan not defined", __func__, NULL);
+    if (pixGetDepth(pixs) != plan->depth)
+        return (PIX *)ERROR_PTR("depths of pixs and plan differ",
+                                __func__, NULL);
+    if (plan->depth == 8)
+        return morphPlanApplyGray(pixs, plan, pixaw);
+    if (plan->bc != MORPH_BC)
+        return (PIX *)ERROR_PTR("boundary condition changed since plan made",
+                                __func__, NULL);
+
+        /* Copy the input into the first frame, inside any added border */
+    frame = plan->frame;
+    border = plan->border;
+    pixGetDimensions(pixs, &ws, &hs, NULL);
+    w = ws + 2 * border;
+    h = hs + 2 * border;
+    level = 0;
+    pix1 = morphPlanGetBuffer(pixaw, 0, w + 2 * frame, h + 2 * frame, 1);
+    pix2 = morphPlanGetBuffer(pixaw, 1, w + 2 * frame, h + 2 * frame, 1);
+    if (!pix1 || !pix2) {
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        return (PIX *)ERROR_PTR("frame buffers not made", __func__, NULL);
+    }
+    if (border > 0)
+        pixClearAll(pix1);
+    pixRasterop(pix1, frame + border, frame + border, ws, hs, PIX_SRC,
+                pixs, 0, 0);
+
+    scale = 1.0;
+    color = getMorphBorderPixelColor(L_MORPH_ERODE, 1);
+    for (i = 0; i < plan->nsteps; i++) {
+        step = &plan->steps[i];
+        if (step->type == L_PLAN_DILATE || step->type == L_PLAN_ERODE) {
+            op = (step->type == L_PLAN_DILATE) ? L_MORPH_DILATE :
+                                                 L_MORPH_ERODE;
+            ring = (step->resetall) ? frame : 32;
+            pixSetOrClearBorder(pix1, ring, ring, ring, ring,
+                      (op == L_MORPH_ERODE && color) ? PIX_SET : PIX_CLR);
+            if (step->selname)
+                pixFMorphopGen_1(pix2, pix1, op, step->selname);
+            else if (op == L_MORPH_DILATE)
+                pixDilate(pix2, pix1, step->sel);
+            else
+                pixErode(pix2, pix1, step->sel);
+            pix3 = pix1;
+            pix1 = pix2;
+            pix2 = pix3;
+            continue;
+        }
+
+            /* Reduction or expansion: move to frames of the new size */
+        pix3 = pixCreate(w, h, 1);
+        pixRasterop(pix3, 0, 0, w, h, PIX_SRC, pix1, frame, frame);
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        if (step->type == L_PLAN_REDUCE) {
+            pixd = pixReduceRankBinaryCascade(pix3, step->level[0],
+                                              step->level[1], step->level[2],
+                                              step->level[3]);
+        } else {
+            pixd = pixExpandReplicate(pix3, step->w);
+        }
+        pixDestroy(&pix3);
+        if (!pixd)
+            return (PIX *)ERROR_PTR("pixd not made", __func__, NULL);
+        if (step->type == L_PLAN_REDUCE) {
+            for (j = 0; j < 4 && step->level[j] > 0; j++)
+                scale *= 0.5;
+        } else {
+            scale *= step->w;
+        }
+        pixGetDimensions(pixd, &w, &h, NULL);
+        level++;
+        pix1 = morphPlanGetBuffer(pixaw, 2 * level,
+                                  w + 2 * frame, h + 2 * frame, 1);
+        pix2 = morphPlanGetBuffer(pixaw, 2 * level + 1,
+                                  w + 2 * frame, h + 2 * frame, 1);
+        if (!pix1 || !pix2) {
+            pixDestroy(&pix1);
+            pixDestroy(&pix2);
+            pixDestroy(&pixd);
+            return (PIX *)ERROR_PTR("frame buffers not made", __func__, NULL);
+        }
+        pixRasterop(pix1, frame, frame, w, h, PIX_SRC, pixd, 0, 0);
+        pixDestroy(&pixd);
+    }
+
+        /* Extract the result, removing any added border */
+    w -= 2 * border;
+    h -= 2 * border;
+    if ((pixd = pixCreate(w, h, 1)) != NULL) {
+        pixRasterop(pixd, 0, 0, w, h, PIX_SRC, pix1,
+                    frame + border, frame + border);
+        pixCopyResolution(pixd, pixs);
+        if (scale != 1.0)
+            pixScaleResolution(pixd, scale, scale);
+        pixCopyInputFormat(pixd, pixs);
+    }
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    if (!pixd)
+        return (PIX *)ERROR_PTR("pixd not made", __func__, NULL);
+    return pixd;
+}
+
+
+/*!
+ * \brief   morphPlanAddLinear()
+ *
+ * \param[in]    plan
+ * \param[in]    sela       from selaAddBasic(), for dwa Sel names
+ * \param[in]    type       L_PLAN_DILATE or L_PLAN_ERODE
+ * \param[in]    hsize      horizontal size of linear Sel
+ * \param[in]    vsize      vertical size of linear Sel
+ * \param[in]    resetall   1 to reset the full frame border before the step
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) One of %hsize and %vsize must be 1.  If both are 1, the
+ *          step is the identity and is not added.
+ *      (2) If the Sel is one of the basic linear Sels, the step uses
+ *          the generated dwa code; otherwise it uses rasterop with
+ *          a brick Sel made here.  The origin is at the center, as
+ *          in pixDilateBrick() and pixDilateBrickDwa().
+ *      (3) If %sela is null, this is a grayscale step, which is done
+ *          with the vHGW method and needs no Sel.
+ * </pre>
+ */
+static l_int32
+morphPlanAddLinear(L_MORPH_PLAN  *plan,
+                   SELA          *sela,
+                   l_int32        type,
+                   l_int32        hsize,
+                   l_int32        vsize,
+                   l_int32        resetall)
+{
+char           name[32];
+l_int32        index;
+L_MORPH_STEP  *step;
+
+    if (hsize == 1 && vsize == 1)
+        return 0;
+
+    step = &plan->steps[plan->nsteps++];
+    step->type = type;
+    step->w = hsize;
+    step->h = vsize;
+    step->resetall = resetall;
+    if (!sela)
+        return 0;
+    if (hsize > 1)
+        snprintf(name, sizeof(name), "sel_%dh", hsize);
+    else
+        snprintf(name, sizeof(name), "sel_%dv", vsize);
+    if (selaFindSelByName(sela, name, &index, NULL) == 0) {
+        step->selname = stringNew(name);
+    } else {
+        step->sel = selCreateBrick(vsize, hsize, vsize / 2, hsize / 2,
+                                   SEL_HIT);
+        if (!step->sel)
+            return ERROR_INT("sel not made", __func__, 1);
+    }
+    return 0;
+}
+
+
+/*!
+ * \brief   morphPlanGetBuffer()
+ *
+ * \param[in]    pixaw    [optional] work buffers; can be null
+ * \param[in]    index    buffer index in %pixaw
+ * \param[in]    w, h     required size
+ * \param[in]    d        required depth: 1 or 8
+ * \return  pix of size w x h and depth d, with undefined contents,
+ *          or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) If %pixaw is null, this makes a new pix.  Otherwise, it
+ *          returns a clone of the pix at %index if it has the right
+ *          size, and otherwise stores a new one there.
+ * </pre>
+ */
+static PIX *
+morphPlanGetBuffer(PIXA    *pixaw,
+                   l_int32  index,
+                   l_int32  w,
+                   l_int32  h,
+                   l_int32  d)
+{
+l_int32  wt, ht;
+PIX     *pix;
+
+    if (!pixaw)
+        return pixCreateNoInit(w, h, d);
+
+    while (pixaGetCount(pixaw) <= index)
+        pixaAddPix(pixaw, pixCreate(1, 1, 1), L_INSERT);
+    pix = pixaGetPix(pixaw, index, L_CLONE);
+    pixGetDimensions(pix, &wt, &ht, NULL);
+    if (wt == w && ht == h && pixGetDepth(pix) == d)
+        return pix;
+
+    pixDestroy(&pix);
+    if ((pix = pixCreateNoInit(w, h, d)) == NULL)
+        return (PIX *)ERROR_PTR("pix not made", __func__, NULL);
+    pixaReplacePix(pixaw, index, pixClone(pix), NULL);
+    return pix;
+}
+
+
+/*!
+ * \brief   morphPlanApplyGray()
+ *
+ * \param[in]    pixs     8 bpp
+ * \param[in]    plan     grayscale plan
+ * \param[in]    pixaw    [optional] work buffers; can be null
+ * \return  pixd, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The linear steps alternate between two frame buffers, as in
+ *          the binary path of pixMorphPlanApply().
+ * </pre>
+ */
+static PIX *
+morphPlanApplyGray(PIX           *pixs,
+                   L_MORPH_PLAN  *plan,
+                   PIXA          *pixaw)
+{
+l_int32        i, w, h, frame, op, ret;
+L_MORPH_STEP  *step;
+PIX           *pix1, *pix2, *pix3, *pixt, *pixd;
+
+    frame = plan->frame;
+    pixGetDimensions(pixs, &w, &h, NULL);
+    pix1 = morphPlanGetBuffer(pixaw, 0, w + 2 * frame, h + 2 * frame, 8);
+    pix2 = morphPlanGetBuffer(pixaw, 1, w + 2 * frame, h + 2 * frame, 8);
+    pixt = pixCreateNoInit(w, h, 8);
+    if (!pix1 || !pix2 || !pixt) {
+        pixDestroy(&pix1);
+        pixDestroy(&pix2);
+        pixDestroy(&pixt);
+        return (PIX *)ERROR_PTR("frame buffers not made", __func__, NULL);
+    }
+    pixRasterop(pix1, frame, frame, w, h, PIX_SRC, pixs, 0, 0);
+
+    ret = 0;
+    for (i = 0; i < plan->nsteps && ret == 0; i++) {
+        step = &plan->steps[i];
+        if ((step->type == L_PLAN_DILATE || step->type == L_PLAN_ERODE) &&
+            !step->sel) {
+            op = (step->type == L_PLAN_DILATE) ? L_MORPH_DILATE :
+                                                 L_MORPH_ERODE;
+            if (step->h == 1)
+                ret = pixGrayMorphLinearFramed(pix2, pix1, frame, op,
+                                               step->w, L_HORIZ);
+            else
+                ret = pixGrayMorphLinearFramed(pix2, pix1, frame, op,
+                                               step->h, L_VERT);
+            pix3 = pix1;
+            pix1 = pix2;
+            pix2 = pix3;
+            continue;
+        }
+
+            /* Disk Sels and tophats: make the result and copy it back */
+        pixRasterop(pixt, 0, 0, w, h, PIX_SRC, pix1, frame, frame);
+        switch (step->type)
+        {
+        case L_PLAN_DILATE:
+            pixd = pixDilateGraySel(pixt, step->sel);
+            break;
+        case L_PLAN_ERODE:
+            pixd = pixErodeGraySel(pixt, step->sel);
+            break;
+        case L_PLAN_OPEN:
+            pixd = pixOpenGraySel(pixt, step->sel);
+            break;
+        case L_PLAN_CLOSE:
+            pixd = pixCloseGraySel(pixt, step->sel);
+            break;
+        case L_PLAN_TOPHAT_WHITE:
+            pixd = pixTophat(pixt, step->w, step->h, L_TOPHAT_WHITE);
+            break;
+        default:  /* L_PLAN_TOPHAT_BLACK */
+            pixd = pixTophat(pixt, step->w, step->h, L_TOPHAT_BLACK);
+            break;
+        }
+        if (pixd)
+            pixRasterop(pix1, frame, frame, w, h, PIX_SRC, pixd, 0, 0);
+        else
+            ret = 1;
+        pixDestroy(&pixd);
+    }
+
+        /* Extract the result */
+    pixd = NULL;
+    if (ret == 0) {
+        pixRasterop(pixt, 0, 0, w, h, PIX_SRC, pix1, frame, frame);
+        pixd = pixClone(pixt);
+        pixCopyResolution(pixd, pixs);
+        pixCopyInputFormat(pixd, pixs);
+    }
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    pixDestroy(&pixt);
+    if (!pixd)
+        return (PIX *)ERROR_PTR("pixd not made", __func__, NULL);
+    return pixd;
+}
@@ -0,0 +1,1360 @@
+/*====================================================================*
+ -  Copyright (C) 2001 Leptonica.  All rights reserved.
+ -
+ -  Redistribution and use in source and binary forms, with or without
+ -  modification, are permitted provided that the following conditions
+ -  are met:
+ -  1. Redistributions of source code must retain the above copyright
+ -     notice, this list of conditions and the following disclaimer.
+ -  2. Redistributions in binary form must reproduce the above
+ -     copyright notice, this list of conditions and the following
+ -     disclaimer in the documentation and/or other materials
+ -     provided with the distribution.
+ -
+ -  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ -  ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ -  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ -  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL ANY
+ -  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ -  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ -  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ -  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ -  OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ -  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ -  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *====================================================================*/
+
+/*!
+ * \file pboxa.c
+ * <pre>
+ *
+ *      Create/Destroy/Copy
+ *          L_PBOXA      *pboxaCreate()
+ *          void          pboxaDestroy()
+ *          L_PBOXA      *pboxaCopy()
+ *
+ *      Accessors
+ *          l_int32       pboxaGetCount()
+ *          l_ok          pboxaAddBox()
+ *          l_ok          pboxaGetBoxGeometry()
+ *
+ *      Conversion to and from boxa
+ *          L_PBOXA      *boxaConvertToPboxa()
+ *          BOXA         *pboxaConvertToBoxa()
+ *
+ *      Box operations
+ *          l_ok          pboxaGetExtent()
+ *          L_PBOXA      *pboxaSort()
+ *          L_PBOXA      *pboxaSelectBySize()
+ *          L_PBOXA      *pboxaIntersectsBox()
+ *          L_PBOXA      *pboxaCombineOverlaps()
+ *          l_ok          pboxaCombineOverlapsInPair()
+ *
+ *      Spatial index
+ *          L_BOXGRID    *boxgridCreate()
+ *          void          boxgridDestroy()
+ *          NUMA         *boxgridFindIntersecting()
+ *
+ *      Static helpers
+ *          static l_int32     pboxaExtendArrays()
+ *          static l_int32     pboxaSortCompare()
+ *          static l_int32     pboxaSaveValidLow()
+ *          static void        pboxaAbsorbOverlaps()
+ *          static L_BOXGRID  *boxgridCreateLow()
+ *          static l_int32     boxgridCollect()
+ *          static l_int32     intSortCompare()
+ *
+ *  A BOXA is an array of pointers to separately allocated boxes.  For
+ *  a page with a very large number of connected components, making
+ *  the boxa costs one allocation per box, and every operation on it
+ *  follows a pointer for each box; operations that make new boxes,
+ *  such as boxaCombineOverlaps(), allocate in their inner loops.
+ *  The L_PBOXA holds the same boxes packed into four parallel
+ *  arrays of x, y, w and h, so an array of boxes is 4 allocations,
+ *  and the operations here work directly on the arrays.  They give
+ *  the same results as the corresponding boxa functions:
+ *          pboxaGetExtent()          boxaGetExtent()
+ *          pboxaSort()               boxaSort()
+ *          pboxaSelectBySize()       boxaSelectBySize()
+ *          pboxaIntersectsBox()      boxaIntersectsBox()
+ *          pboxaCombineOverlaps()    boxaCombineOverlaps()
+ *          pboxaCombineOverlapsInPair()   boxaCombineOverlapsInPair()
+ *  except that pboxaSort() is stable, so boxes with equal sort keys
+ *  are kept in their original order.
+ *
+ *  The L_BOXGRID is a spatial index over a set of boxes: a uniform
+ *  grid of cells, each holding the indices of the boxes that touch it.
+ *  Finding the boxes that intersect a region only looks at the boxes
+ *  in the cells it covers, so for a page of small components a query
+ *  is O(1) instead of O(n).  The overlap-combining functions here use
+ *  it for large sets, which makes each iteration near-linear instead
+ *  of O(n^2), with the same result as the pairwise scan.  It is also
+ *  used by boxaHandleOverlaps() and boxaContainedInBoxa().
+ *
+ *  Typical use is
+ *          pba1 = boxaConvertToPboxa(boxa);
+ *          pba2 = pboxaSelectBySize(pba1, 5, 5, L_SELECT_IF_BOTH,
+ *                                   L_SELECT_IF_GTE, NULL);
+ *          pba3 = pboxaCombineOverlaps(pba2);
+ *          boxad = pboxaConvertToBoxa(pba3);
+ * </pre>
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config_auto.h>
+#endif  /* HAVE_CONFIG_H */
+
+#include <string.h>
+#include "allheaders.h"
+#include "pix_internal.h"
+
+    /* Initial and maximum size of the box arrays */
+static const l_int32  InitialBoxAlloc = 64;
+static const l_int32  MaxPboxaArraySize = 10000000;
+
+    /* Below this number of boxes, overlaps are found by pairwise scan */
+static const l_int32  MinBoxesForGrid = 48;
+
+    /* Sort key and original index, for pboxaSort() */
+struct PboxaSortItem
+{
+    l_float64  key;
+    l_int32    index;
+};
+
+static l_int32 pboxaExtendArrays(L_PBOXA *pba, l_int32 size);
+static l_int32 pboxaSortCompare(const void *item1, const void *item2);
+static l_int32 pboxaSaveValidLow(L_PBOXA *pba);
+static l_int32 pboxaAbsorbOverlaps(L_PBOXA *pbd, L_PBOXA *pbs,
+                                   l_int32 bigger);
+static L_BOXGRID *boxgridCreateLow(L_PBOXA *pba, l_int32 cellw,
+                                   l_int32 cellh);
+static l_int32 boxgridCollect(L_BOXGRID *grid, l_int32 l, l_int32 t,
+                              l_int32 r, l_int32 b, l_int32 minindex,
+                              l_int32 **pcand, l_int32 *pncand,
+                              l_int32 *pnalloc);
+static l_int32 intSortCompare(const void *item1, const void *item2);
+
+
+/*--------------------------------------------------------------------*
+ *                        Create/Destroy/Copy                         *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   pboxaCreate()
+ *
+ * \param[in]    n     initial number of boxes allocated; 0 for default
+ * \return  pboxa, or NULL on error
+ */
+L_PBOXA *
+pboxaCreate(l_int32  n)
+{
+L_PBOXA  *pba;
+
+    if (n <= 0 || n > MaxPboxaArraySize)
+        n = InitialBoxAlloc;
+
+    pba = (L_PBOXA *)LEPT_CALLOC(1, sizeof(L_PBOXA));
+    if (pboxaExtendArrays(pba, n)) {
+        pboxaDestroy(&pba);
+        return (L_PBOXA *)ERROR_PTR("arrays not made", __func__, NULL);
+    }
+    return pba;
+}
+
+
+/*!
+ * \brief   pboxaDestroy()
+ *
+ * \param[in,out]   ppba   will be set to null before returning
+ * \return  void
+ */
+void
+pboxaDestroy(L_PBOXA  **ppba)
+{
+L_PBOXA  *pba;
+
+    if (ppba == NULL) {
+        L_WARNING("ptr address is null!\n", __func__);
+        return;
+    }
+    if ((pba = *ppba) == NULL)
+        return;
+
+    LEPT_FREE(pba->x);
+    LEPT_FREE(pba->y);
+    LEPT_FREE(pba->w);
+    LEPT_FREE(pba->h);
+    LEPT_FREE(pba);
+    *ppba = NULL;
+}
+
+
+/*!
+ * \brief   pboxaCopy()
+ *
+ * \param[in]    pbas
+ * \return  pbad, or NULL on error
+ */
+L_PBOXA *
+pboxaCopy(L_PBOXA  *pbas)
+{
+L_PBOXA  *pbad;
+
+    if (!pbas)
+        return (L_PBOXA *)ERROR_PTR("pbas not defined", __func__, NULL);
+
+    if ((pbad = pboxaCreate(pbas->n)) == NULL)
+        return (L_PBOXA *)ERROR_PTR("pbad not made", __func__, NULL);
+    memcpy(pbad->x, pbas->x, pbas->n * sizeof(l_int32));
+    memcpy(pbad->y, pbas->y, pbas->n * sizeof(l_int32));
+    memcpy(pbad->w, pbas->w, pbas->n * sizeof(l_int32));
+    memcpy(pbad->h, pbas->h, pbas->n * sizeof(l_int32));
+    pbad->n = pbas->n;
+    return pbad;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                             Accessors                              *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   pboxaGetCount()
+ *
+ * \param[in]    pba
+ * \return  count of boxes; 0 if no boxes or on error
+ */
+l_int32
+pboxaGetCount(L_PBOXA  *pba)
+{
+    if (!pba)
+        return ERROR_INT("pba not defined", __func__, 0);
+    return pba->n;
+}
+
+
+/*!
+ * \brief   pboxaAddBox()
+ *
+ * \param[in]    pba
+ * \param[in]    x, y, w, h    box geometry
+ * \return  0 if OK, 1 on error
+ */
+l_ok
+pboxaAddBox(L_PBOXA  *pba,
+            l_int32   x,
+            l_int32   y,
+            l_int32   w,
+            l_int32   h)
+{
+l_int32  n;
+
+    if (!pba)
+        return ERROR_INT("pba not defined", __func__, 1);
+
+    n = pba->n;
+    if (n >= pba->nalloc) {
+        if (pba->nalloc >= MaxPboxaArraySize)
+            return ERROR_INT("too many boxes", __func__, 1);
+        if (pboxaExtendArrays(pba, L_MIN(2 * pba->nalloc,
+                                         MaxPboxaArraySize)))
+            return ERROR_INT("extension failed", __func__, 1);
+    }
+    pba->x[n] = x;
+    pba->y[n] = y;
+    pba->w[n] = w;
+    pba->h[n] = h;
+    pba->n++;
+    return 0;
+}
+
+
+/*!
+ * \brief   pboxaGetBoxGeometry()
+ *
+ * \param[in]    pba
+ * \param[in]    index         to the index-th box
+ * \param[out]   px, py, pw, ph    [optional] each can be null
+ * \return  0 if OK, 1 on error
+ */
+l_ok
+pboxaGetBoxGeometry(L_PBOXA  *pba,
+                    l_int32   index,
+                    l_int32  *px,
+                    l_int32  *py,
+                    l_int32  *pw,
+                    l_int32  *ph)
+{
+    if (px) *px = 0;
+    if (py) *py = 0;
+    if (pw) *pw = 0;
+    if (ph) *ph = 0;
+    if (!pba)
+        return ERROR_INT("pba not defined", __func__, 1);
+    if (index < 0 || index >= pba->n)
+        return ERROR_INT("index not valid", __func__, 1);
+
+    if (px) *px = pba->x[index];
+    if (py) *py = pba->y[index];
+    if (pw) *pw = pba->w[index];
+    if (ph) *ph = pba->h[index];
+    return 0;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                   Conversion to and from boxa                      *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   boxaConvertToPboxa()
+ *
+ * \param[in]    boxa
+ * \return  pba, or NULL on error
+ */
+L_PBOXA *
+boxaConvertToPboxa(BOXA  *boxa)
+{
+l_int32   i, n;
+BOX      *box;
+L_PBOXA  *pba;
+
+    if (!boxa)
+        return (L_PBOXA *)ERROR_PTR("boxa not defined", __func__, NULL);
+
+    n = boxaGetCount(boxa);
+    if ((pba = pboxaCreate(n)) == NULL)
+        return (L_PBOXA *)ERROR_PTR("pba not made", __func__, NULL);
+    for (i = 0; i < n; i++) {
+        box = boxa->box[i];
+        pba->x[i] = box->x;
+        pba->y[i] = box->y;
+        pba->w[i] = box->w;
+        pba->h[i] = box->h;
+    }
+    pba->n = n;
+    return pba;
+}
+
+
+/*!
+ * \brief   pboxaConvertToBoxa()
+ *
+ * \param[in]    pba
+ * \return  boxa, or NULL on error
+ */
+BOXA *
+pboxaConvertToBoxa(L_PBOXA  *pba)
+{
+l_int32  i, n;
+BOXA    *boxa;
+
+    if (!pba)
+        return (BOXA *)ERROR_PTR("pba not defined", __func__, NULL);
+
+    n = pba->n;
+    if ((boxa = boxaCreate(n)) == NULL)
+        return (BOXA *)ERROR_PTR("boxa not made", __func__, NULL);
+    for (i = 0; i < n; i++) {
+        boxaAddBox(boxa, boxCreate(pba->x[i], pba->y[i], pba->w[i],
+                                   pba->h[i]), L_INSERT);
+    }
+    return boxa;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                           Box operations                           *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   pboxaGetExtent()
+ *
+ * \param[in]    pba
+ * \param[out]   pw      [optional] width
+ * \param[out]   ph      [optional] height
+ * \param[out]   pbox    [optional]  minimum box containing all boxes
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) See boxaGetExtent().  Boxes with w <= 0 or h <= 0 are ignored.
+ * </pre>
+ */
+l_ok
+pboxaGetExtent(L_PBOXA  *pba,
+               l_int32  *pw,
+               l_int32  *ph,
+               BOX     **pbox)
+{
+l_int32  i, n, xmax, ymax, xmin, ymin, found;
+
+    if (!pw && !ph && !pbox)
+        return ERROR_INT("no ptrs defined", __func__, 1);
+    if (pw) *pw = 0;
+    if (ph) *ph = 0;
+    if (pbox) *pbox = NULL;
+    if (!pba)
+        return ERROR_INT("pba not defined", __func__, 1);
+
+    n = pba->n;
+    xmax = ymax = 0;
+    xmin = ymin = 100000000;
+    found = FALSE;
+    for (i = 0; i < n; i++) {
+        if (pba->w[i] <= 0 || pba->h[i] <= 0)
+            continue;
+        found = TRUE;
+        xmin = L_MIN(xmin, pba->x[i]);
+        ymin = L_MIN(ymin, pba->y[i]);
+        xmax = L_MAX(xmax, pba->x[i] + pba->w[i]);
+        ymax = L_MAX(ymax, pba->y[i] + pba->h[i]);
+    }
+    if (found == FALSE)
+        xmin = ymin = 0;
+    if (pw) *pw = xmax;
+    if (ph) *ph = ymax;
+    if (pbox)
+        *pbox = boxCreate(xmin, ymin, xmax - xmin, ymax - ymin);
+    return 0;
+}
+
+
+/*!
+ * \brief   pboxaSort()
+ *
+ * \param[in]    pbas
+ * \param[in]    sorttype     L_SORT_BY_X, L_SORT_BY_Y,
+ *                            L_SORT_BY_RIGHT, L_SORT_BY_BOT,
+ *                            L_SORT_BY_WIDTH, L_SORT_BY_HEIGHT,
+ *                            L_SORT_BY_MIN_DIMENSION, L_SORT_BY_MAX_DIMENSION,
+ *                            L_SORT_BY_PERIMETER, L_SORT_BY_AREA,
+ *                            L_SORT_BY_ASPECT_RATIO
+ * \param[in]    sortorder    L_SORT_INCREASING, L_SORT_DECREASING
+ * \param[out]   pnaindex     [optional] index of sorted order into
+ *                            original array
+ * \return  pbad sorted version of pbas, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) See boxaSort().  Boxes with equal keys stay in their
+ *          original order, for either sort order.
+ * </pre>
+ */
+L_PBOXA *
+pboxaSort(L_PBOXA  *pbas,
+          l_int32   sorttype,
+          l_int32   sortorder,
+          NUMA    **pnaindex)
+{
+l_int32                 i, n, x, y, w, h, index;
+l_float64               key;
+struct PboxaSortItem   *items;
+L_PBOXA                *pbad;
+
+    if (pnaindex) *pnaindex = NULL;
+    if (!pbas)
+        return (L_PBOXA *)ERROR_PTR("pbas not defined", __func__, NULL);
+    if (sorttype != L_SORT_BY_X && sorttype != L_SORT_BY_Y &&
+        sorttype != L_SORT_BY_RIGHT && sorttype != L_SORT_BY_BOT &&
+        sorttype != L_SORT_BY_WIDTH && sorttype != L_SORT_BY_HEIGHT &&
+        sorttype != L_SORT_BY_MIN_DIMENSION &&
+        sorttype != L_SORT_BY_MAX_DIMENSION &&
+        sorttype != L_SORT_BY_PERIMETER &&
+        sorttype != L_SORT_BY_AREA &&
+        sorttype != L_SORT_BY_ASPECT_RATIO)
+        return (L_PBOXA *)ERROR_PTR("invalid sort type", __func__, NULL);
+    if (sortorder != L_SORT_INCREASING && sortorder != L_SORT_DECREASING)
+        return (L_PBOXA *)ERROR_PTR("invalid sort order", __func__, NULL);
+
+    n = pbas->n;
+    if ((pbad = pboxaCreate(n)) == NULL)
+        return (L_PBOXA *)ERROR_PTR("pbad not made", __func__, NULL);
+    if (n == 0) {
+        if (pnaindex) *pnaindex = numaCreate(1);
+        return pbad;
+    }
+    items = (struct PboxaSortItem *)LEPT_CALLOC(n,
+                                            sizeof(struct PboxaSortItem));
+    if (!items) {
+        pboxaDestroy(&pbad);
+        return (L_PBOXA *)ERROR_PTR("items not made", __func__, NULL);
+    }
+
+        /* The key is negated for decreasing order, so that the
+         * comparison can always break ties with the index */
+    for (i = 0; i < n; i++) {
+        x = pbas->x[i];
+        y = pbas->y[i];
+        w = pbas->w[i];
+        h = pbas->h[i];
+        switch (sorttype)
+        {
+        case L_SORT_BY_X:
+            key = x;
+            break;
+        case L_SORT_BY_Y:
+            key = y;
+            break;
+        case L_SORT_BY_RIGHT:
+            key = x + w - 1;
+            break;
+        case L_SORT_BY_BOT:
+            key = y + h - 1;
+            break;
+        case L_SORT_BY_WIDTH:
+            key = w;
+            break;
+        case L_SORT_BY_HEIGHT:
+            key = h;
+            break;
+        case L_SORT_BY_MIN_DIMENSION:
+            key = L_MIN(w, h);
+            break;
+        case L_SORT_BY_MAX_DIMENSION:
+            key = L_MAX(w, h);
+            break;
+        case L_SORT_BY_PERIMETER:
+            key = w + h;
+            break;
+        case L_SORT_BY_AREA:
+            key = (l_float64)w * (l_float64)h;
+            break;
+        default:  /* L_SORT_BY_ASPECT_RATIO */
+            key = (l_float32)w / (l_float32)h;
+            break;
+        }
+        items[i].key = (sortorder == L_SORT_INCREASING) ? key : -key;
+        items[i].index = i;
+    }
+    qsort(items, n, sizeof(struct PboxaSortItem), pboxaSortCompare);
+
+    for (i = 0; i < n; i++) {
+        index = items[i].index;
+        pbad->x[i] = pbas->x[index];
+        pbad->y[i] = pbas->y[index];
+        pbad->w[i] = pbas->w[index];
+        pbad->h[i] = pbas->h[index];
+    }
+    pbad->n = n;
+
+    if (pnaindex) {
+        *pnaindex = numaCreate(n);
+        for (i = 0; i < n; i++)
+            numaAddNumber(*pnaindex, items[i].index);
+    }
+    LEPT_FREE(items);
+    return pbad;
+}
+
+
+/*!
+ * \brief   pboxaSelectBySize()
+ *
+ * \param[in]    pbas
+ * \param[in]    width, height    threshold dimensions
+ * \param[in]    type             L_SELECT_WIDTH, L_SELECT_HEIGHT,
+ *                                L_SELECT_IF_EITHER, L_SELECT_IF_BOTH
+ * \param[in]    relation         L_SELECT_IF_LT, L_SELECT_IF_GT,
+ *                                L_SELECT_IF_LTE, L_SELECT_IF_GTE
+ * \param[out]   pchanged         [optional] 1 if changed; 0 otherwise
+ * \return  pbad filtered set, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) See boxaSelectBySize().  A new pboxa is always returned.
+ * </pre>
+ */
+L_PBOXA *
+pboxaSelectBySize(L_PBOXA  *pbas,
+                  l_int32   width,
+                  l_int32   height,
+                  l_int32   type,
+                  l_int32   relation,
+                  l_int32  *pchanged)
+{
+l_int32   i, n, nd, w, h, keepw, keeph, keep;
+L_PBOXA  *pbad;
+
+    if (pchanged) *pchanged = FALSE;
+    if (!pbas)
+        return (L_PBOXA *)ERROR_PTR("pbas not defined", __func__, NULL);
+    if (type != L_SELECT_WIDTH && type != L_SELECT_HEIGHT &&
+        type != L_SELECT_IF_EITHER && type != L_SELECT_IF_BOTH)
+        return (L_PBOXA *)ERROR_PTR("invalid type", __func__, NULL);
+    if (relation != L_SELECT_IF_LT && relation != L_SELECT_IF_GT &&
+        relation != L_SELECT_IF_LTE && relation != L_SELECT_IF_GTE)
+        return (L_PBOXA *)ERROR_PTR("invalid relation", __func__, NULL);
+
+    n = pbas->n;
+    if ((pbad = pboxaCreate(n)) == NULL)
+        return (L_PBOXA *)ERROR_PTR("pbad not made", __func__, NULL);
+    nd = 0;
+    for (i = 0; i < n; i++) {
+        w = pbas->w[i];
+        h = pbas->h[i];
+        switch (relation)
+        {
+        case L_SELECT_IF_LT:
+            keepw = (w < width);
+            keeph = (h < height);
+            break;
+        case L_SELECT_IF_GT:
+            keepw = (w > width);
+            keeph = (h > height);
+            break;
+        case L_SELECT_IF_LTE:
+            keepw = (w <= width);
+            keeph = (h <= height);
+            break;
+        default:  /* L_SELECT_IF_GTE */
+            keepw = (w >= width);
+            keeph = (h >= height);
+            break;
+        }
+        if (type == L_SELECT_WIDTH)
+            keep = keepw;
+        else if (type == L_SELECT_HEIGHT)
+            keep = keeph;
+        else if (type == L_SELECT_IF_EITHER)
+            keep = keepw || keeph;
+        else  /* L_SELECT_IF_BOTH */
+            keep = keepw && keeph;
+        if (keep) {
+            pbad->x[nd] = pbas->x[i];
+            pbad->y[nd] = pbas->y[i];
+            pbad->w[nd] = w;
+            pbad->h[nd] = h;
+            nd++;
+        }
+    }
+    pbad->n = nd;
+    if (pchanged) *pchanged = (nd != n);
+    return pbad;
+}
+
+
+/*!
+ * \brief   pboxaIntersectsBox()
+ *
+ * \param[in]    pbas
+ * \param[in]    box     for intersecting
+ * \return  pbad    pboxa with all valid boxes in pbas that intersect box,
+ *                  or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) See boxaIntersectsBox().
+ * </pre>
+ */
+L_PBOXA *
+pboxaIntersectsBox(L_PBOXA  *pbas,
+                   BOX      *box)
+{
+l_int32   i, n, nd, l1, t1, r1, b1, l2, t2, r2, b2, valid;
+L_PBOXA  *pbad;
+
+    if (!pbas)
+        return (L_PBOXA *)ERROR_PTR("pbas not defined", __func__, NULL);
+    if (!box)
+        return (L_PBOXA *)ERROR_PTR("box not defined", __func__, NULL);
+
+    n = pbas->n;
+    if ((pbad = pboxaCreate(n)) == NULL)
+        return (L_PBOXA *)ERROR_PTR("pbad not made", __func__, NULL);
+    boxIsValid(box, &valid);
+    if (n == 0 || !valid)
+        return pbad;  /* empty */
+
+    boxGetGeometry(box, &l1, &t1, &r1, &b1);
+    r1 += l1 - 1;
+    b1 += t1 - 1;
+    nd = 0;
+    for (i = 0; i < n; i++) {
+        if (pbas->w[i] <= 0 || pbas->h[i] <= 0)
+            continue;
+        l2 = pbas->x[i];
+        t2 = pbas->y[i];
+        r2 = l2 + pbas->w[i] - 1;
+        b2 = t2 + pbas->h[i] - 1;
+        if (b2 < t1 || b1 < t2 || r1 < l2 || r2 < l1)
+            continue;
+        pbad->x[nd] = l2;
+        pbad->y[nd] = t2;
+        pbad->w[nd] = pbas->w[i];
+        pbad->h[nd] = pbas->h[i];
+        nd++;
+    }
+    pbad->n = nd;
+    return pbad;
+}
+
+
+/*!
+ * \brief   pboxaCombineOverlaps()
+ *
+ * \param[in]    pbas
+ * \return  pbad   where each set of boxes in pbas that overlap are
+ *                 combined into a single bounding box, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This gives the same boxes, in the same order, as
+ *          boxaCombineOverlaps().  Boxes that are absorbed are marked
+ *          by setting w = 0, and are removed at the end of each
+ *          iteration, so no boxes are allocated.
+ *      (2) Boxes with w <= 0 or h <= 0 are removed.
+ *      (3) For more than a few boxes, the boxes that can overlap each
+ *          box are found with a spatial index; see pboxaAbsorbOverlaps().
+ * </pre>
+ */
+L_PBOXA *
+pboxaCombineOverlaps(L_PBOXA  *pbas)
+{
+l_int32   n1, n2;
+L_PBOXA  *pbad;
+
+    if (!pbas)
+        return (L_PBOXA *)ERROR_PTR("pbas not defined", __func__, NULL);
+
+    if ((pbad = pboxaCopy(pbas)) == NULL)
+        return (L_PBOXA *)ERROR_PTR("pbad not made", __func__, NULL);
+    n1 = pbad->n;
+    while (1) {  /* loop until no change from previous iteration */
+        if (pboxaAbsorbOverlaps(pbad, pbad, 0)) {
+            pboxaDestroy(&pbad);
+            return (L_PBOXA *)ERROR_PTR("overlaps not combined",
+                                        __func__, NULL);
+        }
+        n2 = pboxaSaveValidLow(pbad);
+        if (n1 == n2)
+            break;
+        n1 = n2;
+    }
+    return pbad;
+}
+
+
+/*!
+ * \brief   pboxaCombineOverlapsInPair()
+ *
+ * \param[in]    pbas1, pbas2    input box sets
+ * \param[out]   ppbad1, ppbad2  output box sets
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This gives the same result as boxaCombineOverlapsInPair().
+ *          In particular, the set with the larger total area is
+ *          returned in %ppbad1.
+ * </pre>
+ */
+l_ok
+pboxaCombineOverlapsInPair(L_PBOXA   *pbas1,
+                           L_PBOXA   *pbas2,
+                           L_PBOXA  **ppbad1,
+                           L_PBOXA  **ppbad2)
+{
+l_int32   i, n1, n2, n1i, n2i, area1, area2;
+L_PBOXA  *pba1, *pba2, *pbt;
+
+    if (ppbad1) *ppbad1 = NULL;
+    if (ppbad2) *ppbad2 = NULL;
+    if (!pbas1 || !pbas2)
+        return ERROR_INT("pbas1 and pbas2 not both defined", __func__, 1);
+    if (!ppbad1 || !ppbad2)
+        return ERROR_INT("&pbad1 and &pbad2 not both defined", __func__, 1);
+
+        /* Let the set with the largest area have first crack at the other */
+    area1 = area2 = 0;
+    for (i = 0; i < pbas1->n; i++)
+        area1 += pbas1->w[i] * pbas1->h[i];
+    for (i = 0; i < pbas2->n; i++)
+        area2 += pbas2->w[i] * pbas2->h[i];
+    if (area1 >= area2) {
+        pba1 = pboxaCopy(pbas1);
+        pba2 = pboxaCopy(pbas2);
+    } else {
+        pba1 = pboxaCopy(pbas2);
+        pba2 = pboxaCopy(pbas1);
+    }
+    if (!pba1 || !pba2) {
+        pboxaDestroy(&pba1);
+        pboxaDestroy(&pba2);
+        return ERROR_INT("pba1 and pba2 not both made", __func__, 1);
+    }
+
+    n1i = pba1->n;
+    n2i = pba2->n;
+    while (1) {
+            /* First combine boxes in each set */
+        pbt = pboxaCombineOverlaps(pba1);
+        pboxaDestroy(&pba1);
+        pba1 = pbt;
+        pbt = pboxaCombineOverlaps(pba2);
+        pboxaDestroy(&pba2);
+        pba2 = pbt;
+        if (!pba1 || !pba2)
+            break;
+
+            /* Now combine boxes between sets, with the larger
+             * box absorbing the smaller */
+        if (pboxaAbsorbOverlaps(pba1, pba2, 1) ||  /* 1 eats 2 */
+            pboxaAbsorbOverlaps(pba2, pba1, 1)) {  /* 2 eats 1 */
+            pboxaDestroy(&pba1);
+            break;
+        }
+        n1 = pboxaSaveValidLow(pba1);
+        n2 = pboxaSaveValidLow(pba2);
+        if (n1 == n1i && n2 == n2i) break;
+        n1i = n1;
+        n2i = n2;
+    }
+    if (!pba1 || !pba2) {
+        pboxaDestroy(&pba1);
+        pboxaDestroy(&pba2);
+        return ERROR_INT("overlaps not combined", __func__, 1);
+    }
+
+    *ppbad1 = pba1;
+    *ppbad2 = pba2;
+    return 0;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                           Spatial index                            *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   boxgridCreate()
+ *
+ * \param[in]    boxa
+ * \param[in]    cellw, cellh    cell size; use 0 for each to choose
+ *                               from the box sizes
+ * \return  grid, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The grid holds a copy of the boxes, so %boxa can be changed
+ *          or destroyed after this is called.  Boxes with w <= 0 or
+ *          h <= 0 are not entered.
+ *      (2) The default cell size is twice the average box size, in
+ *          each direction, and is increased if required to limit the
+ *          number of cells to a few times the number of boxes.
+ * </pre>
+ */
+L_BOXGRID *
+boxgridCreate(BOXA     *boxa,
+              l_int32   cellw,
+              l_int32   cellh)
+{
+L_PBOXA  *pba;
+
+    if (!boxa)
+        return (L_BOXGRID *)ERROR_PTR("boxa not defined", __func__, NULL);
+    if (cellw < 0 || cellh < 0)
+        return (L_BOXGRID *)ERROR_PTR("cellw or cellh < 0", __func__, NULL);
+
+    if ((pba = boxaConvertToPboxa(boxa)) == NULL)
+        return (L_BOXGRID *)ERROR_PTR("pba not made", __func__, NULL);
+    return boxgridCreateLow(pba, cellw, cellh);
+}
+
+
+/*!
+ * \brief   boxgridDestroy()
+ *
+ * \param[in,out]   pgrid   will be set to null before returning
+ * \return  void
+ */
+void
+boxgridDestroy(L_BOXGRID  **pgrid)
+{
+L_BOXGRID  *grid;
+
+    if (pgrid == NULL) {
+        L_WARNING("ptr address is null!\n", __func__);
+        return;
+    }
+    if ((grid = *pgrid) == NULL)
+        return;
+
+    pboxaDestroy(&grid->pba);
+    LEPT_FREE(grid->cellstart);
+    LEPT_FREE(grid->index);
+    LEPT_FREE(grid->mark);
+    LEPT_FREE(grid);
+    *pgrid = NULL;
+}
+
+
+/*!
+ * \brief   boxgridFindIntersecting()
+ *
+ * \param[in]    grid
+ * \param[in]    box     region to search
+ * \return  na of indices of the boxes that intersect %box, in
+ *              increasing order, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The indices refer to the boxa from which the grid was made.
+ *          They are the same boxes, in the same order, as returned by
+ *          boxaIntersectsBox().  An empty na is returned if %box is
+ *          not valid.
+ * </pre>
+ */
+NUMA *
+boxgridFindIntersecting(L_BOXGRID  *grid,
+                        BOX        *box)
+{
+l_int32   i, j, l, t, r, b, valid, ncand, nalloc;
+l_int32  *cand;
+NUMA     *na;
+L_PBOXA  *pba;
+
+    if (!grid)
+        return (NUMA *)ERROR_PTR("grid not defined", __func__, NULL);
+    if (!box)
+        return (NUMA *)ERROR_PTR("box not defined", __func__, NULL);
+
+    na = numaCreate(0);
+    boxIsValid(box, &valid);
+    if (!valid)
+        return na;
+
+    boxGetGeometry(box, &l, &t, &r, &b);
+    r += l - 1;
+    b += t - 1;
+    cand = NULL;
+    ncand = nalloc = 0;
+    grid->stamp++;
+    if (boxgridCollect(grid, l, t, r, b, 0, &cand, &ncand, &nalloc)) {
+        numaDestroy(&na);
+        return (NUMA *)ERROR_PTR("candidates not found", __func__, NULL);
+    }
+    qsort(cand, ncand, sizeof(l_int32), intSortCompare);
+    pba = grid->pba;
+    for (i = 0; i < ncand; i++) {
+        j = cand[i];
+        if (pba->y[j] + pba->h[j] - 1 < t || b < pba->y[j] ||
+            pba->x[j] + pba->w[j] - 1 < l || r < pba->x[j])
+            continue;
+        numaAddNumber(na, j);
+    }
+    LEPT_FREE(cand);
+    return na;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                           Static helpers                           *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   pboxaExtendArrays()
+ *
+ * \param[in]    pba
+ * \param[in]    size    new size of the arrays
+ * \return  0 if OK, 1 on error
+ */
+static l_int32
+pboxaExtendArrays(L_PBOXA  *pba,
+                  l_int32   size)
+{
+size_t  oldsize, newsize;
+
+    oldsize = pba->nalloc * sizeof(l_int32);
+    newsize = size * sizeof(l_int32);
+    if ((pba->x = (l_int32 *)reallocNew((void **)&pba->x,
+                                        oldsize, newsize)) == NULL)
+        return ERROR_INT("new x array not returned", __func__, 1);
+    if ((pba->y = (l_int32 *)reallocNew((void **)&pba->y,
+                                        oldsize, newsize)) == NULL)
+        return ERROR_INT("new y array not returned", __func__, 1);
+    if ((pba->w = (l_int32 *)reallocNew((void **)&pba->w,
+                                        oldsize, newsize)) == NULL)
+        return ERROR_INT("new w array not returned", __func__, 1);
+    if ((pba->h = (l_int32 *)reallocNew((void **)&pba->h,
+                                        oldsize, newsize)) == NULL)
+        return ERROR_INT("new h array not returned", __func__, 1);
+    pba->nalloc = size;
+    return 0;
+}
+
+
+/*!
+ * \brief   pboxaSortCompare()
+ *
+ * \param[in]    item1, item2    struct PboxaSortItem
+ * \return  -1, 0 or 1, for increasing key, then increasing index
+ */
+static l_int32
+pboxaSortCompare(const void  *item1,
+                 const void  *item2)
+{
+const struct PboxaSortItem  *p1, *p2;
+
+    p1 = (const struct PboxaSortItem *)item1;
+    p2 = (const struct PboxaSortItem *)item2;
+    if (p1->key < p2->key) return -1;
+    if (p1->key > p2->key) return 1;
+    if (p1->index < p2->index) return -1;
+    if (p1->index > p2->index) return 1;
+    return 0;
+}
+
+
+/*!
+ * \brief   pboxaSaveValidLow()
+ *
+ * \param[in]    pba
+ * \return  number of boxes remaining
+ *
+ * <pre>
+ * Notes:
+ *      (1) Removes, in place, the boxes with w <= 0 or h <= 0.
+ * </pre>
+ */
+static l_int32
+pboxaSaveValidLow(L_PBOXA  *pba)
+{
+l_int32  i, k;
+
+    for (i = 0, k = 0; i < pba->n; i++) {
+        if (pba->w[i] <= 0 || pba->h[i] <= 0)
+            continue;
+        pba->x[k] = pba->x[i];
+        pba->y[k] = pba->y[i];
+        pba->w[k] = pba->w[i];
+        pba->h[k] = pba->h[i];
+        k++;
+    }
+    pba->n = k;
+    return k;
+}
+
+
+/*!
+ * \brief   pboxaAbsorbOverlaps()
+ *
+ * \param[in]    pbd      boxes that absorb
+ * \param[in]    pbs      boxes that can be absorbed; can be %pbd
+ * \param[in]    bigger   1 if a box can only absorb a box of smaller area
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is one pass of the pairwise scan in boxaCombineOverlaps()
+ *          (with %pbs == %pbd) and boxaCombineOverlapsInPair().  Each
+ *          valid box i in %pbd is tested in turn against the valid boxes
+ *          j in %pbs, in increasing order of j, starting with j = i + 1
+ *          if %pbs == %pbd and with j = 0 otherwise.  If box j overlaps
+ *          box i, as it has grown up to that point, box i is replaced by
+ *          the bounding region of the two and box j is marked as absorbed
+ *          by setting its width to 0.
+ *      (2) With a spatial index over %pbs, only the boxes j that overlap
+ *          the current box i are visited.  They are visited in increasing
+ *          order; when box i grows, the boxes with larger index that
+ *          overlap the added region are merged into the remaining list.
+ *          So every absorption happens exactly as in the full scan.
+ *          The index is made from the boxes at the start of the pass,
+ *          which are unchanged when they are visited: before box j is
+ *          itself used to absorb other boxes, it can only be marked
+ *          as absorbed, and that is checked on the arrays.
+ * </pre>
+ */
+static l_int32
+pboxaAbsorbOverlaps(L_PBOXA  *pbd,
+                    L_PBOXA  *pbs,
+                    l_int32   bigger)
+{
+l_int32     i, j, k, n1, n2, first, pos, ncand, nalloc;
+l_int32     l1, t1, r1, b1, l2, t2, r2, b2, nl, nt, nr, nb;
+l_int32    *cand;
+L_BOXGRID  *grid;
+
+    n1 = pbd->n;
+    n2 = pbs->n;
+    if (n1 == 0 || n2 == 0)
+        return 0;
+    grid = NULL;
+    if (n2 >= MinBoxesForGrid &&
+        (grid = boxgridCreateLow(pboxaCopy(pbs), 0, 0)) == NULL)
+        return ERROR_INT("grid not made", __func__, 1);
+    cand = NULL;
+    ncand = nalloc = 0;
+
+    for (i = 0; i < n1; i++) {
+        if (pbd->w[i] <= 0 || pbd->h[i] <= 0)
+            continue;
+        l1 = pbd->x[i];
+        t1 = pbd->y[i];
+        r1 = l1 + pbd->w[i] - 1;
+        b1 = t1 + pbd->h[i] - 1;
+        first = (pbs == pbd) ? i + 1 : 0;
+        if (grid) {
+            grid->stamp++;
+            ncand = 0;
+            if (boxgridCollect(grid, l1, t1, r1, b1, first, &cand, &ncand,
+                               &nalloc)) {
+                boxgridDestroy(&grid);
+                return ERROR_INT("candidates not found", __func__, 1);
+            }
+            qsort(cand, ncand, sizeof(l_int32), intSortCompare);
+        } else {
+            ncand = n2 - first;
+        }
+
+        for (pos = 0; pos < ncand; pos++) {
+            j = (grid) ? cand[pos] : first + pos;
+            if (pbs->w[j] <= 0 || pbs->h[j] <= 0)
+                continue;
+            l2 = pbs->x[j];
+            t2 = pbs->y[j];
+            r2 = l2 + pbs->w[j] - 1;
+            b2 = t2 + pbs->h[j] - 1;
+            if (b2 < t1 || b1 < t2 || r1 < l2 || r2 < l1)
+                continue;
+            if (bigger && (r1 - l1 + 1) * (b1 - t1 + 1) <=
+                          pbs->w[j] * pbs->h[j])
+                continue;
+            nl = L_MIN(l1, l2);
+            nt = L_MIN(t1, t2);
+            nr = L_MAX(r1, r2);
+            nb = L_MAX(b1, b2);
+            pbs->w[j] = 0;
+            if (grid && (nl < l1 || nt < t1 || nr > r1 || nb > b1)) {
+                    /* Add boxes after j that overlap the larger box */
+                k = ncand;
+                if (boxgridCollect(grid, nl, nt, nr, nb, j + 1, &cand,
+                                   &ncand, &nalloc)) {
+                    boxgridDestroy(&grid);
+                    return ERROR_INT("candidates not found", __func__, 1);
+                }
+                if (ncand > k)
+                    qsort(cand + pos + 1, ncand - pos - 1, sizeof(l_int32),
+                          intSortCompare);
+            }
+            l1 = nl;
+            t1 = nt;
+            r1 = nr;
+            b1 = nb;
+        }
+        pbd->x[i] = l1;
+        pbd->y[i] = t1;
+        pbd->w[i] = r1 - l1 + 1;
+        pbd->h[i] = b1 - t1 + 1;
+    }
+
+    LEPT_FREE(cand);
+    boxgridDestroy(&grid);
+    return 0;
+}
+
+
+/*!
+ * \brief   boxgridCreateLow()
+ *
+ * \param[in]    pba      boxes; the grid takes ownership
+ * \param[in]    cellw, cellh    cell size; 0 to choose from the boxes
+ * \return  grid, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The indices in each cell are in increasing order.
+ *      (2) On error, %pba is destroyed.
+ * </pre>
+ */
+static L_BOXGRID *
+boxgridCreateLow(L_PBOXA  *pba,
+                 l_int32   cellw,
+                 l_int32   cellh)
+{
+l_int32     i, n, nvalid, x, y, cx, cy, cx0, cx1, cy0, cy1, ncells, total;
+l_int32     xmin, ymin, xmax, ymax;
+l_float64   sumw, sumh;
+L_BOXGRID  *grid;
+
+    if (!pba)
+        return (L_BOXGRID *)ERROR_PTR("pba not defined", __func__, NULL);
+
+        /* Extent and mean size of the valid boxes */
+    n = pba->n;
+    nvalid = 0;
+    sumw = sumh = 0.0;
+    xmin = ymin = 100000000;
+    xmax = ymax = -100000000;
+    for (i = 0; i < n; i++) {
+        if (pba->w[i] <= 0 || pba->h[i] <= 0)
+            continue;
+        nvalid++;
+        sumw += pba->w[i];
+        sumh += pba->h[i];
+        xmin = L_MIN(xmin, pba->x[i]);
+        ymin = L_MIN(ymin, pba->y[i]);
+        xmax = L_MAX(xmax, pba->x[i] + pba->w[i] - 1);
+        ymax = L_MAX(ymax, pba->y[i] + pba->h[i] - 1);
+    }
+    if (nvalid == 0) {
+        xmin = ymin = xmax = ymax = 0;
+        sumw = sumh = 1.0;
+        nvalid = 1;
+    }
+    if (cellw <= 0)
+        cellw = L_MAX(1, (l_int32)(2.0 * sumw / nvalid));
+    if (cellh <= 0)
+        cellh = L_MAX(1, (l_int32)(2.0 * sumh / nvalid));
+    while (1) {
+        cx = (xmax - xmin) / cellw + 1;
+        cy = (ymax - ymin) / cellh + 1;
+        if ((l_float64)cx * cy <= 4.0 * nvalid + 16)
+            break;
+        cellw *= 2;
+        cellh *= 2;
+    }
+    ncells = cx * cy;
+
+    grid = (L_BOXGRID *)LEPT_CALLOC(1, sizeof(L_BOXGRID));
+    grid->pba = pba;
+    grid->nx = cx;
+    grid->ny = cy;
+    grid->cellw = cellw;
+    grid->cellh = cellh;
+    grid->xmin = xmin;
+    grid->ymin = ymin;
+    grid->cellstart = (l_int32 *)LEPT_CALLOC(ncells + 1, sizeof(l_int32));
+    grid->mark = (l_int32 *)LEPT_CALLOC(L_MAX(1, n), sizeof(l_int32));
+    if (!grid->cellstart || !grid->mark) {
+        boxgridDestroy(&grid);
+        return (L_BOXGRID *)ERROR_PTR("grid arrays not made", __func__, NULL);
+    }
+
+        /* Count the entries in each cell, and then fill them in */
+    for (i = 0; i < n; i++) {
+        if (pba->w[i] <= 0 || pba->h[i] <= 0)
+            continue;
+        cx0 = (pba->x[i] - xmin) / cellw;
+        cy0 = (pba->y[i] - ymin) / cellh;
+        cx1 = (pba->x[i] + pba->w[i] - 1 - xmin) / cellw;
+        cy1 = (pba->y[i] + pba->h[i] - 1 - ymin) / cellh;
+        for (y = cy0; y <= cy1; y++) {
+            for (x = cx0; x <= cx1; x++)
+                grid->cellstart[y * cx + x + 1]++;
+        }
+    }
+    for (i = 0; i < ncells; i++)
+        grid->cellstart[i + 1] += grid->cellstart[i];
+    total = grid->cellstart[ncells];
+    grid->index = (l_int32 *)LEPT_CALLOC(L_MAX(1, total), sizeof(l_int32));
+    if (!grid->index) {
+        boxgridDestroy(&grid);
+        return (L_BOXGRID *)ERROR_PTR("grid index not made", __func__, NULL);
+    }
+    for (i = 0; i < n; i++) {
+        if (pba->w[i] <= 0 || pba->h[i] <= 0)
+            continue;
+        cx0 = (pba->x[i] - xmin) / cellw;
+        cy0 = (pba->y[i] - ymin) / cellh;
+        cx1 = (pba->x[i] + pba->w[i] - 1 - xmin) / cellw;
+        cy1 = (pba->y[i] + pba->h[i] - 1 - ymin) / cellh;
+        for (y = cy0; y <= cy1; y++) {
+            for (x = cx0; x <= cx1; x++)
+                grid->index[grid->cellstart[y * cx + x]++] = i;
+        }
+    }
+    for (i = ncells; i > 0; i--)  /* restore the cell starts */
+        grid->cellstart[i] = grid->cellstart[i - 1];
+    grid->cellstart[0] = 0;
+    return grid;
+}
+
+
+/*!
+ * \brief   boxgridCollect()
+ *
+ * \param[in]    grid
+ * \param[in]    l, t, r, b      region, with inclusive bounds
+ * \param[in]    minindex        smallest box index to collect
+ * \param[in,out] pcand          candidate array; reallocated as needed
+ * \param[in,out] pncand         number of candidates
+ * \param[in,out] pnalloc        size of candidate array
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) Appends to the candidate array the index of each box, not
+ *          already marked with the current stamp, that is in a cell
+ *          touched by the region.  The boxes found are marked, so the
+ *          caller increments grid->stamp once for each set of queries
+ *          whose results are to be combined without duplicates.
+ *      (2) The candidates are not necessarily in order, and they are
+ *          not necessarily intersecting the region.
+ *      (3) On error, the candidate array is freed and %pcand is
+ *          set to NULL.
+ * </pre>
+ */
+static l_int32
+boxgridCollect(L_BOXGRID  *grid,
+               l_int32     l,
+               l_int32     t,
+               l_int32     r,
+               l_int32     b,
+               l_int32     minindex,
+               l_int32   **pcand,
+               l_int32    *pncand,
+               l_int32    *pnalloc)
+{
+l_int32   x, y, k, j, cx0, cy0, cx1, cy1, ncand, nalloc;
+l_int32  *cand, *newcand;
+
+    if (r < grid->xmin || b < grid->ymin)
+        return 0;
+    cx0 = (l < grid->xmin) ? 0 : (l - grid->xmin) / grid->cellw;
+    cy0 = (t < grid->ymin) ? 0 : (t - grid->ymin) / grid->cellh;
+    cx1 = L_MIN(grid->nx - 1, (r - grid->xmin) / grid->cellw);
+    cy1 = L_MIN(grid->ny - 1, (b - grid->ymin) / grid->cellh);
+    if (cx0 > cx1 || cy0 > cy1)
+        return 0;
+
+    cand = *pcand;
+    ncand = *pncand;
+    nalloc = *pnalloc;
+    for (y = cy0; y <= cy1; y++) {
+        for (x = cx0; x <= cx1; x++) {
+            for (k = grid->cellstart[y * grid->nx + x];
+                 k < grid->cellstart[y * grid->nx + x + 1]; k++) {
+                j = grid->index[k];
+                if (j < minindex || grid->mark[j] == grid->stamp)
+                    continue;
+                grid->mark[j] = grid->stamp;
+                if (ncand >= nalloc) {
+                    nalloc = L_MAX(64, 2 * nalloc);
+                    newcand = (l_int32 *)reallocNew((void **)&cand,
+                                                    sizeof(l_int32) * ncand,
+                                                    sizeof(l_int32) * nalloc);
+                    if (!newcand) {
+                        LEPT_FREE(cand);
+                        *pcand = NULL;
+                        *pncand = *pnalloc = 0;
+                        return ERROR_INT("cand not extended", __func__, 1);
+                    }
+                    cand = newcand;
+                }
+                cand[ncand++] = j;
+            }
+        }
+    }
+    *pcand = cand;
+    *pncand = ncand;
+    *pnalloc = nalloc;
+    return 0;
+}
+
+
+static l_int32
+intSortCompare(const void  *item1,
+               const void  *item2)
+{
+l_int32  i1, i2;
+
+    i1 = *(const l_int32 *)item1;
+    i2 = *(const l_int32 *)item2;
+    return (i1 > i2) - (i1 < i2);
+}
@@ -75,6 +75,7 @@
  *
  *     Static helpers
  *          static NUMA     *parseRotationString()
+ *          static l_int32   rotateorthUnscaledToPdf()
  * </pre>
  */
 
@@ -86,6 +87,9 @@
 #include "allheaders.h"
 
 static NUMA *parseRotationString(l_int32  n, const char *rotstring);
+static l_int32 rotateorthUnscaledToPdf(SARRAY *sa, NUMA *narot,
+                                       l_int32 quality, const char *title,
+                                       const char *fileout);
 
 #define DEBUG_PARSER 0
 
@@ -538,6 +542,10 @@ PIXAC     *pixac1 = NULL;
  *        lower resolution in the images in the output pdf.
  *    (6) Default jpeg %quality is 75; quality factors between 25 and 95
  *        are allowed.
+ *    (7) With %scalefactor == 1.0, the images are not decoded unless
+ *        they must be.  Jpeg images are rotated in the DCT domain when
+ *        possible, and otherwise wrapped as is.  See
+ *        l_generateCIDataForPdfOrth().
  * </pre>
  */
 l_ok
@@ -549,7 +557,7 @@ rotateorthFilesToPdf(SARRAY      *sa,
                      const char  *fileout)
 {
 char      *fname;
-l_int32    n, i, res, maxi, rotval;
+l_int32    n, i, res, maxi, rotval, ret;
 l_int32    maxsmallset = 25;  /* max num images kept uncompressed in array */
 NUMA      *na1;
 PIX       *pixs, *pix1, *pix2, *pix3;
@@ -590,6 +598,14 @@ PIXAC     *pixac1 = NULL;
     }
 #endif  /* DEBUG_PARSER */
 
+    if (scalefactor == 1.0) {
+        if (title && strcmp(title, "none") == 0)
+            title = NULL;
+        ret = rotateorthUnscaledToPdf(sa, na1, quality, title, fileout);
+        numaDestroy(&na1);
+        return ret;
+    }
+
     if (n <= maxsmallset)
         pixa1 = pixaCreate(n);
     else
@@ -656,6 +672,92 @@ PIXAC     *pixac1 = NULL;
 }
 
 
+/*!
+ * \brief   rotateorthUnscaledToPdf()
+ *
+ * \param[in]    sa         sorted full pathnames of images
+ * \param[in]    narot      rotation values for the images
+ * \param[in]    quality    for jpeg if transcoded
+ * \param[in]    title      [optional] pdf title; can be null
+ * \param[in]    fileout    pdf file of all images
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *    (1) This is rotateorthFilesToPdf() with no scaling.  Each page is
+ *        generated from its file with l_generateCIDataForPdfOrth(), so
+ *        jpeg images are rotated without recompression.
+ *    (2) As with scaling, all pages use the resolution inferred from
+ *        the first image, taking its longest side to be 11.0 inches.
+ * </pre>
+ */
+static l_int32
+rotateorthUnscaledToPdf(SARRAY      *sa,
+                        NUMA        *narot,
+                        l_int32      quality,
+                        const char  *title,
+                        const char  *fileout)
+{
+char         *fname;
+l_uint8      *data;
+l_int32       n, i, res, rotval, npages, ret;
+size_t        nbytes;
+L_BYTEA      *ba;
+L_COMP_DATA  *cid;
+L_PTRA       *pa_data;
+PIX          *pix1;
+
+    n = sarrayGetCount(sa);
+    pa_data = ptraCreate(n);
+    res = 0;
+    for (i = 0; i < n; i++) {
+        if (i == 0)
+            lept_stderr("page: ");
+        if (n < 12) {
+            lept_stderr("%d . ", i);
+        } else {
+            if (i && (i % 10 == 0))
+                lept_stderr("%d . ", i);
+        }
+        fname = sarrayGetString(sa, i, L_NOCOPY);
+        numaGetIValue(narot, i, &rotval);
+        if (l_generateCIDataForPdfOrth(fname, rotval, quality, &cid)) {
+            L_ERROR("image %s not converted\n", __func__, fname);
+            continue;
+        }
+        if (res == 0) {
+            pix1 = pixCreateHeader(cid->w, cid->h, 1);
+            pixInferResolution(pix1, 11.0, &res);
+            pixDestroy(&pix1);
+        }
+        cid->res = res;
+        if (cidConvertToPdfData(cid, title, &data, &nbytes))  /* frees cid */
+            continue;
+        ba = l_byteaInitFromMem(data, nbytes);
+        LEPT_FREE(data);
+        ptraAdd(pa_data, ba);
+    }
+    ptraGetActualCount(pa_data, &npages);
+    if (npages == 0) {
+        ptraDestroy(&pa_data, FALSE, FALSE);
+        return ERROR_INT("no pdf files made", __func__, 1);
+    }
+
+        /* Concatenate and write the multipage pdf */
+    lept_stderr("\nWrite output to %s\n", fileout);
+    ret = ptraConcatenatePdfToData(pa_data, NULL, &data, &nbytes);
+    if (!ret)
+        ret = l_binaryWrite(fileout, "w", data, nbytes);
+    LEPT_FREE(data);
+    for (i = 0; i < npages; i++) {
+        ba = (L_BYTEA *)ptraRemove(pa_data, i, L_NO_COMPACTION);
+        l_byteaDestroy(&ba);
+    }
+    ptraDestroy(&pa_data, FALSE, FALSE);
+    return ret;
+}
+
+
 /*!
  * \brief   parseRotationString()
  *
@@ -114,6 +114,7 @@
  *     3. Convert multiple images to pdf (one image per page)
  *          l_int32             pixaConvertToPdf()
  *          l_int32             pixaConvertToPdfData()
+ *          l_int32             pdfMakePages()
  *
  *     4. Single page, multi-image converters
  *          l_int32             convertToPdf()
@@ -204,6 +205,9 @@
 #include <string.h>
 #include <math.h>
 #include "allheaders.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif  /* _OPENMP */
 
 /* --------------------------------------------*/
 #if  USE_PDFIO   /* defined in environ.h */
@@ -212,6 +216,10 @@
     /* Typical scan resolution in ppi (pixels/inch) */
 static const l_int32  DefaultInputRes = 300;
 
+    /* Number of pages read and encoded at a time for each thread,
+     * when pages are encoded in parallel */
+static const l_int32  PdfPagesPerThread = 2;
+
 /*---------------------------------------------------------------------*
  *    Convert specified image files to pdf (one image file per page)   *
  *---------------------------------------------------------------------*/
@@ -246,6 +254,9 @@ static const l_int32  DefaultInputRes = 300;
  *          all images to be compressed with that type.  Use 0 to have
  *          the type determined for each image based on depth and whether
  *          or not it has a colormap.
+ *      (5) Each page is written to the file as soon as it is made, with
+ *          a pdf writer (see pdfWriterOpen()), so the memory used does
+ *          not grow with the number of pages.
  * </pre>
  */
 l_ok
@@ -304,22 +315,21 @@ saConvertFilesToPdf(SARRAY      *sa,
                     const char  *title,
                     const char  *fileout)
 {
-l_uint8  *data;
-l_int32   ret;
-size_t    nbytes;
+l_int32        ret;
+L_PDF_WRITER  *pdfw;
 
     if (!sa)
         return ERROR_INT("sa not defined", __func__, 1);
+    if (!fileout)
+        return ERROR_INT("fileout not defined", __func__, 1);
+    if (scalefactor <= 0.0) scalefactor = 1.0;
 
-    ret = saConvertFilesToPdfData(sa, res, scalefactor, type, quality,
-                                  title, &data, &nbytes);
-    if (ret) {
-        if (data) LEPT_FREE(data);
-        return ERROR_INT("pdf data not made", __func__, 1);
-    }
-
-    ret = l_binaryWrite(fileout, "w", data, nbytes);
-    LEPT_FREE(data);
+        /* Each page is written to the file as it is made */
+    if ((pdfw = pdfWriterOpen(fileout, title)) == NULL)
+        return ERROR_INT("pdfw not made", __func__, 1);
+    pdfMakePages(sa, NULL, NULL, res, scalefactor, type, quality, title,
+                 NULL, pdfw);
+    ret = pdfWriterClose(&pdfw);
     if (ret)
         L_ERROR("pdf data not written to file\n", __func__);
     return ret;
@@ -357,12 +367,8 @@ saConvertFilesToPdfData(SARRAY      *sa,
                         l_uint8    **pdata,
                         size_t      *pnbytes)
 {
-char     *fname;
-l_uint8  *imdata;
-l_int32   i, n, ret, pagetype, npages, scaledres;
-size_t    imbytes;
+l_int32   i, ret, npages;
 L_BYTEA  *ba;
-PIX      *pixs, *pix;
 L_PTRA   *pa_data;
 
     if (!pdata)
@@ -380,44 +386,9 @@ L_PTRA   *pa_data;
     }
 
         /* Generate all the encoded pdf strings */
-    n = sarrayGetCount(sa);
-    pa_data = ptraCreate(n);
-    for (i = 0; i < n; i++) {
-        if (i && (i % 10 == 0)) lept_stderr(".. %d ", i);
-        fname = sarrayGetString(sa, i, L_NOCOPY);
-        if ((pixs = pixRead(fname)) == NULL) {
-            L_ERROR("image not readable from file %s\n", __func__, fname);
-            continue;
-        }
-        if (scalefactor != 1.0)
-            pix = pixScale(pixs, scalefactor, scalefactor);
-        else
-            pix = pixClone(pixs);
-        pixDestroy(&pixs);
-        scaledres = (l_int32)(res * scalefactor);
-
-            /* Select the encoding type */
-        if (type != L_DEFAULT_ENCODE) {
-            pagetype = type;
-        } else if (selectDefaultPdfEncoding(pix, &pagetype) != 0) {
-            pixDestroy(&pix);
-            L_ERROR("encoding type selection failed for file %s\n",
-                    __func__, fname);
-            continue;
-        }
-
-        ret = pixConvertToPdfData(pix, pagetype, quality, &imdata, &imbytes,
-                                  0, 0, scaledres, title, NULL, 0);
-        pixDestroy(&pix);
-        if (ret) {
-            LEPT_FREE(imdata);
-            L_ERROR("pdf encoding failed for %s\n", __func__, fname);
-            continue;
-        }
-        ba = l_byteaInitFromMem(imdata, imbytes);
-        LEPT_FREE(imdata);
-        ptraAdd(pa_data, ba);
-    }
+    pa_data = ptraCreate(sarrayGetCount(sa));
+    pdfMakePages(sa, NULL, NULL, res, scalefactor, type, quality, title,
+                 pa_data, NULL);
     ptraGetActualCount(pa_data, &npages);
     if (npages == 0) {
         L_ERROR("no pdf files made\n", __func__);
@@ -524,6 +495,8 @@ PIXCMAP  *cmap;
  *      (3) This is very fast for jpeg, jp2k and some png files,
  *          because the compressed data is wrapped up and concatenated.
  *          For other types of png, the images must be read and recompressed.
+ *      (4) As with convertFilesToPdf(), each page is written to the
+ *          file as soon as it is made.
  * </pre>
  */
 l_ok
@@ -566,21 +539,26 @@ saConvertUnscaledFilesToPdf(SARRAY      *sa,
                             const char  *title,
                             const char  *fileout)
 {
-l_uint8  *data;
-l_int32   ret;
-size_t    nbytes;
+char          *fname;
+l_int32        i, n, ret;
+L_PDF_WRITER  *pdfw;
 
     if (!sa)
         return ERROR_INT("sa not defined", __func__, 1);
+    if (!fileout)
+        return ERROR_INT("fileout not defined", __func__, 1);
 
-    ret = saConvertUnscaledFilesToPdfData(sa, title, &data, &nbytes);
-    if (ret) {
-        if (data) LEPT_FREE(data);
-        return ERROR_INT("pdf data not made", __func__, 1);
+        /* Each page is written to the file as it is made */
+    if ((pdfw = pdfWriterOpen(fileout, title)) == NULL)
+        return ERROR_INT("pdfw not made", __func__, 1);
+    n = sarrayGetCount(sa);
+    for (i = 0; i < n; i++) {
+        if (i && (i % 10 == 0)) lept_stderr(".. %d ", i);
+        fname = sarrayGetString(sa, i, L_NOCOPY);
+        pdfWriterAddFile(pdfw, fname);
     }
 
-    ret = l_binaryWrite(fileout, "w", data, nbytes);
-    LEPT_FREE(data);
+    ret = pdfWriterClose(&pdfw);
     if (ret)
         L_ERROR("pdf data not written to file\n", __func__);
     return ret;
@@ -753,6 +731,8 @@ L_COMP_DATA  *cid;
  *          all images to be compressed with that type.  Use 0 to have
  *          the type determined for each image based on depth and whether
  *          or not it has a colormap.
+ *      (4) Each page is written to the file as soon as it is made, so
+ *          only one encoded page is held in memory.
  * </pre>
  */
 l_ok
@@ -764,22 +744,25 @@ pixaConvertToPdf(PIXA        *pixa,
                  const char  *title,
                  const char  *fileout)
 {
-l_uint8  *data;
-l_int32   ret;
-size_t    nbytes;
+l_int32        ret;
+L_PDF_WRITER  *pdfw;
 
     if (!pixa)
         return ERROR_INT("pixa not defined", __func__, 1);
+    if (!fileout)
+        return ERROR_INT("fileout not defined", __func__, 1);
+    if (scalefactor <= 0.0) scalefactor = 1.0;
+    if (scalefactor >= 50.0)
+        return ERROR_INT("scalefactor too large", __func__, 1);
+    if (quality < 0 || quality > 100)
+        return ERROR_INT("invalid quality", __func__, 1);
 
-    ret = pixaConvertToPdfData(pixa, res, scalefactor, type, quality,
-                               title, &data, &nbytes);
-    if (ret) {
-        LEPT_FREE(data);
-        return ERROR_INT("conversion to pdf failed", __func__, 1);
-    }
-
-    ret = l_binaryWrite(fileout, "w", data, nbytes);
-    LEPT_FREE(data);
+        /* Each page is written to the file as it is made */
+    if ((pdfw = pdfWriterOpen(fileout, title)) == NULL)
+        return ERROR_INT("pdfw not made", __func__, 1);
+    pdfMakePages(NULL, pixa, NULL, res, scalefactor, type, quality, title,
+                 NULL, pdfw);
+    ret = pdfWriterClose(&pdfw);
     if (ret)
         L_ERROR("pdf data not written to file\n", __func__);
     return ret;
@@ -817,11 +800,8 @@ pixaConvertToPdfData(PIXA        *pixa,
                      l_uint8    **pdata,
                      size_t      *pnbytes)
 {
-l_uint8  *imdata;
-l_int32   i, n, ret, scaledres, pagetype;
-size_t    imbytes;
+l_int32   i, n, ret;
 L_BYTEA  *ba;
-PIX      *pixs, *pix;
 L_PTRA   *pa_data;
 
     if (!pdata)
@@ -848,44 +828,8 @@ L_PTRA   *pa_data;
         /* Generate all the encoded pdf strings */
     n = pixaGetCount(pixa);
     pa_data = ptraCreate(n);
-    for (i = 0; i < n; i++) {
-        if ((pixs = pixaGetPix(pixa, i, L_CLONE)) == NULL) {
-            L_ERROR("pixs[%d] not retrieved\n", __func__, i);
-            continue;
-        }
-        if (scalefactor != 1.0)
-            pix = pixScale(pixs, scalefactor, scalefactor);
-        else
-            pix = pixClone(pixs);
-        pixDestroy(&pixs);
-        if (!pix) {
-            L_ERROR("pix[%d] not made\n", __func__, i);
-            continue;
-        }
-        scaledres = (l_int32)(res * scalefactor);
-
-            /* Select the encoding type */
-        if (type != L_DEFAULT_ENCODE) {
-            pagetype = type;
-        } else if (selectDefaultPdfEncoding(pix, &pagetype) != 0) {
-            L_ERROR("encoding type selection failed for pix[%d]\n",
-                        __func__, i);
-            pixDestroy(&pix);
-            continue;
-        }
-
-        ret = pixConvertToPdfData(pix, pagetype, quality, &imdata, &imbytes,
-                                  0, 0, scaledres, title, NULL, 0);
-        pixDestroy(&pix);
-        if (ret) {
-            LEPT_FREE(imdata);
-            L_ERROR("pdf encoding failed for pix[%d]\n", __func__, i);
-            continue;
-        }
-        ba = l_byteaInitFromMem(imdata, imbytes);
-        LEPT_FREE(imdata);
-        ptraAdd(pa_data, ba);
-    }
+    pdfMakePages(NULL, pixa, NULL, res, scalefactor, type, quality, title,
+                 pa_data, NULL);
     ptraGetActualCount(pa_data, &n);
     if (n == 0) {
         L_ERROR("no pdf files made\n", __func__);
@@ -906,6 +850,193 @@ L_PTRA   *pa_data;
 }
 
 
+/*!
+ * \brief   pdfMakePages()
+ *
+ * \param[in]    sa            [optional] string array of pathnames for images
+ * \param[in]    pixa          [optional] images; use if %sa is null
+ * \param[in]    pixac         [optional] compressed images; use if %sa
+ *                             and %pixa are null
+ * \param[in]    res           input resolution of all images; 0 to use
+ *                             the resolution of each image
+ * \param[in]    scalefactor   scaling factor applied to each image; > 0.0
+ * \param[in]    type          encoding type (L_JPEG_ENCODE, L_G4_ENCODE,
+ *                             L_FLATE_ENCODE, L_JP2K_ENCODE, or
+ *                             L_DEFAULT_ENCODE for default)
+ * \param[in]    quality       for jpeg: 1-100; 0 for default (75)
+ *                             for jp2k: 27-45; 0 for default (34)
+ * \param[in]    title         [optional] pdf title; can be null
+ * \param[in]    pa_data       [optional] for the pages, as L_BYTEA
+ * \param[in]    pdfw          [optional] writer for the pages; use if
+ *                             %pa_data is null
+ * \return  number of pages made
+ *
+ * <pre>
+ * Notes:
+ *      (1) Each image is read from file or taken from %pixa or %pixac,
+ *          scaled, and encoded as a single page pdf.  The pages are
+ *          added in order, either to %pa_data or with
+ *          pdfWriterAddPageData().  This is used by the multipage
+ *          converters here and by pixacompConvertToPdfData().
+ *      (2) If l_pdfSetThreads() allows more than one thread, the images
+ *          are read and encoded on separate threads, PdfPagesPerThread
+ *          pages per thread at a time, which bounds the memory used.
+ *          The pages of each batch are added in order after they have
+ *          all been made.  Each page is encoded independently, so the
+ *          output does not depend on the number of threads.
+ *      (3) The pix in %pixa are cloned and destroyed outside the
+ *          parallel loop, because changes to the refcount are not
+ *          thread-safe.  A pix that appears twice in a batch is copied.
+ *          The pix in %pixac are made directly from the pixcomp,
+ *          because the cache of pixacompGetPix() is not thread-safe.
+ *          Placeholder images in %pixac, with a width of 1, are skipped.
+ *      (4) If a page cannot be written with %pdfw, for example because
+ *          the stream is full, no more pages are encoded.
+ * </pre>
+ */
+l_int32
+pdfMakePages(SARRAY        *sa,
+             PIXA          *pixa,
+             PIXAC         *pixac,
+             l_int32        res,
+             l_float32      scalefactor,
+             l_int32        type,
+             l_int32        quality,
+             const char    *title,
+             L_PTRA        *pa_data,
+             L_PDF_WRITER  *pdfw)
+{
+char      *fname;
+l_uint8  **pagedata;
+l_int32    i, j, k, n, nw, nwin, nthreads, npages, ret, failed;
+size_t    *pagebytes;
+PIX       *pix;
+PIX      **pixs;
+PIXC      *pixc;
+
+    if (!sa && !pixa && !pixac)
+        return ERROR_INT("no image source", __func__, 0);
+    if (!pa_data && !pdfw)
+        return ERROR_INT("neither pa_data nor pdfw defined", __func__, 0);
+
+    if (sa)
+        n = sarrayGetCount(sa);
+    else if (pixa)
+        n = pixaGetCount(pixa);
+    else
+        n = pixacompGetCount(pixac);
+    nthreads = l_pdfGetThreads();
+#ifdef _OPENMP
+    if (nthreads == 0)
+        nthreads = omp_get_max_threads();
+#else
+    nthreads = 1;
+#endif  /* _OPENMP */
+    nwin = (nthreads > 1) ? PdfPagesPerThread * nthreads : 1;
+    pagedata = (l_uint8 **)LEPT_CALLOC(nwin, sizeof(l_uint8 *));
+    pagebytes = (size_t *)LEPT_CALLOC(nwin, sizeof(size_t));
+    pixs = (PIX **)LEPT_CALLOC(nwin, sizeof(PIX *));
+
+    npages = 0;
+    failed = FALSE;
+    for (i = 0; i < n; i += nwin) {
+        nw = L_MIN(nwin, n - i);
+        if (!sa && pixa) {
+            for (j = 0; j < nw; j++) {
+                pixs[j] = pixaGetPix(pixa, i + j, L_CLONE);
+                for (k = 0; k < j; k++) {
+                    if (pixs[j] && pixs[j] == pixs[k]) {
+                        pixDestroy(&pixs[j]);
+                        pixs[j] = pixCopy(NULL, pixs[k]);
+                        break;
+                    }
+                }
+            }
+        }
+
+            /* Read and encode the batch of pages */
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+        private(fname, pix, pixc, ret) if (nthreads > 1)
+#endif  /* _OPENMP */
+        for (j = 0; j < nw; j++) {
+            if (sa) {
+                fname = sarrayGetString(sa, i + j, L_NOCOPY);
+                if ((pixs[j] = pixRead(fname)) == NULL)
+                    L_ERROR("image not readable from file %s\n",
+                            __func__, fname);
+            } else if (!pixa) {
+                pixc = pixacompGetPixcomp(pixac,
+                                          pixacompGetOffset(pixac) + i + j,
+                                          L_NOCOPY);
+                if ((pixs[j] = pixCreateFromPixcomp(pixc)) != NULL &&
+                    pixGetWidth(pixs[j]) == 1) {  /* placeholder */
+                    L_INFO("placeholder image[%d] has w = 1\n",
+                           __func__, i + j);
+                    pixDestroy(&pixs[j]);
+                    continue;
+                }
+            }
+            if (!pixs[j]) {
+                if (!sa)
+                    L_ERROR("pixs[%d] not retrieved\n", __func__, i + j);
+                continue;
+            }
+            if (scalefactor != 1.0) {
+                if ((pix = pixScale(pixs[j], scalefactor,
+                                    scalefactor)) == NULL) {
+                    L_ERROR("pix[%d] not made\n", __func__, i + j);
+                    continue;
+                }
+            } else {
+                pix = pixs[j];
+            }
+            ret = pixConvertToPdfData(pix, type, quality, &pagedata[j],
+                                      &pagebytes[j], 0, 0,
+                                      (l_int32)(res * scalefactor),
+                                      title, NULL, 0);
+            if (pix != pixs[j])
+                pixDestroy(&pix);
+            if (ret) {
+                LEPT_FREE(pagedata[j]);
+                pagedata[j] = NULL;
+                L_ERROR("pdf encoding failed for page %d\n", __func__, i + j);
+            }
+        }
+
+            /* Add the pages in order */
+        for (j = 0; j < nw; j++) {
+            pixDestroy(&pixs[j]);
+            if (pagedata[j] && !failed) {
+                if (pa_data) {
+                    ptraAdd(pa_data, l_byteaInitFromMem(pagedata[j],
+                                                        pagebytes[j]));
+                    npages++;
+                } else if (pdfWriterAddPageData(pdfw, pagedata[j],
+                                                pagebytes[j]) == 0) {
+                    npages++;
+                } else {
+                    L_ERROR("page %d not written; stopping\n",
+                            __func__, i + j);
+                    failed = TRUE;
+                }
+            }
+            LEPT_FREE(pagedata[j]);
+            pagedata[j] = NULL;
+        }
+        if (failed)
+            break;
+        if (sa && i + nw < n && (i + nw) / 10 > i / 10)
+            lept_stderr(".. %d ", 10 * ((i + nw) / 10));
+    }
+
+    LEPT_FREE(pagedata);
+    LEPT_FREE(pagebytes);
+    LEPT_FREE(pixs);
+    return npages;
+}
+
+
 /*---------------------------------------------------------------------*
  *                Single page, multi-image converters                  *
  *---------------------------------------------------------------------*/
@@ -130,6 +130,15 @@ l_ok pixaConvertToPdfData(PIXA *pixa, l_int32 res, l_float32 scalefactor,
 
 /* ----------------------------------------------------------------------*/
 
+l_int32 pdfMakePages(SARRAY *sa, PIXA *pixa, PIXAC *pixac, l_int32 res,
+                     l_float32 scalefactor, l_int32 type, l_int32 quality,
+                     const char *title, L_PTRA *pa_data, L_PDF_WRITER *pdfw)
+{
+    return ERROR_INT("function not present", __func__, 0);
+}
+
+/* ----------------------------------------------------------------------*/
+
 l_ok convertToPdf(const char *filein,
                   l_int32 type, l_int32 quality,
                   const char *fileout,
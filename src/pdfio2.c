@@ -36,11 +36,24 @@
  *     Intermediate function for generating multipage pdf output
  *          l_int32              ptraConcatenatePdfToData()
  *
+ *     Streaming multipage pdf writer
+ *          L_PDF_WRITER        *pdfWriterOpen()
+ *          L_PDF_WRITER        *pdfWriterOpenStream()
+ *          l_int32              pdfWriterAddPix()
+ *          l_int32              pdfWriterAddCompData()
+ *          l_int32              pdfWriterAddFile()
+ *          l_int32              pdfWriterAddPageData()
+ *          l_int32              pdfWriterGetPageCount()
+ *          l_int32              pdfWriterClose()
+ *          static void          pdfWriterWriteData()
+ *          static void          pdfWriterCopySpool()
+ *
  *     Convert tiff multipage to pdf file
  *          l_int32              convertTiffMultipageToPdf()
  *
  *     Generates the CID, transcoding under some conditions
  *          l_int32              l_generateCIDataForPdf()
+ *          l_int32              l_generateCIDataForPdfOrth()
  *          l_int32              l_generateCIData()
  *
  *       Lower-level CID generation without transcoding
@@ -98,6 +111,8 @@
  *     Set flags for special modes
  *          void                 l_pdfSetG4ImageMask()
  *          void                 l_pdfSetDateAndVersion()
+ *          l_int32              l_pdfSetThreads()
+ *          l_int32              l_pdfGetThreads()
  *
  * </pre>
  */
@@ -142,6 +157,9 @@ static l_int32       generateOutputDataPdf(l_uint8 **pdata, size_t *pnbytes,
 static l_int32       parseTrailerPdf(L_BYTEA *bas, L_DNA **pda);
 static char         *generatePagesObjStringPdf(NUMA *napage);
 static L_BYTEA      *substituteObjectNumbers(L_BYTEA *bas, NUMA *na_objs);
+static void          pdfWriterWriteData(L_PDF_WRITER *pdfw, FILE *fp,
+                                        const l_uint8 *data, size_t nbytes);
+static void          pdfWriterCopySpool(L_PDF_WRITER *pdfw);
 
 static L_PDF_DATA   *pdfdataCreate(const char *title);
 static void          pdfdataDestroy(L_PDF_DATA **plpd);
@@ -153,6 +171,8 @@ static L_COMP_DATA  *pdfdataGetCid(L_PDF_DATA *lpd, l_int32 index);
 static l_int32   var_WRITE_G4_IMAGE_MASK = 1;
     /* Write date/time and lib version into pdf; this is the default */
 static l_int32   var_WRITE_DATE_AND_VERSION = 1;
+    /* Number of threads for encoding pages; 1 to encode them in turn */
+static l_int32   var_PDF_THREADS = 1;
 
 #define L_SMALLBUF   256
 #define L_BIGBUF    2048   /* must be able to hold hex colormap */
@@ -471,6 +491,489 @@ NUMAA    *naa_objs;  /* object mapping numbers to new values */
 }
 
 
+/*---------------------------------------------------------------------*
+ *                   Streaming multipage pdf writer                    *
+ *---------------------------------------------------------------------*/
+/*! Pdf writer state for adding pages to an output stream */
+struct L_PdfWriter
+{
+    FILE      *fp;        /* output stream                                */
+    FILE      *fpt;       /* temporary stream for the page objects        */
+    l_int32    ownfp;     /* 1 if the stream is closed with the writer    */
+    l_int32    failed;    /* 1 after a write error                        */
+    size_t     nbytes;    /* number of bytes written to the output stream */
+    size_t     nspool;    /* number of bytes written to the temp stream   */
+    L_DNA     *daloc;     /* location of each object; index is obj number */
+    NUMA      *napage;    /* object number of each Page object            */
+};
+
+
+/*!
+ * \brief   pdfWriterOpen()
+ *
+ * \param[in]    fileout    output pdf file
+ * \param[in]    title      [optional] pdf title; can be null
+ * \return  writer, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This opens a pdf file to which pages are added, one at a
+ *          time, with pdfWriterAddPix(), pdfWriterAddCompData() or
+ *          pdfWriterAddFile().  The file is finished and closed by
+ *          pdfWriterClose().
+ *      (2) Each page is written to a temporary file as soon as it is
+ *          added, so only the data for one page is held in memory,
+ *          regardless of the number of pages.  On closing, the Pages
+ *          object is written, followed by the pages and the trailer.
+ *          The layout is the same as for ptraConcatenatePdfToData().
+ * </pre>
+ */
+L_PDF_WRITER *
+pdfWriterOpen(const char  *fileout,
+              const char  *title)
+{
+FILE          *fp;
+L_PDF_WRITER  *pdfw;
+
+    if (!fileout)
+        return (L_PDF_WRITER *)ERROR_PTR("fileout not defined", __func__, NULL);
+    if ((fp = fopenWriteStream(fileout, "wb")) == NULL)
+        return (L_PDF_WRITER *)ERROR_PTR_1("stream not opened",
+                                           fileout, __func__, NULL);
+    if ((pdfw = pdfWriterOpenStream(fp, title)) == NULL) {
+        fclose(fp);
+        return (L_PDF_WRITER *)ERROR_PTR("pdfw not made", __func__, NULL);
+    }
+    pdfw->ownfp = 1;
+    return pdfw;
+}
+
+
+/*!
+ * \brief   pdfWriterOpenStream()
+ *
+ * \param[in]    fp       output stream, opened for writing
+ * \param[in]    title    [optional] pdf title; can be null
+ * \return  writer, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) See pdfWriterOpen().  The stream is only written
+ *          sequentially, so it can be a pipe or a socket.
+ *          It is not closed by pdfWriterClose().  The pages are
+ *          held in a temporary file until the writer is closed.
+ *      (2) The header, catalog and info objects are the same as for
+ *          a single page pdf.
+ * </pre>
+ */
+L_PDF_WRITER *
+pdfWriterOpenStream(FILE        *fp,
+                    const char  *title)
+{
+L_PDF_DATA    *lpd;
+L_PDF_WRITER  *pdfw;
+
+    if (!fp)
+        return (L_PDF_WRITER *)ERROR_PTR("stream not defined", __func__, NULL);
+
+    if ((pdfw = (L_PDF_WRITER *)LEPT_CALLOC(1, sizeof(L_PDF_WRITER)))
+            == NULL)
+        return (L_PDF_WRITER *)ERROR_PTR("pdfw not made", __func__, NULL);
+#ifdef _WIN32
+    pdfw->fpt = fopenWriteWinTempfile();
+#else
+    pdfw->fpt = tmpfile();
+#endif  /* _WIN32 */
+    if (!pdfw->fpt) {
+        LEPT_FREE(pdfw);
+        return (L_PDF_WRITER *)ERROR_PTR("tmpfile stream not opened",
+                                         __func__, NULL);
+    }
+    pdfw->fp = fp;
+    pdfw->daloc = l_dnaCreate(0);
+    pdfw->napage = numaCreate(0);
+
+        /* Write the header and objects 1 and 2.  The location of
+         * the Pages object (3) is set when it is written on closing. */
+    lpd = pdfdataCreate(title);
+    generateFixedStringsPdf(lpd);
+    l_dnaAddNumber(pdfw->daloc, 0);
+    pdfWriterWriteData(pdfw, fp, (l_uint8 *)lpd->id, strlen(lpd->id));
+    l_dnaAddNumber(pdfw->daloc, pdfw->nbytes);
+    pdfWriterWriteData(pdfw, fp, (l_uint8 *)lpd->obj1, strlen(lpd->obj1));
+    l_dnaAddNumber(pdfw->daloc, pdfw->nbytes);
+    pdfWriterWriteData(pdfw, fp, (l_uint8 *)lpd->obj2, strlen(lpd->obj2));
+    l_dnaAddNumber(pdfw->daloc, 0);
+    pdfdataDestroy(&lpd);
+    if (pdfw->failed) {
+        fclose(pdfw->fpt);
+        l_dnaDestroy(&pdfw->daloc);
+        numaDestroy(&pdfw->napage);
+        LEPT_FREE(pdfw);
+        return (L_PDF_WRITER *)ERROR_PTR("header not written", __func__, NULL);
+    }
+    return pdfw;
+}
+
+
+/*!
+ * \brief   pdfWriterAddPix()
+ *
+ * \param[in]    pdfw
+ * \param[in]    pix        all depths; cmap OK
+ * \param[in]    type       L_G4_ENCODE, L_JPEG_ENCODE, L_FLATE_ENCODE,
+ *                          L_JP2K_ENCODE, or L_DEFAULT_ENCODE for default
+ * \param[in]    quality    for jpeg: 1-100; 0 for default (75)
+ *                          for jp2k: 27-45; 0 for default (34)
+ * \param[in]    res        override the resolution of the image, in ppi;
+ *                          use 0 to respect the resolution of the pix
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This encodes %pix and writes it as the next page.
+ *      (2) If %type is not one of the four encodings, it is chosen
+ *          with selectDefaultPdfEncoding().
+ * </pre>
+ */
+l_ok
+pdfWriterAddPix(L_PDF_WRITER  *pdfw,
+                PIX           *pix,
+                l_int32        type,
+                l_int32        quality,
+                l_int32        res)
+{
+l_uint8  *data;
+l_int32   ret;
+size_t    nbytes;
+
+    if (!pdfw)
+        return ERROR_INT("pdfw not defined", __func__, 1);
+    if (!pix)
+        return ERROR_INT("pix not defined", __func__, 1);
+
+    ret = pixConvertToPdfData(pix, type, quality, &data, &nbytes,
+                              0, 0, res, NULL, NULL, 0);
+    if (ret) {
+        LEPT_FREE(data);
+        return ERROR_INT("pdf page not made", __func__, 1);
+    }
+    ret = pdfWriterAddPageData(pdfw, data, nbytes);
+    LEPT_FREE(data);
+    return ret;
+}
+
+
+/*!
+ * \brief   pdfWriterAddCompData()
+ *
+ * \param[in]    pdfw
+ * \param[in]    cid      compressed image data
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This writes the compressed image data as the next page,
+ *          at the resolution of %cid.
+ *      (2) As with cidConvertToPdfData(), the cid is absorbed and
+ *          destroyed by this function; the caller must not destroy it.
+ * </pre>
+ */
+l_ok
+pdfWriterAddCompData(L_PDF_WRITER  *pdfw,
+                     L_COMP_DATA   *cid)
+{
+l_uint8  *data;
+l_int32   ret;
+size_t    nbytes;
+
+    if (!pdfw) {
+        l_CIDataDestroy(&cid);
+        return ERROR_INT("pdfw not defined", __func__, 1);
+    }
+    if (!cid)
+        return ERROR_INT("cid not defined", __func__, 1);
+
+    if (cidConvertToPdfData(cid, NULL, &data, &nbytes))
+        return ERROR_INT("pdf page not made", __func__, 1);
+    ret = pdfWriterAddPageData(pdfw, data, nbytes);
+    LEPT_FREE(data);
+    return ret;
+}
+
+
+/*!
+ * \brief   pdfWriterAddFile()
+ *
+ * \param[in]    pdfw
+ * \param[in]    fname     image file in any format
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This writes the image as the next page without scaling.
+ *          As with convertUnscaledToPdfData(), jpeg, jp2k and some png
+ *          files are not transcoded.
+ * </pre>
+ */
+l_ok
+pdfWriterAddFile(L_PDF_WRITER  *pdfw,
+                 const char    *fname)
+{
+l_uint8  *data;
+l_int32   ret;
+size_t    nbytes;
+
+    if (!pdfw)
+        return ERROR_INT("pdfw not defined", __func__, 1);
+    if (!fname)
+        return ERROR_INT("fname not defined", __func__, 1);
+
+    if (convertUnscaledToPdfData(fname, NULL, &data, &nbytes))
+        return ERROR_INT_1("pdf page not made", fname, __func__, 1);
+    ret = pdfWriterAddPageData(pdfw, data, nbytes);
+    LEPT_FREE(data);
+    return ret;
+}
+
+
+/*!
+ * \brief   pdfWriterAddPageData()
+ *
+ * \param[in]    pdfw
+ * \param[in]    data      single page pdf made by leptonica
+ * \param[in]    nbytes    size of data
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This writes a page that has already been encoded, for example
+ *          by pixConvertToPdfData().  It allows pages to be encoded
+ *          elsewhere, such as on other threads, and written in order.
+ *      (2) As in ptraConcatenatePdfToData(), objects 4 and higher of
+ *          the page are renumbered to follow the objects already
+ *          written, and references to the Pages object (3) are kept.
+ *          Object 4 is the Page object.
+ *      (3) The objects are written to the temporary stream.  Their
+ *          locations are relative to the start of that stream until
+ *          they are shifted in pdfWriterClose().
+ * </pre>
+ */
+l_ok
+pdfWriterAddPageData(L_PDF_WRITER  *pdfw,
+                     l_uint8       *data,
+                     size_t         nbytes)
+{
+l_uint8  *objdata;
+l_int32   j, nobj, index;
+l_int32  *sizes, *locs;
+size_t    size;
+L_BYTEA  *bas, *bat1, *bat2;
+L_DNA    *da_locs, *da_sizes;
+NUMA     *na_objs;
+
+    if (!pdfw)
+        return ERROR_INT("pdfw not defined", __func__, 1);
+    if (!data || nbytes == 0)
+        return ERROR_INT("no page data", __func__, 1);
+    if (pdfw->failed)
+        return ERROR_INT("previous write failed", __func__, 1);
+
+    bas = l_byteaInitFromMem(data, nbytes);
+    if (parseTrailerPdf(bas, &da_locs) != 0) {
+        l_byteaDestroy(&bas);
+        return ERROR_INT("page data not parsed", __func__, 1);
+    }
+
+        /* Map the objects of the page to the next object numbers */
+    nobj = l_dnaGetCount(da_locs) - 1;
+    index = l_dnaGetCount(pdfw->daloc);
+    numaAddNumber(pdfw->napage, index);
+    na_objs = numaMakeConstant(0.0, nobj);
+    numaReplaceNumber(na_objs, 3, 3);
+    for (j = 4; j < nobj; j++)
+        numaSetValue(na_objs, j, index++);
+
+        /* Write the renumbered objects */
+    da_sizes = l_dnaDiffAdjValues(da_locs);
+    sizes = l_dnaGetIArray(da_sizes);
+    locs = l_dnaGetIArray(da_locs);
+    for (j = 4; j < nobj; j++) {
+        l_dnaAddNumber(pdfw->daloc, pdfw->nspool);
+        bat1 = l_byteaInitFromMem(data + locs[j], sizes[j]);
+        bat2 = substituteObjectNumbers(bat1, na_objs);
+        objdata = l_byteaGetData(bat2, &size);
+        pdfWriterWriteData(pdfw, pdfw->fpt, objdata, size);
+        l_byteaDestroy(&bat1);
+        l_byteaDestroy(&bat2);
+    }
+
+    LEPT_FREE(sizes);
+    LEPT_FREE(locs);
+    l_dnaDestroy(&da_locs);
+    l_dnaDestroy(&da_sizes);
+    numaDestroy(&na_objs);
+    l_byteaDestroy(&bas);
+    if (pdfw->failed)
+        return ERROR_INT("page not written", __func__, 1);
+    return 0;
+}
+
+
+/*!
+ * \brief   pdfWriterGetPageCount()
+ *
+ * \param[in]    pdfw
+ * \return  number of pages written, or 0 on error
+ */
+l_int32
+pdfWriterGetPageCount(L_PDF_WRITER  *pdfw)
+{
+    if (!pdfw)
+        return ERROR_INT("pdfw not defined", __func__, 0);
+    return numaGetCount(pdfw->napage);
+}
+
+
+/*!
+ * \brief   pdfWriterClose()
+ *
+ * \param[in,out]   ppdfw    will be set to null before returning
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This writes the Pages object (3), with references to all
+ *          the pages, then copies the pages from the temporary stream
+ *          and writes the xref table and trailer.  The Pages object
+ *          is ahead of the pages, as in ptraConcatenatePdfToData().
+ *      (2) The stream is closed if it was opened by pdfWriterOpen().
+ *      (3) It is an error if no pages were written.  The output is
+ *          still a valid pdf with no pages.
+ * </pre>
+ */
+l_ok
+pdfWriterClose(L_PDF_WRITER  **ppdfw)
+{
+char          *str;
+l_int32        i, n, ret;
+l_float64      loc;
+L_PDF_WRITER  *pdfw;
+
+    if (!ppdfw)
+        return ERROR_INT("&pdfw not defined", __func__, 1);
+    if ((pdfw = *ppdfw) == NULL)
+        return ERROR_INT("pdfw not defined", __func__, 1);
+    *ppdfw = NULL;
+
+        /* Write the Pages object after objects 1 and 2 */
+    l_dnaSetValue(pdfw->daloc, 3, pdfw->nbytes);
+    if ((str = generatePagesObjStringPdf(pdfw->napage)) != NULL) {
+        pdfWriterWriteData(pdfw, pdfw->fp, (l_uint8 *)str, strlen(str));
+        LEPT_FREE(str);
+    }
+
+        /* Shift the page objects to follow it, and copy them over */
+    n = l_dnaGetCount(pdfw->daloc);
+    for (i = 4; i < n; i++) {
+        l_dnaGetDValue(pdfw->daloc, i, &loc);
+        l_dnaSetValue(pdfw->daloc, i, loc + pdfw->nbytes);
+    }
+    pdfWriterCopySpool(pdfw);
+
+        /* Write the trailer */
+    l_dnaAddNumber(pdfw->daloc, pdfw->nbytes);
+    if ((str = makeTrailerStringPdf(pdfw->daloc)) != NULL) {
+        pdfWriterWriteData(pdfw, pdfw->fp, (l_uint8 *)str, strlen(str));
+        LEPT_FREE(str);
+    }
+    if (fflush(pdfw->fp) != 0)
+        pdfw->failed = 1;
+
+    ret = pdfw->failed;
+    if (numaGetCount(pdfw->napage) == 0) {
+        L_ERROR("no pages were written\n", __func__);
+        ret = 1;
+    }
+    if (pdfw->ownfp && fclose(pdfw->fp) != 0)
+        ret = 1;
+    fclose(pdfw->fpt);
+    if (pdfw->failed)
+        L_ERROR("pdf data not written to stream\n", __func__);
+    l_dnaDestroy(&pdfw->daloc);
+    numaDestroy(&pdfw->napage);
+    LEPT_FREE(pdfw);
+    return ret;
+}
+
+
+/*!
+ * \brief   pdfWriterWriteData()
+ *
+ * \param[in]    pdfw
+ * \param[in]    fp        output stream or temporary stream of pdfw
+ * \param[in]    data      bytes to write
+ * \param[in]    nbytes    number of bytes
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) This keeps count of the bytes written to each stream, for
+ *          the object locations in the xref table.  After a write
+ *          error, nothing more is written.
+ * </pre>
+ */
+static void
+pdfWriterWriteData(L_PDF_WRITER  *pdfw,
+                   FILE          *fp,
+                   const l_uint8 *data,
+                   size_t         nbytes)
+{
+    if (pdfw->failed)
+        return;
+    if (fwrite(data, 1, nbytes, fp) != nbytes)
+        pdfw->failed = 1;
+    if (fp == pdfw->fp)
+        pdfw->nbytes += nbytes;
+    else
+        pdfw->nspool += nbytes;
+}
+
+
+/*!
+ * \brief   pdfWriterCopySpool()
+ *
+ * \param[in]    pdfw
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) This copies the page objects from the temporary stream to
+ *          the output stream, in blocks of fixed size.
+ * </pre>
+ */
+static void
+pdfWriterCopySpool(L_PDF_WRITER  *pdfw)
+{
+l_uint8  buf[16384];
+size_t   nread, nleft;
+
+    if (pdfw->failed)
+        return;
+    rewind(pdfw->fpt);
+    nleft = pdfw->nspool;
+    while (nleft > 0) {
+        nread = fread(buf, 1, L_MIN(nleft, sizeof(buf)), pdfw->fpt);
+        if (nread == 0) {
+            pdfw->failed = 1;
+            return;
+        }
+        pdfWriterWriteData(pdfw, pdfw->fp, buf, nread);
+        nleft -= nread;
+    }
+}
+
+
 /*---------------------------------------------------------------------*
  *                  Convert tiff multipage to pdf file                 *
  *---------------------------------------------------------------------*/
@@ -597,6 +1100,76 @@ PIX          *pixt;
 }
 
 
+/*!
+ * \brief   l_generateCIDataForPdfOrth()
+ *
+ * \param[in]    fname      image file
+ * \param[in]    quads      0-3; number of 90 degree cw rotations
+ * \param[in]    quality    for jpeg if transcoded: 1-100; 0 for default (75)
+ *                          for jp2k if transcoded: 27-45; 0 for default (34)
+ * \param[out]   pcid       compressed data
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is l_generateCIDataForPdf() for an image that is to be
+ *          rotated by a multiple of 90 degrees.
+ *      (2) A jpeg file is rotated in the DCT domain with jpegTransformMem()
+ *          when the edges that are moved are aligned to the iMCU size.
+ *          The rotated data is then wrapped without transcoding, so there
+ *          is no loss of quality and no decoding.
+ *      (3) Otherwise, the image is read, rotated with pixRotateOrth(),
+ *          and encoded with the default encoding for the result.
+ * </pre>
+ */
+l_ok
+l_generateCIDataForPdfOrth(const char    *fname,
+                           l_int32        quads,
+                           l_int32        quality,
+                           L_COMP_DATA  **pcid)
+{
+l_int32   format, lossless, ret;
+size_t    nbytes, nbytesr;
+l_uint8  *data, *datar;
+PIX      *pix1, *pix2;
+
+    if (!pcid)
+        return ERROR_INT("&cid not defined", __func__, 1);
+    *pcid = NULL;
+    if (!fname)
+        return ERROR_INT("fname not defined", __func__, 1);
+    if (quads < 0 || quads > 3)
+        return ERROR_INT("quads not in {0,1,2,3}", __func__, 1);
+    if (quads == 0)
+        return l_generateCIDataForPdf(fname, NULL, quality, pcid);
+
+        /* Rotate jpeg data without decoding, if possible */
+    findFileFormat(fname, &format);
+    if (format == IFF_JFIF_JPEG) {
+        if ((data = l_binaryRead(fname, &nbytes)) == NULL)
+            return ERROR_INT_1("data not read", fname, __func__, 1);
+        datar = NULL;
+        jpegCheckTransformMem(data, nbytes, quads, NULL, &lossless);
+        if (lossless)
+            jpegTransformMem(data, nbytes, quads, NULL, &datar, &nbytesr);
+        LEPT_FREE(data);
+        if (datar) {  /* l_generateJpegDataMem() takes ownership of datar */
+            if ((*pcid = l_generateJpegDataMem(datar, nbytesr, 0)) != NULL)
+                return 0;
+        }
+    }
+
+        /* Otherwise, decode, rotate and encode */
+    if ((pix1 = pixRead(fname)) == NULL)
+        return ERROR_INT_1("pix not read", fname, __func__, 1);
+    pix2 = pixRotateOrth(pix1, quads);
+    ret = l_generateCIDataForPdf(NULL, pix2, quality, pcid);
+    pixDestroy(&pix1);
+    pixDestroy(&pix2);
+    return ret;
+}
+
+
 /*!
  * \brief   l_generateCIData()
  *
@@ -2611,8 +3184,9 @@ pdfdataGetCid(L_PDF_DATA  *lpd,
  * Notes:
  *      (1) Looks for the argument of the first instance of /Count in the file.
  *      (2) This first reads 10000 bytes from the beginning of the file.
- *          If "/Count" is not in that string, it reads the entire file
- *          and looks for "/Count".
+ *          If "/Count" is not in that string, it reads 10000 bytes from
+ *          the end of the file, and then the entire file, looking for
+ *          "/Count".
  *      (3) This will not work on encrypted pdf files or on files where
  *          the "/Count" field is binary compressed.  Not finding the
  *          "/Count" field is not an error, but a warning is given.
@@ -2624,7 +3198,7 @@ getPdfPageCount(const char  *fname,
 {
 l_uint8  *data;
 l_int32   format, loc, ret, npages, found;
-size_t    nread;
+size_t    nread, size;
 
     if (!pnpages)
         return ERROR_INT("&npages not defined", __func__, 1);
@@ -2643,10 +3217,19 @@ size_t    nread;
         return ERROR_INT("partial data not read", __func__, 1);
 
         /* Find the location of the first instance of "/Count".
-         * If it is not found, try reading the entire file and
-         * looking again. */
+         * If it is not found, try the end of the file, where the
+         * Pages object is put by the streaming pdf writer.  Failing
+         * that, read the entire file and look again. */
     arrayFindSequence(data, nread, (const l_uint8 *)"/Count",
           strlen("/Count"), &loc, &found);
+    if (!found && (size = nbytesInFile(fname)) > 10000) {
+        LEPT_FREE(data);
+        if ((data = l_binaryReadSelect(fname, size - 10000, 10000, &nread))
+                 == NULL)
+            return ERROR_INT("partial data not read", __func__, 1);
+        arrayFindSequence(data, nread, (const l_uint8 *)"/Count",
+              strlen("/Count"), &loc, &found);
+    }
     if (!found) {
         lept_stderr("Reading entire file looking for '/Count'\n");
         LEPT_FREE(data);
@@ -3054,6 +3637,53 @@ l_pdfSetDateAndVersion(l_int32  flag)
     var_WRITE_DATE_AND_VERSION = flag;
 }
 
+
+/*!
+ * \brief   l_pdfSetThreads()
+ *
+ * \param[in]    nthreads    max number of threads for encoding pages;
+ *                           1 to encode them in turn; 0 for all available
+ * \return       prev        previous number of threads
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is used in the multipage converters from image files
+ *          and from pixa and pixacomp, such as saConvertFilesToPdfData()
+ *          and pixacompConvertToPdfData(), to read and encode several
+ *          pages at once.  The output is the same for any number of
+ *          threads.  The default is 1.
+ *      (2) It returns the previous value, so for example:
+ *           l_int32  prev = l_pdfSetThreads(0);  // use all threads
+ *           convertFilesToPdf(...);
+ *           l_pdfSetThreads(prev);   // resets to previous value
+ *      (3) On error, logs a message and does not change the variable.
+ * </pre>
+ */
+l_int32
+l_pdfSetThreads(l_int32  nthreads)
+{
+l_int32  prev;
+
+    prev = var_PDF_THREADS;
+    if (nthreads < 0)
+        L_ERROR("invalid nthreads; unchanged\n", __func__);
+    else
+        var_PDF_THREADS = nthreads;
+    return prev;
+}
+
+
+/*!
+ * \brief   l_pdfGetThreads()
+ *
+ * \return  max number of threads for encoding pages; 0 for all available
+ */
+l_int32
+l_pdfGetThreads(void)
+{
+    return var_PDF_THREADS;
+}
+
 /* --------------------------------------------*/
 #endif  /* USE_PDFIO */
 /* --------------------------------------------*/
@@ -63,6 +63,63 @@ l_ok ptraConcatenatePdfToData(L_PTRA *pa_data, SARRAY *sa,
 
 /* ----------------------------------------------------------------------*/
 
+L_PDF_WRITER * pdfWriterOpen(const char *fileout, const char *title)
+{
+    return (L_PDF_WRITER *)ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
+L_PDF_WRITER * pdfWriterOpenStream(FILE *fp, const char *title)
+{
+    return (L_PDF_WRITER *)ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok pdfWriterAddPix(L_PDF_WRITER *pdfw, PIX *pix, l_int32 type,
+                     l_int32 quality, l_int32 res)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok pdfWriterAddCompData(L_PDF_WRITER *pdfw, L_COMP_DATA *cid)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok pdfWriterAddFile(L_PDF_WRITER *pdfw, const char *fname)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok pdfWriterAddPageData(L_PDF_WRITER *pdfw, l_uint8 *data, size_t nbytes)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_int32 pdfWriterGetPageCount(L_PDF_WRITER *pdfw)
+{
+    return ERROR_INT("function not present", __func__, 0);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok pdfWriterClose(L_PDF_WRITER **ppdfw)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
 l_ok convertTiffMultipageToPdf(const char *filein, const char *fileout)
 {
     return ERROR_INT("function not present", __func__, 1);
@@ -78,6 +135,14 @@ l_ok l_generateCIDataForPdf(const char *fname, PIX *pix, l_int32 quality,
 
 /* ----------------------------------------------------------------------*/
 
+l_ok l_generateCIDataForPdfOrth(const char *fname, l_int32 quads,
+                                l_int32 quality, L_COMP_DATA **pcid)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
 L_COMP_DATA * l_generateFlateDataPdf(const char *fname, PIX *pix)
 {
     return (L_COMP_DATA *)ERROR_PTR("function not present", __func__, NULL);
@@ -162,6 +227,20 @@ void l_pdfSetDateAndVersion(l_int32 flag)
 
 /* ----------------------------------------------------------------------*/
 
+l_int32 l_pdfSetThreads(l_int32 nthreads)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_int32 l_pdfGetThreads(void)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
 /* --------------------------------------------*/
 #endif  /* !USE_PDFIO */
 /* --------------------------------------------*/
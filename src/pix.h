@@ -66,6 +66,10 @@
  *         struct FPix
  *         struct FPixa
  *         struct DPix
+ *         struct L_Integral
+ *         struct RLPix
+ *         struct L_Pboxa
+ *         struct L_Boxgrid
  *         struct PixComp
  *         struct PixaComp
  *
@@ -293,6 +297,27 @@ typedef struct FPixa FPIXA;
 /*! Pix with double array */
 typedef struct DPix DPIX;
 
+/*-------------------------------------------------------------------------*
+ *                   L_Integral: integral image of a pix                   *
+ *-------------------------------------------------------------------------*/
+/*! Integral image (summed-area table) */
+typedef struct L_Integral L_INTEGRAL;
+
+/*-------------------------------------------------------------------------*
+ *                   RLPix: run-length encoded 1 bpp pix                   *
+ *-------------------------------------------------------------------------*/
+/*! Run-length encoded 1 bpp pix */
+typedef struct RLPix RLPIX;
+
+/*-------------------------------------------------------------------------*
+ *                    L_Pboxa: packed array of boxes                       *
+ *-------------------------------------------------------------------------*/
+/*! Array of boxes with packed coordinate arrays */
+typedef struct L_Pboxa L_PBOXA;
+
+/*! Spatial index over a set of boxes */
+typedef struct L_Boxgrid L_BOXGRID;
+
 /*-------------------------------------------------------------------------*
  *                       Compressed pix and arrays                         *
  *-------------------------------------------------------------------------*/
@@ -106,6 +106,8 @@
  *          l_int32       pixSetData()
  *          l_int32       pixFreeData()
  *          l_uint32     *pixExtractData()
+ *          l_int32       pixSetMappedData()
+ *          l_int32       pixIsMapped()
  *
  *    Pix line ptrs
  *          void        **pixGetLinePtrs()
@@ -191,6 +193,15 @@
  *  on the pix data field, look carefully at the behavior of the image
  *  data accessors and keep in mind that when you invoke pixDestroy(),
  *  the pix considers itself the owner of all its heap data.
+ *
+ *  Image data in a file mapping
+ *  ----------------------------
+ *
+ *  The image data can also be in a file that is mapped into memory;
+ *  see pixSetMappedData().  The pix then owns the mapping instead of
+ *  heap data, and it unmaps the file when the data is freed.  The
+ *  functions above handle this, and pixExtractData() returns a heap
+ *  copy of mapped data, so it can be freed in the usual way.
  * </pre>
  */
 
@@ -651,14 +662,12 @@ PIX  *pix;
 static void
 pixFree(PIX  *pix)
 {
-l_uint32  *data;
-char      *text;
+char  *text;
 
     if (!pix) return;
 
     if (--pix->refcount == 0) {
-        if ((data = pixGetData(pix)) != NULL)
-            pixdata_free(data);
+        pixFreeData(pix);
         if ((text = pixGetText(pix)) != NULL)
             LEPT_FREE(text);
 
@@ -914,7 +923,11 @@ PIX     *pixs;
     if (pixs->refcount == 1) {  /* transfer the data, cmap, text */
         pixFreeData(pixd);  /* dealloc any existing data */
         pixSetData(pixd, pixGetData(pixs));  /* transfer new data from pixs */
+        pixd->mapdata = pixs->mapdata;  /* and the file mapping, if any */
+        pixd->mapsize = pixs->mapsize;
         pixs->data = NULL;  /* pixs no longer owns data */
+        pixs->mapdata = NULL;
+        pixs->mapsize = 0;
         pixDestroyColormap(pixd);  /* free the old one, if it exists */
         pixd->colormap = pixGetColormap(pixs);  /* transfer to pixd */
         pixs->colormap = NULL;  /* pixs no longer owns colormap */
@@ -1721,6 +1734,8 @@ pixFreeAndSetData(PIX       *pix,
  * Notes:
  *      (1) This does not free any existing data.  To free existing
  *          data, use pixFreeAndSetData() instead.
+ *      (2) The exception is data in a file mapping, which is not owned
+ *          by anything else, so it is unmapped when it is replaced.
  * </pre>
  */
 l_int32
@@ -1730,6 +1745,10 @@ pixSetData(PIX       *pix,
     if (!pix)
         return ERROR_INT("pix not defined", __func__, 1);
 
+    if (pix->mapdata && data != pix->data) {
+        l_binaryUnmap(&pix->mapdata, pix->mapsize);
+        pix->mapsize = 0;
+    }
     pix->data = data;
     return 0;
 }
@@ -1757,7 +1776,11 @@ l_uint32  *data;
     if (!pix)
         return ERROR_INT("pix not defined", __func__, 1);
 
-    if ((data = pixGetData(pix)) != NULL) {
+    if (pix->mapdata) {  /* the data is in a file mapping */
+        l_binaryUnmap(&pix->mapdata, pix->mapsize);
+        pix->mapsize = 0;
+        pix->data = NULL;
+    } else if ((data = pixGetData(pix)) != NULL) {
         pixdata_free(data);
         pix->data = NULL;
     }
@@ -1779,6 +1802,9 @@ l_uint32  *data;
  *          pix->data ptr is set to NULL.
  *      (3) If refcount > 1, this simply returns a copy of the data,
  *          using the pix allocator, and leaving the input pix unchanged.
+ *      (4) If the data is in a file mapping, a copy is always returned.
+ *          With refcount == 1, the mapping is then released and the
+ *          pix->data ptr is set to NULL, as in (2).
  * </pre>
  */
 l_uint32 *
@@ -1790,21 +1816,86 @@ l_uint32  *data, *datas;
     if (!pixs)
         return (l_uint32 *)ERROR_PTR("pixs not defined", __func__, NULL);
 
-    if (pixs->refcount == 1) {  /* extract */
+    if (pixs->refcount == 1 && !pixs->mapdata) {  /* extract */
         data = pixGetData(pixs);
         pixSetData(pixs, NULL);
-    } else {  /* refcount > 1; copy */
+    } else {  /* refcount > 1 or mapped; copy */
         bytes = 4 * pixGetWpl(pixs) * pixGetHeight(pixs);
         datas = pixGetData(pixs);
         if ((data = (l_uint32 *)pixdata_malloc(bytes)) == NULL)
             return (l_uint32 *)ERROR_PTR("data not made", __func__, NULL);
         memcpy(data, datas, bytes);
+        if (pixs->refcount == 1)  /* release the mapping */
+            pixFreeData(pixs);
     }
 
     return data;
 }
 
 
+/*!
+ * \brief   pixSetMappedData()
+ *
+ * \param[in]   pix
+ * \param[in]   data      image data within the mapping
+ * \param[in]   mapdata   file mapping, from l_binaryMapPrivate()
+ * \param[in]   mapsize   size of the mapping
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This frees any existing data in the pix and assigns %data,
+ *          which is in a file mapping.  The pix takes ownership of the
+ *          mapping, and releases it with l_binaryUnmap() when the data
+ *          is freed.
+ *      (2) %data must be aligned on a 4-byte boundary, and must hold
+ *          4 * wpl * h bytes within the mapping.
+ *      (3) Use a copy-on-write mapping, because leptonica functions
+ *          may write to the data of an input pix; for example, to
+ *          clear the pad bits.  The file is never changed.
+ * </pre>
+ */
+l_ok
+pixSetMappedData(PIX       *pix,
+                 l_uint32  *data,
+                 l_uint8   *mapdata,
+                 size_t     mapsize)
+{
+size_t  offset;
+
+    if (!pix)
+        return ERROR_INT("pix not defined", __func__, 1);
+    if (!data || !mapdata)
+        return ERROR_INT("data or mapdata not defined", __func__, 1);
+    if ((l_uint8 *)data < mapdata || ((size_t)data & 3) != 0)
+        return ERROR_INT("data not aligned in mapping", __func__, 1);
+    offset = (l_uint8 *)data - mapdata;
+    if (offset + 4LL * pixGetWpl(pix) * pixGetHeight(pix) > mapsize)
+        return ERROR_INT("data extends past the mapping", __func__, 1);
+
+    pixFreeData(pix);
+    pix->data = data;
+    pix->mapdata = mapdata;
+    pix->mapsize = mapsize;
+    return 0;
+}
+
+
+/*!
+ * \brief   pixIsMapped()
+ *
+ * \param[in]   pix
+ * \return  1 if the image data is in a file mapping; 0 otherwise
+ */
+l_int32
+pixIsMapped(PIX  *pix)
+{
+    if (!pix)
+        return ERROR_INT("pix not defined", __func__, 0);
+    return (pix->mapdata != NULL);
+}
+
+
 /*--------------------------------------------------------------------*
  *                          Pix line ptrs                             *
  *--------------------------------------------------------------------*/
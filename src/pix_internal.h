@@ -65,6 +65,10 @@
  *       struct FPix
  *       struct FPixa
  *       struct DPix
+ *       struct L_Integral
+ *       struct RLPix
+ *       struct L_Pboxa
+ *       struct L_Boxgrid
  *       struct PixComp
  *       struct PixaComp
  *
@@ -194,6 +198,9 @@ struct Pix
     char                *text;      /*!< text string associated with pix   */
     struct PixColormap  *colormap;  /*!< colormap (may be null)            */
     l_uint32            *data;      /*!< the image data                    */
+    l_uint8             *mapdata;   /*!< file mapping holding the image    */
+                                    /*!< data; usually null                */
+    size_t               mapsize;   /*!< size of the file mapping          */
 };
 
 /*! Colormap of a Pix */
@@ -386,6 +393,87 @@ struct DPix
 };
 
 
+/*-------------------------------------------------------------------------*
+ *                   L_Integral: integral image of a pix                   *
+ *-------------------------------------------------------------------------*/
+/*! Integral image (summed-area table), with optional sums of squares.
+ *  Element (x, y) of each table is the sum over all pixels (j, i) of
+ *  the source with j < x and i < y, so that the first row and column
+ *  are 0.  The sums wrap around modulo 2^32, so a rectangle sum is
+ *  exact when it is less than 2^32; the sums of squares are 64-bit.   */
+struct L_Integral
+{
+    l_int32              w;         /*!< width of source pix               */
+    l_int32              h;         /*!< height of source pix              */
+    l_int32              d;         /*!< depth of source pix: 1 or 8       */
+    l_int32              wpl;       /*!< elements/line of tables: w + 1    */
+    l_uint32            *sum;       /*!< (w + 1) x (h + 1) array of sums   */
+    l_uint64            *sqsum;     /*!< (w + 1) x (h + 1) array of sums   */
+                                    /*!< of squares; can be null           */
+};
+
+
+/*-------------------------------------------------------------------------*
+ *                   RLPix: run-length encoded 1 bpp pix                   *
+ *-------------------------------------------------------------------------*/
+/*! Run-length encoded 1 bpp pix.  The runs of fg pixels on line i are
+ *  stored in elements [rowstart[i], rowstart[i + 1]) of the xstart and
+ *  xend arrays, in increasing order of x.  Runs on a line neither
+ *  overlap nor touch, and xend is the last pixel of the run.          */
+struct RLPix
+{
+    l_int32              w;         /*!< width in pixels                   */
+    l_int32              h;         /*!< height in pixels                  */
+    l_int32              xres;      /*!< image res (ppi) in x direction    */
+                                    /*!< (use 0 if unknown)                */
+    l_int32              yres;      /*!< image res (ppi) in y direction    */
+                                    /*!< (use 0 if unknown)                */
+    l_int32              nruns;     /*!< total number of runs              */
+    l_int32              nalloc;    /*!< size of allocated run arrays      */
+    l_int32             *rowstart;  /*!< index of first run on each line;  */
+                                    /*!< size h + 1                        */
+    l_int32             *xstart;    /*!< first pixel of each run           */
+    l_int32             *xend;      /*!< last pixel of each run            */
+};
+
+
+/*-------------------------------------------------------------------------*
+ *                    L_Pboxa: packed array of boxes                       *
+ *-------------------------------------------------------------------------*/
+/*! Array of boxes, with the coordinates of box i at index i in each of
+ *  the four arrays.  There is no refcount; boxes are not shared.      */
+struct L_Pboxa
+{
+    l_int32              n;         /*!< number of boxes                   */
+    l_int32              nalloc;    /*!< size of allocated arrays          */
+    l_int32             *x;         /*!< left coordinates                  */
+    l_int32             *y;         /*!< top coordinates                   */
+    l_int32             *w;         /*!< box widths                        */
+    l_int32             *h;         /*!< box heights                       */
+};
+
+/*! Spatial index over a set of boxes.  The plane is divided into
+ *  nx * ny cells, and the indices of the boxes that touch cell k are
+ *  in index[cellstart[k]] ... index[cellstart[k + 1] - 1], in
+ *  increasing order.                                                  */
+struct L_Boxgrid
+{
+    l_int32              nx;        /*!< number of cells horizontally      */
+    l_int32              ny;        /*!< number of cells vertically        */
+    l_int32              cellw;     /*!< cell width                        */
+    l_int32              cellh;     /*!< cell height                       */
+    l_int32              xmin;      /*!< left side of the first cell       */
+    l_int32              ymin;      /*!< top of the first cell             */
+    l_int32             *cellstart; /*!< start of each cell in index;      */
+                                    /*!< size nx * ny + 1                  */
+    l_int32             *index;     /*!< box indices for all cells         */
+    l_int32             *mark;      /*!< query stamp for each box, to      */
+                                    /*!< avoid duplicates                  */
+    l_int32              stamp;     /*!< current query stamp               */
+    struct L_Pboxa      *pba;       /*!< copy of the indexed boxes         */
+};
+
+
 /*-------------------------------------------------------------------------*
  *                        PixComp: compressed pix                          *
  *-------------------------------------------------------------------------*/
@@ -405,6 +493,8 @@ struct PixComp
     l_int32              cmapflag;  /*!< flag (1 for cmap, 0 otherwise)    */
     l_uint8             *data;      /*!< the compressed image data         */
     size_t               size;      /*!< size of the data array            */
+    l_int32              mapped;    /*!< 1 if data is in a mapped file     */
+                                    /*!<   owned by the pixacomp           */
 };
 
 
@@ -421,6 +511,15 @@ struct PixaComp
     l_int32              offset;    /*!< indexing offset into ptr array    */
     struct PixComp     **pixc;      /*!< the array of ptrs to PixComp      */
     struct Boxa         *boxa;      /*!< array of boxes                    */
+    l_uint8             *mapdata;   /*!< [optional] mapped file holding    */
+                                    /*!<   the compressed data             */
+    size_t               mapsize;   /*!< size of the mapped file           */
+    l_int32              cachesize; /*!< max number of decompressed pix    */
+                                    /*!<   kept; 0 for no cache            */
+    struct Pix         **cachepix;  /*!< cache of decompressed pix         */
+    l_int32             *cacheindex; /*!< array index of each cached pix   */
+    l_uint32            *cacheuse;  /*!< time of last use of each entry    */
+    l_uint32             cacheclock; /*!< incremented on each access       */
 };
 
 #endif  /* LEPTONICA_PIX_INTERNAL_H */
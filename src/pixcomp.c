@@ -65,6 +65,8 @@
  *           l_int32   pixacompGetCount()
  *           PIXC     *pixacompGetPixcomp()
  *           PIX      *pixacompGetPix()
+ *           l_int32   pixacompSetCacheSize()
+ *           static void  pixacompCacheRemove()
  *           l_int32   pixacompGetPixDimensions()
  *           BOXA     *pixacompGetBoxa()
  *           l_int32   pixacompGetBoxaCount()
@@ -84,6 +86,8 @@
  *           PIXAC    *pixacompRead()
  *           PIXAC    *pixacompReadStream()
  *           PIXAC    *pixacompReadMem()
+ *           PIXAC    *pixacompReadMapped()
+ *           static PIXAC  *pixacompReadStreamInternal()
  *           l_int32   pixacompWrite()
  *           l_int32   pixacompWriteStream()
  *           l_int32   pixacompWriteMem()
@@ -145,6 +149,14 @@
  *   This would allocate an array of 50 pixcomps, but if you asked for
  *   the pix at index 10, using pixacompGetPix(pixac, 10), it would
  *   apply the offset internally, returning the pix at index 0 in the array.
+ *
+ *   For long documents, pixacompReadMapped() reads a serialized pixacomp
+ *   without loading the compressed data: the file is mapped into memory
+ *   and each pixcomp refers to its data in the mapping.  Decompressed
+ *   images can also be kept in a small cache, with the least recently
+ *   used one dropped when it is full (see pixacompSetCacheSize()), so
+ *   that repeated access to the same pages in multi-pass processing
+ *   does not decompress them each time.
  * </pre>
  */
 
@@ -166,6 +178,9 @@ static const size_t  MaxDataSize = 1000000000;   /* 1 GB */
 
     /* Static functions */
 static l_int32 pixacompExtendArray(PIXAC *pixac);
+static void pixacompCacheRemove(PIXAC *pixac, l_int32 aindex);
+static PIXAC *pixacompReadStreamInternal(FILE *fp, l_uint8 *mapdata,
+                                         size_t mapsize);
 static l_int32 pixcompFastConvertToPdfData(PIXC *pixc, const char *title,
                                            l_uint8 **pdata, size_t *pnbytes);
 
@@ -347,6 +362,8 @@ PIXC     *pixc;
  * <pre>
  * Notes:
  *      (1) Always nulls the input ptr.
+ *      (2) Data in a mapped file is not freed; the mapping is owned
+ *          by the pixacomp.
  * </pre>
  */
 void
@@ -362,7 +379,8 @@ PIXC  *pixc;
     if ((pixc = *ppixc) == NULL)
         return;
 
-    LEPT_FREE(pixc->data);
+    if (!pixc->mapped)
+        LEPT_FREE(pixc->data);
     if (pixc->text)
         LEPT_FREE(pixc->text);
     LEPT_FREE(pixc);
@@ -862,6 +880,9 @@ PIXAC   *pixac;
         pixcompDestroy(&pixac->pixc[i]);
     LEPT_FREE(pixac->pixc);
     boxaDestroy(&pixac->boxa);
+    pixacompSetCacheSize(pixac, 0);
+    if (pixac->mapdata)
+        l_binaryUnmap(&pixac->mapdata, pixac->mapsize);
     LEPT_FREE(pixac);
     *ppixac = NULL;
 }
@@ -1075,6 +1096,7 @@ PIXC    *pixct;
     pixct = pixacompGetPixcomp(pixac, index, L_NOCOPY);  /* use %index */
     pixcompDestroy(&pixct);
     pixac->pixc[aindex] = pixc;  /* replace; use array index */
+    pixacompCacheRemove(pixac, aindex);
 
     return 0;
 }
@@ -1173,13 +1195,21 @@ l_int32  aindex;
  * Notes:
  *      (1) The %index includes the offset, which must be subtracted
  *          to get the actual index into the ptr array.
+ *      (2) If the pixac has a cache (see pixacompSetCacheSize()), the
+ *          decompressed pix is kept there, and a copy is returned.
+ *          Getting the pix again while it is still in the cache only
+ *          requires a copy.  The returned pix is owned by the caller
+ *          in either case.
+ *      (3) With a cache, this changes the pixac, so it must not be
+ *          called on the same pixac from more than one thread at once.
  * </pre>
  */
 PIX *
 pixacompGetPix(PIXAC   *pixac,
                l_int32  index)
 {
-l_int32  aindex;
+l_int32  aindex, i, islot;
+PIX     *pix;
 PIXC    *pixc;
 
     if (!pixac)
@@ -1189,7 +1219,111 @@ PIXC    *pixc;
         return (PIX *)ERROR_PTR("array index not valid", __func__, NULL);
 
     pixc = pixacompGetPixcomp(pixac, index, L_NOCOPY);
-    return pixCreateFromPixcomp(pixc);
+    if (pixac->cachesize == 0)
+        return pixCreateFromPixcomp(pixc);
+
+        /* Look in the cache; also find an empty or the least
+         * recently used entry, in case it is not there */
+    pixac->cacheclock++;
+    islot = 0;
+    for (i = 0; i < pixac->cachesize; i++) {
+        if (pixac->cachepix[i] && pixac->cacheindex[i] == aindex) {
+            pixac->cacheuse[i] = pixac->cacheclock;
+            return pixCopy(NULL, pixac->cachepix[i]);
+        }
+        if (!pixac->cachepix[i])
+            pixac->cacheuse[i] = 0;
+        if (pixac->cacheuse[i] < pixac->cacheuse[islot])
+            islot = i;
+    }
+
+        /* Decompress, and replace the entry */
+    if ((pix = pixCreateFromPixcomp(pixc)) == NULL)
+        return (PIX *)ERROR_PTR("pix not made", __func__, NULL);
+    pixDestroy(&pixac->cachepix[islot]);
+    pixac->cachepix[islot] = pix;
+    pixac->cacheindex[islot] = aindex;
+    pixac->cacheuse[islot] = pixac->cacheclock;
+    return pixCopy(NULL, pix);
+}
+
+
+/*!
+ * \brief   pixacompSetCacheSize()
+ *
+ * \param[in]    pixac
+ * \param[in]    cachesize   max number of decompressed pix to keep;
+ *                           0 for no cache
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) With a cache, pixacompGetPix() keeps up to %cachesize of
+ *          the most recently used decompressed pix.  When the cache
+ *          is full, the least recently used pix is dropped.  This makes
+ *          repeated access to the same images fast, while bounding
+ *          the memory used.
+ *      (2) Any pix in the current cache are destroyed.
+ *      (3) The cache is not written by pixacompWrite().
+ * </pre>
+ */
+l_ok
+pixacompSetCacheSize(PIXAC   *pixac,
+                     l_int32  cachesize)
+{
+l_int32  i;
+
+    if (!pixac)
+        return ERROR_INT("pixac not defined", __func__, 1);
+    if (cachesize < 0)
+        return ERROR_INT("cachesize < 0", __func__, 1);
+
+    for (i = 0; i < pixac->cachesize; i++)
+        pixDestroy(&pixac->cachepix[i]);
+    LEPT_FREE(pixac->cachepix);
+    LEPT_FREE(pixac->cacheindex);
+    LEPT_FREE(pixac->cacheuse);
+    pixac->cachesize = 0;
+    pixac->cacheclock = 0;
+    if (cachesize == 0)
+        return 0;
+
+    pixac->cachepix = (PIX **)LEPT_CALLOC(cachesize, sizeof(PIX *));
+    pixac->cacheindex = (l_int32 *)LEPT_CALLOC(cachesize, sizeof(l_int32));
+    pixac->cacheuse = (l_uint32 *)LEPT_CALLOC(cachesize, sizeof(l_uint32));
+    if (!pixac->cachepix || !pixac->cacheindex || !pixac->cacheuse) {
+        LEPT_FREE(pixac->cachepix);
+        LEPT_FREE(pixac->cacheindex);
+        LEPT_FREE(pixac->cacheuse);
+        return ERROR_INT("cache not made", __func__, 1);
+    }
+    pixac->cachesize = cachesize;
+    return 0;
+}
+
+
+/*!
+ * \brief   pixacompCacheRemove()
+ *
+ * \param[in]    pixac
+ * \param[in]    aindex   index into the ptr array; not including offset
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) This drops the cached pix for a pixcomp that is replaced.
+ * </pre>
+ */
+static void
+pixacompCacheRemove(PIXAC   *pixac,
+                    l_int32  aindex)
+{
+l_int32  i;
+
+    for (i = 0; i < pixac->cachesize; i++) {
+        if (pixac->cachepix[i] && pixac->cacheindex[i] == aindex)
+            pixDestroy(&pixac->cachepix[i]);
+    }
 }
 
 
@@ -1628,19 +1762,45 @@ PIXAC  *pixac;
  */
 PIXAC *
 pixacompReadStream(FILE  *fp)
+{
+    if (!fp)
+        return (PIXAC *)ERROR_PTR("stream not defined", __func__, NULL);
+
+    return pixacompReadStreamInternal(fp, NULL, 0);
+}
+
+
+/*!
+ * \brief   pixacompReadStreamInternal()
+ *
+ * \param[in]    fp        file stream
+ * \param[in]    mapdata   [optional] mapped data of the file for %fp
+ * \param[in]    mapsize   size of the mapped data
+ * \return  pixac, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) If %mapdata is null, the compressed data of each pixcomp is
+ *          read from the stream.  Otherwise, the stream is only used
+ *          for the headers; the data is skipped, and each pixcomp
+ *          points to its data in %mapdata.
+ * </pre>
+ */
+static PIXAC *
+pixacompReadStreamInternal(FILE     *fp,
+                           l_uint8  *mapdata,
+                           size_t    mapsize)
 {
 char      buf[256];
 l_uint8  *data;
 l_int32   n, offset, i, w, h, d, ignore;
 l_int32   comptype, cmapflag, version, xres, yres;
 size_t    size;
+l_int64   loc;
 BOXA     *boxa;
 PIXC     *pixc;
 PIXAC    *pixac;
 
-    if (!fp)
-        return (PIXAC *)ERROR_PTR("stream not defined", __func__, NULL);
-
     if (fscanf(fp, "\nPixacomp Version %d\n", &version) != 1)
         return (PIXAC *)ERROR_PTR("not a pixacomp file", __func__, NULL);
     if (version != PIXACOMP_VERSION_NUMBER)
@@ -1695,17 +1855,33 @@ PIXAC    *pixac;
             pixacompDestroy(&pixac);
             return (PIXAC *)ERROR_PTR("read fail for res", __func__, NULL);
         }
-        if ((data = (l_uint8 *)LEPT_CALLOC(1, size)) == NULL) {
-            pixacompDestroy(&pixac);
-            return (PIXAC *)ERROR_PTR("calloc fail for data", __func__, NULL);
+        if (mapdata) {  /* skip over the data */
+            loc = ftell(fp);
+            if (loc < 0 || (size_t)loc + size > mapsize ||
+                fseek(fp, size, SEEK_CUR) != 0) {
+                pixacompDestroy(&pixac);
+                return (PIXAC *)ERROR_PTR("data not in file", __func__, NULL);
+            }
+            data = mapdata + loc;
+        } else {
+            if ((data = (l_uint8 *)LEPT_CALLOC(1, size)) == NULL) {
+                pixacompDestroy(&pixac);
+                return (PIXAC *)ERROR_PTR("calloc fail for data",
+                                          __func__, NULL);
+            }
+            if (fread(data, 1, size, fp) != size) {
+                pixacompDestroy(&pixac);
+                LEPT_FREE(data);
+                return (PIXAC *)ERROR_PTR("error reading data",
+                                          __func__, NULL);
+            }
         }
-        if (fread(data, 1, size, fp) != size) {
+        fgetc(fp);  /* swallow the ending nl */
+        if ((pixc = (PIXC *)LEPT_CALLOC(1, sizeof(PIXC))) == NULL) {
             pixacompDestroy(&pixac);
-            LEPT_FREE(data);
-            return (PIXAC *)ERROR_PTR("error reading data", __func__, NULL);
+            if (!mapdata) LEPT_FREE(data);
+            return (PIXAC *)ERROR_PTR("pixc not made", __func__, NULL);
         }
-        fgetc(fp);  /* swallow the ending nl */
-        pixc = (PIXC *)LEPT_CALLOC(1, sizeof(PIXC));
         pixc->w = w;
         pixc->h = h;
         pixc->d = d;
@@ -1715,6 +1891,7 @@ PIXAC    *pixac;
         pixc->cmapflag = cmapflag;
         pixc->data = data;
         pixc->size = size;
+        pixc->mapped = (mapdata != NULL);
         pixacompAddPixcomp(pixac, pixc, L_INSERT);
     }
     return pixac;
@@ -1752,6 +1929,67 @@ PIXAC  *pixac;
 }
 
 
+/*!
+ * \brief   pixacompReadMapped()
+ *
+ * \param[in]    filename    serialized pixacomp, from pixacompWrite()
+ * \param[in]    cachesize   max number of decompressed pix to keep;
+ *                           0 for no cache
+ * \return  pixac, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This reads the headers of the pixcomp, giving the location
+ *          and size of the compressed data of each one, and maps the file
+ *          into memory (see l_binaryMap()) instead of reading the data.
+ *          Each pixcomp refers to its data in the mapping, which is
+ *          paged in from the file only when the image is decompressed.
+ *          The memory used is then small and does not grow with the
+ *          number of images.
+ *      (2) The file must not be changed while the pixac exists.
+ *          The mapping is released by pixacompDestroy().
+ *      (3) Decompressed images are kept in a cache of size %cachesize;
+ *          see pixacompSetCacheSize().
+ *      (4) The pixac can be used like any other.  Pixcomp that are
+ *          added or replaced are in memory, and pixcomp that are
+ *          copied out of it have their own data.
+ * </pre>
+ */
+PIXAC *
+pixacompReadMapped(const char  *filename,
+                   l_int32      cachesize)
+{
+l_uint8  *mapdata;
+size_t    mapsize;
+FILE     *fp;
+PIXAC    *pixac;
+
+    if (!filename)
+        return (PIXAC *)ERROR_PTR("filename not defined", __func__, NULL);
+    if (cachesize < 0)
+        return (PIXAC *)ERROR_PTR("cachesize < 0", __func__, NULL);
+
+    if ((mapdata = l_binaryMap(filename, &mapsize)) == NULL)
+        return (PIXAC *)ERROR_PTR_1("file not mapped",
+                                    filename, __func__, NULL);
+    if ((fp = fopenReadStream(filename)) == NULL) {
+        l_binaryUnmap(&mapdata, mapsize);
+        return (PIXAC *)ERROR_PTR_1("stream not opened",
+                                    filename, __func__, NULL);
+    }
+    pixac = pixacompReadStreamInternal(fp, mapdata, mapsize);
+    fclose(fp);
+    if (!pixac) {
+        l_binaryUnmap(&mapdata, mapsize);
+        return (PIXAC *)ERROR_PTR_1("pixac not read",
+                                    filename, __func__, NULL);
+    }
+    pixac->mapdata = mapdata;
+    pixac->mapsize = mapsize;
+    pixacompSetCacheSize(pixac, cachesize);
+    return pixac;
+}
+
 /*!
  * \brief   pixacompWrite()
  *
@@ -1968,6 +2206,9 @@ size_t    nbytes;
  * <pre>
  * Notes:
  *      (1) See pixacompConvertToPdf().
+ *      (2) If l_pdfSetThreads() allows more than one thread, several
+ *          pages are decompressed and encoded at once.  The output is
+ *          the same for any number of threads.
  * </pre>
  */
 l_ok
@@ -1980,11 +2221,8 @@ pixacompConvertToPdfData(PIXAC       *pixac,
                          l_uint8    **pdata,
                          size_t      *pnbytes)
 {
-l_uint8  *imdata;
-l_int32   i, n, ret, scaledres, pagetype;
-size_t    imbytes;
+l_int32   i, n, ret;
 L_BYTEA  *ba;
-PIX      *pixs, *pix;
 L_PTRA   *pa_data;
 
     if (!pdata)
@@ -2005,47 +2243,9 @@ L_PTRA   *pa_data;
     }
 
         /* Generate all the encoded pdf strings */
-    n = pixacompGetCount(pixac);
-    pa_data = ptraCreate(n);
-    for (i = 0; i < n; i++) {
-        if ((pixs =
-             pixacompGetPix(pixac, pixacompGetOffset(pixac) + i)) == NULL) {
-            L_ERROR("pix[%d] not retrieved\n", __func__, i);
-            continue;
-        }
-        if (pixGetWidth(pixs) == 1) {  /* used sometimes as placeholders */
-            L_INFO("placeholder image[%d] has w = 1\n", __func__, i);
-            pixDestroy(&pixs);
-            continue;
-        }
-        if (scalefactor != 1.0)
-            pix = pixScale(pixs, scalefactor, scalefactor);
-        else
-            pix = pixClone(pixs);
-        pixDestroy(&pixs);
-        scaledres = (l_int32)(res * scalefactor);
-
-            /* Select the encoding type */
-        if (type != L_DEFAULT_ENCODE) {
-            pagetype = type;
-        } else if (selectDefaultPdfEncoding(pix, &pagetype) != 0) {
-            L_ERROR("encoding type selection failed for pix[%d]\n",
-                    __func__, i);
-            pixDestroy(&pix);
-            continue;
-        }
-
-        ret = pixConvertToPdfData(pix, pagetype, quality, &imdata, &imbytes,
-                                  0, 0, scaledres, title, NULL, 0);
-        pixDestroy(&pix);
-        if (ret) {
-            L_ERROR("pdf encoding failed for pix[%d]\n", __func__, i);
-            continue;
-        }
-        ba = l_byteaInitFromMem(imdata, imbytes);
-        LEPT_FREE(imdata);
-        ptraAdd(pa_data, ba);
-    }
+    pa_data = ptraCreate(pixacompGetCount(pixac));
+    pdfMakePages(NULL, NULL, pixac, res, scalefactor, type, quality, title,
+                 pa_data, NULL);
     ptraGetActualCount(pa_data, &n);
     if (n == 0) {
         L_ERROR("no pdf files made\n", __func__);
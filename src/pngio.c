@@ -46,10 +46,19 @@
  *          l_int32     pixWritePng()  [ special top level ]
  *          l_int32     pixWriteStreamPng()
  *          l_int32     pixSetZlibCompression()
+ *          static void     pngSetWriteParams()
+ *
+ *    Compressing png image data on several threads
+ *          static l_int32  pngWriteImageParallel()
+ *          static void     pngFilterRow()
  *
  *    Set flag for special read mode
  *          void        l_pngSetReadStrip16To8()
  *
+ *    Set preset for writing
+ *          l_int32     l_pngSetWritePreset()
+ *          l_int32     l_pngGetWritePreset()
+ *
  *    Low-level memio utility (thanks to T. D. Hintz)
  *          static void memio_png_write_data()
  *          static void memio_png_flush()
@@ -96,6 +105,27 @@
  *    Note that if you are using the defined constants in zlib instead
  *    of the compression integers given above, you must include zlib-ng.h.
  *
+ *    When more than one thread is requested with l_zlibSetThreads(),
+ *    the image data of large images is filtered and compressed on
+ *    several threads, using zlibCompressParallel(), and written as
+ *    IDAT chunks.  The row filters are those of the write preset
+ *    (see below).  This is not used with the settings of
+ *    pix->special >= 80.
+ *
+ *    The zlib level and the row filters can be chosen together with
+ *    l_pngSetWritePreset().  The filters depend on the image type:
+ *    colormapped images and images with depth < 8 are never filtered,
+ *    because filtering the packed indices only hurts compression.
+ *    For gray and rgb, the presets are:
+ *       L_PNG_WRITE_DEFAULT    libpng defaults: level 6, all filters
+ *       L_PNG_WRITE_FASTEST    level 1, sub filter only
+ *       L_PNG_WRITE_BALANCED   level 3, all filters
+ *       L_PNG_WRITE_SMALLEST   level 9, all filters; for rgb, without
+ *                              the Z_FILTERED strategy
+ *    A zlib level set on the pix with pixSetZlibCompression() overrides
+ *    the level of the preset.  See prog/pngpresets.c for a comparison
+ *    of encoding time and size.
+ *
  *    There is global for determining the size of retained samples:
  *             var_PNG_STRIP_16_to_8
  *    and a function l_pngSetReadStrip16To8() for setting it.
@@ -147,11 +177,27 @@
      * If you don't strip, you can't read the gray-alpha spp = 2 images. */
 static l_int32   var_PNG_STRIP_16_TO_8 = 1;
 
+/* ------------------ Set default for write preset ------------------- */
+static l_int32   var_PNG_WRITE_PRESET = L_PNG_WRITE_DEFAULT;
+
 #ifndef  NO_CONSOLE_IO
 #define  DEBUG_READ     0
 #define  DEBUG_WRITE    0
 #endif  /* ~NO_CONSOLE_IO */
 
+    /* Smallest image data for compressing on several threads */
+static const size_t  MinParallelPngBytes = 262144;
+
+static void pngSetWriteParams(png_structp png_ptr, PIX *pix, l_int32 d,
+                              l_int32 cmflag, l_int32 *pcompval,
+                              l_int32 *pfilters);
+static l_int32 pngWriteImageParallel(png_structp png_ptr, PIX *pix,
+                                     l_int32 compval, l_int32 filters,
+                                     l_int32 nthreads);
+static void pngFilterRow(const l_uint8 *row, const l_uint8 *prev,
+                         l_int32 rowbytes, l_int32 bpp, l_int32 filters,
+                         l_uint8 *out);
+
 
 static const unsigned int pngBespokeSpecials[20] = {
   31131, // filter_type: 0xB8, strategy: 1, compression: 9, window: 15, filesize:ratio: 33.802606, time_spent: 33.802605, flags: 0x7937
@@ -1083,7 +1129,7 @@ pixWriteStreamPng(FILE      *fp,
                   l_float32  gamma)
 {
 char         commentstring[] = "Comment";
-l_int32      i, j, k, wpl, d, spp, compval, valid;
+l_int32      i, j, k, wpl, d, spp, compval, filters, valid, nthreads, ret;
 l_int32      cmflag, opaque, max_trans, ncolors;
 l_int32     *rmap, *gmap, *bmap, *amap;
 l_uint32    *data, *ppixel;
@@ -1165,88 +1211,7 @@ char        *text;
 
     png_init_io(png_ptr, fp);
 
-        /* With best zlib compression (9), get between 1 and 10% improvement
-         * over default (6), but the compression is 3 to 10 times slower.
-         * Use the zlib default (6) as our default compression unless
-         * pix->special falls in the range [10 ... 19]; then subtract 10
-         * to get the compression value.  */
-    compval = Z_DEFAULT_COMPRESSION;
-	if (pix->special >= 10 && pix->special < 20) {
-		compval = pix->special - 10;
-	}
-	png_set_compression_level(png_ptr, compval);
-
-		/*
-		* When pix->special is 100 or larger, it encodes several PNG tweakable
-		* settings, which may be used to produce tighter PNGs or to produce
-		* them faster (lower CPU effort/cost).
-		*
-		* When pix->special is in the range 80..99, one of 20 presets is used
-		* instead.
-		*/
-	if (pix->special >= 80) {
-		/*
-		 * Definition of methods:
-		 *
-		 * - PNG defines 4 filters, which may be combined, plus 'none':
-		 *   PNG_FILTER_NONE or { PNG_FILTER_SUB, PNG_FILTER_UP, PNG_FILTER_AVG, PNG_FILTER_PAETH }
-		 *
-		 * - 9 compression levels 1..9 + 0 = no compression, which makes 10 levels.
-		 *
-		 * - 4 strategies, where only Z_FILTERED will apply the filters, AFAICT.
-		 *
-		 * - RLE compression window 8..15, which is unused when the strategy is Z_HUFFMAN_ONLY.
-		 *   Meanwhile RLE compression is more or less independent of the compression level 1..9:
-		 *   pngcrush says 1..3 are the same and so are 4..9.
-		 *
-		 */
-		unsigned int spec = pix->special - 100;
-		if (pix->special < 100) {
-			// 80..99 are preset indices:
-			spec = pngBespokeSpecials[pix->special - 80];
-		}
-		int filter_type = spec & 0x1F;
-		spec >>= 5;
-		int strategy = spec & 0x07;   // 4 strategies + 0 = 'default' makes 5, taking up 3 bits.
-		spec >>= 3;
-		int compression = spec & 0x0F;   // 10 compression levels, taking up 4 bits.
-		spec >>= 4;
-		int window = spec;			   // 8 window sizes, taking up 3 bits.
-
-		filter_type <<= 3;				// 0b01 --> PNG_FILTER_NONE, etc.
-		if (filter_type < PNG_FILTER_NONE || filter_type > PNG_ALL_FILTERS)
-			filter_type = PNG_NO_FILTERS;
-
-		if (compression < Z_NO_COMPRESSION || compression > Z_BEST_COMPRESSION)
-			compression = Z_DEFAULT_COMPRESSION;
-
-		window += 8;
-		if (window < 8 || window > 15)
-			window = 15;
-
-		if (strategy < Z_DEFAULT_STRATEGY || strategy > Z_FIXED)
-			strategy = Z_DEFAULT_STRATEGY;
-
-		png_set_compression_level(png_ptr, compression);
-
-		png_set_filter(png_ptr, 0, filter_type);
-
-		/* Set other zlib parameters for compressing IDAT */
-		png_set_compression_mem_level(png_ptr, 8);
-		png_set_compression_strategy(png_ptr, strategy);
-		png_set_compression_window_bits(png_ptr, window);
-		//png_set_compression_method(png_ptr, Z_DEFLATED);
-		//png_set_compression_buffer_size(png_ptr, PNG_ZBUF_SIZE);
-
-			/* Set zlib parameters for text compression
-			 * If you don't call these, the parameters
-			 * fall back on those defined for IDAT chunks
-			 */
-		png_set_text_compression_mem_level(png_ptr, 8);
-		png_set_text_compression_strategy(png_ptr, strategy);
-		png_set_text_compression_window_bits(png_ptr, window);
-		//png_set_text_compression_method(png_ptr, Z_DEFLATED);
-	}
+    pngSetWriteParams(png_ptr, pix, d, cmflag, &compval, &filters);
 
     png_set_IHDR(png_ptr, info_ptr, w, h, bit_depth, color_type,
                  PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_BASE,
@@ -1314,6 +1279,16 @@ char        *text;
         /* Write header and palette info */
     png_write_info(png_ptr, info_ptr);
 
+        /* Optionally, compress the image data on several threads */
+    nthreads = l_zlibGetThreads();
+    if (nthreads != 1 && pix->special < 80 &&
+        (size_t)w * h * d / 8 >= MinParallelPngBytes) {
+        ret = pngWriteImageParallel(png_ptr, pix, compval, filters,
+                                    nthreads);
+        png_destroy_write_struct(&png_ptr, &info_ptr);
+        return ret;
+    }
+
     if ((d != 32) && (d != 24)) {  /* not rgb color */
             /* Generate a temporary pix with bytes swapped.
              * For writing a 1 bpp image as png:
@@ -1417,6 +1392,397 @@ pixSetZlibCompression(PIX     *pix,
 }
 
 
+/*!
+ * \brief   pngSetWriteParams()
+ *
+ * \param[in]    png_ptr
+ * \param[in]    pix
+ * \param[in]    d          depth of pix
+ * \param[in]    cmflag     1 if the png will have a colormap
+ * \param[out]   pcompval   zlib compression level
+ * \param[out]   pfilters   png row filter mask
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) This sets the zlib parameters and row filters on the png_ptr,
+ *          from the write preset and pix->special, and returns the
+ *          level and filters for pngWriteImageParallel().
+ *      (2) With best zlib compression (9), get between 1 and 10%
+ *          improvement over default (6), but the compression is 3 to 10
+ *          times slower.  If pix->special falls in the range [10 ... 19],
+ *          subtract 10 to get the compression level, which overrides
+ *          the level of the preset.
+ *      (3) Colormapped images and images with depth < 8 are not
+ *          filtered, as in libpng.  For the other images:
+ *          ~ The fastest preset uses only the sub filter, which saves
+ *            the cost of choosing a filter for each row and does nearly
+ *            as well as the others on photographs.
+ *          ~ Levels 1 to 3 use the fast deflate matcher, which ignores
+ *            the strategy.  On the test images, level 3 gives smaller
+ *            files than level 6 in half the time, so it is used for
+ *            the balanced preset.
+ *          ~ libpng uses Z_FILTERED when the rows are filtered.  At
+ *            level 9, this helps for gray but is 2-4% worse than
+ *            Z_DEFAULT_STRATEGY for rgb, so the smallest preset uses
+ *            the latter for rgb.
+ *      (4) When pix->special is 80 or larger, the bespoke settings
+ *          override everything else.
+ * </pre>
+ */
+static void
+pngSetWriteParams(png_structp  png_ptr,
+                  PIX         *pix,
+                  l_int32      d,
+                  l_int32      cmflag,
+                  l_int32     *pcompval,
+                  l_int32     *pfilters)
+{
+l_int32  compval, filters, zstrategy, nofilter;
+
+    nofilter = (cmflag || d < 8);
+    filters = (nofilter) ? PNG_FILTER_NONE : PNG_ALL_FILTERS;
+    zstrategy = -1;  /* libpng default */
+    switch (var_PNG_WRITE_PRESET) {
+    case L_PNG_WRITE_FASTEST:
+        compval = Z_BEST_SPEED;
+        if (!nofilter)
+            filters = PNG_FILTER_SUB;
+        break;
+    case L_PNG_WRITE_BALANCED:
+        compval = 3;
+        break;
+    case L_PNG_WRITE_SMALLEST:
+        compval = Z_BEST_COMPRESSION;
+        if (d >= 24)
+            zstrategy = Z_DEFAULT_STRATEGY;
+        break;
+    default:
+        compval = Z_DEFAULT_COMPRESSION;
+        break;
+    }
+    if (pix->special >= 10 && pix->special < 20)
+        compval = pix->special - 10;
+    png_set_compression_level(png_ptr, compval);
+    if (var_PNG_WRITE_PRESET != L_PNG_WRITE_DEFAULT)
+        png_set_filter(png_ptr, 0, filters);
+    if (zstrategy >= 0)
+        png_set_compression_strategy(png_ptr, zstrategy);
+    *pcompval = compval;
+    *pfilters = filters;
+
+		/*
+		* When pix->special is 100 or larger, it encodes several PNG tweakable
+		* settings, which may be used to produce tighter PNGs or to produce
+		* them faster (lower CPU effort/cost).
+		*
+		* When pix->special is in the range 80..99, one of 20 presets is used
+		* instead.
+		*/
+	if (pix->special >= 80) {
+		/*
+		 * Definition of methods:
+		 *
+		 * - PNG defines 4 filters, which may be combined, plus 'none':
+		 *   PNG_FILTER_NONE or { PNG_FILTER_SUB, PNG_FILTER_UP, PNG_FILTER_AVG, PNG_FILTER_PAETH }
+		 *
+		 * - 9 compression levels 1..9 + 0 = no compression, which makes 10 levels.
+		 *
+		 * - 4 strategies, where only Z_FILTERED will apply the filters, AFAICT.
+		 *
+		 * - RLE compression window 8..15, which is unused when the strategy is Z_HUFFMAN_ONLY.
+		 *   Meanwhile RLE compression is more or less independent of the compression level 1..9:
+		 *   pngcrush says 1..3 are the same and so are 4..9.
+		 *
+		 */
+		unsigned int spec = pix->special - 100;
+		if (pix->special < 100) {
+			// 80..99 are preset indices:
+			spec = pngBespokeSpecials[pix->special - 80];
+		}
+		int filter_type = spec & 0x1F;
+		spec >>= 5;
+		int strategy = spec & 0x07;   // 4 strategies + 0 = 'default' makes 5, taking up 3 bits.
+		spec >>= 3;
+		int compression = spec & 0x0F;   // 10 compression levels, taking up 4 bits.
+		spec >>= 4;
+		int window = spec;			   // 8 window sizes, taking up 3 bits.
+
+		filter_type <<= 3;				// 0b01 --> PNG_FILTER_NONE, etc.
+		if (filter_type < PNG_FILTER_NONE || filter_type > PNG_ALL_FILTERS)
+			filter_type = PNG_NO_FILTERS;
+
+		if (compression < Z_NO_COMPRESSION || compression > Z_BEST_COMPRESSION)
+			compression = Z_DEFAULT_COMPRESSION;
+
+		window += 8;
+		if (window < 8 || window > 15)
+			window = 15;
+
+		if (strategy < Z_DEFAULT_STRATEGY || strategy > Z_FIXED)
+			strategy = Z_DEFAULT_STRATEGY;
+
+		png_set_compression_level(png_ptr, compression);
+
+		png_set_filter(png_ptr, 0, filter_type);
+		*pcompval = compression;
+		*pfilters = filter_type;
+
+		/* Set other zlib parameters for compressing IDAT */
+		png_set_compression_mem_level(png_ptr, 8);
+		png_set_compression_strategy(png_ptr, strategy);
+		png_set_compression_window_bits(png_ptr, window);
+		//png_set_compression_method(png_ptr, Z_DEFLATED);
+		//png_set_compression_buffer_size(png_ptr, PNG_ZBUF_SIZE);
+
+			/* Set zlib parameters for text compression
+			 * If you don't call these, the parameters
+			 * fall back on those defined for IDAT chunks
+			 */
+		png_set_text_compression_mem_level(png_ptr, 8);
+		png_set_text_compression_strategy(png_ptr, strategy);
+		png_set_text_compression_window_bits(png_ptr, window);
+		//png_set_text_compression_method(png_ptr, Z_DEFLATED);
+	}
+}
+
+
+/*---------------------------------------------------------------------*
+ *            Compressing png image data on several threads            *
+ *---------------------------------------------------------------------*/
+/*!
+ * \brief   pngWriteImageParallel()
+ *
+ * \param[in]    png_ptr     after the header has been written
+ * \param[in]    pix
+ * \param[in]    compval     zlib compression level
+ * \param[in]    filters     mask of png row filters to choose from
+ * \param[in]    nthreads    max number of threads; 0 for all available
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This makes the png rows as in pixWriteStreamPng(), filters
+ *          them in parallel, and compresses the filtered data with
+ *          zlibCompressParallel().  The result is written in IDAT
+ *          chunks, followed by the IEND chunk.
+ *      (2) The png_ptr is not used for compression, so png_write_end()
+ *          is not called; the caller destroys the png_ptr.
+ * </pre>
+ */
+static l_int32
+pngWriteImageParallel(png_structp  png_ptr,
+                      PIX         *pix,
+                      l_int32      compval,
+                      l_int32      filters,
+                      l_int32      nthreads)
+{
+l_uint8    *rawbuf, *filtbuf, *datacomp, *zero;
+l_uint8   **rows;
+l_int32     i, j, k, w, h, d, spp, wpl, rowbytes, bpp;
+l_uint32   *data, *ppixel;
+size_t      nbytescomp, offset, nchunk;
+PIX        *pix1;
+PIXCMAP    *cmap;
+
+    pixGetDimensions(pix, &w, &h, &d);
+    spp = pixGetSpp(pix);
+    cmap = pixGetColormap(pix);
+    pix1 = NULL;
+    rawbuf = NULL;
+    if ((rows = (l_uint8 **)LEPT_CALLOC(h, sizeof(l_uint8 *))) == NULL)
+        return ERROR_INT("rows not made", __func__, 1);
+
+        /* Make the unfiltered rows, in png byte order */
+    if (d == 24) {  /* rgb bytes are in order in each row */
+        rowbytes = 3 * w;
+        bpp = 3;
+        data = pixGetData(pix);
+        wpl = pixGetWpl(pix);
+        for (i = 0; i < h; i++)
+            rows[i] = (l_uint8 *)(data + i * wpl);
+    } else if (d == 32) {
+        bpp = (spp == 4) ? 4 : 3;
+        rowbytes = bpp * w;
+        rawbuf = (l_uint8 *)LEPT_MALLOC((size_t)h * rowbytes);
+        data = pixGetData(pix);
+        wpl = pixGetWpl(pix);
+        if (rawbuf) {
+#ifdef _OPENMP
+#pragma omp parallel for private(j, k, ppixel) if (nthreads != 1)
+#endif  /* _OPENMP */
+            for (i = 0; i < h; i++) {
+                rows[i] = rawbuf + (size_t)i * rowbytes;
+                ppixel = data + i * wpl;
+                for (j = k = 0; j < w; j++) {
+                    rows[i][k++] = GET_DATA_BYTE(ppixel, COLOR_RED);
+                    rows[i][k++] = GET_DATA_BYTE(ppixel, COLOR_GREEN);
+                    rows[i][k++] = GET_DATA_BYTE(ppixel, COLOR_BLUE);
+                    if (spp == 4)
+                        rows[i][k++] = GET_DATA_BYTE(ppixel, L_ALPHA_CHANNEL);
+                    ppixel++;
+                }
+            }
+        }
+    } else {  /* as in pixWriteStreamPng(), invert 1 bpp without cmap */
+        rowbytes = (w * d + 7) / 8;
+        bpp = L_MAX(1, d / 8);
+        if (d == 1 && !cmap) {
+            pix1 = pixInvert(NULL, pix);
+            pixEndianByteSwap(pix1);
+        } else {
+            pix1 = pixEndianByteSwapNew(pix);
+        }
+        if (pix1) {
+            data = pixGetData(pix1);
+            wpl = pixGetWpl(pix1);
+            for (i = 0; i < h; i++)
+                rows[i] = (l_uint8 *)(data + i * wpl);
+        }
+    }
+    if ((d == 32 && !rawbuf) || (d < 24 && !pix1)) {
+        LEPT_FREE(rows);
+        LEPT_FREE(rawbuf);
+        pixDestroy(&pix1);
+        return ERROR_INT("rows not made", __func__, 1);
+    }
+
+        /* Filter the rows; each is preceded by its filter type */
+    filtbuf = (l_uint8 *)LEPT_MALLOC((size_t)h * (rowbytes + 1));
+    zero = (l_uint8 *)LEPT_CALLOC(rowbytes, 1);
+    if (filtbuf && zero) {
+#ifdef _OPENMP
+#pragma omp parallel for if (nthreads != 1)
+#endif  /* _OPENMP */
+        for (i = 0; i < h; i++) {
+            pngFilterRow(rows[i], (i > 0) ? rows[i - 1] : zero, rowbytes,
+                         bpp, filters,
+                         filtbuf + (size_t)i * (rowbytes + 1));
+        }
+    }
+    LEPT_FREE(rows);
+    LEPT_FREE(rawbuf);
+    LEPT_FREE(zero);
+    pixDestroy(&pix1);
+    if (!filtbuf)
+        return ERROR_INT("filtbuf not made", __func__, 1);
+
+        /* Compress and write the image data */
+    datacomp = zlibCompressParallel(filtbuf, (size_t)h * (rowbytes + 1),
+                                    compval, nthreads, &nbytescomp);
+    LEPT_FREE(filtbuf);
+    if (!datacomp)
+        return ERROR_INT("datacomp not made", __func__, 1);
+    for (offset = 0; offset < nbytescomp; offset += nchunk) {
+        nchunk = L_MIN(nbytescomp - offset, 1 << 20);
+        png_write_chunk(png_ptr, (png_const_bytep)"IDAT", datacomp + offset,
+                        nchunk);
+    }
+    png_write_chunk(png_ptr, (png_const_bytep)"IEND", NULL, 0);
+    LEPT_FREE(datacomp);
+    return 0;
+}
+
+
+/*!
+ * \brief   pngFilterRow()
+ *
+ * \param[in]    row         unfiltered row
+ * \param[in]    prev        unfiltered previous row; zeroes for the first
+ * \param[in]    rowbytes    bytes in each row
+ * \param[in]    bpp         bytes/pixel, rounded up to 1
+ * \param[in]    filters     mask of png row filters to choose from
+ * \param[out]   out         filter type followed by the filtered row
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) The bit for filter type t in %filters is (PNG_FILTER_NONE << t),
+ *          as in png_set_filter().  With a single filter, it is used
+ *          for every row.  Otherwise this uses the heuristic in libpng:
+ *          of the allowed filters, the one that gives the smallest sum
+ *          of the filtered bytes, taken as signed values, is chosen.
+ * </pre>
+ */
+static void
+pngFilterRow(const l_uint8  *row,
+             const l_uint8  *prev,
+             l_int32         rowbytes,
+             l_int32         bpp,
+             l_int32         filters,
+             l_uint8        *out)
+{
+l_int32   i, f, a, b, c, p, pa, pb, pc, pred, best, nfilters;
+l_uint8   v;
+l_uint32  sum[5];
+
+    best = 0;
+    for (f = 0, nfilters = 0; f < 5; f++) {
+        if (filters & (PNG_FILTER_NONE << f)) {
+            if (nfilters == 0) best = f;
+            nfilters++;
+        }
+    }
+    if (nfilters > 1) {
+        sum[0] = sum[1] = sum[2] = sum[3] = sum[4] = 0;
+        for (i = 0; i < rowbytes; i++) {
+            a = (i >= bpp) ? row[i - bpp] : 0;
+            b = prev[i];
+            c = (i >= bpp) ? prev[i - bpp] : 0;
+            p = a + b - c;
+            pa = L_ABS(p - a);
+            pb = L_ABS(p - b);
+            pc = L_ABS(p - c);
+            pred = (pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c;
+            v = row[i];
+            sum[0] += (v < 128) ? v : 256 - v;
+            v = row[i] - a;
+            sum[1] += (v < 128) ? v : 256 - v;
+            v = row[i] - b;
+            sum[2] += (v < 128) ? v : 256 - v;
+            v = row[i] - ((a + b) >> 1);
+            sum[3] += (v < 128) ? v : 256 - v;
+            v = row[i] - pred;
+            sum[4] += (v < 128) ? v : 256 - v;
+        }
+        for (f = best + 1; f < 5; f++) {
+            if ((filters & (PNG_FILTER_NONE << f)) && sum[f] < sum[best])
+                best = f;
+        }
+    }
+
+    out[0] = best;
+    out++;
+    for (i = 0; i < rowbytes; i++) {
+        a = (i >= bpp) ? row[i - bpp] : 0;
+        b = prev[i];
+        switch (best) {
+        case 0:
+            out[i] = row[i];
+            break;
+        case 1:
+            out[i] = row[i] - a;
+            break;
+        case 2:
+            out[i] = row[i] - b;
+            break;
+        case 3:
+            out[i] = row[i] - ((a + b) >> 1);
+            break;
+        default:
+            c = (i >= bpp) ? prev[i - bpp] : 0;
+            p = a + b - c;
+            pa = L_ABS(p - a);
+            pb = L_ABS(p - b);
+            pc = L_ABS(p - c);
+            pred = (pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c;
+            out[i] = row[i] - pred;
+            break;
+        }
+    }
+}
+
+
 /*---------------------------------------------------------------------*
  *              Set flag for stripping 16 bits on reading              *
  *---------------------------------------------------------------------*/
@@ -1434,6 +1800,56 @@ l_pngSetReadStrip16To8(l_int32  flag)
 }
 
 
+/*---------------------------------------------------------------------*
+ *                      Set preset for writing png                     *
+ *---------------------------------------------------------------------*/
+/*!
+ * \brief   l_pngSetWritePreset()
+ *
+ * \param[in]    preset     L_PNG_WRITE_DEFAULT, L_PNG_WRITE_FASTEST,
+ *                          L_PNG_WRITE_BALANCED, L_PNG_WRITE_SMALLEST
+ * \return       prev       previous preset
+ *
+ * <pre>
+ * Notes:
+ *      (1) The preset chooses the zlib level and the row filters used
+ *          for writing png, depending on the image type.  See the notes
+ *          at the top of this file.
+ *      (2) It returns the previous value, so for example:
+ *           l_int32  prev = l_pngSetWritePreset(L_PNG_WRITE_FASTEST);
+ *           pixWrite(...);
+ *           l_pngSetWritePreset(prev);   // resets to previous value
+ *      (3) On error, logs a message and does not change the variable.
+ *          Results can be non-deterministic if it is changed while
+ *          other threads are writing.
+ * </pre>
+ */
+l_int32
+l_pngSetWritePreset(l_int32  preset)
+{
+l_int32  prev;
+
+    prev = var_PNG_WRITE_PRESET;
+    if (preset < L_PNG_WRITE_DEFAULT || preset > L_PNG_WRITE_SMALLEST)
+        L_ERROR("invalid preset; unchanged\n", __func__);
+    else
+        var_PNG_WRITE_PRESET = preset;
+    return prev;
+}
+
+
+/*!
+ * \brief   l_pngGetWritePreset()
+ *
+ * \return  current preset for writing png
+ */
+l_int32
+l_pngGetWritePreset(void)
+{
+    return var_PNG_WRITE_PRESET;
+}
+
+
 /*-------------------------------------------------------------------------*
  *                               Memio utility                             *
  *    libpng read/write callback replacements for performing memory I/O    *
@@ -2067,6 +2483,8 @@ pixWriteMemPng(l_uint8  **pfiledata,
 {
 char         commentstring[] = "Comment";
 l_int32      i, j, k, wpl, d, spp, cmflag, opaque, ncolors, compval, valid;
+l_int32      filters;
+l_int32      nthreads, ret;
 l_int32     *rmap, *gmap, *bmap, *amap;
 l_uint32    *data, *ppixel;
 png_byte     bit_depth, color_type;
@@ -2157,87 +2575,7 @@ MEMIODATA    state;
     png_set_write_fn(png_ptr, &state, memio_png_write_data,
                      (png_flush_ptr)NULL);
 
-        /* With best zlib compression (9), get between 1 and 10% improvement
-         * over default (6), but the compression is 3 to 10 times slower.
-         * Use the zlib default (6) as our default compression unless
-         * pix->special falls in the range [10 ... 19]; then subtract 10
-         * to get the compression value.  */
-    compval = Z_DEFAULT_COMPRESSION;
-    if (pix->special >= 10 && pix->special < 20)
-        compval = pix->special - 10;
-    png_set_compression_level(png_ptr, compval);
-
-		/*
-		* When pix->special is 100 or larger, it encodes several PNG tweakable
-		* settings, which may be used to produce tighter PNGs or to produce
-		* them faster (lower CPU effort/cost).
-		*
-		* When pix->special is in the range 80..99, one of 20 presets is used
-		* instead.
-		*/
-	if (pix->special >= 80) {
-		/*
-		 * Definition of methods:
-		 *
-		 * - PNG defines 4 filters, which may be combined, plus 'none':
-		 *   PNG_FILTER_NONE or { PNG_FILTER_SUB, PNG_FILTER_UP, PNG_FILTER_AVG, PNG_FILTER_PAETH }
-		 *
-		 * - 9 compression levels 1..9 + 0 = no compression, which makes 10 levels.
-		 *
-		 * - 4 strategies, where only Z_FILTERED will apply the filters, AFAICT.
-		 *
-		 * - RLE compression window 8..15, which is unused when the strategy is Z_HUFFMAN_ONLY.
-		 *   Meanwhile RLE compression is more or less independent of the compression level 1..9:
-		 *   pngcrush says 1..3 are the same and so are 4..9.
-		 *
-		 */
-		unsigned int spec = pix->special - 100;
-		if (pix->special < 100) {
-			// 80..99 are preset indices:
-			spec = pngBespokeSpecials[pix->special - 80];
-		}
-		int filter_type = spec & 0x1F;
-		spec >>= 5;
-		int strategy = spec & 0x07;   // 4 strategies + 0 = 'default' makes 5, taking up 3 bits.
-		spec >>= 3;
-		int compression = spec & 0x0F;   // 10 compression levels, taking up 4 bits.
-		spec >>= 4;
-		int window = spec;			   // 8 window sizes, taking up 3 bits.
-
-		filter_type <<= 3;				// 0b01 --> PNG_FILTER_NONE, etc.
-		if (filter_type < PNG_FILTER_NONE || filter_type > PNG_ALL_FILTERS)
-			filter_type = PNG_NO_FILTERS;
-
-		if (compression < Z_NO_COMPRESSION || compression > Z_BEST_COMPRESSION)
-			compression = Z_DEFAULT_COMPRESSION;
-
-		window += 8;
-		if (window < 8 || window > 15)
-			window = 15;
-
-		if (strategy < Z_DEFAULT_STRATEGY || strategy > Z_FIXED)
-			strategy = Z_DEFAULT_STRATEGY;
-
-		png_set_compression_level(png_ptr, compression);
-
-		png_set_filter(png_ptr, 0, filter_type);
-
-		/* Set other zlib parameters for compressing IDAT */
-		png_set_compression_mem_level(png_ptr, 8);
-		png_set_compression_strategy(png_ptr, strategy);
-		png_set_compression_window_bits(png_ptr, window);
-		//png_set_compression_method(png_ptr, Z_DEFLATED);
-		//png_set_compression_buffer_size(png_ptr, PNG_ZBUF_SIZE);
-
-			/* Set zlib parameters for text compression
-			 * If you don't call these, the parameters
-			 * fall back on those defined for IDAT chunks
-			 */
-		png_set_text_compression_mem_level(png_ptr, 8);
-		png_set_text_compression_strategy(png_ptr, strategy);
-		png_set_text_compression_window_bits(png_ptr, window);
-		//png_set_text_compression_method(png_ptr, Z_DEFLATED);
-	}
+    pngSetWriteParams(png_ptr, pix, d, cmflag, &compval, &filters);
 
     png_set_IHDR(png_ptr, info_ptr, w, h, bit_depth, color_type,
                  PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_BASE,
@@ -2298,6 +2636,23 @@ MEMIODATA    state;
         /* Write header and palette info */
     png_write_info(png_ptr, info_ptr);
 
+        /* Optionally, compress the image data on several threads */
+    nthreads = l_zlibGetThreads();
+    if (nthreads != 1 && pix->special < 80 &&
+        (size_t)w * h * d / 8 >= MinParallelPngBytes) {
+        ret = pngWriteImageParallel(png_ptr, pix, compval, filters,
+                                    nthreads);
+        png_destroy_write_struct(&png_ptr, &info_ptr);
+        memio_png_flush(&state);
+        if (ret == 0) {
+            *pfiledata = (l_uint8 *)state.m_Buffer;
+            state.m_Buffer = 0;
+            *pfilesize = state.m_Count;
+        }
+        memio_free(&state);
+        return ret;
+    }
+
     if ((d != 32) && (d != 24)) {  /* not rgb color */
             /* Generate a temporary pix with bytes swapped.
              * For writing a 1 bpp image as png:
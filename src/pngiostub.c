@@ -125,6 +125,20 @@ void l_pngSetReadStrip16To8(l_int32 flag)
 
 /* ----------------------------------------------------------------------*/
 
+l_int32 l_pngSetWritePreset(l_int32 preset)
+{
+    return ERROR_INT("function not present", __func__, 0);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_int32 l_pngGetWritePreset(void)
+{
+    return ERROR_INT("function not present", __func__, 0);
+}
+
+/* ----------------------------------------------------------------------*/
+
 PIX * pixReadMemPng(const l_uint8 *filedata, size_t filesize)
 {
     return (PIX * )ERROR_PTR("function not present", __func__, NULL);
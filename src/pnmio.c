@@ -42,8 +42,12 @@
  *          l_int32          pixWriteMemPnm()
  *          l_int32          pixWriteMemPam()
  *
+ *      Read from a file mapping
+ *          PIX             *pixReadPnmMapped()
+ *
  *      Static helpers
  *          static Pix      *freadDataPnm()
+ *          static void      pnmConvertRow()
  *          static l_int32   pnmReadNextAsciiValue();
  *          static l_int32   pnmReadNextNumber();
  *          static l_int32   pnmReadNextString();
@@ -123,6 +127,9 @@
 #include <string.h>
 #include <ctype.h>
 #include "allheaders.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif  /* _OPENMP */
 
 /* --------------------------------------------*/
 #if  USE_PNMIO   /* defined in environ.h */
@@ -134,11 +141,16 @@ static l_int32 pnmReadNextAsciiValue(FILE  *fp, l_int32 *pval);
 static l_int32 pnmReadNextNumber(FILE *fp, l_int32 *pval);
 static l_int32 pnmReadNextString(FILE *fp, char *buff, l_int32 size);
 static l_int32 pnmSkipCommentLines(FILE  *fp);
+static void pnmConvertRow(const l_uint8 *src, l_uint32 *line, l_int32 w,
+                          l_int32 d, l_int32 type, l_int32 bps, l_int32 spp);
 
     /* a sanity check on the size read from file */
 static const l_int32  MAX_PNM_WIDTH = 100000;
 static const l_int32  MAX_PNM_HEIGHT = 100000;
 
+    /* number of rows converted together in pixReadPnmMapped() */
+static const l_int32  PNM_BAND_HEIGHT = 64;
+
 
 /*--------------------------------------------------------------------*
  *                          Stream interface                          *
@@ -981,6 +993,123 @@ FILE    *fp;
 }
 
 
+/*--------------------------------------------------------------------*
+ *                      Read from a file mapping                      *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   pixReadPnmMapped()
+ *
+ * \param[in]    filename
+ * \param[in]    nthreads   max number of threads; 0 for all available
+ * \return  pix, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This gives the same pix as pixRead(), but for the raw formats
+ *          (P4, P5, P6 and P7) it maps the file into memory and converts
+ *          the rows directly from the mapping, in bands of rows that are
+ *          done in parallel.  pixReadStreamPnm() instead reads the file
+ *          a sample at a time, which is slow for large images.
+ *      (2) The ascii formats (P1, P2 and P3) and rgb with 16 bits/sample
+ *          are read from the stream, as in pixReadStreamPnm().
+ *      (3) The file samples are bytes in rgb order, which never matches
+ *          the 32-bit words of the pix, so the data is always converted.
+ *          For a pix that uses the file data in place, see
+ *          pixReadSpixMapped().
+ * </pre>
+ */
+PIX *
+pixReadPnmMapped(const char  *filename,
+                 l_int32      nthreads)
+{
+l_uint8   *mapdata;
+l_int32    w, h, d, type, bps, spp, wpl, i, k, nbands, iend;
+size_t     nbytes, offset, srcbpl;
+l_uint32  *data;
+FILE      *fp;
+PIX       *pix;
+
+    if (!filename)
+        return (PIX *)ERROR_PTR("filename not defined", __func__, NULL);
+    if (nthreads < 0)
+        return (PIX *)ERROR_PTR("invalid nthreads", __func__, NULL);
+
+#ifdef _OPENMP
+    if (nthreads == 0)
+        nthreads = omp_get_max_threads();
+#else
+    nthreads = 1;
+#endif  /* _OPENMP */
+
+        /* Read the header to find where the image data starts */
+    if ((fp = fopenReadStream(filename)) == NULL)
+        return (PIX *)ERROR_PTR_1("image file not found",
+                                  filename, __func__, NULL);
+    if (freadHeaderPnm(fp, &w, &h, &d, &type, &bps, &spp)) {
+        fclose(fp);
+        return (PIX *)ERROR_PTR_1("header read failed",
+                                  filename, __func__, NULL);
+    }
+    if (bps < 1 || bps > 16 || spp < 1 || spp > 4) {
+        fclose(fp);
+        return (PIX *)ERROR_PTR("invalid bps or spp", __func__, NULL);
+    }
+    if (type < 4 || (type >= 6 && bps == 16)) {  /* read from the stream */
+        pix = freadDataPnm(fp, w, h, d, type, bps, spp, FALSE);
+        fclose(fp);
+        if (!pix)
+            return (PIX *)ERROR_PTR_1("read data fails",
+                                      filename, __func__, NULL);
+        return pix;
+    }
+    offset = ftell(fp);
+    fclose(fp);
+
+        /* Bytes in each row of the file */
+    if (type == 4)
+        srcbpl = (w + 7) / 8;
+    else if (type == 5)
+        srcbpl = (d == 16) ? 2 * w : w;
+    else if (type == 6)
+        srcbpl = 3 * w;
+    else  /* type == 7 */
+        srcbpl = spp * w;
+
+    if ((mapdata = l_binaryMap(filename, &nbytes)) == NULL)
+        return (PIX *)ERROR_PTR_1("file not mapped", filename, __func__, NULL);
+    if (offset + srcbpl * h > nbytes) {
+        l_binaryUnmap(&mapdata, nbytes);
+        return (PIX *)ERROR_PTR_1("image data is truncated",
+                                  filename, __func__, NULL);
+    }
+    if ((pix = pixCreate(w, h, d)) == NULL) {
+        l_binaryUnmap(&mapdata, nbytes);
+        return (PIX *)ERROR_PTR("pix not made", __func__, NULL);
+    }
+    pixSetInputFormat(pix, IFF_PNM);
+    if (type == 7 && (spp == 2 || spp == 4))
+        pixSetSpp(pix, 4);
+    data = pixGetData(pix);
+    wpl = pixGetWpl(pix);
+
+        /* Each band of rows is converted independently */
+    nbands = (h + PNM_BAND_HEIGHT - 1) / PNM_BAND_HEIGHT;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+        private(i, iend) if (nthreads > 1)
+#endif  /* _OPENMP */
+    for (k = 0; k < nbands; k++) {
+        iend = L_MIN(h, (k + 1) * PNM_BAND_HEIGHT);
+        for (i = k * PNM_BAND_HEIGHT; i < iend; i++)
+            pnmConvertRow(mapdata + offset + i * srcbpl, data + i * wpl,
+                          w, d, type, bps, spp);
+    }
+
+    l_binaryUnmap(&mapdata, nbytes);
+    return pix;
+}
+
+
 /*--------------------------------------------------------------------*
  *                          Static helpers                            *
  *--------------------------------------------------------------------*/
@@ -1368,6 +1497,95 @@ PIX       *pix;
 }
 
 
+/*!
+ * \brief   pnmConvertRow()
+ *
+ * \param[in]    src     start of the row in the raw pnm data
+ * \param[in]    line    start of the row in the pix
+ * \param[in]    w, d    of the pix
+ * \param[in]    type    pnm type: 4, 5, 6 or 7
+ * \param[in]    bps     bits/sample; 16 only for type 5
+ * \param[in]    spp     samples/pixel
+ * \return  void
+ *
+ * <pre>
+ * Notes:
+ *      (1) This converts one row in the same way as freadDataPnm().
+ *          The pix must be initialized to 0.
+ * </pre>
+ */
+static void
+pnmConvertRow(const l_uint8  *src,
+              l_uint32       *line,
+              l_int32         w,
+              l_int32         d,
+              l_int32         type,
+              l_int32         bps,
+              l_int32         spp)
+{
+l_uint8   val8, aval8, mask8;
+l_uint16  val16;
+l_int32   j, bpl;
+
+    switch (type) {
+    case 4:  /* 1 bpp */
+        bpl = (w + 7) / 8;
+        for (j = 0; j < bpl; j++)
+            SET_DATA_BYTE(line, j, src[j]);
+        break;
+
+    case 5:  /* grayscale */
+        for (j = 0; j < w; j++) {
+            if (d == 2) {
+                SET_DATA_DIBIT(line, j, src[j]);
+            } else if (d == 4) {
+                SET_DATA_QBIT(line, j, src[j]);
+            } else if (d == 8) {
+                SET_DATA_BYTE(line, j, src[j]);
+            } else {  /* d == 16; same byte order as the fread() */
+                memcpy(&val16, src + 2 * j, 2);
+                SET_DATA_TWO_BYTES(line, j, val16);
+            }
+        }
+        break;
+
+    case 6:  /* 8 bps rgb */
+        for (j = 0; j < w; j++, src += 3)
+            composeRGBPixel(src[0], src[1], src[2], line + j);
+        break;
+
+    case 7:  /* bps <= 8 */
+        mask8 = (1 << bps) - 1;
+        for (j = 0; j < w; j++, src += spp) {
+            if (spp == 1) {
+                val8 = src[0] & mask8;
+                if (bps == 1) {
+                    val8 ^= 1;  /* white-is-1 photometry */
+                    SET_DATA_BIT_VAL(line, j, val8);
+                } else if (bps == 2) {
+                    SET_DATA_DIBIT(line, j, val8);
+                } else if (bps == 4) {
+                    SET_DATA_QBIT(line, j, val8);
+                } else {
+                    SET_DATA_BYTE(line, j, val8);
+                }
+            } else if (spp == 2) {
+                val8 = src[0] & mask8;
+                aval8 = src[1] & mask8;
+                composeRGBAPixel(val8, val8, val8, aval8, line + j);
+            } else if (spp == 3) {
+                composeRGBPixel(src[0] & mask8, src[1] & mask8,
+                                src[2] & mask8, line + j);
+            } else {  /* spp == 4 */
+                composeRGBAPixel(src[0] & mask8, src[1] & mask8,
+                                 src[2] & mask8, src[3] & mask8, line + j);
+            }
+        }
+        break;
+    }
+}
+
+
 /*!
  * \brief   pnmReadNextAsciiValue()
  *
@@ -114,6 +114,14 @@ l_ok pixWriteMemPam(l_uint8 **pdata, size_t *psize, PIX *pix)
     return ERROR_INT("function not present", __func__, 1);
 }
 
+/* ----------------------------------------------------------------------*/
+
+PIX * pixReadPnmMapped(const char *filename, l_int32 nthreads)
+{
+    return (PIX * )ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
 
 /* --------------------------------------------*/
 #endif  /* !USE_PNMIO */
@@ -32,6 +32,10 @@
  *          l_int32   pixQuadtreeMean()
  *          l_int32   pixQuadtreeVariance()
  *
+ *      Quadtree linear statistics from integral image
+ *          l_int32   integralQuadtreeMean()
+ *          l_int32   integralQuadtreeVariance()
+ *
  *      Statistics in an arbitrary rectangle
  *          l_int32   pixMeanInRectangle()
  *          l_int32   pixVarianceInRectangle()
@@ -90,6 +94,11 @@
  *      (1) The returned fpixa has %nlevels of fpix, each containing
  *          the mean values at its level.  Level 0 has a
  *          single value; level 1 has 4 values; level 2 has 16; etc.
+ *      (2) If %pix_ma is null, this makes an integral image and calls
+ *          integralQuadtreeMean().  The integral image takes 4 bytes
+ *          per pixel.  Like a %pix_ma made by pixBlockconvAccum(), it
+ *          has 32-bit sums, which overflow for regions of more than
+ *          about 16M pixels.
  * </pre>
  */
 l_ok
@@ -98,13 +107,14 @@ pixQuadtreeMean(PIX     *pixs,
                 PIX     *pix_ma,
                 FPIXA  **pfpixa)
 {
-l_int32    i, j, w, h, size, n;
-l_float32  val;
-BOX       *box;
-BOXA      *boxa;
-BOXAA     *baa;
-FPIX      *fpix;
-PIX       *pix_mac;
+l_int32      i, j, w, h, size, n, ret;
+l_float32    val;
+BOX         *box;
+BOXA        *boxa;
+BOXAA       *baa;
+FPIX        *fpix;
+L_INTEGRAL  *ii;
+PIX         *pix_mac;
 
     if (!pfpixa)
         return ERROR_INT("&fpixa not defined", __func__, 1);
@@ -115,11 +125,15 @@ PIX       *pix_mac;
     if (nlevels > quadtreeMaxLevels(w, h))
         return ERROR_INT("nlevels too large for image", __func__, 1);
 
-    if (!pix_ma)
-        pix_mac = pixBlockconvAccum(pixs);
-    else
-        pix_mac = pixClone(pix_ma);
-    if (!pix_mac)
+    if (!pix_ma) {
+        if ((ii = integralCreate(pixs, 0)) == NULL)
+            return ERROR_INT("ii not made", __func__, 1);
+        ret = integralQuadtreeMean(ii, nlevels, pfpixa);
+        integralDestroy(&ii);
+        return ret;
+    }
+
+    if ((pix_mac = pixClone(pix_ma)) == NULL)
         return ERROR_INT("pix_mac not made", __func__, 1);
 
     if ((baa = boxaaQuadtreeRegions(w, h, nlevels)) == NULL) {
@@ -165,6 +179,10 @@ PIX       *pix_mac;
  *      (1) The returned fpixav and fpixarv have %nlevels of fpix,
  *          each containing at the respective levels the variance
  *          and root variance values.
+ *      (2) If %pix_ma and %dpix_msa are both null, this makes an
+ *          integral image and calls integralQuadtreeVariance().  The
+ *          integral image takes 12 bytes per pixel.  Its 32-bit sums
+ *          overflow for regions of more than about 16M pixels.
  * </pre>
  */
 l_ok
@@ -175,14 +193,15 @@ pixQuadtreeVariance(PIX     *pixs,
                     FPIXA  **pfpixa_v,
                     FPIXA  **pfpixa_rv)
 {
-l_int32    i, j, w, h, size, n;
-l_float32  var, rvar;
-BOX       *box;
-BOXA      *boxa;
-BOXAA     *baa;
-FPIX      *fpixv = NULL, *fpixrv = NULL;
-PIX       *pix_mac;  /* copy of mean accumulator */
-DPIX      *dpix_msac;  /* msa clone */
+l_int32      i, j, w, h, size, n, ret;
+l_float32    var, rvar;
+BOX         *box;
+BOXA        *boxa;
+BOXAA       *baa;
+FPIX        *fpixv = NULL, *fpixrv = NULL;
+L_INTEGRAL  *ii;
+PIX         *pix_mac;  /* copy of mean accumulator */
+DPIX        *dpix_msac;  /* msa clone */
 
     if (!pfpixa_v && !pfpixa_rv)
         return ERROR_INT("neither &fpixav nor &fpixarv defined", __func__, 1);
@@ -194,6 +213,14 @@ DPIX      *dpix_msac;  /* msa clone */
     if (nlevels > quadtreeMaxLevels(w, h))
         return ERROR_INT("nlevels too large for image", __func__, 1);
 
+    if (!pix_ma && !dpix_msa) {
+        if ((ii = integralCreate(pixs, 1)) == NULL)
+            return ERROR_INT("ii not made", __func__, 1);
+        ret = integralQuadtreeVariance(ii, nlevels, pfpixa_v, pfpixa_rv);
+        integralDestroy(&ii);
+        return ret;
+    }
+
     if (!pix_ma)
         pix_mac = pixBlockconvAccum(pixs);
     else
@@ -250,6 +277,141 @@ DPIX      *dpix_msac;  /* msa clone */
 }
 
 
+/*----------------------------------------------------------------------*
+ *          Quadtree linear statistics from integral image              *
+ *----------------------------------------------------------------------*/
+/*!
+ * \brief   integralQuadtreeMean()
+ *
+ * \param[in]    ii       integral image of an 8 bpp pix
+ * \param[in]    nlevels  in quadtree; max allowed depends on image size
+ * \param[out]   pfpixa   mean values in quadtree
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This gives the same result as pixQuadtreeMean(), using an
+ *          integral image that can be shared with other operations
+ *          on the same image.
+ * </pre>
+ */
+l_ok
+integralQuadtreeMean(L_INTEGRAL  *ii,
+                     l_int32      nlevels,
+                     FPIXA      **pfpixa)
+{
+l_int32    i, j, w, h, d, size, n;
+l_float32  val;
+BOX       *box;
+BOXA      *boxa;
+BOXAA     *baa;
+FPIX      *fpix;
+
+    if (!pfpixa)
+        return ERROR_INT("&fpixa not defined", __func__, 1);
+    *pfpixa = NULL;
+    if (!ii)
+        return ERROR_INT("ii not defined", __func__, 1);
+    integralGetDimensions(ii, &w, &h, &d, NULL);
+    if (d != 8)
+        return ERROR_INT("ii not made from 8 bpp pix", __func__, 1);
+    if (nlevels > quadtreeMaxLevels(w, h))
+        return ERROR_INT("nlevels too large for image", __func__, 1);
+
+    if ((baa = boxaaQuadtreeRegions(w, h, nlevels)) == NULL)
+        return ERROR_INT("baa not made", __func__, 1);
+
+    *pfpixa = fpixaCreate(nlevels);
+    for (i = 0; i < nlevels; i++) {
+        boxa = boxaaGetBoxa(baa, i, L_CLONE);
+        size = 1 << i;
+        n = boxaGetCount(boxa);  /* n == size * size */
+        fpix = fpixCreate(size, size);
+        for (j = 0; j < n; j++) {
+            box = boxaGetBox(boxa, j, L_CLONE);
+            integralMeanInRectangle(ii, box, &val);
+            fpixSetPixel(fpix, j % size, j / size, val);
+            boxDestroy(&box);
+        }
+        fpixaAddFPix(*pfpixa, fpix, L_INSERT);
+        boxaDestroy(&boxa);
+    }
+
+    boxaaDestroy(&baa);
+    return 0;
+}
+
+
+/*!
+ * \brief   integralQuadtreeVariance()
+ *
+ * \param[in]    ii          integral image of an 8 bpp pix, with squares
+ * \param[in]    nlevels     in quadtree
+ * \param[out]   pfpixa_v    [optional] variance values in quadtree
+ * \param[out]   pfpixa_rv   [optional] root variance values in quadtree
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This gives the same result as pixQuadtreeVariance().
+ *          %ii must be made with %sqflag = 1.
+ * </pre>
+ */
+l_ok
+integralQuadtreeVariance(L_INTEGRAL  *ii,
+                         l_int32      nlevels,
+                         FPIXA      **pfpixa_v,
+                         FPIXA      **pfpixa_rv)
+{
+l_int32    i, j, w, h, d, size, n, hassq;
+l_float32  var, rvar;
+BOX       *box;
+BOXA      *boxa;
+BOXAA     *baa;
+FPIX      *fpixv = NULL, *fpixrv = NULL;
+
+    if (!pfpixa_v && !pfpixa_rv)
+        return ERROR_INT("neither &fpixav nor &fpixarv defined", __func__, 1);
+    if (pfpixa_v) *pfpixa_v = NULL;
+    if (pfpixa_rv) *pfpixa_rv = NULL;
+    if (!ii)
+        return ERROR_INT("ii not defined", __func__, 1);
+    integralGetDimensions(ii, &w, &h, &d, &hassq);
+    if (d != 8)
+        return ERROR_INT("ii not made from 8 bpp pix", __func__, 1);
+    if (!hassq)
+        return ERROR_INT("ii has no sums of squares", __func__, 1);
+    if (nlevels > quadtreeMaxLevels(w, h))
+        return ERROR_INT("nlevels too large for image", __func__, 1);
+
+    if ((baa = boxaaQuadtreeRegions(w, h, nlevels)) == NULL)
+        return ERROR_INT("baa not made", __func__, 1);
+
+    if (pfpixa_v) *pfpixa_v = fpixaCreate(nlevels);
+    if (pfpixa_rv) *pfpixa_rv = fpixaCreate(nlevels);
+    for (i = 0; i < nlevels; i++) {
+        boxa = boxaaGetBoxa(baa, i, L_CLONE);
+        size = 1 << i;
+        n = boxaGetCount(boxa);  /* n == size * size */
+        if (pfpixa_v) fpixv = fpixCreate(size, size);
+        if (pfpixa_rv) fpixrv = fpixCreate(size, size);
+        for (j = 0; j < n; j++) {
+            box = boxaGetBox(boxa, j, L_CLONE);
+            integralVarianceInRectangle(ii, box, &var, &rvar);
+            if (pfpixa_v) fpixSetPixel(fpixv, j % size, j / size, var);
+            if (pfpixa_rv) fpixSetPixel(fpixrv, j % size, j / size, rvar);
+            boxDestroy(&box);
+        }
+        if (pfpixa_v) fpixaAddFPix(*pfpixa_v, fpixv, L_INSERT);
+        if (pfpixa_rv) fpixaAddFPix(*pfpixa_rv, fpixrv, L_INSERT);
+        boxaDestroy(&boxa);
+    }
+
+    boxaaDestroy(&baa);
+    return 0;
+}
+
+
 /*----------------------------------------------------------------------*
  *                  Statistics in an arbitrary rectangle                *
  *----------------------------------------------------------------------*/
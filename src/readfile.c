@@ -35,6 +35,7 @@
  *           PIX       *pixReadWithHint()
  *           PIX       *pixReadIndexed()
  *           PIX       *pixReadStream()
+ *           PIX       *pixReadMapped()
  *
  *      Read header information from file
  *           l_int32    pixReadHeader()
@@ -409,6 +410,55 @@ PIXCMAP  *cmap;
 
 
 
+/*!
+ * \brief   pixReadMapped()
+ *
+ * \param[in]    filename    with full pathname or in local directory
+ * \param[in]    nthreads    max number of threads for conversion;
+ *                           0 for all available
+ * \return  pix if OK; NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This reads the uncompressed formats by mapping the file into
+ *          memory instead of reading it through a stream:
+ *            spix: the pix data is in the mapping and is not copied;
+ *                  see pixReadSpixMapped().
+ *            pnm:  the rows are converted from the mapping in parallel
+ *                  bands; see pixReadPnmMapped().
+ *            bmp:  the same for uncompressed rgb and rgba; other bmp
+ *                  are decoded from the mapping; see pixReadBmpMapped().
+ *          Other formats are read with pixRead().
+ *      (2) This is useful for large intermediate images that are
+ *          written and read back on a local disk.
+ * </pre>
+ */
+PIX *
+pixReadMapped(const char  *filename,
+              l_int32      nthreads)
+{
+l_int32  format;
+PIX     *pix;
+
+    if (!filename)
+        return (PIX *)ERROR_PTR("filename not defined", __func__, NULL);
+
+    if (findFileFormat(filename, &format))
+        return (PIX *)ERROR_PTR_1("format not found", filename, __func__, NULL);
+    if (format == IFF_SPIX)
+        pix = pixReadSpixMapped(filename);
+    else if (format == IFF_PNM)
+        pix = pixReadPnmMapped(filename, nthreads);
+    else if (format == IFF_BMP)
+        pix = pixReadBmpMapped(filename, nthreads);
+    else
+        pix = pixRead(filename);
+    if (!pix)
+        return (PIX *)ERROR_PTR_1("pix not read", filename, __func__, NULL);
+    return pix;
+}
+
+
 /*---------------------------------------------------------------------*
  *                     Read header information from file               *
  *---------------------------------------------------------------------*/
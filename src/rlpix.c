@@ -0,0 +1,1282 @@
+/*====================================================================*
+ -  Copyright (C) 2001 Leptonica.  All rights reserved.
+ -
+ -  Redistribution and use in source and binary forms, with or without
+ -  modification, are permitted provided that the following conditions
+ -  are met:
+ -  1. Redistributions of source code must retain the above copyright
+ -     notice, this list of conditions and the following disclaimer.
+ -  2. Redistributions in binary form must reproduce the above
+ -     copyright notice, this list of conditions and the following
+ -     disclaimer in the documentation and/or other materials
+ -     provided with the distribution.
+ -
+ -  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ -  ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ -  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ -  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL ANY
+ -  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ -  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ -  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ -  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ -  OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ -  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ -  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *====================================================================*/
+
+/*!
+ * \file rlpix.c
+ * <pre>
+ *
+ *      Create/Destroy/Copy
+ *          RLPIX        *rlpixCreate()
+ *          void          rlpixDestroy()
+ *          RLPIX        *rlpixCopy()
+ *
+ *      Accessors
+ *          l_ok          rlpixGetDimensions()
+ *          l_int32       rlpixGetRunCount()
+ *          l_ok          rlpixGetLineRuns()
+ *
+ *      Conversion to and from pix
+ *          RLPIX        *pixConvertToRLPix()
+ *          PIX          *rlpixConvertToPix()
+ *
+ *      Pixel counting
+ *          l_ok          rlpixCountPixels()
+ *
+ *      Set operations
+ *          RLPIX        *rlpixUnion()
+ *          RLPIX        *rlpixIntersection()
+ *          RLPIX        *rlpixSubtract()
+ *
+ *      Morphology with brick Sels
+ *          RLPIX        *rlpixDilateBrick()
+ *          RLPIX        *rlpixErodeBrick()
+ *          RLPIX        *rlpixOpenBrick()
+ *          RLPIX        *rlpixCloseBrick()
+ *
+ *      Connected components
+ *          BOXA         *rlpixConnCompBB()
+ *          l_ok          rlpixCountConnComp()
+ *
+ *      Static helpers
+ *          static l_int32  rlpixAddRun()
+ *          static void     rlpixEndLine()
+ *          static void     rlpixLineOp()
+ *          static RLPIX   *rlpixHorizontalBrick()
+ *          static RLPIX   *rlpixVerticalBrick()
+ *          static RLPIX   *rlpixCombineShifted()
+ *          static l_int32  rlpixConnCompRoots()
+ *
+ *  A 1 bpp image of text on a white page is mostly 0 words, and the
+ *  packed-bit operations spend most of their time on them.  The RLPIX
+ *  holds only the runs of fg pixels on each line, so the cost of
+ *  an operation goes with the number of runs rather than the area.
+ *  All the functions here give results identical to the corresponding
+ *  pix functions:
+ *          rlpixUnion()              pixOr()
+ *          rlpixIntersection()       pixAnd()
+ *          rlpixSubtract()           pixSubtract()
+ *          rlpixDilateBrick()        pixDilateBrick()
+ *          rlpixErodeBrick()         pixErodeBrick()
+ *          rlpixOpenBrick()          pixOpenBrick()
+ *          rlpixCloseBrick()         pixCloseBrick()
+ *          rlpixConnCompBB()         pixConnCompBB()
+ *          rlpixCountConnComp()      pixCountConnComp()
+ *          rlpixCountPixels()        pixCountPixels()
+ *  Erosion follows the current boundary condition, MORPH_BC.
+ *
+ *  For example, text lines or words on a large page can be found with
+ *          rl1 = pixConvertToRLPix(pixs);
+ *          rl2 = rlpixCloseBrick(rl1, 30, 1);
+ *          boxa = rlpixConnCompBB(rl2, 8);
+ *  without making any full-size pix.
+ *
+ *  Horizontal brick operations move the ends of each run.  Vertical
+ *  operations combine the runs on a window of lines; the window is
+ *  built up by doubling, using log2(size) passes of line-by-line
+ *  union or intersection.  Connected components are found with
+ *  union-find on the runs, joining runs on adjacent lines that
+ *  overlap (4-cc) or overlap or touch diagonally (8-cc).
+ * </pre>
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config_auto.h>
+#endif  /* HAVE_CONFIG_H */
+
+#include <string.h>
+#include "allheaders.h"
+#include "pix_internal.h"
+
+    /* Operations on the runs of a pair of lines */
+enum {
+    L_RUNS_UNION = 1,
+    L_RUNS_INTERSECTION = 2,
+    L_RUNS_SUBTRACT = 3
+};
+
+    /* Initial size of the run arrays */
+static const l_int32  InitialRunAlloc = 256;
+
+static l_int32 rlpixAddRun(RLPIX *rl, l_int32 y, l_int32 xs, l_int32 xe);
+static void rlpixEndLine(RLPIX *rl, l_int32 y);
+static l_int32 rlpixLineOp(RLPIX *rld, l_int32 y, const l_int32 *xs1,
+                           const l_int32 *xe1, l_int32 n1, const l_int32 *xs2,
+                           const l_int32 *xe2, l_int32 n2, l_int32 op);
+static RLPIX *rlpixHorizontalBrick(RLPIX *rls, l_int32 size, l_int32 type);
+static RLPIX *rlpixVerticalBrick(RLPIX *rls, l_int32 size, l_int32 type);
+static RLPIX *rlpixCombineShifted(RLPIX *rls, l_int32 shift, l_int32 op,
+                                  l_int32 fillfull);
+static l_int32 *rlpixConnCompRoots(RLPIX *rls, l_int32 connectivity);
+
+#ifndef  NO_CONSOLE_IO
+#define  DEBUG_RLPIX   0
+#endif  /* ~NO_CONSOLE_IO */
+
+
+/*--------------------------------------------------------------------*
+ *                        Create/Destroy/Copy                         *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   rlpixCreate()
+ *
+ * \param[in]    w, h     dimensions of the image
+ * \return  rlpix with no runs, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The run arrays grow as runs are added.
+ * </pre>
+ */
+RLPIX *
+rlpixCreate(l_int32  w,
+            l_int32  h)
+{
+RLPIX  *rl;
+
+    if (w <= 0 || h <= 0)
+        return (RLPIX *)ERROR_PTR("w and h not both > 0", __func__, NULL);
+
+    if ((rl = (RLPIX *)LEPT_CALLOC(1, sizeof(RLPIX))) == NULL)
+        return (RLPIX *)ERROR_PTR("rl not made", __func__, NULL);
+    rl->w = w;
+    rl->h = h;
+    rl->nalloc = InitialRunAlloc;
+    rl->rowstart = (l_int32 *)LEPT_CALLOC(h + 1, sizeof(l_int32));
+    rl->xstart = (l_int32 *)LEPT_CALLOC(rl->nalloc, sizeof(l_int32));
+    rl->xend = (l_int32 *)LEPT_CALLOC(rl->nalloc, sizeof(l_int32));
+    if (!rl->rowstart || !rl->xstart || !rl->xend) {
+        rlpixDestroy(&rl);
+        return (RLPIX *)ERROR_PTR("arrays not made", __func__, NULL);
+    }
+    return rl;
+}
+
+
+/*!
+ * \brief   rlpixDestroy()
+ *
+ * \param[in,out]   prl   will be set to null before returning
+ * \return  void
+ */
+void
+rlpixDestroy(RLPIX  **prl)
+{
+RLPIX  *rl;
+
+    if (prl == NULL) {
+        L_WARNING("ptr address is null!\n", __func__);
+        return;
+    }
+    if ((rl = *prl) == NULL)
+        return;
+
+    LEPT_FREE(rl->rowstart);
+    LEPT_FREE(rl->xstart);
+    LEPT_FREE(rl->xend);
+    LEPT_FREE(rl);
+    *prl = NULL;
+}
+
+
+/*!
+ * \brief   rlpixCopy()
+ *
+ * \param[in]    rls
+ * \return  rld, or NULL on error
+ */
+RLPIX *
+rlpixCopy(RLPIX  *rls)
+{
+RLPIX  *rld;
+
+    if (!rls)
+        return (RLPIX *)ERROR_PTR("rls not defined", __func__, NULL);
+
+    if ((rld = rlpixCreate(rls->w, rls->h)) == NULL)
+        return (RLPIX *)ERROR_PTR("rld not made", __func__, NULL);
+    rld->xres = rls->xres;
+    rld->yres = rls->yres;
+    if (rls->nruns > rld->nalloc) {
+        LEPT_FREE(rld->xstart);
+        LEPT_FREE(rld->xend);
+        rld->nalloc = rls->nruns;
+        rld->xstart = (l_int32 *)LEPT_CALLOC(rld->nalloc, sizeof(l_int32));
+        rld->xend = (l_int32 *)LEPT_CALLOC(rld->nalloc, sizeof(l_int32));
+        if (!rld->xstart || !rld->xend) {
+            rlpixDestroy(&rld);
+            return (RLPIX *)ERROR_PTR("arrays not made", __func__, NULL);
+        }
+    }
+    rld->nruns = rls->nruns;
+    memcpy(rld->rowstart, rls->rowstart, (rls->h + 1) * sizeof(l_int32));
+    memcpy(rld->xstart, rls->xstart, rls->nruns * sizeof(l_int32));
+    memcpy(rld->xend, rls->xend, rls->nruns * sizeof(l_int32));
+    return rld;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                              Accessors                             *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   rlpixGetDimensions()
+ *
+ * \param[in]    rl
+ * \param[out]   pw, ph    [optional] each can be null
+ * \return  0 if OK, 1 on error
+ */
+l_ok
+rlpixGetDimensions(RLPIX    *rl,
+                   l_int32  *pw,
+                   l_int32  *ph)
+{
+    if (pw) *pw = 0;
+    if (ph) *ph = 0;
+    if (!rl)
+        return ERROR_INT("rl not defined", __func__, 1);
+    if (pw) *pw = rl->w;
+    if (ph) *ph = rl->h;
+    return 0;
+}
+
+
+/*!
+ * \brief   rlpixGetRunCount()
+ *
+ * \param[in]    rl
+ * \return  total number of runs, or 0 on error
+ */
+l_int32
+rlpixGetRunCount(RLPIX  *rl)
+{
+    if (!rl)
+        return ERROR_INT("rl not defined", __func__, 0);
+    return rl->nruns;
+}
+
+
+/*!
+ * \brief   rlpixGetLineRuns()
+ *
+ * \param[in]    rl
+ * \param[in]    y          line
+ * \param[out]   pn         number of runs on the line
+ * \param[out]   pxstart    [optional] first pixel of each run
+ * \param[out]   pxend      [optional] last pixel of each run
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The returned arrays are owned by %rl; do not free them.
+ *          They are in increasing order of x.
+ * </pre>
+ */
+l_ok
+rlpixGetLineRuns(RLPIX     *rl,
+                 l_int32    y,
+                 l_int32   *pn,
+                 l_int32  **pxstart,
+                 l_int32  **pxend)
+{
+l_int32  first;
+
+    if (pxstart) *pxstart = NULL;
+    if (pxend) *pxend = NULL;
+    if (!pn)
+        return ERROR_INT("&n not defined", __func__, 1);
+    *pn = 0;
+    if (!rl)
+        return ERROR_INT("rl not defined", __func__, 1);
+    if (y < 0 || y >= rl->h)
+        return ERROR_INT("y out of bounds", __func__, 1);
+
+    first = rl->rowstart[y];
+    *pn = rl->rowstart[y + 1] - first;
+    if (pxstart) *pxstart = rl->xstart + first;
+    if (pxend) *pxend = rl->xend + first;
+    return 0;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                     Conversion to and from pix                     *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   pixConvertToRLPix()
+ *
+ * \param[in]    pixs     1 bpp
+ * \return  rlpix, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) Words that are all 0 outside a run, or all 1 inside a run,
+ *          are passed over without looking at the bits.
+ * </pre>
+ */
+RLPIX *
+pixConvertToRLPix(PIX  *pixs)
+{
+l_int32    i, j, k, w, h, wpl, inrun, xs, bit;
+l_uint32   word, lastmask;
+l_uint32  *data, *line;
+RLPIX     *rl;
+
+    if (!pixs || pixGetDepth(pixs) != 1)
+        return (RLPIX *)ERROR_PTR("pixs undefined or not 1 bpp",
+                                  __func__, NULL);
+
+    pixGetDimensions(pixs, &w, &h, NULL);
+    if ((rl = rlpixCreate(w, h)) == NULL)
+        return (RLPIX *)ERROR_PTR("rl not made", __func__, NULL);
+    pixGetResolution(pixs, &rl->xres, &rl->yres);
+
+    data = pixGetData(pixs);
+    wpl = pixGetWpl(pixs);
+    lastmask = (w & 31) ? 0xffffffff << (32 - (w & 31)) : 0xffffffff;
+    for (i = 0; i < h; i++) {
+        line = data + (size_t)i * wpl;
+        inrun = FALSE;
+        xs = 0;
+        for (j = 0; j < wpl; j++) {
+            word = line[j];
+            if (j == wpl - 1) word &= lastmask;
+            if (!inrun && word == 0) continue;
+            if (inrun && word == 0xffffffff) continue;
+            for (k = 0; k < 32; k++) {
+                bit = (word >> (31 - k)) & 1;
+                if (bit && !inrun) {
+                    xs = 32 * j + k;
+                    inrun = TRUE;
+                } else if (!bit && inrun) {
+                    if (rlpixAddRun(rl, i, xs, 32 * j + k - 1)) {
+                        rlpixDestroy(&rl);
+                        return (RLPIX *)ERROR_PTR("run not added",
+                                                  __func__, NULL);
+                    }
+                    inrun = FALSE;
+                }
+            }
+        }
+        if (inrun && rlpixAddRun(rl, i, xs, w - 1)) {
+            rlpixDestroy(&rl);
+            return (RLPIX *)ERROR_PTR("run not added", __func__, NULL);
+        }
+        rlpixEndLine(rl, i);
+    }
+
+    return rl;
+}
+
+
+/*!
+ * \brief   rlpixConvertToPix()
+ *
+ * \param[in]    rl
+ * \return  pixd 1 bpp, or NULL on error
+ */
+PIX *
+rlpixConvertToPix(RLPIX  *rl)
+{
+l_int32    i, k, wpl, xs, xe, ws, we, m;
+l_uint32   lmask, rmask;
+l_uint32  *data, *line;
+PIX       *pixd;
+
+    if (!rl)
+        return (PIX *)ERROR_PTR("rl not defined", __func__, NULL);
+
+    if ((pixd = pixCreate(rl->w, rl->h, 1)) == NULL)
+        return (PIX *)ERROR_PTR("pixd not made", __func__, NULL);
+    pixSetResolution(pixd, rl->xres, rl->yres);
+    data = pixGetData(pixd);
+    wpl = pixGetWpl(pixd);
+    for (i = 0; i < rl->h; i++) {
+        line = data + (size_t)i * wpl;
+        for (k = rl->rowstart[i]; k < rl->rowstart[i + 1]; k++) {
+            xs = rl->xstart[k];
+            xe = rl->xend[k];
+            ws = xs >> 5;
+            we = xe >> 5;
+            lmask = 0xffffffff >> (xs & 31);
+            rmask = 0xffffffff << (31 - (xe & 31));
+            if (ws == we) {
+                line[ws] |= lmask & rmask;
+            } else {
+                line[ws] |= lmask;
+                for (m = ws + 1; m < we; m++)
+                    line[m] = 0xffffffff;
+                line[we] |= rmask;
+            }
+        }
+    }
+
+    return pixd;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                           Pixel counting                           *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   rlpixCountPixels()
+ *
+ * \param[in]    rl
+ * \param[out]   pcount    number of fg pixels
+ * \return  0 if OK, 1 on error
+ */
+l_ok
+rlpixCountPixels(RLPIX    *rl,
+                 l_int32  *pcount)
+{
+l_int32  k, count;
+
+    if (!pcount)
+        return ERROR_INT("&count not defined", __func__, 1);
+    *pcount = 0;
+    if (!rl)
+        return ERROR_INT("rl not defined", __func__, 1);
+
+    count = 0;
+    for (k = 0; k < rl->nruns; k++)
+        count += rl->xend[k] - rl->xstart[k] + 1;
+    *pcount = count;
+    return 0;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                           Set operations                           *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   rlpixUnion()
+ *
+ * \param[in]    rl1, rl2
+ * \return  rld, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) As with pixOr(), rld has the size of %rl1, and %rl2 is
+ *          aligned with it at the UL corner and clipped to it.
+ *          The same holds for rlpixIntersection() and rlpixSubtract().
+ *          As with pixAnd(), the part of %rl1 that is not covered
+ *          by %rl2 is not changed by rlpixIntersection().
+ * </pre>
+ */
+RLPIX *
+rlpixUnion(RLPIX  *rl1,
+           RLPIX  *rl2)
+{
+l_int32  i, n1, n2;
+l_int32  *xs1, *xe1, *xs2, *xe2;
+RLPIX   *rld;
+
+    if (!rl1 || !rl2)
+        return (RLPIX *)ERROR_PTR("rl1 and rl2 not both defined",
+                                  __func__, NULL);
+
+    if ((rld = rlpixCreate(rl1->w, rl1->h)) == NULL)
+        return (RLPIX *)ERROR_PTR("rld not made", __func__, NULL);
+    rld->xres = rl1->xres;
+    rld->yres = rl1->yres;
+    for (i = 0; i < rl1->h; i++) {
+        rlpixGetLineRuns(rl1, i, &n1, &xs1, &xe1);
+        n2 = 0;
+        xs2 = xe2 = NULL;
+        if (i < rl2->h)
+            rlpixGetLineRuns(rl2, i, &n2, &xs2, &xe2);
+        if (rlpixLineOp(rld, i, xs1, xe1, n1, xs2, xe2, n2, L_RUNS_UNION)) {
+            rlpixDestroy(&rld);
+            return (RLPIX *)ERROR_PTR("runs not added", __func__, NULL);
+        }
+        rlpixEndLine(rld, i);
+    }
+    return rld;
+}
+
+
+/*!
+ * \brief   rlpixIntersection()
+ *
+ * \param[in]    rl1, rl2
+ * \return  rld, or NULL on error
+ */
+RLPIX *
+rlpixIntersection(RLPIX  *rl1,
+                  RLPIX  *rl2)
+{
+l_int32  i, n1, n2, ret, fullstart, fullend;
+l_int32  *xs1, *xe1, *xs2, *xe2;
+RLPIX   *rld;
+
+    if (!rl1 || !rl2)
+        return (RLPIX *)ERROR_PTR("rl1 and rl2 not both defined",
+                                  __func__, NULL);
+
+    if ((rld = rlpixCreate(rl1->w, rl1->h)) == NULL)
+        return (RLPIX *)ERROR_PTR("rld not made", __func__, NULL);
+    rld->xres = rl1->xres;
+    rld->yres = rl1->yres;
+    fullstart = rl2->w;
+    fullend = rl1->w - 1;
+    for (i = 0; i < rl1->h; i++) {
+        rlpixGetLineRuns(rl1, i, &n1, &xs1, &xe1);
+        if (i < rl2->h) {
+            rlpixGetLineRuns(rl2, i, &n2, &xs2, &xe2);
+            ret = rlpixLineOp(rld, i, xs1, xe1, n1, xs2, xe2, n2,
+                              L_RUNS_INTERSECTION);
+                /* Keep the part of the line to the right of rl2 */
+            if (!ret && fullstart <= fullend)
+                ret = rlpixLineOp(rld, i, xs1, xe1, n1, &fullstart,
+                                  &fullend, 1, L_RUNS_INTERSECTION);
+        } else {  /* keep the line */
+            ret = rlpixLineOp(rld, i, xs1, xe1, n1, NULL, NULL, 0,
+                              L_RUNS_UNION);
+        }
+        if (ret) {
+            rlpixDestroy(&rld);
+            return (RLPIX *)ERROR_PTR("runs not added", __func__, NULL);
+        }
+        rlpixEndLine(rld, i);
+    }
+    return rld;
+}
+
+
+/*!
+ * \brief   rlpixSubtract()
+ *
+ * \param[in]    rl1, rl2
+ * \return  rld, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This gives the fg pixels of %rl1 that are not in %rl2.
+ * </pre>
+ */
+RLPIX *
+rlpixSubtract(RLPIX  *rl1,
+              RLPIX  *rl2)
+{
+l_int32  i, n1, n2;
+l_int32  *xs1, *xe1, *xs2, *xe2;
+RLPIX   *rld;
+
+    if (!rl1 || !rl2)
+        return (RLPIX *)ERROR_PTR("rl1 and rl2 not both defined",
+                                  __func__, NULL);
+
+    if ((rld = rlpixCreate(rl1->w, rl1->h)) == NULL)
+        return (RLPIX *)ERROR_PTR("rld not made", __func__, NULL);
+    rld->xres = rl1->xres;
+    rld->yres = rl1->yres;
+    for (i = 0; i < rl1->h; i++) {
+        rlpixGetLineRuns(rl1, i, &n1, &xs1, &xe1);
+        n2 = 0;
+        xs2 = xe2 = NULL;
+        if (i < rl2->h)
+            rlpixGetLineRuns(rl2, i, &n2, &xs2, &xe2);
+        if (rlpixLineOp(rld, i, xs1, xe1, n1, xs2, xe2, n2,
+                        L_RUNS_SUBTRACT)) {
+            rlpixDestroy(&rld);
+            return (RLPIX *)ERROR_PTR("runs not added", __func__, NULL);
+        }
+        rlpixEndLine(rld, i);
+    }
+    return rld;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                     Morphology with brick Sels                     *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   rlpixDilateBrick()
+ *
+ * \param[in]    rls
+ * \param[in]    hsize    width of brick Sel
+ * \param[in]    vsize    height of brick Sel
+ * \return  rld, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The Sel has its origin at (hsize/2, vsize/2), as in
+ *          pixDilateBrick(), and the result is the same.
+ *      (2) The horizontal and vertical operations are done separably.
+ * </pre>
+ */
+RLPIX *
+rlpixDilateBrick(RLPIX   *rls,
+                 l_int32  hsize,
+                 l_int32  vsize)
+{
+RLPIX  *rl1, *rld;
+
+    if (!rls)
+        return (RLPIX *)ERROR_PTR("rls not defined", __func__, NULL);
+    if (hsize < 1 || vsize < 1)
+        return (RLPIX *)ERROR_PTR("hsize and vsize not >= 1", __func__, NULL);
+
+    if ((rl1 = rlpixHorizontalBrick(rls, hsize, L_MORPH_DILATE)) == NULL)
+        return (RLPIX *)ERROR_PTR("rl1 not made", __func__, NULL);
+    rld = rlpixVerticalBrick(rl1, vsize, L_MORPH_DILATE);
+    rlpixDestroy(&rl1);
+    if (!rld)
+        return (RLPIX *)ERROR_PTR("rld not made", __func__, NULL);
+    return rld;
+}
+
+
+/*!
+ * \brief   rlpixErodeBrick()
+ *
+ * \param[in]    rls
+ * \param[in]    hsize    width of brick Sel
+ * \param[in]    vsize    height of brick Sel
+ * \return  rld, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The result is the same as pixErodeBrick(), for either
+ *          boundary condition.  With symmetric b.c., pixels outside
+ *          the image are taken to be ON.
+ * </pre>
+ */
+RLPIX *
+rlpixErodeBrick(RLPIX   *rls,
+                l_int32  hsize,
+                l_int32  vsize)
+{
+RLPIX  *rl1, *rld;
+
+    if (!rls)
+        return (RLPIX *)ERROR_PTR("rls not defined", __func__, NULL);
+    if (hsize < 1 || vsize < 1)
+        return (RLPIX *)ERROR_PTR("hsize and vsize not >= 1", __func__, NULL);
+
+    if ((rl1 = rlpixHorizontalBrick(rls, hsize, L_MORPH_ERODE)) == NULL)
+        return (RLPIX *)ERROR_PTR("rl1 not made", __func__, NULL);
+    rld = rlpixVerticalBrick(rl1, vsize, L_MORPH_ERODE);
+    rlpixDestroy(&rl1);
+    if (!rld)
+        return (RLPIX *)ERROR_PTR("rld not made", __func__, NULL);
+    return rld;
+}
+
+
+/*!
+ * \brief   rlpixOpenBrick()
+ *
+ * \param[in]    rls
+ * \param[in]    hsize    width of brick Sel
+ * \param[in]    vsize    height of brick Sel
+ * \return  rld, or NULL on error
+ */
+RLPIX *
+rlpixOpenBrick(RLPIX   *rls,
+               l_int32  hsize,
+               l_int32  vsize)
+{
+RLPIX  *rl1, *rld;
+
+    if (!rls)
+        return (RLPIX *)ERROR_PTR("rls not defined", __func__, NULL);
+
+    if ((rl1 = rlpixErodeBrick(rls, hsize, vsize)) == NULL)
+        return (RLPIX *)ERROR_PTR("rl1 not made", __func__, NULL);
+    rld = rlpixDilateBrick(rl1, hsize, vsize);
+    rlpixDestroy(&rl1);
+    if (!rld)
+        return (RLPIX *)ERROR_PTR("rld not made", __func__, NULL);
+    return rld;
+}
+
+
+/*!
+ * \brief   rlpixCloseBrick()
+ *
+ * \param[in]    rls
+ * \param[in]    hsize    width of brick Sel
+ * \param[in]    vsize    height of brick Sel
+ * \return  rld, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) As with pixCloseBrick(), this is not a safe closing:
+ *          with asymmetric b.c., fg pixels near the image boundary
+ *          can be removed.
+ * </pre>
+ */
+RLPIX *
+rlpixCloseBrick(RLPIX   *rls,
+                l_int32  hsize,
+                l_int32  vsize)
+{
+RLPIX  *rl1, *rld;
+
+    if (!rls)
+        return (RLPIX *)ERROR_PTR("rls not defined", __func__, NULL);
+
+    if ((rl1 = rlpixDilateBrick(rls, hsize, vsize)) == NULL)
+        return (RLPIX *)ERROR_PTR("rl1 not made", __func__, NULL);
+    rld = rlpixErodeBrick(rl1, hsize, vsize);
+    rlpixDestroy(&rl1);
+    if (!rld)
+        return (RLPIX *)ERROR_PTR("rld not made", __func__, NULL);
+    return rld;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                        Connected components                        *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   rlpixConnCompBB()
+ *
+ * \param[in]    rls
+ * \param[in]    connectivity    4 or 8
+ * \return  boxa of the c.c. bounding boxes, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The boxes are in the same order as from pixConnCompBB():
+ *          by the raster order of the first pixel of each component.
+ * </pre>
+ */
+BOXA *
+rlpixConnCompBB(RLPIX   *rls,
+                l_int32  connectivity)
+{
+l_int32   i, k, r, nroots, idx;
+l_int32  *root, *index, *xmin, *ymin, *xmax, *ymax;
+BOXA     *boxa;
+
+    if (!rls)
+        return (BOXA *)ERROR_PTR("rls not defined", __func__, NULL);
+    if (connectivity != 4 && connectivity != 8)
+        return (BOXA *)ERROR_PTR("connectivity not 4 or 8", __func__, NULL);
+
+    if (rls->nruns == 0)
+        return boxaCreate(1);
+    if ((root = rlpixConnCompRoots(rls, connectivity)) == NULL)
+        return (BOXA *)ERROR_PTR("roots not found", __func__, NULL);
+
+        /* The roots are the first run of each component, so numbering
+         * them in order of run index gives the raster order */
+    if ((index = (l_int32 *)LEPT_CALLOC(rls->nruns, sizeof(l_int32)))
+            == NULL) {
+        LEPT_FREE(root);
+        return (BOXA *)ERROR_PTR("index not made", __func__, NULL);
+    }
+    nroots = 0;
+    for (k = 0; k < rls->nruns; k++) {
+        if (root[k] == k)
+            index[k] = nroots++;
+    }
+    xmin = (l_int32 *)LEPT_CALLOC(nroots, sizeof(l_int32));
+    ymin = (l_int32 *)LEPT_CALLOC(nroots, sizeof(l_int32));
+    xmax = (l_int32 *)LEPT_CALLOC(nroots, sizeof(l_int32));
+    ymax = (l_int32 *)LEPT_CALLOC(nroots, sizeof(l_int32));
+    boxa = NULL;
+    if (!xmin || !ymin || !xmax || !ymax) {
+        L_ERROR("bounds arrays not made\n", __func__);
+        goto cleanup_arrays;
+    }
+    for (i = 0; i < rls->h; i++) {
+        for (k = rls->rowstart[i]; k < rls->rowstart[i + 1]; k++) {
+            r = root[k];
+            idx = index[r];
+            if (r == k) {  /* first run of the component */
+                xmin[idx] = rls->xstart[k];
+                xmax[idx] = rls->xend[k];
+                ymin[idx] = ymax[idx] = i;
+            } else {
+                xmin[idx] = L_MIN(xmin[idx], rls->xstart[k]);
+                xmax[idx] = L_MAX(xmax[idx], rls->xend[k]);
+                ymax[idx] = i;
+            }
+        }
+    }
+
+    if ((boxa = boxaCreate(nroots)) == NULL) {
+        L_ERROR("boxa not made\n", __func__);
+        goto cleanup_arrays;
+    }
+    for (k = 0; k < nroots; k++) {
+        boxaAddBox(boxa, boxCreate(xmin[k], ymin[k], xmax[k] - xmin[k] + 1,
+                                   ymax[k] - ymin[k] + 1), L_INSERT);
+    }
+
+cleanup_arrays:
+    LEPT_FREE(root);
+    LEPT_FREE(index);
+    LEPT_FREE(xmin);
+    LEPT_FREE(ymin);
+    LEPT_FREE(xmax);
+    LEPT_FREE(ymax);
+    return boxa;
+}
+
+
+/*!
+ * \brief   rlpixCountConnComp()
+ *
+ * \param[in]    rls
+ * \param[in]    connectivity    4 or 8
+ * \param[out]   pcount          number of connected components
+ * \return  0 if OK, 1 on error
+ */
+l_ok
+rlpixCountConnComp(RLPIX    *rls,
+                   l_int32   connectivity,
+                   l_int32  *pcount)
+{
+l_int32   k, count;
+l_int32  *root;
+
+    if (!pcount)
+        return ERROR_INT("&count not defined", __func__, 1);
+    *pcount = 0;
+    if (!rls)
+        return ERROR_INT("rls not defined", __func__, 1);
+    if (connectivity != 4 && connectivity != 8)
+        return ERROR_INT("connectivity not 4 or 8", __func__, 1);
+
+    if (rls->nruns == 0)
+        return 0;
+    if ((root = rlpixConnCompRoots(rls, connectivity)) == NULL)
+        return ERROR_INT("roots not found", __func__, 1);
+    count = 0;
+    for (k = 0; k < rls->nruns; k++) {
+        if (root[k] == k)
+            count++;
+    }
+    LEPT_FREE(root);
+    *pcount = count;
+    return 0;
+}
+
+
+/*--------------------------------------------------------------------*
+ *                           Static helpers                           *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   rlpixAddRun()
+ *
+ * \param[in]    rl
+ * \param[in]    y        line being built; all earlier lines are finished
+ * \param[in]    xs, xe   first and last pixel of the run
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) Runs must be added to a line in increasing order of %xs.
+ *          A run that overlaps or touches the last run on the line
+ *          is merged with it.
+ * </pre>
+ */
+static l_int32
+rlpixAddRun(RLPIX   *rl,
+            l_int32  y,
+            l_int32  xs,
+            l_int32  xe)
+{
+l_int32  n;
+
+    n = rl->nruns;
+    if (n > rl->rowstart[y] && xs <= rl->xend[n - 1] + 1) {
+        if (xe > rl->xend[n - 1])
+            rl->xend[n - 1] = xe;
+        return 0;
+    }
+
+    if (n >= rl->nalloc) {
+        if ((rl->xstart = (l_int32 *)reallocNew((void **)&rl->xstart,
+                               sizeof(l_int32) * rl->nalloc,
+                               2 * sizeof(l_int32) * rl->nalloc)) == NULL)
+            return ERROR_INT("new xstart not returned", __func__, 1);
+        if ((rl->xend = (l_int32 *)reallocNew((void **)&rl->xend,
+                               sizeof(l_int32) * rl->nalloc,
+                               2 * sizeof(l_int32) * rl->nalloc)) == NULL)
+            return ERROR_INT("new xend not returned", __func__, 1);
+        rl->nalloc *= 2;
+    }
+    rl->xstart[n] = xs;
+    rl->xend[n] = xe;
+    rl->nruns++;
+    return 0;
+}
+
+
+/*!
+ * \brief   rlpixEndLine()
+ *
+ * \param[in]    rl
+ * \param[in]    y        line that has been finished
+ * \return  void
+ */
+static void
+rlpixEndLine(RLPIX   *rl,
+             l_int32  y)
+{
+    rl->rowstart[y + 1] = rl->nruns;
+}
+
+
+/*!
+ * \brief   rlpixLineOp()
+ *
+ * \param[in]    rld        the runs are added to line %y of this
+ * \param[in]    y          line of rld
+ * \param[in]    xs1, xe1   runs of the first line
+ * \param[in]    n1         number of runs in the first line
+ * \param[in]    xs2, xe2   runs of the second line
+ * \param[in]    n2         number of runs in the second line
+ * \param[in]    op         L_RUNS_UNION, L_RUNS_INTERSECTION, L_RUNS_SUBTRACT
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) Runs of the second line that extend beyond the width
+ *          of %rld are clipped.
+ * </pre>
+ */
+static l_int32
+rlpixLineOp(RLPIX          *rld,
+            l_int32         y,
+            const l_int32  *xs1,
+            const l_int32  *xe1,
+            l_int32         n1,
+            const l_int32  *xs2,
+            const l_int32  *xe2,
+            l_int32         n2,
+            l_int32         op)
+{
+l_int32  i, j, k, s, e, cur, maxx;
+
+    maxx = rld->w - 1;
+    i = j = 0;
+    if (op == L_RUNS_UNION) {
+        while (i < n1 || j < n2) {
+            if (j >= n2 || (i < n1 && xs1[i] <= xs2[j])) {
+                s = xs1[i];
+                e = xe1[i++];
+            } else {
+                s = xs2[j];
+                e = xe2[j++];
+            }
+            if (s > maxx) continue;
+            if (rlpixAddRun(rld, y, s, L_MIN(e, maxx)))
+                return 1;
+        }
+    } else if (op == L_RUNS_INTERSECTION) {
+        while (i < n1 && j < n2) {
+            s = L_MAX(xs1[i], xs2[j]);
+            e = L_MIN(xe1[i], xe2[j]);
+            if (s <= e && rlpixAddRun(rld, y, s, e))
+                return 1;
+            if (xe1[i] < xe2[j])
+                i++;
+            else
+                j++;
+        }
+    } else {  /* L_RUNS_SUBTRACT */
+        for (i = 0; i < n1; i++) {
+            cur = xs1[i];
+            while (j < n2 && xe2[j] < cur)
+                j++;
+            for (k = j; k < n2 && xs2[k] <= xe1[i]; k++) {
+                if (xs2[k] > cur && rlpixAddRun(rld, y, cur, xs2[k] - 1))
+                    return 1;
+                cur = L_MAX(cur, xe2[k] + 1);
+            }
+            if (cur <= xe1[i] && rlpixAddRun(rld, y, cur, xe1[i]))
+                return 1;
+        }
+    }
+    return 0;
+}
+
+
+/*!
+ * \brief   rlpixHorizontalBrick()
+ *
+ * \param[in]    rls
+ * \param[in]    size    width of the horizontal Sel
+ * \param[in]    type    L_MORPH_DILATE or L_MORPH_ERODE
+ * \return  rld, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) With the origin at cx = size / 2, dilation moves the ends
+ *          of each run out by cx on the left and by size - 1 - cx on
+ *          the right; erosion moves them in by the same amounts.
+ *      (2) For erosion with symmetric b.c., the ends of runs that
+ *          touch the image boundary stay in place.
+ * </pre>
+ */
+static RLPIX *
+rlpixHorizontalBrick(RLPIX   *rls,
+                     l_int32  size,
+                     l_int32  type)
+{
+l_int32  i, k, w, cx, xs, xe, symmetric;
+RLPIX   *rld;
+
+    if (size == 1)
+        return rlpixCopy(rls);
+
+    w = rls->w;
+    if ((rld = rlpixCreate(w, rls->h)) == NULL)
+        return (RLPIX *)ERROR_PTR("rld not made", __func__, NULL);
+    rld->xres = rls->xres;
+    rld->yres = rls->yres;
+    cx = size / 2;
+    symmetric = (MORPH_BC == SYMMETRIC_MORPH_BC);
+    for (i = 0; i < rls->h; i++) {
+        for (k = rls->rowstart[i]; k < rls->rowstart[i + 1]; k++) {
+            if (type == L_MORPH_DILATE) {
+                xs = L_MAX(0, rls->xstart[k] - cx);
+                xe = L_MIN(w - 1, rls->xend[k] + size - 1 - cx);
+            } else {
+                xs = rls->xstart[k];
+                xe = rls->xend[k];
+                if (!symmetric || xs > 0)
+                    xs += cx;
+                if (!symmetric || xe < w - 1)
+                    xe -= size - 1 - cx;
+                if (xs > xe) continue;
+            }
+            if (rlpixAddRun(rld, i, xs, xe)) {
+                rlpixDestroy(&rld);
+                return (RLPIX *)ERROR_PTR("run not added", __func__, NULL);
+            }
+        }
+        rlpixEndLine(rld, i);
+    }
+    return rld;
+}
+
+
+/*!
+ * \brief   rlpixVerticalBrick()
+ *
+ * \param[in]    rls
+ * \param[in]    size    height of the vertical Sel
+ * \param[in]    type    L_MORPH_DILATE or L_MORPH_ERODE
+ * \return  rld, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) With the origin at cy = size / 2, line y of the dilation
+ *          is the union of lines [y + cy - (size - 1), y + cy] of rls,
+ *          and line y of the erosion is the intersection of lines
+ *          [y - cy, y - cy + size - 1].  Lines outside the image are
+ *          empty, except for erosion with symmetric b.c., where
+ *          they are full.
+ *      (2) The lines of rls are put in a taller rlpix, with size - 1
+ *          lines of padding above and below.  Then for L = 1, 2, 4, ...
+ *          the union (intersection) of each window of L lines is
+ *          found from two windows of L/2 lines.  The last step uses
+ *          two overlapping windows to reach exactly %size lines.
+ * </pre>
+ */
+static RLPIX *
+rlpixVerticalBrick(RLPIX   *rls,
+                   l_int32  size,
+                   l_int32  type)
+{
+l_int32  i, k, h, pad, len, shift, offset, op, fillfull;
+RLPIX   *rlp, *rlt, *rld;
+
+    if (size == 1)
+        return rlpixCopy(rls);
+
+    h = rls->h;
+    pad = size - 1;
+    op = (type == L_MORPH_DILATE) ? L_RUNS_UNION : L_RUNS_INTERSECTION;
+    fillfull = (type == L_MORPH_ERODE && MORPH_BC == SYMMETRIC_MORPH_BC);
+
+        /* Make the padded rlpix */
+    if ((rlp = rlpixCreate(rls->w, h + 2 * pad)) == NULL)
+        return (RLPIX *)ERROR_PTR("rlp not made", __func__, NULL);
+    for (i = 0; i < h + 2 * pad; i++) {
+        if (i < pad || i >= h + pad) {
+            if (fillfull && rlpixAddRun(rlp, i, 0, rls->w - 1)) {
+                rlpixDestroy(&rlp);
+                return (RLPIX *)ERROR_PTR("run not added", __func__, NULL);
+            }
+        } else {
+            for (k = rls->rowstart[i - pad]; k < rls->rowstart[i - pad + 1];
+                 k++) {
+                if (rlpixAddRun(rlp, i, rls->xstart[k], rls->xend[k])) {
+                    rlpixDestroy(&rlp);
+                    return (RLPIX *)ERROR_PTR("run not added", __func__, NULL);
+                }
+            }
+        }
+        rlpixEndLine(rlp, i);
+    }
+
+        /* Build up windows of %size lines by doubling */
+    len = 1;
+    while (len < size) {
+        shift = L_MIN(len, size - len);
+        rlt = rlpixCombineShifted(rlp, shift, op, fillfull);
+        rlpixDestroy(&rlp);
+        if ((rlp = rlt) == NULL)
+            return (RLPIX *)ERROR_PTR("rlt not made", __func__, NULL);
+        len += shift;
+    }
+
+        /* Line y of the result is the window starting at line
+         * y + offset of rls, which is line y + offset + pad of rlp */
+    offset = (type == L_MORPH_DILATE) ? size / 2 - (size - 1) : -(size / 2);
+    if ((rld = rlpixCreate(rls->w, h)) == NULL) {
+        rlpixDestroy(&rlp);
+        return (RLPIX *)ERROR_PTR("rld not made", __func__, NULL);
+    }
+    rld->xres = rls->xres;
+    rld->yres = rls->yres;
+    for (i = 0; i < h; i++) {
+        for (k = rlp->rowstart[i + offset + pad];
+             k < rlp->rowstart[i + offset + pad + 1]; k++) {
+            if (rlpixAddRun(rld, i, rlp->xstart[k], rlp->xend[k])) {
+                rlpixDestroy(&rlp);
+                rlpixDestroy(&rld);
+                return (RLPIX *)ERROR_PTR("run not added", __func__, NULL);
+            }
+        }
+        rlpixEndLine(rld, i);
+    }
+    rlpixDestroy(&rlp);
+    return rld;
+}
+
+
+/*!
+ * \brief   rlpixCombineShifted()
+ *
+ * \param[in]    rls
+ * \param[in]    shift      > 0
+ * \param[in]    op         L_RUNS_UNION or L_RUNS_INTERSECTION
+ * \param[in]    fillfull   1 if lines below the image are full; 0 if empty
+ * \return  rld, where line y is line y of rls combined with
+ *          line y + shift of rls; or NULL on error
+ */
+static RLPIX *
+rlpixCombineShifted(RLPIX   *rls,
+                    l_int32  shift,
+                    l_int32  op,
+                    l_int32  fillfull)
+{
+l_int32   i, n1, n2;
+l_int32   fullstart, fullend;
+l_int32  *xs1, *xe1, *xs2, *xe2;
+RLPIX    *rld;
+
+    if ((rld = rlpixCreate(rls->w, rls->h)) == NULL)
+        return (RLPIX *)ERROR_PTR("rld not made", __func__, NULL);
+    fullstart = 0;
+    fullend = rls->w - 1;
+    for (i = 0; i < rls->h; i++) {
+        rlpixGetLineRuns(rls, i, &n1, &xs1, &xe1);
+        if (i + shift < rls->h) {
+            rlpixGetLineRuns(rls, i + shift, &n2, &xs2, &xe2);
+        } else if (fillfull) {
+            n2 = 1;
+            xs2 = &fullstart;
+            xe2 = &fullend;
+        } else {
+            n2 = 0;
+            xs2 = xe2 = NULL;
+        }
+        if (rlpixLineOp(rld, i, xs1, xe1, n1, xs2, xe2, n2, op)) {
+            rlpixDestroy(&rld);
+            return (RLPIX *)ERROR_PTR("runs not added", __func__, NULL);
+        }
+        rlpixEndLine(rld, i);
+    }
+    return rld;
+}
+
+
+/*!
+ * \brief   rlpixConnCompRoots()
+ *
+ * \param[in]    rls
+ * \param[in]    connectivity    4 or 8
+ * \return  array giving for each run the index of the first run of its
+ *          component; or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is union-find on the runs.  Each union links the
+ *          larger root to the smaller, so the root of each component
+ *          is its first run in raster order.
+ * </pre>
+ */
+static l_int32 *
+rlpixConnCompRoots(RLPIX   *rls,
+                   l_int32  connectivity)
+{
+l_int32   i, j, k, r1, r2, reach, start, prevstart, prevend;
+l_int32  *parent;
+
+    if ((parent = (l_int32 *)LEPT_CALLOC(rls->nruns, sizeof(l_int32)))
+            == NULL)
+        return (l_int32 *)ERROR_PTR("parent not made", __func__, NULL);
+    for (k = 0; k < rls->nruns; k++)
+        parent[k] = k;
+
+    reach = (connectivity == 8) ? 1 : 0;
+    for (i = 1; i < rls->h; i++) {
+        prevstart = rls->rowstart[i - 1];
+        prevend = rls->rowstart[i];
+        start = prevstart;
+        for (k = rls->rowstart[i]; k < rls->rowstart[i + 1]; k++) {
+                /* Skip the runs above that end before this one can
+                 * touch them; they can't touch any later run either */
+            while (start < prevend &&
+                   rls->xend[start] + reach < rls->xstart[k])
+                start++;
+            for (j = start; j < prevend &&
+                 rls->xstart[j] <= rls->xend[k] + reach; j++) {
+                for (r1 = j; parent[r1] != r1; r1 = parent[r1]) ;
+                for (r2 = k; parent[r2] != r2; r2 = parent[r2]) ;
+                if (r1 < r2)
+                    parent[r2] = r1;
+                else if (r2 < r1)
+                    parent[r1] = r2;
+                parent[j] = parent[k] = L_MIN(r1, r2);  /* compress */
+            }
+        }
+    }
+
+        /* Flatten, in order, so that every run points to its root */
+    for (k = 0; k < rls->nruns; k++)
+        parent[k] = parent[parent[k]];
+    return parent;
+}
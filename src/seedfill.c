@@ -30,8 +30,10 @@
  *
  *      Binary seedfill (source: Luc Vincent)
  *               PIX         *pixSeedfillBinary()
+ *               PIX         *pixSeedfillBinaryBands()
  *               PIX         *pixSeedfillBinaryRestricted()
- *               static void  seedfillBinaryLow()
+ *               static l_int32  seedfillBinaryLow()
+ *               static l_int32  seedfillBinaryAcrossLow()
  *
  *      Applications of binary seedfill to find and fill holes,
  *      remove c.c. touching the border and fill bg from border:
@@ -169,6 +171,9 @@
 #endif  /* HAVE_CONFIG_H */
 
 #include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif  /* _OPENMP */
 #include "allheaders.h"
 
 struct L_Pixel
@@ -178,9 +183,12 @@ struct L_Pixel
 };
 typedef struct L_Pixel  L_PIXEL;
 
-static void seedfillBinaryLow(l_uint32 *datas, l_int32 hs, l_int32 wpls,
-                              l_uint32 *datam, l_int32 hm, l_int32 wplm,
-                              l_int32 connectivity);
+static l_int32 seedfillBinaryLow(l_uint32 *datas, l_int32 hs, l_int32 wpls,
+                                 l_uint32 *datam, l_int32 hm, l_int32 wplm,
+                                 l_int32 connectivity);
+static l_int32 seedfillBinaryAcrossLow(l_uint32 *linea, l_uint32 *lineb,
+                                       l_uint32 *linema, l_uint32 *linemb,
+                                       l_int32 wpl, l_int32 connectivity);
 static void seedfillGrayLow(l_uint32 *datas, l_int32 w, l_int32 h,
                             l_int32 wpls, l_uint32 *datam, l_int32 wplm,
                             l_int32 connectivity);
@@ -208,6 +216,9 @@ static l_int32 pixQualifyLocalMinima(PIX *pixs, PIX *pixm, l_int32 maxval);
   /* Two-way (UL --> LR, LR --> UL) sweep iterations; typically need only 4 */
 static const l_int32  MaxIters = 40;
 
+  /* Minimum number of rows in each band for banded binary seedfill */
+static const l_int32  MinSeedfillBandHeight = 64;
+
 
 /*-----------------------------------------------------------------------*
  *              Vincent's Iterative Binary Seedfill method               *
@@ -241,6 +252,12 @@ static const l_int32  MaxIters = 40;
  *          a few pixels in each direction.  If the sizes differ,
  *          the clipping is handled by the low-level function
  *          seedfillBinaryLow().
+ *      (6) This stops after MaxIters two-way sweeps.  That is enough
+ *          for all but pathological masks, such as a long spiral, for
+ *          which the fill can be incomplete.
+ *      (7) When built with OpenMP and more than one thread is available,
+ *          large images are filled in bands; see pixSeedfillBinaryBands().
+ *          That always runs to convergence.
  * </pre>
  */
 PIX *
@@ -249,10 +266,11 @@ pixSeedfillBinary(PIX     *pixd,
                   PIX     *pixm,
                   l_int32  connectivity)
 {
-l_int32    i, boolval;
-l_int32    hd, hm, wpld, wplm;
+l_int32    i, hd, hm, wpld, wplm;
 l_uint32  *datad, *datam;
-PIX       *pixt;
+#ifdef _OPENMP
+l_int32    nthreads;
+#endif  /* _OPENMP */
 
     if (!pixs || pixGetDepth(pixs) != 1)
         return (PIX *)ERROR_PTR("pixs undefined or not 1 bpp", __func__, pixd);
@@ -262,15 +280,21 @@ PIX       *pixt;
         return (PIX *)ERROR_PTR("connectivity not in {4,8}", __func__, pixd);
 
         /* Prepare pixd as a copy of pixs if not identical */
+#ifdef _OPENMP
+        /* Split large images into bands that are filled in parallel */
+    nthreads = omp_get_max_threads();
+    if (nthreads > 1 &&
+        L_MIN(pixGetHeight(pixs), pixGetHeight(pixm)) >=
+            2 * MinSeedfillBandHeight)
+        return pixSeedfillBinaryBands(pixd, pixs, pixm, connectivity,
+                                      nthreads);
+#endif  /* _OPENMP */
+
     if ((pixd = pixCopy(pixd, pixs)) == NULL)
         return (PIX *)ERROR_PTR("pixd not made", __func__, NULL);
     pixSetPadBits(pixd, 0);  /* be safe: */
     pixSetPadBits(pixm, 0);  /* avoid using uninitialized memory */
 
-        /* pixt is used to test for completion */
-    if ((pixt = pixCreateTemplate(pixs)) == NULL)
-        return (PIX *)ERROR_PTR("pixt not made", __func__, pixd);
-
     hd = pixGetHeight(pixd);
     hm = pixGetHeight(pixm);  /* included so seedfillBinaryLow() can clip */
     datad = pixGetData(pixd);
@@ -278,12 +302,9 @@ PIX       *pixt;
     wpld = pixGetWpl(pixd);
     wplm = pixGetWpl(pixm);
 
-
     for (i = 0; i < MaxIters; i++) {
-        pixCopy(pixt, pixd);
-        seedfillBinaryLow(datad, hd, wpld, datam, hm, wplm, connectivity);
-        pixEqual(pixd, pixt, &boolval);
-        if (boolval == 1) {
+        if (!seedfillBinaryLow(datad, hd, wpld, datam, hm, wplm,
+                               connectivity)) {
 #if DEBUG_PRINT_ITERS
             lept_stderr("Binary seed fill converged: %d iters\n", i + 1);
 #endif  /* DEBUG_PRINT_ITERS */
@@ -291,7 +312,128 @@ PIX       *pixt;
         }
     }
 
-    pixDestroy(&pixt);
+    return pixd;
+}
+
+
+/*!
+ * \brief   pixSeedfillBinaryBands()
+ *
+ * \param[in]    pixd          [optional]; can be null, equal to pixs,
+ *                             or different from pixs; 1 bpp
+ * \param[in]    pixs          1 bpp seed
+ * \param[in]    pixm          1 bpp filling mask
+ * \param[in]    connectivity  4 or 8
+ * \param[in]    nbands        number of horizontal bands; use 0 for
+ *                             the number of threads available
+ * \return  pixd always
+ *
+ * <pre>
+ * Notes:
+ *      (1) This fills the image split into bands of rows that can be
+ *          filled in parallel.  pixSeedfillBinary() calls it for large
+ *          images when more than one thread is available.  Unlike the
+ *          serial fill, which stops after MaxIters two-way sweeps, this
+ *          has no iteration limit and always gives the full fill.  The
+ *          result is the same as from the serial fill whenever that
+ *          converges within its limit, which it does for all but
+ *          pathological masks.
+ *      (2) Each round has two steps:
+ *            (a) Each band that needs it is filled independently,
+ *                with two-way sweeps repeated until it is stable.
+ *            (b) The fill is propagated across each boundary between
+ *                bands, from the last row of the band above to the
+ *                first row of the band below, and back.  Any band
+ *                with a changed row is marked to be filled again.
+ *          The rounds stop when no band is marked.  Because the
+ *          seed only grows, this converges to the full fill.
+ *      (3) Bands that don't change are not filled again, so for
+ *          typical masks, such as in pixHolesByFilling(), most bands
+ *          are done after the first round.
+ *      (4) Bands have at least MinSeedfillBandHeight rows.
+ * </pre>
+ */
+PIX *
+pixSeedfillBinaryBands(PIX     *pixd,
+                       PIX     *pixs,
+                       PIX     *pixm,
+                       l_int32  connectivity,
+                       l_int32  nbands)
+{
+l_int32    i, k, h, bh, wpl, wpld, wplm, ndirty, changed;
+l_int32   *dirty;
+l_uint32  *datad, *datam;
+
+    if (!pixs || pixGetDepth(pixs) != 1)
+        return (PIX *)ERROR_PTR("pixs undefined or not 1 bpp", __func__, pixd);
+    if (!pixm || pixGetDepth(pixm) != 1)
+        return (PIX *)ERROR_PTR("pixm undefined or not 1 bpp", __func__, pixd);
+    if (connectivity != 4 && connectivity != 8)
+        return (PIX *)ERROR_PTR("connectivity not in {4,8}", __func__, pixd);
+
+    if ((pixd = pixCopy(pixd, pixs)) == NULL)
+        return (PIX *)ERROR_PTR("pixd not made", __func__, NULL);
+    pixSetPadBits(pixd, 0);
+    pixSetPadBits(pixm, 0);
+
+    h = L_MIN(pixGetHeight(pixd), pixGetHeight(pixm));
+    datad = pixGetData(pixd);
+    datam = pixGetData(pixm);
+    wpld = pixGetWpl(pixd);
+    wplm = pixGetWpl(pixm);
+    wpl = L_MIN(wpld, wplm);
+
+    if (nbands <= 0) {
+#ifdef _OPENMP
+        nbands = omp_get_max_threads();
+#else
+        nbands = 1;
+#endif  /* _OPENMP */
+    }
+    nbands = L_MAX(1, L_MIN(nbands, h / MinSeedfillBandHeight));
+    bh = (h + nbands - 1) / nbands;
+    nbands = (h + bh - 1) / bh;
+    if ((dirty = (l_int32 *)LEPT_CALLOC(nbands, sizeof(l_int32))) == NULL)
+        return (PIX *)ERROR_PTR("dirty not made", __func__, pixd);
+    for (k = 0; k < nbands; k++)
+        dirty[k] = 1;
+
+    for (i = 0, ndirty = nbands; ndirty > 0; i++) {
+            /* Fill the bands that have changed */
+#ifdef _OPENMP
+#pragma omp parallel for if (ndirty > 1)
+#endif  /* _OPENMP */
+        for (k = 0; k < nbands; k++) {
+            l_int32  y0, nrows;
+            if (!dirty[k]) continue;
+            y0 = k * bh;
+            nrows = L_MIN(h, y0 + bh) - y0;
+            while (seedfillBinaryLow(datad + (size_t)y0 * wpld, nrows, wpld,
+                                     datam + (size_t)y0 * wplm, nrows, wplm,
+                                     connectivity))
+                ;
+            dirty[k] = 0;
+        }
+
+            /* Propagate across the band boundaries */
+        ndirty = 0;
+        for (k = 1; k < nbands; k++) {
+            changed = seedfillBinaryAcrossLow(
+                          datad + (size_t)(k * bh - 1) * wpld,
+                          datad + (size_t)k * bh * wpld,
+                          datam + (size_t)(k * bh - 1) * wplm,
+                          datam + (size_t)k * bh * wplm, wpl, connectivity);
+            if (changed & 1) dirty[k - 1] = 1;
+            if (changed & 2) dirty[k] = 1;
+        }
+        for (k = 0; k < nbands; k++)
+            ndirty += dirty[k];
+    }
+#if DEBUG_PRINT_ITERS
+    lept_stderr("Banded binary seed fill: %d bands, %d rounds\n", nbands, i);
+#endif  /* DEBUG_PRINT_ITERS */
+
+    LEPT_FREE(dirty);
     return pixd;
 }
 
@@ -394,8 +536,11 @@ PIX     *pix1, *pix2;
  *      (3) Assume that the RHS pad bits of the mask
  *          are properly set to 0.
  *      (4) Clip to the smallest dimensions to avoid invalid reads.
+ *      (5) Returns 1 if any pixel in datas was changed, 0 otherwise.
+ *          This replaces a copy and compare of the whole image to
+ *          test for convergence.
  */
-static void
+static l_int32
 seedfillBinaryLow(l_uint32  *datas,
                   l_int32    hs,
                   l_int32    wpls,
@@ -408,10 +553,12 @@ l_int32    i, j, h, wpl;
 l_uint32   word, mask;
 l_uint32   wordabove, wordleft, wordbelow, wordright;
 l_uint32   wordprev;  /* test against this in previous iteration */
+l_uint32   diff;  /* accumulates the changed bits */
 l_uint32  *lines, *linem;
 
     h = L_MIN(hs, hm);
     wpl = L_MIN(wpls, wplm);
+    diff = 0;
 
     switch (connectivity)
     {
@@ -437,6 +584,7 @@ l_uint32  *lines, *linem;
 
                     /* No need to fill horizontally? */
                 if (!word || !(~word)) {
+                    diff |= word ^ *(lines + j);
                     *(lines + j) = word;
                     continue;
                 }
@@ -445,6 +593,7 @@ l_uint32  *lines, *linem;
                     wordprev = word;
                     word = (word | (word >> 1) | (word << 1)) & mask;
                     if ((word ^ wordprev) == 0) {
+                        diff |= word ^ *(lines + j);
                         *(lines + j) = word;
                         break;
                     }
@@ -473,6 +622,7 @@ l_uint32  *lines, *linem;
 
                     /* No need to fill horizontally? */
                 if (!word || !(~word)) {
+                    diff |= word ^ *(lines + j);
                     *(lines + j) = word;
                     continue;
                 }
@@ -481,6 +631,7 @@ l_uint32  *lines, *linem;
                     wordprev = word;
                     word = (word | (word >> 1) | (word << 1)) & mask;
                     if ((word ^ wordprev) == 0) {
+                        diff |= word ^ *(lines + j);
                         *(lines + j) = word;
                         break;
                     }
@@ -515,6 +666,7 @@ l_uint32  *lines, *linem;
 
                     /* No need to fill horizontally? */
                 if (!word || !(~word)) {
+                    diff |= word ^ *(lines + j);
                     *(lines + j) = word;
                     continue;
                 }
@@ -523,6 +675,7 @@ l_uint32  *lines, *linem;
                     wordprev = word;
                     word = (word | (word >> 1) | (word << 1)) & mask;
                     if ((word ^ wordprev) == 0) {
+                        diff |= word ^ *(lines + j);
                         *(lines + j) = word;
                         break;
                     }
@@ -555,6 +708,7 @@ l_uint32  *lines, *linem;
 
                     /* No need to fill horizontally? */
                 if (!word || !(~word)) {
+                    diff |= word ^ *(lines + j);
                     *(lines + j) = word;
                     continue;
                 }
@@ -563,6 +717,7 @@ l_uint32  *lines, *linem;
                     wordprev = word;
                     word = (word | (word >> 1) | (word << 1)) & mask;
                     if ((word ^ wordprev) == 0) {
+                        diff |= word ^ *(lines + j);
                         *(lines + j) = word;
                         break;
                     }
@@ -574,6 +729,63 @@ l_uint32  *lines, *linem;
     default:
         L_ERROR("connectivity must be 4 or 8\n", __func__);
     }
+    return (diff != 0);
+}
+
+
+/*!
+ * \brief   seedfillBinaryAcrossLow()
+ *
+ * \param[in]    linea     last row of the band above
+ * \param[in]    lineb     first row of the band below
+ * \param[in]    linema    mask row for linea
+ * \param[in]    linemb    mask row for lineb
+ * \param[in]    wpl       words to use in each row
+ * \param[in]    connectivity  4 or 8
+ * \return  1 if linea changed, plus 2 if lineb changed
+ *
+ * <pre>
+ * Notes:
+ *      (1) This moves the fill one pixel down across a band boundary,
+ *          and then one pixel up.  Horizontal filling within the rows
+ *          is left to seedfillBinaryLow() on the bands.
+ * </pre>
+ */
+static l_int32
+seedfillBinaryAcrossLow(l_uint32  *linea,
+                        l_uint32  *lineb,
+                        l_uint32  *linema,
+                        l_uint32  *linemb,
+                        l_int32    wpl,
+                        l_int32    connectivity)
+{
+l_int32    j, pass, ret;
+l_uint32   word, src, diff;
+l_uint32  *lines, *lined, *linem;
+
+    ret = 0;
+    for (pass = 0; pass < 2; pass++) {
+        lines = (pass == 0) ? linea : lineb;
+        lined = (pass == 0) ? lineb : linea;
+        linem = (pass == 0) ? linemb : linema;
+        diff = 0;
+        for (j = 0; j < wpl; j++) {
+            src = lines[j];
+            if (connectivity == 8) {
+                src |= (lines[j] << 1) | (lines[j] >> 1);
+                if (j > 0)
+                    src |= lines[j - 1] << 31;
+                if (j < wpl - 1)
+                    src |= lines[j + 1] >> 31;
+            }
+            word = (lined[j] | src) & linem[j];
+            diff |= word ^ lined[j];
+            lined[j] = word;
+        }
+        if (diff)
+            ret |= (pass == 0) ? 2 : 1;
+    }
+    return ret;
 }
 
 
@@ -58,6 +58,7 @@
  *
  *      Other structuring elements
  *          SEL    *selMakePlusSign()
+ *          SEL    *selMakeDisk()
  * </pre>
  */
 
@@ -883,3 +884,41 @@ SEL  *sel;
     pixDestroy(&pix);
     return sel;
 }
+
+
+/*!
+ * \brief   selMakeDisk()
+ *
+ * \param[in]    radius     >= 1
+ * \return  sel, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The Sel is (2 * radius + 1) on a side, with the origin at
+ *          the center.  Hits are at distance <= radius from the origin.
+ *      (2) This is useful as a flat isotropic Sel for grayscale
+ *          morphology; see pixDilateGraySel().
+ * </pre>
+ */
+SEL *
+selMakeDisk(l_int32  radius)
+{
+l_int32  i, j, size;
+SEL     *sel;
+
+    if (radius < 1)
+        return (SEL *)ERROR_PTR("radius < 1", __func__, NULL);
+
+    size = 2 * radius + 1;
+    if ((sel = selCreate(size, size, "disk")) == NULL)
+        return (SEL *)ERROR_PTR("sel not made", __func__, NULL);
+    selSetOrigin(sel, radius, radius);
+    for (i = 0; i < size; i++) {
+        for (j = 0; j < size; j++) {
+            if ((i - radius) * (i - radius) + (j - radius) * (j - radius) <=
+                radius * radius)
+                selSetElement(sel, i, j, SEL_HIT);
+        }
+    }
+    return sel;
+}
@@ -35,6 +35,7 @@
  *
  *      Reading spix from file
  *           PIX        *pixReadStreamSpix()
+ *           PIX        *pixReadSpixMapped()
  *           l_int32     readHeaderSpix()
  *           l_int32     freadHeaderSpix()
  *           l_int32     sreadHeaderSpix()
@@ -47,6 +48,7 @@
  *           l_int32     pixWriteMemSpix()
  *           l_int32     pixSerializeToMemory()
  *           PIX        *pixDeserializeFromMemory()
+ *           static PIX *pixDeserializeInternal()
  *
  *    Note: these functions have not been extensively tested for fuzzing
  *    (bad input data that can result in, e.g., memory faults).
@@ -72,6 +74,9 @@ static const l_int64  MaxAllowedArea = 400000000LL;
 #define  DEBUG_SERIALIZE      0
 #endif  /* ~NO_CONSOLE_IO */
 
+static PIX *pixDeserializeInternal(const l_uint32 *data, size_t nbytes,
+                                   l_uint8 *mapdata);
+
 
 /*-----------------------------------------------------------------------*
  *                          Reading spix from file                       *
@@ -108,6 +113,52 @@ PIX      *pix;
 }
 
 
+/*!
+ * \brief   pixReadSpixMapped()
+ *
+ * \param[in]    filename    spix file
+ * \return  pix, or NULL on error.
+ *
+ * <pre>
+ * Notes:
+ *      (1) The raster data in a spix file is stored exactly as in the
+ *          pix, so instead of reading the file, this maps it into memory
+ *          and returns a pix whose data is in the mapping.  No image
+ *          data is copied; it is paged in from the file as it is used.
+ *          This is much faster for large images that are only partly
+ *          used, or that are read many times.
+ *      (2) The mapping is copy-on-write (see l_binaryMapPrivate()), so
+ *          the pix can be used like any other pix, and the file is
+ *          never changed.  The file must not be changed by another
+ *          process while the pix exists.
+ *      (3) The mapping is released when the pix is destroyed.
+ *          See pixSetMappedData() for details.
+ *      (4) Because the serialization is in native byte order, the file
+ *          must have been written on a machine with the same endianness.
+ * </pre>
+ */
+PIX *
+pixReadSpixMapped(const char  *filename)
+{
+size_t    nbytes;
+l_uint8  *mapdata;
+PIX      *pix;
+
+    if (!filename)
+        return (PIX *)ERROR_PTR("filename not defined", __func__, NULL);
+
+    if ((mapdata = l_binaryMapPrivate(filename, &nbytes)) == NULL)
+        return (PIX *)ERROR_PTR_1("file not mapped", filename, __func__, NULL);
+    if ((pix = pixDeserializeInternal((l_uint32 *)mapdata, nbytes,
+                                      mapdata)) == NULL) {
+        l_binaryUnmap(&mapdata, nbytes);
+        return (PIX *)ERROR_PTR_1("pix not made", filename, __func__, NULL);
+    }
+    pixSetInputFormat(pix, IFF_SPIX);
+    return pix;
+}
+
+
 /*!
  * \brief   readHeaderSpix()
  *
@@ -423,6 +474,30 @@ PIXCMAP   *cmap;
 PIX *
 pixDeserializeFromMemory(const l_uint32  *data,
                          size_t           nbytes)
+{
+    return pixDeserializeInternal(data, nbytes, NULL);
+}
+
+
+/*!
+ * \brief   pixDeserializeInternal()
+ *
+ * \param[in]    data      serialized data in memory
+ * \param[in]    nbytes    number of bytes in data string
+ * \param[in]    mapdata   [optional] file mapping that holds %data
+ * \return  pix, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) If %mapdata is given, the raster data is not copied; the
+ *          returned pix takes ownership of the mapping, with its
+ *          data in the mapping.  On error, the caller still owns it.
+ * </pre>
+ */
+static PIX *
+pixDeserializeInternal(const l_uint32  *data,
+                       size_t           nbytes,
+                       l_uint8         *mapdata)
 {
 char      *id;
 l_int32    w, h, d, pixdata_size, memdata_size, imdata_size, ncolors, valid;
@@ -467,7 +542,11 @@ PIXCMAP   *cmap = NULL;
         return NULL;
     }
 
-    if ((pixd = pixCreate(w, h, d)) == NULL)
+    if (mapdata)  /* the data will be in the mapping */
+        pixd = pixCreateHeader(w, h, d);
+    else
+        pixd = pixCreate(w, h, d);
+    if (!pixd)
         return (PIX *)ERROR_PTR("pix not made", __func__, NULL);
     if (ncolors > 0) {
         cmap = pixcmapDeserializeFromMemory((l_uint8 *)(&data[6]), 4, ncolors);
@@ -481,19 +560,35 @@ PIXCMAP   *cmap = NULL;
         }
     }
 
-        /* Read the raster data */
-    imdata = pixGetData(pixd);
-    memcpy(imdata, data + 7 + ncolors, imdata_size);
+        /* Read the raster data.  Data in a mapping is used where it is,
+         * and is not owned by the pix until the checks are done. */
+    if (mapdata) {
+        pixSetData(pixd, (l_uint32 *)(data + 7 + ncolors));
+    } else {
+        imdata = pixGetData(pixd);
+        memcpy(imdata, data + 7 + ncolors, imdata_size);
+    }
 
         /* Verify that the colormap is valid with the pix */
     if (ncolors > 0) {
         pixcmapIsValid(cmap, pixd, &valid);
         if (!valid) {
+            if (mapdata) pixSetData(pixd, NULL);
             pixDestroy(&pixd);
             return (PIX *)ERROR_PTR("cmap is invalid with pix", __func__, NULL);
         }
     }
 
+        /* The pix takes ownership of the mapping */
+    if (mapdata) {
+        pixSetData(pixd, NULL);
+        if (pixSetMappedData(pixd, (l_uint32 *)(data + 7 + ncolors),
+                             mapdata, nbytes)) {
+            pixDestroy(&pixd);
+            return (PIX *)ERROR_PTR("mapped data not set", __func__, NULL);
+        }
+    }
+
 #if  DEBUG_SERIALIZE
     lept_stderr("Deserialize: "
                 "raster size = %d, ncolors in cmap = %d, total bytes = %zu\n",
@@ -46,6 +46,8 @@
  *             l_int32    pixWriteStreamTiff()
  *             l_int32    pixWriteStreamTiffWA()
  *      static l_int32    pixWriteToTiffStream()
+ *      static l_int32    tiffSetImageFields()
+ *      static l_int32    tiffWriteRows()
  *      static l_int32    writeCustomTiffTags()
  *
  *     Reading and writing multipage tiff
@@ -55,6 +57,32 @@
  *             l_int32    writeMultipageTiff()      [ special top level ]
  *             l_int32    writeMultipageTiffSA()
  *
+ *     Reading and writing tiff by bands
+ *             L_TIFF_READER  *tiffReaderOpen()
+ *             void            tiffReaderClose()
+ *             l_int32         tiffReaderGetInfo()
+ *             PIX            *tiffReaderReadBand()
+ *             L_TIFF_WRITER  *tiffWriterOpen()
+ *             l_int32         tiffWriterWriteBand()
+ *             l_int32         tiffWriterClose()
+ *             l_int32         tiffProcessBands()
+ *
+ *     Page index for random access to multipage tiff
+ *             L_TIFF_INDEX   *tiffIndexCreate()
+ *             L_TIFF_INDEX   *tiffIndexCreateMem()
+ *      static L_TIFF_INDEX   *tiffIndexBuild()
+ *             void            tiffIndexDestroy()
+ *             l_int32         tiffIndexGetCount()
+ *             l_int32         tiffIndexGetPageInfo()
+ *             L_TIFF_INDEX   *tiffIndexRead()
+ *             L_TIFF_INDEX   *tiffIndexReadStream()
+ *             l_int32         tiffIndexWrite()
+ *             l_int32         tiffIndexWriteStream()
+ *             PIX            *pixReadTiffIndexed()
+ *             PIX            *pixReadStreamTiffIndexed()
+ *             PIX            *pixReadMemTiffIndexed()
+ *      static TIFF           *tiffIndexSeek()
+ *
  *     Information about tiff file
  *             l_int32    fprintTiffInfo()
  *             l_int32    tiffGetCount()
@@ -155,6 +183,12 @@ static const l_int32  MaxTiffHeight = 1 << 20;  /* 1M pixels */
     /* Check g4 data size */
 static const size_t  MaxNumTiffBytes = (1 << 28) - 1;  /* 256 MB */
 
+    /* Maximum number of rows in a band, when reading strips by scanline */
+static const l_int32  MaxBandRows = 256;
+
+    /* Maximum number of pages in a serialized page index */
+static const l_int32  MaxTiffIndexPages = 10000000;
+
     /* All functions with TIFF interfaces are static. */
 static PIX      *pixReadFromTiffStream(TIFF *tif);
 static l_int32   getTiffStreamResolution(TIFF *tif, l_int32 *pxres,
@@ -169,8 +203,13 @@ static l_int32   writeCustomTiffTags(TIFF *tif, NUMA *natags,
 static l_int32   pixWriteToTiffStream(TIFF *tif, PIX *pix, l_int32 comptype,
                                       NUMA *natags, SARRAY *savals,
                                       SARRAY *satypes, NUMA *nasizes);
+static l_int32   tiffSetImageFields(TIFF *tif, PIX *pix, l_int32 h,
+                                    l_int32 comptype);
+static l_int32   tiffWriteRows(TIFF *tif, PIX *pix, l_int32 row0);
 static TIFF     *fopenTiff(FILE *fp, const char *modestring);
 static TIFF     *openTiff(const char *filename, const char *modestring);
+static L_TIFF_INDEX  *tiffIndexBuild(TIFF *tif, size_t size);
+static TIFF     *tiffIndexSeek(TIFF *tif, L_TIFF_INDEX *tidx, l_int32 n);
 
     /* Static helper for tiff compression type */
 static l_int32   getTiffCompressedFormat(l_uint16 tiffcomp);
@@ -1037,15 +1076,7 @@ pixWriteToTiffStream(TIFF    *tif,
                      SARRAY  *satypes,
                      NUMA    *nasizes)
 {
-l_uint8   *linebuf, *data;
-l_uint16   redmap[256], greenmap[256], bluemap[256];
-l_int32    w, h, d, spp, i, j, k, wpl, bpl, tiffbpl, ncolors, cmapsize;
-l_int32   *rmap, *gmap, *bmap;
-l_int32    xres, yres;
-l_uint32  *line, *ppixel;
-PIX       *pixt;
-PIXCMAP   *cmap;
-char      *text;
+l_int32  h;
 
     if (!tif)
         return ERROR_INT("tif stream not defined", __func__, 1);
@@ -1053,14 +1084,60 @@ char      *text;
         return ERROR_INT( "pix not defined", __func__, 1 );
 
     pixSetPadBits(pix, 0);
-    pixGetDimensions(pix, &w, &h, &d);
+    h = pixGetHeight(pix);
+
+        /* ------------------ Write out the header -------------  */
+    tiffSetImageFields(tif, pix, h, comptype);
+
+        /* This is a no-op if arrays are NULL */
+    writeCustomTiffTags(tif, natags, savals, satypes, nasizes);
+
+        /* ------------- Write out the image data -------------  */
+        /* Use single strip for image */
+    TIFFSetField(tif, TIFFTAG_ROWSPERSTRIP, h);
+    tiffWriteRows(tif, pix, 0);
+
+/*    TIFFWriteDirectory(tif); */
+    return 0;
+}
+
+
+/*!
+ * \brief   tiffSetImageFields()
+ *
+ * \param[in]    tif
+ * \param[in]    pix        the image, or the first band of the image
+ * \param[in]    h          height of the full image
+ * \param[in]    comptype   see pixWriteToTiffStream()
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) Sets all the tags that describe the image, except for the
+ *          custom tags and the rows per strip.  The depth, colormap,
+ *          resolution and text are taken from %pix.
+ * </pre>
+ */
+static l_int32
+tiffSetImageFields(TIFF    *tif,
+                   PIX     *pix,
+                   l_int32  h,
+                   l_int32  comptype)
+{
+l_uint16   redmap[256], greenmap[256], bluemap[256];
+l_int32    w, d, spp, i, ncolors, cmapsize;
+l_int32   *rmap, *gmap, *bmap;
+l_int32    xres, yres;
+PIXCMAP   *cmap;
+char      *text;
+
+    pixGetDimensions(pix, &w, NULL, &d);
     spp = pixGetSpp(pix);
     xres = pixGetXRes(pix);
     yres = pixGetYRes(pix);
     if (xres == 0) xres = DefaultResolution;
     if (yres == 0) yres = DefaultResolution;
 
-        /* ------------------ Write out the header -------------  */
     TIFFSetField(tif, TIFFTAG_RESOLUTIONUNIT, (l_uint32)RESUNIT_INCH);
     TIFFSetField(tif, TIFFTAG_XRESOLUTION, (l_float64)xres);
     TIFFSetField(tif, TIFFTAG_YRESOLUTION, (l_float64)yres);
@@ -1185,11 +1262,36 @@ char      *text;
 		L_WARNING("unknown tiff compression; using none\n", __func__);
         TIFFSetField(tif, TIFFTAG_COMPRESSION, COMPRESSION_NONE);
     }
+    return 0;
+}
 
-        /* This is a no-op if arrays are NULL */
-    writeCustomTiffTags(tif, natags, savals, satypes, nasizes);
 
-        /* ------------- Write out the image data -------------  */
+/*!
+ * \brief   tiffWriteRows()
+ *
+ * \param[in]    tif
+ * \param[in]    pix       the image, or a band of the image
+ * \param[in]    row0      row in the tiff image of the first row of %pix
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The fields of %tif must have been set, with
+ *          tiffSetImageFields(), from a pix of the same depth and spp.
+ * </pre>
+ */
+static l_int32
+tiffWriteRows(TIFF    *tif,
+              PIX     *pix,
+              l_int32  row0)
+{
+l_uint8   *linebuf, *data;
+l_int32    w, h, d, spp, i, j, k, wpl, bpl, tiffbpl;
+l_uint32  *line, *ppixel;
+PIX       *pixt;
+
+    pixGetDimensions(pix, &w, &h, &d);
+    spp = pixGetSpp(pix);
     tiffbpl = TIFFScanlineSize(tif);
     wpl = pixGetWpl(pix);
     bpl = 4 * wpl;
@@ -1198,9 +1300,6 @@ char      *text;
     if ((linebuf = (l_uint8 *)LEPT_CALLOC(1, bpl)) == NULL)
         return ERROR_INT("calloc fail for linebuf", __func__, 1);
 
-        /* Use single strip for image */
-    TIFFSetField(tif, TIFFTAG_ROWSPERSTRIP, h);
-
     if (d != 24 && d != 32) {
         if (d == 16)
             pixt = pixEndianTwoByteSwapNew(pix);
@@ -1209,14 +1308,14 @@ char      *text;
         data = (l_uint8 *)pixGetData(pixt);
         for (i = 0; i < h; i++, data += bpl) {
             memcpy(linebuf, data, tiffbpl);
-            if (TIFFWriteScanline(tif, linebuf, i, 0) < 0)
+            if (TIFFWriteScanline(tif, linebuf, row0 + i, 0) < 0)
                 break;
         }
         pixDestroy(&pixt);
-    } else if (d == 24) {  /* See note 4 above: special case of 24 bpp rgb */
+    } else if (d == 24) {  /* see pixWriteToTiffStream(), note 4 */
         for (i = 0; i < h; i++) {
             line = pixGetData(pix) + i * wpl;
-            if (TIFFWriteScanline(tif, (l_uint8 *)line, i, 0) < 0)
+            if (TIFFWriteScanline(tif, (l_uint8 *)line, row0 + i, 0) < 0)
                 break;
         }
     } else {  /* 32 bpp rgb or rgba */
@@ -1230,14 +1329,14 @@ char      *text;
                     linebuf[k++] = GET_DATA_BYTE(ppixel, L_ALPHA_CHANNEL);
                 ppixel++;
             }
-            if (TIFFWriteScanline(tif, linebuf, i, 0) < 0)
+            if (TIFFWriteScanline(tif, linebuf, row0 + i, 0) < 0)
                 break;
         }
     }
 
-/*    TIFFWriteDirectory(tif); */
     LEPT_FREE(linebuf);
-
+    if (i < h)
+        return ERROR_INT("scanline write failed", __func__, 1);
     return 0;
 }
 
@@ -1632,6 +1731,1300 @@ PIX         *pix;
 }
 
 
+/*--------------------------------------------------------------*
+ *               Reading and writing tiff by bands              *
+ *--------------------------------------------------------------*/
+/*  These read and write a tiff image as a sequence of bands of
+ *  full-width rows, so that an image that is too large to hold
+ *  in memory can be processed with bounded memory.  The reader uses
+ *  the strips or tiles of the file: a band is a strip, or a row of
+ *  tiles, so that each part of the file is decoded once.  The writer
+ *  writes the rows of each band as they are given; the tiff library
+ *  only holds one strip at a time.  */
+
+/*!
+ * \brief   Band reader for a page of a tiff file
+ *
+ *  The packed samples of the rows in a band are read into %rawbuf,
+ *  either with TIFFReadScanline() for strips or with TIFFReadTile()
+ *  for tiles, and converted to the pix in the same way as in
+ *  pixReadFromTiffStream().  Images that pixReadFromTiffStream()
+ *  reads with TIFFReadRGBAImageOriented() are read here a strip or
+ *  a tile at a time into %rgbabuf, and %rgba is set.
+ */
+struct L_TiffReader
+{
+    FILE      *fp;        /* file stream for the tiff file                */
+    TIFF      *tif;       /* tiff handle, on the requested page           */
+    l_int32    w;         /* image width                                  */
+    l_int32    h;         /* image height                                 */
+    l_int32    d;         /* depth of the pix in each band                */
+    l_int32    spp;       /* samples/pixel in the file                    */
+    l_int32    bps;       /* bits/sample in the file                      */
+    l_int32    tiled;     /* 1 if the image is stored in tiles            */
+    l_int32    tilew;     /* tile width, if tiled                         */
+    l_int32    tileh;     /* tile height, if tiled                        */
+    l_int32    rgba;      /* 1 if read with the RGBA interface            */
+    l_int32    invert;    /* 1 if the photometry requires inversion       */
+    l_int32    bandh;     /* number of rows in each band except the last  */
+    l_int32    nextrow;   /* first row of the next band                   */
+    l_int32    rawbpl;    /* bytes of packed samples in each row          */
+    l_int32    xres;      /* x resolution, ppi; 0 if unknown              */
+    l_int32    yres;      /* y resolution, ppi; 0 if unknown              */
+    l_int32    format;    /* input format, from the compression type      */
+    PIXCMAP   *cmap;      /* colormap, if any                             */
+    l_uint8   *rawbuf;    /* packed samples for the rows of one band      */
+    l_uint8   *tilebuf;   /* packed samples for one tile                  */
+    l_uint32  *rgbabuf;   /* abgr raster for one strip or tile            */
+};
+
+/*!
+ * \brief   Band writer for a tiff file
+ *
+ *  The image fields are set from the first band that is written;
+ *  each later band must have the same width, depth and spp.
+ */
+struct L_TiffWriter
+{
+    TIFF      *tif;       /* tiff handle                                  */
+    l_int32    comptype;  /* requested compression                        */
+    l_int32    w;         /* image width, from the first band             */
+    l_int32    h;         /* image height                                 */
+    l_int32    d;         /* depth, from the first band                   */
+    l_int32    spp;       /* samples/pixel, from the first band           */
+    l_int32    nextrow;   /* first row of the next band                   */
+};
+
+
+/*!
+ * \brief   tiffReaderOpen()
+ *
+ * \param[in]    filename
+ * \param[in]    n           page number 0 based
+ * \return  reader, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This opens page %n of a tiff file for reading by bands with
+ *          tiffReaderReadBand().  The same images can be read as with
+ *          pixReadTiff(), and tiled images can also be read.  The
+ *          pixels in the bands are the same as in the pix returned
+ *          by pixReadTiff().
+ *      (2) The height is not limited, because the full image is never
+ *          in memory.  Memory use is proportional to the width times
+ *          the band height.
+ *      (3) Orientations other than ORIENTATION_TOPLEFT require the full
+ *          image to transform, and are rejected; use pixReadTiff().
+ *      (4) For rgba, and for rgb that is not 8 bps and interleaved,
+ *          the tiff library converts a strip or tile at a time.
+ *          If such an image is written as a single strip, the band is
+ *          the full image.
+ * </pre>
+ */
+L_TIFF_READER *
+tiffReaderOpen(const char  *filename,
+               l_int32      n)
+{
+l_uint16        spp, bps, photometry, tiffcomp, sample_fmt, planar;
+l_uint16        orientation;
+l_uint16       *redmap, *greenmap, *bluemap;
+l_int32         i, ncolors, packedbpl;
+l_uint32        w, h, val;
+FILE           *fp;
+TIFF           *tif;
+L_TIFF_READER  *reader;
+
+    if (!filename)
+        return (L_TIFF_READER *)ERROR_PTR("filename not defined",
+                                          __func__, NULL);
+
+    if ((fp = fopenReadStream(filename)) == NULL)
+        return (L_TIFF_READER *)ERROR_PTR_1("image file not found",
+                                            filename, __func__, NULL);
+    if ((tif = fopenTiff(fp, "r")) == NULL) {
+        fclose(fp);
+        return (L_TIFF_READER *)ERROR_PTR("tif not opened", __func__, NULL);
+    }
+    if (TIFFSetDirectory(tif, n) == 0) {
+        TIFFCleanup(tif);
+        fclose(fp);
+        return (L_TIFF_READER *)ERROR_PTR("page not found", __func__, NULL);
+    }
+
+    reader = (L_TIFF_READER *)LEPT_CALLOC(1, sizeof(L_TIFF_READER));
+    reader->fp = fp;
+    reader->tif = tif;
+
+        /* Same restrictions as in pixReadFromTiffStream(), except for
+         * tiles and the image height */
+    TIFFGetFieldDefaulted(tif, TIFFTAG_SAMPLEFORMAT, &sample_fmt);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_COMPRESSION, &tiffcomp);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_BITSPERSAMPLE, &bps);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_SAMPLESPERPIXEL, &spp);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_PLANARCONFIG, &planar);
+    TIFFGetField(tif, TIFFTAG_IMAGEWIDTH, &w);
+    TIFFGetField(tif, TIFFTAG_IMAGELENGTH, &h);
+    if (sample_fmt != SAMPLEFORMAT_UINT) {
+        L_ERROR("sample format = %d is not uint\n", __func__, sample_fmt);
+        tiffReaderClose(&reader);
+        return NULL;
+    }
+    if (tiffcomp == COMPRESSION_OJPEG) {
+        L_ERROR("old style jpeg format is not supported\n", __func__);
+        tiffReaderClose(&reader);
+        return NULL;
+    }
+#if defined(COMPRESSION_WEBP)
+    if (tiffcomp == COMPRESSION_WEBP) {
+        L_ERROR("webp in tiff not generally supported yet\n", __func__);
+        tiffReaderClose(&reader);
+        return NULL;
+    }
+#endif  /* COMPRESSION_WEBP */
+    if ((bps != 1 && bps != 2 && bps != 4 && bps != 8 && bps != 16) ||
+        spp < 1 || spp > 4 || (spp == 2 && bps != 8) ||
+        (spp > 2 && bps < 8)) {
+        L_ERROR("unsupported: bps = %d, spp = %d\n", __func__, bps, spp);
+        tiffReaderClose(&reader);
+        return NULL;
+    }
+    if (w == 0 || h == 0 || w > MaxTiffWidth) {
+        L_ERROR("invalid width = %d or height = %d\n", __func__, w, h);
+        tiffReaderClose(&reader);
+        return NULL;
+    }
+    if (TIFFGetField(tif, TIFFTAG_ORIENTATION, &orientation) &&
+        orientation != ORIENTATION_TOPLEFT) {
+        L_ERROR("orientation %d requires the full image\n", __func__,
+                orientation);
+        tiffReaderClose(&reader);
+        return NULL;
+    }
+    reader->w = w;
+    reader->h = h;
+    reader->spp = spp;
+    reader->bps = bps;
+    reader->d = (spp == 1) ? bps : 32;
+
+        /* As in pixReadFromTiffStream(), rgb and rgba go through the
+         * RGBA interface, except for the common case of 8 bps rgb,
+         * which is read directly. */
+    if (!TIFFGetField(tif, TIFFTAG_PHOTOMETRIC, &photometry)) {
+        if (tiffcomp == COMPRESSION_CCITTFAX3 ||
+            tiffcomp == COMPRESSION_CCITTFAX4 ||
+            tiffcomp == COMPRESSION_CCITTRLE ||
+            tiffcomp == COMPRESSION_CCITTRLEW) {
+            photometry = PHOTOMETRIC_MINISWHITE;
+        } else {
+            photometry = PHOTOMETRIC_MINISBLACK;
+        }
+    }
+    if (spp >= 3) {
+        if (spp == 4 || bps != 8 || planar != PLANARCONFIG_CONTIG ||
+            photometry != PHOTOMETRIC_RGB)
+            reader->rgba = 1;
+    } else if (spp == 2 && planar != PLANARCONFIG_CONTIG) {
+        L_ERROR("gray+alpha must be interleaved\n", __func__);
+        tiffReaderClose(&reader);
+        return NULL;
+    }
+
+        /* Band height, and buffers for one band */
+    reader->tiled = TIFFIsTiled(tif);
+    packedbpl = (bps * spp * w + 7) / 8;
+    reader->rawbpl = packedbpl;
+    if (reader->tiled) {
+        TIFFGetField(tif, TIFFTAG_TILEWIDTH, &val);
+        reader->tilew = val;
+        TIFFGetField(tif, TIFFTAG_TILELENGTH, &val);
+        reader->tileh = val;
+        if (reader->tilew <= 0 || reader->tileh <= 0 ||
+            (!reader->rgba &&
+             TIFFTileRowSize(tif) != (bps * spp * reader->tilew + 7) / 8)) {
+            L_ERROR("invalid tile size\n", __func__);
+            tiffReaderClose(&reader);
+            return NULL;
+        }
+        reader->bandh = reader->tileh;
+        if (reader->rgba)
+            reader->rgbabuf = (l_uint32 *)LEPT_CALLOC(
+                     (size_t)reader->tilew * reader->tileh, sizeof(l_uint32));
+        else
+            reader->tilebuf = (l_uint8 *)LEPT_CALLOC(TIFFTileSize(tif), 1);
+    } else {
+        if (!TIFFGetField(tif, TIFFTAG_ROWSPERSTRIP, &val) || val > h)
+            val = h;
+        if (reader->rgba) {
+            reader->bandh = val;  /* must be a strip */
+            reader->rgbabuf = (l_uint32 *)LEPT_CALLOC((size_t)w * val,
+                                                      sizeof(l_uint32));
+        } else {
+            reader->bandh = L_MIN(L_MAX(val, 1), MaxBandRows);
+            if (TIFFScanlineSize(tif) != packedbpl) {
+                L_ERROR("invalid tiffbpl = %d; packedbpl = %d\n", __func__,
+                        (l_int32)TIFFScanlineSize(tif), packedbpl);
+                tiffReaderClose(&reader);
+                return NULL;
+            }
+        }
+    }
+    if (!reader->rgba)
+        reader->rawbuf = (l_uint8 *)LEPT_CALLOC(
+                              (size_t)reader->bandh * packedbpl + 4, 1);
+    if ((reader->rgba && !reader->rgbabuf) ||
+        (!reader->rgba && !reader->rawbuf) ||
+        (reader->tiled && !reader->rgba && !reader->tilebuf)) {
+        tiffReaderClose(&reader);
+        return (L_TIFF_READER *)ERROR_PTR("band buffers not made",
+                                          __func__, NULL);
+    }
+
+        /* Colormap or inversion; see pixReadFromTiffStream() */
+    if (TIFFGetField(tif, TIFFTAG_COLORMAP, &redmap, &greenmap, &bluemap)) {
+        if (bps > 8) {
+            tiffReaderClose(&reader);
+            return (L_TIFF_READER *)ERROR_PTR("colormap size > 256",
+                                              __func__, NULL);
+        }
+        reader->cmap = pixcmapCreate(bps);
+        ncolors = 1 << bps;
+        for (i = 0; i < ncolors; i++)
+            pixcmapAddColor(reader->cmap, redmap[i] >> 8, greenmap[i] >> 8,
+                            bluemap[i] >> 8);
+    } else if ((reader->d == 1 && photometry == PHOTOMETRIC_MINISBLACK) ||
+               (reader->d == 8 && photometry == PHOTOMETRIC_MINISWHITE)) {
+        reader->invert = 1;
+    }
+
+    getTiffStreamResolution(tif, &reader->xres, &reader->yres);
+    reader->format = getTiffCompressedFormat(tiffcomp);
+    return reader;
+}
+
+
+/*!
+ * \brief   tiffReaderClose()
+ *
+ * \param[in,out]   preader   will be set to null before returning
+ * \return  void
+ */
+void
+tiffReaderClose(L_TIFF_READER  **preader)
+{
+L_TIFF_READER  *reader;
+
+    if (preader == NULL) {
+        L_WARNING("ptr address is null!\n", __func__);
+        return;
+    }
+    if ((reader = *preader) == NULL)
+        return;
+
+    TIFFCleanup(reader->tif);
+    fclose(reader->fp);
+    pixcmapDestroy(&reader->cmap);
+    LEPT_FREE(reader->rawbuf);
+    LEPT_FREE(reader->tilebuf);
+    LEPT_FREE(reader->rgbabuf);
+    LEPT_FREE(reader);
+    *preader = NULL;
+}
+
+
+/*!
+ * \brief   tiffReaderGetInfo()
+ *
+ * \param[in]    reader
+ * \param[out]   pw, ph      [optional] image size
+ * \param[out]   pd          [optional] depth of the pix in each band
+ * \param[out]   pbandh      [optional] rows in each band except the last
+ * \param[out]   pnbands     [optional] number of bands
+ * \return  0 if OK, 1 on error
+ */
+l_ok
+tiffReaderGetInfo(L_TIFF_READER  *reader,
+                  l_int32        *pw,
+                  l_int32        *ph,
+                  l_int32        *pd,
+                  l_int32        *pbandh,
+                  l_int32        *pnbands)
+{
+    if (pw) *pw = 0;
+    if (ph) *ph = 0;
+    if (pd) *pd = 0;
+    if (pbandh) *pbandh = 0;
+    if (pnbands) *pnbands = 0;
+    if (!reader)
+        return ERROR_INT("reader not defined", __func__, 1);
+
+    if (pw) *pw = reader->w;
+    if (ph) *ph = reader->h;
+    if (pd) *pd = reader->d;
+    if (pbandh) *pbandh = reader->bandh;
+    if (pnbands) *pnbands = (reader->h + reader->bandh - 1) / reader->bandh;
+    return 0;
+}
+
+
+/*!
+ * \brief   tiffReaderReadBand()
+ *
+ * \param[in]    reader
+ * \param[out]   py        [optional] image row of the first row in the band
+ * \return  pix of the next band, or NULL on error or after the last band
+ *
+ * <pre>
+ * Notes:
+ *      (1) The bands are returned in order from the top of the image.
+ *          All have the height given by tiffReaderGetInfo(), except
+ *          the last, which has the remaining rows.
+ *      (2) There is no error message after the last band.
+ * </pre>
+ */
+PIX *
+tiffReaderReadBand(L_TIFF_READER  *reader,
+                   l_int32        *py)
+{
+l_uint8   *rowptr;
+l_int32    i, j, k, x, y, bh, wpl, rw, rh, ncopy, xoff, tilebpl;
+l_uint32   tiffword;
+l_uint32  *line, *ppixel, *raster;
+TIFF      *tif;
+PIX       *pix, *pix1;
+
+    if (py) *py = 0;
+    if (!reader)
+        return (PIX *)ERROR_PTR("reader not defined", __func__, NULL);
+    if (reader->nextrow >= reader->h)
+        return NULL;
+
+    tif = reader->tif;
+    y = reader->nextrow;
+    bh = L_MIN(reader->bandh, reader->h - y);
+    if ((pix = pixCreate(reader->w, bh, reader->d)) == NULL)
+        return (PIX *)ERROR_PTR("pix not made", __func__, NULL);
+    wpl = pixGetWpl(pix);
+    line = pixGetData(pix);
+
+    if (reader->rgba) {
+            /* The abgr raster for a strip or tile has its origin
+             * at the lower left */
+        if (reader->spp == 4) pixSetSpp(pix, 4);
+        raster = reader->rgbabuf;
+        rw = (reader->tiled) ? reader->tilew : reader->w;
+        rh = (reader->tiled) ? reader->tileh : bh;
+        for (x = 0; x < reader->w; x += rw) {
+            if (reader->tiled) {
+                if (!TIFFReadRGBATile(tif, x, y, raster))
+                    break;
+            } else {
+                if (!TIFFReadRGBAStrip(tif, y, raster))
+                    break;
+            }
+            ncopy = L_MIN(rw, reader->w - x);
+            for (i = 0; i < bh; i++) {
+                ppixel = line + i * wpl + x;
+                for (j = 0; j < ncopy; j++) {
+                    tiffword = raster[(rh - 1 - i) * rw + j];
+                    if (reader->spp == 3) {
+                        composeRGBPixel(TIFFGetR(tiffword), TIFFGetG(tiffword),
+                                        TIFFGetB(tiffword), ppixel);
+                    } else {
+                        composeRGBAPixel(TIFFGetR(tiffword),
+                                         TIFFGetG(tiffword),
+                                         TIFFGetB(tiffword),
+                                         TIFFGetA(tiffword), ppixel);
+                    }
+                    ppixel++;
+                }
+            }
+        }
+        if (x < reader->w) {
+            pixDestroy(&pix);
+            return (PIX *)ERROR_PTR("rgba read failed", __func__, NULL);
+        }
+    } else {
+            /* Read the packed samples of the band */
+        if (reader->tiled) {
+                /* Tile widths are multiples of 16, so each tile starts
+                 * on a byte boundary */
+            tilebpl = TIFFTileRowSize(tif);
+            for (x = 0; x < reader->w; x += reader->tilew) {
+                if (TIFFReadTile(tif, reader->tilebuf, x, y, 0, 0) < 0)
+                    break;
+                xoff = x * reader->bps * reader->spp / 8;
+                ncopy = L_MIN(tilebpl, reader->rawbpl - xoff);
+                for (i = 0; i < bh; i++)
+                    memcpy(reader->rawbuf + i * reader->rawbpl + xoff,
+                           reader->tilebuf + i * tilebpl, ncopy);
+            }
+            if (x < reader->w) {
+                pixDestroy(&pix);
+                return (PIX *)ERROR_PTR("tile read failed", __func__, NULL);
+            }
+        } else {
+            for (i = 0; i < bh; i++) {
+                if (TIFFReadScanline(tif, reader->rawbuf + i * reader->rawbpl,
+                                     y + i, 0) < 0) {
+                    pixDestroy(&pix);
+                    L_ERROR("read fail at line %d\n", __func__, y + i);
+                    return NULL;
+                }
+            }
+        }
+
+            /* Convert to the pix; see pixReadFromTiffStream() */
+        rowptr = reader->rawbuf;
+        if (reader->spp == 1) {
+            for (i = 0; i < bh; i++, rowptr += reader->rawbpl)
+                memcpy(line + i * wpl, rowptr, reader->rawbpl);
+            if (reader->bps <= 8)
+                pixEndianByteSwap(pix);
+            else   /* bps == 16 */
+                pixEndianTwoByteSwap(pix);
+        } else if (reader->spp == 2) {  /* gray plus alpha */
+            pixSetSpp(pix, 4);
+            for (i = 0; i < bh; i++, rowptr += reader->rawbpl) {
+                ppixel = line + i * wpl;
+                for (j = k = 0; j < reader->w; j++, k += 2) {
+                    composeRGBAPixel(rowptr[k], rowptr[k], rowptr[k],
+                                     rowptr[k + 1], ppixel);
+                    ppixel++;
+                }
+            }
+        } else {  /* 8 bps rgb */
+            for (i = 0; i < bh; i++, rowptr += reader->rawbpl) {
+                ppixel = line + i * wpl;
+                for (j = k = 0; j < reader->w; j++, k += 3) {
+                    composeRGBPixel(rowptr[k], rowptr[k + 1], rowptr[k + 2],
+                                    ppixel);
+                    ppixel++;
+                }
+            }
+        }
+    }
+
+    if (reader->cmap) {
+        pixSetColormap(pix, pixcmapCopy(reader->cmap));
+        if (reader->d == 1) {  /* remove the colormap for 1 bpp */
+            pix1 = pixRemoveColormap(pix, REMOVE_CMAP_BASED_ON_SRC);
+            pixDestroy(&pix);
+            pix = pix1;
+        }
+    } else if (reader->invert) {
+        pixInvert(pix, pix);
+    }
+    pixSetResolution(pix, reader->xres, reader->yres);
+    pixSetInputFormat(pix, reader->format);
+
+    reader->nextrow += bh;
+    if (py) *py = y;
+    return pix;
+}
+
+
+/*!
+ * \brief   tiffWriterOpen()
+ *
+ * \param[in]    filename
+ * \param[in]    h          height of the full image
+ * \param[in]    comptype   IFF_TIFF, IFF_TIFF_RLE, IFF_TIFF_PACKBITS,
+ *                          IFF_TIFF_G3, IFF_TIFF_G4,
+ *                          IFF_TIFF_LZW, IFF_TIFF_ZIP, IFF_TIFF_JPEG
+ * \return  writer, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This opens a tiff file for writing an image of height %h
+ *          with tiffWriterWriteBand().  The width, depth, colormap,
+ *          resolution and text are taken from the first band.
+ *      (2) The image is written in strips of the default size chosen
+ *          by the tiff library, which holds at most one strip in memory.
+ *      (3) As in pixWriteStreamTiffWA(), the compression is changed
+ *          to IFF_TIFF_ZIP if it is only valid for 1 bpp and the
+ *          bands have bpp > 1.
+ * </pre>
+ */
+L_TIFF_WRITER *
+tiffWriterOpen(const char  *filename,
+               l_int32      h,
+               l_int32      comptype)
+{
+TIFF           *tif;
+L_TIFF_WRITER  *writer;
+
+    if (!filename)
+        return (L_TIFF_WRITER *)ERROR_PTR("filename not defined",
+                                          __func__, NULL);
+    if (h <= 0)
+        return (L_TIFF_WRITER *)ERROR_PTR("invalid h", __func__, NULL);
+
+    if ((tif = openTiff(filename, "w")) == NULL)
+        return (L_TIFF_WRITER *)ERROR_PTR("tif not opened", __func__, NULL);
+    writer = (L_TIFF_WRITER *)LEPT_CALLOC(1, sizeof(L_TIFF_WRITER));
+    writer->tif = tif;
+    writer->h = h;
+    writer->comptype = comptype;
+    return writer;
+}
+
+
+/*!
+ * \brief   tiffWriterWriteBand()
+ *
+ * \param[in]    writer
+ * \param[in]    pix       the next band of rows
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The bands can have any height, but the total number of
+ *          rows written must be the image height given in
+ *          tiffWriterOpen().
+ *      (2) The pad bits of %pix are set to 0.
+ * </pre>
+ */
+l_ok
+tiffWriterWriteBand(L_TIFF_WRITER  *writer,
+                    PIX            *pix)
+{
+l_int32  w, h, d, comptype;
+
+    if (!writer)
+        return ERROR_INT("writer not defined", __func__, 1);
+    if (!pix)
+        return ERROR_INT("pix not defined", __func__, 1);
+
+    pixGetDimensions(pix, &w, &h, &d);
+    if (writer->nextrow + h > writer->h)
+        return ERROR_INT("too many rows", __func__, 1);
+    if (writer->nextrow == 0) {  /* first band */
+        comptype = writer->comptype;
+        if (d != 1 && comptype != IFF_TIFF && comptype != IFF_TIFF_LZW &&
+            comptype != IFF_TIFF_ZIP && comptype != IFF_TIFF_JPEG) {
+            L_WARNING("invalid compression type %d for bpp > 1; "
+                      "using TIFF_ZIP\n", __func__, comptype);
+            comptype = IFF_TIFF_ZIP;
+        }
+        writer->w = w;
+        writer->d = d;
+        writer->spp = pixGetSpp(pix);
+        tiffSetImageFields(writer->tif, pix, writer->h, comptype);
+        TIFFSetField(writer->tif, TIFFTAG_ROWSPERSTRIP,
+                     TIFFDefaultStripSize(writer->tif, 0));
+    } else if (w != writer->w || d != writer->d ||
+               pixGetSpp(pix) != writer->spp) {
+        return ERROR_INT("band does not match the first band", __func__, 1);
+    }
+
+    pixSetPadBits(pix, 0);
+    if (tiffWriteRows(writer->tif, pix, writer->nextrow))
+        return ERROR_INT("band not written", __func__, 1);
+    writer->nextrow += h;
+    return 0;
+}
+
+
+/*!
+ * \brief   tiffWriterClose()
+ *
+ * \param[in,out]   pwriter   will be set to null before returning
+ * \return  0 if OK, 1 if not all rows were written or on error
+ */
+l_ok
+tiffWriterClose(L_TIFF_WRITER  **pwriter)
+{
+l_int32         ret;
+L_TIFF_WRITER  *writer;
+
+    if (pwriter == NULL)
+        return ERROR_INT("ptr address is null", __func__, 1);
+    if ((writer = *pwriter) == NULL)
+        return 0;
+
+    ret = 0;
+    if (writer->nextrow != writer->h) {
+        L_ERROR("%d of %d rows written\n", __func__, writer->nextrow,
+                writer->h);
+        ret = 1;
+    }
+    TIFFClose(writer->tif);
+    LEPT_FREE(writer);
+    *pwriter = NULL;
+    return ret;
+}
+
+
+/*!
+ * \brief   tiffProcessBands()
+ *
+ * \param[in]    filein
+ * \param[in]    n          page number 0 based
+ * \param[in]    fileout
+ * \param[in]    comptype   compression for %fileout; see tiffWriterOpen()
+ * \param[in]    func       called for each band
+ * \param[in]    userdata   [optional] passed to %func
+ * \return  0 if OK, 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This reads page %n of %filein by bands, calls
+ *          %func(pixs, y, userdata) on each band, where %y is the image
+ *          row of the first row in the band, and writes the pix it
+ *          returns to %fileout.  Only one band is in memory at a time.
+ *      (2) %func must return a new pix (or a clone) with the same
+ *          height as the input band, and the same width and depth for
+ *          every band; or NULL to stop with an error.  The caller
+ *          does not own %pixs.
+ *      (3) Filters that need context from neighboring rows can keep
+ *          rows from the previous band in %userdata.
+ * </pre>
+ */
+l_ok
+tiffProcessBands(const char        *filein,
+                 l_int32            n,
+                 const char        *fileout,
+                 l_int32            comptype,
+                 tiffBandHandler_f  func,
+                 void              *userdata)
+{
+l_int32         h, i, y, nbands, ret;
+PIX            *pixs, *pixd;
+L_TIFF_READER  *reader;
+L_TIFF_WRITER  *writer;
+
+    if (!filein || !fileout)
+        return ERROR_INT("filein and fileout not both defined", __func__, 1);
+    if (!func)
+        return ERROR_INT("func not defined", __func__, 1);
+
+    if ((reader = tiffReaderOpen(filein, n)) == NULL)
+        return ERROR_INT("reader not made", __func__, 1);
+    tiffReaderGetInfo(reader, NULL, &h, NULL, NULL, &nbands);
+    if ((writer = tiffWriterOpen(fileout, h, comptype)) == NULL) {
+        tiffReaderClose(&reader);
+        return ERROR_INT("writer not made", __func__, 1);
+    }
+
+    ret = 0;
+    for (i = 0; i < nbands && ret == 0; i++) {
+        if ((pixs = tiffReaderReadBand(reader, &y)) == NULL) {
+            ret = ERROR_INT("band not read", __func__, 1);
+            break;
+        }
+        if ((pixd = func(pixs, y, userdata)) == NULL) {
+            ret = ERROR_INT("band not processed", __func__, 1);
+        } else if (pixGetHeight(pixd) != pixGetHeight(pixs)) {
+            ret = ERROR_INT("band height changed", __func__, 1);
+        } else {
+            ret = tiffWriterWriteBand(writer, pixd);
+        }
+        pixDestroy(&pixs);
+        pixDestroy(&pixd);
+    }
+
+    tiffReaderClose(&reader);
+    if (tiffWriterClose(&writer))
+        ret = 1;
+    return ret;
+}
+
+
+/*--------------------------------------------------------------*
+ *        Page index for random access to multipage tiff        *
+ *--------------------------------------------------------------*/
+/*  Finding page n of a multipage tiff requires following the chain
+ *  of image file directories (IFDs) from the start of the file, so
+ *  that reading the pages of a large file in random order is
+ *  quadratic in the number of pages.  A page index holds the IFD
+ *  offset of each page, along with the parameters of the image, so
+ *  that it is built with one pass over the file.  It can be written
+ *  to a small text file that is stored alongside the tiff file, and
+ *  read back when the tiff file is next opened.  The readers that
+ *  take an index go directly to the IFD of the requested page.  */
+
+/*!
+ * \brief   Parameters of one page in a tiff page index
+ */
+struct L_TiffPage
+{
+    size_t     offset;    /* offset of the IFD in the file                */
+    l_int32    w;         /* image width                                  */
+    l_int32    h;         /* image height                                 */
+    l_int32    bps;       /* bits/sample                                  */
+    l_int32    spp;       /* samples/pixel                                */
+    l_int32    format;    /* input format, from the compression type      */
+    l_int32    xres;      /* x resolution, ppi; 0 if unknown              */
+    l_int32    yres;      /* y resolution, ppi; 0 if unknown              */
+};
+
+/*!
+ * \brief   Page index for a multipage tiff file or memory buffer
+ *
+ *  The %size of the tiff data is used to detect an index that does
+ *  not belong to the file it is used with.
+ */
+struct L_TiffIndex
+{
+    l_int32             n;        /* number of pages                      */
+    l_int32             nalloc;   /* size of the page array               */
+    size_t              size;     /* number of bytes in the tiff data     */
+    struct L_TiffPage  *page;     /* array of page parameters             */
+};
+
+
+/*!
+ * \brief   tiffIndexCreate()
+ *
+ * \param[in]    filename    tiff file
+ * \return  tidx, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This follows the IFD chain once, and records the IFD offset
+ *          and the image parameters of each page.
+ *      (2) The index can be saved with tiffIndexWrite() and used later
+ *          with pixReadTiffIndexed(), so that the IFD chain does not
+ *          need to be followed again.  It is invalidated by any change
+ *          in the size of the tiff file.
+ * </pre>
+ */
+L_TIFF_INDEX *
+tiffIndexCreate(const char  *filename)
+{
+FILE          *fp;
+L_TIFF_INDEX  *tidx;
+TIFF          *tif;
+
+    if (!filename)
+        return (L_TIFF_INDEX *)ERROR_PTR("filename not defined",
+                                         __func__, NULL);
+
+    if ((fp = fopenReadStream(filename)) == NULL)
+        return (L_TIFF_INDEX *)ERROR_PTR_1("image file not found",
+                                           filename, __func__, NULL);
+    if ((tif = fopenTiff(fp, "r")) == NULL) {
+        fclose(fp);
+        return (L_TIFF_INDEX *)ERROR_PTR_1("tif not opened",
+                                           filename, __func__, NULL);
+    }
+    tidx = tiffIndexBuild(tif, fnbytesInFile(fp));
+    TIFFCleanup(tif);
+    fclose(fp);
+    return tidx;
+}
+
+
+/*!
+ * \brief   tiffIndexCreateMem()
+ *
+ * \param[in]    cdata    const; tiff-encoded
+ * \param[in]    size     size of cdata
+ * \return  tidx, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is a version of tiffIndexCreate() for tiff data in memory.
+ *          Use it with pixReadMemTiffIndexed().
+ * </pre>
+ */
+L_TIFF_INDEX *
+tiffIndexCreateMem(const l_uint8  *cdata,
+                   size_t          size)
+{
+l_uint8       *data;
+L_TIFF_INDEX  *tidx;
+TIFF          *tif;
+
+    if (!cdata)
+        return (L_TIFF_INDEX *)ERROR_PTR("cdata not defined", __func__, NULL);
+
+    data = (l_uint8 *)cdata;  /* we're really not going to change this */
+    if ((tif = fopenTiffMemstream("tifferror", "r", &data, &size)) == NULL)
+        return (L_TIFF_INDEX *)ERROR_PTR("tiff stream not opened",
+                                         __func__, NULL);
+    tidx = tiffIndexBuild(tif, size);
+    TIFFClose(tif);
+    return tidx;
+}
+
+
+/*!
+ * \brief   tiffIndexBuild()
+ *
+ * \param[in]    tif     opened for read, on the first page
+ * \param[in]    size    number of bytes in the tiff data
+ * \return  tidx, or NULL on error
+ */
+static L_TIFF_INDEX *
+tiffIndexBuild(TIFF    *tif,
+               size_t   size)
+{
+l_uint16            bps, spp, tiffcomp;
+l_int32             xres, yres;
+l_uint32            w, h;
+struct L_TiffPage  *page;
+L_TIFF_INDEX       *tidx;
+
+    if ((tidx = (L_TIFF_INDEX *)LEPT_CALLOC(1, sizeof(L_TIFF_INDEX))) == NULL)
+        return (L_TIFF_INDEX *)ERROR_PTR("tidx not made", __func__, NULL);
+    tidx->size = size;
+    do {
+        if (tidx->n == tidx->nalloc) {
+            tidx->nalloc = L_MAX(2 * tidx->nalloc, 20);
+            if ((tidx->page = (struct L_TiffPage *)reallocNew(
+                     (void **)&tidx->page,
+                     sizeof(struct L_TiffPage) * tidx->n,
+                     sizeof(struct L_TiffPage) * tidx->nalloc)) == NULL) {
+                tiffIndexDestroy(&tidx);
+                return (L_TIFF_INDEX *)ERROR_PTR("page array not made",
+                                                 __func__, NULL);
+            }
+        }
+        w = h = 0;
+        xres = yres = 0;
+        TIFFGetField(tif, TIFFTAG_IMAGEWIDTH, &w);
+        TIFFGetField(tif, TIFFTAG_IMAGELENGTH, &h);
+        TIFFGetFieldDefaulted(tif, TIFFTAG_BITSPERSAMPLE, &bps);
+        TIFFGetFieldDefaulted(tif, TIFFTAG_SAMPLESPERPIXEL, &spp);
+        TIFFGetFieldDefaulted(tif, TIFFTAG_COMPRESSION, &tiffcomp);
+        getTiffStreamResolution(tif, &xres, &yres);
+        page = &tidx->page[tidx->n];
+        page->offset = (size_t)TIFFCurrentDirOffset(tif);
+        page->w = w;
+        page->h = h;
+        page->bps = bps;
+        page->spp = spp;
+        page->format = getTiffCompressedFormat(tiffcomp);
+        page->xres = xres;
+        page->yres = yres;
+        tidx->n++;
+    } while (TIFFReadDirectory(tif) != 0);
+    return tidx;
+}
+
+
+/*!
+ * \brief   tiffIndexDestroy()
+ *
+ * \param[in,out]   ptidx    will be set to null before returning
+ * \return  void
+ */
+void
+tiffIndexDestroy(L_TIFF_INDEX  **ptidx)
+{
+L_TIFF_INDEX  *tidx;
+
+    if (ptidx == NULL) {
+        L_WARNING("ptr address is null!\n", __func__);
+        return;
+    }
+    if ((tidx = *ptidx) == NULL)
+        return;
+
+    LEPT_FREE(tidx->page);
+    LEPT_FREE(tidx);
+    *ptidx = NULL;
+}
+
+
+/*!
+ * \brief   tiffIndexGetCount()
+ *
+ * \param[in]    tidx
+ * \return  number of pages, or 0 on error
+ */
+l_int32
+tiffIndexGetCount(L_TIFF_INDEX  *tidx)
+{
+    if (!tidx)
+        return ERROR_INT("tidx not defined", __func__, 0);
+    return tidx->n;
+}
+
+
+/*!
+ * \brief   tiffIndexGetPageInfo()
+ *
+ * \param[in]    tidx
+ * \param[in]    n          page number 0 based
+ * \param[out]   poffset    [optional] offset of the IFD of the page
+ * \param[out]   pw, ph     [optional] image size
+ * \param[out]   pbps       [optional] bits/sample
+ * \param[out]   pspp       [optional] samples/pixel
+ * \param[out]   pformat    [optional] IFF_TIFF_*; from the compression
+ * \param[out]   pxres, pyres  [optional] resolution in ppi; 0 if unknown
+ * \return  0 if OK; 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This gives the parameters of any page without reading the file.
+ * </pre>
+ */
+l_ok
+tiffIndexGetPageInfo(L_TIFF_INDEX  *tidx,
+                     l_int32        n,
+                     size_t        *poffset,
+                     l_int32       *pw,
+                     l_int32       *ph,
+                     l_int32       *pbps,
+                     l_int32       *pspp,
+                     l_int32       *pformat,
+                     l_int32       *pxres,
+                     l_int32       *pyres)
+{
+struct L_TiffPage  *page;
+
+    if (poffset) *poffset = 0;
+    if (pw) *pw = 0;
+    if (ph) *ph = 0;
+    if (pbps) *pbps = 0;
+    if (pspp) *pspp = 0;
+    if (pformat) *pformat = IFF_UNKNOWN;
+    if (pxres) *pxres = 0;
+    if (pyres) *pyres = 0;
+    if (!tidx)
+        return ERROR_INT("tidx not defined", __func__, 1);
+    if (n < 0 || n >= tidx->n)
+        return ERROR_INT("invalid page number", __func__, 1);
+
+    page = &tidx->page[n];
+    if (poffset) *poffset = page->offset;
+    if (pw) *pw = page->w;
+    if (ph) *ph = page->h;
+    if (pbps) *pbps = page->bps;
+    if (pspp) *pspp = page->spp;
+    if (pformat) *pformat = page->format;
+    if (pxres) *pxres = page->xres;
+    if (pyres) *pyres = page->yres;
+    return 0;
+}
+
+
+/*!
+ * \brief   tiffIndexRead()
+ *
+ * \param[in]    filename    serialized page index
+ * \return  tidx, or NULL on error
+ */
+L_TIFF_INDEX *
+tiffIndexRead(const char  *filename)
+{
+FILE          *fp;
+L_TIFF_INDEX  *tidx;
+
+    if (!filename)
+        return (L_TIFF_INDEX *)ERROR_PTR("filename not defined",
+                                         __func__, NULL);
+
+    if ((fp = fopenReadStream(filename)) == NULL)
+        return (L_TIFF_INDEX *)ERROR_PTR_1("stream not opened",
+                                           filename, __func__, NULL);
+    tidx = tiffIndexReadStream(fp);
+    fclose(fp);
+    if (!tidx)
+        return (L_TIFF_INDEX *)ERROR_PTR_1("tidx not read",
+                                           filename, __func__, NULL);
+    return tidx;
+}
+
+
+/*!
+ * \brief   tiffIndexReadStream()
+ *
+ * \param[in]    fp    file stream
+ * \return  tidx, or NULL on error
+ */
+L_TIFF_INDEX *
+tiffIndexReadStream(FILE  *fp)
+{
+l_int32             n, i, version, ignore;
+size_t              size;
+struct L_TiffPage  *page;
+L_TIFF_INDEX       *tidx;
+
+    if (!fp)
+        return (L_TIFF_INDEX *)ERROR_PTR("stream not defined", __func__, NULL);
+
+    if (fscanf(fp, "\nTiff Index Version %d\n", &version) != 1)
+        return (L_TIFF_INDEX *)ERROR_PTR("not a tiff index file",
+                                         __func__, NULL);
+    if (version != TIFF_INDEX_VERSION_NUMBER)
+        return (L_TIFF_INDEX *)ERROR_PTR("invalid tiff index version",
+                                         __func__, NULL);
+    if (fscanf(fp, "Number of pages = %d, size = %zu\n", &n, &size) != 2)
+        return (L_TIFF_INDEX *)ERROR_PTR("not a tiff index file",
+                                         __func__, NULL);
+    if (n < 1 || n > MaxTiffIndexPages)
+        return (L_TIFF_INDEX *)ERROR_PTR("invalid number of pages",
+                                         __func__, NULL);
+
+    if ((tidx = (L_TIFF_INDEX *)LEPT_CALLOC(1, sizeof(L_TIFF_INDEX))) == NULL)
+        return (L_TIFF_INDEX *)ERROR_PTR("tidx not made", __func__, NULL);
+    if ((tidx->page = (struct L_TiffPage *)LEPT_CALLOC(n,
+                                     sizeof(struct L_TiffPage))) == NULL) {
+        tiffIndexDestroy(&tidx);
+        return (L_TIFF_INDEX *)ERROR_PTR("page array not made",
+                                         __func__, NULL);
+    }
+    tidx->nalloc = n;
+    tidx->size = size;
+    for (i = 0; i < n; i++) {
+        page = &tidx->page[i];
+        if (fscanf(fp, "  Page[%d]: offset = %zu, w = %d, h = %d, bps = %d,"
+                   " spp = %d, format = %d, xres = %d, yres = %d\n",
+                   &ignore, &page->offset, &page->w, &page->h, &page->bps,
+                   &page->spp, &page->format, &page->xres,
+                   &page->yres) != 9 ||
+            page->offset == 0 || page->offset >= size) {
+            tiffIndexDestroy(&tidx);
+            return (L_TIFF_INDEX *)ERROR_PTR("page descr not valid",
+                                             __func__, NULL);
+        }
+    }
+    tidx->n = n;
+    return tidx;
+}
+
+
+/*!
+ * \brief   tiffIndexWrite()
+ *
+ * \param[in]    filename    for the serialized page index
+ * \param[in]    tidx
+ * \return  0 if OK; 1 on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) A convenient name for the index of file.tif is file.tif.idx,
+ *          in the same directory.
+ * </pre>
+ */
+l_ok
+tiffIndexWrite(const char    *filename,
+               L_TIFF_INDEX  *tidx)
+{
+l_int32  ret;
+FILE    *fp;
+
+    if (!filename)
+        return ERROR_INT("filename not defined", __func__, 1);
+    if (!tidx)
+        return ERROR_INT("tidx not defined", __func__, 1);
+
+    if ((fp = fopenWriteStream(filename, "w")) == NULL)
+        return ERROR_INT_1("stream not opened", filename, __func__, 1);
+    ret = tiffIndexWriteStream(fp, tidx);
+    fclose(fp);
+    if (ret)
+        return ERROR_INT_1("tidx not written to stream",
+                           filename, __func__, 1);
+    return 0;
+}
+
+
+/*!
+ * \brief   tiffIndexWriteStream()
+ *
+ * \param[in]    fp      file stream; use NULL for stderr
+ * \param[in]    tidx
+ * \return  0 if OK; 1 on error
+ */
+l_ok
+tiffIndexWriteStream(FILE          *fp,
+                     L_TIFF_INDEX  *tidx)
+{
+l_int32             i;
+struct L_TiffPage  *page;
+
+    if (!tidx)
+        return ERROR_INT("tidx not defined", __func__, 1);
+    if (!fp)
+        fp = stderr;
+
+    fprintf(fp, "\nTiff Index Version %d\n", TIFF_INDEX_VERSION_NUMBER);
+    fprintf(fp, "Number of pages = %d, size = %zu\n", tidx->n, tidx->size);
+    for (i = 0; i < tidx->n; i++) {
+        page = &tidx->page[i];
+        fprintf(fp, "  Page[%d]: offset = %zu, w = %d, h = %d, bps = %d,"
+                " spp = %d, format = %d, xres = %d, yres = %d\n",
+                i, page->offset, page->w, page->h, page->bps, page->spp,
+                page->format, page->xres, page->yres);
+    }
+    return 0;
+}
+
+
+/*!
+ * \brief   pixReadTiffIndexed()
+ *
+ * \param[in]    filename
+ * \param[in]    tidx        page index for the file
+ * \param[in]    n           page number 0 based
+ * \return  pix, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is a version of pixReadTiff() that seeks directly to
+ *          the IFD of page %n, using an index made by tiffIndexCreate()
+ *          or read by tiffIndexRead().
+ *      (2) It is an error if the file size does not match the size
+ *          recorded in the index, or if the image size at the IFD
+ *          differs from the index.  Then the index must be rebuilt.
+ * </pre>
+ */
+PIX *
+pixReadTiffIndexed(const char    *filename,
+                   L_TIFF_INDEX  *tidx,
+                   l_int32        n)
+{
+FILE  *fp;
+PIX   *pix;
+
+    if (!filename)
+        return (PIX *)ERROR_PTR("filename not defined", __func__, NULL);
+
+    if ((fp = fopenReadStream(filename)) == NULL)
+        return (PIX *)ERROR_PTR_1("image file not found",
+                                  filename, __func__, NULL);
+    pix = pixReadStreamTiffIndexed(fp, tidx, n);
+    fclose(fp);
+    return pix;
+}
+
+
+/*!
+ * \brief   pixReadStreamTiffIndexed()
+ *
+ * \param[in]    fp      file stream
+ * \param[in]    tidx    page index for the file
+ * \param[in]    n       page number 0 based
+ * \return  pix, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The input format of the pix is the compression of page %n,
+ *          as for pixReadStreamTiff().
+ * </pre>
+ */
+PIX *
+pixReadStreamTiffIndexed(FILE          *fp,
+                         L_TIFF_INDEX  *tidx,
+                         l_int32        n)
+{
+PIX   *pix;
+TIFF  *tif;
+
+    if (!fp)
+        return (PIX *)ERROR_PTR("stream not defined", __func__, NULL);
+    if (!tidx)
+        return (PIX *)ERROR_PTR("tidx not defined", __func__, NULL);
+    if (n < 0 || n >= tidx->n)
+        return (PIX *)ERROR_PTR("invalid page number", __func__, NULL);
+    if ((size_t)fnbytesInFile(fp) != tidx->size)
+        return (PIX *)ERROR_PTR("file size differs from index",
+                                __func__, NULL);
+
+    if ((tif = fopenTiff(fp, "r")) == NULL)
+        return (PIX *)ERROR_PTR("tif not opened", __func__, NULL);
+    if (tiffIndexSeek(tif, tidx, n) == NULL) {
+        TIFFCleanup(tif);
+        return NULL;
+    }
+    if ((pix = pixReadFromTiffStream(tif)) != NULL)
+        pixSetInputFormat(pix, tidx->page[n].format);
+    TIFFCleanup(tif);
+    return pix;
+}
+
+
+/*!
+ * \brief   pixReadMemTiffIndexed()
+ *
+ * \param[in]    cdata    const; tiff-encoded
+ * \param[in]    size     size of cdata
+ * \param[in]    tidx     page index for the data
+ * \param[in]    n        page number 0 based
+ * \return  pix, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is a version of pixReadMemTiff() that seeks directly to
+ *          the IFD of page %n, using an index made by tiffIndexCreateMem()
+ *          or tiffIndexCreate() on the same data.
+ *      (2) The input format of the pix is the compression of page %n.
+ * </pre>
+ */
+PIX *
+pixReadMemTiffIndexed(const l_uint8  *cdata,
+                      size_t          size,
+                      L_TIFF_INDEX   *tidx,
+                      l_int32         n)
+{
+l_uint8  *data;
+PIX      *pix;
+TIFF     *tif;
+
+    if (!cdata)
+        return (PIX *)ERROR_PTR("cdata not defined", __func__, NULL);
+    if (!tidx)
+        return (PIX *)ERROR_PTR("tidx not defined", __func__, NULL);
+    if (n < 0 || n >= tidx->n)
+        return (PIX *)ERROR_PTR("invalid page number", __func__, NULL);
+    if (size != tidx->size)
+        return (PIX *)ERROR_PTR("data size differs from index",
+                                __func__, NULL);
+
+    data = (l_uint8 *)cdata;  /* we're really not going to change this */
+    if ((tif = fopenTiffMemstream("tifferror", "r", &data, &size)) == NULL)
+        return (PIX *)ERROR_PTR("tiff stream not opened", __func__, NULL);
+    if (tiffIndexSeek(tif, tidx, n) == NULL) {
+        TIFFClose(tif);
+        return NULL;
+    }
+    if ((pix = pixReadFromTiffStream(tif)) != NULL)
+        pixSetInputFormat(pix, tidx->page[n].format);
+    TIFFClose(tif);
+    return pix;
+}
+
+
+/*!
+ * \brief   tiffIndexSeek()
+ *
+ * \param[in]    tif     opened for read, on the first page
+ * \param[in]    tidx
+ * \param[in]    n       page number 0 based
+ * \return  tif on page %n, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The first page is read when the tif is opened.  Any other
+ *          page is read from the IFD offset in the index.
+ *      (2) As a check that the index belongs to the tiff data, the
+ *          image size at the IFD must agree with the index.
+ * </pre>
+ */
+static TIFF *
+tiffIndexSeek(TIFF          *tif,
+              L_TIFF_INDEX  *tidx,
+              l_int32        n)
+{
+l_uint32            w, h;
+struct L_TiffPage  *page;
+
+    page = &tidx->page[n];
+    if (n > 0 && TIFFSetSubDirectory(tif, page->offset) == 0)
+        return (TIFF *)ERROR_PTR("IFD not read", __func__, NULL);
+    w = h = 0;
+    TIFFGetField(tif, TIFFTAG_IMAGEWIDTH, &w);
+    TIFFGetField(tif, TIFFTAG_IMAGELENGTH, &h);
+    if ((l_int32)w != page->w || (l_int32)h != page->h)
+        return (TIFF *)ERROR_PTR("page differs from index", __func__, NULL);
+    return tif;
+}
+
+
 /*--------------------------------------------------------------*
  *                    Print info to stream                      *
  *--------------------------------------------------------------*/
@@ -124,6 +124,156 @@ l_ok writeMultipageTiffSA(SARRAY *sa, const char *fileout)
 
 /* ----------------------------------------------------------------------*/
 
+L_TIFF_READER * tiffReaderOpen(const char *filename, l_int32 n)
+{
+    return (L_TIFF_READER *)ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
+void tiffReaderClose(L_TIFF_READER **preader)
+{
+    L_ERROR("function not present\n", __func__);
+    return;
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok tiffReaderGetInfo(L_TIFF_READER *reader, l_int32 *pw, l_int32 *ph,
+                       l_int32 *pd, l_int32 *pbandh, l_int32 *pnbands)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+PIX * tiffReaderReadBand(L_TIFF_READER *reader, l_int32 *py)
+{
+    return (PIX *)ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
+L_TIFF_WRITER * tiffWriterOpen(const char *filename, l_int32 h,
+                               l_int32 comptype)
+{
+    return (L_TIFF_WRITER *)ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok tiffWriterWriteBand(L_TIFF_WRITER *writer, PIX *pix)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok tiffWriterClose(L_TIFF_WRITER **pwriter)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok tiffProcessBands(const char *filein, l_int32 n, const char *fileout,
+                      l_int32 comptype, tiffBandHandler_f func,
+                      void *userdata)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+L_TIFF_INDEX * tiffIndexCreate(const char *filename)
+{
+    return (L_TIFF_INDEX *)ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
+L_TIFF_INDEX * tiffIndexCreateMem(const l_uint8 *cdata, size_t size)
+{
+    return (L_TIFF_INDEX *)ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
+void tiffIndexDestroy(L_TIFF_INDEX **ptidx)
+{
+    L_ERROR("function not present\n", __func__);
+    return;
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_int32 tiffIndexGetCount(L_TIFF_INDEX *tidx)
+{
+    return ERROR_INT("function not present", __func__, 0);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok tiffIndexGetPageInfo(L_TIFF_INDEX *tidx, l_int32 n, size_t *poffset,
+                          l_int32 *pw, l_int32 *ph, l_int32 *pbps,
+                          l_int32 *pspp, l_int32 *pformat, l_int32 *pxres,
+                          l_int32 *pyres)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+L_TIFF_INDEX * tiffIndexRead(const char *filename)
+{
+    return (L_TIFF_INDEX *)ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
+L_TIFF_INDEX * tiffIndexReadStream(FILE *fp)
+{
+    return (L_TIFF_INDEX *)ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok tiffIndexWrite(const char *filename, L_TIFF_INDEX *tidx)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_ok tiffIndexWriteStream(FILE *fp, L_TIFF_INDEX *tidx)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+PIX * pixReadTiffIndexed(const char *filename, L_TIFF_INDEX *tidx, l_int32 n)
+{
+    return (PIX *)ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
+PIX * pixReadStreamTiffIndexed(FILE *fp, L_TIFF_INDEX *tidx, l_int32 n)
+{
+    return (PIX *)ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
+PIX * pixReadMemTiffIndexed(const l_uint8 *cdata, size_t size,
+                            L_TIFF_INDEX *tidx, l_int32 n)
+{
+    return (PIX *)ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
 l_ok fprintTiffInfo(FILE *fpout, const char *tiffile)
 {
     return ERROR_INT("function not present", __func__, 1);
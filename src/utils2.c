@@ -75,6 +75,12 @@
  *           l_int32    nbytesInFile()
  *           l_int32    fnbytesInFile()
  *
+ *       Mapping of a file into memory
+ *           l_uint8   *l_binaryMap()
+ *           l_uint8   *l_binaryMapPrivate()
+ *           l_int32    l_binaryUnmap()
+ *           static l_uint8   *l_binaryMapInternal()
+ *
  *       Copy and compare in memory
  *           l_uint8   *l_binaryCopy()
  *           l_uint8   *l_binaryCompare()
@@ -217,6 +223,7 @@
 #include <strings.h>
 #include <sys/stat.h>  /* for stat, mkdir(2) */
 #include <sys/types.h>
+#include <sys/mman.h>  /* for mmap */
 #endif
 
 #ifdef __APPLE__
@@ -244,6 +251,9 @@
 #define restrict  /**/
 #endif
 
+static l_uint8 *l_binaryMapInternal(const char *filename, size_t *pnbytes,
+                                    l_int32 writable);
+
 /*--------------------------------------------------------------------*
  *                       Safe string operations                       *
  *--------------------------------------------------------------------*/
@@ -1668,6 +1678,155 @@ l_int64  pos, nbytes;
 }
 
 
+/*--------------------------------------------------------------------*
+ *                   Mapping of a file into memory                    *
+ *--------------------------------------------------------------------*/
+/*!
+ * \brief   l_binaryMap()
+ *
+ * \param[in]    filename
+ * \param[out]   pnbytes    size of the file
+ * \return  mapped data, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This maps the file into memory for reading, with mmap(), or
+ *          MapViewOfFile() on Windows.  The data is paged in from the
+ *          file as it is accessed, and the pages can be dropped again
+ *          by the system, so mapping a large file does not use heap
+ *          memory for its contents.
+ *      (2) The data must not be written, and it is not null-terminated.
+ *          The file must not be changed while it is mapped.
+ *      (3) Release the data with l_binaryUnmap(); never LEPT_FREE() it.
+ *      (4) An empty file can not be mapped.
+ * </pre>
+ */
+l_uint8 *
+l_binaryMap(const char  *filename,
+            size_t      *pnbytes)
+{
+    return l_binaryMapInternal(filename, pnbytes, FALSE);
+}
+
+
+/*!
+ * \brief   l_binaryMapPrivate()
+ *
+ * \param[in]    filename
+ * \param[out]   pnbytes    size of the file
+ * \return  mapped data, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) This is the same as l_binaryMap(), except that the data
+ *          can be written.  The pages are copy-on-write: a page that
+ *          is written is copied for this process, and the file itself
+ *          is never changed.
+ *      (2) Release the data with l_binaryUnmap().
+ * </pre>
+ */
+l_uint8 *
+l_binaryMapPrivate(const char  *filename,
+                   size_t      *pnbytes)
+{
+    return l_binaryMapInternal(filename, pnbytes, TRUE);
+}
+
+
+/*!
+ * \brief   l_binaryUnmap()
+ *
+ * \param[in,out]   pdata    data from l_binaryMap(); will be nulled
+ * \param[in]       nbytes   size of the mapped data
+ * \return  0 if OK, 1 on error
+ */
+l_ok
+l_binaryUnmap(l_uint8  **pdata,
+              size_t     nbytes)
+{
+l_int32   ret;
+l_uint8  *data;
+
+    if (!pdata)
+        return ERROR_INT("&data not defined", __func__, 1);
+    if ((data = *pdata) == NULL)
+        return 0;
+    *pdata = NULL;
+
+#ifdef _WIN32
+    ret = (UnmapViewOfFile(data) == 0);
+#else
+    ret = (munmap(data, nbytes) != 0);
+#endif  /* _WIN32 */
+    if (ret)
+        return ERROR_INT("data not unmapped", __func__, 1);
+    return 0;
+}
+
+
+/*!
+ * \brief   l_binaryMapInternal()
+ *
+ * \param[in]    filename
+ * \param[out]   pnbytes    size of the file
+ * \param[in]    writable   1 for copy-on-write pages; 0 for read-only
+ * \return  mapped data, or NULL on error
+ */
+static l_uint8 *
+l_binaryMapInternal(const char  *filename,
+                    size_t      *pnbytes,
+                    l_int32      writable)
+{
+l_uint8  *data;
+size_t    nbytes;
+FILE     *fp;
+#ifdef _WIN32
+HANDLE    hfile, hmap;
+#endif  /* _WIN32 */
+
+    if (!pnbytes)
+        return (l_uint8 *)ERROR_PTR("&nbytes not defined", __func__, NULL);
+    *pnbytes = 0;
+    if (!filename)
+        return (l_uint8 *)ERROR_PTR("filename not defined", __func__, NULL);
+
+    if ((fp = fopenReadStream(filename)) == NULL)
+        return (l_uint8 *)ERROR_PTR_1("file stream not opened",
+                                      filename, __func__, NULL);
+    if ((nbytes = fnbytesInFile(fp)) == 0) {
+        fclose(fp);
+        return (l_uint8 *)ERROR_PTR_1("file is empty",
+                                      filename, __func__, NULL);
+    }
+
+        /* The mapping remains valid after the stream is closed */
+    data = NULL;
+#ifdef _WIN32
+    hfile = (HANDLE)_get_osfhandle(_fileno(fp));
+    hmap = CreateFileMapping(hfile, NULL,
+                             (writable) ? PAGE_WRITECOPY : PAGE_READONLY,
+                             0, 0, NULL);
+    if (hmap) {
+        data = (l_uint8 *)MapViewOfFile(hmap,
+                              (writable) ? FILE_MAP_COPY : FILE_MAP_READ,
+                              0, 0, 0);
+        CloseHandle(hmap);
+    }
+#else
+    data = (l_uint8 *)mmap(NULL, nbytes,
+                           (writable) ? PROT_READ | PROT_WRITE : PROT_READ,
+                           MAP_PRIVATE, fileno(fp), 0);
+    if (data == (l_uint8 *)MAP_FAILED)
+        data = NULL;
+#endif  /* _WIN32 */
+    fclose(fp);
+    if (!data)
+        return (l_uint8 *)ERROR_PTR_1("file not mapped",
+                                      filename, __func__, NULL);
+    *pnbytes = nbytes;
+    return data;
+}
+
 /*--------------------------------------------------------------------*
  *                     Copy and compare in memory                     *
  *--------------------------------------------------------------------*/
@@ -33,6 +33,12 @@
  *          l_uint8   *zlibCompress()
  *          l_uint8   *zlibUncompress()
  *
+ *      Parallel compression by blocks
+ *          l_uint8   *zlibCompressParallel()
+ *          static l_int32  zlibDeflateBlock()
+ *          l_int32    l_zlibSetThreads()
+ *          l_int32    l_zlibGetThreads()
+ *
  *
  *    This provides an example use of the byte buffer utility
  *    (see bbuffer.c for details of how the bbuffer works internally).
@@ -44,6 +50,14 @@
  *    With memory mapping, one should be able to compress between
  *    memory buffers by using the file system to buffer everything in
  *    the background, but the bbuffer implementation is more portable.
+ *
+ *    zlibCompressParallel() splits the input into blocks that are
+ *    deflated independently on separate threads, each primed with the
+ *    last 32 KB of the previous block as its dictionary, and joins them
+ *    into a single zlib stream that any inflater can decode.  The number
+ *    of threads is set with l_zlibSetThreads(); the default of 1 keeps
+ *    zlibCompress() and png writing on the single-stream encoder, so
+ *    that their output is unchanged.
  * </pre>
  */
 
@@ -51,6 +65,7 @@
 #include <config_auto.h>
 #endif  /* HAVE_CONFIG_H */
 
+#include <string.h>
 #include "allheaders.h"
 
 /* --------------------------------------------*/
@@ -63,10 +78,26 @@
 #if HAVE_LIBZ_NG
 #include "zlib-ng.h"
 #endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif  /* _OPENMP */
 
 static const l_int32  L_BUF_SIZE = 32768;
 static const l_int32  ZLIB_COMPRESSION_LEVEL = 6;
 
+    /* For parallel compression: the size of the input block given to
+     * each thread, and the size of the deflate window */
+static const size_t   ZLIB_BLOCK_SIZE = 131072;
+static const size_t   ZLIB_WINDOW_SIZE = 32768;
+
+    /* Number of threads for compression; 1 for a single stream and
+     * 0 for all available threads */
+static l_int32  var_ZLIB_THREADS = 1;
+
+static l_int32 zlibDeflateBlock(const l_uint8 *datain, size_t nin,
+                                size_t ndict, l_int32 level, l_int32 last,
+                                l_uint8 **pdataout, size_t *pnout);
+
 #ifndef  NO_CONSOLE_IO
 #define  DEBUG     0
 #endif  /* ~NO_CONSOLE_IO */
@@ -91,6 +122,9 @@ static const l_int32  ZLIB_COMPRESSION_LEVEL = 6;
  *          be used if the data were being read from one file
  *          and written to another.  This is done iteratively,
  *          compressing L_BUF_SIZE bytes of input data at a time.
+ *      (2) If more than one thread has been requested with
+ *          l_zlibSetThreads(), large inputs are compressed with
+ *          zlibCompressParallel().
  * </pre>
  */
 l_uint8 *
@@ -109,6 +143,11 @@ zng_stream    z;
     if (!datain)
         return (l_uint8 *)ERROR_PTR("datain not defined", __func__, NULL);
 
+        /* Use several threads if requested and there is enough data */
+    if (var_ZLIB_THREADS != 1 && nin >= 2 * ZLIB_BLOCK_SIZE)
+        return zlibCompressParallel(datain, nin, ZLIB_COMPRESSION_LEVEL,
+                                    var_ZLIB_THREADS, pnout);
+
         /* Set up fixed size buffers used in z_stream */
     bufferin = (l_uint8 *)LEPT_CALLOC(L_BUF_SIZE, sizeof(l_uint8));
     bufferout = (l_uint8 *)LEPT_CALLOC(L_BUF_SIZE, sizeof(l_uint8));
@@ -280,6 +319,253 @@ cleanup_arrays:
     return dataout;
 }
 
+
+/*---------------------------------------------------------------------*
+ *                   Parallel compression by blocks                    *
+ *---------------------------------------------------------------------*/
+/*!
+ * \brief   zlibCompressParallel()
+ *
+ * \param[in]    datain    byte buffer with input data
+ * \param[in]    nin       number of bytes of input data
+ * \param[in]    level     zlib compression level: -1 for default, or 0 - 9
+ * \param[in]    nthreads  max number of threads; 0 for all available
+ * \param[out]   pnout     number of bytes of output data
+ * \return  dataout compressed data in zlib format, or NULL on error
+ *
+ * <pre>
+ * Notes:
+ *      (1) The input is split into blocks of ZLIB_BLOCK_SIZE bytes, which
+ *          are compressed in parallel as raw deflate data.  Each block
+ *          except the first uses the last ZLIB_WINDOW_SIZE bytes of the
+ *          previous block as a dictionary, so the loss in compression
+ *          compared to a single stream is small.  Each block except the
+ *          last ends with a sync flush, which byte-aligns its output, so
+ *          the blocks can be concatenated.  The result is a single zlib
+ *          stream, with the zlib header and the adler32 checksum of all
+ *          the data, that is decoded by zlibUncompress() or any inflater.
+ *      (2) The output depends on the block size but not on the number
+ *          of threads, so it is the same on every machine.
+ *      (3) This is used by zlibCompress() and for the image data in png
+ *          when l_zlibSetThreads() requests more than one thread.
+ * </pre>
+ */
+l_uint8 *
+zlibCompressParallel(const l_uint8  *datain,
+                     size_t          nin,
+                     l_int32         level,
+                     l_int32         nthreads,
+                     size_t         *pnout)
+{
+l_uint8   *dataout;
+l_uint8  **blockout;
+l_int32    i, nblocks, flevel, ret;
+l_uint32   adler, *blockadler;
+size_t     start, n, ndict, nout;
+size_t    *blocksize;
+
+    if (!pnout)
+        return (l_uint8 *)ERROR_PTR("&nout not defined", __func__, NULL);
+    *pnout = 0;
+    if (!datain)
+        return (l_uint8 *)ERROR_PTR("datain not defined", __func__, NULL);
+    if (level < -1 || level > 9)
+        return (l_uint8 *)ERROR_PTR("invalid level", __func__, NULL);
+    if (nthreads < 0)
+        return (l_uint8 *)ERROR_PTR("invalid nthreads", __func__, NULL);
+
+#ifdef _OPENMP
+    if (nthreads == 0)
+        nthreads = omp_get_max_threads();
+#else
+    nthreads = 1;
+#endif  /* _OPENMP */
+
+    nblocks = (nin + ZLIB_BLOCK_SIZE - 1) / ZLIB_BLOCK_SIZE;
+    nblocks = L_MAX(1, nblocks);
+    blockout = (l_uint8 **)LEPT_CALLOC(nblocks, sizeof(l_uint8 *));
+    blocksize = (size_t *)LEPT_CALLOC(nblocks, sizeof(size_t));
+    blockadler = (l_uint32 *)LEPT_CALLOC(nblocks, sizeof(l_uint32));
+    if (!blockout || !blocksize || !blockadler) {
+        LEPT_FREE(blockout);
+        LEPT_FREE(blocksize);
+        LEPT_FREE(blockadler);
+        return (l_uint8 *)ERROR_PTR("block arrays not made", __func__, NULL);
+    }
+
+        /* Compress the blocks and find their checksums */
+    ret = 0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+        private(start, n, ndict) reduction(+:ret) if (nthreads > 1)
+#endif  /* _OPENMP */
+    for (i = 0; i < nblocks; i++) {
+        start = i * ZLIB_BLOCK_SIZE;
+        n = L_MIN(ZLIB_BLOCK_SIZE, nin - start);
+        ndict = L_MIN(start, ZLIB_WINDOW_SIZE);
+        ret += zlibDeflateBlock(datain + start, n, ndict, level,
+                                i == nblocks - 1, &blockout[i],
+                                &blocksize[i]);
+        blockadler[i] = zng_adler32(1, datain + start, n);
+    }
+
+        /* Join the blocks, between the header and the checksum */
+    dataout = NULL;
+    if (ret == 0) {
+        for (i = 0, nout = 6; i < nblocks; i++)
+            nout += blocksize[i];
+        dataout = (l_uint8 *)LEPT_CALLOC(nout, sizeof(l_uint8));
+    }
+    if (dataout) {
+        if (level == 0 || level == 1)
+            flevel = 0;
+        else if (level >= 2 && level <= 5)
+            flevel = 1;
+        else if (level == 6 || level == -1)
+            flevel = 2;
+        else
+            flevel = 3;
+        dataout[0] = 0x78;  /* deflate with a 32 KB window */
+        dataout[1] = flevel << 6;
+        dataout[1] += 31 - (dataout[0] * 256 + dataout[1]) % 31;
+        adler = 1;
+        for (i = 0, nout = 2; i < nblocks; i++) {
+            memcpy(dataout + nout, blockout[i], blocksize[i]);
+            nout += blocksize[i];
+            n = L_MIN(ZLIB_BLOCK_SIZE, nin - i * ZLIB_BLOCK_SIZE);
+            adler = (i == 0) ? blockadler[0]
+                             : zng_adler32_combine(adler, blockadler[i], n);
+        }
+        dataout[nout++] = (adler >> 24) & 0xff;
+        dataout[nout++] = (adler >> 16) & 0xff;
+        dataout[nout++] = (adler >> 8) & 0xff;
+        dataout[nout++] = adler & 0xff;
+        *pnout = nout;
+    }
+
+    for (i = 0; i < nblocks; i++)
+        LEPT_FREE(blockout[i]);
+    LEPT_FREE(blockout);
+    LEPT_FREE(blocksize);
+    LEPT_FREE(blockadler);
+    if (!dataout)
+        return (l_uint8 *)ERROR_PTR("dataout not made", __func__, NULL);
+    return dataout;
+}
+
+
+/*!
+ * \brief   zlibDeflateBlock()
+ *
+ * \param[in]    datain    start of the block
+ * \param[in]    nin       number of bytes in the block
+ * \param[in]    ndict     number of bytes before %datain to use as
+ *                         the dictionary
+ * \param[in]    level     zlib compression level
+ * \param[in]    last      1 for the last block; 0 otherwise
+ * \param[out]   pdataout  raw deflate data
+ * \param[out]   pnout     number of bytes of output data
+ * \return  0 if OK, 1 on error
+ */
+static l_int32
+zlibDeflateBlock(const l_uint8  *datain,
+                 size_t          nin,
+                 size_t          ndict,
+                 l_int32         level,
+                 l_int32         last,
+                 l_uint8       **pdataout,
+                 size_t         *pnout)
+{
+l_uint8    *dataout;
+l_int32     status;
+size_t      nalloc;
+zng_stream  z;
+
+    *pdataout = NULL;
+    *pnout = 0;
+    z.zalloc = (alloc_func)0;
+    z.zfree = (free_func)0;
+    z.opaque = (voidpf)0;
+    if (zng_deflateInit2(&z, level, Z_DEFLATED, -15, 8,
+                         Z_DEFAULT_STRATEGY) != Z_OK)
+        return ERROR_INT("deflateInit2 failed", __func__, 1);
+    if (ndict > 0 &&
+        zng_deflateSetDictionary(&z, datain - ndict, ndict) != Z_OK) {
+        zng_deflateEnd(&z);
+        return ERROR_INT("dictionary not set", __func__, 1);
+    }
+
+        /* Room for the data and the trailing empty stored block */
+    nalloc = zng_deflateBound(&z, nin) + 16;
+    if ((dataout = (l_uint8 *)LEPT_MALLOC(nalloc)) == NULL) {
+        zng_deflateEnd(&z);
+        return ERROR_INT("dataout not made", __func__, 1);
+    }
+    z.next_in = (l_uint8 *)datain;
+    z.avail_in = nin;
+    z.next_out = dataout;
+    z.avail_out = nalloc;
+    status = zng_deflate(&z, (last) ? Z_FINISH : Z_SYNC_FLUSH);
+    zng_deflateEnd(&z);
+    if ((last && status != Z_STREAM_END) ||
+        (!last && (status != Z_OK || z.avail_in != 0 || z.avail_out == 0))) {
+        LEPT_FREE(dataout);
+        return ERROR_INT("block not compressed", __func__, 1);
+    }
+    *pdataout = dataout;
+    *pnout = nalloc - z.avail_out;
+    return 0;
+}
+
+
+/*!
+ * \brief   l_zlibSetThreads()
+ *
+ * \param[in]    nthreads    max number of threads; 1 for a single
+ *                           stream; 0 for all available threads
+ * \return       prev        previous number of threads
+ *
+ * <pre>
+ * Notes:
+ *      (1) This variable is used in zlibCompress(), and thus in flate
+ *          encoding of images in pdf, and in writing png, to split
+ *          large data into blocks that are compressed in parallel.
+ *          The default is 1, which gives the same single-stream output
+ *          as before.
+ *      (2) It returns the previous value, so for example:
+ *           l_int32  prev = l_zlibSetThreads(4);  // use up to 4 threads
+ *           pixWrite(...);
+ *           l_zlibSetThreads(prev);   // resets to previous value
+ *      (3) On error, logs a message and does not change the variable.
+ *          Results can be non-deterministic if it is changed while
+ *          other threads are writing.
+ * </pre>
+ */
+l_int32
+l_zlibSetThreads(l_int32  nthreads)
+{
+l_int32  prev;
+
+    prev = var_ZLIB_THREADS;
+    if (nthreads < 0)
+        L_ERROR("invalid nthreads; unchanged\n", __func__);
+    else
+        var_ZLIB_THREADS = nthreads;
+    return prev;
+}
+
+
+/*!
+ * \brief   l_zlibGetThreads()
+ *
+ * \return  max number of threads for compression; 0 for all available
+ */
+l_int32
+l_zlibGetThreads(void)
+{
+    return var_ZLIB_THREADS;
+}
+
 /* --------------------------------------------*/
 #endif  /* HAVE_LIBZ */
 /* --------------------------------------------*/
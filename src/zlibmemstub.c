@@ -54,6 +54,28 @@ l_uint8 * zlibUncompress(const l_uint8 *datain, size_t nin, size_t *pnout)
     return (l_uint8 *)ERROR_PTR("function not present", __func__, NULL);
 }
 
+/* ----------------------------------------------------------------------*/
+
+l_uint8 * zlibCompressParallel(const l_uint8 *datain, size_t nin,
+                               l_int32 level, l_int32 nthreads, size_t *pnout)
+{
+    return (l_uint8 *)ERROR_PTR("function not present", __func__, NULL);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_int32 l_zlibSetThreads(l_int32 nthreads)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
+/* ----------------------------------------------------------------------*/
+
+l_int32 l_zlibGetThreads(void)
+{
+    return ERROR_INT("function not present", __func__, 1);
+}
+
 /* --------------------------------------------*/
 #endif  /* !HAVE_LIBZ */
 /* --------------------------------------------*/
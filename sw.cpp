@@ -117,6 +117,7 @@ void build(Solution &s)
             {"conversion_reg", {"conversion_reg.c"}},
             {"convolve_reg", {"convolve_reg.c"}},
             {"crop_reg", {"crop_reg.c"}},
+            {"deflate_reg", {"deflate_reg.c"}},
             {"dewarp_reg", {"dewarp_reg.c"}},
             {"distance_reg", {"distance_reg.c"}},
             {"dither_reg", {"dither_reg.c"}},
@@ -175,6 +176,7 @@ void build(Solution &s)
             {"paintmask_reg", {"paintmask_reg.c"}},
             {"paint_reg", {"paint_reg.c"}},
             {"partition_reg", {"partition_reg.c"}},
+            {"pboxa_reg", {"pboxa_reg.c"}},
             {"pdfio1_reg", {"pdfio1_reg.c"}},
             {"pdfio2_reg", {"pdfio2_reg.c"}},
             {"pdfseg_reg", {"pdfseg_reg.c"}},
@@ -202,6 +204,7 @@ void build(Solution &s)
             {"rasteropip_reg", {"rasteropip_reg.c"}},
             {"rasterop_reg", {"rasterop_reg.c"}},
             {"rectangle_reg", {"rectangle_reg.c"}},
+            {"rlpix_reg", {"rlpix_reg.c"}},
             {"rotate1_reg", {"rotate1_reg.c"}},
             {"rotate2_reg", {"rotate2_reg.c"}},
             {"scale_reg", {"scale_reg.c"}},
@@ -217,6 +220,8 @@ void build(Solution &s)
             {"subpixel_reg", {"subpixel_reg.c"}},
             {"texturefill_reg", {"texturefill_reg.c"}},
             {"threshnorm_reg", {"threshnorm_reg.c"}},
+            {"tiffbands_reg", {"tiffbands_reg.c"}},
+            {"tiffindex_reg", {"tiffindex_reg.c"}},
             {"translate_reg", {"translate_reg.c"}},
             {"warper_reg", {"warper_reg.c"}},
             {"watershed_reg", {"watershed_reg.c"}},
@@ -319,6 +324,7 @@ void build(Solution &s)
             {"pixaatest", {"pixaatest.c"}},
             {"pixafileinfo", {"pixafileinfo.c"}},
             {"plottest", {"plottest.c"}},
+            {"pngpresets", {"pngpresets.c"}},
             {"printimage", {"printimage.c"}},
             {"printsplitimage", {"printsplitimage.c"}},
             {"printtiff", {"printtiff.c"}},